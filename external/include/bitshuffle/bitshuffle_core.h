@@ -78,6 +78,21 @@ int bshuf_using_SSE2(void);
 int bshuf_using_AVX2(void);
 
 
+/* ---- bshuf_host_supports_AVX2 ----
+ *
+ * Whether the AVX2 routines can run on the host processor. When the
+ * routines were compiled for a non-AVX2 target with runtime dispatch
+ * support, this queries the host CPU; otherwise it matches
+ * bshuf_using_AVX2.
+ *
+ * Returns
+ * -------
+ *  1 if the AVX2 routines can be used, 0 otherwise.
+ *
+ */
+int bshuf_host_supports_AVX2(void);
+
+
 /* ---- bshuf_default_block_size ----
  *
  * The default block size as function of element size.
@@ -23,12 +23,26 @@
 
 #if defined(__AVX2__) && defined (__SSE2__)
 #define USEAVX2
+#elif defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+/* The compilation target lacks AVX2, but the compiler can still emit the
+ * AVX2 kernels with a per-function target attribute. They are selected at
+ * runtime when the host CPU supports them. */
+#define USEAVX2
+#define USEAVX2RUNTIME
 #endif
 
 #if defined(__SSE2__)
 #define USESSE2
 #endif
 
+/* Attribute for functions containing AVX2 instructions when the rest of the
+ * translation unit is compiled for a non-AVX2 target. */
+#ifdef USEAVX2RUNTIME
+#define BSHUF_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#else
+#define BSHUF_TARGET_AVX2
+#endif
+
 
 // Conditional includes for SSE2 and AVX2.
 #ifdef USEAVX2
@@ -63,6 +77,20 @@ int bshuf_using_AVX2(void) {
 }
 
 
+int bshuf_host_supports_AVX2(void) {
+#ifdef USEAVX2RUNTIME
+    static int supported = -1;
+    if (supported < 0)
+        supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+    return supported;
+#elif defined(USEAVX2)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+
 /* ---- Worker code not requiring special instruction sets. ----
  *
  * The following code does not use any x86 specific vectorized instructions
@@ -897,6 +925,7 @@ int64_t bshuf_shuffle_bit_eightelem_SSE(const void* in, void* out, const size_t
 #ifdef USEAVX2
 
 /* Transpose bits within bytes. */
+BSHUF_TARGET_AVX2
 int64_t bshuf_trans_bit_byte_AVX(const void* in, void* out, const size_t size,
          const size_t elem_size) {
 
@@ -928,6 +957,7 @@ int64_t bshuf_trans_bit_byte_AVX(const void* in, void* out, const size_t size,
 
 
 /* Transpose bits within elements. */
+BSHUF_TARGET_AVX2
 int64_t bshuf_trans_bit_elem_AVX(const void* in, void* out, const size_t size,
          const size_t elem_size) {
 
@@ -952,6 +982,7 @@ int64_t bshuf_trans_bit_elem_AVX(const void* in, void* out, const size_t size,
 
 /* For data organized into a row for each bit (8 * elem_size rows), transpose
  * the bytes. */
+BSHUF_TARGET_AVX2
 int64_t bshuf_trans_byte_bitrow_AVX(const void* in, void* out, const size_t size,
          const size_t elem_size) {
 
@@ -1047,6 +1078,7 @@ int64_t bshuf_trans_byte_bitrow_AVX(const void* in, void* out, const size_t size
 
 
 /* Shuffle bits within the bytes of eight element blocks. */
+BSHUF_TARGET_AVX2
 int64_t bshuf_shuffle_bit_eightelem_AVX(const void* in, void* out, const size_t size,
          const size_t elem_size) {
 
@@ -1084,6 +1116,7 @@ int64_t bshuf_shuffle_bit_eightelem_AVX(const void* in, void* out, const size_t
 
 
 /* Untranspose bits within elements. */
+BSHUF_TARGET_AVX2
 int64_t bshuf_untrans_bit_elem_AVX(const void* in, void* out, const size_t size,
          const size_t elem_size) {
 
@@ -1157,15 +1190,19 @@ int64_t bshuf_untrans_bit_elem_AVX(const void* in, void* out, const size_t size,
 #endif // #ifdef USEAVX2
 
 
-/* ---- Drivers selecting best instruction set at compile time. ---- */
+/* ---- Drivers selecting best instruction set at runtime. ---- */
 
-int64_t bshuf_trans_bit_elem(const void* in, void* out, const size_t size, 
+int64_t bshuf_trans_bit_elem(const void* in, void* out, const size_t size,
         const size_t elem_size) {
 
     int64_t count;
 #ifdef USEAVX2
-    count = bshuf_trans_bit_elem_AVX(in, out, size, elem_size);
-#elif defined(USESSE2)
+    if (bshuf_host_supports_AVX2()) {
+        count = bshuf_trans_bit_elem_AVX(in, out, size, elem_size);
+        return count;
+    }
+#endif
+#ifdef USESSE2
     count = bshuf_trans_bit_elem_SSE(in, out, size, elem_size);
 #else
     count = bshuf_trans_bit_elem_scal(in, out, size, elem_size);
@@ -1174,13 +1211,17 @@ int64_t bshuf_trans_bit_elem(const void* in, void* out, const size_t size,
 }
 
 
-int64_t bshuf_untrans_bit_elem(const void* in, void* out, const size_t size, 
+int64_t bshuf_untrans_bit_elem(const void* in, void* out, const size_t size,
         const size_t elem_size) {
 
     int64_t count;
 #ifdef USEAVX2
-    count = bshuf_untrans_bit_elem_AVX(in, out, size, elem_size);
-#elif defined(USESSE2)
+    if (bshuf_host_supports_AVX2()) {
+        count = bshuf_untrans_bit_elem_AVX(in, out, size, elem_size);
+        return count;
+    }
+#endif
+#ifdef USESSE2
     count = bshuf_untrans_bit_elem_SSE(in, out, size, elem_size);
 #else
     count = bshuf_untrans_bit_elem_scal(in, out, size, elem_size);
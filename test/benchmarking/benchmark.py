@@ -132,6 +132,47 @@ def print_results(results):
         print('{:<30s}{:>60d} ms'.format(bench, min(results[bench])))
 
 
+def write_results(results, path):
+    """Writes benchmark timing results to a JSON baseline file."""
+    baseline = {bench: {'trials_ms': times, 'min_ms': min(times)}
+                for bench, times in results.items()}
+    with open(path, 'w') as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.write('\n')
+    print('Wrote results to {}'.format(path))
+
+
+def compare_results(results, baseline_path, threshold_pct):
+    """
+    Compares benchmark timing results against a JSON baseline file.
+
+    :return: True if no benchmark regressed by more than threshold_pct.
+    """
+    with open(baseline_path) as f:
+        baseline = json.load(f)
+
+    print('Comparing against {} (threshold: {}%):'.format(
+        baseline_path, threshold_pct))
+    print('-' * 93)
+    ok = True
+    for bench in sorted(results.keys()):
+        if bench not in baseline:
+            print('{:<40s}{:>53s}'.format(bench, 'no baseline'))
+            continue
+        baseline_ms = baseline[bench]['min_ms']
+        current_ms = min(results[bench])
+        if baseline_ms > 0:
+            change_pct = 100.0 * (current_ms - baseline_ms) / baseline_ms
+        else:
+            change_pct = 0.0
+        regressed = change_pct > threshold_pct
+        ok = ok and not regressed
+        print('{:<40s}{:>15d} ms{:>15d} ms{:>+10.1f}% {}'.format(
+            bench, baseline_ms, current_ms, change_pct,
+            'REGRESSED' if regressed else 'ok'))
+    return ok
+
+
 def run_benchmarks(args):
     """Runs the benchmark programs."""
     if args.benchmarks is None:
@@ -170,6 +211,7 @@ def run_benchmarks(args):
         p.stop()
 
     print_results(results)
+    return results
 
 
 def main():
@@ -183,6 +225,17 @@ def main():
     parser.add_argument('-b', '--benchmarks', metavar='NAMES',
                         help='If given, one or more comma-separated names of '
                              'benchmarks to run.')
+    parser.add_argument('-j', '--json', metavar='FILE',
+                        help='If given, write the results to FILE as a JSON '
+                             'baseline.')
+    parser.add_argument('-c', '--compare', metavar='BASELINE',
+                        help='If given, compare the results against the JSON '
+                             'baseline in BASELINE and exit with an error if '
+                             'any benchmark regressed beyond the threshold.')
+    parser.add_argument('-t', '--threshold', metavar='PCT', type=float,
+                        default=10.0,
+                        help='Regression threshold percentage used with '
+                             '--compare (default: 10).')
     args = parser.parse_args()
 
     if find_tiledb_path(args) is None:
@@ -196,7 +249,14 @@ def main():
         list_benchmarks(show=True)
         sys.exit(0)
 
-    run_benchmarks(args)
+    results = run_benchmarks(args)
+
+    if args.json is not None:
+        write_results(results, args.json)
+
+    if args.compare is not None:
+        if not compare_results(results, args.compare, args.threshold):
+            sys.exit(1)
 
 
 if __name__ == '__main__':
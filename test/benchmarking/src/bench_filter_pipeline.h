@@ -0,0 +1,224 @@
+/**
+ * @file   bench_filter_pipeline.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Declares the shared implementation of the filter pipeline benchmarks.
+ * Each bench_filter_pipeline_* program instantiates it with one codec
+ * pipeline; the benchmark exercises the pipeline's forward pass (a write
+ * to a scratch array) and reverse pass (full reads, with the default and
+ * a single-threaded context) over several datatypes and chunk sizes.
+ */
+
+#ifndef TILEDB_BENCH_FILTER_PIPELINE_H
+#define TILEDB_BENCH_FILTER_PIPELINE_H
+
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+class FilterPipelineBenchmark : public BenchmarkBase {
+ public:
+  /**
+   * @param name Name of the benchmark, used for the array URIs.
+   * @param filters The filter pipeline to benchmark, as pairs of filter
+   *    type and compression level (0 means the filter's default level).
+   * @param integer_only If true, skip the floating point attribute (for
+   *    codecs that only accept integer input).
+   */
+  FilterPipelineBenchmark(
+      std::string name,
+      std::vector<std::pair<tiledb_filter_type_t, int32_t>> filters,
+      bool integer_only = false)
+      : array_uri_(name + "_array")
+      , scratch_uri_(name + "_scratch")
+      , filters_(std::move(filters))
+      , integer_only_(integer_only) {
+  }
+
+ protected:
+  virtual void setup() {
+    tiledb::Array::create(array_uri_, make_schema());
+
+    int32_data_.resize(num_cells_);
+    std::iota(int32_data_.begin(), int32_data_.end(), 0);
+
+    uint64_data_.resize(num_cells_);
+    std::iota(uint64_data_.begin(), uint64_data_.end(), 0);
+
+    if (!integer_only_) {
+      float64_data_.resize(num_cells_);
+      for (uint64_t i = 0; i < num_cells_; i++) {
+        float64_data_[i] = 0.5 * static_cast<double>(i);
+      }
+    }
+
+    write_array(array_uri_);
+  }
+
+  virtual void teardown() {
+    tiledb::VFS vfs(ctx_);
+    for (const auto& uri : {array_uri_, scratch_uri_}) {
+      if (vfs.is_dir(uri)) {
+        vfs.remove_dir(uri);
+      }
+    }
+  }
+
+  virtual void pre_run() {
+    int32_data_.resize(num_cells_);
+    uint64_data_.resize(num_cells_);
+    if (!integer_only_) {
+      float64_data_.resize(num_cells_);
+    }
+
+    // Remove the scratch array of a previous run so the timed write always
+    // creates the first fragment.
+    tiledb::VFS vfs(ctx_);
+    if (vfs.is_dir(scratch_uri_)) {
+      vfs.remove_dir(scratch_uri_);
+    }
+  }
+
+  virtual void run() {
+    // Forward pass: write all attributes through the pipeline.
+    tiledb::Array::create(scratch_uri_, make_schema());
+    write_array(scratch_uri_);
+
+    // Reverse pass: full read with the default thread pool.
+    read_array(ctx_);
+
+    // Reverse pass again with a single thread, so regressions that only
+    // show without parallelism across chunks are not averaged away.
+    tiledb::Config config;
+    config["sm.compute_concurrency_level"] = "1";
+    tiledb::Context single_threaded_ctx(config);
+    read_array(single_threaded_ctx);
+  }
+
+ private:
+  /**
+   * Creates the array schema: each datatype is stored once with the
+   * default max chunk size and once with 1MB chunks, each attribute
+   * filtered by the benchmarked pipeline.
+   */
+  tiledb::ArraySchema make_schema() {
+    tiledb::Domain domain(ctx_);
+    domain.add_dimension(tiledb::Dimension::create<uint64_t>(
+        ctx_, "d", {{0, num_cells_ - 1}}, tile_extent_));
+
+    tiledb::ArraySchema schema(ctx_, TILEDB_DENSE);
+    schema.set_domain(domain);
+
+    for (const auto& [suffix, chunk_size] : chunk_configs_) {
+      tiledb::FilterList filter_list(ctx_);
+      for (const auto& [type, level] : filters_) {
+        tiledb::Filter filter(ctx_, type);
+        if (level != 0) {
+          filter.set_option(TILEDB_COMPRESSION_LEVEL, level);
+        }
+        filter_list.add_filter(filter);
+      }
+      if (chunk_size != 0) {
+        filter_list.set_max_chunk_size(chunk_size);
+      }
+
+      schema.add_attribute(tiledb::Attribute::create<int32_t>(
+          ctx_, "a_int32" + suffix, filter_list));
+      schema.add_attribute(tiledb::Attribute::create<uint64_t>(
+          ctx_, "a_uint64" + suffix, filter_list));
+      if (!integer_only_) {
+        schema.add_attribute(tiledb::Attribute::create<double>(
+            ctx_, "a_float64" + suffix, filter_list));
+      }
+    }
+
+    return schema;
+  }
+
+  /** Writes all attributes to the array at `uri`. */
+  void write_array(const std::string& uri) {
+    tiledb::Array array(ctx_, uri, TILEDB_WRITE);
+    tiledb::Query query(ctx_, array, TILEDB_WRITE);
+    query
+        .set_subarray(tiledb::Subarray(ctx_, array)
+                          .set_subarray<uint64_t>({0, num_cells_ - 1}))
+        .set_layout(TILEDB_ROW_MAJOR);
+    set_buffers(query);
+    query.submit();
+    array.close();
+  }
+
+  /** Reads back all attributes of the main array with the given context. */
+  void read_array(tiledb::Context& ctx) {
+    tiledb::Array array(ctx, array_uri_, TILEDB_READ);
+    tiledb::Query query(ctx, array);
+    query
+        .set_subarray(tiledb::Subarray(ctx, array).set_subarray<uint64_t>(
+            {0, num_cells_ - 1}))
+        .set_layout(TILEDB_ROW_MAJOR);
+    set_buffers(query);
+    query.submit();
+    array.close();
+  }
+
+  /** Sets the data buffer of every attribute on a query. */
+  void set_buffers(tiledb::Query& query) {
+    for (const auto& [suffix, chunk_size] : chunk_configs_) {
+      (void)chunk_size;
+      query.set_data_buffer("a_int32" + suffix, int32_data_);
+      query.set_data_buffer("a_uint64" + suffix, uint64_data_);
+      if (!integer_only_) {
+        query.set_data_buffer("a_float64" + suffix, float64_data_);
+      }
+    }
+  }
+
+  const std::string array_uri_;
+  const std::string scratch_uri_;
+  const std::vector<std::pair<tiledb_filter_type_t, int32_t>> filters_;
+  const bool integer_only_;
+
+  const uint64_t num_cells_ = 1 << 23;
+  const uint64_t tile_extent_ = 1 << 20;
+
+  /** Attribute name suffix and max chunk size (0 keeps the default). */
+  const std::vector<std::pair<std::string, uint32_t>> chunk_configs_ = {
+      {"_default_chunk", 0}, {"_1mb_chunk", 1024 * 1024}};
+
+  tiledb::Context ctx_;
+  std::vector<int32_t> int32_data_;
+  std::vector<uint64_t> uint64_data_;
+  std::vector<double> float64_data_;
+};
+
+#endif
@@ -490,6 +490,104 @@ TEST_CASE_METHOD(
   remove_array(array_name);
 }
 
+TEST_CASE_METHOD(
+    DenseTilerFx,
+    "DenseTiler: Test get tile, 1D, tile-aligned zero-copy",
+    "[DenseTiler][get_tile][1d][zero_copy]") {
+  // Create array
+  std::string array_name = "dense_tiler";
+  int32_t d_dom[] = {1, 10};
+  int32_t d_ext = 5;
+  create_array(
+      array_name,
+      {{"d", TILEDB_INT32, d_dom, &d_ext}},
+      {{"a", TILEDB_INT32, 1, false}},
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Create buffers covering both tiles exactly
+  std::unordered_map<std::string, QueryBuffer> buffers;
+  std::vector<int32_t> buff_a = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  uint64_t buff_a_size = buff_a.size() * sizeof(int32_t);
+  buffers["a"] = QueryBuffer(&buff_a[0], nullptr, &buff_a_size, nullptr);
+
+  // Create tile-aligned subarray
+  open_array(array_name, TILEDB_READ);
+  int32_t sub1[] = {1, 10};
+  tiledb::sm::Subarray subarray1(
+      array_->array_.get(),
+      Layout::ROW_MAJOR,
+      &test::g_helper_stats,
+      test::g_helper_logger());
+  add_ranges({sub1}, sizeof(sub1), &subarray1);
+
+  // Create DenseTiler
+  DenseTiler<int32_t> tiler1(
+      tracker_, &buffers, &subarray1, &test::g_helper_stats);
+
+  // Both tiles alias the user buffer instead of copying it
+  WriterTileTuple tile1_0(
+      array_->array_->array_schema_latest(),
+      array_->array_->array_schema_latest().domain().cell_num_per_tile(),
+      false,
+      false,
+      sizeof(int32_t),
+      Datatype::INT32,
+      tracker_);
+  CHECK(tiler1.get_tile(0, "a", tile1_0).ok());
+  CHECK(tile1_0.fixed_tile().has_data_alias());
+  CHECK(tile1_0.fixed_tile().data() == &buff_a[0]);
+  std::vector<int32_t> c_data1_0 = {1, 2, 3, 4, 5};
+  CHECK(check_tile<int32_t>(tile1_0.fixed_tile(), c_data1_0));
+
+  WriterTileTuple tile1_1(
+      array_->array_->array_schema_latest(),
+      array_->array_->array_schema_latest().domain().cell_num_per_tile(),
+      false,
+      false,
+      sizeof(int32_t),
+      Datatype::INT32,
+      tracker_);
+  CHECK(tiler1.get_tile(1, "a", tile1_1).ok());
+  CHECK(tile1_1.fixed_tile().has_data_alias());
+  CHECK(tile1_1.fixed_tile().data() == &buff_a[5]);
+  std::vector<int32_t> c_data1_1 = {6, 7, 8, 9, 10};
+  CHECK(check_tile<int32_t>(tile1_1.fixed_tile(), c_data1_1));
+
+  // Create subarray that is not tile-aligned
+  close_array();
+  open_array(array_name, TILEDB_READ);
+  int32_t sub2[] = {3, 6};
+  tiledb::sm::Subarray subarray2(
+      array_->array_.get(),
+      Layout::ROW_MAJOR,
+      &test::g_helper_stats,
+      test::g_helper_logger());
+  add_ranges({sub2}, sizeof(sub2), &subarray2);
+
+  // Create DenseTiler
+  DenseTiler<int32_t> tiler2(
+      tracker_, &buffers, &subarray2, &test::g_helper_stats);
+
+  // A partially covered tile is copied, not aliased
+  WriterTileTuple tile2(
+      array_->array_->array_schema_latest(),
+      array_->array_->array_schema_latest().domain().cell_num_per_tile(),
+      false,
+      false,
+      sizeof(int32_t),
+      Datatype::INT32,
+      tracker_);
+  CHECK(tiler2.get_tile(0, "a", tile2).ok());
+  CHECK(!tile2.fixed_tile().has_data_alias());
+  std::vector<int32_t> c_data2 = {fill_value, fill_value, 1, 2, 3};
+  CHECK(check_tile<int32_t>(tile2.fixed_tile(), c_data2));
+
+  // Clean up
+  close_array();
+  remove_array(array_name);
+}
+
 TEST_CASE_METHOD(
     DenseTilerFx,
     "DenseTiler: Test get tile, 1D, tile exceeding array domain",
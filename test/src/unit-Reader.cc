@@ -183,6 +183,7 @@ TEST_CASE_METHOD(
       Layout::ROW_MAJOR,
       condition,
       default_channel_aggregates,
+      CancellationSource(),
       false);
   Reader reader(&g_helper_stats, g_helper_logger(), params);
   unsigned dim_num = 2;
@@ -678,6 +678,22 @@ TEST_CASE_METHOD(
     rc = tiledb_array_open(ctx_, array2, TILEDB_READ);
     REQUIRE(rc == TILEDB_ERR);
 
+    // Opening with a wrong key on the same context must still fail after the
+    // correct-key open above warmed the generic tile cache with the decrypted
+    // schema; the cache key includes a digest of the encryption key, so the
+    // wrong key misses the cache and fails authentication on the read path.
+    tiledb_array_t* array3;
+    rc = tiledb_array_alloc(ctx_, array_name.c_str(), &array3);
+    REQUIRE(rc == TILEDB_OK);
+    rc = tiledb_array_set_config(ctx_, array3, cfg);
+    REQUIRE(rc == TILEDB_OK);
+    rc = tiledb_array_open(ctx_, array3, TILEDB_READ);
+    REQUIRE(rc == TILEDB_ERR);
+    rc = tiledb_array_is_open(ctx_, array3, &is_open);
+    REQUIRE(rc == TILEDB_OK);
+    REQUIRE(is_open == 0);
+    tiledb_array_free(&array3);
+
     // Close arrays
     rc = tiledb_array_close(ctx_, array2);
     REQUIRE(
@@ -233,6 +233,8 @@ void check_save_to_file() {
   ss << "rest.load_enumerations_on_array_open true\n";
   ss << "rest.load_metadata_on_array_open true\n";
   ss << "rest.load_non_empty_domain_on_array_open true\n";
+  ss << "rest.payload_buffer_alignment 0\n";
+  ss << "rest.query_deadline_ms 0\n";
   ss << "rest.retry_count 25\n";
   ss << "rest.retry_delay_factor 1.25\n";
   ss << "rest.retry_http_codes 503\n";
@@ -246,30 +248,45 @@ void check_save_to_file() {
   ss << "sm.check_coord_dups true\n";
   ss << "sm.check_coord_oob true\n";
   ss << "sm.check_global_order true\n";
+  ss << "sm.compress_tile_offsets false\n";
   ss << "sm.compute_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
   ss << "sm.consolidation.amplification 1.0\n";
+  ss << "sm.consolidation.array_metadata_index false\n";
   ss << "sm.consolidation.buffer_size 50000000\n";
+  ss << "sm.consolidation.commits_manifest false\n";
+  ss << "sm.consolidation.max_concurrent_nodes 1\n";
   ss << "sm.consolidation.max_fragment_size " << std::to_string(UINT64_MAX)
      << "\n";
   ss << "sm.consolidation.mode fragments\n";
+  ss << "sm.consolidation.overlap_clusters false\n";
+  ss << "sm.consolidation.pass_through false\n";
   ss << "sm.consolidation.purge_deleted_cells false\n";
   ss << "sm.consolidation.step_max_frags 4294967295\n";
   ss << "sm.consolidation.step_min_frags 4294967295\n";
   ss << "sm.consolidation.step_size_ratio 0.0\n";
   ss << "sm.consolidation.steps 4294967295\n";
+  ss << "sm.consolidation.streaming false\n";
   ss << "sm.consolidation.timestamp_end " << std::to_string(UINT64_MAX) << "\n";
   ss << "sm.consolidation.timestamp_start 0\n";
   ss << "sm.dedup_coords false\n";
   ss << "sm.enable_signal_handlers true\n";
   ss << "sm.encryption_type NO_ENCRYPTION\n";
+  ss << "sm.enumeration_cache_size 50000000\n";
   ss << "sm.enumerations_max_size 10485760\n";
   ss << "sm.enumerations_max_total_size 52428800\n";
+  ss << "sm.est_result_size.max_sampled_tiles 0\n";
+  ss << "sm.filter.dictionary_decode_table_cache false\n";
+  ss << "sm.fragment_info.lazy_load false\n";
+  ss << "sm.fragment_info.load_from_summary false\n";
   ss << "sm.fragment_info.preload_mbrs false\n";
+  ss << "sm.fragment_meta_cache_size 10000000\n";
+  ss << "sm.generic_tile_cache_size 10000000\n";
   ss << "sm.group.timestamp_end 18446744073709551615\n";
   ss << "sm.group.timestamp_start 0\n";
   ss << "sm.io_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
+  ss << "sm.label_range_cache_size 1000000\n";
   ss << "sm.max_tile_overlap_size 314572800\n";
   ss << "sm.mem.consolidation.buffers_weight 1\n";
   ss << "sm.mem.consolidation.reader_weight 3\n";
@@ -286,27 +303,42 @@ void check_save_to_file() {
   ss << "sm.memory_budget 5368709120\n";
   ss << "sm.memory_budget_var 10737418240\n";
   ss << "sm.merge_overlapping_ranges_experimental true\n";
+  ss << "sm.numa_pinning false\n";
   ss << "sm.partial_tile_offsets_loading false\n";
+  ss << "sm.query.admission.memory_budget 0\n";
+  ss << "sm.query.admission.queue_timeout_ms 300000\n";
+  ss << "sm.query.condition.adaptive_order true\n";
   ss << "sm.query.dense.qc_coords_mode false\n";
   ss << "sm.query.dense.reader refactored\n";
+  ss << "sm.query.sparse_global_order.pipelined_unfilter false\n";
   ss << "sm.query.sparse_global_order.reader refactored\n";
+  ss << "sm.query.sparse_unordered_with_dups.dedup false\n";
+  ss << "sm.query.sparse_unordered_with_dups.prefetch_tile_count 0\n";
   ss << "sm.query.sparse_unordered_with_dups.reader refactored\n";
+  ss << "sm.query.streamed_var_read_min_tile_size 0\n";
+  ss << "sm.query.unordered_writer.streaming_ingest false\n";
+  ss << "sm.query.zero_copy_unfiltered_tiles false\n";
   ss << "sm.read_range_oob warn\n";
   ss << "sm.skip_checksum_validation false\n";
   ss << "sm.skip_est_size_partitioning false\n";
   ss << "sm.skip_unary_partitioning_budget_check false\n";
+  ss << "sm.tile_cache_size 10000000\n";
   ss << "sm.vacuum.mode fragments\n";
   ss << "sm.var_offsets.bitsize 64\n";
   ss << "sm.var_offsets.extra_element false\n";
   ss << "sm.var_offsets.mode bytes\n";
   ss << "ssl.verify true\n";
   ss << "vfs.azure.block_list_block_size 5242880\n";
+  ss << "vfs.azure.max_inflight_blocks 0\n";
   ss << "vfs.azure.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
   ss << "vfs.azure.max_retries 5\n";
   ss << "vfs.azure.max_retry_delay_ms 60000\n";
   ss << "vfs.azure.retry_delay_ms 800\n";
   ss << "vfs.azure.use_block_list_upload true\n";
+  ss << "vfs.block_cache.block_size 4194304\n";
+  ss << "vfs.block_cache.size 10737418240\n";
+  ss << "vfs.file.mmap_reads false\n";
   ss << "vfs.file.posix_directory_permissions 755\n";
   ss << "vfs.file.posix_file_permissions 644\n";
   ss << "vfs.gcs.max_direct_upload_size 10737418240\n";
@@ -316,6 +348,7 @@ void check_save_to_file() {
   ss << "vfs.gcs.request_timeout_ms 3000\n";
   ss << "vfs.gcs.use_multi_part_upload true\n";
   ss << "vfs.max_batch_size 104857600\n";
+  ss << "vfs.max_concurrent_reads 128\n";
   ss << "vfs.min_batch_gap 512000\n";
   ss << "vfs.min_batch_size 20971520\n";
   ss << "vfs.min_parallel_size 10485760\n";
@@ -330,6 +363,7 @@ void check_save_to_file() {
   ss << "vfs.s3.logging_level Off\n";
   ss << "vfs.s3.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
+  ss << "vfs.s3.max_request_rate 0.0\n";
   ss << "vfs.s3.multipart_part_size 5242880\n";
   ss << "vfs.s3.no_sign_request false\n";
   ss << "vfs.s3.object_canned_acl NOT_SET\n";
@@ -603,6 +637,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["rest.server_address"] = "https://api.tiledb.com";
   all_param_values["rest.server_serialization_format"] = "CAPNP";
   all_param_values["rest.http_compressor"] = "any";
+  all_param_values["rest.query_deadline_ms"] = "0";
   all_param_values["rest.retry_count"] = "25";
   all_param_values["rest.retry_delay_factor"] = "1.25";
   all_param_values["rest.retry_initial_delay_ms"] = "500";
@@ -616,6 +651,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["rest.use_refactored_array_open"] = "true";
   all_param_values["rest.use_refactored_array_open_and_query_submit"] = "true";
   all_param_values["rest.payer_namespace"] = "";
+  all_param_values["rest.payload_buffer_alignment"] = "0";
   all_param_values["sm.allow_separate_attribute_writes"] = "false";
   all_param_values["sm.allow_updates_experimental"] = "false";
   all_param_values["sm.encryption_key"] = "";
@@ -624,6 +660,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.partial_tile_offsets_loading"] = "false";
   all_param_values["sm.enumerations_max_size"] = "10485760";
   all_param_values["sm.enumerations_max_total_size"] = "52428800";
+  all_param_values["sm.est_result_size.max_sampled_tiles"] = "0";
   all_param_values["sm.check_coord_dups"] = "true";
   all_param_values["sm.check_coord_oob"] = "true";
   all_param_values["sm.check_global_order"] = "true";
@@ -632,10 +669,21 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.skip_unary_partitioning_budget_check"] = "false";
   all_param_values["sm.memory_budget"] = "5368709120";
   all_param_values["sm.memory_budget_var"] = "10737418240";
+  all_param_values["sm.tile_cache_size"] = "10000000";
+  all_param_values["sm.query.admission.memory_budget"] = "0";
+  all_param_values["sm.query.admission.queue_timeout_ms"] = "300000";
+  all_param_values["sm.query.condition.adaptive_order"] = "true";
   all_param_values["sm.query.dense.qc_coords_mode"] = "false";
   all_param_values["sm.query.dense.reader"] = "refactored";
+  all_param_values["sm.query.sparse_global_order.pipelined_unfilter"] = "false";
   all_param_values["sm.query.sparse_global_order.reader"] = "refactored";
+  all_param_values["sm.query.sparse_unordered_with_dups.dedup"] = "false";
+  all_param_values["sm.query.sparse_unordered_with_dups.prefetch_tile_count"] =
+      "0";
   all_param_values["sm.query.sparse_unordered_with_dups.reader"] = "refactored";
+  all_param_values["sm.query.streamed_var_read_min_tile_size"] = "0";
+  all_param_values["sm.query.unordered_writer.streaming_ingest"] = "false";
+  all_param_values["sm.query.zero_copy_unfiltered_tiles"] = "false";
   all_param_values["sm.mem.consolidation.buffers_weight"] = "1";
   all_param_values["sm.mem.consolidation.reader_weight"] = "3";
   all_param_values["sm.mem.consolidation.writer_weight"] = "2";
@@ -658,15 +706,23 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.group.timestamp_start"] = "0";
   all_param_values["sm.compute_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["sm.numa_pinning"] = "false";
   all_param_values["sm.io_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["sm.skip_checksum_validation"] = "false";
+  all_param_values["sm.filter.dictionary_decode_table_cache"] = "false";
   all_param_values["sm.consolidation.amplification"] = "1.0";
   all_param_values["sm.consolidation.steps"] = "4294967295";
   all_param_values["sm.consolidation.timestamp_start"] = "0";
   all_param_values["sm.consolidation.timestamp_end"] =
       std::to_string(UINT64_MAX);
   all_param_values["sm.consolidation.purge_deleted_cells"] = "false";
+  all_param_values["sm.consolidation.overlap_clusters"] = "false";
+  all_param_values["sm.consolidation.streaming"] = "false";
+  all_param_values["sm.consolidation.pass_through"] = "false";
+  all_param_values["sm.consolidation.max_concurrent_nodes"] = "1";
+  all_param_values["sm.consolidation.commits_manifest"] = "false";
+  all_param_values["sm.consolidation.array_metadata_index"] = "false";
   all_param_values["sm.consolidation.step_min_frags"] = "4294967295";
   all_param_values["sm.consolidation.step_max_frags"] = "4294967295";
   all_param_values["sm.consolidation.buffer_size"] = "50000000";
@@ -680,14 +736,26 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.var_offsets.extra_element"] = "true";
   all_param_values["sm.var_offsets.mode"] = "elements";
   all_param_values["sm.max_tile_overlap_size"] = "314572800";
+  all_param_values["sm.fragment_info.lazy_load"] = "false";
+  all_param_values["sm.fragment_info.load_from_summary"] = "false";
   all_param_values["sm.fragment_info.preload_mbrs"] = "true";
+  all_param_values["sm.fragment_meta_cache_size"] = "10000000";
+  all_param_values["sm.enumeration_cache_size"] = "50000000";
+  all_param_values["sm.generic_tile_cache_size"] = "10000000";
+  all_param_values["sm.label_range_cache_size"] = "1000000";
   all_param_values["sm.partial_tile_offsets_loading"] = "false";
+  all_param_values["sm.compress_tile_offsets"] = "false";
 
   all_param_values["ssl.ca_file"] = "";
   all_param_values["ssl.ca_path"] = "";
   all_param_values["ssl.verify"] = "true";
 
   all_param_values["vfs.max_batch_size"] = "104857600";
+  all_param_values["vfs.max_concurrent_reads"] = "128";
+  all_param_values["vfs.file.mmap_reads"] = "false";
+  all_param_values["vfs.block_cache.dir"] = "";
+  all_param_values["vfs.block_cache.size"] = "10737418240";
+  all_param_values["vfs.block_cache.block_size"] = "4194304";
   all_param_values["vfs.min_batch_gap"] = "512000";
   all_param_values["vfs.min_batch_size"] = "20971520";
   all_param_values["vfs.min_parallel_size"] = "10485760";
@@ -710,6 +778,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.azure.storage_sas_token"] = "";
   all_param_values["vfs.azure.blob_endpoint"] = "";
   all_param_values["vfs.azure.block_list_block_size"] = "5242880";
+  all_param_values["vfs.azure.max_inflight_blocks"] = "0";
   all_param_values["vfs.azure.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["vfs.azure.use_block_list_upload"] = "true";
@@ -739,6 +808,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.s3.connect_timeout_ms"] = "10800";
   all_param_values["vfs.s3.connect_max_tries"] = "5";
   all_param_values["vfs.s3.connect_scale_factor"] = "25";
+  all_param_values["vfs.s3.max_request_rate"] = "0.0";
   all_param_values["vfs.s3.sse"] = "";
   all_param_values["vfs.s3.sse_kms_key_id"] = "";
   all_param_values["vfs.s3.storage_class"] = "NOT_SET";
@@ -739,3 +739,87 @@ TEST_CASE("Compression-RLE: Test empty input", "[compression][rle][rle-num]") {
   tiledb::sm::RLE::decompress<uint64_t>(compressed, decompressed);
   CHECK(decompressed == uncompressed);
 }
+
+TEST_CASE(
+    "Compression-RLE: Test skip index and mid-chunk decompression of strings",
+    "[compression][rle][rle-strings]") {
+  std::string str1 = "HG543232";
+  std::string str2 = "HG54";
+  std::string str3 = "A";
+  std::string str4 = "HG5";
+  std::string_view uncompressed[] = {
+      str1, str1, str1, str2, str2, str3, str4, str4, str4, str4};
+  const uint64_t num_cells = 10;
+
+  // Compress the input array
+  const auto exp_size = 4 * (sizeof(uint8_t) + sizeof(uint8_t)) + str1.size() +
+                        str2.size() + str3.size() + str4.size();
+  std::vector<std::byte> compressed(exp_size);
+  tiledb::sm::RLE::compress<uint8_t, uint8_t>(uncompressed, compressed);
+
+  // Reference full decompression
+  const uint64_t total_size = 3 * str1.size() + 2 * str2.size() + str3.size() +
+                              4 * str4.size();
+  std::vector<std::byte> full(total_size);
+  std::vector<uint64_t> full_offsets(num_cells);
+  tiledb::sm::RLE::decompress<uint8_t, uint8_t>(compressed, full, full_offsets);
+
+  // The index stores every other run with its cumulative output positions
+  auto index = tiledb::sm::RLE::build_skip_index(compressed, 1, 1, 2);
+  REQUIRE(index.size() == 2);
+  CHECK(index[0].input_offset == 0);
+  CHECK(index[0].output_cell == 0);
+  CHECK(index[0].output_offset == 0);
+  CHECK(index[1].input_offset == 2 * 2 + str1.size() + str2.size());
+  CHECK(index[1].output_cell == 5);
+  CHECK(index[1].output_offset == 3 * str1.size() + 2 * str2.size());
+
+  // Decode every possible cell range and compare to the full decode
+  for (uint64_t first_cell = 0; first_cell < num_cells; first_cell++) {
+    for (uint64_t len = 1; len <= num_cells - first_cell; len++) {
+      const uint64_t last = first_cell + len - 1;
+      const uint64_t start_byte = full_offsets[first_cell];
+      const uint64_t end_byte =
+          last == num_cells - 1 ? total_size : full_offsets[last + 1];
+      std::vector<std::byte> out(end_byte - start_byte);
+      std::vector<uint64_t> out_offsets(len);
+      tiledb::sm::RLE::decompress(
+          compressed, 1, 1, index, first_cell, out, out_offsets);
+
+      CHECK(memcmp(out.data(), full.data() + start_byte, out.size()) == 0);
+      for (uint64_t i = 0; i < len; i++) {
+        CHECK(out_offsets[i] == full_offsets[first_cell + i] - start_byte);
+      }
+    }
+  }
+
+  // An empty skip index decodes from the start of the chunk
+  std::vector<std::byte> out(str2.size());
+  std::vector<uint64_t> out_offsets(1);
+  tiledb::sm::RLE::decompress(compressed, 1, 1, {}, 3, out, out_offsets);
+  CHECK(memcmp(out.data(), str2.data(), str2.size()) == 0);
+  CHECK(out_offsets[0] == 0);
+}
+
+TEST_CASE(
+    "Compression-RLE: Test mid-chunk decompression of numbers",
+    "[compression][rle][rle-num]") {
+  std::vector<uint64_t> uncompressed = {1, 1, 1, 1, 2, 3, 3, 4, 4, 4};
+
+  // Compress the input array
+  const auto num_of_runs = 4;
+  std::vector<uint64_t> compressed(num_of_runs * 2);
+  tiledb::sm::RLE::compress<uint64_t>(uncompressed, compressed);
+
+  // Decode every possible cell range and compare to the input
+  for (uint64_t first_cell = 0; first_cell < uncompressed.size();
+       first_cell++) {
+    for (uint64_t len = 1; len <= uncompressed.size() - first_cell; len++) {
+      std::vector<uint64_t> out(len);
+      tiledb::sm::RLE::decompress<uint64_t>(compressed, first_cell, out);
+      for (uint64_t i = 0; i < len; i++) {
+        CHECK(out[i] == uncompressed[first_cell + i]);
+      }
+    }
+  }
+}
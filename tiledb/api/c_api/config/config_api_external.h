@@ -140,6 +140,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `sm.io_concurrency_level` <br>
  *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
  *    **Default*: # cores
+ * - `sm.numa_pinning` <br>
+ *    If `true`, thread pool workers are partitioned across the NUMA
+ *    nodes of the machine and pinned to the CPUs of their node, keeping
+ *    the memory they allocate node-local. Best-effort; only has an
+ *    effect on Linux machines with more than one node. <br>
+ *    **Default**: false
  * - `sm.vacuum.mode` <br>
  *    The vacuuming mode, one of
  *    `commits` (remove only consolidated commit files),
@@ -215,6 +221,10 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The memory budget for tiles of var-sized attributes
  *    to be fetched during reads.<br>
  *    **Default**: 10GB
+ * - `sm.tile_cache_size` <br>
+ *    The maximum size (in bytes) of the context-level cache of unfiltered
+ *    tiles shared by all queries. A value of 0 disables the cache.<br>
+ *    **Default**: 10MB
  * - `sm.var_offsets.bitsize` <br>
  *    The size of offsets in bits to be used for offset buffers of var-sized
  *    attributes<br>
@@ -227,6 +237,22 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The offsets format (`bytes` or `elements`) to be used for
  *    var-sized attributes.<br>
  *    **Default**: bytes
+ * - `sm.query.admission.memory_budget` <br>
+ *    The maximum summed cost estimate (in bytes) of the queries admitted for
+ *    concurrent processing. A query whose cost estimate, derived from the
+ *    fragments its subarray may touch, does not fit next to the queries
+ *    already running waits for them to finish before its processing starts.
+ *    0 disables query admission control. <br>
+ *    **Default**: 0
+ * - `sm.query.admission.queue_timeout_ms` <br>
+ *    Maximum time (in milliseconds) a query may wait for admission before
+ *    its submission fails. <br>
+ *    **Default**: 300000
+ * - `sm.query.condition.adaptive_order` <br>
+ *    If `true`, sparse readers sample the selectivity and evaluation cost
+ *    of the query condition clauses on the first tile and reorder them so
+ *    that the most decisive clause per unit of cost runs first.<br>
+ *    **Default**: true
  * - `sm.query.dense.reader` <br>
  *    Which reader to use for dense queries. "refactored" or "legacy".<br>
  *    **Default**: refactored
@@ -234,10 +260,41 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    Which reader to use for sparse global order queries. "refactored"
  *    or "legacy".<br>
  *    **Default**: legacy
+ * - `sm.query.sparse_global_order.pipelined_unfilter` <br>
+ *    If `true`, the sparse global order reader pipelines tile reads and
+ *    unfiltering so that unfiltering of a field starts as soon as its own
+ *    bytes have landed, while reads for the remaining fields are still in
+ *    flight. <br>
+ *    **Default**: false
  * - `sm.query.sparse_unordered_with_dups.reader` <br>
  *    Which reader to use for sparse unordered with dups queries.
  *    "refactored" or "legacy".<br>
  *    **Default**: refactored
+ * - `sm.query.sparse_unordered_with_dups.dedup` <br>
+ *    If `true`, the sparse unordered with dups reader eliminates duplicate
+ *    coordinates from the results, keeping the occurrence from the most
+ *    recent fragment. <br>
+ *    **Default**: false
+ * - `sm.query.sparse_unordered_with_dups.prefetch_tile_count` <br>
+ *    Maximum number of result tiles the sparse unordered with dups reader
+ *    speculatively issues VFS reads for, ahead of the tiles currently being
+ *    processed, to hide object-store latency. 0 disables prefetching. <br>
+ *    **Default**: 0
+ * - `sm.query.streamed_var_read_min_tile_size` <br>
+ *    **Experimental** <br>
+ *    Minimum in-memory var tile size for which readers fetch only the byte
+ *    ranges of the selected cells instead of the whole var tile, cutting
+ *    read amplification on arrays with very large cells. Only var tiles
+ *    written with an empty filter pipeline and no encryption are eligible.
+ *    0 disables streamed var reads. <br>
+ *    **Default**: 0
+ * - `sm.query.zero_copy_unfiltered_tiles` <br>
+ *    **Experimental** <br>
+ *    If `true`, tiles whose filter pipeline is empty are served directly from
+ *    the read buffers instead of being copied into their own allocations.
+ *    This avoids a copy per tile but keeps the whole read buffer alive for
+ *    as long as any of its tiles is in use. <br>
+ *    **Default**: false
  * - `sm.mem.malloc_trim` <br>
  *    Should malloc_trim be called on context and query destruction? This might
  *    reduce residual memory usage. <br>
@@ -353,6 +410,22 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.max_batch_size` <br>
  *    The maximum number of bytes in a VFS read operation<br>
  *    **Default**: UINT64_MAX
+ * - `vfs.max_concurrent_reads` <br>
+ *    The maximum number of in-flight read operations per object-store
+ *    bucket. Oversized reads are only split into parallel range requests
+ *    while the bucket has idle capacity. Zero disables the budget. <br>
+ *    **Default**: 128
+ * - `vfs.block_cache.dir` <br>
+ *    The local directory of the on-disk block cache for remote backends.
+ *    Cached blocks persist across processes and are evicted in LRU order
+ *    against the cache byte budget. An empty value disables the cache. <br>
+ *    **Default**: ""
+ * - `vfs.block_cache.size` <br>
+ *    The byte budget of the on-disk block cache. <br>
+ *    **Default**: 10GB
+ * - `vfs.block_cache.block_size` <br>
+ *    The block size (in bytes) of the on-disk block cache. <br>
+ *    **Default**: 4MB
  * - `vfs.min_batch_size` <br>
  *    The minimum number of bytes in a VFS read operation<br>
  *    **Default**: 20MB
@@ -382,6 +455,10 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.file.posix_directory_permissions` <br>
  *    Permissions to use for posix file system with directory creation.<br>
  *    **Default**: 755
+ * - `vfs.file.mmap_reads` <br>
+ *    Whether to serve local file reads from shared read-only memory
+ *    mappings instead of per-read syscalls (POSIX only). <br>
+ *    **Default**: false
  * - `vfs.azure.storage_account_name` <br>
  *    Set the name of the Azure Storage account to use. <br>
  *    **Default**: ""
@@ -407,6 +484,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    vfs.azure.max_parallel_ops` bytes will be buffered before issuing block
  *    uploads in parallel. <br>
  *    **Default**: "5242880"
+ * - `vfs.azure.max_inflight_blocks` <br>
+ *    The maximum number of pipelined in-flight block uploads per blob.
+ *    When non-zero, block uploads are queued as blocks are staged instead
+ *    of being awaited in batches, and block sizes adapt to the observed
+ *    upload durations. Zero keeps the synchronous batch uploader. <br>
+ *    **Default**: "0"
  * - `vfs.azure.max_parallel_ops` <br>
  *    The maximum number of Azure backend parallel operations. <br>
  *    **Default**: `sm.io_concurrency_level`
@@ -701,6 +784,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The delay factor to exponentially wait until further retries of a failed
  *    REST request <br>
  *    **Default**: 1.25
+ * - `rest.query_deadline_ms` <br>
+ *    Deadline in milliseconds for remote read queries. When non-zero, the
+ *    server returns whatever result batches completed by the deadline and
+ *    the query is reported as incomplete; resubmitting it resumes where the
+ *    previous round trip stopped. Zero disables the deadline. <br>
+ *    **Default**: 0
  * - `rest.curl.verbose` <br>
  *    Set curl to run in verbose mode for REST requests <br>
  *    curl will print to stdout with this option
@@ -65,6 +65,12 @@ TILEDB_FILTER_TYPE_ENUM(FILTER_NONE) = 0,
     TILEDB_FILTER_TYPE_ENUM(FILTER_WEBP) = 18,
     /** Delta filter. */
     TILEDB_FILTER_TYPE_ENUM(FILTER_DELTA) = 19,
+    /** Adaptive compression filter. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_ADAPTIVE) = 20,
+    /** CRC32C checksum filter. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_CHECKSUM_CRC32C) = 21,
+    /** Validity bit packing filter. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_VALIDITY_BIT_PACK) = 22,
 #endif
 
 #ifdef TILEDB_FILTER_OPTION_ENUM
@@ -53,6 +53,12 @@ const tiledb_channel_operator_handle_t* tiledb_channel_operator_mean =
 const tiledb_channel_operator_handle_t* tiledb_channel_operator_null_count =
     tiledb_channel_operator_handle_t::make_handle(
         tiledb::sm::constants::aggregate_null_count_str);
+const tiledb_channel_operator_handle_t* tiledb_channel_operator_distinct_count =
+    tiledb_channel_operator_handle_t::make_handle(
+        tiledb::sm::constants::aggregate_distinct_count_str);
+const tiledb_channel_operator_handle_t* tiledb_channel_operator_median =
+    tiledb_channel_operator_handle_t::make_handle(
+        tiledb::sm::constants::aggregate_median_str);
 
 const tiledb_channel_operation_handle_t* tiledb_aggregate_count =
     tiledb_channel_operation_handle_t::make_handle(
@@ -136,6 +142,20 @@ capi_return_t tiledb_channel_operator_null_count_get(
   return TILEDB_OK;
 }
 
+capi_return_t tiledb_channel_operator_distinct_count_get(
+    tiledb_ctx_t*, const tiledb_channel_operator_t** op) {
+  ensure_output_pointer_is_valid(op);
+  *op = tiledb_channel_operator_distinct_count;
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_channel_operator_median_get(
+    tiledb_ctx_t*, const tiledb_channel_operator_t** op) {
+  ensure_output_pointer_is_valid(op);
+  *op = tiledb_channel_operator_median;
+  return TILEDB_OK;
+}
+
 capi_return_t tiledb_channel_operator_min_get(
     tiledb_ctx_t*, const tiledb_channel_operator_t** op) {
   ensure_output_pointer_is_valid(op);
@@ -301,6 +321,22 @@ CAPI_INTERFACE(
       tiledb::api::tiledb_channel_operator_null_count_get>(ctx, op);
 }
 
+CAPI_INTERFACE(
+    channel_operator_distinct_count_get,
+    tiledb_ctx_t* ctx,
+    const tiledb_channel_operator_t** op) {
+  return api_entry_with_context<
+      tiledb::api::tiledb_channel_operator_distinct_count_get>(ctx, op);
+}
+
+CAPI_INTERFACE(
+    channel_operator_median_get,
+    tiledb_ctx_t* ctx,
+    const tiledb_channel_operator_t** op) {
+  return api_entry_with_context<
+      tiledb::api::tiledb_channel_operator_median_get>(ctx, op);
+}
+
 CAPI_INTERFACE(
     aggregate_count_get,
     tiledb_ctx_t* ctx,
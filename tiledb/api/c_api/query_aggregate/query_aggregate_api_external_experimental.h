@@ -65,6 +65,12 @@ TILEDB_EXPORT extern const tiledb_channel_operator_t*
 TILEDB_EXPORT extern const tiledb_channel_operator_t*
     tiledb_channel_operator_null_count;
 
+TILEDB_EXPORT extern const tiledb_channel_operator_t*
+    tiledb_channel_operator_distinct_count;
+
+TILEDB_EXPORT extern const tiledb_channel_operator_t*
+    tiledb_channel_operator_median;
+
 // Constant aggregate operation handles
 TILEDB_EXPORT extern const tiledb_channel_operation_t* tiledb_aggregate_count;
 
@@ -176,6 +182,48 @@ TILEDB_EXPORT int32_t tiledb_channel_operator_mean_get(
 TILEDB_EXPORT int32_t tiledb_channel_operator_null_count_get(
     tiledb_ctx_t* ctx, const tiledb_channel_operator_t** op) TILEDB_NOEXCEPT;
 
+/**
+ * Helper function to access the constant DISTINCT_COUNT channel operator
+ * handle. The aggregate computes an approximate count of the distinct values
+ * of the input field, using a HyperLogLog sketch with a relative standard
+ * error of about 1.6%.
+ * **Example:**
+ *
+ * @code{.c}
+ * const tiledb_channel_operator_t *operator_distinct_count;
+ * tiledb_channel_operator_distinct_count_get(ctx, &operator_distinct_count);
+ * tiledb_channel_operation_t* distinct_count_A;
+ * tiledb_create_unary_aggregate(ctx, query, operator_distinct_count, "A",
+ * distinct_count_A);
+ * @endcode
+ *
+ * @param ctx The TileDB context
+ * @param op The operator handle to be retrieved
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_channel_operator_distinct_count_get(
+    tiledb_ctx_t* ctx, const tiledb_channel_operator_t** op) TILEDB_NOEXCEPT;
+
+/**
+ * Helper function to access the constant MEDIAN channel operator handle. The
+ * aggregate computes an approximate median of the input field, using a
+ * t-digest sketch with a relative error typically well under 1%.
+ * **Example:**
+ *
+ * @code{.c}
+ * const tiledb_channel_operator_t *operator_median;
+ * tiledb_channel_operator_median_get(ctx, &operator_median);
+ * tiledb_channel_operation_t* median_A;
+ * tiledb_create_unary_aggregate(ctx, query, operator_median, "A", median_A);
+ * @endcode
+ *
+ * @param ctx The TileDB context
+ * @param op The operator handle to be retrieved
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_channel_operator_median_get(
+    tiledb_ctx_t* ctx, const tiledb_channel_operator_t** op) TILEDB_NOEXCEPT;
+
 /**
  * Gets the default channel of the query. The default channel consists of all
  * the rows the query would return as if executed standalone.
@@ -32,12 +32,84 @@
 #include "governor.h"
 #include "tiledb/common/heap_profiler.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace tiledb::common {
 
 void Governor::memory_panic() {
   heap_profiler.dump_and_terminate();
 }
 
+RequestRateGovernor& RequestRateGovernor::instance() {
+  static RequestRateGovernor governor;
+  return governor;
+}
+
+void RequestRateGovernor::set_rate(
+    Backend backend, double requests_per_second) {
+  auto& bucket = buckets_[static_cast<size_t>(backend)];
+  std::lock_guard<std::mutex> lock(bucket.mtx);
+  bucket.configured_rate = requests_per_second;
+  if (bucket.current_rate == 0.0 ||
+      bucket.current_rate > requests_per_second) {
+    bucket.current_rate = requests_per_second;
+  }
+  bucket.last_refill = std::chrono::steady_clock::now();
+}
+
+void RequestRateGovernor::acquire(Backend backend) {
+  auto& bucket = buckets_[static_cast<size_t>(backend)];
+  std::unique_lock<std::mutex> lock(bucket.mtx);
+  while (bucket.configured_rate > 0.0) {
+    refill(bucket);
+    if (bucket.tokens >= 1.0) {
+      bucket.tokens -= 1.0;
+      return;
+    }
+
+    // Sleep without the lock until the next token accrues, so waiters
+    // do not serialize behind each other.
+    std::chrono::duration<double> wait{
+        (1.0 - bucket.tokens) / bucket.current_rate};
+    lock.unlock();
+    std::this_thread::sleep_for(wait);
+    lock.lock();
+  }
+}
+
+void RequestRateGovernor::report_throttle(Backend backend) {
+  auto& bucket = buckets_[static_cast<size_t>(backend)];
+  std::lock_guard<std::mutex> lock(bucket.mtx);
+  if (bucket.configured_rate <= 0.0) {
+    return;
+  }
+
+  // Multiplicative decrease with a floor of one request per second, and
+  // drain any accumulated burst allowance.
+  bucket.current_rate = std::max(1.0, bucket.current_rate / 2.0);
+  bucket.tokens = std::min(bucket.tokens, 1.0);
+}
+
+void RequestRateGovernor::refill(TokenBucket& bucket) const {
+  auto now = std::chrono::steady_clock::now();
+  std::chrono::duration<double> elapsed = now - bucket.last_refill;
+  bucket.last_refill = now;
+
+  // Additive recovery toward the configured rate at 10% of the
+  // configured rate per second.
+  if (bucket.current_rate < bucket.configured_rate) {
+    bucket.current_rate = std::min(
+        bucket.configured_rate,
+        bucket.current_rate + bucket.configured_rate * 0.1 * elapsed.count());
+  }
+
+  // Allow bursts of up to one second of the current rate.
+  bucket.tokens = std::min(
+      std::max(1.0, bucket.current_rate),
+      bucket.tokens + bucket.current_rate * elapsed.count());
+}
+
 }  // namespace tiledb::common
 
 /*
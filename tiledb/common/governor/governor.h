@@ -32,6 +32,11 @@
 #ifndef TILEDB_COMMON_GOVERNOR_H
 #define TILEDB_COMMON_GOVERNOR_H
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
 namespace tiledb::common {
 
 /**
@@ -53,6 +58,80 @@ class Governor {
   static void memory_panic();
 };
 
+/**
+ * A process-wide token-bucket governor that paces outgoing requests to
+ * remote I/O backends.
+ *
+ * Remote object stores rate-limit requests per prefix. When several
+ * contexts in one process each issue requests independently, they
+ * collectively trip the limit and collapse into retry backoff. All VFS
+ * instances share this governor, so the process as a whole stays under
+ * the limit.
+ *
+ * Each backend has one bucket. `set_rate` configures the steady-state
+ * request rate (0 disables pacing), `acquire` blocks until a token is
+ * available, and `report_throttle` is called on throttling responses
+ * (e.g. S3 'SLOW_DOWN') to halve the current rate, which then recovers
+ * additively toward the configured rate.
+ */
+class RequestRateGovernor {
+ public:
+  /** The I/O backends subject to request pacing. */
+  enum class Backend : size_t { S3 = 0, AZURE, GCS, COUNT };
+
+  /** Returns the process-wide instance. */
+  static RequestRateGovernor& instance();
+
+  /**
+   * Sets the configured request rate of a backend, in requests per
+   * second. A rate of 0 disables pacing for the backend.
+   */
+  void set_rate(Backend backend, double requests_per_second);
+
+  /**
+   * Blocks until the backend may issue one request. A no-op when pacing
+   * is disabled for the backend.
+   */
+  void acquire(Backend backend);
+
+  /**
+   * Signals that the backend was throttled. Halves the current rate,
+   * with a floor of one request per second.
+   */
+  void report_throttle(Backend backend);
+
+ private:
+  /** A per-backend token bucket. */
+  struct TokenBucket {
+    /** Protects all fields of the bucket. */
+    std::mutex mtx;
+
+    /** The configured steady-state rate; 0 disables pacing. */
+    double configured_rate = 0.0;
+
+    /** The current rate, between the floor and the configured rate. */
+    double current_rate = 0.0;
+
+    /** The available tokens; one request consumes one token. */
+    double tokens = 0.0;
+
+    /** The time tokens were last refilled. */
+    std::chrono::steady_clock::time_point last_refill;
+  };
+
+  RequestRateGovernor() = default;
+
+  /**
+   * Adds the tokens accrued since the last refill and recovers the
+   * current rate toward the configured rate. Must be called with the
+   * bucket lock held.
+   */
+  void refill(TokenBucket& bucket) const;
+
+  /** The per-backend buckets. */
+  std::array<TokenBucket, static_cast<size_t>(Backend::COUNT)> buckets_;
+};
+
 }  // namespace tiledb::common
 
 #endif  // TILEDB_COMMON_GOVERNOR_H
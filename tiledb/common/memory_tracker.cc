@@ -31,6 +31,7 @@
  * the top level description in memory_tracker.h.
  */
 
+#include <algorithm>
 #include <fstream>
 
 #include "external/include/nlohmann/json.hpp"
@@ -70,6 +71,8 @@ std::string memory_type_to_str(MemoryType type) {
       return "FilteredDataBlock";
     case MemoryType::FOOTER:
       return "Footer";
+    case MemoryType::GENERIC_TILE_CACHE:
+      return "GenericTileCache";
     case MemoryType::GENERIC_TILE_IO:
       return "GenericTileIO";
     case MemoryType::METADATA:
@@ -82,8 +85,12 @@ std::string memory_type_to_str(MemoryType type) {
       return "ResultTileBitmap";
     case MemoryType::RTREE:
       return "RTree";
+    case MemoryType::TILE_CACHE:
+      return "TileCache";
     case MemoryType::TILE_DATA:
       return "TileData";
+    case MemoryType::TILE_GLOBAL_ORDER_KEYS:
+      return "TileGlobalOrderKeys";
     case MemoryType::TILE_HILBERT_VALUES:
       return "TileHilbertValues";
     case MemoryType::TILE_MAX_VALS:
@@ -120,12 +127,18 @@ std::string memory_tracker_type_to_str(MemoryTrackerType type) {
       return "ArrayWrite";
     case MemoryTrackerType::CONSOLIDATOR:
       return "Consolidator";
+    case MemoryTrackerType::ENUMERATION_CACHE:
+      return "EnumerationCache";
     case MemoryTrackerType::ENUMERATION_CREATE:
       return "EnumerationCreate";
     case MemoryTrackerType::EPHEMERAL:
       return "Ephemeral";
     case MemoryTrackerType::FRAGMENT_INFO_LOAD:
       return "FragmentInfoLoad";
+    case MemoryTrackerType::FRAGMENT_META_CACHE:
+      return "FragmentMetaCache";
+    case MemoryTrackerType::GENERIC_TILE_CACHE:
+      return "GenericTileCache";
     case MemoryTrackerType::GROUP:
       return "Group";
     case MemoryTrackerType::QUERY_READ:
@@ -136,29 +149,133 @@ std::string memory_tracker_type_to_str(MemoryTrackerType type) {
       return "RestClient";
     case MemoryTrackerType::SCHEMA_EVOLUTION:
       return "SchemaEvolution";
+    case MemoryTrackerType::TILE_CACHE:
+      return "TileCache";
   }
 
   auto val = std::to_string(static_cast<uint32_t>(type));
   throw std::logic_error("Invalid memory tracker type: " + val);
 }
 
+bool ShardedCounter::add(uint64_t bytes) {
+  auto& shard = this->shard();
+  auto size = static_cast<int64_t>(bytes);
+  auto new_count =
+      shard.count.fetch_add(size, std::memory_order_relaxed) + size;
+  if (memory_budget_ == nullptr) {
+    return false;
+  }
+
+  // Fast path: the allocation fits in the budget already leased to this
+  // shard and the shared ledger is not touched.
+  auto leased = shard.leased.load(std::memory_order_relaxed);
+  if (new_count <= leased) {
+    return false;
+  }
+
+  // The shard's lease is exhausted; take a new lease from the shared ledger.
+  // Leases are padded to a chunk so the ledger is touched once per chunk of
+  // net allocation rather than on every allocation. The ledger is grown
+  // before the shard lease so it never undercounts the outstanding leases.
+  auto needed = new_count - leased;
+  auto grant = std::max(needed, lease_chunk_bytes_);
+  auto prev_leased = leased_total_.fetch_add(grant, std::memory_order_relaxed);
+  shard.leased.fetch_add(grant, std::memory_order_relaxed);
+
+  // Maintain the high-water mark of the ledger. Usage only grows past the
+  // previous peak through a lease grant, so updating it here keeps the
+  // mark off the per-allocation fast path.
+  auto new_leased = prev_leased + grant;
+  auto peak = leased_peak_.load(std::memory_order_relaxed);
+  while (new_leased > peak &&
+         !leased_peak_.compare_exchange_weak(
+             peak, new_leased, std::memory_order_relaxed)) {
+  }
+
+  // Budgets above the int64 bounds (notably the default of uint64 max) are
+  // effectively unlimited.
+  auto budget = memory_budget_->load(std::memory_order_relaxed);
+  constexpr auto budget_limit =
+      static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  if (budget >= budget_limit ||
+      prev_leased + grant <= static_cast<int64_t>(budget)) {
+    return false;
+  }
+
+  // The lease took the ledger past the budget; reconcile against the exact
+  // count. If the exact count is still within the budget, keep only the
+  // lease that is strictly needed so that allocations near the budget keep
+  // reconciling instead of over-admitting by the chunk padding.
+  if (static_cast<int64_t>(get()) <= static_cast<int64_t>(budget)) {
+    auto excess = grant - needed;
+    if (excess > 0) {
+      shard.leased.fetch_sub(excess, std::memory_order_relaxed);
+      leased_total_.fetch_sub(excess, std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+  // The exact count exceeds the budget. Return the entire lease so the next
+  // allocation reconciles again, preserving the per allocation granularity
+  // of the budget exceeded callback, and report the exceedance.
+  shard.leased.fetch_sub(grant, std::memory_order_relaxed);
+  leased_total_.fetch_sub(grant, std::memory_order_relaxed);
+  return true;
+}
+
+void ShardedCounter::sub(uint64_t bytes) {
+  auto& shard = this->shard();
+  auto size = static_cast<int64_t>(bytes);
+  auto count = shard.count.fetch_sub(size, std::memory_order_relaxed) - size;
+  if (memory_budget_ == nullptr) {
+    return;
+  }
+
+  // Return lease slack beyond two chunks to the shared ledger so a shard
+  // that freed a large amount of memory does not hold budget other shards
+  // may need. The shard lease is shrunk before the ledger so the ledger
+  // never undercounts the outstanding leases.
+  auto leased = shard.leased.load(std::memory_order_relaxed);
+  if (leased - count > 2 * lease_chunk_bytes_) {
+    auto reclaim = leased - count - lease_chunk_bytes_;
+    if (shard.leased.compare_exchange_strong(
+            leased, leased - reclaim, std::memory_order_relaxed)) {
+      leased_total_.fetch_sub(reclaim, std::memory_order_relaxed);
+    }
+  }
+}
+
+uint64_t ShardedCounter::get() const {
+  int64_t total = 0;
+  for (auto& shard : shards_) {
+    total += shard.count.load(std::memory_order_relaxed);
+  }
+  return static_cast<uint64_t>(total);
+}
+
+uint64_t ShardedCounter::peak() const {
+  // The current count can exceed the recorded ledger peak when no budget
+  // is enforced or before the first lease is taken.
+  auto peak = leased_peak_.load(std::memory_order_relaxed);
+  auto current = static_cast<int64_t>(get());
+  return static_cast<uint64_t>(std::max(peak, current));
+}
+
 uint64_t MemoryTrackerResource::get_count() {
-  return type_counter_.fetch_add(0, std::memory_order_relaxed);
+  return type_counter_.get();
 }
 
 void* MemoryTrackerResource::do_allocate(size_t bytes, size_t alignment) {
-  auto previous_total =
-      total_counter_.fetch_add(bytes, std::memory_order_relaxed);
-  type_counter_.fetch_add(bytes, std::memory_order_relaxed);
-  if (previous_total + bytes > memory_budget_ && on_budget_exceeded_) {
+  type_counter_.add(bytes);
+  if (total_counter_.add(bytes) && on_budget_exceeded_) {
     try {
       on_budget_exceeded_();
     } catch (...) {
       // If the callback throws, undo the counter increments and rethrow.
       // If we don't do this, the assert in the MemoryTracker destructor
       // will fail because the total_counter_ will be non-zero.
-      total_counter_.fetch_sub(bytes, std::memory_order_relaxed);
-      type_counter_.fetch_sub(bytes, std::memory_order_relaxed);
+      total_counter_.sub(bytes);
+      type_counter_.sub(bytes);
       throw;
     }
   }
@@ -168,8 +285,8 @@ void* MemoryTrackerResource::do_allocate(size_t bytes, size_t alignment) {
 void MemoryTrackerResource::do_deallocate(
     void* ptr, size_t bytes, size_t alignment) {
   upstream_->deallocate(ptr, bytes, alignment);
-  type_counter_.fetch_sub(bytes, std::memory_order_relaxed);
-  total_counter_.fetch_sub(bytes, std::memory_order_relaxed);
+  type_counter_.sub(bytes);
+  total_counter_.sub(bytes);
 }
 
 bool MemoryTrackerResource::do_is_equal(
@@ -179,7 +296,7 @@ bool MemoryTrackerResource::do_is_equal(
 
 MemoryTracker::~MemoryTracker() {
   assert(
-      total_counter_.fetch_add(0) == 0 &&
+      total_counter_.get() == 0 &&
       "MemoryTracker destructed with outstanding allocations.");
 }
 
@@ -194,19 +311,28 @@ tdb::pmr::memory_resource* MemoryTracker::get_resource(MemoryType type) {
 
   // Add a new counter if it doesn't exist.
   if (counters_.find(type) == counters_.end()) {
-    counters_.emplace(type, 0);
+    counters_.try_emplace(type);
   } else {
     // There's no outstanding memory resource for this type, so it must be zero.
-    assert(counters_[type] == 0 && "Invalid memory tracking state.");
+    assert(counters_[type].get() == 0 && "Invalid memory tracking state.");
+  }
+
+  // Route tile data allocations through the block pool so that tile sized
+  // buffers freed by one loop iteration of an incomplete query are recycled
+  // by the next one. The tracking resource sits on top of the pool, so the
+  // budget accounting is unaffected by the recycling.
+  auto upstream = upstream_;
+  if (type == MemoryType::TILE_DATA || type == MemoryType::FILTERED_DATA ||
+      type == MemoryType::FILTERED_DATA_BLOCK) {
+    upstream = &block_pool_;
   }
 
   // Create and track a shared_ptr to the new memory resource.
   auto ret = make_shared<MemoryTrackerResource>(
       HERE(),
-      upstream_,
+      upstream,
       total_counter_,
       counters_[type],
-      memory_budget_,
       on_budget_exceeded_);
   resources_.emplace(type, ret);
 
@@ -218,7 +344,7 @@ std::tuple<uint64_t, std::unordered_map<MemoryType, uint64_t>>
 MemoryTracker::get_counts() {
   std::lock_guard<std::mutex> lg(mutex_);
 
-  auto total = total_counter_.fetch_add(0, std::memory_order_relaxed);
+  auto total = total_counter_.get();
   std::unordered_map<MemoryType, uint64_t> by_type;
   std::vector<MemoryType> to_del;
   for (auto& [mem_type, resource] : resources_) {
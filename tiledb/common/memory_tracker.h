@@ -96,6 +96,7 @@
 #ifndef TILEDB_MEMORY_TRACKER_H
 #define TILEDB_MEMORY_TRACKER_H
 
+#include <array>
 #include <condition_variable>
 #include <functional>
 #include <thread>
@@ -118,13 +119,16 @@ enum class MemoryType {
   FILTERED_DATA,
   FILTERED_DATA_BLOCK,
   FOOTER,
+  GENERIC_TILE_CACHE,
   GENERIC_TILE_IO,
   METADATA,
   QUERY_CONDITION,
   RESULT_TILE,
   RESULT_TILE_BITMAP,
   RTREE,
+  TILE_CACHE,
   TILE_DATA,
+  TILE_GLOBAL_ORDER_KEYS,
   TILE_HILBERT_VALUES,
   TILE_MAX_VALS,
   TILE_MIN_VALS,
@@ -151,14 +155,18 @@ enum class MemoryTrackerType {
   ARRAY_READ,
   ARRAY_WRITE,
   CONSOLIDATOR,
+  ENUMERATION_CACHE,
   ENUMERATION_CREATE,
   EPHEMERAL,
   FRAGMENT_INFO_LOAD,
+  FRAGMENT_META_CACHE,
+  GENERIC_TILE_CACHE,
   GROUP,
   QUERY_READ,
   QUERY_WRITE,
   REST_CLIENT,
-  SCHEMA_EVOLUTION
+  SCHEMA_EVOLUTION,
+  TILE_CACHE
 };
 
 /**
@@ -169,6 +177,115 @@ enum class MemoryTrackerType {
  */
 std::string memory_tracker_type_to_str(MemoryTrackerType type);
 
+/**
+ * A byte counter sharded across cache line padded slots.
+ *
+ * Every pmr allocation updates the type counter of its MemoryTrackerResource
+ * and the total counter of the owning MemoryTracker. With a single atomic per
+ * counter, allocation heavy multi-threaded reads serialize on the counter
+ * cache lines. Each thread instead updates a shard selected by hashing its
+ * thread id so that concurrent updates land on distinct cache lines. Reads
+ * sum all shards and are exact; they only happen on cold paths (statistics,
+ * budget reconciliation, destruction).
+ *
+ * When constructed with a memory budget, the counter also enforces it using
+ * slack based reservation. Shards take leases on the budget in chunks from a
+ * shared ledger so the ledger is only touched once per lease chunk of net
+ * allocation instead of on every allocation. When a lease would take the
+ * ledger past the budget, the exact count is computed and compared against
+ * the budget and lease padding stops, so budget exceedances are detected
+ * with the same per allocation granularity as an unsharded counter while the
+ * budget is a concern.
+ */
+class ShardedCounter {
+ public:
+  /** Constructor for a counter without a budget. */
+  ShardedCounter()
+      : memory_budget_(nullptr) {
+  }
+
+  /**
+   * Constructor for a counter that enforces a budget.
+   *
+   * @param memory_budget The memory budget to enforce.
+   */
+  explicit ShardedCounter(const std::atomic<uint64_t>& memory_budget)
+      : memory_budget_(&memory_budget) {
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ShardedCounter);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(ShardedCounter);
+
+  /**
+   * Add bytes to the calling thread's shard.
+   *
+   * @param bytes The number of bytes to add.
+   * @return true if the addition took the exact count over the budget.
+   */
+  bool add(uint64_t bytes);
+
+  /**
+   * Subtract bytes from the calling thread's shard, returning excess budget
+   * lease to the shared ledger.
+   *
+   * @param bytes The number of bytes to subtract.
+   */
+  void sub(uint64_t bytes);
+
+  /** The exact count summed over all shards. */
+  uint64_t get() const;
+
+  /**
+   * The high-water mark of the count. The mark is maintained on the
+   * budget-lease path, so it lags the instantaneous peak by up to one
+   * lease chunk per shard; the shared ledger is still only touched once
+   * per chunk of net allocation.
+   */
+  uint64_t peak() const;
+
+ private:
+  /** The number of shards. */
+  static constexpr size_t num_shards_ = 16;
+
+  /** The size of a budget lease chunk. */
+  static constexpr int64_t lease_chunk_bytes_ = 1024 * 1024;
+
+  /**
+   * A cache line padded shard.
+   *
+   * The per shard count and lease are signed because bytes are regularly
+   * freed on a different thread than the one that allocated them, which
+   * drives individual shards negative. Only the sum over all shards is
+   * meaningful.
+   */
+  struct alignas(64) Shard {
+    /** The bytes counted against this shard. */
+    std::atomic<int64_t> count{0};
+
+    /** The budget leased to this shard. */
+    std::atomic<int64_t> leased{0};
+  };
+
+  /** Return the calling thread's shard. */
+  Shard& shard() {
+    static thread_local const size_t index =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) % num_shards_;
+    return shards_[index];
+  }
+
+  /** The shards. */
+  std::array<Shard, num_shards_> shards_;
+
+  /** The budget leased to all shards combined. */
+  std::atomic<int64_t> leased_total_{0};
+
+  /** The high-water mark of the leased total. */
+  std::atomic<int64_t> leased_peak_{0};
+
+  /** The budget to enforce, or nullptr if this counter has no budget. */
+  const std::atomic<uint64_t>* memory_budget_;
+};
+
 class MemoryTrackerResource : public tdb::pmr::memory_resource {
  public:
   // Disable all default generated constructors.
@@ -179,14 +296,12 @@ class MemoryTrackerResource : public tdb::pmr::memory_resource {
   /** Constructor. */
   explicit MemoryTrackerResource(
       tdb::pmr::memory_resource* upstream,
-      std::atomic<uint64_t>& total_counter,
-      std::atomic<uint64_t>& type_counter,
-      const std::atomic<uint64_t>& memory_budget,
+      ShardedCounter& total_counter,
+      ShardedCounter& type_counter,
       std::function<void()> on_budget_exceeded)
       : upstream_(upstream)
       , total_counter_(total_counter)
       , type_counter_(type_counter)
-      , memory_budget_(memory_budget)
       , on_budget_exceeded_(on_budget_exceeded) {
   }
 
@@ -209,13 +324,10 @@ class MemoryTrackerResource : public tdb::pmr::memory_resource {
   tdb::pmr::memory_resource* upstream_;
 
   /** A reference to a total counter for the MemoryTracker. */
-  std::atomic<uint64_t>& total_counter_;
+  ShardedCounter& total_counter_;
 
   /** A reference to the memory type counter this resource is tracking. */
-  std::atomic<uint64_t>& type_counter_;
-
-  /** The memory budget for this resource. */
-  const std::atomic<uint64_t>& memory_budget_;
+  ShardedCounter& type_counter_;
 
   /** A function to call when the budget is exceeded. */
   std::function<void()> on_budget_exceeded_;
@@ -323,12 +435,11 @@ class MemoryTracker {
    */
   uint64_t get_memory_available() {
     std::lock_guard<std::mutex> lg(mutex_);
-    if (legacy_memory_usage_ + counters_[MemoryType::TILE_OFFSETS] >
-        legacy_memory_budget_) {
+    auto tile_offsets = counters_[MemoryType::TILE_OFFSETS].get();
+    if (legacy_memory_usage_ + tile_offsets > legacy_memory_budget_) {
       return 0;
     }
-    return legacy_memory_budget_ - legacy_memory_usage_ -
-           counters_[MemoryType::TILE_OFFSETS];
+    return legacy_memory_budget_ - legacy_memory_usage_ - tile_offsets;
   }
 
   /**
@@ -340,6 +451,23 @@ class MemoryTracker {
     return legacy_memory_budget_;
   }
 
+  /**
+   * Get the memory budget used by the new system.
+   * @return budget
+   */
+  uint64_t get_modern_memory_budget() {
+    return memory_budget_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Get the high-water mark of the total memory tracked by the new
+   * system. See `ShardedCounter::peak` for its granularity.
+   * @return peak usage in bytes
+   */
+  uint64_t get_peak_memory_usage() {
+    return total_counter_.peak();
+  }
+
   /**
    * Refresh the memory budget used by the new system.
    *
@@ -380,8 +508,9 @@ class MemoryTracker {
       , id_(generate_id())
       , type_(MemoryTrackerType::ANONYMOUS)
       , upstream_(tdb::pmr::get_default_resource())
-      , total_counter_(0)
+      , block_pool_(upstream_, pool_min_block_size_, pool_max_cached_bytes_)
       , memory_budget_(memory_budget)
+      , total_counter_(memory_budget_)
       , on_budget_exceeded_(on_budget_exceeded){};
 
  private:
@@ -407,22 +536,46 @@ class MemoryTracker {
   /** The type of this MemoryTracker. */
   MemoryTrackerType type_;
 
+  /** Minimum allocation size eligible for the block pool. */
+  static constexpr size_t pool_min_block_size_ = 64 * 1024;
+
+  /** Maximum bytes the block pool may cache for reuse. */
+  static constexpr size_t pool_max_cached_bytes_ = 1024 * 1024 * 1024;
+
   /** The upstream memory resource. */
   tdb::pmr::memory_resource* upstream_;
 
+  /**
+   * A pool over the upstream resource that recycles tile sized allocations
+   * by size class. Tile data allocations are routed through this pool so
+   * that the buffers freed at the end of one loop iteration of an
+   * incomplete query are reused by the next iteration instead of cycling
+   * through the allocator. Cached blocks are released when the tracker is
+   * destructed, i.e. at the end of the query for query trackers.
+   *
+   * Declared before resources_ so it outlives the resources that allocate
+   * from it.
+   */
+  tdb::pmr::block_pool_resource block_pool_;
+
   /** MemoryTrackerResource by MemoryType. */
   std::unordered_map<MemoryType, std::shared_ptr<MemoryTrackerResource>>
       resources_;
 
   /** Memory counters by MemoryType. */
-  std::unordered_map<MemoryType, std::atomic<uint64_t>> counters_;
+  std::unordered_map<MemoryType, ShardedCounter> counters_;
 
-  /** The total memory usage of this MemoryTracker. */
-  std::atomic<uint64_t> total_counter_;
-
-  /** Memory budget. */
+  /**
+   * Memory budget.
+   *
+   * Declared before total_counter_, which holds a reference to it for
+   * budget enforcement.
+   */
   std::atomic<uint64_t> memory_budget_;
 
+  /** The total memory usage of this MemoryTracker. */
+  ShardedCounter total_counter_;
+
   /** A function to call when the budget is exceeded. */
   std::function<void()> on_budget_exceeded_;
 
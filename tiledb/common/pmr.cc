@@ -30,6 +30,8 @@
  * This file contains implementation of pmr functions
  */
 
+#include <cstddef>
+
 #include "pmr.h"
 
 namespace tiledb::common::pmr {
@@ -42,4 +44,97 @@ memory_resource* get_default_resource() {
 #endif
 }
 
+/* ********************************* */
+/*        BLOCK POOL RESOURCE        */
+/* ********************************* */
+
+/**
+ * Size classes are multiples of this quantum so that slightly different
+ * allocation sizes still hit the same free list.
+ */
+static constexpr size_t block_pool_quantum = 4096;
+
+block_pool_resource::block_pool_resource(
+    memory_resource* upstream, size_t min_block_size, size_t max_cached_bytes)
+    : upstream_(upstream)
+    , min_block_size_(min_block_size)
+    , max_cached_bytes_(max_cached_bytes)
+    , cached_bytes_(0) {
+}
+
+block_pool_resource::~block_pool_resource() {
+  release();
+}
+
+void block_pool_resource::release() {
+  std::lock_guard<std::mutex> lg(mutex_);
+  for (auto& [block_size, blocks] : free_blocks_) {
+    for (auto* block : blocks) {
+      upstream_->deallocate(block, block_size, alignof(std::max_align_t));
+    }
+  }
+  free_blocks_.clear();
+  cached_bytes_ = 0;
+}
+
+size_t block_pool_resource::cached_bytes() {
+  std::lock_guard<std::mutex> lg(mutex_);
+  return cached_bytes_;
+}
+
+void* block_pool_resource::do_allocate(size_t bytes, size_t alignment) {
+  // Small or over-aligned allocations are not pooled.
+  if (bytes < min_block_size_ || alignment > alignof(std::max_align_t)) {
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  const auto block_size = size_class(bytes);
+  {
+    std::lock_guard<std::mutex> lg(mutex_);
+    auto iter = free_blocks_.find(block_size);
+    if (iter != free_blocks_.end() && !iter->second.empty()) {
+      auto* block = iter->second.back();
+      iter->second.pop_back();
+      cached_bytes_ -= block_size;
+      return block;
+    }
+  }
+
+  // Allocate the full size class so the block can be reused for any
+  // allocation in the same class. Pooled blocks always use the maximum
+  // fundamental alignment so the upstream deallocation is consistent no
+  // matter the alignment of the requests that recycled them.
+  return upstream_->allocate(block_size, alignof(std::max_align_t));
+}
+
+void block_pool_resource::do_deallocate(
+    void* p, size_t bytes, size_t alignment) {
+  if (bytes < min_block_size_ || alignment > alignof(std::max_align_t)) {
+    upstream_->deallocate(p, bytes, alignment);
+    return;
+  }
+
+  const auto block_size = size_class(bytes);
+  {
+    std::lock_guard<std::mutex> lg(mutex_);
+    if (cached_bytes_ + block_size <= max_cached_bytes_) {
+      free_blocks_[block_size].emplace_back(p);
+      cached_bytes_ += block_size;
+      return;
+    }
+  }
+
+  upstream_->deallocate(p, block_size, alignof(std::max_align_t));
+}
+
+bool block_pool_resource::do_is_equal(
+    const memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+size_t block_pool_resource::size_class(size_t bytes) {
+  return (bytes + block_pool_quantum - 1) / block_pool_quantum *
+         block_pool_quantum;
+}
+
 }  // namespace tiledb::common::pmr
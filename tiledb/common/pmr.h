@@ -36,6 +36,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -66,6 +67,89 @@ using polymorphic_allocator = std::pmr::polymorphic_allocator<Tp>;
 
 memory_resource* get_default_resource();
 
+/* ********************************* */
+/*  BLOCK POOL RESOURCE DECLARATION  */
+/* ********************************* */
+
+/**
+ * A memory resource that recycles large allocations by size class.
+ *
+ * Freed blocks at or above a minimum size are kept in per-size-class free
+ * lists instead of being returned to the upstream resource, and are handed
+ * back for later allocations of the same size class. This avoids allocator
+ * and page-fault churn for workloads that repeatedly allocate and free
+ * buffers of the same few sizes, such as tile buffers across the loop
+ * iterations of an incomplete query. Allocations below the minimum size or
+ * with extended alignment pass straight through to the upstream resource.
+ *
+ * Cached blocks are capped at a maximum byte count; blocks freed past the
+ * cap go back to the upstream resource. All cached blocks are released to
+ * the upstream resource on destruction.
+ *
+ * This class is thread safe.
+ */
+class block_pool_resource : public memory_resource {
+ public:
+  block_pool_resource() = delete;
+  block_pool_resource(const block_pool_resource&) = delete;
+  block_pool_resource(block_pool_resource&&) = delete;
+  block_pool_resource& operator=(const block_pool_resource&) = delete;
+  block_pool_resource& operator=(block_pool_resource&&) = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param upstream The upstream memory resource to allocate from.
+   * @param min_block_size Minimum allocation size eligible for pooling.
+   * @param max_cached_bytes Maximum bytes to keep cached for reuse.
+   */
+  block_pool_resource(
+      memory_resource* upstream,
+      size_t min_block_size,
+      size_t max_cached_bytes);
+
+  /** Destructor. */
+  ~block_pool_resource() override;
+
+  /** Return all cached blocks to the upstream resource. */
+  void release();
+
+  /** The number of bytes currently cached for reuse. */
+  size_t cached_bytes();
+
+ protected:
+  /** Allocate from the free lists, or the upstream resource on a miss. */
+  void* do_allocate(size_t bytes, size_t alignment) override;
+
+  /** Cache an eligible block for reuse, within the cached bytes cap. */
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+  /** Check if two memory resources are equal. */
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  /** Round a byte count up to its size class. */
+  static size_t size_class(size_t bytes);
+
+  /** The upstream memory resource to use for the actual allocations. */
+  memory_resource* upstream_;
+
+  /** Minimum allocation size eligible for pooling. */
+  size_t min_block_size_;
+
+  /** Maximum bytes to keep cached for reuse. */
+  size_t max_cached_bytes_;
+
+  /** Protects the free lists and the cached bytes count. */
+  std::mutex mutex_;
+
+  /** Free blocks, by size class. */
+  std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+
+  /** The number of bytes currently cached for reuse. */
+  size_t cached_bytes_;
+};
+
 /* ********************************* */
 /*     PMR UNIQUE_PTR DECLARATION    */
 /* ********************************* */
@@ -31,6 +31,8 @@
  */
 
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <test/support/tdb_catch.h>
 #include "tiledb/common/memory_tracker.h"
@@ -38,6 +40,89 @@
 
 using namespace tiledb::sm;
 
+TEST_CASE(
+    "Memory tracker: Test block pool recycling",
+    "[memory_tracker][block_pool]") {
+  MemoryTrackerManager tracker_manager;
+  auto tracker = tracker_manager.create_tracker();
+  auto resource = tracker->get_resource(MemoryType::TILE_DATA);
+
+  // A tile sized allocation is cached by the block pool when freed and
+  // handed back to the next allocation of the same size class.
+  const size_t tile_size = 4 * 1024 * 1024;
+  auto block = resource->allocate(tile_size, alignof(std::max_align_t));
+  resource->deallocate(block, tile_size, alignof(std::max_align_t));
+  auto recycled = resource->allocate(tile_size, alignof(std::max_align_t));
+  CHECK(recycled == block);
+  resource->deallocate(recycled, tile_size, alignof(std::max_align_t));
+}
+
+TEST_CASE(
+    "Memory tracker: Test sharded counting across threads",
+    "[memory_tracker][sharded_counter]") {
+  MemoryTrackerManager tracker_manager;
+  auto tracker = tracker_manager.create_tracker();
+  auto resource = tracker->get_resource(MemoryType::RESULT_TILE);
+
+  // Allocate on a set of threads, then free every allocation on a different
+  // thread than the one that made it so that individual counter shards go
+  // negative, and check that the summed counts stay exact.
+  const size_t num_threads = 8;
+  const size_t allocs_per_thread = 100;
+  const size_t alloc_size = 64;
+  std::vector<std::vector<void*>> ptrs(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back([&, i]() {
+      for (size_t j = 0; j < allocs_per_thread; j++) {
+        ptrs[i].push_back(
+            resource->allocate(alloc_size, alignof(std::max_align_t)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto [total, by_type] = tracker->get_counts();
+  CHECK(total == num_threads * allocs_per_thread * alloc_size);
+  CHECK(by_type[MemoryType::RESULT_TILE] == total);
+
+  threads.clear();
+  for (size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back([&, i]() {
+      for (auto* ptr : ptrs[(i + 1) % num_threads]) {
+        resource->deallocate(ptr, alloc_size, alignof(std::max_align_t));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto [total_after, by_type_after] = tracker->get_counts();
+  CHECK(total_after == 0);
+  CHECK(by_type_after[MemoryType::RESULT_TILE] == 0);
+}
+
+TEST_CASE(
+    "Memory tracker: Test high-water mark",
+    "[memory_tracker][peak]") {
+  MemoryTrackerManager tracker_manager;
+  auto tracker = tracker_manager.create_tracker();
+  auto resource = tracker->get_resource(MemoryType::RESULT_TILE);
+
+  const size_t alloc_size = 16 * 1024 * 1024;
+  auto block = resource->allocate(alloc_size, alignof(std::max_align_t));
+  CHECK(tracker->get_peak_memory_usage() >= alloc_size);
+  resource->deallocate(block, alloc_size, alignof(std::max_align_t));
+
+  // The mark survives the free even though the current usage dropped.
+  auto [total, by_type] = tracker->get_counts();
+  CHECK(total == 0);
+  CHECK(tracker->get_peak_memory_usage() >= alloc_size);
+}
+
 TEST_CASE(
     "Memory tracker: Test budget exceeded callback",
     "[memory_tracker][budget_exceeded]") {
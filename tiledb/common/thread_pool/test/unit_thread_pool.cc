@@ -34,6 +34,7 @@
 
 #include <stdint.h>
 #include <test/support/tdb_catch.h>
+#include <algorithm>
 #include <atomic>
 #include <cstdio>
 #include <iostream>
@@ -193,6 +194,71 @@ TEST_CASE("ThreadPool: Test multiple threads", "[threadpool]") {
   REQUIRE(result == 100);
 }
 
+TEST_CASE("ThreadPool: Test affinity hints", "[threadpool]") {
+  bool use_wait = GENERATE(true, false);
+  std::atomic<int> result(0);
+  std::vector<ThreadPool::Task> results;
+  ThreadPool pool{4};
+
+  // All tasks prefer worker 0; the other workers must steal them for
+  // everything to complete in a reasonable time. Also check that
+  // this_worker() is valid inside a task and empty outside.
+  REQUIRE(!pool.this_worker().has_value());
+  for (int i = 0; i < 100; i++) {
+    results.push_back(pool.async_with_affinity(0, [&pool, &result]() {
+      auto worker = pool.this_worker();
+      if (!worker.has_value() || *worker >= pool.concurrency_level()) {
+        return Status_Error("Invalid worker index");
+      }
+      result++;
+      return Status::Ok();
+    }));
+  }
+  wait_all(pool, use_wait, results);
+  REQUIRE(result == 100);
+}
+
+TEST_CASE("ThreadPool: Test priority lanes", "[threadpool]") {
+  ThreadPool pool{1};
+  std::vector<ThreadPool::Task> results;
+  std::promise<void> gate;
+  std::shared_future<void> gate_future(gate.get_future());
+  std::mutex order_mutex;
+  std::vector<int> order;
+
+  // Block the single worker so the tasks below queue up behind it.
+  results.push_back(pool.execute([gate_future]() {
+    gate_future.wait();
+    return Status::Ok();
+  }));
+
+  for (int i = 0; i < 8; i++) {
+    results.push_back(pool.execute([&order_mutex, &order, i]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(i);
+      return Status::Ok();
+    }));
+  }
+
+  {
+    ThreadPool::PriorityScope scope(ThreadPool::Priority::INTERACTIVE);
+    results.push_back(pool.execute([&order_mutex, &order]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(-1);
+      return Status::Ok();
+    }));
+  }
+
+  gate.set_value();
+  REQUIRE(pool.wait_all(results).ok());
+
+  // The interactive task must overtake the queued bulk tasks, modulo
+  // the occasional dequeue the lane weighting grants to bulk work.
+  REQUIRE(order.size() == 9);
+  auto pos = std::find(order.begin(), order.end(), -1) - order.begin();
+  REQUIRE(pos <= 2);
+}
+
 TEST_CASE("ThreadPool: Test wait status", "[threadpool]") {
   bool use_wait = GENERATE(true, false);
   std::atomic<int> result(0);
@@ -35,19 +35,93 @@
 #include <queue>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <fstream>
+#include <sstream>
+#endif
+
 #include "tiledb/common/logger.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
 
 namespace tiledb::common {
 
+namespace {
+
+#if defined(__linux__)
+/** Parses a sysfs cpulist string, e.g. "0-15,32-47". */
+std::vector<int> parse_cpulist(const std::string& cpulist) {
+  std::vector<int> cpus;
+  std::stringstream ss(cpulist);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    const auto dash = range.find('-');
+    try {
+      if (dash == std::string::npos) {
+        cpus.push_back(std::stoi(range));
+      } else {
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+          cpus.push_back(cpu);
+        }
+      }
+    } catch (...) {
+      return {};
+    }
+  }
+  return cpus;
+}
+
+/**
+ * Returns the cpu sets of the NUMA nodes of the machine, read from
+ * sysfs. Returns an empty vector if the topology cannot be read or the
+ * machine has a single node, in which case pinning is pointless.
+ */
+std::vector<cpu_set_t> numa_node_cpusets() {
+  std::vector<cpu_set_t> cpusets;
+  for (size_t node = 0;; ++node) {
+    std::ifstream cpulist_file(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!cpulist_file.good()) {
+      break;
+    }
+    std::string cpulist;
+    std::getline(cpulist_file, cpulist);
+    const auto cpus = parse_cpulist(cpulist);
+    if (cpus.empty()) {
+      return {};
+    }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (const int cpu : cpus) {
+      CPU_SET(cpu, &cpuset);
+    }
+    cpusets.push_back(cpuset);
+  }
+  if (cpusets.size() < 2) {
+    return {};
+  }
+  return cpusets;
+}
+#endif
+
+}  // namespace
+
+thread_local const ThreadPool* ThreadPool::tl_pool_ = nullptr;
+thread_local size_t ThreadPool::tl_worker_index_ = 0;
+thread_local ThreadPool::Priority ThreadPool::tl_priority_ =
+    ThreadPool::Priority::BULK;
+
 // Constructor.  May throw an exception on error.  No logging is done as the
 // logger may not yet be initialized.
-ThreadPool::ThreadPool(size_t n)
+ThreadPool::ThreadPool(size_t n, bool pin_threads)
     : concurrency_level_(n) {
   // If concurrency_level_ is set to zero, construct the thread pool in shutdown
-  // state.  Explicitly shut down the task queue as well.
+  // state.
   if (concurrency_level_ == 0) {
-    task_queue_.drain();
+    shutdown_ = true;
     return;
   }
 
@@ -61,6 +135,24 @@ ThreadPool::ThreadPool(size_t n)
     throw std::runtime_error(msg);
   }
 
+  queues_.reserve(concurrency_level_);
+  for (size_t i = 0; i < concurrency_level_; ++i) {
+    queues_.emplace_back(make_shared<WorkerQueue>(HERE()));
+  }
+
+  // Discover the NUMA topology if the workers should be pinned.
+#if defined(__linux__)
+  std::vector<cpu_set_t> node_cpusets;
+  if (pin_threads) {
+    node_cpusets = numa_node_cpusets();
+    if (!node_cpusets.empty()) {
+      worker_numa_nodes_.assign(concurrency_level_, no_numa_node);
+    }
+  }
+#else
+  (void)pin_threads;
+#endif
+
   threads_.reserve(concurrency_level_);
 
   for (size_t i = 0; i < concurrency_level_; ++i) {
@@ -73,7 +165,7 @@ ThreadPool::ThreadPool(size_t n)
     size_t tries = 3;
     while (tries--) {
       try {
-        tmp = std::thread(&ThreadPool::worker, this);
+        tmp = std::thread(&ThreadPool::worker, this, i);
       } catch (const std::system_error& e) {
         if (e.code() != std::errc::resource_unavailable_try_again ||
             tries == 0) {
@@ -90,6 +182,19 @@ ThreadPool::ThreadPool(size_t n)
       break;
     }
 
+#if defined(__linux__)
+    // Pin the worker to the CPUs of its node, best-effort. Workers are
+    // distributed round-robin across the nodes.
+    if (!node_cpusets.empty()) {
+      const size_t node = i % node_cpusets.size();
+      if (pthread_setaffinity_np(
+              tmp.native_handle(), sizeof(cpu_set_t), &node_cpusets[node]) ==
+          0) {
+        worker_numa_nodes_[i] = node;
+      }
+    }
+#endif
+
     try {
       threads_.emplace_back(std::move(tmp));
     } catch (...) {
@@ -99,22 +204,133 @@ ThreadPool::ThreadPool(size_t n)
   }
 }
 
-void ThreadPool::worker() {
+void ThreadPool::worker(const size_t index) {
+  tl_pool_ = this;
+  tl_worker_index_ = index;
+
   while (true) {
-    auto val = task_queue_.pop();
-    if (val) {
-      (*(*val))();
-    } else {
+    if (auto task = try_dequeue_task(index)) {
+      run_task(*task);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(wakeup_mutex_);
+    wakeup_cv_.wait(lock, [this]() {
+      return shutdown_ || num_queued_.load(std::memory_order_acquire) > 0;
+    });
+
+    // Drain the remaining tasks before exiting at shutdown.
+    if (shutdown_ && num_queued_.load(std::memory_order_acquire) == 0) {
       break;
     }
   }
 }
 
+void ThreadPool::push_task(
+    const size_t affinity, const Priority priority, TaskEntry task) {
+  auto& queue = *queues_[affinity % queues_.size()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    queue.lanes_[static_cast<size_t>(priority)].push_back(std::move(task));
+  }
+
+  // Publish the new task under the wakeup lock so that the
+  // notification cannot race with a worker that found the queues empty
+  // and is about to go to sleep.
+  {
+    std::lock_guard<std::mutex> lock(wakeup_mutex_);
+    num_queued_.fetch_add(1, std::memory_order_release);
+  }
+  wakeup_cv_.notify_one();
+}
+
+std::optional<ThreadPool::DequeuedTask> ThreadPool::try_dequeue_task(
+    const size_t hint, const Priority max_priority) {
+  const size_t num_queues = queues_.size();
+  if (num_queues == 0 ||
+      num_queued_.load(std::memory_order_acquire) == 0) {
+    return std::nullopt;
+  }
+
+  // Check the preferred queue first, then steal from the others.
+  for (size_t i = 0; i < num_queues; ++i) {
+    auto& queue = *queues_[(hint + i) % num_queues];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+
+    // Weighted lane selection: interactive work is preferred, but bulk
+    // claims one in every 4 dequeues and background one in every 16,
+    // so the lower lanes cannot starve under a flood of interactive
+    // tasks.
+    const size_t max_lane = static_cast<size_t>(max_priority);
+    const uint64_t tick = queue.ticks_++;
+    size_t preferred = static_cast<size_t>(Priority::INTERACTIVE);
+    if (tick % 16 == 15) {
+      preferred = static_cast<size_t>(Priority::BACKGROUND);
+    } else if (tick % 4 == 3) {
+      preferred = static_cast<size_t>(Priority::BULK);
+    }
+    if (preferred > max_lane) {
+      preferred = static_cast<size_t>(Priority::INTERACTIVE);
+    }
+
+    auto pop_lane = [&](size_t l) -> std::optional<DequeuedTask> {
+      auto& lane = queue.lanes_[l];
+      if (lane.empty()) {
+        return std::nullopt;
+      }
+      TaskEntry task = std::move(lane.front());
+      lane.pop_front();
+      num_queued_.fetch_sub(1, std::memory_order_release);
+      return DequeuedTask(std::move(task), static_cast<Priority>(l));
+    };
+
+    if (auto task = pop_lane(preferred)) {
+      return task;
+    }
+    for (size_t l = 0; l <= max_lane; ++l) {
+      if (l == preferred) {
+        continue;
+      }
+      if (auto task = pop_lane(l)) {
+        return task;
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+void ThreadPool::run_task(DequeuedTask& entry) {
+  const Priority previous = tl_priority_;
+  tl_priority_ = entry.second;
+  (*entry.first)();
+  tl_priority_ = previous;
+}
+
+std::optional<size_t> ThreadPool::this_worker() const {
+  if (tl_pool_ == this) {
+    return tl_worker_index_;
+  }
+  return std::nullopt;
+}
+
+std::optional<size_t> ThreadPool::worker_numa_node(const size_t index) const {
+  if (index < worker_numa_nodes_.size() &&
+      worker_numa_nodes_[index] != no_numa_node) {
+    return worker_numa_nodes_[index];
+  }
+  return std::nullopt;
+}
+
 // shutdown is private and only called by constructor and destructor (RAII), so
 // shutdown won't be called from multiple threads.
 void ThreadPool::shutdown() {
   concurrency_level_.store(0);
-  task_queue_.drain();
+  {
+    std::lock_guard<std::mutex> lock(wakeup_mutex_);
+    shutdown_ = true;
+  }
+  wakeup_cv_.notify_all();
   for (auto&& t : threads_) {
     t.join();
   }
@@ -140,6 +356,7 @@ Status ThreadPool::wait_all(std::vector<Task>& tasks) {
 // don't throw in the case of errors/exceptions.
 std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
   std::vector<Status> statuses(tasks.size());
+  uint64_t idle_spins = 0;
 
   std::queue<size_t> pending_tasks;
 
@@ -186,18 +403,23 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
       // If the task is not completed, try again later
       pending_tasks.push(task_id);
 
-      // In the meantime, try to do something useful to make progress (and avoid
-      // deadlock)
-      if (auto val = task_queue_.try_pop()) {
-        (*(*val))();
-      } else {
+      // In the meantime, try to do something useful to make progress (and
+      // avoid deadlock). Prefer tasks at the waiting context's priority or
+      // higher, so a short wait does not trampoline long lower-priority
+      // work; only steal from the lower lanes if the wait drags on.
+      const size_t hint = this_worker().value_or(0);
+      if (auto val = try_dequeue_task(hint, tl_priority_)) {
+        run_task(*val);
+        idle_spins = 0;
+      } else if (idle_spins++ < max_idle_spins_before_stealing) {
         // If nothing useful to do, yield so we don't burn cycles
         // going through the task list over and over (thereby slowing down other
         // threads).
         std::this_thread::yield();
-
-        // (An alternative would be to wait some amount of time)
-        // task.wait_for(std::chrono::milliseconds(10));
+      } else if (auto val = try_dequeue_task(hint)) {
+        run_task(*val);
+      } else {
+        std::this_thread::yield();
       }
     }
   }
@@ -206,6 +428,7 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
 }
 
 Status ThreadPool::wait(Task& task) {
+  uint64_t idle_spins = 0;
   while (true) {
     if (!task.valid()) {
       return Status_ThreadPoolError("Invalid task future");
@@ -235,10 +458,18 @@ Status ThreadPool::wait(Task& task) {
 
       return st;
     } else {
-      // In the meantime, try to do something useful to make progress (and avoid
-      // deadlock)
-      if (auto val = task_queue_.try_pop()) {
-        (*(*val))();
+      // In the meantime, try to do something useful to make progress (and
+      // avoid deadlock). Prefer tasks at the waiting context's priority or
+      // higher, so a short wait does not trampoline long lower-priority
+      // work; only steal from the lower lanes if the wait drags on.
+      const size_t hint = this_worker().value_or(0);
+      if (auto val = try_dequeue_task(hint, tl_priority_)) {
+        run_task(*val);
+        idle_spins = 0;
+      } else if (idle_spins++ < max_idle_spins_before_stealing) {
+        std::this_thread::yield();
+      } else if (auto val = try_dequeue_task(hint)) {
+        run_task(*val);
       } else {
         std::this_thread::yield();
       }
@@ -33,10 +33,14 @@
 #ifndef TILEDB_THREAD_POOL_H
 #define TILEDB_THREAD_POOL_H
 
-#include "producer_consumer_queue.h"
-
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
@@ -49,6 +53,49 @@ class ThreadPool {
  public:
   using Task = std::future<Status>;
 
+  /** The priority lanes tasks may be scheduled on. */
+  enum class Priority : uint8_t {
+    /** Latency-critical work, e.g. array-open metadata loads. */
+    INTERACTIVE = 0,
+    /** Regular query work; the default. */
+    BULK = 1,
+    /** Maintenance work that should yield to everything else. */
+    BACKGROUND = 2,
+  };
+
+  /** The number of priority lanes. */
+  static constexpr size_t num_priorities = 3;
+
+  /**
+   * RAII scope that sets the priority lane of the tasks the calling
+   * thread schedules with `async()`. Tasks inherit the lane of the
+   * task that scheduled them, so a scope opened before a parallel
+   * region applies to nested submissions as well.
+   */
+  class PriorityScope {
+   public:
+    /** Constructor. */
+    explicit PriorityScope(Priority priority)
+        : previous_(tl_priority_) {
+      tl_priority_ = priority;
+    }
+
+    /** Copy constructor. */
+    DISABLE_COPY(PriorityScope);
+
+    /** Copy-assignment. */
+    DISABLE_COPY_ASSIGN(PriorityScope);
+
+    /** Destructor. */
+    ~PriorityScope() {
+      tl_priority_ = previous_;
+    }
+
+   private:
+    /** The priority to restore when the scope ends. */
+    Priority previous_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -61,8 +108,14 @@ class ThreadPool {
    * zero will construct the thread pool in its shutdown state--constructed but
    * not accepting nor executing any tasks.  A value of 256*hardware_concurrency
    * or larger is an error.
+   * @param pin_threads If `true`, partition the workers across the NUMA
+   * nodes of the machine and pin each worker to the CPUs of its node.
+   * Memory a pinned worker allocates and first touches is then
+   * node-local, and affinity hints keep follow-up work on the same
+   * node. Best-effort: a no-op on platforms without a readable NUMA
+   * topology or on single-node machines.
    */
-  explicit ThreadPool(size_t n);
+  explicit ThreadPool(size_t n, bool pin_threads = false);
 
   /** Deleted default constructor */
   ThreadPool() = delete;
@@ -93,6 +146,30 @@ class ThreadPool {
 
   template <class Fn, class... Args>
   auto async(Fn&& f, Args&&... args) {
+    return async_with_affinity(
+        next_queue_.fetch_add(1, std::memory_order_relaxed),
+        std::forward<Fn>(f),
+        std::forward<Args>(args)...);
+  }
+
+  /**
+   * Schedule a new task to be executed, with a hint about the worker
+   * that should run it. The task is queued on the calling thread's
+   * current priority lane. Scheduling with the index returned by
+   * `this_worker()` inside an earlier task lands the new task on the
+   * worker that ran that task, so data the earlier task touched is
+   * still warm in that core's caches. The hint is not a guarantee: an
+   * idle worker steals queued tasks from the other workers rather than
+   * sleeping.
+   *
+   * @param affinity Index of the preferred worker, taken modulo the
+   * concurrency level.
+   * @param f Callable object to call
+   * @param args... Parameters to pass to f
+   * @return std::future referring to the shared state created by this call
+   */
+  template <class Fn, class... Args>
+  auto async_with_affinity(size_t affinity, Fn&& f, Args&&... args) {
     if (concurrency_level_ == 0) {
       Task invalid_future;
       LOG_ERROR("Cannot execute task; thread pool uninitialized.");
@@ -110,11 +187,28 @@ class ThreadPool {
 
     std::future<R> future = task->get_future();
 
-    task_queue_.push(task);
+    push_task(affinity, tl_priority_, task);
 
     return future;
   }
 
+  /**
+   * Returns the index of the worker the calling thread corresponds to,
+   * if the calling thread is a worker of this pool, and nothing
+   * otherwise. The result may be passed to `async_with_affinity()` to
+   * schedule follow-up work on the same worker.
+   */
+  std::optional<size_t> this_worker() const;
+
+  /**
+   * Returns the NUMA node the given worker is pinned to, or nothing if
+   * the workers are not pinned. Workers `i` and `j` share a node iff
+   * `i % num_nodes == j % num_nodes`, so schedulers can keep related
+   * tasks node-local by reusing affinity hints congruent modulo the
+   * node count.
+   */
+  std::optional<size_t> worker_numa_node(size_t index) const;
+
   /**
    * Alias for async()
    *
@@ -169,23 +263,103 @@ class ThreadPool {
   /* ********************************* */
 
  private:
+  /** The type of the tasks kept in the worker queues. */
+  using TaskEntry = shared_ptr<std::packaged_task<Status()>>;
+
+  /** A dequeued task, together with the lane it was queued on. */
+  using DequeuedTask = std::pair<TaskEntry, Priority>;
+
+  /** A per-worker task queue. */
+  struct WorkerQueue {
+    /** Protects `lanes_` and `ticks_`. */
+    std::mutex mutex_;
+
+    /** The tasks queued on this worker, one deque per priority lane. */
+    std::deque<TaskEntry> lanes_[num_priorities];
+
+    /** The number of dequeues served; drives the lane weighting. */
+    uint64_t ticks_ = 0;
+  };
+
   /** The worker thread routine */
-  void worker();
+  void worker(size_t index);
+
+  /** Enqueues a task on the worker queue selected by `affinity`. */
+  void push_task(size_t affinity, Priority priority, TaskEntry task);
+
+  /**
+   * Dequeues a task, checking the worker queue selected by `hint`
+   * first and stealing from the other queues if it is empty. Within a
+   * queue, lanes are weighted so that interactive work is preferred
+   * without starving the lower lanes. Only lanes at `max_priority` or
+   * higher are considered. Returns nothing if no eligible task is
+   * queued.
+   */
+  std::optional<DequeuedTask> try_dequeue_task(
+      size_t hint, Priority max_priority = Priority::BACKGROUND);
+
+  /**
+   * Runs a dequeued task, making its lane the calling thread's current
+   * priority for the duration so that nested submissions inherit it.
+   */
+  void run_task(DequeuedTask& entry);
 
   /** Terminate threads in the thread pool */
   void shutdown();
 
-  /** Producer-consumer queue where functions to be executed are kept */
-  ProducerConsumerQueue<
-      shared_ptr<std::packaged_task<Status()>>,
-      std::deque<shared_ptr<std::packaged_task<Status()>>>>
-      task_queue_;
+  /**
+   * The number of unproductive spins a waiting thread tolerates before
+   * it starts executing tasks from lanes below its own priority. Keeps
+   * short waits from trampolining long lower-priority work while still
+   * guaranteeing progress for recursive waits.
+   */
+  static constexpr uint64_t max_idle_spins_before_stealing = 64;
+
+  /**
+   * The per-worker task queues. Workers contend only on their own
+   * queue, its submitters and the occasional stealer, instead of on
+   * one pool-wide queue.
+   */
+  std::vector<shared_ptr<WorkerQueue>> queues_;
+
+  /** Round-robin counter selecting the queue for unhinted tasks. */
+  std::atomic<size_t> next_queue_{0};
+
+  /** The number of queued, not-yet-dequeued tasks, across all queues. */
+  std::atomic<size_t> num_queued_{0};
+
+  /** Protects `shutdown_`; pairs with `wakeup_cv_`. */
+  std::mutex wakeup_mutex_;
+
+  /** Wakes up idle workers when tasks arrive or at shutdown. */
+  std::condition_variable wakeup_cv_;
+
+  /** Whether the pool is shutting down. */
+  bool shutdown_{false};
 
   /** The worker threads */
   std::vector<std::thread> threads_;
 
+  /**
+   * The NUMA node each worker is pinned to, empty if the workers are
+   * not pinned. Workers that failed to pin hold `no_numa_node`.
+   */
+  std::vector<size_t> worker_numa_nodes_;
+
+  /** Sentinel for a worker without a NUMA node assignment. */
+  static constexpr size_t no_numa_node = static_cast<size_t>(-1);
+
   /** The maximum level of concurrency among all of the worker threads */
   std::atomic<size_t> concurrency_level_;
+
+  /** The pool the calling thread is a worker of, if any. */
+  static thread_local const ThreadPool* tl_pool_;
+
+  /** The worker index of the calling thread within `tl_pool_`. */
+  static thread_local size_t tl_worker_index_;
+
+  /** The priority lane the calling thread schedules tasks on. */
+  static thread_local Priority tl_priority_;
 };
 }  // namespace tiledb::common
 
@@ -48,6 +48,7 @@
 #include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/enums/serialization_type.h"
+#include "tiledb/sm/fragment/fragment_identifier.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/global_state/unit_test_config.h"
 #include "tiledb/sm/misc/parallel_functions.h"
@@ -102,6 +103,8 @@ Array::Array(
     , config_(resources_.config())
     , remote_(array_uri.is_tiledb())
     , memory_tracker_(resources_.create_memory_tracker())
+    , label_range_cache_(
+          config_.get<uint64_t>("sm.label_range_cache_size", Config::must_find))
     , consistency_controller_(cc)
     , consistency_sentry_(nullopt) {
 }
@@ -424,6 +427,11 @@ void Array::load_fragments(
     const std::vector<TimestampedURI>& fragments_to_load) {
   auto timer_se = resources_.stats().start_timer("sm_array_load_fragments");
 
+  // The tombstone masks and bloom filters are keyed on fragment indices,
+  // which change with the loaded fragments
+  opened_array_->clear_tombstone_masks();
+  opened_array_->clear_bloom_filters();
+
   // Load the fragment metadata
   std::unordered_map<std::string, std::pair<Tile*, uint64_t>> offsets;
   set_fragment_metadata(FragmentMetadata::load(
@@ -869,7 +877,9 @@ std::vector<shared_ptr<const Enumeration>> Array::get_enumerations(
     throw ArrayException("Unable to load enumerations; Array is not open.");
   }
 
-  // Dedupe requested names and filter out anything already loaded.
+  // Dedupe requested names and filter out anything already loaded. The
+  // check is lock-free so that queries whose enumerations are already
+  // loaded do not contend on the lazy load mutex below.
   std::unordered_set<std::string> enmrs_to_load;
   for (auto& enmr_name : enumeration_names) {
     if (array_schema_latest().is_enumeration_loaded(enmr_name)) {
@@ -881,9 +891,23 @@ std::vector<shared_ptr<const Enumeration>> Array::get_enumerations(
   // Only attempt to load enumerations if we have at least one Enumeration
   // to load.
   if (enmrs_to_load.size() > 0) {
+    // Serialize the load across queries sharing this opened array and
+    // recheck, as a concurrent query may have just loaded some of the
+    // requested enumerations; storing one twice is an error.
+    std::lock_guard<std::mutex> lg(opened_array_->lazy_load_mtx());
+    for (auto it = enmrs_to_load.begin(); it != enmrs_to_load.end();) {
+      if (array_schema_latest().is_enumeration_loaded(*it)) {
+        it = enmrs_to_load.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
     std::vector<shared_ptr<const Enumeration>> loaded;
 
-    if (remote_) {
+    if (enmrs_to_load.empty()) {
+      // A concurrent query loaded everything requested.
+    } else if (remote_) {
       auto rest_client = resources_.rest_client();
       if (rest_client == nullptr) {
         throw ArrayException(
@@ -942,7 +966,11 @@ bool Array::is_empty() const {
 }
 
 bool Array::is_open() {
-  std::lock_guard<std::mutex> lock(mtx_);
+  // The flag is atomic, so checking it does not need `mtx_`. The mutex
+  // only guards the atomicity between the flag and the consistency
+  // sentry during open and close, which a plain read does not observe.
+  // Queries sharing this array check the flag concurrently and locking
+  // here serializes them needlessly.
   return is_open_;
 }
 
@@ -1191,6 +1219,146 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
   return Status::Ok();
 }
 
+Status Array::delta_refresh() {
+  auto timer = resources_.stats().start_timer("array_delta_refresh");
+
+  // Check the array was opened already in READ mode.
+  if (!is_open_) {
+    return LOG_STATUS(
+        Status_ArrayError("Cannot refresh array; Array is not open"));
+  }
+  if (query_type_ != QueryType::READ) {
+    return LOG_STATUS(Status_ArrayError(
+        "Cannot refresh array; Array was not opened in read mode"));
+  }
+
+  // Remote arrays and user-set end timestamps cannot be refreshed
+  // incrementally.
+  if (remote_ ||
+      (user_set_timestamp_end_.has_value() &&
+       user_set_timestamp_end_.value() != array_dir_timestamp_end_)) {
+    return reopen();
+  }
+
+  auto new_timestamp_end = utils::time::timestamp_now_ms();
+
+  // A single LIST of the commits directory discovers everything written
+  // since the array was opened: fragments of format version 12 or higher
+  // commit by creating a timestamp-named file there.
+  std::vector<URI> commits_dir_uris;
+  try {
+    commits_dir_uris = array_directory().list_commits_dir_uris();
+  } catch (const std::exception& e) {
+    return LOG_STATUS(Status_ArrayDirectoryError(e.what()));
+  }
+
+  // Collect the names of the fragments that are already open.
+  std::unordered_set<std::string> open_fragments;
+  for (const auto& meta : fragment_metadata()) {
+    open_fragments.emplace(meta->fragment_uri().last_path_part());
+  }
+
+  // Compute the fragment delta. Anything that is not a plain fragment
+  // commit (delete, update, vacuum or consolidated commit files) changes
+  // the view of the fragments already open, so fall back to a full reopen
+  // when such a file appeared after the last open.
+  const bool dense = array_schema_latest().dense();
+  std::vector<TimestampedURI> to_load;
+  try {
+    for (const auto& uri : commits_dir_uris) {
+      if (stdx::string::ends_with(
+              uri.to_string(), constants::write_file_suffix)) {
+        auto name = uri.last_path_part();
+        name =
+            name.substr(0, name.size() - constants::write_file_suffix.size());
+        if (open_fragments.count(name) != 0) {
+          continue;
+        }
+
+        FragmentID fragment_id{uri};
+        auto timestamp_range{fragment_id.timestamp_range()};
+        auto overlaps =
+            dense ? (timestamp_range.first >= array_dir_timestamp_start_ &&
+                     timestamp_range.second <= new_timestamp_end) :
+                    (timestamp_range.first <= new_timestamp_end &&
+                     timestamp_range.second >= array_dir_timestamp_start_);
+        if (overlaps) {
+          to_load.emplace_back(
+              array_uri_.join_path(constants::array_fragments_dir_name)
+                  .join_path(name),
+              timestamp_range);
+        }
+      } else {
+        FragmentID fragment_id{uri};
+        if (fragment_id.timestamp_range().second > array_dir_timestamp_end_) {
+          return reopen();
+        }
+      }
+    }
+  } catch (const std::exception&) {
+    // An unparsable commits directory entry; let reopen deal with it.
+    return reopen();
+  }
+
+  // Nothing new was written: only slide the end timestamp forward.
+  if (to_load.empty()) {
+    array_dir_timestamp_end_ = new_timestamp_end;
+    return Status::Ok();
+  }
+
+  std::sort(to_load.begin(), to_load.end());
+
+  // Load the metadata of the new fragments only. A fragment written under
+  // a schema this array has not seen makes the load throw; fall back to a
+  // full reopen, which reloads the schemas too.
+  std::vector<shared_ptr<FragmentMetadata>> new_metadata;
+  try {
+    std::unordered_map<std::string, std::pair<Tile*, uint64_t>> offsets;
+    new_metadata = FragmentMetadata::load(
+        resources_,
+        memory_tracker(),
+        opened_array_->array_schema_latest_ptr(),
+        array_schemas_all(),
+        *encryption_key(),
+        to_load,
+        offsets);
+  } catch (const std::exception&) {
+    return reopen();
+  }
+
+  // Append to the opened array state.
+  auto& metadata = fragment_metadata();
+  metadata.insert(metadata.end(), new_metadata.begin(), new_metadata.end());
+  opened_array_->clear_relevant_fragments_cache();
+  array_dir_timestamp_end_ = new_timestamp_end;
+
+  return Status::Ok();
+}
+
+void Array::delta_refresh_async() {
+  std::lock_guard<std::mutex> lock(delta_refresh_task_mtx_);
+  if (delta_refresh_task_.valid()) {
+    // A refresh is already in flight.
+    return;
+  }
+
+  delta_refresh_task_ =
+      resources_.compute_tp().execute([this]() { return delta_refresh(); });
+}
+
+Status Array::await_delta_refresh() {
+  ThreadPool::Task task;
+  {
+    std::lock_guard<std::mutex> lock(delta_refresh_task_mtx_);
+    if (!delta_refresh_task_.valid()) {
+      return Status::Ok();
+    }
+    task = std::move(delta_refresh_task_);
+  }
+
+  return resources_.compute_tp().wait(task);
+}
+
 void Array::set_config(Config config) {
   if (is_open()) {
     throw ArrayException("[set_config] Cannot set a config on an open array");
@@ -1272,8 +1440,29 @@ void Array::get_metadata(
     throw ArrayException("Cannot get metadata; Key cannot be null");
   }
 
-  // Load array metadata, if not loaded yet
+  // Load array metadata, if not loaded yet. For local arrays, serve the
+  // lookup from the raw metadata tiles instead, deferring the full
+  // deserialization until an API that needs all keys is called.
   if (!metadata_loaded()) {
+    if (!remote_) {
+      const auto& value_struct = cached_metadata_value(key);
+      if (value_struct.del_) {
+        // Key not found
+        *value = nullptr;
+        return;
+      }
+
+      *value_type = static_cast<Datatype>(value_struct.type_);
+      if (value_struct.num_ == 0) {
+        // zero-valued keys
+        *value_num = 1;
+        *value = nullptr;
+      } else {
+        *value_num = value_struct.num_;
+        *value = (const void*)(value_struct.value_.data());
+      }
+      return;
+    }
     throw_if_not_ok(load_metadata());
   }
 
@@ -1344,8 +1533,17 @@ std::optional<Datatype> Array::metadata_type(const char* key) {
     throw ArrayException("Cannot get metadata; Key cannot be null");
   }
 
-  // Load array metadata, if not loaded yet
+  // Load array metadata, if not loaded yet. For local arrays, serve the
+  // lookup from the raw metadata tiles instead.
   if (!metadata_loaded()) {
+    if (!remote_) {
+      const auto& value_struct = cached_metadata_value(key);
+      if (value_struct.del_) {
+        // Key not found
+        return nullopt;
+      }
+      return static_cast<Datatype>(value_struct.type_);
+    }
     throw_if_not_ok(load_metadata());
   }
 
@@ -2016,22 +2214,39 @@ Status Array::compute_max_buffer_sizes(
 }
 
 void Array::do_load_metadata() {
+  auto timer_se = resources_.stats().start_timer("sm_load_array_metadata");
+
+  opened_array_->metadata() = Metadata::deserialize(load_metadata_tiles());
+
+  // Sets the loaded metadata URIs
+  opened_array_->metadata().set_loaded_metadata_uris(
+      array_directory().array_meta_uris());
+
+  // The raw tiles are no longer needed once fully deserialized
+  opened_array_->metadata_tiles().clear();
+}
+
+const std::vector<shared_ptr<Tile>>& Array::load_metadata_tiles() {
   if (!array_directory().loaded()) {
     throw ArrayException(
         "Cannot load metadata; array directory is not loaded.");
   }
-  auto timer_se = resources_.stats().start_timer("sm_load_array_metadata");
+
+  auto& metadata_tiles = opened_array_->metadata_tiles();
+  if (!metadata_tiles.empty()) {
+    return metadata_tiles;
+  }
 
   // Determine which array metadata to load
   const auto& array_metadata_to_load = array_directory().array_meta_uris();
 
   auto metadata_num = array_metadata_to_load.size();
-  std::vector<shared_ptr<Tile>> metadata_tiles(metadata_num);
+  std::vector<shared_ptr<Tile>> tiles(metadata_num);
   throw_if_not_ok(
       parallel_for(&resources_.compute_tp(), 0, metadata_num, [&](size_t m) {
         const auto& uri = array_metadata_to_load[m].uri_;
 
-        metadata_tiles[m] = GenericTileIO::load(
+        tiles[m] = GenericTileIO::load(
             resources_, uri, 0, *encryption_key(), memory_tracker_);
 
         return Status::Ok();
@@ -2039,18 +2254,46 @@ void Array::do_load_metadata() {
 
   // Compute array metadata size for the statistics
   uint64_t meta_size = 0;
-  for (const auto& t : metadata_tiles) {
+  for (const auto& t : tiles) {
     meta_size += t->size();
   }
   resources_.stats().add_counter("read_array_meta_size", meta_size);
 
-  opened_array_->metadata() = Metadata::deserialize(metadata_tiles);
+  metadata_tiles = std::move(tiles);
+  return metadata_tiles;
+}
+
+const Metadata::MetadataValue& Array::cached_metadata_value(const char* key) {
+  // Targeted lookups may run from concurrent queries sharing this opened
+  // array; the cache and the raw tiles are guarded by the lazy load
+  // mutex, like the full metadata load.
+  std::lock_guard<std::mutex> lg(opened_array_->lazy_load_mtx());
+  auto& cache = opened_array_->metadata_cache();
+  auto it = cache.find(key);
+  if (it == cache.end()) {
+    auto found = Metadata::get_from_tiles(load_metadata_tiles(), key);
+    Metadata::MetadataValue value_struct;
+    if (found.has_value()) {
+      value_struct = std::move(*found);
+    } else {
+      // Record the miss so repeated lookups do not rescan the tiles
+      value_struct.del_ = 1;
+    }
+    it = cache.emplace(key, std::move(value_struct)).first;
+  }
 
-  // Sets the loaded metadata URIs
-  opened_array_->metadata().set_loaded_metadata_uris(array_metadata_to_load);
+  return it->second;
 }
 
 Status Array::load_metadata() {
+  // Serialize the lazy load across queries sharing this opened array and
+  // recheck under the lock, as a concurrent query may have just loaded
+  // the metadata. Callers that found it loaded never reach this lock.
+  std::lock_guard<std::mutex> lg(opened_array_->lazy_load_mtx());
+  if (metadata_loaded()) {
+    return Status::Ok();
+  }
+
   if (remote_) {
     auto rest_client = resources_.rest_client();
     if (rest_client == nullptr) {
@@ -2185,6 +2428,16 @@ void Array::upgrade_version(
 Status Array::compute_non_empty_domain() {
   // Keep the current opened array alive for the duration of this call.
   auto opened_array = opened_array_;
+
+  // Serialize the lazy computation across queries sharing this opened
+  // array and recheck under the lock, as a concurrent query may have
+  // just computed the domain. Callers that found it computed never
+  // reach this lock.
+  std::lock_guard<std::mutex> lg(opened_array->lazy_load_mtx());
+  if (opened_array->non_empty_domain_computed()) {
+    return Status::Ok();
+  }
+
   auto& fragment_metadata = opened_array->fragment_metadata();
   auto& array_schema_latest = opened_array->array_schema_latest();
   auto& non_empty_domain = opened_array->non_empty_domain();
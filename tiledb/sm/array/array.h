@@ -41,10 +41,12 @@
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array/consistency.h"
+#include "tiledb/sm/cache/label_range_cache.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/crypto/encryption_key.h"
 #include "tiledb/sm/fragment/fragment_info.h"
 #include "tiledb/sm/metadata/metadata.h"
+#include "tiledb/sm/misc/bloom_filter.h"
 
 using namespace tiledb::common;
 
@@ -75,6 +77,28 @@ enum class QueryType : uint8_t;
  */
 class OpenedArray {
  public:
+  /**
+   * Cached outcome of a relevant fragments computation.
+   *
+   * A later query whose ranges are all contained in `ranges` can restrict
+   * its own relevant fragments computation to `relevant_fragments`: a
+   * fragment whose non-empty domain does not overlap the cached ranges
+   * cannot overlap any range contained in them.
+   */
+  struct RelevantFragmentsCacheEntry {
+    /** The ranges the computation was done for, per dimension. */
+    std::vector<std::vector<Range>> ranges;
+
+    /** Whether each dimension was default for the computation. */
+    std::vector<bool> is_default;
+
+    /** The number of fragments the computation was done on. */
+    size_t fragment_num;
+
+    /** The indexes of the fragments relevant to the ranges. */
+    std::vector<unsigned> relevant_fragments;
+  };
+
   /* No default constructor. */
   OpenedArray() = delete;
 
@@ -168,6 +192,24 @@ class OpenedArray {
     return metadata_loaded_;
   }
 
+  /**
+   * Gets a reference to the raw array metadata tiles, cached so that
+   * targeted key lookups that precede a full metadata load do not read
+   * the metadata files again.
+   */
+  inline std::vector<shared_ptr<Tile>>& metadata_tiles() {
+    return metadata_tiles_;
+  }
+
+  /**
+   * Gets a reference to the cache of targeted metadata key lookups. The
+   * entries keep the pointers returned to the user valid after a later
+   * full metadata load replaces the metadata map.
+   */
+  inline std::map<std::string, Metadata::MetadataValue>& metadata_cache() {
+    return metadata_cache_;
+  }
+
   /** Get a reference to the `non_empty_domain_computed_` value. */
   inline bool& non_empty_domain_computed() {
     return non_empty_domain_computed_;
@@ -183,6 +225,106 @@ class OpenedArray {
     return fragment_metadata_;
   }
 
+  /**
+   * Returns a copy of the cached relevant fragments computation, if any.
+   * Queries on the same opened array may run concurrently, so a copy is
+   * returned instead of a reference.
+   */
+  inline optional<RelevantFragmentsCacheEntry> relevant_fragments_cache()
+      const {
+    std::lock_guard<std::mutex> lg(relevant_fragments_cache_mtx_);
+    return relevant_fragments_cache_;
+  }
+
+  /** Caches the outcome of a relevant fragments computation. */
+  inline void set_relevant_fragments_cache(RelevantFragmentsCacheEntry entry) {
+    std::lock_guard<std::mutex> lg(relevant_fragments_cache_mtx_);
+    relevant_fragments_cache_ = std::move(entry);
+  }
+
+  /** Clears the cached relevant fragments computation. */
+  inline void clear_relevant_fragments_cache() {
+    std::lock_guard<std::mutex> lg(relevant_fragments_cache_mtx_);
+    relevant_fragments_cache_ = nullopt;
+  }
+
+  /**
+   * Returns the cached tombstone mask of a fragment tile (the cells
+   * cleared by the delete conditions of this opened array), or `nullptr`
+   * if it has not been computed yet. Queries on the same opened array may
+   * run concurrently, so the mask is shared and immutable. An empty mask
+   * means no condition applies to the tile.
+   */
+  inline shared_ptr<const std::vector<uint8_t>> tombstone_mask(
+      unsigned frag_idx, uint64_t tile_idx) const {
+    std::lock_guard<std::mutex> lg(tombstone_mask_cache_mtx_);
+    auto it = tombstone_mask_cache_.find({frag_idx, tile_idx});
+    return it == tombstone_mask_cache_.end() ? nullptr : it->second;
+  }
+
+  /** Caches the tombstone mask of a fragment tile. */
+  inline void set_tombstone_mask(
+      unsigned frag_idx,
+      uint64_t tile_idx,
+      shared_ptr<const std::vector<uint8_t>> mask) {
+    std::lock_guard<std::mutex> lg(tombstone_mask_cache_mtx_);
+    tombstone_mask_cache_[{frag_idx, tile_idx}] = std::move(mask);
+  }
+
+  /**
+   * Clears the cached tombstone masks. Must be called when the fragment
+   * metadata of the opened array is replaced, as the masks are keyed on
+   * fragment indices.
+   */
+  inline void clear_tombstone_masks() {
+    std::lock_guard<std::mutex> lg(tombstone_mask_cache_mtx_);
+    tombstone_mask_cache_.clear();
+  }
+
+  /**
+   * Returns the cached bloom filter over the values of a field in a
+   * fragment tile, or `nullptr` if it has not been computed yet. Queries
+   * on the same opened array may run concurrently, so the filter is
+   * shared and immutable.
+   */
+  inline shared_ptr<const BloomFilter> bloom_filter(
+      const std::string& name, unsigned frag_idx, uint64_t tile_idx) const {
+    std::lock_guard<std::mutex> lg(bloom_filter_cache_mtx_);
+    auto it = bloom_filter_cache_.find({name, frag_idx, tile_idx});
+    return it == bloom_filter_cache_.end() ? nullptr : it->second;
+  }
+
+  /** Caches the bloom filter of a field in a fragment tile. */
+  inline void set_bloom_filter(
+      const std::string& name,
+      unsigned frag_idx,
+      uint64_t tile_idx,
+      shared_ptr<const BloomFilter> filter) {
+    std::lock_guard<std::mutex> lg(bloom_filter_cache_mtx_);
+    bloom_filter_cache_[{name, frag_idx, tile_idx}] = std::move(filter);
+  }
+
+  /**
+   * Clears the cached bloom filters. Must be called when the fragment
+   * metadata of the opened array is replaced, as the filters are keyed on
+   * fragment indices.
+   */
+  inline void clear_bloom_filters() {
+    std::lock_guard<std::mutex> lg(bloom_filter_cache_mtx_);
+    bloom_filter_cache_.clear();
+  }
+
+  /**
+   * Returns the mutex that serializes the lazy loads of opened-array
+   * state (array metadata, non-empty domain, enumerations) across
+   * queries sharing this opened array. Only the slow path of a lazy
+   * load takes this lock; once the state is loaded, accessors read it
+   * without any locking.
+   */
+  inline std::mutex& lazy_load_mtx() const {
+    return lazy_load_mtx_;
+  }
+
   /** Returns a constant pointer to the encryption key. */
   inline const EncryptionKey* encryption_key() const {
     return encryption_key_.get();
@@ -247,6 +389,12 @@ class OpenedArray {
   /** True if the array metadata is loaded. */
   bool metadata_loaded_;
 
+  /** The raw array metadata tiles, cached for targeted key lookups. */
+  std::vector<shared_ptr<Tile>> metadata_tiles_;
+
+  /** A cache of targeted metadata key lookups. */
+  std::map<std::string, Metadata::MetadataValue> metadata_cache_;
+
   /** True if the non_empty_domain has been computed */
   bool non_empty_domain_computed_;
 
@@ -256,6 +404,33 @@ class OpenedArray {
   /** The metadata of the fragments the array was opened with. */
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata_;
 
+  /** The cached outcome of the last relevant fragments computation. */
+  optional<RelevantFragmentsCacheEntry> relevant_fragments_cache_;
+
+  /** Protects `relevant_fragments_cache_`. */
+  mutable std::mutex relevant_fragments_cache_mtx_;
+
+  /** Cached per-tile tombstone masks, shared across queries. */
+  std::map<
+      std::pair<unsigned, uint64_t>,
+      shared_ptr<const std::vector<uint8_t>>>
+      tombstone_mask_cache_;
+
+  /** Protects `tombstone_mask_cache_`. */
+  mutable std::mutex tombstone_mask_cache_mtx_;
+
+  /** Cached per-tile field bloom filters, shared across queries. */
+  std::map<
+      std::tuple<std::string, unsigned, uint64_t>,
+      shared_ptr<const BloomFilter>>
+      bloom_filter_cache_;
+
+  /** Protects `bloom_filter_cache_`. */
+  mutable std::mutex bloom_filter_cache_mtx_;
+
+  /** Serializes lazy loads of opened-array state across queries. */
+  mutable std::mutex lazy_load_mtx_;
+
   /**
    * The private encryption key used to encrypt the array.
    *
@@ -568,6 +743,7 @@ class Array {
   inline void set_fragment_metadata(
       std::vector<shared_ptr<FragmentMetadata>>&& fragment_metadata) {
     opened_array_->fragment_metadata() = fragment_metadata;
+    opened_array_->clear_relevant_fragments_cache();
   }
 
   /**
@@ -671,6 +847,38 @@ class Array {
    */
   Status reopen(uint64_t timestamp_start, uint64_t timestamp_end);
 
+  /**
+   * Incrementally refreshes the view of the array, using a single LIST of
+   * the commits directory to discover fragments written since the array
+   * was last opened and appending their metadata to the opened array
+   * state. This is much cheaper than `reopen` for arrays that receive
+   * frequent small writes, as the directory state and the metadata of
+   * already open fragments are reused.
+   *
+   * Falls back to a full `reopen` when the delta cannot be applied
+   * incrementally: remote arrays, a user-set end timestamp, new
+   * delete/update/vacuum or consolidated commit files, or fragments
+   * written under a schema this array has not loaded.
+   *
+   * @note Applicable only for reads, it errors if the array was opened
+   *     for writes. Like `reopen`, it must not run concurrently with
+   *     query creation on the same array.
+   */
+  Status delta_refresh();
+
+  /**
+   * Runs `delta_refresh` on a background thread. Does nothing if a
+   * refresh is already in flight. The outcome is reported by
+   * `await_delta_refresh`.
+   */
+  void delta_refresh_async();
+
+  /**
+   * Waits for a background `delta_refresh` to complete, if one is in
+   * flight, and returns its status.
+   */
+  Status await_delta_refresh();
+
   /** Returns the start timestamp used to load the array directory. */
   inline uint64_t timestamp_start() const {
     return array_dir_timestamp_start_;
@@ -991,6 +1199,11 @@ class Array {
     return memory_tracker_;
   }
 
+  /** Returns the cache of resolved dimension label ranges. */
+  inline LabelRangeCache& label_range_cache() {
+    return label_range_cache_;
+  }
+
   /**
    * Checks the config to see if non empty domain should be serialized on array
    * open.
@@ -1145,6 +1358,13 @@ class Array {
   /** Memory tracker for the array. */
   shared_ptr<MemoryTracker> memory_tracker_;
 
+  /**
+   * Cache of index ranges resolved from dimension label ranges. Entries are
+   * keyed on the fragment list of the dimension label, so writes to a label
+   * change the key and stale entries simply age out.
+   */
+  LabelRangeCache label_range_cache_;
+
   /** A reference to the object which controls the present Array instance. */
   ConsistencyController& consistency_controller_;
 
@@ -1157,6 +1377,12 @@ class Array {
    */
   std::mutex mtx_;
 
+  /** Background delta refresh task, if one is in flight. */
+  ThreadPool::Task delta_refresh_task_;
+
+  /** Mutex that protects `delta_refresh_task_`. */
+  std::mutex delta_refresh_task_mtx_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -1244,6 +1470,20 @@ class Array {
    */
   void do_load_metadata();
 
+  /**
+   * Loads the raw array metadata tiles of a non-remote array into the
+   * opened array's tile cache, if not cached already, and returns them.
+   */
+  const std::vector<shared_ptr<Tile>>& load_metadata_tiles();
+
+  /**
+   * Looks up a single metadata key in the raw metadata tiles without
+   * deserializing them in full and caches the outcome in the opened
+   * array. A returned value with `del_` set means the key does not
+   * exist. Only valid for non-remote arrays before a full metadata load.
+   */
+  const Metadata::MetadataValue& cached_metadata_value(const char* key);
+
   /**
    * Load array metadata, handles remote arrays vs non-remote arrays
    * @return  Status
@@ -294,6 +294,150 @@ void ArrayDirectory::write_commit_ignore_file(
   throw_if_not_ok(resources_.get().vfs().close_file(ignore_file_uri));
 }
 
+/** Appends a LEB128 varint to a commits manifest buffer. */
+static void manifest_write_varint(std::vector<uint8_t>& data, uint64_t value) {
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    data.emplace_back(byte);
+  } while (value != 0);
+}
+
+/**
+ * Reads a LEB128 varint from a commits manifest buffer, advancing
+ * `offset`. Throws on a truncated or malformed buffer.
+ */
+static uint64_t manifest_read_varint(
+    const std::string& data, uint64_t& offset) {
+  uint64_t value = 0;
+  unsigned shift = 0;
+  while (true) {
+    if (offset >= data.size() || shift >= 64) {
+      throw ArrayDirectoryException(
+          "Invalid consolidated commits manifest; Truncated integer");
+    }
+    uint8_t byte = static_cast<uint8_t>(data[offset++]);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+    shift += 7;
+  }
+}
+
+std::vector<uint8_t> ArrayDirectory::serialize_commits_manifest(
+    const URI& array_uri,
+    const std::vector<URI>& commit_uris,
+    ContextResources& resources) {
+  const auto base_uri_size = array_uri.to_string().size();
+
+  // Parse the timestamps out of every relative commit URI. Records whose
+  // name cannot be reconstructed exactly from the parsed values are kept
+  // as raw strings.
+  struct Record {
+    URI uri;
+    std::string relative_uri;
+    uint64_t t1 = 0;
+    uint64_t t2 = 0;
+    std::string prefix;
+    std::string rest;
+    bool raw = true;
+  };
+  std::vector<Record> records(commit_uris.size());
+  for (uint64_t i = 0; i < commit_uris.size(); i++) {
+    auto& r = records[i];
+    r.uri = commit_uris[i];
+    r.relative_uri = commit_uris[i].to_string().substr(base_uri_size);
+    try {
+      FragmentID fragment_id{commit_uris[i]};
+      auto timestamps{fragment_id.timestamp_range()};
+      r.t1 = timestamps.first;
+      r.t2 = timestamps.second;
+    } catch (...) {
+      continue;
+    }
+    auto slash = r.relative_uri.find_last_of('/');
+    if (slash == std::string::npos) {
+      continue;
+    }
+    r.prefix = r.relative_uri.substr(0, slash + 1);
+    const std::string timestamps_part =
+        "__" + std::to_string(r.t1) + "_" + std::to_string(r.t2) + "_";
+    if (r.relative_uri.compare(
+            slash + 1, timestamps_part.size(), timestamps_part) != 0) {
+      continue;
+    }
+    r.rest = r.relative_uri.substr(slash + 1 + timestamps_part.size());
+    r.raw = false;
+  }
+
+  // Sort the records by first timestamp, then by name.
+  std::stable_sort(records.begin(), records.end(), [](auto& a, auto& b) {
+    if (a.t1 != b.t1) {
+      return a.t1 < b.t1;
+    }
+    return a.relative_uri < b.relative_uri;
+  });
+
+  // The directory prefix is shared by all v12+ commit URIs, so it is
+  // stored once in the header; records under a different prefix fall
+  // back to raw strings.
+  std::string prefix;
+  for (auto& r : records) {
+    if (!r.raw) {
+      prefix = r.prefix;
+      break;
+    }
+  }
+
+  std::vector<uint8_t> data;
+  data.insert(
+      data.end(),
+      constants::con_commits_manifest_magic.begin(),
+      constants::con_commits_manifest_magic.end());
+  manifest_write_varint(data, constants::con_commits_manifest_version);
+  manifest_write_varint(data, prefix.size());
+  data.insert(data.end(), prefix.begin(), prefix.end());
+  manifest_write_varint(data, records.size());
+
+  uint64_t prev_t1 = 0;
+  for (auto& r : records) {
+    const bool payload = stdx::string::ends_with(
+        r.relative_uri, constants::delete_file_suffix);
+    const bool raw = r.raw || r.prefix != prefix || r.t2 < r.t1;
+    uint8_t flags = 0;
+    flags |= payload ? 0x1 : 0;
+    flags |= raw ? 0x2 : 0;
+    data.emplace_back(flags);
+
+    if (raw) {
+      manifest_write_varint(data, r.relative_uri.size());
+      data.insert(data.end(), r.relative_uri.begin(), r.relative_uri.end());
+    } else {
+      manifest_write_varint(data, r.t1 - prev_t1);
+      manifest_write_varint(data, r.t2 - r.t1);
+      manifest_write_varint(data, r.rest.size());
+      data.insert(data.end(), r.rest.begin(), r.rest.end());
+      prev_t1 = r.t1;
+    }
+
+    // Inline the delete condition tile, as the text format does.
+    if (payload) {
+      uint64_t size = 0;
+      throw_if_not_ok(resources.vfs().file_size(r.uri, &size));
+      manifest_write_varint(data, size);
+      const auto pos = data.size();
+      data.resize(pos + size);
+      throw_if_not_ok(resources.vfs().read(r.uri, 0, &data[pos], size));
+    }
+  }
+
+  return data;
+}
+
 void ArrayDirectory::delete_fragments_list(
     const std::vector<URI>& fragment_uris) {
   // Get fragment URIs from the array that match the input fragment_uris
@@ -316,23 +460,36 @@ void ArrayDirectory::delete_fragments_list(
     write_commit_ignore_file(commit_uris_to_ignore);
   }
 
-  // Delete fragments and commits
+  // Delete fragment directories
+  std::vector<uint8_t> commit_is_file(uris.size());
   throw_if_not_ok(parallel_for(
       &resources_.get().compute_tp(), 0, uris.size(), [&](size_t i) {
         auto& vfs = resources_.get().vfs();
         throw_if_not_ok(vfs.remove_dir(uris[i]));
         bool is_file = false;
         throw_if_not_ok(vfs.is_file(commit_uris_to_delete[i], &is_file));
-        if (is_file) {
-          throw_if_not_ok(vfs.remove_file(commit_uris_to_delete[i]));
-        }
+        commit_is_file[i] = is_file;
         return Status::Ok();
       }));
+
+  // Delete the commit files that are present, batching the deletions.
+  std::vector<URI> commit_uris_to_remove;
+  for (uint64_t i = 0; i < uris.size(); i++) {
+    if (commit_is_file[i]) {
+      commit_uris_to_remove.emplace_back(commit_uris_to_delete[i]);
+    }
+  }
+  resources_.get().vfs().remove_files(
+      &resources_.get().compute_tp(), commit_uris_to_remove);
 }
 
 Status ArrayDirectory::load() {
   assert(!loaded_);
 
+  // Array-open listings and metadata loads are latency-critical; keep
+  // them ahead of any bulk query work sharing the thread pool.
+  ThreadPool::PriorityScope priority_scope(ThreadPool::Priority::INTERACTIVE);
+
   std::vector<ThreadPool::Task> tasks;
   std::vector<URI> root_dir_uris;
   std::vector<URI> commits_dir_uris;
@@ -637,7 +794,7 @@ ArrayDirectory::load_root_dir_uris_v1_v11(
   return {Status::Ok(), fragment_uris.value()};
 }
 
-std::vector<URI> ArrayDirectory::list_commits_dir_uris() {
+std::vector<URI> ArrayDirectory::list_commits_dir_uris() const {
   // List the commits folder array directory URIs
   auto timer_se = stats_->start_timer("list_commit_uris");
   return ls(uri_.join_path(constants::array_commits_dir_name));
@@ -739,7 +896,7 @@ ArrayDirectory::load_consolidated_commit_uris(
   // Load all commit URIs. This is done in serial for now as it can be optimized
   // by vacuuming.
   std::unordered_set<std::string> uris_set;
-  std::vector<std::pair<URI, std::string>> meta_files;
+  std::vector<std::pair<URI, std::vector<std::string>>> meta_files;
   for (uint64_t i = 0; i < commits_dir_uris.size(); i++) {
     auto& uri = commits_dir_uris[i];
     if (stdx::string::ends_with(
@@ -747,16 +904,29 @@ ArrayDirectory::load_consolidated_commit_uris(
       uint64_t size = 0;
       RETURN_NOT_OK_TUPLE(
           resources_.get().vfs().file_size(uri, &size), nullopt, nullopt);
-      meta_files.emplace_back(uri, std::string());
+      meta_files.emplace_back(uri, std::vector<std::string>());
+      auto& relative_uris = meta_files.back().second;
 
-      auto& names = meta_files.back().second;
+      std::string names;
       names.resize(size);
       RETURN_NOT_OK_TUPLE(
           resources_.get().vfs().read(uri, 0, &names[0], size),
           nullopt,
           nullopt);
+
+      // Binary manifests carry a magic prefix; anything else is the
+      // text format.
+      const auto& magic = constants::con_commits_manifest_magic;
+      if (names.size() >= magic.size() &&
+          names.compare(0, magic.size(), magic) == 0) {
+        decode_commits_manifest(
+            uri, names, ignore_set, uris_set, relative_uris);
+        continue;
+      }
+
       std::stringstream ss(names);
       for (std::string condition_marker; std::getline(ss, condition_marker);) {
+        relative_uris.emplace_back(condition_marker);
         if (ignore_set.count(condition_marker) == 0) {
           uris_set.emplace(uri_.to_string() + condition_marker);
         }
@@ -798,10 +968,9 @@ ArrayDirectory::load_consolidated_commit_uris(
   // See if we have a file that contains all URIs, which means we can vacuum.
   if (mode_ == ArrayDirectoryMode::COMMITS) {
     for (auto& meta_file : meta_files) {
-      std::stringstream ss(meta_file.second);
       uint64_t count = 0;
       bool all_in_set = true;
-      for (std::string uri_str; std::getline(ss, uri_str);) {
+      for (auto& uri_str : meta_file.second) {
         if (uris_set.count(uri_.to_string() + uri_str) > 0) {
           count++;
         } else {
@@ -832,6 +1001,126 @@ ArrayDirectory::load_consolidated_commit_uris(
   return {Status::Ok(), uris, uris_set};
 }
 
+void ArrayDirectory::decode_commits_manifest(
+    const URI& con_uri,
+    const std::string& data,
+    const std::unordered_set<std::string>& ignore_set,
+    std::unordered_set<std::string>& uris_set,
+    std::vector<std::string>& relative_uris) {
+  uint64_t offset = constants::con_commits_manifest_magic.size();
+  auto version = manifest_read_varint(data, offset);
+  if (version > constants::con_commits_manifest_version) {
+    throw ArrayDirectoryException(
+        "Cannot read consolidated commits manifest of version " +
+        std::to_string(version) + "; a newer library version is required");
+  }
+
+  // Read the shared directory prefix.
+  auto prefix_len = manifest_read_varint(data, offset);
+  if (offset + prefix_len > data.size()) {
+    throw ArrayDirectoryException(
+        "Invalid consolidated commits manifest; Truncated prefix");
+  }
+  const std::string prefix = data.substr(offset, prefix_len);
+  offset += prefix_len;
+
+  // Manifest records are sorted by first timestamp, so read-mode opens at
+  // a timestamp window can skip records that ended before the window and
+  // stop decoding at the first record starting past it, without
+  // reconstructing their URIs. The pruning test is the loosest overlap
+  // test; the exact per-fragment filtering still happens in
+  // `compute_filtered_uris`. Other modes need every record.
+  const bool prune = mode_ == ArrayDirectoryMode::READ;
+
+  auto record_num = manifest_read_varint(data, offset);
+  uint64_t prev_t1 = 0;
+  for (uint64_t r = 0; r < record_num; r++) {
+    if (offset >= data.size()) {
+      throw ArrayDirectoryException(
+          "Invalid consolidated commits manifest; Truncated record");
+    }
+    const uint8_t flags = static_cast<uint8_t>(data[offset++]);
+
+    // Reconstruct the relative commit URI.
+    std::string relative_uri;
+    std::pair<uint64_t, uint64_t> timestamps{0, 0};
+    bool have_timestamps = false;
+    if ((flags & 0x2) != 0) {
+      auto len = manifest_read_varint(data, offset);
+      if (offset + len > data.size()) {
+        throw ArrayDirectoryException(
+            "Invalid consolidated commits manifest; Truncated record");
+      }
+      relative_uri = data.substr(offset, len);
+      offset += len;
+    } else {
+      auto t1 = prev_t1 + manifest_read_varint(data, offset);
+      auto t2 = t1 + manifest_read_varint(data, offset);
+      prev_t1 = t1;
+      auto len = manifest_read_varint(data, offset);
+      if (offset + len > data.size()) {
+        throw ArrayDirectoryException(
+            "Invalid consolidated commits manifest; Truncated record");
+      }
+
+      if (prune) {
+        // No later record can start within the window either.
+        if (t1 > timestamp_end_) {
+          return;
+        }
+
+        if (t2 < timestamp_start_) {
+          offset += len;
+
+          // Skip the inlined condition tile of a pruned delete commit.
+          if ((flags & 0x1) != 0) {
+            auto size = manifest_read_varint(data, offset);
+            if (offset + size > data.size()) {
+              throw ArrayDirectoryException(
+                  "Invalid consolidated commits manifest; Truncated "
+                  "condition tile");
+            }
+            offset += size;
+          }
+          continue;
+        }
+      }
+
+      relative_uri = prefix + "__" + std::to_string(t1) + "_" +
+                     std::to_string(t2) + "_" + data.substr(offset, len);
+      offset += len;
+      timestamps = {t1, t2};
+      have_timestamps = true;
+    }
+
+    relative_uris.emplace_back(relative_uri);
+    if (ignore_set.count(relative_uri) == 0) {
+      uris_set.emplace(uri_.to_string() + relative_uri);
+    }
+
+    // If we have a delete, process the inlined condition tile.
+    if ((flags & 0x1) != 0) {
+      auto size = manifest_read_varint(data, offset);
+      if (offset + size > data.size()) {
+        throw ArrayDirectoryException(
+            "Invalid consolidated commits manifest; Truncated condition tile");
+      }
+      if (!have_timestamps) {
+        FragmentID fragment_id{URI(relative_uri)};
+        timestamps = fragment_id.timestamp_range();
+      }
+
+      // Add the delete tile location if it overlaps the open start/end
+      // times
+      if (timestamps_overlap(timestamps, false)) {
+        delete_and_update_tiles_location_.emplace_back(
+            con_uri, relative_uri, offset);
+      }
+      offset += size;
+    }
+  }
+}
+
 void ArrayDirectory::load_array_meta_uris() {
   // Load the URIs in the array metadata directory
   std::vector<URI> array_meta_dir_uris;
@@ -1325,6 +1614,17 @@ shared_ptr<const Enumeration> ArrayDirectory::load_enumeration(
                       .join_path(constants::array_enumerations_dir_name)
                       .join_path(enumeration_path);
 
+  // Enumeration files are immutable and their names are unique, so a cached
+  // enumeration for this URI can be shared as-is.
+  auto& cache = resources_.get().enumeration_cache();
+  if (cache.enabled()) {
+    auto cached = cache.lookup(enmr_uri.to_string());
+    if (cached != nullptr) {
+      resources_.get().stats().add_counter("enumeration_cache_hit", 1);
+      return cached;
+    }
+  }
+
   auto tile = GenericTileIO::load(
       resources_, enmr_uri, 0, encryption_key, memory_tracker);
   resources_.get().stats().add_counter("read_enumeration_size", tile->size());
@@ -1338,6 +1638,14 @@ shared_ptr<const Enumeration> ArrayDirectory::load_enumeration(
   }
 
   Deserializer deserializer(tile->data(), tile->size());
+  if (cache.enabled()) {
+    // Deserialize through the cache's context-lifetime tracker so that the
+    // shared object can outlive the array open that loaded it.
+    auto enmr = Enumeration::deserialize(deserializer, cache.memory_tracker());
+    cache.insert(enmr_uri.to_string(), enmr);
+    return enmr;
+  }
+
   return Enumeration::deserialize(deserializer, memory_tracker);
 }
 
@@ -473,6 +473,24 @@ class ArrayDirectory {
   /** Writes a commit ignore file. */
   void write_commit_ignore_file(const std::vector<URI>& commit_uris_to_ignore);
 
+  /**
+   * Serializes the input commit URIs into the binary consolidated
+   * commits manifest format. The records are sorted by their first
+   * timestamp and their timestamps are delta-encoded, so manifests stay
+   * compact and cheap to parse at high fragment counts. Delete commit
+   * files have their condition tile inlined, like in the text format.
+   *
+   * @param array_uri The array URI the commit URIs are relative to.
+   * @param commit_uris The commit URIs to serialize, in timestamp order.
+   * @param resources The context resources, used to read delete
+   *     condition tiles.
+   * @return The manifest bytes.
+   */
+  static std::vector<uint8_t> serialize_commits_manifest(
+      const URI& array_uri,
+      const std::vector<URI>& commit_uris,
+      ContextResources& resources);
+
   /** Deletes the array fragments at the given fragment URIs. */
   void delete_fragments_list(const std::vector<URI>& fragment_uris);
 
@@ -559,6 +577,13 @@ class ArrayDirectory {
     return loaded_;
   }
 
+  /**
+   * List the commits directory uris for v12 or higher.
+   *
+   * @return vector of commit URIs.
+   */
+  std::vector<URI> list_commits_dir_uris() const;
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -668,13 +693,6 @@ class ArrayDirectory {
   tuple<Status, optional<std::vector<URI>>> load_root_dir_uris_v1_v11(
       const std::vector<URI>& root_dir_uris);
 
-  /**
-   * List the commits directory uris for v12 or higher.
-   *
-   * @return vector of commit URIs.
-   */
-  std::vector<URI> list_commits_dir_uris();
-
   /**
    * Loads the commit directory uris for v12 or higher.
    *
@@ -712,6 +730,32 @@ class ArrayDirectory {
       optional<std::unordered_set<std::string>>>
   load_consolidated_commit_uris(const std::vector<URI>& commits_dir_uris);
 
+  /**
+   * Decodes a binary consolidated commits manifest, performing the same
+   * work as the text parsing path of `load_consolidated_commit_uris`:
+   * commit URIs that are not ignored are added to `uris_set`, the
+   * locations of inlined delete condition tiles are registered, and the
+   * relative URIs of all records are returned through `relative_uris`
+   * for the vacuum check.
+   *
+   * In read mode, the records are pruned against the open timestamp
+   * window: records sort by first timestamp, so records that ended
+   * before the window are skipped and decoding stops at the first
+   * record starting past it.
+   *
+   * @param con_uri The URI of the consolidated commits file.
+   * @param data The contents of the consolidated commits file.
+   * @param ignore_set The relative commit URIs to ignore.
+   * @param uris_set The set of commit URIs to add to.
+   * @param relative_uris The relative URIs of all manifest records.
+   */
+  void decode_commits_manifest(
+      const URI& con_uri,
+      const std::string& data,
+      const std::unordered_set<std::string>& ignore_set,
+      std::unordered_set<std::string>& uris_set,
+      std::vector<std::string>& relative_uris);
+
   /** Loads the array metadata URIs. */
   void load_array_meta_uris();
 
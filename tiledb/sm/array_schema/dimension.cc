@@ -38,6 +38,7 @@
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/type/apply_with_type.h"
 #include "tiledb/type/range/range.h"
+#include "tiledb/type/range/range_operations.h"
 
 #include <bitset>
 #include <cassert>
@@ -473,12 +474,17 @@ void Dimension::expand_range_var_v(const char* v, uint64_t v_size, Range* r) {
   assert(v != nullptr);
   assert(r != nullptr);
 
-  std::string start(r->start_str());
-  std::string end(r->end_str());
-  auto v_str = std::string(v, v_size);
+  // Compare as string views to avoid copying the bounds before knowing
+  // whether the range expands at all.
+  auto start = r->start_str();
+  auto end = r->end_str();
+  std::string_view v_str(v, v_size);
 
-  r->set_str_range(
-      (v_str < start) ? v_str : start, (v_str > end) ? v_str : end);
+  if (v_str < start || v_str > end) {
+    r->set_str_range(
+        std::string((v_str < start) ? v_str : start),
+        std::string((v_str > end) ? v_str : end));
+  }
 }
 
 template <class T>
@@ -504,10 +510,12 @@ void Dimension::expand_range_var(const Range& r1, Range* r2) const {
   auto r2_start = r2->start_str();
   auto r2_end = r2->end_str();
 
-  std::string min((r1_start < r2_start) ? r1_start : r2_start);
-  std::string max((r1_end < r2_end) ? r2_end : r1_end);
-
-  r2->set_str_range(min, max);
+  // Copy the bounds only if `r1` actually expands `r2`.
+  if (r1_start < r2_start || r1_end > r2_end) {
+    r2->set_str_range(
+        std::string((r1_start < r2_start) ? r1_start : r2_start),
+        std::string((r1_end < r2_end) ? r2_end : r1_end));
+  }
 }
 
 template <class T>
@@ -599,15 +607,7 @@ bool Dimension::covered(const Range& r1, const Range& r2) const {
 
 template <>
 bool Dimension::overlap<char>(const Range& r1, const Range& r2) {
-  auto r1_start = r1.start_str();
-  auto r1_end = r1.end_str();
-  auto r2_start = r2.start_str();
-  auto r2_end = r2.end_str();
-
-  auto r1_after_r2 = r1_start > r2_end;
-  auto r2_after_r1 = r2_start > r1_end;
-
-  return !r1_after_r2 && !r2_after_r1;
+  return tiledb::type::intersects<std::string_view>(r1, r2);
 }
 
 template <class T>
@@ -615,9 +615,7 @@ bool Dimension::overlap(const Range& r1, const Range& r2) {
   assert(!r1.empty());
   assert(!r2.empty());
 
-  auto d1 = (const T*)r1.data();
-  auto d2 = (const T*)r2.data();
-  return !(d1[0] > d2[1] || d1[1] < d2[0]);
+  return tiledb::type::intersects<T>(r1, r2);
 }
 
 bool Dimension::overlap(const Range& r1, const Range& r2) const {
@@ -681,7 +679,7 @@ double Dimension::overlap_ratio(const Range& r1, const Range& r2) {
   assert(r2_low <= r2_high);
 
   // Special case: No overlap, intervals are disjoint
-  if (r1_low > r2_high || r1_high < r2_low)
+  if (!tiledb::type::intersects<T>(r1, r2))
     return 0.0;
   // Special case: All overlap, interval r2 is a subset of interval r1
   if (r1_low <= r2_low && r2_high <= r1_high)
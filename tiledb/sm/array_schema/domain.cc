@@ -46,6 +46,7 @@
 #include "tiledb/type/range/range.h"
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
@@ -193,27 +194,17 @@ uint64_t Domain::cell_num_per_tile() const {
 template <>
 int Domain::cell_order_cmp_impl<char>(
     const Dimension*, const UntypedDatumView a, const UntypedDatumView b) {
-  auto var_a = reinterpret_cast<const char*>(a.content());
-  auto var_b = reinterpret_cast<const char*>(b.content());
   auto size_a{a.size()};
   auto size_b{b.size()};
   auto size = std::min(size_a, size_b);
 
+  // Compare the common prefix with memcmp, which libc vectorizes, instead
+  // of a byte-at-a-time loop. This is the hot path when sorting or merging
+  // cells on string dimensions.
   if (size != 0) {
-    size_t i = 0;
-    while (var_a[i] == var_b[i]) {
-      if (i == size - 1) {
-        break;
-      }
-      ++i;
-    }
-
-    if (var_a[i] < var_b[i]) {
-      return -1;
-    }
-
-    if (var_a[i] > var_b[i]) {
-      return 1;
+    auto res = std::memcmp(a.content(), b.content(), size);
+    if (res != 0) {
+      return (res < 0) ? -1 : 1;
     }
   }
 
@@ -34,6 +34,7 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/sm/buffer/buffer_pool.h"
 
 #include <algorithm>
 #include <iostream>
@@ -161,7 +162,9 @@ Buffer::Buffer(uint64_t size)
     : BufferBase((void*)nullptr, size)
     , owns_data_(true)
     , alloced_size_(0) {
-  throw_if_not_ok(ensure_alloced_size(size_));
+  // Allocate the exact requested capacity; a fixed-size buffer must not be
+  // rounded up to a size class, as callers rely on its precise capacity.
+  throw_if_not_ok(this->realloc(size_));
   preallocated_ = true;
   size_ = 0;
 }
@@ -180,7 +183,7 @@ Buffer::Buffer(const Buffer& buff)
   preallocated_ = buff.preallocated_;
 
   if (buff.owns_data_ && buff.data_ != nullptr) {
-    data_ = tdb_malloc(alloced_size_);
+    data_ = global_buffer_pool.allocate(alloced_size_);
     assert(data_);
     std::memcpy(data_, buff.data_, buff.alloced_size_);
   }
@@ -210,7 +213,7 @@ uint64_t Buffer::alloced_size() const {
 
 void Buffer::clear() {
   if (data_ != nullptr && owns_data_)
-    tdb_free(data_);
+    global_buffer_pool.release(data_, alloced_size_);
 
   data_ = nullptr;
   offset_ = 0;
@@ -239,6 +242,14 @@ bool Buffer::owns_data() const {
   return owns_data_;
 }
 
+Status Buffer::reserve(const uint64_t nbytes) {
+  if (!owns_data_) {
+    return LOG_STATUS(Status_BufferError(
+        "Cannot reserve buffer capacity; Buffer does not own data"));
+  }
+  return ensure_alloced_size(nbytes);
+}
+
 Status Buffer::realloc(const uint64_t nbytes) {
   if (!owns_data_) {
     return LOG_STATUS(Status_BufferError(
@@ -246,7 +257,7 @@ Status Buffer::realloc(const uint64_t nbytes) {
   }
 
   if (data_ == nullptr) {
-    data_ = tdb_malloc(nbytes);
+    data_ = global_buffer_pool.allocate(nbytes);
     if (data_ == nullptr) {
       return LOG_STATUS(Status_BufferError(
           "Cannot allocate buffer; Memory allocation failed"));
@@ -370,9 +381,11 @@ Status Buffer::ensure_alloced_size(const uint64_t nbytes) {
     return Status::Ok();
   }
 
-  auto new_alloc_size = alloced_size_ == 0 ? nbytes : alloced_size_;
-  while (new_alloc_size < nbytes)
-    new_alloc_size *= 2;
+  // Grow by at least a factor of two, rounded up to a size class so that
+  // small buffers do not crawl up from tiny exact-need allocations and so
+  // that released blocks are recyclable through the buffer pool.
+  auto new_alloc_size =
+      BufferPool::size_class(std::max(nbytes, 2 * alloced_size_));
 
   return this->realloc(new_alloc_size);
 }
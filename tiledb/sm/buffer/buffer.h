@@ -247,6 +247,18 @@ class Buffer : public BufferBase {
    */
   Status realloc(uint64_t nbytes);
 
+  /**
+   * Ensures the buffer capacity is at least the input size, without changing
+   * the buffer size. Callers that know the final size of the data they will
+   * write should call this first so the buffer reaches its capacity in a
+   * single allocation instead of a chain of realloc copies. The requested
+   * capacity is rounded up to a buffer pool size class.
+   *
+   * @param nbytes Minimum capacity, in bytes.
+   * @return Status.
+   */
+  Status reserve(uint64_t nbytes);
+
   /** Resets the buffer size. */
   void reset_size();
 
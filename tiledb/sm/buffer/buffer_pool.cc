@@ -0,0 +1,124 @@
+/**
+ * @file   buffer_pool.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class BufferPool.
+ */
+
+#include "tiledb/sm/buffer/buffer_pool.h"
+#include "tiledb/common/heap_memory.h"
+
+namespace tiledb {
+namespace sm {
+
+/** The smallest size class, in bytes. */
+static constexpr uint64_t min_class = 512;
+
+/**
+ * Above this size, classes are multiples of it rather than powers of two, so
+ * that rounding never over-allocates a large buffer by more than 4MB.
+ */
+static constexpr uint64_t large_class_granularity = 4 * 1024 * 1024;
+
+/** Blocks larger than this are never retained in the free lists. */
+static constexpr uint64_t max_pooled_block = 64 * 1024 * 1024;
+
+BufferPool::BufferPool(uint64_t max_bytes)
+    : max_bytes_(max_bytes) {
+}
+
+BufferPool::~BufferPool() {
+  clear();
+}
+
+uint64_t BufferPool::size_class(uint64_t nbytes) {
+  if (nbytes == 0) {
+    return 0;
+  }
+  if (nbytes > large_class_granularity) {
+    // Round up to the next multiple of the large class granularity.
+    return ((nbytes + large_class_granularity - 1) / large_class_granularity) *
+           large_class_granularity;
+  }
+  auto sc = min_class;
+  while (sc < nbytes) {
+    sc *= 2;
+  }
+  return sc;
+}
+
+void* BufferPool::allocate(uint64_t nbytes) {
+  {
+    std::lock_guard<std::mutex> lg(mtx_);
+    auto it = free_lists_.find(nbytes);
+    if (it != free_lists_.end() && !it->second.empty()) {
+      auto* data = it->second.back();
+      it->second.pop_back();
+      pooled_bytes_ -= nbytes;
+      return data;
+    }
+  }
+  return tdb_malloc(nbytes);
+}
+
+void BufferPool::release(void* data, uint64_t alloced_size) {
+  if (data == nullptr) {
+    return;
+  }
+  if (size_class(alloced_size) == alloced_size &&
+      alloced_size <= max_pooled_block) {
+    std::lock_guard<std::mutex> lg(mtx_);
+    if (pooled_bytes_ + alloced_size <= max_bytes_) {
+      free_lists_[alloced_size].push_back(data);
+      pooled_bytes_ += alloced_size;
+      return;
+    }
+  }
+  tdb_free(data);
+}
+
+uint64_t BufferPool::pooled_bytes() const {
+  std::lock_guard<std::mutex> lg(mtx_);
+  return pooled_bytes_;
+}
+
+void BufferPool::clear() {
+  std::lock_guard<std::mutex> lg(mtx_);
+  for (auto& fl : free_lists_) {
+    for (auto* data : fl.second) {
+      tdb_free(data);
+    }
+  }
+  free_lists_.clear();
+  pooled_bytes_ = 0;
+}
+
+BufferPool global_buffer_pool(64 * 1024 * 1024);
+
+}  // namespace sm
+}  // namespace tiledb
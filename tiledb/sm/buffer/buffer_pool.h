@@ -0,0 +1,145 @@
+/**
+ * @file   buffer_pool.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class BufferPool.
+ */
+
+#ifndef TILEDB_BUFFER_POOL_H
+#define TILEDB_BUFFER_POOL_H
+
+#include <cinttypes>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A process-wide pool of size-classed allocations backing `Buffer`.
+ *
+ * `Buffer` instances on the write path (metadata serialization, generic tile
+ * assembly) are created and destroyed at a high rate, and each one used to
+ * start from an exact-need allocation and grow by doubling, producing long
+ * chains of realloc copies. The pool addresses both halves of that cost:
+ *
+ * - Allocation sizes are rounded up to size classes (powers of two with a
+ *   512-byte floor, then 4MB-granular above 4MB), so a buffer reaches its
+ *   final capacity in far fewer reallocations.
+ * - Blocks whose capacity is an exact size class are recycled through
+ *   per-class free lists instead of being returned to the heap, so repeated
+ *   serialization cycles reuse warm blocks rather than hitting the allocator.
+ *
+ * The pool caps the bytes it retains; releases beyond the cap, and releases
+ * of blocks that are not an exact size class, fall through to the heap.
+ */
+class BufferPool {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_bytes Maximum number of bytes retained in the free lists.
+   */
+  explicit BufferPool(uint64_t max_bytes);
+
+  /** Destructor. Returns all retained blocks to the heap. */
+  ~BufferPool();
+
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Returns the size class for the given number of bytes: the next power of
+   * two with a 512-byte floor, or the next multiple of 4MB above 4MB. Zero
+   * maps to zero.
+   */
+  static uint64_t size_class(uint64_t nbytes);
+
+  /**
+   * Allocates a block of exactly `nbytes` bytes, reusing a pooled block when
+   * `nbytes` is a size class with a non-empty free list.
+   *
+   * @param nbytes Number of bytes to allocate.
+   * @return The allocated block, or `nullptr` on allocation failure.
+   */
+  void* allocate(uint64_t nbytes);
+
+  /**
+   * Releases a block previously sized to `alloced_size` bytes. The block is
+   * retained in the free lists if `alloced_size` is an exact size class no
+   * larger than the maximum pooled block and the byte cap permits; otherwise
+   * it is freed.
+   *
+   * @param data The block to release. May be `nullptr`, in which case this
+   *    is a no-op.
+   * @param alloced_size The allocated size of the block, in bytes.
+   */
+  void release(void* data, uint64_t alloced_size);
+
+  /** Returns the number of bytes currently retained in the free lists. */
+  uint64_t pooled_bytes() const;
+
+  /** Returns all retained blocks to the heap. */
+  void clear();
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum number of bytes retained in the free lists. */
+  uint64_t max_bytes_;
+
+  /** Protects the free lists and the retained byte count. */
+  mutable std::mutex mtx_;
+
+  /** Free lists of recycled blocks, keyed by size class. */
+  std::map<uint64_t, std::vector<void*>> free_lists_;
+
+  /** Number of bytes currently retained in the free lists. */
+  uint64_t pooled_bytes_ = 0;
+};
+
+/**
+ * The pool backing `Buffer` allocations in this process.
+ */
+extern BufferPool global_buffer_pool;
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_BUFFER_POOL_H
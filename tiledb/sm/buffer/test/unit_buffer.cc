@@ -50,7 +50,8 @@ TEST_CASE("Buffer: Test default constructor with write void*", "[buffer]") {
   REQUIRE(st.ok());
   CHECK(buff->offset() == 3);
   CHECK(buff->size() == sizeof(data));
-  CHECK(buff->alloced_size() == 3);
+  // Growth allocations are rounded up to the minimum buffer pool size class.
+  CHECK(buff->alloced_size() == 512);
   buff->reset_offset();
   CHECK(buff->offset() == 0);
 
@@ -69,11 +70,18 @@ TEST_CASE("Buffer: Test default constructor with write void*", "[buffer]") {
   CHECK(readtwo[1] == 3);
   CHECK(buff->offset() == 3);
 
-  // Reallocate
+  // Reallocation below the current capacity is a no-op.
   st = buff->realloc(10);
   REQUIRE(st.ok());
   CHECK(buff->size() == 3);
-  CHECK(buff->alloced_size() == 10);
+  CHECK(buff->alloced_size() == 512);
+  CHECK(buff->offset() == 3);
+
+  // Reallocation beyond the current capacity is exact.
+  st = buff->realloc(600);
+  REQUIRE(st.ok());
+  CHECK(buff->size() == 3);
+  CHECK(buff->alloced_size() == 600);
   CHECK(buff->offset() == 3);
 
   // Test copy constructor
@@ -106,7 +114,7 @@ TEST_CASE("Buffer: Test swap", "[buffer]") {
   CHECK(buff1.owns_data());
   CHECK(buff1.offset() == 3);
   CHECK(buff1.size() == sizeof(data1));
-  CHECK(buff1.alloced_size() == 3);
+  CHECK(buff1.alloced_size() == 512);
   CHECK(std::memcmp(buff1.data(), &data1, sizeof(data1)) == 0);
 
   char data2[5] = {4, 5, 6, 7, 8};
@@ -119,12 +127,12 @@ TEST_CASE("Buffer: Test swap", "[buffer]") {
   CHECK(buff1.owns_data());
   CHECK(buff1.offset() == 5);
   CHECK(buff1.size() == sizeof(data2));
-  CHECK(buff1.alloced_size() == 5);
+  CHECK(buff1.alloced_size() == 512);
   CHECK(std::memcmp(buff1.data(), &data2, sizeof(data2)) == 0);
   CHECK(buff2.owns_data());
   CHECK(buff2.offset() == 3);
   CHECK(buff2.size() == sizeof(data1));
-  CHECK(buff2.alloced_size() == 3);
+  CHECK(buff2.alloced_size() == 512);
   CHECK(std::memcmp(buff2.data(), &data1, sizeof(data1)) == 0);
 
   char data3[] = {9};
@@ -139,7 +147,7 @@ TEST_CASE("Buffer: Test swap", "[buffer]") {
   CHECK(buff3.owns_data());
   CHECK(buff3.offset() == 5);
   CHECK(buff3.size() == sizeof(data2));
-  CHECK(buff3.alloced_size() == 5);
+  CHECK(buff3.alloced_size() == 512);
   CHECK(std::memcmp(buff3.data(), &data2, sizeof(data2)) == 0);
 }
 
@@ -153,7 +161,7 @@ TEST_CASE("Buffer: Test move", "[buffer]") {
   CHECK(buff1.owns_data());
   CHECK(buff1.offset() == 3);
   CHECK(buff1.size() == sizeof(data1));
-  CHECK(buff1.alloced_size() == 3);
+  CHECK(buff1.alloced_size() == 512);
   CHECK(std::memcmp(buff1.data(), &data1, sizeof(data1)) == 0);
 
   // Move constructor
@@ -161,7 +169,7 @@ TEST_CASE("Buffer: Test move", "[buffer]") {
   CHECK(b.owns_data());
   CHECK(b.offset() == 3);
   CHECK(b.size() == 3);
-  CHECK(b.alloced_size() == 3);
+  CHECK(b.alloced_size() == 512);
   CHECK(std::memcmp(b.data(), &data1, sizeof(data1)) == 0);
   CHECK(buff1.owns_data());
   CHECK(buff1.offset() == 0);
@@ -175,7 +183,7 @@ TEST_CASE("Buffer: Test move", "[buffer]") {
   CHECK(b2.owns_data());
   CHECK(b2.offset() == 3);
   CHECK(b2.size() == 3);
-  CHECK(b2.alloced_size() == 3);
+  CHECK(b2.alloced_size() == 512);
   CHECK(std::memcmp(b2.data(), &data1, sizeof(data1)) == 0);
   CHECK(b.owns_data());
   CHECK(b.offset() == 0);
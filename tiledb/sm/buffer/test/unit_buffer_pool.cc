@@ -0,0 +1,107 @@
+/**
+ * @file unit_buffer_pool.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `BufferPool` class.
+ */
+
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/buffer/buffer_pool.h"
+
+#include <test/support/tdb_catch.h>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+TEST_CASE("BufferPool: Size classes", "[buffer-pool]") {
+  constexpr uint64_t mb = 1024 * 1024;
+
+  CHECK(BufferPool::size_class(0) == 0);
+  CHECK(BufferPool::size_class(1) == 512);
+  CHECK(BufferPool::size_class(512) == 512);
+  CHECK(BufferPool::size_class(513) == 1024);
+  CHECK(BufferPool::size_class(100000) == 131072);
+  CHECK(BufferPool::size_class(4 * mb) == 4 * mb);
+
+  // Above 4MB, classes are 4MB-granular rather than powers of two, so large
+  // buffers are never over-allocated by more than 4MB.
+  CHECK(BufferPool::size_class(4 * mb + 1) == 8 * mb);
+  CHECK(BufferPool::size_class(99 * mb) == 100 * mb);
+  CHECK(BufferPool::size_class(100 * mb) == 100 * mb);
+}
+
+TEST_CASE("BufferPool: Recycling", "[buffer-pool]") {
+  BufferPool pool(1024 * 1024);
+  CHECK(pool.pooled_bytes() == 0);
+
+  // A released block of an exact size class is retained and handed back to
+  // the next allocation of that class.
+  auto* data = pool.allocate(1024);
+  REQUIRE(data != nullptr);
+  pool.release(data, 1024);
+  CHECK(pool.pooled_bytes() == 1024);
+  CHECK(pool.allocate(1024) == data);
+  CHECK(pool.pooled_bytes() == 0);
+
+  // Blocks that are not an exact size class are freed, not retained.
+  auto* odd = pool.allocate(1000);
+  REQUIRE(odd != nullptr);
+  pool.release(odd, 1000);
+  CHECK(pool.pooled_bytes() == 0);
+
+  // Releases beyond the byte cap are freed, not retained.
+  BufferPool small_pool(512);
+  auto* a = small_pool.allocate(512);
+  auto* b = small_pool.allocate(512);
+  small_pool.release(a, 512);
+  small_pool.release(b, 512);
+  CHECK(small_pool.pooled_bytes() == 512);
+
+  small_pool.clear();
+  CHECK(small_pool.pooled_bytes() == 0);
+}
+
+TEST_CASE("BufferPool: Buffer growth policy", "[buffer-pool]") {
+  // A buffer grows along size classes instead of exact-need allocations.
+  Buffer buff;
+  std::vector<char> data(600);
+  throw_if_not_ok(buff.write(data.data(), 1));
+  CHECK(buff.alloced_size() == 512);
+  throw_if_not_ok(buff.write(data.data(), data.size()));
+  CHECK(buff.alloced_size() == 1024);
+
+  // A reserve hint reaches the final capacity in a single allocation.
+  Buffer hinted;
+  throw_if_not_ok(hinted.reserve(1000));
+  CHECK(hinted.size() == 0);
+  CHECK(hinted.alloced_size() == 1024);
+  auto* alloced_data = hinted.data();
+  throw_if_not_ok(hinted.write(data.data(), data.size()));
+  CHECK(hinted.data() == alloced_data);
+}
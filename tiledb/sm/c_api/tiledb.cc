@@ -1089,6 +1089,26 @@ int32_t tiledb_query_get_stats(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_get_resource_report(
+    tiledb_ctx_t* ctx, tiledb_query_t* query, char** report_json) {
+  if (sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (report_json == nullptr)
+    return TILEDB_ERR;
+
+  const std::string str = query->query_->resource_report();
+
+  *report_json = static_cast<char*>(std::malloc(str.size() + 1));
+  if (*report_json == nullptr)
+    return TILEDB_ERR;
+
+  std::memcpy(*report_json, str.data(), str.size());
+  (*report_json)[str.size()] = '\0';
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_set_config(
     tiledb_ctx_t* ctx, tiledb_query_t* query, tiledb_config_t* config) {
   // Sanity check
@@ -1180,6 +1200,62 @@ int32_t tiledb_query_set_validity_buffer(
   return TILEDB_OK;
 }
 
+capi_return_t tiledb_query_set_buffers(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    uint64_t desc_num,
+    const tiledb_query_buffer_desc_t* descs) {
+  // Sanity check
+  if (sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+  if (desc_num != 0 && descs == nullptr) {
+    throw CAPIStatusException("Pointer to buffer descriptors may not be NULL");
+  }
+
+  // Validate the whole table before registering anything so that an invalid
+  // entry does not leave a partial registration behind.
+  for (uint64_t i = 0; i < desc_num; i++) {
+    const auto& desc = descs[i];
+    if (desc.name == nullptr) {
+      throw CAPIStatusException(
+          "Buffer descriptor " + std::to_string(i) +
+          ": field name may not be NULL");
+    }
+    if (desc.data_size == nullptr) {
+      throw CAPIStatusException(
+          "Buffer descriptor " + std::to_string(i) +
+          ": pointer to data size may not be NULL");
+    }
+    if ((desc.offsets == nullptr) != (desc.offsets_size == nullptr)) {
+      throw CAPIStatusException(
+          "Buffer descriptor " + std::to_string(i) +
+          ": offsets buffer and size must both be set or both be NULL");
+    }
+    if ((desc.validity == nullptr) != (desc.validity_size == nullptr)) {
+      throw CAPIStatusException(
+          "Buffer descriptor " + std::to_string(i) +
+          ": validity buffer and size must both be set or both be NULL");
+    }
+  }
+
+  // Register the buffers
+  for (uint64_t i = 0; i < desc_num; i++) {
+    const auto& desc = descs[i];
+    throw_if_not_ok(query->query_->set_data_buffer(
+        desc.name, desc.data, desc.data_size));
+    if (desc.offsets != nullptr) {
+      throw_if_not_ok(query->query_->set_offsets_buffer(
+          desc.name, desc.offsets, desc.offsets_size));
+    }
+    if (desc.validity != nullptr) {
+      throw_if_not_ok(query->query_->set_validity_buffer(
+          desc.name, desc.validity, desc.validity_size));
+    }
+  }
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_get_data_buffer(
     tiledb_ctx_t* ctx,
     tiledb_query_t* query,
@@ -5754,6 +5830,15 @@ CAPI_INTERFACE(
   return api_entry<tiledb::api::tiledb_query_get_stats>(ctx, query, stats_json);
 }
 
+CAPI_INTERFACE(
+    query_get_resource_report,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    char** report_json) {
+  return api_entry<tiledb::api::tiledb_query_get_resource_report>(
+      ctx, query, report_json);
+}
+
 CAPI_INTERFACE(
     query_set_config,
     tiledb_ctx_t* ctx,
@@ -5821,6 +5906,16 @@ CAPI_INTERFACE(
       ctx, query, name, buffer_validity, buffer_validity_size);
 }
 
+CAPI_INTERFACE(
+    query_set_buffers,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    uint64_t desc_num,
+    const tiledb_query_buffer_desc_t* descs) {
+  return api_entry<tiledb::api::tiledb_query_set_buffers>(
+      ctx, query, desc_num, descs);
+}
+
 CAPI_INTERFACE(
     query_get_data_buffer,
     tiledb_ctx_t* ctx,
@@ -988,6 +988,35 @@ TILEDB_EXPORT int32_t tiledb_query_get_stats(
     tiledb_query_t* query,
     char** stats_json) TILEDB_NOEXCEPT;
 
+/**
+ * Retrieves a structured resource accounting report from a Query: the
+ * counters and timers collected on the query's own stats subtree (IO
+ * bytes and requests, unfilter and copy CPU, etc.) and the memory
+ * high-water mark and budget of the query's memory tracker. Unlike the
+ * context-level stats, the report only covers this query, so the cost of
+ * a query can be attributed exactly even with concurrent queries on the
+ * same context.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * char* report_json;
+ * tiledb_query_get_resource_report(ctx, query, &report_json);
+ * // Use the string
+ * tiledb_stats_free_str(&report_json);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query object.
+ * @param report_json The output json. The caller takes ownership
+ *   of the c-string and must free it using tiledb_stats_free_str().
+ * @return `TILEDB_OK` for success and `TILEDB_OOM` or `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_resource_report(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    char** report_json) TILEDB_NOEXCEPT;
+
 /**
  * Set the query config
  *
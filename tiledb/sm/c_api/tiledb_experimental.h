@@ -715,6 +715,52 @@ TILEDB_EXPORT int32_t tiledb_query_get_status_details(
     tiledb_query_t* query,
     tiledb_query_status_details_t* status_details) TILEDB_NOEXCEPT;
 
+/** This should move to c_api/tiledb_struct_defs.h when stabilized */
+typedef struct tiledb_experimental_query_buffer_desc_t {
+  const char* name;        ///< The field (attribute/dimension) name.
+  void* data;              ///< The data buffer.
+  uint64_t* data_size;     ///< In/out size of `data`, in bytes.
+  uint64_t* offsets;       ///< Offsets buffer for var-sized fields, or NULL.
+  uint64_t* offsets_size;  ///< In/out size of `offsets`, in bytes.
+  uint8_t* validity;       ///< Validity buffer for nullable fields, or NULL.
+  uint64_t* validity_size;  ///< In/out size of `validity`, in bytes.
+} tiledb_query_buffer_desc_t;
+
+/**
+ * Sets the buffers for multiple fields of a query in a single call.
+ *
+ * This is equivalent to calling `tiledb_query_set_data_buffer` and, where
+ * the respective descriptor members are not NULL,
+ * `tiledb_query_set_offsets_buffer` and `tiledb_query_set_validity_buffer`
+ * for every entry of the descriptor table, but crosses the FFI boundary
+ * once and validates the arguments in one pass. The whole table is checked
+ * before any buffer is registered, so an invalid entry leaves the query
+ * unchanged. Buffers remain registered across resubmits of an incomplete
+ * query; there is no need to set them again between submits.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_buffer_desc_t descs[2];
+ * descs[0] = (tiledb_query_buffer_desc_t){
+ *     "a1", a1, &a1_size, NULL, NULL, NULL, NULL};
+ * descs[1] = (tiledb_query_buffer_desc_t){
+ *     "a2", a2, &a2_size, a2_offsets, &a2_offsets_size, NULL, NULL};
+ * tiledb_query_set_buffers(ctx, query, 2, descs);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param desc_num The number of entries in `descs`.
+ * @param descs The buffer descriptor table.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_query_set_buffers(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    uint64_t desc_num,
+    const tiledb_query_buffer_desc_t* descs) TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*              CONTEXT              */
 /* ********************************* */
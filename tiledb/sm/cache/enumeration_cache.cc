@@ -0,0 +1,86 @@
+/**
+ * @file   enumeration_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class EnumerationCache.
+ */
+
+#include "tiledb/sm/cache/enumeration_cache.h"
+
+#include "tiledb/common/memory_tracker.h"
+#include "tiledb/sm/array_schema/enumeration.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+EnumerationCache::EnumerationCache(
+    uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker)
+    : LRUCache<std::string, shared_ptr<const Enumeration>>(max_size)
+    , max_size_(max_size)
+    , memory_tracker_(memory_tracker) {
+  memory_tracker_->set_type(MemoryTrackerType::ENUMERATION_CACHE);
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+shared_ptr<const Enumeration> EnumerationCache::lookup(const std::string& uri) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!has_item(uri)) {
+    return nullptr;
+  }
+
+  touch_item(uri);
+  return *get_item(uri);
+}
+
+void EnumerationCache::insert(
+    const std::string& uri, shared_ptr<const Enumeration> enumeration) {
+  if (!enabled()) {
+    return;
+  }
+
+  // Account for the value data, the offsets and the name to index map.
+  uint64_t entry_size = enumeration->data().size() +
+                        enumeration->offsets().size() +
+                        enumeration->elem_count() * sizeof(uint64_t);
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  LRUCache<std::string, shared_ptr<const Enumeration>>::insert(
+      uri, std::move(enumeration), entry_size, false);
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,135 @@
+/**
+ * @file   enumeration_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class EnumerationCache.
+ */
+
+#ifndef TILEDB_ENUMERATION_CACHE_H
+#define TILEDB_ENUMERATION_CACHE_H
+
+#include <mutex>
+#include <string>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class Enumeration;
+class MemoryTracker;
+
+/**
+ * A thread-safe, context-level LRU cache of loaded enumerations.
+ *
+ * Enumeration files are immutable and their path names are unique, so a
+ * hit for a URI is always valid and all opens of an array on the same
+ * context can share one immutable `Enumeration` object instead of
+ * re-reading and re-deserializing it on every open. Dropped enumerations
+ * simply stop being requested and age out of the cache.
+ *
+ * Cached enumerations must be deserialized through the memory tracker
+ * returned by `memory_tracker()`, which lives as long as the context, so
+ * that entries can safely outlive the array open that inserted them.
+ */
+class EnumerationCache
+    : private LRUCache<std::string, shared_ptr<const Enumeration>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of 0 disables the
+   *     cache.
+   * @param memory_tracker The memory tracker to charge cached enumerations
+   *     to.
+   */
+  EnumerationCache(uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(EnumerationCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(EnumerationCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache is enabled. */
+  inline bool enabled() const {
+    return max_size_ > 0;
+  }
+
+  /** Returns the memory tracker to deserialize cached enumerations through. */
+  inline shared_ptr<MemoryTracker> memory_tracker() const {
+    return memory_tracker_;
+  }
+
+  /**
+   * Returns the cached enumeration for the input URI, or `nullptr` on a
+   * miss. A hit makes the entry the most recently used one.
+   *
+   * @param uri The URI of the enumeration file.
+   * @return The cached enumeration, if any.
+   */
+  shared_ptr<const Enumeration> lookup(const std::string& uri);
+
+  /**
+   * Inserts an enumeration into the cache. Does nothing if an entry
+   * already exists for the URI or the cache is disabled.
+   *
+   * @param uri The URI of the enumeration file.
+   * @param enumeration The enumeration, deserialized through
+   *     `memory_tracker()`.
+   */
+  void insert(
+      const std::string& uri, shared_ptr<const Enumeration> enumeration);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum cache size, in bytes. */
+  const uint64_t max_size_;
+
+  /** The memory tracker cached enumerations are charged to. */
+  shared_ptr<MemoryTracker> memory_tracker_;
+
+  /** Protects the underlying LRU cache. */
+  std::mutex mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ENUMERATION_CACHE_H
@@ -0,0 +1,151 @@
+/**
+ * @file   fragment_meta_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FragmentMetaCache.
+ */
+
+#ifndef TILEDB_FRAGMENT_META_CACHE_H
+#define TILEDB_FRAGMENT_META_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class MemoryTracker;
+class Tile;
+
+/**
+ * A cached consolidated fragment metadata file, or `nullptr` components
+ * on a miss.
+ */
+struct CachedFragmentMeta {
+  /** The generic tile holding the file contents. */
+  shared_ptr<Tile> tile_;
+
+  /** The parsed fragment name to footer offset table. */
+  shared_ptr<const std::vector<std::pair<std::string, uint64_t>>> offsets_;
+};
+
+/**
+ * A thread-safe, context-level LRU cache of consolidated fragment metadata
+ * files and their parsed footer offset tables.
+ *
+ * Array opens read the same consolidated fragment metadata over and over;
+ * caching the loaded tiles lets repeated opens of an array on the same
+ * context skip both the I/O and the table parse. The files are immutable
+ * and their names are unique, so a hit for a URI is always valid; vacuumed
+ * files simply stop being requested and age out of the cache.
+ *
+ * The cached tiles must be allocated through the memory tracker returned
+ * by `memory_tracker()`, which lives as long as the context, so that
+ * entries can safely outlive the array open that inserted them.
+ */
+class FragmentMetaCache : private LRUCache<std::string, CachedFragmentMeta> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of 0 disables the
+   *     cache.
+   * @param memory_tracker The memory tracker to charge cached tiles to.
+   */
+  FragmentMetaCache(
+      uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FragmentMetaCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FragmentMetaCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache is enabled. */
+  inline bool enabled() const {
+    return max_size_ > 0;
+  }
+
+  /** Returns the memory tracker to allocate cached tiles through. */
+  inline shared_ptr<MemoryTracker> memory_tracker() const {
+    return memory_tracker_;
+  }
+
+  /**
+   * Returns the cached entry for the input URI, or an entry with `nullptr`
+   * components on a miss. A hit makes the entry the most recently used one.
+   *
+   * @param uri The URI of the consolidated fragment metadata file.
+   * @return The cached entry, if any.
+   */
+  CachedFragmentMeta lookup(const std::string& uri);
+
+  /**
+   * Inserts an entry into the cache. Does nothing if an entry already
+   * exists for the URI or the cache is disabled.
+   *
+   * @param uri The URI of the consolidated fragment metadata file.
+   * @param tile The generic tile holding the file contents, allocated
+   *     through `memory_tracker()`.
+   * @param offsets The parsed fragment name to footer offset table.
+   */
+  void insert(
+      const std::string& uri,
+      shared_ptr<Tile> tile,
+      const std::vector<std::pair<std::string, uint64_t>>& offsets);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum cache size, in bytes. */
+  const uint64_t max_size_;
+
+  /** The memory tracker cached tiles are charged to. */
+  shared_ptr<MemoryTracker> memory_tracker_;
+
+  /** Protects the underlying LRU cache. */
+  std::mutex mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FRAGMENT_META_CACHE_H
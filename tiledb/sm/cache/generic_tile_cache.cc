@@ -0,0 +1,124 @@
+/**
+ * @file   generic_tile_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class GenericTileCache.
+ */
+
+#include <cstring>
+
+#include "tiledb/sm/cache/generic_tile_cache.h"
+
+#include "tiledb/common/memory_tracker.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+GenericTileCache::GenericTileCache(
+    uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker)
+    : LRUCache<std::string, CachedGenericTile>(max_size)
+    , max_size_(max_size)
+    , memory_tracker_(memory_tracker) {
+  memory_tracker_->set_type(MemoryTrackerType::GENERIC_TILE_CACHE);
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+CachedGenericTile GenericTileCache::lookup(
+    const URI& uri, uint64_t offset, const std::string& key_digest) {
+  auto key = make_key(uri, offset, key_digest);
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!has_item(key)) {
+    return CachedGenericTile();
+  }
+
+  touch_item(key);
+  return *get_item(key);
+}
+
+void GenericTileCache::insert(
+    const URI& uri,
+    uint64_t offset,
+    const std::string& key_digest,
+    const void* data,
+    uint64_t size,
+    uint32_t version,
+    uint8_t datatype,
+    uint64_t cell_size,
+    uint8_t encryption_type) {
+  if (!enabled() || size == 0) {
+    return;
+  }
+
+  // Copy the tile data outside of the lock, the copy is simply dropped if a
+  // concurrent reader cached the same entry in the meantime.
+  auto resource = memory_tracker_->get_resource(MemoryType::GENERIC_TILE_CACHE);
+  auto copy = static_cast<std::byte*>(resource->allocate(size));
+  memcpy(copy, data, size);
+
+  CachedGenericTile entry;
+  entry.size_ = size;
+  entry.version_ = version;
+  entry.datatype_ = datatype;
+  entry.cell_size_ = cell_size;
+  entry.encryption_type_ = encryption_type;
+
+  // The deleter keeps the memory tracker alive so that evicted entries can
+  // outlive the cache while a reader still references them.
+  auto memory_tracker = memory_tracker_;
+  entry.data_ =
+      std::shared_ptr<std::byte>(copy, [memory_tracker, size](std::byte* p) {
+        memory_tracker->get_resource(MemoryType::GENERIC_TILE_CACHE)
+            ->deallocate(p, size);
+      });
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  LRUCache<std::string, CachedGenericTile>::insert(
+      make_key(uri, offset, key_digest), std::move(entry), size, false);
+}
+
+/* ********************************* */
+/*          PRIVATE METHODS          */
+/* ********************************* */
+
+std::string GenericTileCache::make_key(
+    const URI& uri, uint64_t offset, const std::string& key_digest) {
+  return uri.to_string() + "#" + std::to_string(offset) + "#" + key_digest;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,187 @@
+/**
+ * @file   generic_tile_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class GenericTileCache.
+ */
+
+#ifndef TILEDB_GENERIC_TILE_CACHE_H
+#define TILEDB_GENERIC_TILE_CACHE_H
+
+#include <mutex>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class MemoryTracker;
+
+/**
+ * The unfiltered payload of one generic tile, along with the header fields
+ * needed to reconstruct a tile object on a hit. The data pointer is
+ * `nullptr` on a cache miss.
+ */
+struct CachedGenericTile {
+  /** Unfiltered tile data. */
+  std::shared_ptr<std::byte> data_;
+
+  /** Size of the unfiltered tile data. */
+  uint64_t size_ = 0;
+
+  /** Format version from the generic tile header. */
+  uint32_t version_ = 0;
+
+  /** Datatype from the generic tile header. */
+  uint8_t datatype_ = 0;
+
+  /** Cell size from the generic tile header. */
+  uint64_t cell_size_ = 0;
+
+  /** Encryption type from the generic tile header. */
+  uint8_t encryption_type_ = 0;
+};
+
+/**
+ * A thread-safe, context-level LRU cache of unfiltered generic tiles.
+ *
+ * Generic tiles hold schema, enumeration and metadata objects that are
+ * re-read, decrypted and decompressed identically on every array open.
+ * `GenericTileIO` probes the cache before reading and inserts the
+ * unfiltered payload afterwards, so that repeated opens skip the I/O and
+ * the filter pipeline. Entries are keyed by URI and file offset; TileDB
+ * object files are written once under unique, timestamped names and are
+ * never modified in place, so a key always addresses the same bytes and
+ * invalidation reduces to LRU eviction.
+ *
+ * The cached buffers are allocated through the memory tracker passed at
+ * construction. Entries evicted while a reader still references them stay
+ * alive until the last reference is dropped.
+ */
+class GenericTileCache : private LRUCache<std::string, CachedGenericTile> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of 0 disables the
+   *     cache.
+   * @param memory_tracker The memory tracker to charge cached buffers to.
+   */
+  GenericTileCache(uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(GenericTileCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(GenericTileCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache is enabled. */
+  inline bool enabled() const {
+    return max_size_ > 0;
+  }
+
+  /**
+   * Returns the cached entry for the input location, or an entry with a
+   * `nullptr` data pointer on a miss. A hit makes the entry the most
+   * recently used one.
+   *
+   * @param uri The URI of the file holding the generic tile.
+   * @param offset The offset of the generic tile in the file.
+   * @param key_digest Digest of the encryption key the tile is read with.
+   * @return The cached entry, if any.
+   */
+  CachedGenericTile lookup(
+      const URI& uri, uint64_t offset, const std::string& key_digest);
+
+  /**
+   * Inserts an entry into the cache, copying the input buffer into memory
+   * owned by the cache. Does nothing if the entry already exists or the
+   * cache is disabled.
+   *
+   * @param uri The URI of the file holding the generic tile.
+   * @param offset The offset of the generic tile in the file.
+   * @param key_digest Digest of the encryption key the tile was read with.
+   * @param data Unfiltered tile data.
+   * @param size Size of the unfiltered tile data.
+   * @param version Format version from the generic tile header.
+   * @param datatype Datatype from the generic tile header.
+   * @param cell_size Cell size from the generic tile header.
+   * @param encryption_type Encryption type from the generic tile header.
+   */
+  void insert(
+      const URI& uri,
+      uint64_t offset,
+      const std::string& key_digest,
+      const void* data,
+      uint64_t size,
+      uint32_t version,
+      uint8_t datatype,
+      uint64_t cell_size,
+      uint8_t encryption_type);
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Builds the cache key for the input location. The key includes a digest
+   * of the encryption key, so that plaintext cached under one key can never
+   * be served to a lookup with a different key: a wrong-key read misses the
+   * cache and fails authentication on the regular read path instead.
+   */
+  static std::string make_key(
+      const URI& uri, uint64_t offset, const std::string& key_digest);
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum cache size, in bytes. */
+  const uint64_t max_size_;
+
+  /** The memory tracker cached buffers are charged to. */
+  shared_ptr<MemoryTracker> memory_tracker_;
+
+  /** Protects the underlying LRU cache. */
+  std::mutex mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_GENERIC_TILE_CACHE_H
@@ -0,0 +1,94 @@
+/**
+ * @file   label_range_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class LabelRangeCache.
+ */
+
+#include "tiledb/sm/cache/label_range_cache.h"
+
+#include <cstring>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+LabelRangeCache::LabelRangeCache(uint64_t max_size)
+    : LRUCache<std::string, shared_ptr<const CachedLabelRanges>>(max_size)
+    , max_size_(max_size) {
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+shared_ptr<const CachedLabelRanges> LabelRangeCache::lookup(
+    const std::string& key) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!has_item(key)) {
+    return nullptr;
+  }
+
+  touch_item(key);
+  return *get_item(key);
+}
+
+void LabelRangeCache::insert(
+    const std::string& key,
+    bool ranges_are_points,
+    storage_size_t count,
+    const void* data,
+    storage_size_t data_size) {
+  if (!enabled()) {
+    return;
+  }
+
+  auto entry = make_shared<CachedLabelRanges>(
+      HERE(),
+      CachedLabelRanges{
+          ranges_are_points,
+          count,
+          std::vector<uint8_t>(
+              static_cast<const uint8_t*>(data),
+              static_cast<const uint8_t*>(data) + data_size)});
+
+  // Account for the range data and the key.
+  const uint64_t entry_size = data_size + key.size();
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  LRUCache<std::string, shared_ptr<const CachedLabelRanges>>::insert(
+      key, std::move(entry), entry_size, false);
+}
+
+}  // namespace sm
+}  // namespace tiledb
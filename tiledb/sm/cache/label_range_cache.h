@@ -0,0 +1,143 @@
+/**
+ * @file   label_range_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class LabelRangeCache.
+ */
+
+#ifndef TILEDB_LABEL_RANGE_CACHE_H
+#define TILEDB_LABEL_RANGE_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** Index ranges resolved from a set of label ranges. */
+struct CachedLabelRanges {
+  /**
+   * If ``true``, the data contains point values. Otherwise, it contains
+   * alternating start/end values of ranges.
+   */
+  bool ranges_are_points_;
+
+  /** The number of stored index values. */
+  storage_size_t count_;
+
+  /** The raw index range data. */
+  std::vector<uint8_t> data_;
+};
+
+/**
+ * A thread-safe LRU cache of index ranges resolved from dimension label
+ * ranges, keyed by label name, label fragment list and label ranges.
+ *
+ * Time-window style workloads query the same label boundaries over and
+ * over; resolving them runs a full `OrderedDimLabelReader` read against the
+ * dimension label array every time. The resolved index ranges only depend
+ * on the label data, so keying entries on the fragment list of the opened
+ * dimension label makes hits always valid: writes to the label change the
+ * fragment list and thus the key, and the stale entries age out of the
+ * cache.
+ */
+class LabelRangeCache
+    : private LRUCache<std::string, shared_ptr<const CachedLabelRanges>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of 0 disables the
+   *     cache.
+   */
+  explicit LabelRangeCache(uint64_t max_size);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(LabelRangeCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(LabelRangeCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache is enabled. */
+  inline bool enabled() const {
+    return max_size_ > 0;
+  }
+
+  /**
+   * Returns the cached entry for the input key, or `nullptr` on a miss. A
+   * hit makes the entry the most recently used one.
+   *
+   * @param key The cache key for the resolved ranges.
+   * @return The cached entry, if any.
+   */
+  shared_ptr<const CachedLabelRanges> lookup(const std::string& key);
+
+  /**
+   * Inserts an entry into the cache. Does nothing if an entry already
+   * exists for the key or the cache is disabled.
+   *
+   * @param key The cache key for the resolved ranges.
+   * @param ranges_are_points If ``true``, the data contains point values.
+   * @param count The number of stored index values.
+   * @param data The raw index range data.
+   * @param data_size Size of the index range data, in bytes.
+   */
+  void insert(
+      const std::string& key,
+      bool ranges_are_points,
+      storage_size_t count,
+      const void* data,
+      storage_size_t data_size);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum cache size, in bytes. */
+  const uint64_t max_size_;
+
+  /** Protects the underlying LRU cache. */
+  std::mutex mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_LABEL_RANGE_CACHE_H
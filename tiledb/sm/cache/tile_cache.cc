@@ -0,0 +1,139 @@
+/**
+ * @file   tile_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class TileCache.
+ */
+
+#include <cstring>
+
+#include "tiledb/sm/cache/tile_cache.h"
+
+#include "tiledb/common/memory_tracker.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+TileCache::TileCache(
+    uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker)
+    : LRUCache<std::string, CachedTileData>(max_size)
+    , max_size_(max_size)
+    , memory_tracker_(memory_tracker) {
+  memory_tracker_->set_type(MemoryTrackerType::TILE_CACHE);
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+CachedTileData TileCache::lookup(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!has_item(key)) {
+    return CachedTileData();
+  }
+
+  touch_item(key);
+  return *get_item(key);
+}
+
+bool TileCache::contains(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return has_item(key);
+}
+
+void TileCache::insert(
+    const std::string& key,
+    const void* fixed_data,
+    uint64_t fixed_size,
+    const void* var_data,
+    uint64_t var_size,
+    const void* validity_data,
+    uint64_t validity_size) {
+  if (!enabled()) {
+    return;
+  }
+
+  // Copy the tile data outside of the lock, the copies are simply dropped if
+  // a concurrent query cached the same entry in the meantime.
+  CachedTileData entry;
+  uint64_t entry_size = 0;
+  if (fixed_data != nullptr) {
+    entry.fixed_ = copy_into_cache(fixed_data, fixed_size);
+    entry.fixed_size_ = fixed_size;
+    entry_size += fixed_size;
+  }
+
+  if (var_data != nullptr) {
+    entry.var_ = copy_into_cache(var_data, var_size);
+    entry.var_size_ = var_size;
+    entry_size += var_size;
+  }
+
+  if (validity_data != nullptr) {
+    entry.validity_ = copy_into_cache(validity_data, validity_size);
+    entry.validity_size_ = validity_size;
+    entry_size += validity_size;
+  }
+
+  if (entry_size == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  LRUCache<std::string, CachedTileData>::insert(
+      key, std::move(entry), entry_size, false);
+}
+
+/* ********************************* */
+/*          PRIVATE METHODS          */
+/* ********************************* */
+
+std::shared_ptr<std::byte> TileCache::copy_into_cache(
+    const void* data, uint64_t size) {
+  auto resource = memory_tracker_->get_resource(MemoryType::TILE_CACHE);
+  auto copy = static_cast<std::byte*>(resource->allocate(size));
+  memcpy(copy, data, size);
+
+  // The deleter keeps the memory tracker alive so that evicted entries can
+  // outlive the cache while a query still references them.
+  auto memory_tracker = memory_tracker_;
+  return std::shared_ptr<std::byte>(
+      copy, [memory_tracker, size](std::byte* p) {
+        memory_tracker->get_resource(MemoryType::TILE_CACHE)
+            ->deallocate(p, size);
+      });
+}
+
+}  // namespace sm
+}  // namespace tiledb
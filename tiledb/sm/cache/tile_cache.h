@@ -0,0 +1,186 @@
+/**
+ * @file   tile_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TileCache.
+ */
+
+#ifndef TILEDB_TILE_CACHE_H
+#define TILEDB_TILE_CACHE_H
+
+#include <mutex>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class MemoryTracker;
+
+/**
+ * Unfiltered tile payloads served from the tile cache for one result tile,
+ * or `nullptr` for the components that are not cached.
+ */
+struct CachedTileData {
+  /** Fixed data. */
+  std::shared_ptr<std::byte> fixed_;
+
+  /** Size of the fixed data. */
+  uint64_t fixed_size_ = 0;
+
+  /** Var data. */
+  std::shared_ptr<std::byte> var_;
+
+  /** Size of the var data. */
+  uint64_t var_size_ = 0;
+
+  /** Validity data. */
+  std::shared_ptr<std::byte> validity_;
+
+  /** Size of the validity data. */
+  uint64_t validity_size_ = 0;
+};
+
+/**
+ * A thread-safe, context-level LRU cache of unfiltered tile payloads.
+ *
+ * Readers insert tile data after unfiltering and probe the cache before
+ * issuing reads, so that queries overlapping previously read tiles skip
+ * both the I/O and the filter pipeline for those tiles. Keys are opaque
+ * strings built by the readers from the fragment URI, tile index and field
+ * name; since fragment URIs are never reused, stale entries cannot be
+ * served and invalidation reduces to LRU eviction.
+ *
+ * The cached buffers are allocated through the memory tracker passed at
+ * construction. Entries evicted while a concurrent query still references
+ * them stay alive until the last reference is dropped.
+ */
+class TileCache : private LRUCache<std::string, CachedTileData> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of 0 disables the
+   *     cache.
+   * @param memory_tracker The memory tracker to charge cached buffers to.
+   */
+  TileCache(uint64_t max_size, shared_ptr<MemoryTracker> memory_tracker);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(TileCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(TileCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache is enabled. */
+  inline bool enabled() const {
+    return max_size_ > 0;
+  }
+
+  /**
+   * Returns the cached entry for the input key, or an entry with `nullptr`
+   * components on a miss. A hit makes the entry the most recently used one.
+   *
+   * @param key The key of the entry to look up.
+   * @return The cached entry, if any.
+   */
+  CachedTileData lookup(const std::string& key);
+
+  /**
+   * Returns `true` if an entry exists for the input key. Used to avoid
+   * copying tile data for entries that are already cached.
+   *
+   * @param key The key of the entry to check.
+   * @return `true` if the entry exists.
+   */
+  bool contains(const std::string& key);
+
+  /**
+   * Inserts an entry into the cache, copying the input buffers into memory
+   * owned by the cache. Components with a `nullptr` data pointer are not
+   * stored. Does nothing if the entry already exists or the cache is
+   * disabled.
+   *
+   * @param key The key of the entry to insert.
+   * @param fixed_data Fixed tile data, or `nullptr`.
+   * @param fixed_size Size of the fixed tile data.
+   * @param var_data Var tile data, or `nullptr`.
+   * @param var_size Size of the var tile data.
+   * @param validity_data Validity tile data, or `nullptr`.
+   * @param validity_size Size of the validity tile data.
+   */
+  void insert(
+      const std::string& key,
+      const void* fixed_data,
+      uint64_t fixed_size,
+      const void* var_data,
+      uint64_t var_size,
+      const void* validity_data,
+      uint64_t validity_size);
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Copies the input buffer into a buffer allocated through the memory
+   * tracker.
+   *
+   * @param data The data to copy, or `nullptr`.
+   * @param size The size of the data.
+   * @return Shared ownership of the copy, or `nullptr`.
+   */
+  std::shared_ptr<std::byte> copy_into_cache(const void* data, uint64_t size);
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Maximum cache size, in bytes. */
+  const uint64_t max_size_;
+
+  /** The memory tracker cached buffers are charged to. */
+  shared_ptr<MemoryTracker> memory_tracker_;
+
+  /** Protects the underlying LRU cache. */
+  std::mutex mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TILE_CACHE_H
@@ -34,6 +34,9 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/constants.h"
+
+#include <cstring>
 
 class DoubleDeltaException : public StatusException {
  public:
@@ -54,10 +57,194 @@ namespace tiledb::sm {
 
 const uint64_t DoubleDelta::OVERHEAD = 17;
 
+/**
+ * Widens a value to 64 bits, sign-extending signed types so that small
+ * negative deltas stay small after zig-zag encoding. All double delta
+ * arithmetic in the blocked layout is performed modulo two to the width of
+ * the value type, so the widening scheme does not affect correctness.
+ */
+template <class T>
+static inline uint64_t dd_widened(T value) {
+  if constexpr (std::is_same_v<T, uint64_t>)
+    return value;
+  else
+    return uint64_t(int64_t(value));
+}
+
 /* ****************************** */
 /*               API              */
 /* ****************************** */
 
+void DoubleDelta::compress(
+    Datatype type,
+    format_version_t version,
+    ConstBuffer* input_buffer,
+    Buffer* output_buffer) {
+  // Arrays written before the blocked layout keep the legacy layout.
+  if (version < constants::double_delta_blocked_min_format_version)
+    return DoubleDelta::compress(type, input_buffer, output_buffer);
+
+  switch (type) {
+    case Datatype::BLOB:
+    case Datatype::GEOM_WKB:
+    case Datatype::GEOM_WKT:
+      return DoubleDelta::compress_blocked<std::byte>(
+          input_buffer, output_buffer);
+    case Datatype::INT8:
+      return DoubleDelta::compress_blocked<int8_t>(input_buffer, output_buffer);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return DoubleDelta::compress_blocked<uint8_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT16:
+      return DoubleDelta::compress_blocked<int16_t>(
+          input_buffer, output_buffer);
+    case Datatype::UINT16:
+      return DoubleDelta::compress_blocked<uint16_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT32:
+      return DoubleDelta::compress_blocked<int>(input_buffer, output_buffer);
+    case Datatype::UINT32:
+      return DoubleDelta::compress_blocked<uint32_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT64:
+      return DoubleDelta::compress_blocked<int64_t>(
+          input_buffer, output_buffer);
+    case Datatype::UINT64:
+      return DoubleDelta::compress_blocked<uint64_t>(
+          input_buffer, output_buffer);
+    case Datatype::CHAR:
+      return DoubleDelta::compress_blocked<char>(input_buffer, output_buffer);
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return DoubleDelta::compress_blocked<int64_t>(
+          input_buffer, output_buffer);
+    case Datatype::STRING_ASCII:
+    case Datatype::STRING_UTF8:
+    case Datatype::STRING_UTF16:
+    case Datatype::STRING_UTF32:
+    case Datatype::STRING_UCS2:
+    case Datatype::STRING_UCS4:
+    case Datatype::ANY:
+      return DoubleDelta::compress_blocked<uint8_t>(
+          input_buffer, output_buffer);
+    case Datatype::FLOAT32:
+    case Datatype::FLOAT64:
+      throw DoubleDeltaException(
+          "DoubleDelta tile compression is not yet supported for float types.");
+  }
+
+  assert(false);
+  throw DoubleDeltaException(
+      "Cannot compress tile with DoubleDelta; Unsupported datatype");
+}
+
+void DoubleDelta::decompress(
+    Datatype type,
+    format_version_t version,
+    ConstBuffer* input_buffer,
+    PreallocatedBuffer* output_buffer) {
+  // Arrays written before the blocked layout keep the legacy layout.
+  if (version < constants::double_delta_blocked_min_format_version)
+    return DoubleDelta::decompress(type, input_buffer, output_buffer);
+
+  switch (type) {
+    case Datatype::BLOB:
+    case Datatype::GEOM_WKB:
+    case Datatype::GEOM_WKT:
+      return DoubleDelta::decompress_blocked<std::byte>(
+          input_buffer, output_buffer);
+    case Datatype::INT8:
+      return DoubleDelta::decompress_blocked<int8_t>(
+          input_buffer, output_buffer);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return DoubleDelta::decompress_blocked<uint8_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT16:
+      return DoubleDelta::decompress_blocked<int16_t>(
+          input_buffer, output_buffer);
+    case Datatype::UINT16:
+      return DoubleDelta::decompress_blocked<uint16_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT32:
+      return DoubleDelta::decompress_blocked<int>(input_buffer, output_buffer);
+    case Datatype::UINT32:
+      return DoubleDelta::decompress_blocked<uint32_t>(
+          input_buffer, output_buffer);
+    case Datatype::INT64:
+      return DoubleDelta::decompress_blocked<int64_t>(
+          input_buffer, output_buffer);
+    case Datatype::UINT64:
+      return DoubleDelta::decompress_blocked<uint64_t>(
+          input_buffer, output_buffer);
+    case Datatype::CHAR:
+      return DoubleDelta::decompress_blocked<char>(input_buffer, output_buffer);
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return DoubleDelta::decompress_blocked<int64_t>(
+          input_buffer, output_buffer);
+    case Datatype::STRING_ASCII:
+    case Datatype::STRING_UTF8:
+    case Datatype::STRING_UTF16:
+    case Datatype::STRING_UTF32:
+    case Datatype::STRING_UCS2:
+    case Datatype::STRING_UCS4:
+    case Datatype::ANY:
+      return DoubleDelta::decompress_blocked<uint8_t>(
+          input_buffer, output_buffer);
+    case Datatype::FLOAT32:
+    case Datatype::FLOAT64:
+      throw DoubleDeltaException(
+          "DoubleDelta tile decompression is not yet supported for float "
+          "types.");
+  }
+
+  assert(false);
+  throw DoubleDeltaException(
+      "Cannot decompress tile with DoubleDelta; Unupported datatype");
+}
+
 void DoubleDelta::compress(
     Datatype type, ConstBuffer* input_buffer, Buffer* output_buffer) {
   switch (type) {
@@ -197,9 +384,11 @@ void DoubleDelta::decompress(
       "Cannot decompress tile with DoubleDelta; Unupported datatype");
 }
 
-uint64_t DoubleDelta::overhead(uint64_t) {
-  // DoubleDelta has a fixed size overhead
-  return DoubleDelta::OVERHEAD;
+uint64_t DoubleDelta::overhead(uint64_t nbytes) {
+  // The blocked layout adds one bitsize byte and up to a word of padding per
+  // block on top of the header and the two leading values. This bound also
+  // covers the fixed overhead of the legacy layout.
+  return DoubleDelta::OVERHEAD + 9 * (nbytes / DoubleDelta::BLOCK_SIZE + 1);
 }
 
 /* ****************************** */
@@ -256,6 +445,146 @@ void DoubleDelta::compress(ConstBuffer* input_buffer, Buffer* output_buffer) {
     throw_if_not_ok(output_buffer->write(&chunk, sizeof(uint64_t)));
 }
 
+template <class T>
+void DoubleDelta::compress_blocked(
+    ConstBuffer* input_buffer, Buffer* output_buffer) {
+  // Calculate number of values
+  uint64_t value_size = sizeof(T);
+  uint64_t num = input_buffer->size() / value_size;
+  assert(num > 0 && (input_buffer->size() % value_size == 0));
+  auto in = (const T*)input_buffer->data();
+
+  // Write number of values
+  throw_if_not_ok(output_buffer->write(&num, sizeof(uint64_t)));
+
+  // Write the first two values verbatim
+  throw_if_not_ok(output_buffer->write(&in[0], value_size));
+  if (num == 1)
+    return;
+  throw_if_not_ok(output_buffer->write(&in[1], value_size));
+  if (num == 2)
+    return;
+
+  // Double deltas are truncated to the width of the value type; the
+  // decompressor reconstructs the values with the same modular arithmetic,
+  // so the truncation is lossless and it bounds the per-block bitsize by
+  // the type width.
+  constexpr unsigned width = 8 * sizeof(T);
+  constexpr uint64_t mask =
+      (width == 64) ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+
+  uint64_t zz[BLOCK_SIZE];
+  uint64_t words[BLOCK_SIZE];
+  uint64_t prev_delta = dd_widened(in[1]) - dd_widened(in[0]);
+  uint64_t i = 2;
+  while (i < num) {
+    uint64_t count = std::min(BLOCK_SIZE, num - i);
+
+    // Zig-zag encode the block's double deltas and compute their bitsize
+    uint64_t max_zz = 0;
+    for (uint64_t j = 0; j < count; ++j) {
+      uint64_t cur_delta = dd_widened(in[i + j]) - dd_widened(in[i + j - 1]);
+      uint64_t dd = (cur_delta - prev_delta) & mask;
+      uint64_t sign = uint64_t(0) - ((dd >> (width - 1)) & 1);
+      uint64_t z = ((dd << 1) ^ sign) & mask;
+      zz[j] = z;
+      max_zz |= z;
+      prev_delta = cur_delta;
+    }
+    uint8_t bits = 0;
+    while (max_zz != 0) {
+      ++bits;
+      max_zz >>= 1;
+    }
+
+    // Write the bitsize byte and the block packed LSB-first in 64-bit words
+    throw_if_not_ok(output_buffer->write(&bits, sizeof(uint8_t)));
+    if (bits > 0) {
+      uint64_t nwords = (count * bits + 63) / 64;
+      std::memset(words, 0, nwords * sizeof(uint64_t));
+      for (uint64_t j = 0; j < count; ++j) {
+        uint64_t bit_pos = j * bits;
+        uint64_t word = bit_pos >> 6, bit = bit_pos & 63;
+        words[word] |= zz[j] << bit;
+        if (bit + bits > 64)
+          words[word + 1] |= zz[j] >> (64 - bit);
+      }
+      throw_if_not_ok(output_buffer->write(words, nwords * sizeof(uint64_t)));
+    }
+    i += count;
+  }
+}
+
+template <class T>
+void DoubleDelta::decompress_blocked(
+    ConstBuffer* input_buffer, PreallocatedBuffer* output_buffer) {
+  // Read number of values
+  uint64_t num = 0;
+  uint64_t value_size = sizeof(T);
+  throw_if_not_ok(input_buffer->read(&num, sizeof(uint64_t)));
+  if (num == 0)
+    return;
+  if (num > output_buffer->free_space() / value_size) {
+    throw DoubleDeltaException(
+        "Cannot decompress with DoubleDelta; Output buffer overflow");
+  }
+  auto out = (T*)output_buffer->cur_data();
+
+  // Read the first two values verbatim
+  throw_if_not_ok(input_buffer->read(&out[0], value_size));
+  if (num >= 2)
+    throw_if_not_ok(input_buffer->read(&out[1], value_size));
+  if (num <= 2) {
+    output_buffer->advance_offset(num * value_size);
+    return;
+  }
+
+  constexpr unsigned width = 8 * sizeof(T);
+  constexpr uint64_t mask =
+      (width == 64) ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+
+  uint64_t words[BLOCK_SIZE];
+  uint64_t prev = dd_widened(out[1]);
+  uint64_t prev_delta = dd_widened(out[1]) - dd_widened(out[0]);
+  uint64_t i = 2;
+  while (i < num) {
+    uint64_t count = std::min(BLOCK_SIZE, num - i);
+    uint8_t bits = 0;
+    throw_if_not_ok(input_buffer->read(&bits, sizeof(uint8_t)));
+    if (bits > 64) {
+      throw DoubleDeltaException(
+          "Cannot decompress with DoubleDelta; Invalid block bitsize");
+    }
+
+    if (bits == 0) {
+      // All double deltas in the block are zero (constant stride)
+      for (uint64_t j = 0; j < count; ++j) {
+        prev += prev_delta;
+        out[i + j] = (T)prev;
+      }
+    } else {
+      uint64_t nwords = (count * bits + 63) / 64;
+      throw_if_not_ok(input_buffer->read(words, nwords * sizeof(uint64_t)));
+      uint64_t value_mask =
+          (bits == 64) ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+      for (uint64_t j = 0; j < count; ++j) {
+        uint64_t bit_pos = j * bits;
+        uint64_t word = bit_pos >> 6, bit = bit_pos & 63;
+        uint64_t z = words[word] >> bit;
+        if (bit + bits > 64)
+          z |= words[word + 1] << (64 - bit);
+        z &= value_mask;
+        uint64_t dd = ((z >> 1) ^ (uint64_t(0) - (z & 1))) & mask;
+        prev_delta += dd;
+        prev += prev_delta;
+        out[i + j] = (T)prev;
+      }
+    }
+    i += count;
+  }
+  output_buffer->advance_offset(num * value_size);
+}
+
 template <class T>
 void DoubleDelta::compute_bitsize(T* in, uint64_t num, unsigned int* bitsize) {
   // Find maximum absolute double delta
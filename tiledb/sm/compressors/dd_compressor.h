@@ -49,17 +49,65 @@ enum class Datatype : uint8_t;
 class DoubleDelta {
  public:
   /**
-   * Constant overhead (equal to 1 byte for the bitsize, 8 bytes for
-   * the number of cells, and 8 bytes for a potential extra 64-bit chunk).
+   * Constant overhead of the legacy layout (equal to 1 byte for the bitsize,
+   * 8 bytes for the number of cells, and 8 bytes for a potential extra
+   * 64-bit chunk).
    */
   static const uint64_t OVERHEAD;
 
+  /** Number of values encoded per block in the blocked layout. */
+  static constexpr uint64_t BLOCK_SIZE = 128;
+
   /* ****************************** */
   /*               API              */
   /* ****************************** */
 
   /**
-   * Compression function. The algorithm works as follows:
+   * Compression function. For format versions starting at
+   * constants::double_delta_blocked_min_format_version, the output buffer
+   * contains:
+   *
+   * n | in_0 | in_1 | block_0 | block_1 | ...
+   *
+   * where *n* (uint64_t) is the number of values in the input buffer, the
+   * first two values are stored verbatim, and each block encodes up to
+   * BLOCK_SIZE double deltas as a bitsize byte followed by the zig-zag
+   * encoded double deltas, bit-packed LSB-first into 64-bit words. The
+   * double deltas are truncated to the width of the value type, so a block
+   * never needs more bits per value than the type width and decompression
+   * can unpack a whole block with shifts and masks.
+   *
+   * For older format versions, the legacy layout documented on the
+   * three-argument overload is produced.
+   *
+   * @param type The type of the input values.
+   * @param version The format version to write.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write to the compressed data.
+   */
+  static void compress(
+      Datatype type,
+      format_version_t version,
+      ConstBuffer* input_buffer,
+      Buffer* output_buffer);
+
+  /**
+   * Decompression function for data written with the given format version.
+   *
+   * @param type The type of the original decompressed values.
+   * @param version The format version the data was written with.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write the decompressed data to.
+   */
+  static void decompress(
+      Datatype type,
+      format_version_t version,
+      ConstBuffer* input_buffer,
+      PreallocatedBuffer* output_buffer);
+
+  /**
+   * Compression function producing the legacy layout. The algorithm works as
+   * follows:
    *
    * Let the input buffer contain the following values:
    *
@@ -104,7 +152,7 @@ class DoubleDelta {
       Datatype type, ConstBuffer* input_buffer, Buffer* output_buffer);
 
   /**
-   * Decompression function.
+   * Decompression function for the legacy layout.
    *
    * @param type The type of the original decompressed values.
    * @param input_buffer Input buffer to read from.
@@ -127,6 +175,28 @@ class DoubleDelta {
   template <class T>
   static void compress(ConstBuffer* input_buffer, Buffer* output_buffer);
 
+  /**
+   * Templated compression function producing the blocked layout.
+   *
+   * @tparam The datatype of the values.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write the compressed data to.
+   */
+  template <class T>
+  static void compress_blocked(
+      ConstBuffer* input_buffer, Buffer* output_buffer);
+
+  /**
+   * Templated decompression function for the blocked layout.
+   *
+   * @tparam The datatype of the values.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write the decompressed data to.
+   */
+  template <class T>
+  static void decompress_blocked(
+      ConstBuffer* input_buffer, PreallocatedBuffer* output_buffer);
+
   /**
    * Calculates the bitsize all the double deltas will have. Note that
    * the sign bit is not counted.
@@ -229,7 +229,7 @@ void Delta::compress(ConstBuffer* input_buffer, Buffer* output_buffer) {
   uint64_t num = input_buffer->size() / value_size;
   assert(num > 0 && (input_buffer->size() % value_size == 0));
 
-  auto in = (T*)input_buffer->data();
+  auto in = (const T*)input_buffer->data();
 
   // Write number of values
   throw_if_not_ok(output_buffer->write(&num, sizeof(uint64_t)));
@@ -237,10 +237,16 @@ void Delta::compress(ConstBuffer* input_buffer, Buffer* output_buffer) {
   // Write first value
   throw_if_not_ok(output_buffer->write(&in[0], value_size));
   if (num > 1) {
-    for (uint64_t i = 1; i < num; ++i) {
-      int64_t cur_delta = int64_t(in[i]) - int64_t(in[i - 1]);
-      throw_if_not_ok(output_buffer->write(&cur_delta, value_size));
-    }
+    // Write the deltas in a single pass through the output allocation.
+    // Truncating the wider difference to the value size produces the same
+    // bytes the element-at-a-time path used to write.
+    uint64_t nbytes = (num - 1) * value_size;
+    throw_if_not_ok(output_buffer->realloc(output_buffer->offset() + nbytes));
+    auto deltas = (T*)output_buffer->cur_data();
+    for (uint64_t i = 1; i < num; ++i)
+      deltas[i - 1] = (T)(int64_t(in[i]) - int64_t(in[i - 1]));
+    output_buffer->advance_size(nbytes);
+    output_buffer->advance_offset(nbytes);
   }
 }
 
@@ -250,21 +256,26 @@ void Delta::decompress(
   uint64_t num = 0;
   uint64_t value_size = sizeof(T);
   throw_if_not_ok(input_buffer->read(&num, sizeof(uint64_t)));
-
-  // Read first value
-  T last_value;
-  T cur_value;
-  throw_if_not_ok(input_buffer->read(&last_value, value_size));
-  throw_if_not_ok(output_buffer->write(&last_value, value_size));
-  if (num > 1) {
-    // Decompress rest of the values
-    for (uint64_t i = 1; i < num; ++i) {
-      throw_if_not_ok(input_buffer->read(&cur_value, value_size));
-      cur_value = static_cast<T>(int64_t(last_value) + int64_t(cur_value));
-      throw_if_not_ok(output_buffer->write(&cur_value, value_size));
-      last_value = cur_value;
-    }
+  if (num == 0)
+    return;
+  if (num > output_buffer->free_space() / value_size) {
+    throw DeltaCompressorException(
+        "Decompression failed; Output buffer overflow");
   }
+  if (num > input_buffer->nbytes_left_to_read() / value_size) {
+    throw DeltaCompressorException(
+        "Decompression failed; Input buffer too small");
+  }
+
+  // Prefix-sum the deltas in a single pass through both allocations. The
+  // modular arithmetic matches the truncation applied by the compressor.
+  auto in = (const T*)input_buffer->cur_data();
+  auto out = (T*)output_buffer->cur_data();
+  out[0] = in[0];
+  for (uint64_t i = 1; i < num; ++i)
+    out[i] = static_cast<T>(int64_t(out[i - 1]) + int64_t(in[i]));
+  input_buffer->advance_offset(num * value_size);
+  output_buffer->advance_offset(num * value_size);
 }
 
 // Explicit template instantiations
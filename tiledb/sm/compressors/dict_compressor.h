@@ -36,8 +36,10 @@
 #include "tiledb/common/common.h"
 #include "tiledb/sm/misc/endian.h"
 
+#include <cstring>
+#include <limits>
 #include <map>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 using namespace tiledb::common;
@@ -45,6 +47,104 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+/**
+ * Flat open-addressing hash table mapping strings to word ids, used by
+ * dictionary encoding.
+ *
+ * Linear probing over a single power-of-two slot array: each slot stores
+ * the precomputed hash, the key view and the id, so probing is one cache
+ * line per step and insertion never allocates per entry, unlike the node
+ * based std::unordered_map it replaces. Keys are views into the tile
+ * input, so no key storage is needed. The slot array is sized up front
+ * for the worst case (all input strings unique) and is never rehashed.
+ *
+ * `reset` keeps the allocation when the capacity fits, so a thread
+ * encoding many same-sized tiles in one write reuses the same table
+ * memory across tiles.
+ */
+class StringIdTable {
+ public:
+  /** The id stored in empty slots. */
+  static constexpr uint64_t invalid_id = std::numeric_limits<uint64_t>::max();
+
+  /**
+   * Clears the table and sizes it for the input number of keys at a load
+   * factor of at most 0.7. The allocation is reused when possible and
+   * released when it is much larger than needed.
+   */
+  void reset(uint64_t expected_keys) {
+    uint64_t capacity = 64;
+    while (capacity * 7 < expected_keys * 10) {
+      capacity <<= 1;
+    }
+    mask_ = capacity - 1;
+    if (slots_.capacity() > 4 * capacity) {
+      std::vector<Slot>().swap(slots_);
+    }
+    slots_.assign(capacity, Slot{});
+  }
+
+  /**
+   * Returns the id of `key`, inserting it with id `next_id` if it is not
+   * already present.
+   */
+  uint64_t find_or_insert(std::string_view key, uint64_t next_id) {
+    auto hash = hash_string(key);
+    auto index = hash & mask_;
+    while (true) {
+      auto& slot = slots_[index];
+      if (slot.id == invalid_id) {
+        slot = {hash, next_id, key};
+        return next_id;
+      }
+      if (slot.hash == hash && slot.key == key) {
+        return slot.id;
+      }
+      index = (index + 1) & mask_;
+    }
+  }
+
+ private:
+  /** A table slot; empty slots have `id == invalid_id`. */
+  struct Slot {
+    uint64_t hash = 0;
+    uint64_t id = invalid_id;
+    std::string_view key;
+  };
+
+  /**
+   * Multiply-mix hash over 8-byte words. The unaligned loads go through
+   * memcpy so the compiler emits single wide loads, and comparing the
+   * stored hash before the key skips almost all full key comparisons.
+   */
+  static uint64_t hash_string(std::string_view key) {
+    const char* data = key.data();
+    uint64_t size = key.size();
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ (size * 0xff51afd7ed558ccdULL);
+    while (size >= 8) {
+      uint64_t word;
+      std::memcpy(&word, data, 8);
+      hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 32;
+      data += 8;
+      size -= 8;
+    }
+    uint64_t word = 0;
+    if (size > 0) {
+      std::memcpy(&word, data, size);
+    }
+    hash = (hash ^ word) * 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 32;
+    return hash;
+  }
+
+  /** The slot array; its size is always a power of two. */
+  std::vector<Slot> slots_;
+
+  /** The probe mask, equal to the slot array size minus one. */
+  uint64_t mask_ = 0;
+};
+
 /** Handles dictionary compression/decompression of variable sized strings. */
 class DictEncoding {
  public:
@@ -145,18 +245,23 @@ class DictEncoding {
     dict.reserve(input.size());
     T word_id = 0;
     const auto word_id_size = sizeof(T);
-    // hash table to store string - unique id associations
-    std::unordered_map<std::string_view, T> word_ids;
+    // Flat hash table to store string - unique id associations. It is
+    // thread local so consecutive tiles encoded on the same thread reuse
+    // the same slot array instead of reallocating it per tile.
+    thread_local StringIdTable word_ids;
+    word_ids.reset(input.size());
     auto out_index = 0;
 
     for (uint64_t i = 0; i < input.size(); i++) {
-      // If we haven't seen that string before, add it to the dictionary
-      if (word_ids.find(input[i]) == word_ids.end()) {
+      // If we haven't seen that string before, add it to the dictionary.
+      // A single probe both looks up and inserts.
+      auto id = word_ids.find_or_insert(input[i], word_id);
+      if (id == word_id) {
         dict.emplace_back(input[i]);
-        word_ids[input[i]] = word_id++;
+        word_id++;
       }
 
-      utils::endianness::encode_be<T>(word_ids[input[i]], &output[out_index]);
+      utils::endianness::encode_be<T>(static_cast<T>(id), &output[out_index]);
       out_index += word_id_size;
     }
 
@@ -302,5 +302,129 @@ void RLE::decompress(
   }
 }
 
+std::vector<RLE::SkipEntry> RLE::build_skip_index(
+    const span<const std::byte> input,
+    const uint8_t rle_len_size,
+    const uint8_t string_len_size,
+    uint64_t k) {
+  if (rle_len_size == 0 || string_len_size == 0) {
+    throw RLEException("Failed building RLE skip index; empty arguments");
+  }
+
+  if (rle_len_size <= 1) {
+    if (string_len_size <= 1) {
+      return build_skip_index<uint8_t, uint8_t>(input, k);
+    } else if (string_len_size <= 2) {
+      return build_skip_index<uint8_t, uint16_t>(input, k);
+    } else if (string_len_size <= 4) {
+      return build_skip_index<uint8_t, uint32_t>(input, k);
+    } else {
+      return build_skip_index<uint8_t, uint64_t>(input, k);
+    }
+  } else if (rle_len_size <= 2) {
+    if (string_len_size <= 1) {
+      return build_skip_index<uint16_t, uint8_t>(input, k);
+    } else if (string_len_size <= 2) {
+      return build_skip_index<uint16_t, uint16_t>(input, k);
+    } else if (string_len_size <= 4) {
+      return build_skip_index<uint16_t, uint32_t>(input, k);
+    } else {
+      return build_skip_index<uint16_t, uint64_t>(input, k);
+    }
+  } else if (rle_len_size <= 4) {
+    if (string_len_size <= 1) {
+      return build_skip_index<uint32_t, uint8_t>(input, k);
+    } else if (string_len_size <= 2) {
+      return build_skip_index<uint32_t, uint16_t>(input, k);
+    } else if (string_len_size <= 4) {
+      return build_skip_index<uint32_t, uint32_t>(input, k);
+    } else {
+      return build_skip_index<uint32_t, uint64_t>(input, k);
+    }
+  } else {
+    if (string_len_size <= 1) {
+      return build_skip_index<uint64_t, uint8_t>(input, k);
+    } else if (string_len_size <= 2) {
+      return build_skip_index<uint64_t, uint16_t>(input, k);
+    } else if (string_len_size <= 4) {
+      return build_skip_index<uint64_t, uint32_t>(input, k);
+    } else {
+      return build_skip_index<uint64_t, uint64_t>(input, k);
+    }
+  }
+}
+
+void RLE::decompress(
+    const span<const std::byte> input,
+    const uint8_t rle_len_size,
+    const uint8_t string_len_size,
+    const std::vector<SkipEntry>& skip_index,
+    const uint64_t first_cell,
+    span<std::byte> output,
+    span<uint64_t> output_offsets) {
+  if (input.empty() || rle_len_size == 0 || string_len_size == 0) {
+    throw RLEException(
+        "Failed decompressing strings with RLE; empty input arguments");
+  }
+
+  if (rle_len_size <= 1) {
+    if (string_len_size <= 1) {
+      decompress<uint8_t, uint8_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 2) {
+      decompress<uint8_t, uint16_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 4) {
+      decompress<uint8_t, uint32_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else {
+      decompress<uint8_t, uint64_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    }
+  } else if (rle_len_size <= 2) {
+    if (string_len_size <= 1) {
+      decompress<uint16_t, uint8_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 2) {
+      decompress<uint16_t, uint16_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 4) {
+      decompress<uint16_t, uint32_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else {
+      decompress<uint16_t, uint64_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    }
+  } else if (rle_len_size <= 4) {
+    if (string_len_size <= 1) {
+      decompress<uint32_t, uint8_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 2) {
+      decompress<uint32_t, uint16_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 4) {
+      decompress<uint32_t, uint32_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else {
+      decompress<uint32_t, uint64_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    }
+  } else {
+    if (string_len_size <= 1) {
+      decompress<uint64_t, uint8_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 2) {
+      decompress<uint64_t, uint16_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else if (string_len_size <= 4) {
+      decompress<uint64_t, uint32_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    } else {
+      decompress<uint64_t, uint64_t>(
+          input, skip_index, first_cell, output, output_offsets);
+    }
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
@@ -37,6 +37,7 @@
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/endian.h"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -52,6 +53,21 @@ class PreallocatedBuffer;
 /** Handles compression/decompression Run-Length-Encoding. */
 class RLE {
  public:
+  /**
+   * Skip index entry for RLE-compressed strings: the input offset of a run
+   * together with the cumulative output position of its first cell.
+   */
+  struct SkipEntry {
+    /** Byte offset of the run in the compressed input. */
+    uint64_t input_offset;
+
+    /** Index of the first cell the run decodes to. */
+    uint64_t output_cell;
+
+    /** Byte offset of the first cell in the decompressed output. */
+    uint64_t output_offset;
+  };
+
   /**
    * Compression function.
    *
@@ -164,13 +180,158 @@ class RLE {
       in_index += run_size;
       string_length = utils::endianness::decode_be<P>(&input[in_index]);
       in_index += str_len_size;
+
+      // Write the string once and expand it over the run with doubling
+      // memcpys, so long runs are produced with wide copies instead of one
+      // copy per cell.
+      if (string_length > 0) {
+        memcpy(&output[out_offset], &input[in_index], string_length);
+        uint64_t copied = 1;
+        while (copied < run_length) {
+          const auto to_copy = std::min<uint64_t>(copied, run_length - copied);
+          memcpy(
+              &output[out_offset + copied * string_length],
+              &output[out_offset],
+              to_copy * string_length);
+          copied += to_copy;
+        }
+      }
+
       for (uint64_t j = 0; j < run_length; j++) {
-        if (string_length > 0) {
-          memcpy(&output[out_offset], &input[in_index], string_length);
+        output_offsets[offset_index + j] = out_offset + j * string_length;
+      }
+      offset_index += run_length;
+      out_offset += static_cast<uint64_t>(run_length) * string_length;
+      in_index += string_length;
+    }
+  }
+
+  /**
+   * Builds a skip index for RLE-compressed strings: the input offset and
+   * cumulative output position of every `k`-th run, starting with the
+   * first one. Only the run headers are scanned, so building the index is
+   * much cheaper than decoding. The index lets `decompress` calls start
+   * mid-chunk without walking the runs from the beginning of the input.
+   *
+   * @tparam T Type of integer used to store run lengths by the encoder
+   * @tparam P Type of integer used to store string sizes by the encoder
+   * @param input Input in [run length|string_size|string] RLE format
+   * @param k Number of runs between consecutive index entries
+   * @return Skip index entries, in input order
+   */
+  template <class T, class P>
+  static std::vector<SkipEntry> build_skip_index(
+      const span<const std::byte> input, uint64_t k) {
+    std::vector<SkipEntry> index;
+    if (input.empty() || k == 0)
+      return index;
+
+    const uint64_t run_size = sizeof(T);
+    const uint64_t str_len_size = sizeof(P);
+
+    uint64_t in_index = 0;
+    uint64_t cell = 0;
+    uint64_t out_offset = 0;
+    uint64_t run_num = 0;
+    while (in_index < input.size()) {
+      if (run_num % k == 0) {
+        index.push_back({in_index, cell, out_offset});
+      }
+
+      const auto run_length = utils::endianness::decode_be<T>(&input[in_index]);
+      const auto string_length =
+          utils::endianness::decode_be<P>(&input[in_index + run_size]);
+      cell += run_length;
+      out_offset += static_cast<uint64_t>(run_length) * string_length;
+      in_index += run_size + str_len_size + string_length;
+      run_num++;
+    }
+
+    return index;
+  }
+
+  /**
+   * Decompress a range of cells from strings encoded in RLE format. The
+   * skip index positions the decoder at the closest indexed run at or
+   * before `first_cell`; the runs between that run and the first cell are
+   * skipped by reading only their headers, without copying payloads. The
+   * number of cells decoded is the size of `output_offsets` (less if the
+   * input is exhausted first) and the offsets are relative to the start of
+   * `output`.
+   *
+   * @tparam T Type of integer used to store run lengths by the encoder
+   * @tparam P Type of integer used to store string sizes by the encoder
+   * @param input Input in [run length|string_size|string] RLE format
+   * @param skip_index Skip index built with `build_skip_index`, may be
+   * empty
+   * @param first_cell Index of the first cell to decode
+   * @param output Decoded output as a series of strings in contiguous
+   * memory. Memory is allocated and owned by the caller
+   * @param output_offsets Output offsets of the decoded cells. Memory is
+   * allocated and owned by the caller
+   */
+  template <class T, class P>
+  static void decompress(
+      const span<const std::byte> input,
+      const std::vector<SkipEntry>& skip_index,
+      const uint64_t first_cell,
+      span<std::byte> output,
+      span<uint64_t> output_offsets) {
+    if (input.empty() || output_offsets.empty())
+      return;
+
+    const uint64_t run_size = sizeof(T);
+    const uint64_t str_len_size = sizeof(P);
+
+    // Start from the closest indexed run at or before the first cell.
+    uint64_t in_index = 0;
+    uint64_t cell = 0;
+    auto it = std::upper_bound(
+        skip_index.begin(),
+        skip_index.end(),
+        first_cell,
+        [](uint64_t c, const SkipEntry& e) { return c < e.output_cell; });
+    if (it != skip_index.begin()) {
+      --it;
+      in_index = it->input_offset;
+      cell = it->output_cell;
+    }
+
+    uint64_t out_offset = 0;
+    size_t offset_index = 0;
+    while (in_index < input.size() && offset_index < output_offsets.size()) {
+      const auto run_length = utils::endianness::decode_be<T>(&input[in_index]);
+      const auto string_length =
+          utils::endianness::decode_be<P>(&input[in_index + run_size]);
+      in_index += run_size + str_len_size;
+
+      // Cells of the run before the first cell are skipped, not decoded.
+      const uint64_t skipped =
+          first_cell > cell ?
+              std::min<uint64_t>(first_cell - cell, run_length) :
+              0;
+      const uint64_t to_decode = std::min<uint64_t>(
+          run_length - skipped, output_offsets.size() - offset_index);
+
+      if (to_decode > 0 && string_length > 0) {
+        memcpy(&output[out_offset], &input[in_index], string_length);
+        uint64_t copied = 1;
+        while (copied < to_decode) {
+          const auto to_copy = std::min<uint64_t>(copied, to_decode - copied);
+          memcpy(
+              &output[out_offset + copied * string_length],
+              &output[out_offset],
+              to_copy * string_length);
+          copied += to_copy;
         }
-        output_offsets[offset_index++] = out_offset;
-        out_offset += string_length;
       }
+
+      for (uint64_t j = 0; j < to_decode; j++) {
+        output_offsets[offset_index + j] = out_offset + j * string_length;
+      }
+      offset_index += to_decode;
+      out_offset += to_decode * string_length;
+      cell += run_length;
       in_index += string_length;
     }
   }
@@ -280,11 +441,84 @@ class RLE {
     while (in_index < input.size()) {
       run_length = input[in_index++];
       auto value = input[in_index++];
-      for (uint64_t j = 0; j < run_length; j++) {
-        output[out_index++] = value;
-      }
+      std::fill_n(&output[out_index], run_length, value);
+      out_index += run_length;
+    }
+  }
+
+  /**
+   * Decompress a range of cells from numbers encoded in RLE format. Runs
+   * before `first_cell` are skipped by reading only their run lengths. The
+   * number of cells decoded is the size of `output` (less if the input is
+   * exhausted first).
+   *
+   * @tparam T Type of integer in input
+   * @param input Input in [run length|value] RLE format to decompress
+   * @param first_cell Index of the first cell to decode
+   * @param output Decoded output as a series of values in contiguous
+   * memory. Memory is allocated and owned by the caller
+   */
+  template <class T>
+  static void decompress(
+      const span<T> input, const uint64_t first_cell, span<T> output) {
+    if (input.empty() || output.empty())
+      return;
+
+    uint64_t cell = 0;
+    uint64_t out_index = 0;
+    uint64_t in_index = 0;
+    while (in_index < input.size() && out_index < output.size()) {
+      const uint64_t run_length = input[in_index++];
+      const auto value = input[in_index++];
+
+      // Cells of the run before the first cell are skipped, not decoded.
+      const uint64_t skipped =
+          first_cell > cell ? std::min(first_cell - cell, run_length) : 0;
+      const uint64_t to_decode =
+          std::min<uint64_t>(run_length - skipped, output.size() - out_index);
+      std::fill_n(&output[out_index], to_decode, value);
+      out_index += to_decode;
+      cell += run_length;
     }
   }
+
+  /**
+   * Builds a skip index for RLE-compressed strings
+   *
+   * @param input Input in [run length|string_size|string] RLE format
+   * @param rle_len_size Bytesize used to store run lengths
+   * @param string_len_size Bytesize used to store string sizes
+   * @param k Number of runs between consecutive index entries
+   * @return Skip index entries, in input order
+   */
+  static std::vector<SkipEntry> build_skip_index(
+      const span<const std::byte> input,
+      const uint8_t rle_len_size,
+      const uint8_t string_len_size,
+      uint64_t k);
+
+  /**
+   * Decompress a range of cells from strings encoded in RLE format,
+   * starting mid-chunk with the help of a skip index
+   *
+   * @param input Input in [run length|string_size|string] RLE format
+   * @param rle_len_size Bytesize used to read run lengths
+   * @param string_len_size Bytesize used to read string sizes
+   * @param skip_index Skip index built with `build_skip_index`
+   * @param first_cell Index of the first cell to decode
+   * @param output Decoded output as a series of strings in contiguous
+   * memory
+   * @param output_offsets Output offsets of the decoded cells. Memory is
+   * allocated and owned by the caller
+   */
+  static void decompress(
+      const span<const std::byte> input,
+      const uint8_t rle_len_size,
+      const uint8_t string_len_size,
+      const std::vector<SkipEntry>& skip_index,
+      const uint64_t first_cell,
+      span<std::byte> output,
+      span<uint64_t> output_offsets);
 };
 }  // namespace sm
 }  // namespace tiledb
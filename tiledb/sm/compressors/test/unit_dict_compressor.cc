@@ -34,6 +34,7 @@
 
 #include "../dict_compressor.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
 #include <sstream>
@@ -430,3 +431,49 @@ TEST_CASE(
     CHECK(expected_offsets[i] == decompressed_offsets[i]);
   }
 }
+
+TEST_CASE(
+    "Compression-Dictionary: Test compression with many unique words and "
+    "table reuse across inputs",
+    "[compression][dict]") {
+  // Enough unique words to force the id table through long probe
+  // sequences, plus repeats to exercise lookups of existing entries.
+  const uint64_t num_unique = 1000;
+  std::vector<std::string> words;
+  words.reserve(num_unique);
+  for (uint64_t i = 0; i < num_unique; i++) {
+    words.emplace_back("word_" + std::to_string(i) + random_string(i % 17));
+  }
+
+  std::vector<std::string_view> uncompressed;
+  uncompressed.reserve(2 * num_unique);
+  for (uint64_t i = 0; i < num_unique; i++) {
+    uncompressed.emplace_back(words[i]);
+    uncompressed.emplace_back(words[i / 2]);
+  }
+
+  std::vector<std::byte> compressed(uncompressed.size() * sizeof(uint16_t));
+  auto dict = tiledb::sm::DictEncoding::compress<uint16_t>(
+      uncompressed, compressed);
+  REQUIRE(dict.size() == num_unique);
+  for (uint64_t i = 0; i < num_unique; i++) {
+    CHECK(dict[i] == words[i]);
+  }
+
+  // A second, different input on the same thread reuses the thread local
+  // id table; stale entries from the first input must not leak into it.
+  std::string other1 = "other_a", other2 = "other_b";
+  std::string_view uncompressed2[] = {other2, other1, other2};
+  std::vector<std::byte> compressed2(3 * sizeof(uint16_t));
+  auto dict2 = tiledb::sm::DictEncoding::compress<uint16_t>(
+      uncompressed2, compressed2);
+  REQUIRE(dict2.size() == 2);
+  CHECK(dict2[0] == other2);
+  CHECK(dict2[1] == other1);
+  std::vector<uint8_t> exp_compressed2{0, 0, 0, 1, 0, 0};
+  CHECK(
+      memcmp(
+          exp_compressed2.data(),
+          reinterpret_cast<uint8_t*>(compressed2.data()),
+          exp_compressed2.size()) == 0);
+}
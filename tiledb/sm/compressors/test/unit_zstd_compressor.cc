@@ -0,0 +1,107 @@
+/**
+ * @file   unit_zstd_compressor.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the zstd dictionary compression mode.
+ */
+
+#include <test/support/tdb_catch.h>
+
+#include "../zstd_compressor.h"
+#include "tiledb/sm/buffer/buffer.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+namespace {
+
+/** Builds a sample resembling a small tile of similar-looking records. */
+std::string make_sample(size_t seed) {
+  static const char* words[] = {
+      "sample", "sparse", "fragment", "attribute", "dimension"};
+  std::string s;
+  for (size_t i = 0; i < 16; i++) {
+    s += words[(seed + i) % std::size(words)];
+    s += std::to_string(seed * 31 + i);
+    s += ',';
+  }
+  return s;
+}
+
+}  // namespace
+
+TEST_CASE(
+    "Compression-ZStd: Test dictionary round trip", "[compression][zstd]") {
+  auto compress_ctx_pool =
+      make_shared<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>(HERE(), 1);
+  auto decompress_ctx_pool =
+      make_shared<BlockingResourcePool<ZStd::ZSTD_Decompress_Context>>(
+          HERE(), 1);
+
+  // Train a dictionary on samples that share structure with the input.
+  std::vector<std::string> sample_storage;
+  sample_storage.reserve(1000);
+  std::vector<ConstBuffer> samples;
+  samples.reserve(1000);
+  for (size_t i = 0; i < 1000; i++) {
+    sample_storage.emplace_back(make_sample(i));
+    samples.emplace_back(
+        sample_storage.back().data(), sample_storage.back().size());
+  }
+  auto dict = ZStd::train_dictionary(samples, 4096);
+  CHECK(!dict.empty());
+  CHECK(dict.size() <= 4096);
+
+  // Compress a small input with the dictionary.
+  std::string data = make_sample(4242);
+  ConstBuffer input(data.data(), data.size());
+  Buffer compressed;
+  REQUIRE(compressed.realloc(data.size() + ZStd::overhead(data.size())).ok());
+  ZStd::compress(
+      ZStd::default_level(), compress_ctx_pool, dict, &input, &compressed);
+  CHECK(compressed.size() > 0);
+
+  // The round trip through the same dictionary restores the input.
+  std::vector<char> decompressed(data.size());
+  ConstBuffer compressed_input(compressed.data(), compressed.size());
+  PreallocatedBuffer output(decompressed.data(), decompressed.size());
+  ZStd::decompress(decompress_ctx_pool, dict, &compressed_input, &output);
+  CHECK(std::memcmp(decompressed.data(), data.data(), data.size()) == 0);
+}
+
+TEST_CASE(
+    "Compression-ZStd: Test dictionary training failure",
+    "[compression][zstd]") {
+  // Training without samples cannot produce a dictionary.
+  std::vector<ConstBuffer> samples;
+  CHECK_THROWS(ZStd::train_dictionary(samples, 4096));
+}
@@ -35,6 +35,9 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/buffer/buffer.h"
 
+#include <zdict.h>
+
+#include <cstring>
 #include <iostream>
 
 using namespace tiledb::common;
@@ -86,6 +89,82 @@ void ZStd::compress(
   output_buffer->advance_offset(zstd_ret);
 }
 
+void ZStd::compress(
+    int level,
+    shared_ptr<BlockingResourcePool<ZSTD_Compress_Context>> compress_ctx_pool,
+    span<const std::byte> dict,
+    ConstBuffer* input_buffer,
+    Buffer* output_buffer) {
+  // Sanity check
+  if (input_buffer->data() == nullptr || output_buffer->data() == nullptr)
+    throw ZStdException("Failed compressing with ZStd; invalid buffer format");
+
+  if (compress_ctx_pool == nullptr) {
+    throw ZStdException(
+        "Failed compressing with ZStd; Resource pool not initialized");
+  }
+
+  ResourceGuard context_guard(*compress_ctx_pool);
+  auto& context = context_guard.get();
+
+  // Compress with the dictionary
+  uint64_t zstd_ret = ZSTD_compress_usingDict(
+      context.ptr(),
+      output_buffer->cur_data(),
+      output_buffer->free_space(),
+      input_buffer->data(),
+      input_buffer->size(),
+      dict.data(),
+      dict.size(),
+      level < level_limit_ ? ZStd::default_level() : level);
+
+  // Handle error
+  if (ZSTD_isError(zstd_ret) != 0) {
+    const char* msg = ZSTD_getErrorName(zstd_ret);
+    throw ZStdException(std::string("ZStd compression failed: ") + msg);
+  }
+
+  // Set size of compressed data
+  output_buffer->advance_size(zstd_ret);
+  output_buffer->advance_offset(zstd_ret);
+}
+
+std::vector<std::byte> ZStd::train_dictionary(
+    const std::vector<ConstBuffer>& samples, uint64_t dict_capacity) {
+  // The trainer takes the samples concatenated into a single buffer.
+  std::vector<size_t> sample_sizes;
+  sample_sizes.reserve(samples.size());
+  uint64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.emplace_back(sample.size());
+    total_size += sample.size();
+  }
+  std::vector<std::byte> sample_data(total_size);
+  uint64_t offset = 0;
+  for (const auto& sample : samples) {
+    std::memcpy(sample_data.data() + offset, sample.data(), sample.size());
+    offset += sample.size();
+  }
+
+  std::vector<std::byte> dict(dict_capacity);
+  uint64_t zstd_ret = ZDICT_trainFromBuffer(
+      dict.data(),
+      dict_capacity,
+      sample_data.data(),
+      sample_sizes.data(),
+      static_cast<unsigned>(sample_sizes.size()));
+
+  // Handle error
+  if (ZDICT_isError(zstd_ret) != 0) {
+    const char* msg = ZDICT_getErrorName(zstd_ret);
+    throw ZStdException(
+        std::string("ZStd dictionary training failed: ") + msg);
+  }
+
+  dict.resize(zstd_ret);
+  return dict;
+}
+
 void ZStd::decompress(
     shared_ptr<BlockingResourcePool<ZSTD_Decompress_Context>>
         decompress_ctx_pool,
@@ -130,6 +209,45 @@ void ZStd::decompress(
   output_buffer.advance_offset(zstd_ret);
 }
 
+void ZStd::decompress(
+    shared_ptr<BlockingResourcePool<ZSTD_Decompress_Context>>
+        decompress_ctx_pool,
+    span<const std::byte> dict,
+    ConstBuffer* input_buffer,
+    PreallocatedBuffer* output_buffer) {
+  // Sanity check
+  if (input_buffer->data() == nullptr || output_buffer->data() == nullptr)
+    throw ZStdException(
+        "Failed decompressing with ZStd; invalid buffer format");
+
+  if (decompress_ctx_pool == nullptr) {
+    throw ZStdException(
+        "Failed decompressing with ZStd; Resource pool not initialized");
+  }
+
+  ResourceGuard context_guard(*decompress_ctx_pool);
+  auto& context = context_guard.get();
+
+  // Decompress with the dictionary
+  uint64_t zstd_ret = ZSTD_decompress_usingDict(
+      context.ptr(),
+      output_buffer->cur_data(),
+      output_buffer->free_space(),
+      input_buffer->data(),
+      input_buffer->size(),
+      dict.data(),
+      dict.size());
+
+  // Check error
+  if (ZSTD_isError(zstd_ret) != 0) {
+    const char* msg = ZSTD_getErrorName(zstd_ret);
+    throw ZStdException(std::string("ZStd decompression failed: ") + msg);
+  }
+
+  // Set size decompressed data
+  output_buffer->advance_offset(zstd_ret);
+}
+
 uint64_t ZStd::overhead(uint64_t nbytes) {
   return ZSTD_compressBound(nbytes) - nbytes;
 }
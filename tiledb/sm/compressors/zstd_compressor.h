@@ -105,6 +105,36 @@ class ZStd {
    */
   static void compress(ConstBuffer* input_buffer, Buffer* output_buffer);
 
+  /**
+   * Compression function that compresses with a pre-trained dictionary.
+   *
+   * Small inputs compress poorly on their own because zstd has no history
+   * to match against; a dictionary trained on similar data seeds that
+   * history. The same dictionary bytes must be passed to `decompress`.
+   *
+   * @param level Compression level.
+   * @param compress_ctx_pool Resource pool to manage compression context reuse
+   * @param dict The dictionary to compress with.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write to the compressed data.
+   */
+  static void compress(
+      int level,
+      shared_ptr<BlockingResourcePool<ZSTD_Compress_Context>> compress_ctx_pool,
+      span<const std::byte> dict,
+      ConstBuffer* input_buffer,
+      Buffer* output_buffer);
+
+  /**
+   * Trains a dictionary from samples of the data to be compressed.
+   *
+   * @param samples Sample inputs, ideally whole representative chunks.
+   * @param dict_capacity Maximum size of the trained dictionary in bytes.
+   * @return The trained dictionary.
+   */
+  static std::vector<std::byte> train_dictionary(
+      const std::vector<ConstBuffer>& samples, uint64_t dict_capacity);
+
   /**
    * Decompression function.
    *
@@ -131,6 +161,22 @@ class ZStd {
       ConstBuffer& input_buffer,
       PreallocatedBuffer& output_buffer);
 
+  /**
+   * Decompression function for data compressed with a dictionary.
+   *
+   * @param decompress_ctx_pool Resource pool to manage decompression context
+   * reuse
+   * @param dict The dictionary the data was compressed with.
+   * @param input_buffer Input buffer to read from.
+   * @param output_buffer Output buffer to write the decompressed data to.
+   */
+  static void decompress(
+      shared_ptr<BlockingResourcePool<ZSTD_Decompress_Context>>
+          decompress_ctx_pool,
+      span<const std::byte> dict,
+      ConstBuffer* input_buffer,
+      PreallocatedBuffer* output_buffer);
+
   /** Returns the default compression level. */
   static int default_level() {
     return default_level_;
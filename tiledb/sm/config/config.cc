@@ -88,6 +88,7 @@ const std::string Config::REST_RETRY_HTTP_CODES = "503";
 const std::string Config::REST_RETRY_COUNT = "25";
 const std::string Config::REST_RETRY_INITIAL_DELAY_MS = "500";
 const std::string Config::REST_RETRY_DELAY_FACTOR = "1.25";
+const std::string Config::REST_QUERY_DEADLINE_MS = "0";
 const std::string Config::REST_CURL_BUFFER_SIZE = "524288";
 const std::string Config::REST_CAPNP_TRAVERSAL_LIMIT = "536870912";
 const std::string Config::REST_CURL_VERBOSE = "false";
@@ -97,6 +98,7 @@ const std::string Config::REST_LOAD_NON_EMPTY_DOMAIN_ON_ARRAY_OPEN = "true";
 const std::string Config::REST_USE_REFACTORED_ARRAY_OPEN = "false";
 const std::string Config::REST_USE_REFACTORED_QUERY_SUBMIT = "false";
 const std::string Config::REST_PAYER_NAMESPACE = "";
+const std::string Config::REST_PAYLOAD_BUFFER_ALIGNMENT = "0";
 const std::string Config::SM_ALLOW_SEPARATE_ATTRIBUTE_WRITES = "false";
 const std::string Config::SM_ALLOW_UPDATES_EXPERIMENTAL = "false";
 const std::string Config::SM_ENCRYPTION_KEY = "";
@@ -111,11 +113,35 @@ const std::string Config::SM_SKIP_EST_SIZE_PARTITIONING = "false";
 const std::string Config::SM_SKIP_UNARY_PARTITIONING_BUDGET_CHECK = "false";
 const std::string Config::SM_MEMORY_BUDGET = "5368709120";       // 5GB
 const std::string Config::SM_MEMORY_BUDGET_VAR = "10737418240";  // 10GB
+const std::string Config::SM_TILE_CACHE_SIZE = "10000000";          // 10MB
+const std::string Config::SM_FRAGMENT_META_CACHE_SIZE = "10000000";  // 10MB
+const std::string Config::SM_ENUMERATION_CACHE_SIZE = "50000000";    // 50MB
+const std::string Config::SM_GENERIC_TILE_CACHE_SIZE = "10000000";   // 10MB
+const std::string Config::SM_LABEL_RANGE_CACHE_SIZE = "1000000";     // 1MB
+const std::string Config::SM_QUERY_CONDITION_ADAPTIVE_ORDER = "true";
+const std::string Config::SM_BLOOM_FILTER_BITS_PER_CELL = "0";  // disabled
 const std::string Config::SM_QUERY_DENSE_QC_COORDS_MODE = "false";
+const std::string Config::SM_QUERY_DENSE_QC_COORDS_RANGES = "false";
 const std::string Config::SM_QUERY_DENSE_READER = "refactored";
 const std::string Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER = "refactored";
+const std::string Config::SM_QUERY_SPARSE_GLOBAL_ORDER_PIPELINED_UNFILTER =
+    "false";
 const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER =
     "refactored";
+const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_DEDUP = "false";
+const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_PREFETCH_TILES =
+    "0";
+const std::string Config::SM_QUERY_STREAMED_VAR_READ_MIN_TILE_SIZE = "0";
+const std::string Config::SM_QUERY_ADMISSION_MEMORY_BUDGET = "0";
+const std::string Config::SM_QUERY_ADMISSION_QUEUE_TIMEOUT_MS = "300000";
+const std::string Config::SM_QUERY_UNORDERED_WRITER_STREAMING_INGEST = "false";
+const std::string Config::SM_QUERY_ZERO_COPY_UNFILTERED_TILES = "false";
+const std::string Config::SM_QUERY_TILE_MAJOR_UNFILTER = "false";
+const std::string Config::SM_QUERY_STAGE_INCOMPLETE_TILES = "false";
+const std::string Config::SM_QUERY_GLOBAL_WRITER_CHECKPOINT_FILE =
+    "";  // disabled
+const std::string Config::SM_QUERY_GLOBAL_WRITER_RESUME = "false";
+const std::string Config::SM_TRACE_FILE = "";  // disabled
 const std::string Config::SM_MEM_MALLOC_TRIM = "true";
 const std::string Config::SM_UPPER_MEMORY_LIMIT = "1073741824";  // 1GB
 const std::string Config::SM_MEM_TOTAL_BUDGET = "10737418240";   // 10GB
@@ -136,12 +162,20 @@ const std::string Config::SM_COMPUTE_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
 const std::string Config::SM_IO_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
+const std::string Config::SM_NUMA_PINNING = "false";
 const std::string Config::SM_SKIP_CHECKSUM_VALIDATION = "false";
+const std::string Config::SM_FILTER_DICTIONARY_DECODE_TABLE_CACHE = "false";
 const std::string Config::SM_CONSOLIDATION_AMPLIFICATION = "1.0";
 const std::string Config::SM_CONSOLIDATION_BUFFER_SIZE = "50000000";
 const std::string Config::SM_CONSOLIDATION_MAX_FRAGMENT_SIZE =
     std::to_string(UINT64_MAX);
 const std::string Config::SM_CONSOLIDATION_PURGE_DELETED_CELLS = "false";
+const std::string Config::SM_CONSOLIDATION_OVERLAP_CLUSTERS = "false";
+const std::string Config::SM_CONSOLIDATION_STREAMING = "false";
+const std::string Config::SM_CONSOLIDATION_PASS_THROUGH = "false";
+const std::string Config::SM_CONSOLIDATION_MAX_CONCURRENT_NODES = "1";
+const std::string Config::SM_CONSOLIDATION_COMMITS_MANIFEST = "false";
+const std::string Config::SM_CONSOLIDATION_ARRAY_METADATA_INDEX = "false";
 const std::string Config::SM_CONSOLIDATION_STEPS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MIN_FRAGS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MAX_FRAGS = "4294967295";
@@ -157,10 +191,14 @@ const std::string Config::SM_OFFSETS_BITSIZE = "64";
 const std::string Config::SM_OFFSETS_EXTRA_ELEMENT = "false";
 const std::string Config::SM_OFFSETS_FORMAT_MODE = "bytes";
 const std::string Config::SM_MAX_TILE_OVERLAP_SIZE = "314572800";  // 300MiB
+const std::string Config::SM_EST_RESULT_SIZE_MAX_SAMPLED_TILES = "0";
 const std::string Config::SM_GROUP_TIMESTAMP_START = "0";
 const std::string Config::SM_GROUP_TIMESTAMP_END = std::to_string(UINT64_MAX);
 const std::string Config::SM_FRAGMENT_INFO_PRELOAD_MBRS = "false";
+const std::string Config::SM_FRAGMENT_INFO_LOAD_FROM_SUMMARY = "false";
+const std::string Config::SM_FRAGMENT_INFO_LAZY_LOAD = "false";
 const std::string Config::SM_PARTIAL_TILE_OFFSETS_LOADING = "false";
+const std::string Config::SM_COMPRESS_TILE_OFFSETS = "false";
 const std::string Config::SM_ENUMERATIONS_MAX_SIZE = "10485760";        // 10MiB
 const std::string Config::SM_ENUMERATIONS_MAX_TOTAL_SIZE = "52428800";  // 50MiB
 const std::string Config::SSL_CA_FILE = "";
@@ -168,13 +206,25 @@ const std::string Config::SSL_CA_PATH = "";
 const std::string Config::SSL_VERIFY = "true";
 const std::string Config::VFS_MIN_PARALLEL_SIZE = "10485760";
 const std::string Config::VFS_MAX_BATCH_SIZE = "104857600";
+const std::string Config::VFS_MAX_CONCURRENT_READS = "128";
+const std::string Config::VFS_BLOCK_CACHE_DIR = "";
+const std::string Config::VFS_BLOCK_CACHE_SIZE = "10737418240";    // 10GiB
+const std::string Config::VFS_BLOCK_CACHE_BLOCK_SIZE = "4194304";  // 4MiB
+const std::string Config::VFS_LS_CACHE_TTL_SEC = "0";  // disabled
+const std::string Config::VFS_LS_CACHE_MAX_PREFIXES = "1024";
 const std::string Config::VFS_MIN_BATCH_GAP = "512000";
 const std::string Config::VFS_MIN_BATCH_SIZE = "20971520";
 const std::string Config::VFS_FILE_POSIX_FILE_PERMISSIONS = "644";
 const std::string Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS = "755";
+const std::string Config::VFS_FILE_MMAP_READS = "false";
 const std::string Config::VFS_READ_AHEAD_SIZE = "102400";          // 100KiB
 const std::string Config::VFS_READ_AHEAD_CACHE_SIZE = "10485760";  // 10MiB;
 const std::string Config::VFS_READ_LOGGING_MODE = "";
+const std::string Config::VFS_FAULT_INJECTION_MEAN_LATENCY_MS = "0";
+const std::string Config::VFS_FAULT_INJECTION_BANDWIDTH_MBPS = "0";
+const std::string Config::VFS_FAULT_INJECTION_THROTTLE_RATE = "0";
+const std::string Config::VFS_FAULT_INJECTION_MAX_RETRIES = "5";
+const std::string Config::VFS_FAULT_INJECTION_SEED = "0";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_NAME = "";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_KEY = "";
 const std::string Config::VFS_AZURE_STORAGE_SAS_TOKEN = "";
@@ -182,6 +232,7 @@ const std::string Config::VFS_AZURE_BLOB_ENDPOINT = "";
 const std::string Config::VFS_AZURE_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
 const std::string Config::VFS_AZURE_BLOCK_LIST_BLOCK_SIZE = "5242880";
+const std::string Config::VFS_AZURE_MAX_INFLIGHT_BLOCKS = "0";
 const std::string Config::VFS_AZURE_USE_BLOCK_LIST_UPLOAD = "true";
 const std::string Config::VFS_AZURE_MAX_RETRIES = "5";
 const std::string Config::VFS_AZURE_RETRY_DELAY_MS = "800";
@@ -218,6 +269,7 @@ const std::string Config::VFS_S3_CA_PATH = "";
 const std::string Config::VFS_S3_CONNECT_TIMEOUT_MS = "10800";
 const std::string Config::VFS_S3_CONNECT_MAX_TRIES = "5";
 const std::string Config::VFS_S3_CONNECT_SCALE_FACTOR = "25";
+const std::string Config::VFS_S3_MAX_REQUEST_RATE = "0.0";
 const std::string Config::VFS_S3_SSE = "";
 const std::string Config::VFS_S3_SSE_KMS_KEY_ID = "";
 const std::string Config::VFS_S3_STORAGE_CLASS = "NOT_SET";
@@ -252,6 +304,7 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "rest.retry_initial_delay_ms", Config::REST_RETRY_INITIAL_DELAY_MS),
     std::make_pair("rest.retry_delay_factor", Config::REST_RETRY_DELAY_FACTOR),
+    std::make_pair("rest.query_deadline_ms", Config::REST_QUERY_DEADLINE_MS),
     std::make_pair("rest.curl.buffer_size", Config::REST_CURL_BUFFER_SIZE),
     std::make_pair(
         "rest.capnp_traversal_limit", Config::REST_CAPNP_TRAVERSAL_LIMIT),
@@ -272,6 +325,8 @@ const std::map<std::string, std::string> default_config_values = {
         "rest.use_refactored_array_open_and_query_submit",
         Config::REST_USE_REFACTORED_QUERY_SUBMIT),
     std::make_pair("rest.payer_namespace", Config::REST_PAYER_NAMESPACE),
+    std::make_pair(
+        "rest.payload_buffer_alignment", Config::REST_PAYLOAD_BUFFER_ALIGNMENT),
     std::make_pair(
         "config.env_var_prefix", Config::CONFIG_ENVIRONMENT_VARIABLE_PREFIX),
     std::make_pair("config.logging_level", Config::CONFIG_LOGGING_LEVEL),
@@ -299,15 +354,68 @@ const std::map<std::string, std::string> default_config_values = {
         Config::SM_SKIP_UNARY_PARTITIONING_BUDGET_CHECK),
     std::make_pair("sm.memory_budget", Config::SM_MEMORY_BUDGET),
     std::make_pair("sm.memory_budget_var", Config::SM_MEMORY_BUDGET_VAR),
+    std::make_pair("sm.tile_cache_size", Config::SM_TILE_CACHE_SIZE),
+    std::make_pair(
+        "sm.fragment_meta_cache_size", Config::SM_FRAGMENT_META_CACHE_SIZE),
+    std::make_pair(
+        "sm.enumeration_cache_size", Config::SM_ENUMERATION_CACHE_SIZE),
+    std::make_pair(
+        "sm.generic_tile_cache_size", Config::SM_GENERIC_TILE_CACHE_SIZE),
+    std::make_pair(
+        "sm.label_range_cache_size", Config::SM_LABEL_RANGE_CACHE_SIZE),
+    std::make_pair(
+        "sm.query.condition.adaptive_order",
+        Config::SM_QUERY_CONDITION_ADAPTIVE_ORDER),
+    std::make_pair(
+        "sm.query.bloom_filter_bits_per_cell",
+        Config::SM_BLOOM_FILTER_BITS_PER_CELL),
     std::make_pair(
         "sm.query.dense.qc_coords_mode", Config::SM_QUERY_DENSE_QC_COORDS_MODE),
+    std::make_pair(
+        "sm.query.dense.qc_coords_ranges",
+        Config::SM_QUERY_DENSE_QC_COORDS_RANGES),
     std::make_pair("sm.query.dense.reader", Config::SM_QUERY_DENSE_READER),
     std::make_pair(
         "sm.query.sparse_global_order.reader",
         Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER),
+    std::make_pair(
+        "sm.query.sparse_global_order.pipelined_unfilter",
+        Config::SM_QUERY_SPARSE_GLOBAL_ORDER_PIPELINED_UNFILTER),
     std::make_pair(
         "sm.query.sparse_unordered_with_dups.reader",
         Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER),
+    std::make_pair(
+        "sm.query.sparse_unordered_with_dups.dedup",
+        Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_DEDUP),
+    std::make_pair(
+        "sm.query.sparse_unordered_with_dups.prefetch_tile_count",
+        Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_PREFETCH_TILES),
+    std::make_pair(
+        "sm.query.streamed_var_read_min_tile_size",
+        Config::SM_QUERY_STREAMED_VAR_READ_MIN_TILE_SIZE),
+    std::make_pair(
+        "sm.query.admission.memory_budget",
+        Config::SM_QUERY_ADMISSION_MEMORY_BUDGET),
+    std::make_pair(
+        "sm.query.admission.queue_timeout_ms",
+        Config::SM_QUERY_ADMISSION_QUEUE_TIMEOUT_MS),
+    std::make_pair(
+        "sm.query.unordered_writer.streaming_ingest",
+        Config::SM_QUERY_UNORDERED_WRITER_STREAMING_INGEST),
+    std::make_pair(
+        "sm.query.zero_copy_unfiltered_tiles",
+        Config::SM_QUERY_ZERO_COPY_UNFILTERED_TILES),
+    std::make_pair(
+        "sm.query.tile_major_unfilter", Config::SM_QUERY_TILE_MAJOR_UNFILTER),
+    std::make_pair(
+        "sm.query.stage_incomplete_tiles",
+        Config::SM_QUERY_STAGE_INCOMPLETE_TILES),
+    std::make_pair(
+        "sm.query.global_writer.checkpoint_file",
+        Config::SM_QUERY_GLOBAL_WRITER_CHECKPOINT_FILE),
+    std::make_pair(
+        "sm.query.global_writer.resume", Config::SM_QUERY_GLOBAL_WRITER_RESUME),
+    std::make_pair("sm.trace.file", Config::SM_TRACE_FILE),
     std::make_pair("sm.mem.malloc_trim", Config::SM_MEM_MALLOC_TRIM),
     std::make_pair(
         "sm.mem.tile_upper_memory_limit", Config::SM_UPPER_MEMORY_LIMIT),
@@ -344,8 +452,12 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.compute_concurrency_level", Config::SM_COMPUTE_CONCURRENCY_LEVEL),
     std::make_pair("sm.io_concurrency_level", Config::SM_IO_CONCURRENCY_LEVEL),
+    std::make_pair("sm.numa_pinning", Config::SM_NUMA_PINNING),
     std::make_pair(
         "sm.skip_checksum_validation", Config::SM_SKIP_CHECKSUM_VALIDATION),
+    std::make_pair(
+        "sm.filter.dictionary_decode_table_cache",
+        Config::SM_FILTER_DICTIONARY_DECODE_TABLE_CACHE),
     std::make_pair(
         "sm.consolidation.amplification",
         Config::SM_CONSOLIDATION_AMPLIFICATION),
@@ -357,6 +469,22 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.consolidation.purge_deleted_cells",
         Config::SM_CONSOLIDATION_PURGE_DELETED_CELLS),
+    std::make_pair(
+        "sm.consolidation.overlap_clusters",
+        Config::SM_CONSOLIDATION_OVERLAP_CLUSTERS),
+    std::make_pair(
+        "sm.consolidation.streaming", Config::SM_CONSOLIDATION_STREAMING),
+    std::make_pair(
+        "sm.consolidation.pass_through", Config::SM_CONSOLIDATION_PASS_THROUGH),
+    std::make_pair(
+        "sm.consolidation.max_concurrent_nodes",
+        Config::SM_CONSOLIDATION_MAX_CONCURRENT_NODES),
+    std::make_pair(
+        "sm.consolidation.commits_manifest",
+        Config::SM_CONSOLIDATION_COMMITS_MANIFEST),
+    std::make_pair(
+        "sm.consolidation.array_metadata_index",
+        Config::SM_CONSOLIDATION_ARRAY_METADATA_INDEX),
     std::make_pair(
         "sm.consolidation.step_min_frags",
         Config::SM_CONSOLIDATION_STEP_MIN_FRAGS),
@@ -381,14 +509,24 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("sm.var_offsets.mode", Config::SM_OFFSETS_FORMAT_MODE),
     std::make_pair(
         "sm.max_tile_overlap_size", Config::SM_MAX_TILE_OVERLAP_SIZE),
+    std::make_pair(
+        "sm.est_result_size.max_sampled_tiles",
+        Config::SM_EST_RESULT_SIZE_MAX_SAMPLED_TILES),
     std::make_pair(
         "sm.group.timestamp_start", Config::SM_GROUP_TIMESTAMP_START),
     std::make_pair("sm.group.timestamp_end", Config::SM_GROUP_TIMESTAMP_END),
     std::make_pair(
         "sm.fragment_info.preload_mbrs", Config::SM_FRAGMENT_INFO_PRELOAD_MBRS),
+    std::make_pair(
+        "sm.fragment_info.load_from_summary",
+        Config::SM_FRAGMENT_INFO_LOAD_FROM_SUMMARY),
+    std::make_pair(
+        "sm.fragment_info.lazy_load", Config::SM_FRAGMENT_INFO_LAZY_LOAD),
     std::make_pair(
         "sm.partial_tile_offsets_loading",
         Config::SM_PARTIAL_TILE_OFFSETS_LOADING),
+    std::make_pair(
+        "sm.compress_tile_offsets", Config::SM_COMPRESS_TILE_OFFSETS),
     std::make_pair(
         "sm.enumerations_max_size", Config::SM_ENUMERATIONS_MAX_SIZE),
     std::make_pair(
@@ -399,6 +537,15 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("ssl.verify", Config::SSL_VERIFY),
     std::make_pair("vfs.min_parallel_size", Config::VFS_MIN_PARALLEL_SIZE),
     std::make_pair("vfs.max_batch_size", Config::VFS_MAX_BATCH_SIZE),
+    std::make_pair(
+        "vfs.max_concurrent_reads", Config::VFS_MAX_CONCURRENT_READS),
+    std::make_pair("vfs.block_cache.dir", Config::VFS_BLOCK_CACHE_DIR),
+    std::make_pair("vfs.block_cache.size", Config::VFS_BLOCK_CACHE_SIZE),
+    std::make_pair(
+        "vfs.block_cache.block_size", Config::VFS_BLOCK_CACHE_BLOCK_SIZE),
+    std::make_pair("vfs.ls_cache.ttl_sec", Config::VFS_LS_CACHE_TTL_SEC),
+    std::make_pair(
+        "vfs.ls_cache.max_prefixes", Config::VFS_LS_CACHE_MAX_PREFIXES),
     std::make_pair("vfs.min_batch_gap", Config::VFS_MIN_BATCH_GAP),
     std::make_pair("vfs.min_batch_size", Config::VFS_MIN_BATCH_SIZE),
     std::make_pair("vfs.read_ahead_size", Config::VFS_READ_AHEAD_SIZE),
@@ -410,7 +557,22 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "vfs.file.posix_directory_permissions",
         Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS),
+    std::make_pair("vfs.file.mmap_reads", Config::VFS_FILE_MMAP_READS),
     std::make_pair("vfs.read_logging_mode", Config::VFS_READ_LOGGING_MODE),
+    std::make_pair(
+        "vfs.fault_injection.mean_latency_ms",
+        Config::VFS_FAULT_INJECTION_MEAN_LATENCY_MS),
+    std::make_pair(
+        "vfs.fault_injection.bandwidth_mbps",
+        Config::VFS_FAULT_INJECTION_BANDWIDTH_MBPS),
+    std::make_pair(
+        "vfs.fault_injection.throttle_rate",
+        Config::VFS_FAULT_INJECTION_THROTTLE_RATE),
+    std::make_pair(
+        "vfs.fault_injection.max_retries",
+        Config::VFS_FAULT_INJECTION_MAX_RETRIES),
+    std::make_pair(
+        "vfs.fault_injection.seed", Config::VFS_FAULT_INJECTION_SEED),
     std::make_pair(
         "vfs.azure.storage_account_name",
         Config::VFS_AZURE_STORAGE_ACCOUNT_NAME),
@@ -424,6 +586,8 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "vfs.azure.block_list_block_size",
         Config::VFS_AZURE_BLOCK_LIST_BLOCK_SIZE),
+    std::make_pair(
+        "vfs.azure.max_inflight_blocks", Config::VFS_AZURE_MAX_INFLIGHT_BLOCKS),
     std::make_pair(
         "vfs.azure.use_block_list_upload",
         Config::VFS_AZURE_USE_BLOCK_LIST_UPLOAD),
@@ -483,6 +647,8 @@ const std::map<std::string, std::string> default_config_values = {
         "vfs.s3.connect_max_tries", Config::VFS_S3_CONNECT_MAX_TRIES),
     std::make_pair(
         "vfs.s3.connect_scale_factor", Config::VFS_S3_CONNECT_SCALE_FACTOR),
+    std::make_pair(
+        "vfs.s3.max_request_rate", Config::VFS_S3_MAX_REQUEST_RATE),
     std::make_pair("vfs.s3.sse", Config::VFS_S3_SSE),
     std::make_pair("vfs.s3.sse_kms_key_id", Config::VFS_S3_SSE_KMS_KEY_ID),
     std::make_pair("vfs.s3.storage_class", Config::VFS_S3_STORAGE_CLASS),
@@ -771,6 +937,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.io_concurrency_level") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.numa_pinning") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.amplification") {
     RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "sm.consolidation.buffer_size") {
@@ -779,6 +947,18 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.consolidation.purge_deleted_cells") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.overlap_clusters") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.streaming") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.pass_through") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.max_concurrent_nodes") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v32));
+  } else if (param == "sm.consolidation.commits_manifest") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.array_metadata_index") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.steps") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "sm.consolidation.step_min_frags") {
@@ -797,12 +977,22 @@ Status Config::sanity_check(
           Status_ConfigError("Invalid offsets format parameter value"));
   } else if (param == "sm.fragment_info.preload_mbrs") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.fragment_info.load_from_summary") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.fragment_info.lazy_load") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "ssl.verify") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.min_parallel_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.max_batch_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.max_concurrent_reads") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.block_cache.size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.block_cache.block_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.min_batch_gap") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.min_batch_size") {
@@ -815,6 +1005,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "vfs.file.posix_directory_permissions") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
+  } else if (param == "vfs.file.mmap_reads") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.s3.scheme") {
     if (value != "http" && value != "https")
       return LOG_STATUS(
@@ -835,6 +1027,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vint64));
   } else if (param == "vfs.s3.connect_scale_factor") {
     RETURN_NOT_OK(utils::parse::convert(value, &vint64));
+  } else if (param == "vfs.s3.max_request_rate") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "vfs.s3.request_timeout_ms") {
     RETURN_NOT_OK(utils::parse::convert(value, &vint64));
   } else if (param == "vfs.s3.requester_pays") {
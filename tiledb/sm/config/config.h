@@ -101,6 +101,12 @@ class Config {
   /** The default exponential delay factor for retrying a http request. */
   static const std::string REST_RETRY_DELAY_FACTOR;
 
+  /**
+   * The default deadline for remote read queries in milliseconds. Zero
+   * disables the deadline.
+   */
+  static const std::string REST_QUERY_DEADLINE_MS;
+
   /** The default buffer size for curl reads used by REST. */
   static const std::string REST_CURL_BUFFER_SIZE;
 
@@ -128,6 +134,12 @@ class Config {
   /** The namespace that should be charged for the request. */
   static const std::string REST_PAYER_NAMESPACE;
 
+  /**
+   * The alignment, in bytes, of the raw attribute buffer blocks in
+   * serialized query payloads. Zero keeps the legacy packed layout.
+   */
+  static const std::string REST_PAYLOAD_BUFFER_ALIGNMENT;
+
   /** The prefix to use for checking for parameter environmental variables. */
   static const std::string CONFIG_ENVIRONMENT_VARIABLE_PREFIX;
 
@@ -209,18 +221,173 @@ class Config {
    */
   static const std::string SM_MEMORY_BUDGET_VAR;
 
+  /**
+   * The maximum size (in bytes) of the context-level cache of unfiltered
+   * tiles shared by all queries. A value of 0 disables the cache.
+   */
+  static const std::string SM_TILE_CACHE_SIZE;
+
+  /**
+   * The maximum size (in bytes) of the context-level cache of consolidated
+   * fragment metadata files shared by all array opens. A value of 0
+   * disables the cache.
+   */
+  static const std::string SM_FRAGMENT_META_CACHE_SIZE;
+
+  /**
+   * The maximum size (in bytes) of the context-level cache of loaded
+   * enumerations shared by all array opens. A value of 0 disables the
+   * cache.
+   */
+  static const std::string SM_ENUMERATION_CACHE_SIZE;
+
+  /**
+   * The maximum size (in bytes) of the context-level cache of unfiltered
+   * generic tiles (schema, enumeration and metadata objects) shared by all
+   * array opens. A value of 0 disables the cache.
+   */
+  static const std::string SM_GENERIC_TILE_CACHE_SIZE;
+
+  /**
+   * The maximum size (in bytes) of the per-array cache of index ranges
+   * resolved from dimension label ranges. A value of 0 disables the cache.
+   */
+  static const std::string SM_LABEL_RANGE_CACHE_SIZE;
+
+  /**
+   * If `true`, sparse readers sample the selectivity and evaluation cost of
+   * the query condition clauses on the first tile and reorder them so that
+   * the most decisive clause per unit of cost runs first.
+   */
+  static const std::string SM_QUERY_CONDITION_ADAPTIVE_ORDER;
+
+  /**
+   * The number of bits per cell used for the per-tile bloom filters that
+   * sparse readers build for attributes with equality query conditions. A
+   * value of 0 disables the filters.
+   */
+  static const std::string SM_BLOOM_FILTER_BITS_PER_CELL;
+
   /** Set the dense reader in qc coords mode. */
   static const std::string SM_QUERY_DENSE_QC_COORDS_MODE;
 
+  /**
+   * Make qc coords mode return the matching cells as inclusive coordinate
+   * ranges instead of one coordinate per cell. Requires
+   * `sm.query.dense.qc_coords_mode`.
+   */
+  static const std::string SM_QUERY_DENSE_QC_COORDS_RANGES;
+
   /** Which reader to use for dense queries. */
   static const std::string SM_QUERY_DENSE_READER;
 
   /** Which reader to use for sparse global order queries. */
   static const std::string SM_QUERY_SPARSE_GLOBAL_ORDER_READER;
 
+  /**
+   * If `true`, the sparse global order reader pipelines tile reads and
+   * unfiltering so that unfiltering of a field starts as soon as its own
+   * bytes have landed.
+   */
+  static const std::string SM_QUERY_SPARSE_GLOBAL_ORDER_PIPELINED_UNFILTER;
+
   /** Which reader to use for sparse unordered with dups queries. */
   static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
 
+  /**
+   * If `true`, the sparse unordered with dups reader eliminates duplicate
+   * coordinates from the results, keeping the occurrence from the most
+   * recent fragment.
+   */
+  static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_DEDUP;
+
+  /**
+   * Maximum number of result tiles the sparse unordered with dups reader
+   * prefetches ahead of the tiles being processed. 0 disables prefetching.
+   */
+  static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_PREFETCH_TILES;
+
+  /**
+   * Minimum in-memory var tile size for which readers fetch only the byte
+   * ranges of the selected cells instead of the whole var tile. Only var
+   * tiles written with an empty filter pipeline and no encryption are
+   * eligible. 0 disables streamed var reads.
+   */
+  static const std::string SM_QUERY_STREAMED_VAR_READ_MIN_TILE_SIZE;
+
+  /**
+   * The maximum summed cost estimate (in bytes) of the queries admitted for
+   * concurrent processing. A query whose estimate does not fit next to the
+   * queries already running waits for them to finish before its processing
+   * starts. A value of 0 disables query admission control.
+   */
+  static const std::string SM_QUERY_ADMISSION_MEMORY_BUDGET;
+
+  /**
+   * Maximum time (in milliseconds) a query may wait for admission before its
+   * submission fails.
+   */
+  static const std::string SM_QUERY_ADMISSION_QUEUE_TIMEOUT_MS;
+
+  /**
+   * If `true`, the unordered writer accepts repeated complete buffer sets on
+   * the same query. Each batch is sorted and written as its own fragment and
+   * the accumulated fragments are merged into a single fragment in global
+   * order when the query is finalized.
+   */
+  static const std::string SM_QUERY_UNORDERED_WRITER_STREAMING_INGEST;
+
+  /**
+   * If `true`, tiles whose filter pipeline is empty are served directly from
+   * the read buffers instead of being copied into their own allocations.
+   */
+  static const std::string SM_QUERY_ZERO_COPY_UNFILTERED_TILES;
+
+  /**
+   * If `true`, readers unfilter all requested fields of one tile together on
+   * the same worker, walking the tiles in (fragment, tile index) order,
+   * instead of unfiltering field by field across all tiles. Keeps the
+   * working set of a worker within one tile to reduce last level cache
+   * thrash.
+   */
+  static const std::string SM_QUERY_TILE_MAJOR_UNFILTER;
+
+  /**
+   * If `true`, sparse readers stage the unfiltered data of result tiles
+   * that were processed but did not fit in the user buffers, so that the
+   * `submit()` call that reprocesses them only copies their cells instead
+   * of reading and unfiltering them again. The staged buffers are charged
+   * to the query memory tracker.
+   */
+  static const std::string SM_QUERY_STAGE_INCOMPLETE_TILES;
+
+  /**
+   * URI of the file where a global order write query persists its write
+   * state after every successful submission. The checkpoint records the
+   * in-progress fragment metadata together with the multipart upload
+   * state of the cloud backend (e.g. S3 upload ids and completed part
+   * etags), so that a restarted process can resume the write via
+   * `sm.query.global_writer.resume` instead of re-ingesting the data.
+   * An empty value disables checkpointing. Requires a build with
+   * serialization enabled.
+   */
+  static const std::string SM_QUERY_GLOBAL_WRITER_CHECKPOINT_FILE;
+
+  /**
+   * If `true`, a global order write query restores its write state from
+   * `sm.query.global_writer.checkpoint_file` on the first submission,
+   * resuming the in-progress fragment of a previous process instead of
+   * starting a new fragment.
+   */
+  static const std::string SM_QUERY_GLOBAL_WRITER_RESUME;
+
+  /**
+   * The path the trace of the durations reported through the stats tree
+   * is written to, in the Chrome trace event JSON format. An empty value
+   * disables tracing.
+   */
+  static const std::string SM_TRACE_FILE;
+
   /** Should malloc_trim be called on query/ctx destructors. */
   static const std::string SM_MEM_MALLOC_TRIM;
 
@@ -272,9 +439,23 @@ class Config {
   /** The maximum concurrency level for io-bound operations. */
   static const std::string SM_IO_CONCURRENCY_LEVEL;
 
+  /**
+   * If `true`, thread pool workers are partitioned across the NUMA
+   * nodes of the machine and pinned to the CPUs of their node.
+   */
+  static const std::string SM_NUMA_PINNING;
+
   /** If `true`, checksum validation will be skipped on reads. */
   static const std::string SM_SKIP_CHECKSUM_VALIDATION;
 
+  /**
+   * If `true`, decode tables for dictionary-encoded string attributes are
+   * cached and shared across all tiles that persist a byte-identical
+   * dictionary, trading a bounded amount of memory for decode CPU on
+   * low-cardinality attributes.
+   */
+  static const std::string SM_FILTER_DICTIONARY_DECODE_TABLE_CACHE;
+
   /**
    * The factor by which the size of the dense fragment resulting
    * from consolidating a set of fragments (containing at least one
@@ -295,6 +476,68 @@ class Config {
   /** Purge deleted cells or not. */
   static const std::string SM_CONSOLIDATION_PURGE_DELETED_CELLS;
 
+  /**
+   * **Experimental** <br>
+   * If `true`, fragment consolidation picks the next fragments from
+   * clusters of actually overlapping non-empty domains, leaving fragments
+   * that are disjoint from all others untouched, instead of using the
+   * size/adjacency heuristic.
+   */
+  static const std::string SM_CONSOLIDATION_OVERLAP_CLUSTERS;
+
+  /**
+   * **Experimental** <br>
+   * If `true`, fragment consolidation overlaps reads and writes by
+   * double-buffering: each batch is written on a background thread while
+   * the next one is read. The consolidation buffers budget is split
+   * between the two batches in flight, halving the batch size, so the
+   * total memory use stays within `sm.consolidation.total_budget`.
+   */
+  static const std::string SM_CONSOLIDATION_STREAMING;
+
+  /**
+   * **Experimental** <br>
+   * If `true`, fragment consolidation moves filtered tiles verbatim into
+   * the new fragment when the selected fragments transfer intact (sparse
+   * 1D array allowing duplicates, disjoint non-empty domains, same
+   * format version, full tiles), instead of decompressing and
+   * recompressing all data. The pass-through fragment carries no
+   * per-cell timestamps, so cells take the consolidated fragment's
+   * timestamp range, as with consolidation without timestamps. Steps
+   * whose fragments do not qualify fall back to the rewriting path.
+   */
+  static const std::string SM_CONSOLIDATION_PASS_THROUGH;
+
+  /**
+   * **Experimental** <br>
+   * The maximum number of disjoint overlap clusters that fragment
+   * consolidation executes concurrently in a single step, each with its
+   * own reader/writer pair and an equal share of the total memory
+   * budget. Only effective together with
+   * `sm.consolidation.overlap_clusters`; a value of 1 keeps the steps
+   * serial.
+   */
+  static const std::string SM_CONSOLIDATION_MAX_CONCURRENT_NODES;
+
+  /**
+   * **Experimental** <br>
+   * If `true`, commits consolidation writes a compact binary manifest
+   * (sorted records with delta-encoded timestamps) instead of the text
+   * format. Manifests are smaller and cheaper to parse on array open,
+   * but arrays consolidated this way require a library version that can
+   * read them.
+   */
+  static const std::string SM_CONSOLIDATION_COMMITS_MANIFEST;
+
+  /**
+   * **Experimental** <br>
+   * If `true`, array metadata consolidation appends a sorted key index
+   * to the consolidated metadata, so that readers can look up a single
+   * key without deserializing all of the metadata. Arrays consolidated
+   * this way require a library version that can read the index.
+   */
+  static const std::string SM_CONSOLIDATION_ARRAY_METADATA_INDEX;
+
   /** Number of steps in the consolidation algorithm. */
   static const std::string SM_CONSOLIDATION_STEPS;
 
@@ -374,6 +617,16 @@ class Config {
    */
   static const std::string SM_MAX_TILE_OVERLAP_SIZE;
 
+  /**
+   * The maximum number of tiles sampled per fully-overlapping tile range
+   * when estimating result sizes. When non-zero, long runs of fully
+   * overlapping tiles are estimated from a subset of evenly spaced tiles
+   * and extrapolated with an upper confidence bound, instead of
+   * inspecting the metadata of every overlapping tile. `0` means exact
+   * estimation.
+   */
+  static const std::string SM_EST_RESULT_SIZE_MAX_SAMPLED_TILES;
+
   /**
    * A group will open between this value and timestamp_end.
    */
@@ -391,9 +644,37 @@ class Config {
    */
   static const std::string SM_FRAGMENT_INFO_PRELOAD_MBRS;
 
+  /**
+   * **Experimental** <br>
+   * If `true`, fragment info will be served from the compact summary in the
+   * consolidated fragment metadata when the summary covers all fragments,
+   * without loading any per-fragment metadata. Fragment info APIs that
+   * require full metadata (e.g. MBRs) are not available in this mode.
+   */
+  static const std::string SM_FRAGMENT_INFO_LOAD_FROM_SUMMARY;
+
+  /**
+   * **Experimental** <br>
+   * If `true`, fragment info load only reads the array schemas and the
+   * directory listing; the per-fragment metadata is loaded in one
+   * parallel batch the first time an accessor needs it. Fragment counts,
+   * URIs and timestamp ranges are served from the listing alone. Ignored
+   * when MBR preloading is enabled.
+   */
+  static const std::string SM_FRAGMENT_INFO_LAZY_LOAD;
+
   /** If `true` the readers might partially load/unload tile offsets. */
   static const std::string SM_PARTIAL_TILE_OFFSETS_LOADING;
 
+  /**
+   * **Experimental** <br>
+   * If `true`, tile offsets are kept in memory in a compressed
+   * (base + bit-packed delta) form, trading a small decode cost on access
+   * for a several-fold reduction in metadata memory on arrays with many
+   * fragments or attributes.
+   */
+  static const std::string SM_COMPRESS_TILE_OFFSETS;
+
   /** The maximum size of a single enumeration. */
   static const std::string SM_ENUMERATIONS_MAX_SIZE;
 
@@ -415,6 +696,33 @@ class Config {
   /** The default maximum number of bytes in a batched VFS read operation. */
   static const std::string VFS_MAX_BATCH_SIZE;
 
+  /**
+   * The default maximum number of in-flight read operations per object-store
+   * bucket.
+   */
+  static const std::string VFS_MAX_CONCURRENT_READS;
+
+  /**
+   * The local directory of the VFS on-disk block cache. An empty value
+   * disables the cache.
+   */
+  static const std::string VFS_BLOCK_CACHE_DIR;
+
+  /** The byte budget of the VFS on-disk block cache. */
+  static const std::string VFS_BLOCK_CACHE_SIZE;
+
+  /** The block size (in bytes) of the VFS on-disk block cache. */
+  static const std::string VFS_BLOCK_CACHE_BLOCK_SIZE;
+
+  /**
+   * The number of seconds a cached prefix listing stays valid in the VFS
+   * listing cache. A value of 0 disables the cache.
+   */
+  static const std::string VFS_LS_CACHE_TTL_SEC;
+
+  /** The maximum number of prefix listings in the VFS listing cache. */
+  static const std::string VFS_LS_CACHE_MAX_PREFIXES;
+
   /**
    * The default minimum number of bytes between two VFS read batches.
    */
@@ -429,6 +737,9 @@ class Config {
   /** The default posix permissions for directory creations */
   static const std::string VFS_FILE_POSIX_DIRECTORY_PERMISSIONS;
 
+  /** Whether to serve local file reads from memory mappings (POSIX only). */
+  static const std::string VFS_FILE_MMAP_READS;
+
   /** The maximum size (in bytes) to read-ahead in the VFS. */
   static const std::string VFS_READ_AHEAD_SIZE;
 
@@ -438,6 +749,33 @@ class Config {
   /** The type of read logging to perform in the VFS. */
   static const std::string VFS_READ_LOGGING_MODE;
 
+  /**
+   * The mean of the per-op latency (in milliseconds) injected into
+   * in-memory filesystem operations. A value of 0 injects no latency.
+   */
+  static const std::string VFS_FAULT_INJECTION_MEAN_LATENCY_MS;
+
+  /**
+   * The bandwidth cap (in MB/s) injected into in-memory filesystem data
+   * transfers. A value of 0 leaves the bandwidth uncapped.
+   */
+  static const std::string VFS_FAULT_INJECTION_BANDWIDTH_MBPS;
+
+  /**
+   * The probability that an in-memory filesystem operation attempt gets
+   * an injected throttling error. A value of 0 injects no errors.
+   */
+  static const std::string VFS_FAULT_INJECTION_THROTTLE_RATE;
+
+  /**
+   * The number of attempts before an injected throttling error surfaces
+   * instead of backing off.
+   */
+  static const std::string VFS_FAULT_INJECTION_MAX_RETRIES;
+
+  /** The seed of the fault injection generator. */
+  static const std::string VFS_FAULT_INJECTION_SEED;
+
   /** Azure storage account name. */
   static const std::string VFS_AZURE_STORAGE_ACCOUNT_NAME;
 
@@ -456,6 +794,9 @@ class Config {
   /** Azure block list block size. */
   static const std::string VFS_AZURE_BLOCK_LIST_BLOCK_SIZE;
 
+  /** Azure max pipelined in-flight block uploads per blob. */
+  static const std::string VFS_AZURE_MAX_INFLIGHT_BLOCKS;
+
   /** Azure use block list upload. */
   static const std::string VFS_AZURE_USE_BLOCK_LIST_UPLOAD;
 
@@ -558,6 +899,15 @@ class Config {
   /** Connect scale factor for exponential backoff. */
   static const std::string VFS_S3_CONNECT_SCALE_FACTOR;
 
+  /**
+   * **Experimental** <br>
+   * The maximum aggregate S3 request rate of the process in requests
+   * per second, shared across all contexts. The rate halves on
+   * 'SLOW_DOWN' responses and recovers gradually toward the configured
+   * value. 0 disables request pacing.
+   */
+  static const std::string VFS_S3_MAX_REQUEST_RATE;
+
   /** S3 server-side encryption algorithm. */
   static const std::string VFS_S3_SSE;
 
@@ -0,0 +1,59 @@
+/**
+ * @file   query_config.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class QueryConfig.
+ */
+
+#include "tiledb/sm/config/query_config.h"
+#include "tiledb/sm/config/config.h"
+
+namespace tiledb {
+namespace sm {
+
+QueryConfig::QueryConfig(const Config& config)
+    : var_offsets_mode_(
+          config.get<std::string>("sm.var_offsets.mode", Config::must_find))
+    , var_offsets_extra_element_(config.get<bool>(
+          "sm.var_offsets.extra_element", Config::must_find))
+    , var_offsets_bitsize_(
+          config.get<uint32_t>("sm.var_offsets.bitsize", Config::must_find))
+    , allow_separate_attribute_writes_(config.get<bool>(
+          "sm.allow_separate_attribute_writes", Config::must_find))
+    , check_coord_dups_(
+          config.get<bool>("sm.check_coord_dups", Config::must_find))
+    , check_coord_oob_(
+          config.get<bool>("sm.check_coord_oob", Config::must_find))
+    , check_global_order_(
+          config.get<bool>("sm.check_global_order", Config::must_find))
+    , dedup_coords_(config.get<bool>("sm.dedup_coords", Config::must_find))
+    , malloc_trim_(config.get<bool>("sm.mem.malloc_trim", Config::must_find)) {
+}
+
+}  // namespace sm
+}  // namespace tiledb
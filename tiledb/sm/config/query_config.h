@@ -0,0 +1,162 @@
+/**
+ * @file   query_config.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class QueryConfig.
+ */
+
+#ifndef TILEDB_QUERY_CONFIG_H
+#define TILEDB_QUERY_CONFIG_H
+
+#include <cstdint>
+#include <string>
+
+namespace tiledb {
+namespace sm {
+
+class Config;
+
+/**
+ * A frozen, typed snapshot of the config parameters consulted on query hot
+ * paths.
+ *
+ * `Config::get` performs a string-keyed map lookup and parses the stored
+ * value on every call. That is fine for one-time setup but shows up in
+ * profiles when consulted per operation, e.g. the offsets-mode checks done
+ * on every buffer set. A `QueryConfig` parses those parameters once, at
+ * construction, so hot paths read plain typed fields instead.
+ *
+ * The snapshot is intentionally frozen: it is rebuilt whenever the query
+ * config changes (see `Query::set_config`) and never observes later
+ * mutations of the `Config` it was built from.
+ */
+class QueryConfig {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Default constructor is deleted. */
+  QueryConfig() = delete;
+
+  /**
+   * Constructor. Parses all snapshot parameters from the given config.
+   *
+   * @param config The config to snapshot.
+   */
+  explicit QueryConfig(const Config& config);
+
+  /** Destructor. */
+  ~QueryConfig() = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the value of `sm.var_offsets.mode`. */
+  inline const std::string& var_offsets_mode() const {
+    return var_offsets_mode_;
+  }
+
+  /** Returns the value of `sm.var_offsets.extra_element`. */
+  inline bool var_offsets_extra_element() const {
+    return var_offsets_extra_element_;
+  }
+
+  /** Returns the value of `sm.var_offsets.bitsize`. */
+  inline uint32_t var_offsets_bitsize() const {
+    return var_offsets_bitsize_;
+  }
+
+  /** Returns the value of `sm.allow_separate_attribute_writes`. */
+  inline bool allow_separate_attribute_writes() const {
+    return allow_separate_attribute_writes_;
+  }
+
+  /** Returns the value of `sm.check_coord_dups`. */
+  inline bool check_coord_dups() const {
+    return check_coord_dups_;
+  }
+
+  /** Returns the value of `sm.check_coord_oob`. */
+  inline bool check_coord_oob() const {
+    return check_coord_oob_;
+  }
+
+  /** Returns the value of `sm.check_global_order`. */
+  inline bool check_global_order() const {
+    return check_global_order_;
+  }
+
+  /** Returns the value of `sm.dedup_coords`. */
+  inline bool dedup_coords() const {
+    return dedup_coords_;
+  }
+
+  /** Returns the value of `sm.mem.malloc_trim`. */
+  inline bool malloc_trim() const {
+    return malloc_trim_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The value of `sm.var_offsets.mode`. */
+  std::string var_offsets_mode_;
+
+  /** The value of `sm.var_offsets.extra_element`. */
+  bool var_offsets_extra_element_;
+
+  /** The value of `sm.var_offsets.bitsize`. */
+  uint32_t var_offsets_bitsize_;
+
+  /** The value of `sm.allow_separate_attribute_writes`. */
+  bool allow_separate_attribute_writes_;
+
+  /** The value of `sm.check_coord_dups`. */
+  bool check_coord_dups_;
+
+  /** The value of `sm.check_coord_oob`. */
+  bool check_coord_oob_;
+
+  /** The value of `sm.check_global_order`. */
+  bool check_global_order_;
+
+  /** The value of `sm.dedup_coords`. */
+  bool dedup_coords_;
+
+  /** The value of `sm.mem.malloc_trim`. */
+  bool malloc_trim_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_CONFIG_H
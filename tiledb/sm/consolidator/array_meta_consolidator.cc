@@ -90,6 +90,7 @@ Status ArrayMetaConsolidator::consolidate(
   // Copy-assign the read metadata into the metadata of the array for writes
   auto& metadata_r = array_for_reads.metadata();
   array_for_writes.opened_array()->metadata() = metadata_r;
+  array_for_writes.opened_array()->metadata().set_store_index(write_index_);
   URI new_uri = metadata_r.get_uri(array_uri);
   const auto& to_vacuum = metadata_r.loaded_metadata_uris();
 
@@ -152,6 +153,9 @@ Status ArrayMetaConsolidator::set_config(const Config& config) {
   throw_if_not_ok(merged_config.get<uint64_t>(
       "sm.consolidation.timestamp_end", &config_.timestamp_end_, &found));
   assert(found);
+  throw_if_not_ok(merged_config.get<bool>(
+      "sm.consolidation.array_metadata_index", &write_index_, &found));
+  assert(found);
 
   return Status::Ok();
 }
@@ -118,6 +118,10 @@ class ArrayMetaConsolidator : public Consolidator {
 
   /** Consolidation configuration parameters. */
   Consolidator::ConsolidationConfigBase config_;
+
+  /** If `true`, a sorted key index is appended to the consolidated
+   * metadata. */
+  bool write_index_ = false;
 };
 
 }  // namespace tiledb::sm
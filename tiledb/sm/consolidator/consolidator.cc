@@ -262,6 +262,24 @@ void Consolidator::write_consolidated_commits_file(
   // Compute the file name.
   auto name = storage_format::generate_consolidated_fragment_name(
       commit_uris.front(), commit_uris.back(), write_version);
+  URI consolidated_commits_uri =
+      array_dir.get_commits_dir(write_version)
+          .join_path(name + constants::con_commits_file_suffix);
+
+  // Write the compact binary manifest format if requested. Arrays
+  // consolidated this way require a library version that can read it.
+  bool manifest = false, found = false;
+  throw_if_not_ok(resources.config().get<bool>(
+      "sm.consolidation.commits_manifest", &manifest, &found));
+  assert(found);
+  if (manifest) {
+    auto data = ArrayDirectory::serialize_commits_manifest(
+        array_dir.uri(), commit_uris, resources);
+    throw_if_not_ok(resources.vfs().write(
+        consolidated_commits_uri, data.data(), data.size()));
+    throw_if_not_ok(resources.vfs().close_file(consolidated_commits_uri));
+    return;
+  }
 
   // Compute size of consolidated file. Save the sizes of the files to re-use
   // below.
@@ -304,9 +322,6 @@ void Consolidator::write_consolidated_commits_file(
   }
 
   // Write the file to storage.
-  URI consolidated_commits_uri =
-      array_dir.get_commits_dir(write_version)
-          .join_path(name + constants::con_commits_file_suffix);
   throw_if_not_ok(resources.vfs().write(
       consolidated_commits_uri, data.data(), data.size()));
   throw_if_not_ok(resources.vfs().close_file(consolidated_commits_uri));
@@ -37,12 +37,16 @@
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/fragment/fragment_identifier.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/storage_format/uri/generate_uri.h"
+#include "tiledb/type/apply_with_type.h"
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 #include <sstream>
@@ -234,6 +238,16 @@ Status FragmentConsolidator::consolidate(
   // to compute the anterior ND range that can help determine
   // which dense fragments are consolidatable.
   FragmentInfo fragment_info(URI(array_name), resources_);
+
+  // Consolidation planning needs only summary-level information per
+  // fragment, so serve it from the consolidated fragment metadata
+  // summaries when they cover all fragments, instead of loading each
+  // fragment's metadata footer.
+  Config summary_config;
+  throw_if_not_ok(
+      summary_config.set("sm.fragment_info.load_from_summary", "true"));
+  fragment_info.set_config(summary_config);
+
   auto st = fragment_info.load(
       array_for_reads->array_directory(),
       config_.timestamp_start_,
@@ -256,6 +270,31 @@ Status FragmentConsolidator::consolidate(
     if (fragment_info.fragment_num() <= 1)
       break;
 
+    // When the overlap cluster planner may run multiple nodes, first try
+    // to consolidate a batch of disjoint clusters concurrently. Each
+    // executed node counts as a step. If fewer than two clusters are
+    // eligible, fall through to the serial path below.
+    if (config_.overlap_clusters_ && config_.max_concurrent_nodes_ > 1) {
+      uint32_t nodes_done = 0;
+      st = consolidate_clusters_in_parallel(
+          array_for_reads,
+          encryption_type,
+          encryption_key,
+          key_length,
+          fragment_info,
+          std::min(config_.max_concurrent_nodes_, config_.steps_ - step),
+          &nodes_done);
+      if (!st.ok()) {
+        throw_if_not_ok(array_for_reads->close());
+        throw_if_not_ok(array_for_writes->close());
+        return st;
+      }
+      if (nodes_done > 0) {
+        step += nodes_done;
+        continue;
+      }
+    }
+
     // Find the next fragments to be consolidated
     NDRange union_non_empty_domains;
     st = compute_next_to_consolidate(
@@ -282,7 +321,8 @@ Status FragmentConsolidator::consolidate(
         to_consolidate,
         union_non_empty_domains,
         &new_fragment_uri,
-        cw);
+        cw,
+        config_);
     if (!st.ok()) {
       throw_if_not_ok(array_for_reads->close());
       throw_if_not_ok(array_for_writes->close());
@@ -343,8 +383,14 @@ Status FragmentConsolidator::consolidate_fragments(
     return Status::Ok();
   }
 
-  // Get all fragment info
+  // Get all fragment info. The explicit fragment list only needs
+  // summary-level information, so serve it from the consolidated
+  // fragment metadata summaries when they cover all fragments.
   FragmentInfo fragment_info(URI(array_name), resources_);
+  Config summary_config;
+  throw_if_not_ok(
+      summary_config.set("sm.fragment_info.load_from_summary", "true"));
+  fragment_info.set_config(summary_config);
   auto st = fragment_info.load(
       array_for_reads->array_directory(),
       0,
@@ -417,7 +463,8 @@ Status FragmentConsolidator::consolidate_fragments(
       to_consolidate,
       union_non_empty_domains,
       &new_fragment_uri,
-      cw);
+      cw,
+      config_);
   if (!st.ok()) {
     throw_if_not_ok(array_for_reads->close());
     throw_if_not_ok(array_for_writes->close());
@@ -468,15 +515,15 @@ void FragmentConsolidator::vacuum(const char* array_name) {
   // Delete fragment directories
   auto& vfs = resources_.vfs();
   auto& compute_tp = resources_.compute_tp();
+  std::vector<uint8_t> commit_is_file(fragment_uris_to_vacuum.size());
+  std::vector<URI> commit_uris(fragment_uris_to_vacuum.size());
   throw_if_not_ok(parallel_for(
       &compute_tp, 0, fragment_uris_to_vacuum.size(), [&](size_t i) {
-        // Remove the commit file, if present.
-        auto commit_uri = array_dir.get_commit_uri(fragment_uris_to_vacuum[i]);
+        // Check for a commit file to remove below.
+        commit_uris[i] = array_dir.get_commit_uri(fragment_uris_to_vacuum[i]);
         bool is_file = false;
-        throw_if_not_ok(vfs.is_file(commit_uri, &is_file));
-        if (is_file) {
-          throw_if_not_ok(vfs.remove_file(commit_uri));
-        }
+        throw_if_not_ok(vfs.is_file(commit_uris[i], &is_file));
+        commit_is_file[i] = is_file;
 
         bool is_dir = false;
         throw_if_not_ok(vfs.is_dir(fragment_uris_to_vacuum[i], &is_dir));
@@ -487,6 +534,15 @@ void FragmentConsolidator::vacuum(const char* array_name) {
         return Status::Ok();
       }));
 
+  // Delete the commit files that are present, batching the deletions.
+  std::vector<URI> commit_uris_to_remove;
+  for (uint64_t i = 0; i < commit_uris.size(); i++) {
+    if (commit_is_file[i]) {
+      commit_uris_to_remove.emplace_back(commit_uris[i]);
+    }
+  }
+  vfs.remove_files(&compute_tp, commit_uris_to_remove);
+
   // Delete the vacuum files.
   vfs.remove_files(
       &compute_tp, filtered_fragment_uris.fragment_vac_uris_to_vacuum());
@@ -531,7 +587,8 @@ Status FragmentConsolidator::consolidate_internal(
     const std::vector<TimestampedURI>& to_consolidate,
     const NDRange& union_non_empty_domains,
     URI* new_fragment_uri,
-    FragmentConsolidationWorkspace& cw) {
+    FragmentConsolidationWorkspace& cw,
+    FragmentConsolidationConfig cfg) {
   auto timer_se = stats_->start_timer("consolidate_internal");
 
   array_for_reads->load_fragments(to_consolidate);
@@ -546,7 +603,7 @@ Status FragmentConsolidator::consolidate_internal(
   // If there are any delete conditions coming after the first fragment or if
   // there are any fragments with delete meta, the new fragment will include
   // delete meta.
-  if (!config_.purge_deleted_cells_ &&
+  if (!cfg.purge_deleted_cells_ &&
       array_schema.write_version() >= constants::deletes_min_version) {
     // Get the first fragment first timestamp.
     FragmentID fragment_id{to_consolidate[0].uri_};
@@ -556,33 +613,49 @@ Status FragmentConsolidator::consolidate_internal(
          array_for_reads->array_directory()
              .delete_and_update_tiles_location()) {
       if (delete_and_update_tile_location.timestamp() >= timestamps.first) {
-        config_.with_delete_meta_ = true;
+        cfg.with_delete_meta_ = true;
         break;
       }
     }
 
-    if (!config_.with_delete_meta_) {
+    if (!cfg.with_delete_meta_) {
       for (auto& frag_md : array_for_reads->fragment_metadata()) {
         if (frag_md->has_delete_meta()) {
-          config_.with_delete_meta_ = true;
+          cfg.with_delete_meta_ = true;
           break;
         }
       }
     }
   }
 
+  // Move the filtered tiles verbatim into the new fragment when the
+  // selected fragments transfer intact, avoiding the decompression and
+  // recompression of their data.
+  if (cfg.pass_through_) {
+    std::vector<size_t> order;
+    if (can_pass_through(array_for_reads, cfg, &order)) {
+      return consolidate_pass_through(
+          array_for_reads, to_consolidate, order, new_fragment_uri);
+    }
+  }
+
   // Compute memory budgets
   uint64_t total_weights =
-      config_.buffers_weight_ + config_.reader_weight_ + config_.writer_weight_;
-  uint64_t single_unit_budget = config_.total_budget_ / total_weights;
-  uint64_t buffers_budget = config_.buffers_weight_ * single_unit_budget;
-  uint64_t reader_budget = config_.reader_weight_ * single_unit_budget;
-  uint64_t writer_budget = config_.writer_weight_ * single_unit_budget;
-
-  // Prepare buffers
+      cfg.buffers_weight_ + cfg.reader_weight_ + cfg.writer_weight_;
+  uint64_t single_unit_budget = cfg.total_budget_ / total_weights;
+  uint64_t buffers_budget = cfg.buffers_weight_ * single_unit_budget;
+  uint64_t reader_budget = cfg.reader_weight_ * single_unit_budget;
+  uint64_t writer_budget = cfg.writer_weight_ * single_unit_budget;
+
+  // Prepare buffers. Streaming consolidation ping-pongs between two
+  // workspaces, so each gets half the budget to keep the total within
+  // `sm.consolidation.total_budget`.
   auto average_var_cell_sizes = array_for_reads->get_average_var_cell_sizes();
+  if (cfg.streaming_) {
+    buffers_budget /= 2;
+  }
   cw.resize_buffers(
-      stats_, config_, array_schema, average_var_cell_sizes, buffers_budget);
+      stats_, cfg, array_schema, average_var_cell_sizes, buffers_budget);
 
   // Create queries
   tdb_unique_ptr<Query> query_r = nullptr;
@@ -595,7 +668,8 @@ Status FragmentConsolidator::consolidate_internal(
       query_w,
       new_fragment_uri,
       reader_budget,
-      writer_budget));
+      writer_budget,
+      cfg));
 
   // Get the vacuum URI
   URI vac_uri;
@@ -608,7 +682,14 @@ Status FragmentConsolidator::consolidate_internal(
   }
 
   // Read from one array and write to the other
-  copy_array(query_r.get(), query_w.get(), cw);
+  if (cfg.streaming_) {
+    FragmentConsolidationWorkspace cw_b(consolidator_memory_tracker_);
+    cw_b.resize_buffers(
+        stats_, cfg, array_schema, average_var_cell_sizes, buffers_budget);
+    copy_array_pipelined(query_r.get(), query_w.get(), cw, cw_b, cfg);
+  } else {
+    copy_array(query_r.get(), query_w.get(), cw, cfg);
+  }
 
   // Finalize write query
   auto st = query_w->finalize();
@@ -637,15 +718,485 @@ Status FragmentConsolidator::consolidate_internal(
   return st;
 }
 
+Status FragmentConsolidator::consolidate_clusters_in_parallel(
+    shared_ptr<Array> array_for_reads,
+    EncryptionType encryption_type,
+    const void* encryption_key,
+    uint32_t key_length,
+    FragmentInfo& fragment_info,
+    uint32_t max_nodes,
+    uint32_t* nodes_done) {
+  auto timer_se = stats_->start_timer("consolidate_parallel_nodes");
+  *nodes_done = 0;
+
+  // Plan as many disjoint clusters as nodes may run.
+  std::vector<std::vector<TimestampedURI>> to_consolidate;
+  std::vector<NDRange> union_non_empty_domains;
+  RETURN_NOT_OK(compute_overlap_clusters(
+      array_for_reads->array_schema_latest(),
+      fragment_info,
+      max_nodes,
+      &to_consolidate,
+      &union_non_empty_domains));
+
+  // With fewer than two eligible clusters, leave the work to the
+  // serial path.
+  auto node_num = to_consolidate.size();
+  if (node_num < 2) {
+    return Status::Ok();
+  }
+
+  // Every node gets an equal share of the total memory budget. The
+  // nodes work on config copies, so that the per-step delete-metadata
+  // decision of one node cannot leak into another.
+  auto node_config = config_;
+  node_config.total_budget_ = config_.total_budget_ / node_num;
+
+  // Run every node on its own pair of opened arrays; `load_fragments`
+  // replaces the fragment metadata of the array it is called on, so
+  // concurrent nodes cannot share the caller's.
+  std::vector<URI> new_fragment_uris(node_num);
+  std::vector<ThreadPool::Task> tasks;
+  tasks.reserve(node_num);
+  for (size_t n = 0; n < node_num; n++) {
+    tasks.emplace_back(resources_.compute_tp().execute([&, n]() {
+      auto reads{
+          make_shared<Array>(HERE(), resources_, array_for_reads->array_uri())};
+      RETURN_NOT_OK(reads->open_without_fragments(
+          encryption_type, encryption_key, key_length));
+      auto writes{make_shared<Array>(HERE(), resources_, reads->array_uri())};
+      RETURN_NOT_OK_ELSE(
+          writes->open(
+              QueryType::WRITE, encryption_type, encryption_key, key_length),
+          throw_if_not_ok(reads->close()));
+
+      Status st;
+      try {
+        FragmentConsolidationWorkspace cw(consolidator_memory_tracker_);
+        st = consolidate_internal(
+            reads,
+            writes,
+            to_consolidate[n],
+            union_non_empty_domains[n],
+            &new_fragment_uris[n],
+            cw,
+            node_config);
+      } catch (const std::exception& e) {
+        st = Status_ConsolidatorError(e.what());
+      }
+      auto st_r = reads->close();
+      auto st_w = writes->close();
+      RETURN_NOT_OK(st);
+      RETURN_NOT_OK(st_r);
+      return st_w;
+    }));
+  }
+  RETURN_NOT_OK(resources_.compute_tp().wait_all(tasks));
+
+  // Load the info of each consolidated fragment and add it to the
+  // fragment info, replacing the fragments that its node consolidated.
+  for (size_t n = 0; n < node_num; n++) {
+    RETURN_NOT_OK(fragment_info.load_and_replace(
+        new_fragment_uris[n], to_consolidate[n]));
+  }
+
+  *nodes_done = (uint32_t)node_num;
+
+  return Status::Ok();
+}
+
+bool FragmentConsolidator::can_pass_through(
+    shared_ptr<Array> array_for_reads,
+    const FragmentConsolidationConfig& cfg,
+    std::vector<size_t>* order) const {
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  const auto& fragments = array_for_reads->fragment_metadata();
+
+  // Delete metadata requires rewriting cells, and so does purging
+  // deleted cells when any delete condition exists.
+  if (cfg.with_delete_meta_) {
+    return false;
+  }
+  if (cfg.purge_deleted_cells_ && !array_for_reads->array_directory()
+                                       .delete_and_update_tiles_location()
+                                       .empty()) {
+    return false;
+  }
+
+  // Without rewriting, duplicate coordinates across the source
+  // fragments cannot be deduplicated.
+  if (array_schema.dense() || !array_schema.allows_dups()) {
+    return false;
+  }
+
+  // Whole-fragment global ordering is only cheap to prove in 1D, where
+  // the global order is the coordinate order.
+  if (array_schema.dim_num() != 1) {
+    return false;
+  }
+  auto dim{array_schema.domain().dimension_ptr(0)};
+  auto dim_type = dim->type();
+  if (dim->var_size() ||
+      (!datatype_is_integer(dim_type) && !datatype_is_real(dim_type) &&
+       !datatype_is_datetime(dim_type) && !datatype_is_time(dim_type))) {
+    return false;
+  }
+
+  // The source tiles transfer intact only from sparse fragments at the
+  // latest format version, written with the latest schema and without
+  // timestamps or delete metadata.
+  const auto write_version = array_schema.write_version();
+  for (const auto& frag : fragments) {
+    if (frag->dense() || frag->format_version() != write_version ||
+        frag->has_timestamps() || frag->has_delete_meta() ||
+        frag->array_schema_name() != array_schema.name()) {
+      return false;
+    }
+  }
+
+  // The tile min/max metadata of var-sized attributes cannot be
+  // transferred to the new fragment yet.
+  for (const auto& attr : array_schema.attributes()) {
+    if (attr->var_size() &&
+        TileMetadataGenerator::has_min_max_metadata(
+            attr->type(), false, true, attr->cell_val_num())) {
+      return false;
+    }
+  }
+
+  // Order the fragments by their non-empty domains and make sure those
+  // are pairwise disjoint, so that no overlap resolution is needed and
+  // concatenating the fragments keeps the cells in global order.
+  auto fragment_num = fragments.size();
+  order->resize(fragment_num);
+  std::iota(order->begin(), order->end(), 0);
+  bool disjoint = false;
+  type::apply_with_type(
+      [&](auto v) {
+        using T = decltype(v);
+        if constexpr (type::TileDBNumeric<T>) {
+          auto start = [&](size_t f) {
+            return *static_cast<const T*>(
+                fragments[f]->non_empty_domain()[0].start_fixed());
+          };
+          auto end = [&](size_t f) {
+            return *static_cast<const T*>(
+                fragments[f]->non_empty_domain()[0].end_fixed());
+          };
+          std::sort(order->begin(), order->end(), [&](size_t a, size_t b) {
+            return start(a) < start(b);
+          });
+          disjoint = true;
+          for (size_t i = 1; i < fragment_num; i++) {
+            if (!(end((*order)[i - 1]) < start((*order)[i]))) {
+              disjoint = false;
+              break;
+            }
+          }
+        }
+      },
+      dim_type);
+  if (!disjoint) {
+    return false;
+  }
+
+  // The tiles move verbatim, so every source tile except the last one
+  // of the last fragment must hold exactly the schema capacity, for
+  // the new fragment's per-tile cell counts to stay correct.
+  for (size_t i = 0; i < fragment_num - 1; i++) {
+    if (fragments[(*order)[i]]->last_tile_cell_num() !=
+        array_schema.capacity()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Status FragmentConsolidator::consolidate_pass_through(
+    shared_ptr<Array> array_for_reads,
+    const std::vector<TimestampedURI>& to_consolidate,
+    const std::vector<size_t>& order,
+    URI* new_fragment_uri) {
+  auto timer_se = stats_->start_timer("consolidate_pass_through");
+
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  auto& fragments = array_for_reads->fragment_metadata();
+  const auto& encryption_key = array_for_reads->get_encryption_key();
+  const auto write_version = array_schema.write_version();
+  auto& array_dir = array_for_reads->array_directory();
+  auto& domain{array_schema.domain()};
+  auto dim_num = array_schema.dim_num();
+  auto& vfs = resources_.vfs();
+
+  // Gather the field names, and the names that carry each kind of
+  // per-tile metadata.
+  std::vector<std::string> names;
+  std::vector<std::string> min_max_names, sum_names, null_count_names;
+  names.reserve(dim_num + array_schema.attribute_num());
+  for (unsigned d = 0; d < dim_num; d++) {
+    names.emplace_back(domain.dimension_ptr(d)->name());
+  }
+  for (const auto& attr : array_schema.attributes()) {
+    names.emplace_back(attr->name());
+  }
+  for (const auto& name : names) {
+    const auto type = array_schema.type(name);
+    const auto is_dim = array_schema.is_dim(name);
+    const auto var_size = array_schema.var_size(name);
+    const auto cell_val_num = array_schema.cell_val_num(name);
+    if (TileMetadataGenerator::has_min_max_metadata(
+            type, is_dim, var_size, cell_val_num)) {
+      min_max_names.emplace_back(name);
+    }
+    if (TileMetadataGenerator::has_sum_metadata(type, var_size, cell_val_num)) {
+      sum_names.emplace_back(name);
+    }
+    if (array_schema.is_nullable(name)) {
+      null_count_names.emplace_back(name);
+    }
+  }
+
+  // Load the source metadata moved below: R-Tree (MBRs), tile offsets,
+  // var sizes and the per-tile metadata.
+  uint64_t total_tiles = 0;
+  for (auto f : order) {
+    auto& frag = fragments[f];
+    auto loaded = frag->loaded_metadata();
+    loaded->load_rtree(encryption_key);
+    loaded->load_tile_offsets(encryption_key, names);
+    for (const auto& name : names) {
+      if (array_schema.var_size(name)) {
+        loaded->load_tile_var_sizes(encryption_key, name);
+      }
+    }
+    if (!min_max_names.empty()) {
+      loaded->load_tile_min_values(encryption_key, min_max_names);
+      loaded->load_tile_max_values(encryption_key, min_max_names);
+    }
+    if (!sum_names.empty()) {
+      loaded->load_tile_sum_values(encryption_key, sum_names);
+    }
+    if (!null_count_names.empty()) {
+      loaded->load_tile_null_count_values(encryption_key, null_count_names);
+    }
+    total_tiles += frag->tile_num();
+  }
+
+  // The new fragment covers the timestamps of the first to the last
+  // consolidated fragment.
+  auto fragment_name = storage_format::generate_consolidated_fragment_name(
+      to_consolidate.front().uri_, to_consolidate.back().uri_, write_version);
+  auto frag_dir_uri = array_dir.get_fragments_dir(write_version);
+  *new_fragment_uri = frag_dir_uri.join_path(fragment_name);
+  URI vac_uri = array_dir.get_vacuum_uri(*new_fragment_uri);
+
+  // Create the directories of the new fragment.
+  throw_if_not_ok(vfs.create_dir(frag_dir_uri));
+  throw_if_not_ok(vfs.create_dir(*new_fragment_uri));
+  throw_if_not_ok(vfs.create_dir(array_dir.get_commits_dir(write_version)));
+
+  // Create the new fragment metadata.
+  FragmentID fragment_id{*new_fragment_uri};
+  auto frag_meta = make_shared<FragmentMetadata>(
+      HERE(),
+      &resources_,
+      array_for_reads->array_schema_latest_ptr(),
+      *new_fragment_uri,
+      fragment_id.timestamp_range(),
+      consolidator_memory_tracker_,
+      false /* dense */,
+      false /* has_timestamps */,
+      false /* has_delete_meta */);
+  frag_meta->init(domain.domain());
+  frag_meta->set_num_tiles(total_tiles);
+
+  // Transfer the MBRs and the last tile cell count.
+  uint64_t base_tile = 0;
+  for (auto f : order) {
+    auto& frag = fragments[f];
+    auto tile_num = frag->tile_num();
+    for (uint64_t t = 0; t < tile_num; t++) {
+      frag_meta->set_mbr(base_tile + t, frag->mbr(t));
+    }
+    base_tile += tile_num;
+  }
+  frag_meta->set_last_tile_cell_num(
+      fragments[order.back()]->last_tile_cell_num());
+
+  // Move the filtered tiles of each field verbatim, one task per field
+  // as the writers do, fixing up the tile offsets in the new fragment
+  // metadata as the bytes land.
+  std::vector<ThreadPool::Task> tasks;
+  tasks.reserve(names.size());
+  for (const auto& name : names) {
+    tasks.push_back(resources_.io_tp().execute([&, name]() {
+      const bool var_size = array_schema.var_size(name);
+      const bool nullable = array_schema.is_nullable(name);
+      auto uri = frag_meta->uri(name);
+      URI var_uri = var_size ? frag_meta->var_uri(name) : URI("");
+      URI validity_uri = nullable ? frag_meta->validity_uri(name) : URI("");
+
+      std::vector<uint8_t> buffer;
+      auto copy_tile = [&](const URI& src_uri,
+                           const URI& dest_uri,
+                           uint64_t offset,
+                           uint64_t size) {
+        buffer.resize(size);
+        RETURN_NOT_OK(vfs.read(src_uri, offset, buffer.data(), size));
+        return vfs.write(dest_uri, buffer.data(), size);
+      };
+
+      uint64_t tile_id = 0;
+      for (auto f : order) {
+        auto& frag = fragments[f];
+        auto loaded = frag->loaded_metadata();
+        auto src_uri = frag->uri(name);
+        auto tile_num = frag->tile_num();
+        for (uint64_t t = 0; t < tile_num; t++, tile_id++) {
+          auto tile_size = loaded->persisted_tile_size(name, t);
+          RETURN_NOT_OK(
+              copy_tile(src_uri, uri, loaded->file_offset(name, t), tile_size));
+          frag_meta->set_tile_offset(name, tile_id, tile_size);
+
+          if (var_size) {
+            auto var_tile_size = loaded->persisted_tile_var_size(name, t);
+            RETURN_NOT_OK(copy_tile(
+                frag->var_uri(name),
+                var_uri,
+                loaded->file_var_offset(name, t),
+                var_tile_size));
+            frag_meta->set_tile_var_offset(name, tile_id, var_tile_size);
+            frag_meta->set_tile_var_size(
+                name, tile_id, loaded->tile_var_size(name, t));
+          }
+
+          if (nullable) {
+            auto validity_tile_size =
+                loaded->persisted_tile_validity_size(name, t);
+            RETURN_NOT_OK(copy_tile(
+                frag->validity_uri(name),
+                validity_uri,
+                loaded->file_validity_offset(name, t),
+                validity_tile_size));
+            frag_meta->set_tile_validity_offset(
+                name, tile_id, validity_tile_size);
+          }
+        }
+      }
+
+      // Close the new fragment's files.
+      throw_if_not_ok(vfs.close_file(uri));
+      if (var_size) {
+        throw_if_not_ok(vfs.close_file(var_uri));
+      }
+      if (nullable) {
+        throw_if_not_ok(vfs.close_file(validity_uri));
+      }
+
+      return Status::Ok();
+    }));
+  }
+  auto statuses = resources_.io_tp().wait_all_status(tasks);
+  for (auto& st : statuses) {
+    if (!st.ok()) {
+      bool is_dir = false;
+      throw_if_not_ok(vfs.is_dir(*new_fragment_uri, &is_dir));
+      if (is_dir) {
+        throw_if_not_ok(vfs.remove_dir(*new_fragment_uri));
+      }
+      return st;
+    }
+  }
+
+  // Transfer the per-tile metadata. The eligibility check excluded
+  // var-sized fields with min/max metadata, so the values are fixed
+  // size.
+  for (const auto& name : min_max_names) {
+    const bool nullable = array_schema.is_nullable(name);
+    auto cell_size = array_schema.cell_size(name);
+    uint64_t tile_id = 0;
+    for (auto f : order) {
+      auto& frag = fragments[f];
+      auto tile_num = frag->tile_num();
+      for (uint64_t t = 0; t < tile_num; t++, tile_id++) {
+        // Fully null tiles record no min/max.
+        if (nullable &&
+            frag->loaded_metadata()->get_tile_null_count(name, t) ==
+                frag->cell_num(t)) {
+          continue;
+        }
+        auto min = static_cast<const uint8_t*>(
+            frag->get_tile_min_as<const void*>(name, t));
+        auto max = static_cast<const uint8_t*>(
+            frag->get_tile_max_as<const void*>(name, t));
+        frag_meta->set_tile_min(name, tile_id, ByteVec(min, min + cell_size));
+        frag_meta->set_tile_max(name, tile_id, ByteVec(max, max + cell_size));
+      }
+    }
+  }
+  for (const auto& name : sum_names) {
+    uint64_t tile_id = 0;
+    for (auto f : order) {
+      auto& frag = fragments[f];
+      auto tile_num = frag->tile_num();
+      for (uint64_t t = 0; t < tile_num; t++, tile_id++) {
+        auto sum = static_cast<const uint8_t*>(
+            frag->loaded_metadata()->get_tile_sum(name, t));
+        frag_meta->set_tile_sum(
+            name, tile_id, ByteVec(sum, sum + sizeof(uint64_t)));
+      }
+    }
+  }
+  for (const auto& name : null_count_names) {
+    uint64_t tile_id = 0;
+    for (auto f : order) {
+      auto& frag = fragments[f];
+      auto tile_num = frag->tile_num();
+      for (uint64_t t = 0; t < tile_num; t++, tile_id++) {
+        frag_meta->set_tile_null_count(
+            name,
+            tile_id,
+            frag->loaded_metadata()->get_tile_null_count(name, t));
+      }
+    }
+  }
+
+  // Mark the delete conditions processed, like the rewriting path; the
+  // eligibility check rejected every condition that could affect the
+  // source cells.
+  const auto& delete_and_update_tiles_location =
+      array_dir.delete_and_update_tiles_location();
+  std::vector<std::string> processed_conditions;
+  processed_conditions.reserve(delete_and_update_tiles_location.size());
+  for (auto& location : delete_and_update_tiles_location) {
+    processed_conditions.emplace_back(location.condition_marker());
+  }
+  frag_meta->set_processed_conditions(processed_conditions);
+
+  // Flush the fragment metadata, then make the fragment visible.
+  frag_meta->compute_fragment_min_max_sum_null_count();
+  frag_meta->store(encryption_key);
+  throw_if_not_ok(vfs.touch(array_dir.get_commit_uri(*new_fragment_uri)));
+
+  stats_->add_counter("consolidate_pass_through_num", 1);
+
+  return write_vacuum_file(
+      write_version, array_for_reads->array_uri(), vac_uri, to_consolidate);
+}
+
 void FragmentConsolidator::copy_array(
-    Query* query_r, Query* query_w, FragmentConsolidationWorkspace& cw) {
+    Query* query_r,
+    Query* query_w,
+    FragmentConsolidationWorkspace& cw,
+    const FragmentConsolidationConfig& cfg) {
   auto timer_se = stats_->start_timer("consolidate_copy_array");
 
   // Set the read query buffers outside the repeated submissions.
   // The Reader will reset the query buffer sizes to the original
   // sizes, not the potentially smaller sizes of the results after
   // the query submission.
-  set_query_buffers(query_r, cw);
+  set_query_buffers(query_r, cw, cfg);
 
   do {
     // READ
@@ -662,13 +1213,74 @@ void FragmentConsolidator::copy_array(
 
     // Set explicitly the write query buffers, as the sizes may have
     // been altered by the read query.
-    set_query_buffers(query_w, cw);
+    set_query_buffers(query_w, cw, cfg);
 
     // WRITE
     throw_if_not_ok(query_w->submit());
   } while (query_r->status() == QueryStatus::INCOMPLETE);
 }
 
+void FragmentConsolidator::copy_array_pipelined(
+    Query* query_r,
+    Query* query_w,
+    FragmentConsolidationWorkspace& cw_a,
+    FragmentConsolidationWorkspace& cw_b,
+    const FragmentConsolidationConfig& cfg) {
+  auto timer_se = stats_->start_timer("consolidate_copy_array");
+
+  auto& compute_tp = resources_.compute_tp();
+  auto read_cw = &cw_a;
+  auto other_cw = &cw_b;
+  ThreadPool::Task write_task;
+
+  // Waits for the in-flight write, propagating its status.
+  auto wait_write = [&]() {
+    if (write_task.valid()) {
+      throw_if_not_ok(compute_tp.wait(write_task));
+    }
+  };
+
+  bool incomplete;
+  do {
+    // READ into the workspace the in-flight write does not use. See
+    // `copy_array` for why the read buffers are set on every iteration.
+    set_query_buffers(query_r, *read_cw, cfg);
+    try {
+      throw_if_not_ok(query_r->submit());
+    } catch (...) {
+      // Do not leave a write referencing this stack frame behind.
+      if (write_task.valid()) {
+        (void)compute_tp.wait(write_task);
+      }
+      throw;
+    }
+    incomplete = query_r->status() == QueryStatus::INCOMPLETE;
+
+    // If Consolidation cannot make any progress, throw. The first buffer
+    // will always contain fixed size data, whether it is tile offsets for
+    // var size attribute/dimension or the actual fixed size data so we
+    // can use its size to know if any cells were written or not.
+    if (read_cw->sizes().at(0) == 0) {
+      wait_write();
+      throw FragmentConsolidatorException(
+          "Consolidation read 0 cells, no progress can be made");
+    }
+
+    // The writer consumes one batch at a time; wait for the previous
+    // write before handing it the batch just read.
+    wait_write();
+
+    // WRITE in the background, overlapping with the next read.
+    std::swap(read_cw, other_cw);
+    write_task = compute_tp.execute([this, query_w, other_cw, &cfg]() {
+      set_query_buffers(query_w, *other_cw, cfg);
+      return query_w->submit();
+    });
+  } while (incomplete);
+
+  wait_write();
+}
+
 Status FragmentConsolidator::create_queries(
     shared_ptr<Array> array_for_reads,
     shared_ptr<Array> array_for_writes,
@@ -677,7 +1289,8 @@ Status FragmentConsolidator::create_queries(
     tdb_unique_ptr<Query>& query_w,
     URI* new_fragment_uri,
     uint64_t read_memory_budget,
-    uint64_t write_memory_budget) {
+    uint64_t write_memory_budget,
+    const FragmentConsolidationConfig& cfg) {
   auto timer_se = stats_->start_timer("consolidate_create_queries");
 
   const auto dense = array_for_reads->array_schema_latest().dense();
@@ -705,7 +1318,7 @@ Status FragmentConsolidator::create_queries(
   }
 
   // Enable consolidation with timestamps on the reader, if applicable.
-  if (config_.with_timestamps_ && !dense) {
+  if (cfg.with_timestamps_ && !dense) {
     throw_if_not_ok(query_r->set_consolidation_with_timestamps());
   }
 
@@ -727,7 +1340,7 @@ Status FragmentConsolidator::create_queries(
       write_memory_budget));
   throw_if_not_ok(query_w->set_layout(Layout::GLOBAL_ORDER));
   throw_if_not_ok(query_w->disable_checks_consolidation());
-  query_w->set_fragment_size(config_.max_fragment_size_);
+  query_w->set_fragment_size(cfg.max_fragment_size_);
   if (array_for_reads->array_schema_latest().dense()) {
     throw_if_not_ok(query_w->set_subarray_unsafe(subarray));
   }
@@ -755,6 +1368,12 @@ Status FragmentConsolidator::compute_next_to_consolidate(
     const FragmentInfo& fragment_info,
     std::vector<TimestampedURI>* to_consolidate,
     NDRange* union_non_empty_domains) const {
+  // Use the overlap cluster planner if requested.
+  if (config_.overlap_clusters_) {
+    return compute_next_overlap_cluster(
+        array_schema, fragment_info, to_consolidate, union_non_empty_domains);
+  }
+
   auto timer_se = stats_->start_timer("consolidate_compute_next");
 
   // Preparation
@@ -866,8 +1485,201 @@ Status FragmentConsolidator::compute_next_to_consolidate(
   return Status::Ok();
 }
 
+Status FragmentConsolidator::compute_next_overlap_cluster(
+    const ArraySchema& array_schema,
+    const FragmentInfo& fragment_info,
+    std::vector<TimestampedURI>* to_consolidate,
+    NDRange* union_non_empty_domains) const {
+  std::vector<std::vector<TimestampedURI>> clusters;
+  std::vector<NDRange> cluster_unions;
+  RETURN_NOT_OK(compute_overlap_clusters(
+      array_schema, fragment_info, 1, &clusters, &cluster_unions));
+
+  to_consolidate->clear();
+  if (!clusters.empty()) {
+    *to_consolidate = std::move(clusters.front());
+    *union_non_empty_domains = std::move(cluster_unions.front());
+  }
+
+  return Status::Ok();
+}
+
+Status FragmentConsolidator::compute_overlap_clusters(
+    const ArraySchema& array_schema,
+    const FragmentInfo& fragment_info,
+    uint32_t max_clusters,
+    std::vector<std::vector<TimestampedURI>>* to_consolidate,
+    std::vector<NDRange>* union_non_empty_domains) const {
+  auto timer_se = stats_->start_timer("consolidate_compute_next_cluster");
+
+  // Preparation
+  auto sparse = !array_schema.dense();
+  const auto& fragments = fragment_info.single_fragment_info_vec();
+  auto& domain{array_schema.domain()};
+  to_consolidate->clear();
+  union_non_empty_domains->clear();
+  auto fragment_num = fragments.size();
+  auto min = config_.min_frags_;
+  min = (uint32_t)((min > fragment_num) ? fragment_num : min);
+  min = std::max<uint32_t>(min, 2);
+  auto max = config_.max_frags_;
+  max = (uint32_t)((max > fragment_num) ? fragment_num : max);
+  if (max < 2) {
+    return Status::Ok();
+  }
+
+  // Cluster the fragments with a union-find over non-empty domain
+  // overlap: two fragments end up in the same cluster iff they are
+  // connected through a chain of pairwise overlapping non-empty domains.
+  // Fragments that are disjoint from all others stay in singleton
+  // clusters and are never rewritten.
+  std::vector<size_t> parent(fragment_num);
+  for (size_t f = 0; f < fragment_num; f++) {
+    parent[f] = f;
+  }
+  auto find = [&parent](size_t f) {
+    while (parent[f] != f) {
+      parent[f] = parent[parent[f]];
+      f = parent[f];
+    }
+    return f;
+  };
+  for (size_t i = 0; i < fragment_num; i++) {
+    for (size_t j = i + 1; j < fragment_num; j++) {
+      if (domain.overlap(
+              fragments[i].non_empty_domain(), fragments[j].non_empty_domain()))
+        parent[find(i)] = find(j);
+    }
+  }
+
+  // Gather the cluster members, in timestamp order (the fragment info
+  // vector is sorted by timestamp).
+  std::map<size_t, std::vector<size_t>> clusters;
+  for (size_t f = 0; f < fragment_num; f++) {
+    clusters[find(f)].emplace_back(f);
+  }
+
+  // Gather the eligible clusters.
+  std::vector<std::vector<size_t>> eligible_members;
+  std::vector<NDRange> eligible_unions;
+  std::vector<uint64_t> eligible_sizes;
+  for (auto& [root, members] : clusters) {
+    (void)root;
+    if (members.size() < min) {
+      continue;
+    }
+
+    // A cluster larger than the step maximum is trimmed to its earliest
+    // members; the remainder is picked up by subsequent steps.
+    const bool trimmed = members.size() > max;
+    if (trimmed) {
+      members.resize(max);
+    }
+
+    // Compute the union of the non-empty domains and the total size.
+    NDRange union_ned = fragments[members[0]].non_empty_domain();
+    uint64_t size = 0;
+    for (auto f : members) {
+      domain.expand_ndrange(fragments[f].non_empty_domain(), &union_ned);
+      size += fragments[f].fragment_size();
+    }
+
+    // For dense arrays (and for trimmed clusters, whose union may now
+    // cover fragments that were left out), make sure the union does not
+    // overlap the anterior range or any non-member fragment that precedes
+    // the last member, as the consolidated fragment would shadow them.
+    if (!sparse || trimmed) {
+      const auto& anterior_ndrange = fragment_info.anterior_ndrange();
+      if (anterior_ndrange.size() != 0 &&
+          domain.overlap(union_ned, anterior_ndrange)) {
+        continue;
+      }
+
+      bool shadows = false;
+      size_t m = 0;
+      for (size_t f = 0; f < members.back(); f++) {
+        if (m < members.size() && members[m] == f) {
+          m++;
+          continue;
+        }
+        if (domain.overlap(union_ned, fragments[f].non_empty_domain())) {
+          shadows = true;
+          break;
+        }
+      }
+      if (shadows) {
+        continue;
+      }
+    }
+
+    // Check the consolidation amplification factor for dense arrays.
+    if (!sparse) {
+      auto union_cell_num = domain.cell_num(union_ned);
+      uint64_t sum_cell_num = 0;
+      for (auto f : members) {
+        sum_cell_num +=
+            domain.cell_num(fragments[f].expanded_non_empty_domain());
+      }
+      if ((double(union_cell_num) / sum_cell_num) > config_.amplification_) {
+        continue;
+      }
+    }
+
+    eligible_members.emplace_back(members);
+    eligible_unions.emplace_back(union_ned);
+    eligible_sizes.emplace_back(size);
+  }
+
+  // Order the eligible clusters with the most members first, breaking
+  // ties with the smallest total size; the more overlapping fragments
+  // a read has to merge, the more the overlap degrades it.
+  std::vector<size_t> order(eligible_members.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (eligible_members[a].size() != eligible_members[b].size()) {
+      return eligible_members[a].size() > eligible_members[b].size();
+    }
+    return eligible_sizes[a] < eligible_sizes[b];
+  });
+
+  // Emit up to `max_clusters` clusters. When more than one is
+  // requested, the clusters will be consolidated concurrently, so only
+  // accept clusters whose domain unions are disjoint from the ones
+  // already accepted; the bounding-box union of a cluster may cover
+  // fragments of another cluster even though their members never
+  // overlap.
+  for (auto c : order) {
+    if (to_consolidate->size() >= max_clusters) {
+      break;
+    }
+
+    bool disjoint = true;
+    for (auto& accepted : *union_non_empty_domains) {
+      if (domain.overlap(eligible_unions[c], accepted)) {
+        disjoint = false;
+        break;
+      }
+    }
+    if (!disjoint) {
+      continue;
+    }
+
+    std::vector<TimestampedURI> uris;
+    uris.reserve(eligible_members[c].size());
+    for (auto f : eligible_members[c]) {
+      uris.emplace_back(fragments[f].uri(), fragments[f].timestamp_range());
+    }
+    to_consolidate->emplace_back(std::move(uris));
+    union_non_empty_domains->emplace_back(std::move(eligible_unions[c]));
+  }
+
+  return Status::Ok();
+}
+
 void FragmentConsolidator::set_query_buffers(
-    Query* query, FragmentConsolidationWorkspace& cw) const {
+    Query* query,
+    FragmentConsolidationWorkspace& cw,
+    const FragmentConsolidationConfig& cfg) const {
   auto buffers = &cw.buffers();
   auto buffer_sizes = &cw.sizes();
 
@@ -929,7 +1741,7 @@ void FragmentConsolidator::set_query_buffers(
     }
   }
 
-  if (config_.with_timestamps_ && !dense) {
+  if (cfg.with_timestamps_ && !dense) {
     throw_if_not_ok(query->set_data_buffer(
         constants::timestamps,
         (void*)&(*buffers)[bid][0],
@@ -937,7 +1749,7 @@ void FragmentConsolidator::set_query_buffers(
     ++bid;
   }
 
-  if (config_.with_delete_meta_ && !dense) {
+  if (cfg.with_delete_meta_ && !dense) {
     throw_if_not_ok(query->set_data_buffer(
         constants::delete_timestamps,
         (void*)&(*buffers)[bid][0],
@@ -1008,6 +1820,26 @@ Status FragmentConsolidator::set_config(const Config& config) {
       &config_.purge_deleted_cells_,
       &found));
   assert(found);
+  config_.overlap_clusters_ = false;
+  throw_if_not_ok(merged_config.get<bool>(
+      "sm.consolidation.overlap_clusters",
+      &config_.overlap_clusters_,
+      &found));
+  assert(found);
+  config_.streaming_ = false;
+  throw_if_not_ok(merged_config.get<bool>(
+      "sm.consolidation.streaming", &config_.streaming_, &found));
+  assert(found);
+  config_.pass_through_ = false;
+  throw_if_not_ok(merged_config.get<bool>(
+      "sm.consolidation.pass_through", &config_.pass_through_, &found));
+  assert(found);
+  config_.max_concurrent_nodes_ = 1;
+  throw_if_not_ok(merged_config.get<uint32_t>(
+      "sm.consolidation.max_concurrent_nodes",
+      &config_.max_concurrent_nodes_,
+      &found));
+  assert(found);
   config_.min_frags_ = 0;
   throw_if_not_ok(merged_config.get<uint32_t>(
       "sm.consolidation.step_min_frags", &config_.min_frags_, &found));
@@ -1042,6 +1874,10 @@ Status FragmentConsolidator::set_config(const Config& config) {
     throw FragmentConsolidatorException(
         "Invalid configuration; Amplification config parameter must be "
         "non-negative");
+  if (config_.max_concurrent_nodes_ == 0)
+    throw FragmentConsolidatorException(
+        "Invalid configuration; Maximum concurrent nodes config parameter "
+        "must be at least 1");
 
   return Status::Ok();
 }
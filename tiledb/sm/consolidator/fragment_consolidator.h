@@ -108,6 +108,21 @@ struct FragmentConsolidationConfig : Consolidator::ConsolidationConfigBase {
   bool use_refactored_reader_;
   /** Purge deleted cells or not. */
   bool purge_deleted_cells_;
+  /** Plan steps from non-empty domain overlap clusters or not. */
+  bool overlap_clusters_;
+  /** Overlap reads and writes with double-buffered streaming or not. */
+  bool streaming_;
+  /**
+   * Move filtered tiles verbatim into the new fragment when the
+   * selected fragments transfer intact, instead of rewriting all cells.
+   */
+  bool pass_through_;
+  /**
+   * Maximum number of disjoint overlap clusters consolidated
+   * concurrently in a single step. Only used with the overlap
+   * cluster planner.
+   */
+  uint32_t max_concurrent_nodes_;
 };
 
 /**
@@ -293,6 +308,9 @@ class FragmentConsolidator : public Consolidator {
    * @param new_fragment_uri The URI of the fragment created after
    *     consolidating the `to_consolidate` fragments.
    * @param cw A workspace containing buffers for the queries
+   * @param cfg The consolidation parameters to use for this step. Taken
+   *     by value, as the step makes a local delete-metadata decision;
+   *     concurrent steps must not observe each other's.
    * @return Status
    */
   Status consolidate_internal(
@@ -301,7 +319,83 @@ class FragmentConsolidator : public Consolidator {
       const std::vector<TimestampedURI>& to_consolidate,
       const NDRange& union_non_empty_domains,
       URI* new_fragment_uri,
-      FragmentConsolidationWorkspace& cw);
+      FragmentConsolidationWorkspace& cw,
+      FragmentConsolidationConfig cfg);
+
+  /**
+   * Consolidates up to `max_nodes` disjoint overlap clusters
+   * concurrently, each on its own pair of opened arrays and with an
+   * equal share of the total memory budget. Used when
+   * `sm.consolidation.max_concurrent_nodes` exceeds 1 together with the
+   * overlap cluster planner. Runs nothing (and leaves the serial path
+   * to the caller) when fewer than two eligible clusters exist.
+   *
+   * @param array_for_reads The caller's array opened for reads; used
+   *     only for its URI and latest schema.
+   * @param encryption_type The encryption type of the array.
+   * @param encryption_key The encryption key of the array.
+   * @param key_length The length of the encryption key.
+   * @param fragment_info Information about all the fragments; updated
+   *     with the consolidated fragments of every executed node.
+   * @param max_nodes Maximum number of clusters to consolidate.
+   * @param nodes_done The function will return here the number of
+   *     executed nodes, each of which counts as a consolidation step.
+   * @return Status
+   */
+  Status consolidate_clusters_in_parallel(
+      shared_ptr<Array> array_for_reads,
+      EncryptionType encryption_type,
+      const void* encryption_key,
+      uint32_t key_length,
+      FragmentInfo& fragment_info,
+      uint32_t max_nodes,
+      uint32_t* nodes_done);
+
+  /**
+   * Checks whether the loaded fragments of `array_for_reads` can be
+   * consolidated by moving their filtered tiles verbatim into the new
+   * fragment. This requires that no cell is dropped, rewritten or
+   * reordered: a sparse 1D array that allows duplicates, source
+   * fragments with pairwise disjoint non-empty domains at the latest
+   * format version without timestamps or delete metadata, and all
+   * source tiles full except the last one of the last fragment, so the
+   * concatenation remains in global order with the schema capacity per
+   * tile. Var-sized attributes carrying tile min/max metadata are not
+   * supported, as their metadata cannot be transferred yet.
+   *
+   * @param array_for_reads The array opened for reads, with the
+   *     fragments to consolidate loaded.
+   * @param cfg The consolidation parameters of this step.
+   * @param order The function will return here the source fragment
+   *     indices in global (coordinate) order.
+   * @return `True` if the fragments can be consolidated verbatim.
+   */
+  bool can_pass_through(
+      shared_ptr<Array> array_for_reads,
+      const FragmentConsolidationConfig& cfg,
+      std::vector<size_t>* order) const;
+
+  /**
+   * Consolidates the loaded fragments of `array_for_reads` by moving
+   * their filtered tiles verbatim into the new fragment, fixing up the
+   * tile offsets in the new fragment metadata only. The caller must
+   * have established eligibility with `can_pass_through`. Also writes
+   * the commit and vacuum files of the new fragment.
+   *
+   * @param array_for_reads The array opened for reads, with the
+   *     fragments to consolidate loaded.
+   * @param to_consolidate The fragments to consolidate in this step.
+   * @param order The source fragment indices in global order, as
+   *     returned by `can_pass_through`.
+   * @param new_fragment_uri The URI of the fragment created after
+   *     consolidating the `to_consolidate` fragments.
+   * @return Status
+   */
+  Status consolidate_pass_through(
+      shared_ptr<Array> array_for_reads,
+      const std::vector<TimestampedURI>& to_consolidate,
+      const std::vector<size_t>& order,
+      URI* new_fragment_uri);
 
   /**
    * Copies the array by reading from the fragments to be consolidated
@@ -311,9 +405,33 @@ class FragmentConsolidator : public Consolidator {
    * @param query_r The read query.
    * @param query_w The write query.
    * @param cw A workspace containing buffers for the queries
+   * @param cfg The consolidation parameters of this step.
    */
   void copy_array(
-      Query* query_r, Query* query_w, FragmentConsolidationWorkspace& cw);
+      Query* query_r,
+      Query* query_w,
+      FragmentConsolidationWorkspace& cw,
+      const FragmentConsolidationConfig& cfg);
+
+  /**
+   * Copies the array by reading from the fragments to be consolidated
+   * with `query_r` and writing to the new fragment with `query_w`,
+   * overlapping the two: each batch is written on a compute thread pool
+   * task while the next batch is read into the other workspace. Used
+   * when `sm.consolidation.streaming` is set.
+   *
+   * @param query_r The read query.
+   * @param query_w The write query.
+   * @param cw_a A workspace containing buffers for the queries.
+   * @param cw_b A second workspace, ping-ponged with the first.
+   * @param cfg The consolidation parameters of this step.
+   */
+  void copy_array_pipelined(
+      Query* query_r,
+      Query* query_w,
+      FragmentConsolidationWorkspace& cw_a,
+      FragmentConsolidationWorkspace& cw_b,
+      const FragmentConsolidationConfig& cfg);
 
   /**
    * Creates the queries needed for consolidation. It also retrieves
@@ -331,6 +449,7 @@ class FragmentConsolidator : public Consolidator {
    * @param new_fragment_uri The URI of the new fragment to be created.
    * @param read_memory_budget Memory budget for the read operation.
    * @param write_memory_budget Memory budget for the write operation.
+   * @param cfg The consolidation parameters of this step.
    * @return Status
    */
   Status create_queries(
@@ -341,7 +460,8 @@ class FragmentConsolidator : public Consolidator {
       tdb_unique_ptr<Query>& query_w,
       URI* new_fragment_uri,
       uint64_t read_memory_budget,
-      uint64_t write_memory_budget);
+      uint64_t write_memory_budget,
+      const FragmentConsolidationConfig& cfg);
 
   /**
    * Based on the input fragment info, this algorithm decides the (sorted) list
@@ -360,6 +480,48 @@ class FragmentConsolidator : public Consolidator {
       std::vector<TimestampedURI>* to_consolidate,
       NDRange* union_non_empty_domains) const;
 
+  /**
+   * Alternative planner used when `sm.consolidation.overlap_clusters` is
+   * set. Clusters the fragments by actual non-empty domain overlap and
+   * selects the cluster whose overlap degrades reads the most, leaving
+   * fragments that are disjoint from all others untouched.
+   *
+   * @param array_schema The array schema.
+   * @param fragment_info Information about all the fragments.
+   * @param to_consolidate The fragments to consolidate in the next step.
+   * @param union_non_empty_domains The function will return here the
+   *     union of the non-empty domains of the fragments in `to_consolidate`.
+   * @return Status
+   */
+  Status compute_next_overlap_cluster(
+      const ArraySchema& array_schema,
+      const FragmentInfo& fragment_info,
+      std::vector<TimestampedURI>* to_consolidate,
+      NDRange* union_non_empty_domains) const;
+
+  /**
+   * Clusters the fragments by actual non-empty domain overlap and
+   * selects up to `max_clusters` eligible clusters, most degrading
+   * first (most members, smallest total size on ties). When more than
+   * one cluster is requested, the returned clusters additionally have
+   * pairwise disjoint domain unions, so they can be consolidated
+   * concurrently without one node shadowing the fragments of another.
+   *
+   * @param array_schema The array schema.
+   * @param fragment_info Information about all the fragments.
+   * @param max_clusters Maximum number of clusters to return.
+   * @param to_consolidate The fragments to consolidate, per cluster.
+   * @param union_non_empty_domains The union of the non-empty domains
+   *     of the fragments of each cluster, in the same order.
+   * @return Status
+   */
+  Status compute_overlap_clusters(
+      const ArraySchema& array_schema,
+      const FragmentInfo& fragment_info,
+      uint32_t max_clusters,
+      std::vector<std::vector<TimestampedURI>>* to_consolidate,
+      std::vector<NDRange>* union_non_empty_domains) const;
+
   /** Checks and sets the input configuration parameters. */
   Status set_config(const Config& config);
 
@@ -371,9 +533,12 @@ class FragmentConsolidator : public Consolidator {
    *
    * @param query The query to set the buffers to.
    * @param cw Consolidation workspace containing the buffers
+   * @param cfg The consolidation parameters of this step.
    */
   void set_query_buffers(
-      Query* query, FragmentConsolidationWorkspace& cw) const;
+      Query* query,
+      FragmentConsolidationWorkspace& cw,
+      const FragmentConsolidationConfig& cfg) const;
 
   /** Writes the vacuum file that contains the URIs of the consolidated
    * fragments. */
@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/consolidator/fragment_meta_consolidator.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/sm/array_schema/ndrectangle.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/fragment/fragment_identifier.h"
@@ -154,6 +155,36 @@ Status FragmentMetaConsolidator::consolidate(
     // Combine serialized fragment metadata footers into a single buffer
     for (const auto& t : tiles)
       serializer.write(t->data(), t->size());
+
+    // Append a compact per-fragment summary (timestamp range, cell count,
+    // fragment size, non-empty domain) after the footers, followed by a
+    // trailer that points back to it. Readers that predate the summary
+    // never read past the footers, so the section is backwards compatible.
+    auto summary_offset = offset;
+    serializer.write<uint32_t>(
+        constants::consolidated_fragment_summary_version);
+    for (auto m : meta) {
+      auto timestamp_range = m->timestamp_range();
+      serializer.write<uint64_t>(timestamp_range.first);
+      serializer.write<uint64_t>(timestamp_range.second);
+      serializer.write<uint64_t>(m->cell_num());
+      serializer.write<uint64_t>(m->fragment_size());
+      serializer.write<uint8_t>(m->dense() ? 0 : 1);
+      const auto& schema_name = m->array_schema_name();
+      serializer.write<uint64_t>(schema_name.size());
+      serializer.write(schema_name.data(), schema_name.size());
+      const auto& non_empty_domain = m->non_empty_domain();
+      serializer.write<uint8_t>(non_empty_domain.empty() ? 1 : 0);
+      if (!non_empty_domain.empty()) {
+        NDRectangle(
+            consolidator_memory_tracker_,
+            m->array_schema()->shared_domain(),
+            non_empty_domain)
+            .serialize(serializer);
+      }
+    }
+    serializer.write<uint64_t>(summary_offset);
+    serializer.write<uint64_t>(constants::consolidated_fragment_summary_magic);
   };
 
   SizeComputationSerializer size_computation_serializer;
@@ -200,19 +231,17 @@ void FragmentMetaConsolidator::vacuum(const char* array_name) {
     }
   }
 
-  // Vacuum
-  auto& vfs = resources_.vfs();
-  auto& compute_tp = resources_.compute_tp();
-  throw_if_not_ok(
-      parallel_for(&compute_tp, 0, fragment_meta_uris.size(), [&](size_t i) {
-        auto& uri = fragment_meta_uris[i];
-        FragmentID fragment_id{uri};
-        auto timestamp_range{fragment_id.timestamp_range()};
-        if (timestamp_range.second != t_latest) {
-          throw_if_not_ok(vfs.remove_file(uri));
-        }
-        return Status::Ok();
-      }));
+  // Vacuum, batching the deletions.
+  std::vector<URI> uris_to_vacuum;
+  uris_to_vacuum.reserve(fragment_meta_uris.size());
+  for (const auto& uri : fragment_meta_uris) {
+    FragmentID fragment_id{uri};
+    auto timestamp_range{fragment_id.timestamp_range()};
+    if (timestamp_range.second != t_latest) {
+      uris_to_vacuum.emplace_back(uri);
+    }
+  }
+  resources_.vfs().remove_files(&resources_.compute_tp(), uris_to_vacuum);
 }
 
 }  // namespace tiledb::sm
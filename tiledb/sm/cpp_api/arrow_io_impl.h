@@ -134,6 +134,9 @@ struct BufferInfo {
   uint64_t offsets_num;      // number of offsets
   void* offsets;             // offsets pointer
   size_t offsets_elem_size;  // bytes per offset element
+  bool nullable;             // is the attribute nullable
+  uint8_t* validity;         // validity bytemap pointer
+  uint64_t validity_num;     // number of validity bytemap elements
 };
 
 /* ****************************** */
@@ -499,7 +502,9 @@ struct CPPArrowArray {
       int64_t null_num,
       int64_t offset,
       std::vector<std::shared_ptr<CPPArrowArray>> children,
-      std::vector<void*> buffers) {
+      std::vector<void*> buffers,
+      std::vector<std::vector<uint8_t>> owned_buffers = {}) {
+    owned_buffers_ = std::move(owned_buffers);
     array_ = static_cast<ArrowArray*>(std::malloc(sizeof(ArrowArray)));
     if (array_ == nullptr)
       throw tiledb::TileDBError("Failed to allocate ArrowArray");
@@ -575,6 +580,13 @@ struct CPPArrowArray {
  private:
   ArrowArray* array_;
   std::vector<void*> buffers_;
+
+  /**
+   * Buffers owned by this object (e.g. a validity bitmap packed during
+   * export), kept alive until the ArrowArray.release callback fires. All
+   * other entries of `buffers_` point at memory owned by the query.
+   */
+  std::vector<std::vector<uint8_t>> owned_buffers_;
 };
 
 /* ****************************** */
@@ -591,6 +603,7 @@ class ArrowImporter {
  private:
   Query* const query_;
   std::vector<void*> offset_buffers_;
+  std::vector<void*> validity_buffers_;
 
 };  // class ArrowExporter
 
@@ -602,6 +615,9 @@ ArrowImporter::~ArrowImporter() {
   for (auto p : offset_buffers_) {
     std::free(p);
   }
+  for (auto p : validity_buffers_) {
+    std::free(p);
+  }
 }
 
 void ArrowImporter::import_(
@@ -617,19 +633,32 @@ void ArrowImporter::import_(
     void* p_data = const_cast<void*>(arw_array->buffers[2]);
     const uint64_t num_offsets = arw_array->length;
     uint64_t data_nbytes = 0;
+    uint64_t* p_offsets64 = nullptr;
     if (typeinfo.arrow_large) {
-      data_nbytes =
-          static_cast<uint64_t*>(p_offsets)[num_offsets] * typeinfo.elem_size;
+      // The offsets are already 64-bit and are used zero-copy.
+      p_offsets64 = static_cast<uint64_t*>(p_offsets);
+      data_nbytes = p_offsets64[num_offsets] * typeinfo.elem_size;
     } else {
-      data_nbytes =
-          static_cast<uint32_t*>(p_offsets)[num_offsets] * typeinfo.elem_size;
+      // Widen the 32-bit Arrow offsets to the 64-bit offsets TileDB
+      // expects. The converted buffer is owned by this object and freed
+      // when the importer goes out of scope.
+      auto p_offsets32 = static_cast<uint32_t*>(p_offsets);
+      data_nbytes = p_offsets32[num_offsets] * typeinfo.elem_size;
+      p_offsets64 = static_cast<uint64_t*>(
+          std::malloc((num_offsets + 1) * sizeof(uint64_t)));
+      if (p_offsets64 == nullptr) {
+        throw TDB_LERROR("[TileDB-Arrow] Failed to allocate offsets buffer");
+      }
+      offset_buffers_.push_back(p_offsets64);
+      for (uint64_t i = 0; i < num_offsets + 1; i++) {
+        p_offsets64[i] = p_offsets32[i];
+      }
     }
 
     // Set the TileDB buffer, adding `1` to `num_offsets` to account for
     // the expected, extra offset.
     query_->set_data_buffer(name, p_data, data_nbytes);
-    query_->set_offsets_buffer(
-        name, static_cast<uint64_t*>(p_offsets), num_offsets + 1);
+    query_->set_offsets_buffer(name, p_offsets64, num_offsets + 1);
   } else {
     // fixed-size attribute (not TILEDB_VAR_NUM)
     assert(arw_array->n_buffers == 2);
@@ -639,6 +668,28 @@ void ArrowImporter::import_(
 
     query_->set_data_buffer(name, static_cast<void*>(p_data), data_num);
   }
+
+  // Unpack the Arrow validity bitmap, if the attribute is nullable, into
+  // the byte-per-cell validity bytemap TileDB expects. A missing bitmap
+  // means all cells are valid.
+  auto schema = query_->array().schema();
+  if (schema.has_attribute(name) && schema.attribute(name).nullable()) {
+    const uint64_t num_cells = arw_array->length;
+    auto bytemap = static_cast<uint8_t*>(std::malloc(num_cells));
+    if (bytemap == nullptr) {
+      throw TDB_LERROR("[TileDB-Arrow] Failed to allocate validity buffer");
+    }
+    validity_buffers_.push_back(bytemap);
+    auto p_validity = static_cast<const uint8_t*>(arw_array->buffers[0]);
+    if (p_validity == nullptr) {
+      memset(bytemap, 1, num_cells);
+    } else {
+      for (uint64_t i = 0; i < num_cells; i++) {
+        bytemap[i] = (p_validity[i / 8] >> (i % 8)) & 1;
+      }
+    }
+    query_->set_validity_buffer(name, bytemap, num_cells);
+  }
 }
 
 /* ****************************** */
@@ -723,18 +774,21 @@ BufferInfo ArrowExporter::buffer_info(const std::string& name) {
   retval.offsets_num = (is_var ? offsets_nelem : 1);
   retval.offsets = offsets;
   retval.offsets_elem_size = offsets_elem_nbytes;
+  retval.nullable = false;
+  retval.validity = nullptr;
+  retval.validity_num = 0;
+
+  auto schema = query_->array().schema();
+  if (schema.has_attribute(name) && schema.attribute(name).nullable()) {
+    retval.nullable = true;
+    query_->get_validity_buffer(name, &retval.validity, &retval.validity_num);
+  }
 
   return retval;
 }
 
 int64_t flags_for_buffer(BufferInfo binfo) {
-  /*  TODO, use these defs from arrow_cdefs.h -- currently not applicable.
-      #define ARROW_FLAG_DICTIONARY_ORDERED 1
-      #define ARROW_FLAG_NULLABLE 2
-      #define ARROW_FLAG_MAP_KEYS_SORTED 4
-  */
-  (void)binfo;
-  return 0;
+  return binfo.nullable ? ARROW_FLAG_NULLABLE : 0;
 }
 
 void ArrowExporter::export_(
@@ -754,15 +808,6 @@ void ArrowExporter::export_(
   //   - delete is called by lambda stored in ArrowSchema.release
   CPPArrowSchema* cpp_schema = new CPPArrowSchema(
       name, arrow_fmt.fmt_, std::nullopt, arrow_flags, {}, {});
-
-  std::vector<void*> buffers;
-  if (bufferinfo.is_var) {
-    buffers = {nullptr, bufferinfo.offsets, bufferinfo.data};
-  } else {
-    cpp_schema = new CPPArrowSchema(
-        name, arrow_fmt.fmt_, std::nullopt, arrow_flags, {}, {});
-    buffers = {nullptr, bufferinfo.data};
-  }
   cpp_schema->export_ptr(schema);
 
   size_t elem_num = 0;
@@ -773,12 +818,39 @@ void ArrowExporter::export_(
     elem_num = bufferinfo.data_num;
   }
 
+  // Pack the byte-per-cell validity values into an Arrow validity bitmap.
+  // The bitmap is owned by the exported array and released with it; all
+  // other buffers are exported zero-copy.
+  std::vector<std::vector<uint8_t>> owned_buffers;
+  void* p_validity = nullptr;
+  int64_t null_num = 0;
+  if (bufferinfo.nullable) {
+    std::vector<uint8_t> bitmap((elem_num + 7) / 8, 0);
+    for (size_t i = 0; i < elem_num; i++) {
+      if (bufferinfo.validity[i] != 0) {
+        bitmap[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+      } else {
+        null_num++;
+      }
+    }
+    owned_buffers.emplace_back(std::move(bitmap));
+    p_validity = owned_buffers.back().data();
+  }
+
+  std::vector<void*> buffers;
+  if (bufferinfo.is_var) {
+    buffers = {p_validity, bufferinfo.offsets, bufferinfo.data};
+  } else {
+    buffers = {p_validity, bufferinfo.data};
+  }
+
   auto cpp_arrow_array = new CPPArrowArray(
-      elem_num,  // elem_num
-      0,         // null_num
-      0,         // offset
-      {},        // children
-      buffers);
+      elem_num,   // elem_num
+      null_num,   // null_num
+      0,          // offset
+      {},         // children
+      buffers,
+      std::move(owned_buffers));
   cpp_arrow_array->export_ptr(array);
 }
 
@@ -315,6 +315,12 @@ class Config {
    * - `sm.io_concurrency_level` <br>
    *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
    *    **Default*: # cores
+   * - `sm.numa_pinning` <br>
+   *    If `true`, thread pool workers are partitioned across the NUMA
+   *    nodes of the machine and pinned to the CPUs of their node,
+   *    keeping the memory they allocate node-local. Best-effort; only
+   *    has an effect on Linux machines with more than one node. <br>
+   *    **Default**: false
    * - `sm.vacuum.mode` <br>
    *    The vacuuming mode, one of
    *    `commits` (remove only consolidated commit files),
@@ -528,6 +534,23 @@ class Config {
    * - `vfs.max_batch_size` <br>
    *    The maximum number of bytes in a VFS read operation<br>
    *    **Default**: UINT64_MAX
+   * - `vfs.max_concurrent_reads` <br>
+   *    The maximum number of in-flight read operations per object-store
+   *    bucket. Oversized reads are only split into parallel range requests
+   *    while the bucket has idle capacity. Zero disables the budget. <br>
+   *    **Default**: 128
+   * - `vfs.block_cache.dir` <br>
+   *    The local directory of the on-disk block cache for remote backends.
+   *    Cached blocks persist across processes and are evicted in LRU order
+   *    against the cache byte budget. An empty value disables the cache.
+   *    <br>
+   *    **Default**: ""
+   * - `vfs.block_cache.size` <br>
+   *    The byte budget of the on-disk block cache. <br>
+   *    **Default**: 10GB
+   * - `vfs.block_cache.block_size` <br>
+   *    The block size (in bytes) of the on-disk block cache. <br>
+   *    **Default**: 4MB
    * - `vfs.min_batch_size` <br>
    *    The minimum number of bytes in a VFS read operation<br>
    *    **Default**: 20MB
@@ -557,6 +580,10 @@ class Config {
    * - `vfs.file.posix_directory_permissions` <br>
    *    permissions to use for posix file system with file or dir creation.<br>
    *    **Default**: 755
+   * - `vfs.file.mmap_reads` <br>
+   *    Whether to serve local file reads from shared read-only memory
+   *    mappings instead of per-read syscalls (POSIX only). <br>
+   *    **Default**: false
    * - `vfs.azure.storage_account_name` <br>
    *    Set the name of the Azure Storage account to use. <br>
    *    **Default**: ""
@@ -582,6 +609,12 @@ class Config {
    *    `vfs.azure.block_list_block_size * vfs.azure.max_parallel_ops` bytes
    *    will be buffered before issuing block uploads in parallel. <br>
    *    **Default**: "5242880"
+   * - `vfs.azure.max_inflight_blocks` <br>
+   *    The maximum number of pipelined in-flight block uploads per blob.
+   *    When non-zero, block uploads are queued as blocks are staged instead
+   *    of being awaited in batches, and block sizes adapt to the observed
+   *    upload durations. Zero keeps the synchronous batch uploader. <br>
+   *    **Default**: "0"
    * - `vfs.azure.max_parallel_ops` <br>
    *    The maximum number of Azure backend parallel operations. <br>
    *    **Default**: `sm.io_concurrency_level`
@@ -878,6 +911,12 @@ class Config {
    *    The delay factor to exponentially wait until further retries of a
    *    failed REST request <br>
    *    **Default**: 1.25
+   * - `rest.query_deadline_ms` <br>
+   *    Deadline in milliseconds for remote read queries. When non-zero, the
+   *    server returns whatever result batches completed by the deadline and
+   *    the query is reported as incomplete; resubmitting it resumes where
+   *    the previous round trip stopped. Zero disables the deadline. <br>
+   *    **Default**: 0
    * - `rest.curl.verbose` <br>
    *    Set curl to run in verbose mode for REST requests <br>
    *    curl will print to stdout with this option
@@ -914,6 +953,13 @@ class Config {
    * - `rest.payer_namespace` <br>
    *    The namespace that should be charged for the request. <br>
    *    **Default**: no default set
+   * - `rest.payload_buffer_alignment` <br>
+   *    The alignment, in bytes, of the raw attribute buffer blocks in
+   *    serialized query payloads. Aligned blocks can be consumed in place
+   *    by columnar (e.g. Arrow) readers without re-buffering. Must be zero
+   *    or a power of two multiple of 8, no greater than 256, and must be
+   *    supported by both peers. Zero keeps the legacy packed layout. <br>
+   *    **Default**: 0
    * - `filestore.buffer_size` <br>
    *    Specifies the size in bytes of the internal buffers used in the
    *    filestore API. The size should be bigger than the minimum tile size
@@ -336,6 +336,12 @@ class Filter {
         return "WEBP";
       case TILEDB_FILTER_DELTA:
         return "DELTA";
+      case TILEDB_FILTER_ADAPTIVE:
+        return "ADAPTIVE";
+      case TILEDB_FILTER_CHECKSUM_CRC32C:
+        return "CHECKSUM_CRC32C";
+      case TILEDB_FILTER_VALIDITY_BIT_PACK:
+        return "VALIDITY_BIT_PACK";
     }
     return "";
   }
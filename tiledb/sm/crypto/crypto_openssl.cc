@@ -34,6 +34,7 @@
 
 #include "tiledb/sm/crypto/crypto_openssl.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/macros.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/crypto/crypto.h"
 
@@ -43,11 +44,92 @@
 #include <openssl/rand.h>
 #include <openssl/sha.h>
 
+#include <cstring>
+
 using namespace tiledb::common;
 
 namespace tiledb {
 namespace sm {
 
+/**
+ * A cipher context that caches the expanded AES-256 key schedule between
+ * calls.
+ *
+ * The filter pipeline encrypts every chunk of a tile with the same key, one
+ * call per chunk, concurrently on the compute thread pool. Allocating a fresh
+ * context and re-running the key expansion for each chunk is pure overhead;
+ * when the key is unchanged from the previous call on this thread, only the
+ * IV is reinitialized and the expanded key is reused.
+ */
+class GCMCipherContext {
+ public:
+  GCMCipherContext()
+      : ctx_(EVP_CIPHER_CTX_new())
+      , has_key_(false)
+      , encrypt_(false) {
+  }
+
+  ~GCMCipherContext() {
+    if (ctx_ != nullptr)
+      EVP_CIPHER_CTX_free(ctx_);
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(GCMCipherContext);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(GCMCipherContext);
+
+  /**
+   * Returns the context initialized for AES-256-GCM with the given key and
+   * IV, or nullptr on error. The key expansion is skipped if the key and
+   * direction match the previous call.
+   */
+  EVP_CIPHER_CTX* init(bool encrypt, const void* key, const unsigned char* iv) {
+    if (ctx_ == nullptr)
+      return nullptr;
+
+    int rc;
+    if (has_key_ && encrypt_ == encrypt &&
+        std::memcmp(key_, key, Crypto::AES256GCM_KEY_BYTES) == 0) {
+      // Same key and direction; reuse the cached key schedule.
+      rc = encrypt ? EVP_EncryptInit_ex(ctx_, nullptr, nullptr, nullptr, iv) :
+                     EVP_DecryptInit_ex(ctx_, nullptr, nullptr, nullptr, iv);
+    } else {
+      auto key_buf = (const unsigned char*)key;
+      rc = encrypt ?
+               EVP_EncryptInit_ex(
+                   ctx_, EVP_aes_256_gcm(), nullptr, key_buf, iv) :
+               EVP_DecryptInit_ex(
+                   ctx_, EVP_aes_256_gcm(), nullptr, key_buf, iv);
+      has_key_ = rc == 1;
+      encrypt_ = encrypt;
+      if (has_key_)
+        std::memcpy(key_, key, Crypto::AES256GCM_KEY_BYTES);
+    }
+
+    return rc == 1 ? ctx_ : nullptr;
+  }
+
+  /** Invalidates the cached key after a failed cipher operation. */
+  void invalidate() {
+    has_key_ = false;
+  }
+
+ private:
+  /** The underlying OpenSSL context, or nullptr if allocation failed. */
+  EVP_CIPHER_CTX* ctx_;
+
+  /** The key the context was last initialized with. */
+  uint8_t key_[Crypto::AES256GCM_KEY_BYTES];
+
+  /** Whether 'key_' holds a successfully initialized key. */
+  bool has_key_;
+
+  /** Whether the cached key schedule is for encryption or decryption. */
+  bool encrypt_;
+};
+
+/** The per-thread cipher context. */
+static thread_local GCMCipherContext gcm_cipher_context_;
+
 Status OpenSSL::get_random_bytes(unsigned num_bytes, Buffer* output) {
   if (output->free_space() < num_bytes)
     RETURN_NOT_OK(output->realloc(output->alloced_size() + num_bytes));
@@ -97,24 +179,13 @@ Status OpenSSL::encrypt_aes256gcm(
   // Copy IV to output arg.
   std::memcpy(output_iv->cur_data(), iv_buf, iv_len);
 
-  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  // Initialize the cipher from the per-thread context. We use the default
+  // parameter lengths for the IV and tag, so no further configuration is
+  // needed for the cipher.
+  EVP_CIPHER_CTX* ctx = gcm_cipher_context_.init(true, key->data(), iv_buf);
   if (ctx == nullptr)
-    return LOG_STATUS(Status_EncryptionError(
-        "OpenSSL error; cannot encrypt: context allocation failed."));
-
-  // Initialize the cipher. We use the default parameter lengths for the IV and
-  // tag, so no further configuration is needed for the cipher.
-  EVP_CIPHER_CTX_init(ctx);
-  if (EVP_EncryptInit_ex(
-          ctx,
-          EVP_aes_256_gcm(),
-          nullptr,
-          (unsigned char*)key->data(),
-          iv_buf) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error initializing cipher."));
-  }
 
   // Encrypt the input.
   int output_len;
@@ -124,7 +195,7 @@ Status OpenSSL::encrypt_aes256gcm(
           &output_len,
           (const unsigned char*)input->data(),
           (int)input->size()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error encrypting data."));
   }
@@ -134,7 +205,7 @@ Status OpenSSL::encrypt_aes256gcm(
   // Finalize encryption.
   if (EVP_EncryptFinal_ex(
           ctx, (unsigned char*)output->cur_data(), &output_len) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error finalizing encryption."));
   }
@@ -147,14 +218,11 @@ Status OpenSSL::encrypt_aes256gcm(
           EVP_CTRL_GCM_GET_TAG,
           Crypto::AES256GCM_TAG_BYTES,
           (char*)output_tag->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error getting tag."));
   }
 
-  // Clean up.
-  EVP_CIPHER_CTX_free(ctx);
-
   return Status::Ok();
 }
 
@@ -179,24 +247,14 @@ Status OpenSSL::decrypt_aes256gcm(
         "OpenSSL error; cannot decrypt: output buffer too small."));
   }
 
-  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  // Initialize the cipher from the per-thread context. We use the default
+  // parameter lengths for the IV and tag, so no further configuration is
+  // needed for the cipher.
+  EVP_CIPHER_CTX* ctx = gcm_cipher_context_.init(
+      false, key->data(), (const unsigned char*)iv->data());
   if (ctx == nullptr)
-    return LOG_STATUS(Status_EncryptionError(
-        "OpenSSL error; cannot decrypt: context allocation failed."));
-
-  // Initialize the cipher. We use the default parameter lengths for the IV and
-  // tag, so no further configuration is needed for the cipher.
-  EVP_CIPHER_CTX_init(ctx);
-  if (EVP_DecryptInit_ex(
-          ctx,
-          EVP_aes_256_gcm(),
-          nullptr,
-          (unsigned char*)key->data(),
-          (unsigned char*)iv->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error initializing cipher."));
-  }
 
   // Decrypt the input.
   int output_len;
@@ -206,7 +264,7 @@ Status OpenSSL::decrypt_aes256gcm(
           &output_len,
           (const unsigned char*)input->data(),
           (int)input->size()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error decrypting data."));
   }
@@ -220,7 +278,7 @@ Status OpenSSL::decrypt_aes256gcm(
           EVP_CTRL_GCM_SET_TAG,
           Crypto::AES256GCM_TAG_BYTES,
           (char*)tag->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error setting tag."));
   }
@@ -228,7 +286,7 @@ Status OpenSSL::decrypt_aes256gcm(
   // Finalize decryption.
   if (EVP_DecryptFinal_ex(
           ctx, (unsigned char*)output->cur_data(), &output_len) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    gcm_cipher_context_.invalidate();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error finalizing decryption."));
   }
@@ -236,9 +294,6 @@ Status OpenSSL::decrypt_aes256gcm(
     output->advance_size((uint64_t)output_len);
   output->advance_offset((uint64_t)output_len);
 
-  // Clean up.
-  EVP_CIPHER_CTX_free(ctx);
-
   return Status::Ok();
 }
 
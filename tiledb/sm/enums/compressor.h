@@ -64,7 +64,9 @@ enum class Compressor : uint8_t {
   /** Dictionary compressor */
   DICTIONARY_ENCODING = 7,
   /** Delta compressor */
-  DELTA = 8
+  DELTA = 8,
+  /** Per-chunk adaptive compressor selection */
+  ADAPTIVE = 9
 };
 
 /** Returns the string representation of the input compressor. */
@@ -88,6 +90,8 @@ inline const std::string& compressor_str(Compressor type) {
       return constants::double_delta_str;
     case Compressor::DICTIONARY_ENCODING:
       return constants::filter_dictionary_str;
+    case Compressor::ADAPTIVE:
+      return constants::adaptive_str;
     default:
       return constants::empty_str;
   }
@@ -114,15 +118,17 @@ inline Status compressor_enum(
     *compressor = Compressor::DOUBLE_DELTA;
   else if (compressor_type_str == constants::filter_dictionary_str)
     *compressor = Compressor::DICTIONARY_ENCODING;
+  else if (compressor_type_str == constants::adaptive_str)
+    *compressor = Compressor::ADAPTIVE;
   else {
     return Status_Error("Invalid Compressor " + compressor_type_str);
   }
   return Status::Ok();
 }
 
-/** Throws error if the input Compressor enum is not between 0 and 7. */
+/** Throws error if the input Compressor enum is not between 0 and 9. */
 inline void ensure_compressor_is_valid(uint8_t compressor) {
-  if (compressor > 8) {
+  if (compressor > 9) {
     throw std::runtime_error(
         "Invalid Compressor (" + std::to_string(compressor) + ")");
   }
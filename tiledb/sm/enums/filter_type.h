@@ -96,6 +96,12 @@ inline const std::string& filter_type_str(FilterType filter_type) {
       return constants::filter_webp_str;
     case FilterType::FILTER_DELTA:
       return constants::delta_str;
+    case FilterType::FILTER_ADAPTIVE:
+      return constants::adaptive_str;
+    case FilterType::FILTER_CHECKSUM_CRC32C:
+      return constants::filter_checksum_crc32c_str;
+    case FilterType::FILTER_VALIDITY_BIT_PACK:
+      return constants::filter_validity_bit_pack_str;
     default:
       return constants::empty_str;
   }
@@ -140,6 +146,12 @@ inline Status filter_type_enum(
     *filter_type = FilterType::FILTER_WEBP;
   else if (filter_type_str == constants::delta_str)
     *filter_type = FilterType::FILTER_DELTA;
+  else if (filter_type_str == constants::adaptive_str)
+    *filter_type = FilterType::FILTER_ADAPTIVE;
+  else if (filter_type_str == constants::filter_checksum_crc32c_str)
+    *filter_type = FilterType::FILTER_CHECKSUM_CRC32C;
+  else if (filter_type_str == constants::filter_validity_bit_pack_str)
+    *filter_type = FilterType::FILTER_VALIDITY_BIT_PACK;
   else {
     return Status_Error("Invalid FilterType " + filter_type_str);
   }
@@ -148,7 +160,7 @@ inline Status filter_type_enum(
 
 /** Throws error if the input Filtertype enum is not between 0 and 16. */
 inline void ensure_filtertype_is_valid(uint8_t type) {
-  if (type > 18) {
+  if (type > 22) {
     throw std::runtime_error(
         "Invalid FilterType (" + std::to_string(type) + ")");
   }
@@ -32,6 +32,7 @@
 
 #ifdef HAVE_AZURE
 
+#include <chrono>
 #include <sstream>
 
 #include <azure/core/diagnostics/logger.hpp>
@@ -44,6 +45,7 @@
 #include "tiledb/common/stdx_string.h"
 #include "tiledb/platform/cert_file.h"
 #include "tiledb/sm/filesystem/azure.h"
+#include "tiledb/sm/global_state/global_state.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
@@ -153,6 +155,8 @@ AzureParameters::AzureParameters(
     , block_list_block_size_(config.get<uint64_t>(
           "vfs.azure.block_list_block_size", Config::must_find))
     , write_cache_max_size_(max_parallel_ops_ * block_list_block_size_)
+    , max_inflight_blocks_(config.get<uint64_t>(
+          "vfs.azure.max_inflight_blocks", Config::must_find))
     , max_retries_(
           config.get<uint64_t>("vfs.azure.max_retries", Config::must_find))
     , retry_delay_(std::chrono::milliseconds(
@@ -183,6 +187,28 @@ Status Azure::init(const Config& config, ThreadPool* const thread_pool) {
 /*                 API               */
 /* ********************************* */
 
+/**
+ * Builds the transport pool key for an Azure blob service client. Every
+ * configuration parameter that affects the connection or the credentials
+ * must be part of the key so that two contexts only share a client when it
+ * behaves identically for both.
+ */
+static std::string client_pool_key(const AzureParameters& params) {
+  std::stringstream key;
+  key << "azure\n"
+      << params.blob_endpoint_ << "\n"
+      << params.account_name_ << "\n"
+      << params.account_key_ << "\n"
+      << params.has_sas_token_ << "\n"
+      << params.max_retries_ << "\n"
+      << params.retry_delay_.count() << "\n"
+      << params.max_retry_delay_.count() << "\n"
+      << params.ssl_cfg_.ca_file() << "\n"
+      << params.ssl_cfg_.ca_path() << "\n"
+      << params.ssl_cfg_.verify() << "\n";
+  return key.str();
+}
+
 const ::Azure::Storage::Blobs::BlobServiceClient&
 Azure::AzureClientSingleton::get(const AzureParameters& params) {
   // Initialize logging from the Azure SDK.
@@ -213,6 +239,19 @@ Azure::AzureClientSingleton::get(const AzureParameters& params) {
     return *client_;
   }
 
+  // Reuse a pooled client created by a previous context with an identical
+  // connection configuration, if one exists. This skips credential
+  // acquisition and keeps the SDK's TLS connection pool warm across
+  // short-lived contexts.
+  auto& transport_pool =
+      global_state::GlobalState::GetGlobalState().transport_pool();
+  const std::string pool_key = client_pool_key(params);
+  client_ = transport_pool.find<::Azure::Storage::Blobs::BlobServiceClient>(
+      pool_key);
+  if (client_) {
+    return *client_;
+  }
+
   ::Azure::Storage::Blobs::BlobClientOptions options;
   options.Retry.MaxRetries = params.max_retries_;
   options.Retry.RetryDelay = params.retry_delay_;
@@ -229,13 +268,13 @@ Azure::AzureClientSingleton::get(const AzureParameters& params) {
           "Azure storage account name must be set when specifying account key. "
           "Account key will be ignored.");
     } else {
-      client_ =
-          tdb_unique_ptr<::Azure::Storage::Blobs::BlobServiceClient>(tdb_new(
-              ::Azure::Storage::Blobs::BlobServiceClient,
-              params.blob_endpoint_,
-              make_shared<::Azure::Storage::StorageSharedKeyCredential>(
-                  HERE(), params.account_name_, params.account_key_),
-              options));
+      client_ = make_shared<::Azure::Storage::Blobs::BlobServiceClient>(
+          HERE(),
+          params.blob_endpoint_,
+          make_shared<::Azure::Storage::StorageSharedKeyCredential>(
+              HERE(), params.account_name_, params.account_key_),
+          options);
+      client_ = transport_pool.insert(pool_key, client_);
       return *client_;
     }
   }
@@ -269,12 +308,9 @@ Azure::AzureClientSingleton::get(const AzureParameters& params) {
       // https://github.com/Azure/azure-sdk-for-cpp/blob/azure-storage-blobs_12.7.0/sdk/storage/azure-storage-blobs/src/blob_service_client.cpp#L84
       tokenContext.Scopes.emplace_back("https://storage.azure.com/.default");
       std::ignore = credential->GetToken(tokenContext, {});
-      client_ =
-          tdb_unique_ptr<::Azure::Storage::Blobs::BlobServiceClient>(tdb_new(
-              ::Azure::Storage::Blobs::BlobServiceClient,
-              params.blob_endpoint_,
-              credential,
-              options));
+      client_ = make_shared<::Azure::Storage::Blobs::BlobServiceClient>(
+          HERE(), params.blob_endpoint_, credential, options);
+      client_ = transport_pool.insert(pool_key, client_);
       return *client_;
     } catch (...) {
       LOG_INFO(
@@ -283,10 +319,9 @@ Azure::AzureClientSingleton::get(const AzureParameters& params) {
     }
   }
 
-  client_ = tdb_unique_ptr<::Azure::Storage::Blobs::BlobServiceClient>(tdb_new(
-      ::Azure::Storage::Blobs::BlobServiceClient,
-      params.blob_endpoint_,
-      options));
+  client_ = make_shared<::Azure::Storage::Blobs::BlobServiceClient>(
+      HERE(), params.blob_endpoint_, options);
+  client_ = transport_pool.insert(pool_key, client_);
 
   return *client_;
 }
@@ -351,6 +386,9 @@ Status Azure::flush_blob(const URI& uri) {
     state = &block_list_upload_states_.at(uri.to_string());
   }
 
+  // Drain any pipelined block uploads before committing the block list.
+  state->wait_inflight_tasks(thread_pool_);
+
   std::string container_name;
   std::string blob_path;
   RETURN_NOT_OK(parse_azure_uri(uri, &container_name, &blob_path));
@@ -699,6 +737,24 @@ Status Azure::move_dir(const URI& old_uri, const URI& new_uri) {
   return Status::Ok();
 }
 
+Status Azure::copy_file(const URI& old_uri, const URI& new_uri) {
+  return copy_blob(old_uri, new_uri);
+}
+
+Status Azure::copy_dir(const URI& old_uri, const URI& new_uri) {
+  std::vector<std::string> paths;
+  RETURN_NOT_OK(ls(old_uri, &paths, ""));
+  auto status = parallel_for(thread_pool_, 0, paths.size(), [&](size_t i) {
+    const std::string suffix = paths[i].substr(old_uri.to_string().size());
+    const URI new_path = new_uri.join_path(suffix);
+    throw_if_not_ok(copy_blob(URI(paths[i]), new_path));
+    return Status::Ok();
+  });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
 Status Azure::blob_size(const URI& uri, uint64_t* const nbytes) const {
   auto& c = client();
   assert(nbytes);
@@ -1053,6 +1109,11 @@ Status Azure::write_blocks(
   std::string blob_path;
   RETURN_NOT_OK(parse_azure_uri(uri, &container_name, &blob_path));
 
+  if (azure_params_->max_inflight_blocks_ > 0) {
+    return write_blocks_pipelined(
+        container_name, blob_path, state, buffer, length);
+  }
+
   if (num_ops == 1) {
     const std::string block_id = state->next_block_id();
 
@@ -1092,6 +1153,51 @@ Status Azure::write_blocks(
   return Status::Ok();
 }
 
+Status Azure::write_blocks_pipelined(
+    const std::string& container_name,
+    const std::string& blob_path,
+    BlockListUploadState* const state,
+    const void* const buffer,
+    const uint64_t length) {
+  assert(azure_params_);
+  const uint64_t max_inflight = azure_params_->max_inflight_blocks_;
+
+  uint64_t offset = 0;
+  while (offset < length) {
+    const uint64_t block_size =
+        state->pipelined_block_size(azure_params_->block_list_block_size_);
+    const uint64_t thread_buffer_len = std::min(length - offset, block_size);
+
+    // Stage an owned copy of the block so that the upload can continue
+    // after the caller releases its buffer.
+    auto block = make_shared<Buffer>(HERE());
+    RETURN_NOT_OK(block->write(
+        static_cast<const char*>(buffer) + offset, thread_buffer_len));
+
+    const std::string block_id = state->next_block_id();
+    ThreadPool::Task task = thread_pool_->execute(
+        [this, container_name, blob_path, block, block_id, state]() {
+          const auto start = std::chrono::steady_clock::now();
+          const Status st = upload_block(
+              container_name, blob_path, block->data(), block->size(),
+              block_id);
+          if (st.ok()) {
+            state->record_upload_duration(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+          }
+          return st;
+        });
+    RETURN_NOT_OK(state->enqueue_inflight_task(
+        thread_pool_, std::move(task), max_inflight));
+
+    offset += thread_buffer_len;
+  }
+
+  return Status::Ok();
+}
+
 LsObjects Azure::list_blobs_impl(
     const std::string& container_name,
     const std::string& blob_path,
@@ -48,6 +48,8 @@
 #if !defined(NOMINMAX)
 #define NOMINMAX  // avoid min/max macros from windows headers
 #endif
+#include <atomic>
+#include <deque>
 #include <list>
 #include <unordered_map>
 
@@ -95,6 +97,12 @@ struct AzureParameters {
   /**  The maximum size of each value-element in 'write_cache_map_'. */
   uint64_t write_cache_max_size_;
 
+  /**
+   * The maximum number of pipelined in-flight block uploads per blob. Zero
+   * uploads blocks in synchronous batches instead.
+   */
+  uint64_t max_inflight_blocks_;
+
   /** The maximum number of retries. */
   int max_retries_;
 
@@ -465,6 +473,28 @@ class Azure {
    */
   Status move_dir(const URI& old_uri, const URI& new_uri);
 
+  /**
+   * Copies a blob. The copy is performed server-side; no data passes
+   * through the client.
+   *
+   * @param old_uri The URI of the blob to be copied.
+   * @param new_uri The URI of the copy destination.
+   * @return Status
+   */
+  Status copy_file(const URI& old_uri, const URI& new_uri);
+
+  /**
+   * Copies a directory. All the blobs with directory prefix `old_uri`
+   * are copied, in parallel, to new blobs with prefix `new_uri`. The
+   * copies are performed server-side; no data passes through the
+   * client.
+   *
+   * @param old_uri The URI of the old path.
+   * @param new_uri The URI of the new path.
+   * @return Status
+   */
+  Status copy_dir(const URI& old_uri, const URI& new_uri);
+
   /**
    * Returns the size of the input blob with a given URI in bytes.
    *
@@ -590,7 +620,17 @@ class Azure {
    public:
     BlockListUploadState()
         : next_block_id_(0)
-        , st_(Status::Ok()) {
+        , st_(Status::Ok())
+        , block_size_multiplier_(1) {
+    }
+
+    /** Move constructor. Must not race with in-flight uploads. */
+    BlockListUploadState(BlockListUploadState&& other) noexcept
+        : next_block_id_(other.next_block_id_)
+        , block_ids_(std::move(other.block_ids_))
+        , st_(std::move(other.st_))
+        , block_size_multiplier_(other.block_size_multiplier_.load())
+        , inflight_tasks_(std::move(other.inflight_tasks_)) {
     }
 
     /* Generates the next base64-encoded block id. */
@@ -613,7 +653,70 @@ class Azure {
       }
     }
 
+    /**
+     * Returns the current pipelined block size: the configured block size
+     * scaled by the adaptive multiplier.
+     */
+    uint64_t pipelined_block_size(const uint64_t base_block_size) const {
+      return base_block_size * block_size_multiplier_.load();
+    }
+
+    /**
+     * Feeds an observed block upload duration back into the adaptive block
+     * sizing. An upload finishing well under a second is latency-bound, so
+     * doubling the block size cuts the per-request overhead without
+     * lengthening the pipeline stages noticeably; a slow upload halves it
+     * again so that a congested network does not pin large buffers.
+     */
+    void record_upload_duration(const uint64_t duration_ms) {
+      uint64_t multiplier = block_size_multiplier_.load();
+      if (duration_ms < 250 && multiplier < max_block_size_multiplier) {
+        block_size_multiplier_.compare_exchange_strong(
+            multiplier, 2 * multiplier);
+      } else if (duration_ms > 4000 && multiplier > 1) {
+        block_size_multiplier_.compare_exchange_strong(
+            multiplier, multiplier / 2);
+      }
+    }
+
+    /**
+     * Queues a pipelined block upload, blocking the writer on the oldest
+     * queued upload while more than `max_inflight` are in flight.
+     *
+     * @param tp The thread pool the uploads execute on.
+     * @param task The upload task to queue.
+     * @param max_inflight The maximum number of in-flight uploads.
+     * @return Status
+     */
+    Status enqueue_inflight_task(
+        ThreadPool* const tp,
+        ThreadPool::Task&& task,
+        const uint64_t max_inflight) {
+      inflight_tasks_.emplace_back(std::move(task));
+      while (inflight_tasks_.size() > max_inflight) {
+        const Status st = tp->wait(inflight_tasks_.front());
+        inflight_tasks_.pop_front();
+        update_st(st);
+        RETURN_NOT_OK(st);
+      }
+      return Status::Ok();
+    }
+
+    /**
+     * Waits for all queued pipelined uploads, folding their return
+     * statuses into the aggregate status.
+     */
+    void wait_inflight_tasks(ThreadPool* const tp) {
+      while (!inflight_tasks_.empty()) {
+        update_st(tp->wait(inflight_tasks_.front()));
+        inflight_tasks_.pop_front();
+      }
+    }
+
    private:
+    // The maximum adaptive block size multiplier.
+    static constexpr uint64_t max_block_size_multiplier = 64;
+
     // The next block id to generate.
     uint64_t next_block_id_;
 
@@ -623,6 +726,12 @@ class Azure {
     // The aggregate status. If any individual block
     // upload fails, this will be in a non-OK status.
     Status st_;
+
+    // The adaptive block size multiplier, written by upload tasks.
+    std::atomic<uint64_t> block_size_multiplier_;
+
+    // The pipelined uploads still in flight, oldest first.
+    std::deque<ThreadPool::Task> inflight_tasks_;
   };
 
   /**
@@ -644,8 +753,11 @@ class Azure {
         const AzureParameters& params);
 
    private:
-    /** The Azure blob service client. */
-    tdb_unique_ptr<::Azure::Storage::Blobs::BlobServiceClient> client_;
+    /**
+     * The Azure blob service client. Shared with the process-wide transport
+     * pool, so it may outlive this instance.
+     */
+    shared_ptr<::Azure::Storage::Blobs::BlobServiceClient> client_;
 
     /** Protects from creating the client many times. */
     std::mutex client_init_mtx_;
@@ -737,6 +849,27 @@ class Azure {
   Status write_blocks(
       const URI& uri, const void* buffer, uint64_t length, bool last_block);
 
+  /**
+   * Writes the input buffer as uncommited blocks through the pipelined
+   * uploader. Each block is staged into an owned copy and its upload is
+   * queued immediately; the writer only blocks while the configured number
+   * of in-flight uploads is exceeded. Block sizes adapt to the observed
+   * upload durations.
+   *
+   * @param container_name The blob's container name.
+   * @param blob_path The blob's file path relative to the container.
+   * @param state The block list upload state of the blob.
+   * @param buffer The input buffer.
+   * @param length The size of the input buffer.
+   * @return Status
+   */
+  Status write_blocks_pipelined(
+      const std::string& container_name,
+      const std::string& blob_path,
+      BlockListUploadState* state,
+      const void* buffer,
+      uint64_t length);
+
   /**
    * Executes and waits for a single, uncommited block upload.
    *
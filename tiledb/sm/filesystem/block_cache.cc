@@ -0,0 +1,337 @@
+/**
+ * @file   block_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class BlockCache.
+ */
+
+#include "tiledb/sm/filesystem/block_cache.h"
+#include "tiledb/sm/buffer/buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+using namespace tiledb::common;
+
+namespace tiledb::sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+BlockCache::BlockCache(
+    const std::string& dir, const uint64_t max_size, const uint64_t block_size)
+    : dir_(dir)
+    , max_size_(max_size)
+    , block_size_(block_size)
+    , current_size_(0)
+    , tmp_file_counter_(0) {
+  if (block_size_ == 0) {
+    throw BlockCacheException("The block size cannot be zero.");
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(dir_, ec);
+  if (ec) {
+    throw BlockCacheException(
+        "Failed to create the cache directory '" + dir + "'; " + ec.message());
+  }
+
+  load_persisted_blocks();
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+Status BlockCache::read(
+    const ReadFn& read_fn,
+    const URI& uri,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes) {
+  const std::string encoded_uri = encode_uri(uri.to_string());
+
+  // Serve the requested range block by block.
+  uint64_t nbytes_copied = 0;
+  while (nbytes_copied < nbytes) {
+    const uint64_t block_index = (offset + nbytes_copied) / block_size_;
+    const uint64_t offset_in_block =
+        offset + nbytes_copied - block_index * block_size_;
+    const uint64_t len =
+        std::min(nbytes - nbytes_copied, block_size_ - offset_in_block);
+    const std::string key =
+        encoded_uri + "_" + std::to_string(block_index) + ".blk";
+    void* const dest = static_cast<uint8_t*>(buffer) + nbytes_copied;
+
+    if (!read_cached_block(key, offset_in_block, dest, len)) {
+      RETURN_NOT_OK(fetch_block(
+          read_fn, uri, block_index, key, offset_in_block, dest, len));
+    }
+
+    nbytes_copied += len;
+  }
+
+  return Status::Ok();
+}
+
+void BlockCache::pin(const URI& uri) {
+  const std::string prefix = encode_uri(uri.to_string());
+  std::lock_guard<std::mutex> lg(mtx_);
+  if (std::find(pinned_prefixes_.begin(), pinned_prefixes_.end(), prefix) !=
+      pinned_prefixes_.end()) {
+    return;
+  }
+  pinned_prefixes_.emplace_back(prefix);
+  for (auto& [key, block] : blocks_) {
+    if (key.compare(0, prefix.size(), prefix) == 0) {
+      block.pinned_ = true;
+    }
+  }
+}
+
+void BlockCache::unpin(const URI& uri) {
+  const std::string prefix = encode_uri(uri.to_string());
+  std::lock_guard<std::mutex> lg(mtx_);
+  const auto it =
+      std::find(pinned_prefixes_.begin(), pinned_prefixes_.end(), prefix);
+  if (it == pinned_prefixes_.end()) {
+    return;
+  }
+  pinned_prefixes_.erase(it);
+  for (auto& [key, block] : blocks_) {
+    if (block.pinned_ && key.compare(0, prefix.size(), prefix) == 0) {
+      block.pinned_ = pinned(key);
+    }
+  }
+  evict_lru_blocks();
+}
+
+/* ********************************* */
+/*          PRIVATE METHODS          */
+/* ********************************* */
+
+std::string BlockCache::encode_uri(const std::string& uri_str) {
+  std::stringstream ss;
+  for (const unsigned char c : uri_str) {
+    // The underscore is reserved as the block index separator.
+    if (std::isalnum(c) || c == '.' || c == '-') {
+      ss << c;
+    } else {
+      ss << '%' << std::hex << std::setw(2) << std::setfill('0')
+         << static_cast<int>(c) << std::dec;
+    }
+  }
+  return ss.str();
+}
+
+std::filesystem::path BlockCache::block_path(const std::string& key) const {
+  return dir_ / key;
+}
+
+bool BlockCache::pinned(const std::string& key) const {
+  for (const auto& prefix : pinned_prefixes_) {
+    if (key.compare(0, prefix.size(), prefix) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BlockCache::read_cached_block(
+    const std::string& key,
+    const uint64_t offset_in_block,
+    void* const buffer,
+    const uint64_t nbytes) {
+  {
+    std::lock_guard<std::mutex> lg(mtx_);
+    const auto it = blocks_.find(key);
+
+    // A cached block may be shorter than the requested range when it was
+    // fetched for an earlier read that needed fewer of its bytes; treat
+    // it as a miss so that the fetch replaces it with a longer block.
+    if (it == blocks_.end() || it->second.size_ < offset_in_block + nbytes) {
+      return false;
+    }
+
+    // Touch the block to make it the most recently used one.
+    lru_.splice(lru_.end(), lru_, it->second.lru_it_);
+  }
+
+  std::ifstream file(block_path(key), std::ios::binary);
+  if (file) {
+    file.seekg(static_cast<std::streamoff>(offset_in_block));
+    file.read(
+        static_cast<char*>(buffer), static_cast<std::streamsize>(nbytes));
+    if (static_cast<uint64_t>(file.gcount()) == nbytes) {
+      return true;
+    }
+  }
+
+  // The block file was removed or truncated behind our back; drop it from
+  // the index and fall back to a fetch.
+  std::lock_guard<std::mutex> lg(mtx_);
+  const auto it = blocks_.find(key);
+  if (it != blocks_.end()) {
+    current_size_ -= it->second.size_;
+    lru_.erase(it->second.lru_it_);
+    blocks_.erase(it);
+  }
+  return false;
+}
+
+Status BlockCache::fetch_block(
+    const ReadFn& read_fn,
+    const URI& uri,
+    const uint64_t block_index,
+    const std::string& key,
+    const uint64_t offset_in_block,
+    void* const buffer,
+    const uint64_t nbytes) {
+  Buffer block;
+  RETURN_NOT_OK(block.realloc(block_size_));
+
+  // Only the block prefix covering the requested range is known to exist
+  // in the object; the rest of the block is a best-effort read-ahead that
+  // may be cut short by the end of the object.
+  const uint64_t required = offset_in_block + nbytes;
+  uint64_t nbytes_read = 0;
+  RETURN_NOT_OK(read_fn(
+      uri,
+      static_cast<off_t>(block_index * block_size_),
+      block.data(),
+      required,
+      block_size_ - required,
+      &nbytes_read));
+  assert(nbytes_read >= required);
+
+  // Copy the requested range back into the caller's output `buffer`.
+  std::memcpy(
+      buffer,
+      static_cast<uint8_t*>(block.data()) + offset_in_block,
+      nbytes);
+
+  insert_block(key, block.data(), nbytes_read);
+  return Status::Ok();
+}
+
+void BlockCache::insert_block(
+    const std::string& key, const void* const data, const uint64_t size) {
+  // Write to a temporary name first so that a concurrent reader never sees
+  // a partially written block file.
+  const auto path = block_path(key);
+  const auto tmp_path =
+      dir_ / (key + ".tmp" + std::to_string(tmp_file_counter_.fetch_add(1)));
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    file.write(
+        static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (!file) {
+      std::error_code ec;
+      std::filesystem::remove(tmp_path, ec);
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    std::filesystem::remove(tmp_path, ec);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lg(mtx_);
+  const auto it = blocks_.find(key);
+  if (it != blocks_.end()) {
+    current_size_ -= it->second.size_;
+    current_size_ += size;
+    it->second.size_ = size;
+    lru_.splice(lru_.end(), lru_, it->second.lru_it_);
+  } else {
+    const auto lru_it = lru_.insert(lru_.end(), key);
+    blocks_[key] = Block{size, pinned(key), lru_it};
+    current_size_ += size;
+  }
+  evict_lru_blocks();
+}
+
+void BlockCache::evict_lru_blocks() {
+  auto it = lru_.begin();
+  while (current_size_ > max_size_ && it != lru_.end()) {
+    const auto block_it = blocks_.find(*it);
+    if (block_it->second.pinned_) {
+      ++it;
+      continue;
+    }
+    std::error_code ec;
+    std::filesystem::remove(block_path(*it), ec);
+    current_size_ -= block_it->second.size_;
+    blocks_.erase(block_it);
+    it = lru_.erase(it);
+  }
+}
+
+void BlockCache::load_persisted_blocks() {
+  // Collect the persisted block files and approximate the LRU order of the
+  // previous processes with the file modification times.
+  std::vector<std::pair<std::filesystem::file_time_type, std::string>> found;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator(dir_, ec)) {
+    const auto name = entry.path().filename().string();
+    if (name.find(".blk.tmp") != std::string::npos) {
+      // Remove temporary files left behind by a crashed process.
+      std::filesystem::remove(entry.path(), ec);
+      continue;
+    }
+    if (name.size() < 4 || name.compare(name.size() - 4, 4, ".blk") != 0 ||
+        !entry.is_regular_file()) {
+      continue;
+    }
+    found.emplace_back(entry.last_write_time(), name);
+  }
+  std::sort(found.begin(), found.end());
+
+  for (const auto& [mtime, name] : found) {
+    const uint64_t size = std::filesystem::file_size(dir_ / name, ec);
+    if (ec) {
+      continue;
+    }
+    const auto lru_it = lru_.insert(lru_.end(), name);
+    blocks_[name] = Block{size, false, lru_it};
+    current_size_ += size;
+  }
+
+  evict_lru_blocks();
+}
+
+}  // namespace tiledb::sm
@@ -0,0 +1,269 @@
+/**
+ * @file   block_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class BlockCache.
+ */
+
+#ifndef TILEDB_BLOCK_CACHE_H
+#define TILEDB_BLOCK_CACHE_H
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+using namespace tiledb::common;
+
+namespace tiledb::sm {
+
+/** Class for block cache status exceptions. */
+class BlockCacheException : public StatusException {
+ public:
+  explicit BlockCacheException(const std::string& message)
+      : StatusException("BlockCache", message) {
+  }
+};
+
+/**
+ * A read-through block cache that persists remote object data on a local
+ * disk, layered between the VFS and the object-store backends.
+ *
+ * Reads are served in fixed-size blocks: on a miss, the whole block covering
+ * the requested range is fetched from the backend and written to a file in
+ * the cache directory, so repeated reads of the same data across process
+ * restarts become local I/O. Blocks are evicted in LRU order against a byte
+ * budget, except for blocks under a pinned URI prefix.
+ *
+ * Because TileDB fragment data is immutable, cached blocks are never
+ * invalidated; removing an object from the cache directory is always safe.
+ * Cache insertion is best-effort: a block that cannot be written locally is
+ * still returned to the caller and simply not cached.
+ */
+class BlockCache {
+ public:
+  /* ********************************* */
+  /*          TYPE DEFINITIONS         */
+  /* ********************************* */
+
+  /**
+   * The backend read routine used to fetch blocks. The arguments are the
+   * URI, offset, buffer, number of required bytes, number of additional
+   * best-effort bytes, and the returned number of bytes read.
+   */
+  using ReadFn = std::function<Status(
+      const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  BlockCache() = delete;
+
+  /**
+   * Constructor. Creates the cache directory if it does not exist and
+   * adopts the block files persisted by previous processes, ordered from
+   * least to most recently used by their modification times.
+   *
+   * @param dir The local directory holding the cached block files.
+   * @param max_size The cache byte budget, enforced by LRU eviction.
+   * @param block_size The byte size of a cached block.
+   */
+  BlockCache(const std::string& dir, uint64_t max_size, uint64_t block_size);
+
+  /** Destructor. */
+  ~BlockCache() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(BlockCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(BlockCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Reads a byte range of a URI through the cache. Cached blocks are read
+   * from the local disk; missing blocks are fetched with `read_fn`, copied
+   * to the caller and inserted into the cache.
+   *
+   * @param read_fn The backend read routine to fetch missing blocks with.
+   * @param uri The URI of the object to read.
+   * @param offset The offset where the read begins.
+   * @param buffer The buffer to read into.
+   * @param nbytes Number of bytes to read.
+   * @return Status
+   */
+  Status read(
+      const ReadFn& read_fn,
+      const URI& uri,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes);
+
+  /**
+   * Pins all present and future blocks of URIs starting with `uri`,
+   * excluding them from eviction. Pinning a fragment URI keeps every file
+   * of the fragment resident. Pinned blocks may hold the cache above its
+   * byte budget.
+   *
+   * @param uri The URI prefix to pin.
+   */
+  void pin(const URI& uri);
+
+  /**
+   * Unpins a URI prefix previously passed to `pin`, making its blocks
+   * evictable again.
+   *
+   * @param uri The URI prefix to unpin.
+   */
+  void unpin(const URI& uri);
+
+ private:
+  /* ********************************* */
+  /*        PRIVATE DATATYPES          */
+  /* ********************************* */
+
+  /** Bookkeeping for one cached block file. */
+  struct Block {
+    /** The byte size of the block file. */
+    uint64_t size_;
+
+    /** Whether the block is excluded from eviction. */
+    bool pinned_;
+
+    /** The block's position in the LRU list. */
+    std::list<std::string>::iterator lru_it_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The local directory holding the cached block files. */
+  std::filesystem::path dir_;
+
+  /** The cache byte budget. */
+  uint64_t max_size_;
+
+  /** The byte size of a cached block. */
+  uint64_t block_size_;
+
+  /** The total byte size of the cached block files. */
+  uint64_t current_size_;
+
+  /** Names temporary files uniquely during block insertion. */
+  std::atomic<uint64_t> tmp_file_counter_;
+
+  /** Protects the block index, the LRU list and the pinned prefixes. */
+  std::mutex mtx_;
+
+  /** The cached block keys, from least to most recently used. */
+  std::list<std::string> lru_;
+
+  /** Maps a block key to its bookkeeping entry. */
+  std::unordered_map<std::string, Block> blocks_;
+
+  /** The encoded URI prefixes currently pinned. */
+  std::vector<std::string> pinned_prefixes_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Encodes a URI string into a filename-safe form. The encoding is
+   * per-character, so a URI prefix encodes to a filename prefix.
+   */
+  static std::string encode_uri(const std::string& uri_str);
+
+  /** Returns the path of the block file for `key`. */
+  std::filesystem::path block_path(const std::string& key) const;
+
+  /** Returns true if `key` falls under a pinned URI prefix. */
+  bool pinned(const std::string& key) const;
+
+  /**
+   * Attempts to copy `[offset_in_block, offset_in_block + nbytes)` of a
+   * cached block into `buffer`. Returns false if the block is absent or
+   * does not cover the range; a block file that was removed behind our
+   * back is dropped from the index.
+   */
+  bool read_cached_block(
+      const std::string& key,
+      uint64_t offset_in_block,
+      void* buffer,
+      uint64_t nbytes);
+
+  /**
+   * Fetches the block covering the requested range from the backend,
+   * copies the range into `buffer` and inserts the block into the cache.
+   *
+   * @param read_fn The backend read routine.
+   * @param uri The URI of the object to read.
+   * @param block_index The index of the block to fetch.
+   * @param key The cache key of the block.
+   * @param offset_in_block The requested offset within the block.
+   * @param buffer The buffer to copy the requested range into.
+   * @param nbytes The number of requested bytes within the block.
+   * @return Status
+   */
+  Status fetch_block(
+      const ReadFn& read_fn,
+      const URI& uri,
+      uint64_t block_index,
+      const std::string& key,
+      uint64_t offset_in_block,
+      void* buffer,
+      uint64_t nbytes);
+
+  /**
+   * Writes a block file and records it in the index, evicting LRU blocks
+   * if the byte budget is exceeded. Failures to write the file are
+   * swallowed; the cache then simply does not retain the block.
+   */
+  void insert_block(const std::string& key, const void* data, uint64_t size);
+
+  /** Evicts unpinned LRU blocks while over budget. Caller holds `mtx_`. */
+  void evict_lru_blocks();
+
+  /** Adopts the block files persisted in `dir_` by previous processes. */
+  void load_persisted_blocks();
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_BLOCK_CACHE_H
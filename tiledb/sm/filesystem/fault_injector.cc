@@ -0,0 +1,112 @@
+/**
+ * @file   fault_injector.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class FaultInjector.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "tiledb/sm/filesystem/fault_injector.h"
+#include "tiledb/sm/filesystem/vfs.h"
+
+namespace tiledb::sm {
+
+FaultInjector::FaultInjector(const Config& config)
+    : mean_latency_ms_(
+          config.get<double>("vfs.fault_injection.mean_latency_ms").value())
+    , bandwidth_mbps_(
+          config.get<uint64_t>("vfs.fault_injection.bandwidth_mbps").value())
+    , throttle_rate_(
+          config.get<double>("vfs.fault_injection.throttle_rate").value())
+    , max_retries_(
+          config.get<uint32_t>("vfs.fault_injection.max_retries").value())
+    , rng_(config.get<uint64_t>("vfs.fault_injection.seed").value()) {
+  enabled_ =
+      mean_latency_ms_ > 0 || bandwidth_mbps_ > 0 || throttle_rate_ > 0;
+}
+
+void FaultInjector::inject_meta_op() {
+  if (!enabled_) {
+    return;
+  }
+
+  const auto delay_us = operation_delay_us(0);
+  if (delay_us > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(delay_us));
+  }
+}
+
+void FaultInjector::inject_data_op(const uint64_t nbytes) {
+  if (!enabled_) {
+    return;
+  }
+
+  // A transfer of n bytes at b MB/s takes n/b microseconds.
+  const uint64_t transfer_us =
+      bandwidth_mbps_ == 0 ? 0 : nbytes / bandwidth_mbps_;
+  const auto delay_us = operation_delay_us(transfer_us);
+  if (delay_us > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(delay_us));
+  }
+}
+
+uint64_t FaultInjector::operation_delay_us(const uint64_t transfer_us) {
+  uint64_t delay_us = transfer_us;
+
+  // The random draws are serialized so that the injected sequence only
+  // depends on the seed and the order of the operations; the sleeps
+  // happen outside the lock.
+  std::unique_lock<std::mutex> lock(rng_mtx_);
+
+  if (mean_latency_ms_ > 0) {
+    std::exponential_distribution<double> latency(1.0 / mean_latency_ms_);
+    delay_us += static_cast<uint64_t>(latency(rng_) * 1000);
+  }
+
+  if (throttle_rate_ > 0) {
+    // Mimic the S3 retry schedule on 503 responses: every throttled
+    // attempt backs off exponentially, and the error surfaces only when
+    // the whole schedule is throttled.
+    std::uniform_real_distribution<double> throttled(0.0, 1.0);
+    uint32_t attempt = 0;
+    while (throttled(rng_) < throttle_rate_) {
+      if (++attempt >= max_retries_) {
+        throw filesystem::VFSException(
+            "Injected throttling error; the operation was throttled on " +
+            std::to_string(max_retries_) + " attempts.");
+      }
+      delay_us += (uint64_t(25) << attempt) * 1000;
+    }
+  }
+
+  return delay_us;
+}
+
+}  // namespace tiledb::sm
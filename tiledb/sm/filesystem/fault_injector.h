@@ -0,0 +1,137 @@
+/**
+ * @file   fault_injector.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FaultInjector.
+ */
+
+#ifndef TILEDB_FAULT_INJECTOR_H
+#define TILEDB_FAULT_INJECTOR_H
+
+#include <mutex>
+#include <random>
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/config/config.h"
+
+using namespace tiledb::common;
+
+namespace tiledb::sm {
+
+/**
+ * Injects object-store behavior into the in-memory filesystem: per-op
+ * latency, a bandwidth cap on data transfers and throttling errors with
+ * retry-like backoff, mimicking how the S3 backend handles 503 responses.
+ * Benchmarks and tests configure it through the `vfs.fault_injection.*`
+ * parameters to reproduce cloud-only performance behavior locally and
+ * deterministically: the injected delays and errors are drawn from a
+ * seeded generator, so a run is repeatable given the same parameters.
+ *
+ * The injector is disabled by default and all its methods are no-ops in
+ * that state.
+ */
+class FaultInjector {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor from the VFS configuration. */
+  explicit FaultInjector(const Config& config);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if any injection parameter is set. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Injects the configured latency and throttling for a metadata
+   * operation (file size, listing, creation, removal, move).
+   *
+   * @throws VFSException if a throttling error is injected on every
+   *    attempt of the retry schedule.
+   */
+  void inject_meta_op();
+
+  /**
+   * Injects the configured latency, bandwidth delay and throttling for a
+   * data operation.
+   *
+   * @param nbytes Number of bytes transferred by the operation.
+   * @throws VFSException if a throttling error is injected on every
+   *    attempt of the retry schedule.
+   */
+  void inject_data_op(uint64_t nbytes);
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Runs the throttling and latency schedule of one operation and
+   * returns the total time to sleep, in microseconds.
+   *
+   * @param transfer_us Bandwidth delay of the operation, in microseconds.
+   * @return Time to sleep, in microseconds.
+   */
+  uint64_t operation_delay_us(uint64_t transfer_us);
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether any injection parameter is set. */
+  bool enabled_;
+
+  /** Mean per-op latency, in milliseconds. Zero injects no latency. */
+  double mean_latency_ms_;
+
+  /** Bandwidth cap on data transfers, in MB/s. Zero means uncapped. */
+  uint64_t bandwidth_mbps_;
+
+  /** Probability that an attempt gets a throttling error. */
+  double throttle_rate_;
+
+  /** Number of attempts before a throttling error surfaces. */
+  uint32_t max_retries_;
+
+  /** Deterministic generator for latencies and throttling decisions. */
+  std::mt19937_64 rng_;
+
+  /** Protects `rng_`. */
+  std::mutex rng_mtx_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_FAULT_INJECTOR_H
@@ -53,6 +53,7 @@
 #include "tiledb/common/unique_rwlock.h"
 #include "tiledb/platform/cert_file.h"
 #include "tiledb/sm/filesystem/gcs.h"
+#include "tiledb/sm/global_state/global_state.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
@@ -221,6 +222,28 @@ Status GCS::init_client() const {
     return Status::Ok();
   }
 
+  // Reuse a pooled client created by a previous context with an identical
+  // connection configuration, if one exists. This skips credential
+  // acquisition and keeps the client's connection pool warm across
+  // short-lived contexts. Every configuration parameter that affects the
+  // connection or the credentials must be part of the key.
+  auto& transport_pool =
+      global_state::GlobalState::GetGlobalState().transport_pool();
+  std::stringstream pool_key_ss;
+  pool_key_ss << "gcs\n"
+              << endpoint_ << "\n"
+              << project_id_ << "\n"
+              << service_account_key_ << "\n"
+              << workload_identity_configuration_ << "\n"
+              << impersonate_service_account_ << "\n"
+              << request_timeout_ms_ << "\n"
+              << ssl_cfg_.ca_file() << "\n";
+  const std::string pool_key = pool_key_ss.str();
+  client_ = transport_pool.find<google::cloud::storage::Client>(pool_key);
+  if (client_) {
+    return Status::Ok();
+  }
+
   google::cloud::Options ca_options;
   if (!ssl_cfg_.ca_file().empty()) {
     ca_options.set<google::cloud::CARootsFilePathOption>(ssl_cfg_.ca_file());
@@ -252,8 +275,9 @@ Status GCS::init_client() const {
     client_options.set<google::cloud::storage::RetryPolicyOption>(
         make_shared<google::cloud::storage::LimitedTimeRetryPolicy>(
             HERE(), std::chrono::milliseconds(request_timeout_ms_)));
-    client_ = tdb_unique_ptr<google::cloud::storage::Client>(
-        tdb_new(google::cloud::storage::Client, client_options));
+    client_ =
+        make_shared<google::cloud::storage::Client>(HERE(), client_options);
+    client_ = transport_pool.insert(pool_key, client_);
   } catch (const std::exception& e) {
     return LOG_STATUS(
         Status_GCSError("Failed to initialize GCS: " + std::string(e.what())));
@@ -758,6 +782,26 @@ Status GCS::move_dir(const URI& old_uri, const URI& new_uri) {
   return Status::Ok();
 }
 
+Status GCS::copy_file(const URI& old_uri, const URI& new_uri) {
+  return copy_object(old_uri, new_uri);
+}
+
+Status GCS::copy_dir(const URI& old_uri, const URI& new_uri) {
+  RETURN_NOT_OK(init_client());
+
+  std::vector<std::string> paths;
+  RETURN_NOT_OK(ls(old_uri, &paths, ""));
+  auto status = parallel_for(thread_pool_, 0, paths.size(), [&](size_t i) {
+    const std::string suffix = paths[i].substr(old_uri.to_string().size());
+    const URI new_path = new_uri.join_path(suffix);
+    throw_if_not_ok(copy_object(URI(paths[i]), new_path));
+    return Status::Ok();
+  });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
 Status GCS::touch(const URI& uri) const {
   RETURN_NOT_OK(init_client());
 
@@ -1018,6 +1062,14 @@ Status GCS::write_parts(
       if (exists) {
         RETURN_NOT_OK(remove_object(uri));
       }
+
+      // Provide a best-effort attempt to delete any part objects left
+      // behind by a process that crashed mid-upload, so they are neither
+      // leaked nor mistaken for parts of this upload.
+      google::cloud::storage::DeleteByPrefix(
+          *client_,
+          bucket_name,
+          remove_trailing_slash(object_path) + "__tiledb_");
     } else {
       // If another thread switched state, switch back to a read lock
       state = &multi_part_upload_states_.at(uri.to_string());
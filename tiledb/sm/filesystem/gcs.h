@@ -294,6 +294,28 @@ class GCS {
    */
   Status move_dir(const URI& old_uri, const URI& new_uri);
 
+  /**
+   * Copies an object. The copy is performed server-side; no data
+   * passes through the client.
+   *
+   * @param old_uri The URI of the object to be copied.
+   * @param new_uri The URI of the copy destination.
+   * @return Status
+   */
+  Status copy_file(const URI& old_uri, const URI& new_uri);
+
+  /**
+   * Copies a directory. All the objects with directory prefix
+   * `old_uri` are copied, in parallel, to new objects with prefix
+   * `new_uri`. The copies are performed server-side; no data passes
+   * through the client.
+   *
+   * @param old_uri The URI of the old path.
+   * @param new_uri The URI of the new path.
+   * @return Status
+   */
+  Status copy_dir(const URI& old_uri, const URI& new_uri);
+
   /**
    * Creates an empty object.
    *
@@ -486,8 +508,9 @@ class GCS {
   // A comma-separated list with the GCS service accounts to impersonate.
   std::string impersonate_service_account_;
 
-  // The GCS REST client.
-  mutable tdb_unique_ptr<google::cloud::storage::Client> client_;
+  // The GCS REST client. Shared with the process-wide transport pool, so it
+  // may outlive this instance.
+  mutable shared_ptr<google::cloud::storage::Client> client_;
 
   /** Maps a object URI to an write cache buffer. */
   std::unordered_map<std::string, Buffer> write_cache_map_;
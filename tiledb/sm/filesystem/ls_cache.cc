@@ -0,0 +1,110 @@
+/**
+ * @file   ls_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class LsCache.
+ */
+
+#include "tiledb/sm/filesystem/ls_cache.h"
+
+namespace tiledb::sm {
+
+/** The prefix part of a cache key, after the listing-kind tag. */
+static std::string key_prefix(const std::string& key) {
+  return key.substr(2);
+}
+
+LsCache::LsCache(const uint64_t ttl_sec, const uint64_t max_prefixes)
+    : ttl_sec_(ttl_sec)
+    , max_prefixes_(max_prefixes) {
+}
+
+std::optional<LsObjects> LsCache::lookup(const std::string& key) {
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return std::nullopt;
+  }
+
+  // Expired listings are dropped instead of served.
+  const auto age = std::chrono::steady_clock::now() - it->second.cached_at;
+  if (age >= std::chrono::seconds(ttl_sec_)) {
+    lru_.erase(it->second.lru_it);
+    entries_.erase(it);
+    return std::nullopt;
+  }
+
+  lru_.splice(lru_.end(), lru_, it->second.lru_it);
+  return it->second.objects;
+}
+
+void LsCache::insert(const std::string& key, const LsObjects& objects) {
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    it->second.objects = objects;
+    it->second.cached_at = std::chrono::steady_clock::now();
+    lru_.splice(lru_.end(), lru_, it->second.lru_it);
+    return;
+  }
+
+  while (entries_.size() >= max_prefixes_) {
+    entries_.erase(lru_.front());
+    lru_.pop_front();
+  }
+
+  auto lru_it = lru_.insert(lru_.end(), key);
+  entries_.emplace(
+      key, Entry{objects, std::chrono::steady_clock::now(), lru_it});
+}
+
+void LsCache::invalidate(const URI& uri) {
+  const auto& uri_str = uri.to_string();
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    // A listing is affected if it covers the mutated URI, or if it lists
+    // a prefix under a removed directory.
+    const auto prefix = key_prefix(it->first);
+    if (uri_str.rfind(prefix, 0) == 0 || prefix.rfind(uri_str, 0) == 0) {
+      lru_.erase(it->second.lru_it);
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+uint64_t LsCache::num_prefixes() {
+  std::unique_lock<std::mutex> lck(mtx_);
+  return entries_.size();
+}
+
+}  // namespace tiledb::sm
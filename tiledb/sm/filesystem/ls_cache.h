@@ -0,0 +1,162 @@
+/**
+ * @file   ls_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class LsCache.
+ */
+
+#ifndef TILEDB_LS_CACHE_H
+#define TILEDB_LS_CACHE_H
+
+#include <chrono>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "tiledb/common/macros.h"
+#include "tiledb/sm/filesystem/ls_scanner.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+namespace tiledb::sm {
+
+/**
+ * A TTL-bound cache of prefix listings, keyed on the listed prefix.
+ *
+ * Orchestration workloads list the same prefixes over and over for
+ * monitoring, and a LIST request against an object store is paginated and
+ * billed per page. The cache holds the raw (unfiltered) listing of each
+ * prefix for a configured time-to-live, so repeated scans within the TTL
+ * are served locally; file predicates are applied over the cached entries
+ * by the caller.
+ *
+ * Mutations issued through the owning `VFS` invalidate the listings they
+ * affect, so a process observes its own writes immediately. Mutations by
+ * other processes are observed once the TTL expires; the TTL is the
+ * staleness bound the user opts into.
+ *
+ * Entries are evicted in LRU order against a prefix-count budget.
+ */
+class LsCache {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  LsCache() = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param ttl_sec Seconds a cached listing stays valid.
+   * @param max_prefixes The maximum number of cached prefix listings,
+   *     enforced by LRU eviction.
+   */
+  LsCache(uint64_t ttl_sec, uint64_t max_prefixes);
+
+  /** Destructor. */
+  ~LsCache() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(LsCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(LsCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Looks up the cached listing of a prefix.
+   *
+   * @param key The cache key of the listing.
+   * @return The cached objects, or `nullopt` on a miss or an expired
+   *     entry.
+   */
+  std::optional<LsObjects> lookup(const std::string& key);
+
+  /**
+   * Caches the listing of a prefix, evicting the least recently used
+   * listings past the prefix-count budget.
+   *
+   * @param key The cache key of the listing.
+   * @param objects The listed objects.
+   */
+  void insert(const std::string& key, const LsObjects& objects);
+
+  /**
+   * Drops the cached listings affected by a mutation of the input URI:
+   * the listings of every prefix covering the URI and, for a directory
+   * removal, the listings under it.
+   *
+   * @param uri The created, written, moved or removed URI.
+   */
+  void invalidate(const URI& uri);
+
+  /** Returns the number of cached prefix listings. */
+  uint64_t num_prefixes();
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** A cached prefix listing. */
+  struct Entry {
+    /** The listed objects. */
+    LsObjects objects;
+
+    /** The instant the listing was cached. */
+    std::chrono::steady_clock::time_point cached_at;
+
+    /** Position of the key in the LRU list. */
+    std::list<std::string>::iterator lru_it;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Seconds a cached listing stays valid. */
+  const uint64_t ttl_sec_;
+
+  /** The maximum number of cached prefix listings. */
+  const uint64_t max_prefixes_;
+
+  /** Protects the members below. */
+  std::mutex mtx_;
+
+  /** The cached listings by key. */
+  std::map<std::string, Entry> entries_;
+
+  /** The cache keys, ordered from least to most recently used. */
+  std::list<std::string> lru_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_LS_CACHE_H
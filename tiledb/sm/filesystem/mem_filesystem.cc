@@ -32,9 +32,11 @@
 
 #include <algorithm>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <unordered_set>
 
+#include "tiledb/common/common.h"
 #include "tiledb/common/filesystem/directory_entry.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
@@ -104,8 +106,11 @@ class MemFilesystem::FSNode {
   /*         PUBLIC ATTRIBUTES         */
   /* ********************************* */
 
-  /** Protects `children_`. */
-  mutable std::mutex mutex_;
+  /**
+   * Protects `children_` and the node's contents. Readers take shared
+   * locks; mutators take exclusive locks.
+   */
+  mutable std::shared_mutex mutex_;
 
   /** A hashtable of all the next-level subnodes of this node*/
   std::unordered_map<std::string, tdb_unique_ptr<FSNode>> children_;
@@ -120,7 +125,6 @@ class MemFilesystem::File : public MemFilesystem::FSNode {
   /** Default constructor. */
   File()
       : FSNode()
-      , data_(nullptr)
       , size_(0) {
   }
 
@@ -131,11 +135,7 @@ class MemFilesystem::File : public MemFilesystem::FSNode {
   DISABLE_MOVE(File);
 
   /** Destructor. */
-  ~File() {
-    if (data_) {
-      tdb_free(data_);
-    }
-  }
+  ~File() = default;
 
   /* ********************************* */
   /*             OPERATORS             */
@@ -188,7 +188,29 @@ class MemFilesystem::File : public MemFilesystem::FSNode {
       return LOG_STATUS(
           Status_MemFSError("Cannot read from file; Read exceeds file size"));
 
-    memcpy(buffer, (char*)data_ + offset, nbytes);
+    // Copy piecewise out of the chunks that overlap the requested
+    // range. Chunks are immutable once published, so a shared lock on
+    // this node suffices and concurrent readers never contend.
+    uint64_t chunk_start = 0;
+    uint64_t copied = 0;
+    for (const auto& chunk : chunks_) {
+      if (copied == nbytes) {
+        break;
+      }
+      if (chunk_start + chunk->size_ > offset + copied) {
+        const uint64_t chunk_offset = offset + copied - chunk_start;
+        const uint64_t to_copy =
+            std::min(nbytes - copied, chunk->size_ - chunk_offset);
+        memcpy(
+            (char*)buffer + copied,
+            (char*)chunk->data_ + chunk_offset,
+            to_copy);
+        copied += to_copy;
+      }
+      chunk_start += chunk->size_;
+    }
+
+    assert(copied == nbytes);
     return Status::Ok();
   }
 
@@ -202,38 +224,58 @@ class MemFilesystem::File : public MemFilesystem::FSNode {
           std::string("Wrong input buffer or size when writing to file")));
     }
 
-    if (data_ == nullptr) {
-      data_ = tdb_malloc(nbytes);
-      if (data_ == nullptr) {
-        return LOG_STATUS(Status_MemFSError(
-            std::string("Out of memory, cannot write to file")));
-      }
-      memcpy(data_, data, nbytes);
-      size_ = nbytes;
-    } else {
-      void* new_data;
-      new_data = tdb_realloc(data_, size_ + nbytes);
-
-      if (new_data == nullptr) {
-        return LOG_STATUS(
-            Status_MemFSError("Out of memory, cannot append new data to file"));
-      }
-
-      memcpy((char*)new_data + size_, data, nbytes);
-      data_ = new_data;
-      size_ += nbytes;
+    // Each write becomes a new immutable chunk. The cost of an append
+    // is therefore independent of the file size; the previously
+    // written data is never reallocated or copied.
+    void* chunk_data = tdb_malloc(nbytes);
+    if (chunk_data == nullptr) {
+      return LOG_STATUS(Status_MemFSError(
+          std::string("Out of memory, cannot write to file")));
     }
+    memcpy(chunk_data, data, nbytes);
+    chunks_.emplace_back(make_shared<Chunk>(HERE(), chunk_data, nbytes));
+    size_ += nbytes;
 
     return Status::Ok();
   }
 
  private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** An immutable chunk of file data; never modified once created. */
+  struct Chunk {
+    /** Constructor. Takes ownership of `data`. */
+    Chunk(void* data, uint64_t size)
+        : data_(data)
+        , size_(size) {
+    }
+
+    /** Copy constructor. */
+    DISABLE_COPY(Chunk);
+
+    /** Copy-assignment. */
+    DISABLE_COPY_ASSIGN(Chunk);
+
+    /** Destructor. */
+    ~Chunk() {
+      tdb_free(data_);
+    }
+
+    /** the data stored in this chunk */
+    void* data_;
+
+    /** the size in bytes of the data in this chunk */
+    uint64_t size_;
+  };
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES         */
   /* ********************************* */
 
-  /** the data stored in this file */
-  void* data_;
+  /** the data of this file as a sequence of immutable chunks */
+  std::vector<shared_ptr<Chunk>> chunks_;
 
   /** the size in bytes of the data in this file */
   uint64_t size_;
@@ -284,7 +326,7 @@ class MemFilesystem::Directory : public MemFilesystem::FSNode {
     std::vector<directory_entry> names;
     names.reserve(children_.size());
     for (const auto& child : children_) {
-      std::unique_lock<std::mutex> lock(child.second->mutex_);
+      std::shared_lock<std::shared_mutex> lock(child.second->mutex_);
       if (child.second->is_dir()) {
         names.emplace_back("mem://" + full_path + child.first, 0, true);
       } else {
@@ -340,8 +382,8 @@ Status MemFilesystem::file_size(
   assert(size);
 
   FSNode* cur;
-  std::unique_lock<std::mutex> cur_lock;
-  RETURN_NOT_OK(lookup_node(path, &cur, &cur_lock));
+  std::shared_lock<std::shared_mutex> cur_lock;
+  RETURN_NOT_OK(lookup_node_rd(path, &cur, &cur_lock));
 
   if (cur == nullptr) {
     return LOG_STATUS(
@@ -353,8 +395,8 @@ Status MemFilesystem::file_size(
 
 bool MemFilesystem::is_dir(const std::string& path) const {
   FSNode* cur;
-  std::unique_lock<std::mutex> cur_lock;
-  if (!lookup_node(path, &cur, &cur_lock).ok() || cur == nullptr) {
+  std::shared_lock<std::shared_mutex> cur_lock;
+  if (!lookup_node_rd(path, &cur, &cur_lock).ok() || cur == nullptr) {
     return false;
   }
 
@@ -363,8 +405,8 @@ bool MemFilesystem::is_dir(const std::string& path) const {
 
 bool MemFilesystem::is_file(const std::string& path) const {
   FSNode* cur;
-  std::unique_lock<std::mutex> cur_lock;
-  if (!lookup_node(path, &cur, &cur_lock).ok() || cur == nullptr) {
+  std::shared_lock<std::shared_mutex> cur_lock;
+  if (!lookup_node_rd(path, &cur, &cur_lock).ok() || cur == nullptr) {
     return false;
   }
 
@@ -388,7 +430,7 @@ std::vector<directory_entry> MemFilesystem::ls_with_sizes(
   std::vector<std::string> tokens = tokenize(abspath);
 
   FSNode* cur = root_.get();
-  std::unique_lock<std::mutex> cur_lock(cur->mutex_);
+  std::shared_lock<std::shared_mutex> cur_lock(cur->mutex_);
   std::string dir;
   for (auto& token : tokens) {
     assert(cur_lock.owns_lock());
@@ -399,8 +441,10 @@ std::vector<directory_entry> MemFilesystem::ls_with_sizes(
       throw MemFSException("Unable to list on non-existent path " + abspath);
     }
 
-    cur = cur->children_[token].get();
-    cur_lock = std::unique_lock<std::mutex>(cur->mutex_);
+    FSNode* child = cur->children_.at(token).get();
+    std::shared_lock<std::shared_mutex> child_lock(child->mutex_);
+    cur_lock.swap(child_lock);
+    cur = child;
   }
 
   assert(cur_lock.owns_lock());
@@ -426,7 +470,7 @@ Status MemFilesystem::move(
 
   // Lookup the `old_path` parent.
   FSNode* old_node_parent;
-  std::unique_lock<std::mutex> old_node_parent_lock;
+  std::unique_lock<std::shared_mutex> old_node_parent_lock;
   RETURN_NOT_OK(
       lookup_node(old_path_tokens, &old_node_parent, &old_node_parent_lock));
 
@@ -456,7 +500,7 @@ Status MemFilesystem::move(
 
   // Lookup the `new_path` parent.
   FSNode* new_node_parent;
-  std::unique_lock<std::mutex> new_node_parent_lock;
+  std::unique_lock<std::shared_mutex> new_node_parent_lock;
   RETURN_NOT_OK(
       lookup_node(new_path_tokens, &new_node_parent, &new_node_parent_lock));
 
@@ -472,8 +516,8 @@ Status MemFilesystem::read(
     void* const buffer,
     const uint64_t nbytes) const {
   FSNode* node;
-  std::unique_lock<std::mutex> node_lock;
-  RETURN_NOT_OK(lookup_node(path, &node, &node_lock));
+  std::shared_lock<std::shared_mutex> node_lock;
+  RETURN_NOT_OK(lookup_node_rd(path, &node, &node_lock));
 
   if (node == nullptr) {
     return LOG_STATUS(Status_MemFSError(
@@ -487,9 +531,9 @@ Status MemFilesystem::remove(const std::string& path, const bool is_dir) const {
   std::vector<std::string> tokens = tokenize(path);
 
   FSNode* cur = root_.get();
-  std::unique_lock<std::mutex> cur_lock(cur->mutex_);
+  std::unique_lock<std::shared_mutex> cur_lock(cur->mutex_);
   FSNode* parent = nullptr;
-  std::unique_lock<std::mutex> parent_lock;
+  std::unique_lock<std::shared_mutex> parent_lock;
   for (const auto& token : tokens) {
     assert(cur_lock.owns_lock());
     assert(cur_lock.mutex() == &cur->mutex_);
@@ -506,7 +550,7 @@ Status MemFilesystem::remove(const std::string& path, const bool is_dir) const {
     std::swap(parent_lock, cur_lock);
 
     cur = cur->children_[token].get();
-    cur_lock = std::unique_lock<std::mutex>(cur->mutex_);
+    cur_lock = std::unique_lock<std::shared_mutex>(cur->mutex_);
   }
 
   if (cur == root_.get()) {
@@ -537,7 +581,7 @@ Status MemFilesystem::create_dir_internal(
   std::vector<std::string> tokens = tokenize(path);
 
   FSNode* cur = root_.get();
-  std::unique_lock<std::mutex> cur_lock(cur->mutex_);
+  std::unique_lock<std::shared_mutex> cur_lock(cur->mutex_);
 
   for (auto iter = tokens.begin(); iter != tokens.end(); ++iter) {
     const std::string& token = *iter;
@@ -558,7 +602,7 @@ Status MemFilesystem::create_dir_internal(
     // Only take the lock for `cur` if it is not the newly-created
     // directory.
     if (std::next(iter) != tokens.end()) {
-      cur_lock = std::unique_lock<std::mutex>(cur->mutex_);
+      cur_lock = std::unique_lock<std::shared_mutex>(cur->mutex_);
     }
   }
 
@@ -578,7 +622,7 @@ Status MemFilesystem::touch_internal(
   std::vector<std::string> tokens = tokenize(path);
 
   FSNode* cur = root_.get();
-  std::unique_lock<std::mutex> cur_lock(cur->mutex_);
+  std::unique_lock<std::shared_mutex> cur_lock(cur->mutex_);
   for (unsigned long i = 0; i < tokens.size() - 1; ++i) {
     const std::string& token = tokens[i];
 
@@ -591,7 +635,7 @@ Status MemFilesystem::touch_internal(
     }
 
     cur = cur->children_[token].get();
-    cur_lock = std::unique_lock<std::mutex>(cur->mutex_);
+    cur_lock = std::unique_lock<std::shared_mutex>(cur->mutex_);
   }
 
   if (!cur->is_dir()) {
@@ -615,13 +659,13 @@ Status MemFilesystem::write(
   assert(data);
 
   FSNode* node;
-  std::unique_lock<std::mutex> node_lock;
+  std::unique_lock<std::shared_mutex> node_lock;
   RETURN_NOT_OK(lookup_node(path, &node, &node_lock));
 
   // If the file doesn't exist, create it.
   if (node == nullptr) {
     RETURN_NOT_OK(touch_internal(path, &node));
-    node_lock = std::unique_lock<std::mutex>(node->mutex_);
+    node_lock = std::unique_lock<std::shared_mutex>(node->mutex_);
   }
 
   return node->append(data, nbytes);
@@ -644,7 +688,7 @@ std::vector<std::string> MemFilesystem::tokenize(
 Status MemFilesystem::lookup_node(
     const std::string& path,
     MemFilesystem::FSNode** node,
-    std::unique_lock<std::mutex>* node_lock) const {
+    std::unique_lock<std::shared_mutex>* node_lock) const {
   assert(node);
   assert(node_lock);
   assert(!node_lock->owns_lock());
@@ -656,25 +700,78 @@ Status MemFilesystem::lookup_node(
 Status MemFilesystem::lookup_node(
     const std::vector<std::string>& tokens,
     MemFilesystem::FSNode** node,
-    std::unique_lock<std::mutex>* node_lock) const {
+    std::unique_lock<std::shared_mutex>* node_lock) const {
+  assert(node);
+  assert(node_lock);
+  assert(!node_lock->owns_lock());
+
+  FSNode* cur = root_.get();
+  if (tokens.empty()) {
+    *node = cur;
+    *node_lock = std::unique_lock<std::shared_mutex>(cur->mutex_);
+    return Status::Ok();
+  }
+
+  // Traverse interior nodes with shared locks so that concurrent
+  // operations on different files never block one another; only the
+  // final node is locked exclusively.
+  std::shared_lock<std::shared_mutex> cur_lock(cur->mutex_);
+  for (size_t i = 0; i < tokens.size() - 1; ++i) {
+    assert(cur_lock.owns_lock());
+    assert(cur_lock.mutex() == &cur->mutex_);
+
+    if (!cur->has_child(tokens[i])) {
+      *node = nullptr;
+      return Status::Ok();
+    }
+
+    FSNode* child = cur->children_.at(tokens[i]).get();
+    std::shared_lock<std::shared_mutex> child_lock(child->mutex_);
+    cur_lock.swap(child_lock);
+    cur = child;
+  }
+
+  assert(cur_lock.owns_lock());
+  assert(cur_lock.mutex() == &cur->mutex_);
+
+  if (!cur->has_child(tokens.back())) {
+    *node = nullptr;
+    return Status::Ok();
+  }
+
+  // Lock the final node exclusively before releasing its parent.
+  FSNode* child = cur->children_.at(tokens.back()).get();
+  *node_lock = std::unique_lock<std::shared_mutex>(child->mutex_);
+  *node = child;
+
+  return Status::Ok();
+}
+
+Status MemFilesystem::lookup_node_rd(
+    const std::string& path,
+    MemFilesystem::FSNode** node,
+    std::shared_lock<std::shared_mutex>* node_lock) const {
   assert(node);
   assert(node_lock);
   assert(!node_lock->owns_lock());
 
+  const std::vector<std::string> tokens = tokenize(path);
+
   FSNode* cur = root_.get();
-  std::unique_lock<std::mutex> cur_lock(cur->mutex_);
+  std::shared_lock<std::shared_mutex> cur_lock(cur->mutex_);
   for (const auto& token : tokens) {
     assert(cur_lock.owns_lock());
     assert(cur_lock.mutex() == &cur->mutex_);
 
-    if (cur->has_child(token)) {
-      cur = cur->children_[token].get();
-    } else {
+    if (!cur->has_child(token)) {
       *node = nullptr;
       return Status::Ok();
     }
 
-    cur_lock = std::unique_lock<std::mutex>(cur->mutex_);
+    FSNode* child = cur->children_.at(token).get();
+    std::shared_lock<std::shared_mutex> child_lock(child->mutex_);
+    cur_lock.swap(child_lock);
+    cur = child;
   }
 
   assert(cur_lock.owns_lock());
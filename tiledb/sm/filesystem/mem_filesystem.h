@@ -33,6 +33,8 @@
 #ifndef TILEDB_MEMORY_FILESYSTEM_H
 #define TILEDB_MEMORY_FILESYSTEM_H
 
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -233,17 +235,22 @@ class MemFilesystem {
   /* ********************************* */
 
   /**
-   * Finds the node in the filesystem tree that corresponds to a path
+   * Finds the node in the filesystem tree that corresponds to a path.
+   *
+   * Interior nodes are traversed with shared locks so that lookups
+   * towards different files never contend; only the final node is
+   * locked exclusively.
    *
    * @param path The full name of the file/directory to be looked up
    * @param node The output node, nullptr if not found.
-   * @param node_lock Mutates to a lock on `node->mutex_`, if found.
+   * @param node_lock Mutates to an exclusive lock on `node->mutex_`,
+   *     if found.
    * @return Status
    */
   Status lookup_node(
       const std::string& path,
       FSNode** node,
-      std::unique_lock<std::mutex>* node_lock) const;
+      std::unique_lock<std::shared_mutex>* node_lock) const;
 
   /**
    * Finds the node in the filesystem tree that corresponds to a vector
@@ -251,13 +258,32 @@ class MemFilesystem {
    *
    * @param tokens The path tokens.
    * @param node The output node, nullptr if not found.
-   * @param node_lock Mutates to a lock on `node->mutex_`, if found.
+   * @param node_lock Mutates to an exclusive lock on `node->mutex_`,
+   *     if found.
    * @return Status
    */
   Status lookup_node(
       const std::vector<std::string>& tokens,
       FSNode** node,
-      std::unique_lock<std::mutex>* node_lock) const;
+      std::unique_lock<std::shared_mutex>* node_lock) const;
+
+  /**
+   * Finds the node in the filesystem tree that corresponds to a path,
+   * for read-only access.
+   *
+   * The entire traversal uses shared locks, so concurrent readers of
+   * the same node never contend with one another.
+   *
+   * @param path The full name of the file/directory to be looked up
+   * @param node The output node, nullptr if not found.
+   * @param node_lock Mutates to a shared lock on `node->mutex_`, if
+   *     found.
+   * @return Status
+   */
+  Status lookup_node_rd(
+      const std::string& path,
+      FSNode** node,
+      std::shared_lock<std::shared_mutex>* node_lock) const;
 
   /**
    * Splits a path into file/directory names
@@ -37,6 +37,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/common/stdx_string.h"
 #include "tiledb/sm/misc/constants.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
 #include "uri.h"
@@ -44,15 +45,27 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TILEDB_POSIX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <future>
 #include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <sstream>
+#include <unordered_map>
 
 using namespace tiledb::common;
 using filesystem::directory_entry;
@@ -122,7 +135,8 @@ class PosixDIR {
   optional<DIR*> dir_;
 };
 
-Posix::Posix(const Config& config) {
+Posix::Posix(const Config& config, ThreadPool* io_tp)
+    : io_tp_(io_tp) {
   // Initialize member variables with posix config parameters.
 
   // File and directory permissions are set by the user in octal.
@@ -132,6 +146,8 @@ Posix::Posix(const Config& config) {
   permissions = config.get<std::string>(
       "vfs.file.posix_directory_permissions", Config::must_find);
   directory_permissions_ = std::strtol(permissions.c_str(), nullptr, 8);
+
+  mmap_reads_ = config.get<bool>("vfs.file.mmap_reads", Config::must_find);
 }
 
 void Posix::create_dir(const URI& uri) const {
@@ -252,6 +268,400 @@ void Posix::copy_dir(const URI& old_uri, const URI& new_uri) const {
   }
 }
 
+#ifdef TILEDB_POSIX_IO_URING
+
+/**
+ * A per-thread io_uring instance used to batch large reads.
+ *
+ * A large read is split into chunks whose submission queue entries are all
+ * submitted with a single io_uring_enter syscall, which keeps the device
+ * queue of an NVMe drive full from one reader thread instead of paying one
+ * blocking pread per chunk. The ring is created lazily per thread; if
+ * io_uring is unavailable (old kernel or a seccomp policy), reads fall back
+ * to the plain pread loop. The raw syscall interface is used on purpose so
+ * that no dependency on liburing is introduced.
+ */
+class PosixIOUring {
+ public:
+  /** Number of submission queue entries. */
+  static constexpr unsigned QUEUE_DEPTH = 64;
+
+  /** Size in bytes of each chunk submitted as one queue entry. */
+  static constexpr uint64_t CHUNK_SIZE = 1024 * 1024;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(PosixIOUring);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(PosixIOUring);
+
+  /** Constructor. Sets up the ring, leaving it unavailable on failure. */
+  PosixIOUring() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = (int)syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+    if (ring_fd_ < 0) {
+      return;
+    }
+
+    // Requiring a kernel that maps both rings with one mmap (5.4+) keeps the
+    // setup and cleanup simple; older kernels use the pread fallback.
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+      shutdown();
+      return;
+    }
+
+    ring_sz_ = std::max<size_t>(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    ring_ptr_ = mmap(
+        nullptr,
+        ring_sz_,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd_,
+        IORING_OFF_SQ_RING);
+    sqes_sz_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ptr_ = mmap(
+        nullptr,
+        sqes_sz_,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd_,
+        IORING_OFF_SQES);
+    if (ring_ptr_ == MAP_FAILED || sqes_ptr_ == MAP_FAILED) {
+      shutdown();
+      return;
+    }
+
+    auto ring = static_cast<char*>(ring_ptr_);
+    sq_tail_ = (unsigned*)(ring + params.sq_off.tail);
+    sq_mask_ = (unsigned*)(ring + params.sq_off.ring_mask);
+    sq_array_ = (unsigned*)(ring + params.sq_off.array);
+    cq_head_ = (unsigned*)(ring + params.cq_off.head);
+    cq_tail_ = (unsigned*)(ring + params.cq_off.tail);
+    cq_mask_ = (unsigned*)(ring + params.cq_off.ring_mask);
+    cqes_ = (io_uring_cqe*)(ring + params.cq_off.cqes);
+    sqes_ = (io_uring_sqe*)sqes_ptr_;
+  }
+
+  /** Destructor. */
+  ~PosixIOUring() {
+    shutdown();
+  }
+
+  /** Returns whether the ring was set up successfully. */
+  bool available() const {
+    return ring_fd_ >= 0;
+  }
+
+  /**
+   * Reads from a file, submitting all chunks of the read region with as few
+   * io_uring_enter syscalls as possible.
+   *
+   * @param fd The file descriptor to read from.
+   * @param buffer The buffer to read into.
+   * @param nbytes The number of bytes to read.
+   * @param offset The file offset to read from.
+   * @return Status
+   */
+  Status read(int fd, void* buffer, uint64_t nbytes, uint64_t offset) {
+    // One outstanding chunk of the read, indexed by sqe user_data.
+    struct Request {
+      uint8_t* buf;
+      uint64_t len;
+      uint64_t off;
+    };
+    std::vector<Request> requests;
+    requests.reserve((nbytes + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    auto bytes = static_cast<uint8_t*>(buffer);
+    for (uint64_t pos = 0; pos < nbytes; pos += CHUNK_SIZE) {
+      requests.push_back(
+          {bytes + pos, std::min(CHUNK_SIZE, nbytes - pos), offset + pos});
+    }
+
+    Status st = Status::Ok();
+    std::vector<uint64_t> retry;
+    uint64_t next = 0, num_completed = 0, inflight = 0;
+    while ((st.ok() && num_completed < requests.size()) || inflight > 0) {
+      // Fill the submission queue. After an error, only drain what is still
+      // in flight, as the kernel writes into the chunk buffers until then.
+      unsigned submitted = 0;
+      if (st.ok()) {
+        unsigned tail = *sq_tail_;
+        while (inflight < QUEUE_DEPTH &&
+               (next < requests.size() || !retry.empty())) {
+          uint64_t id;
+          if (!retry.empty()) {
+            id = retry.back();
+            retry.pop_back();
+          } else {
+            id = next++;
+          }
+          const auto& r = requests[id];
+          unsigned idx = tail & *sq_mask_;
+          io_uring_sqe* sqe = &sqes_[idx];
+          std::memset(sqe, 0, sizeof(*sqe));
+          sqe->opcode = IORING_OP_READ;
+          sqe->fd = fd;
+          sqe->addr = (uint64_t)(uintptr_t)r.buf;
+          sqe->len = (unsigned)r.len;
+          sqe->off = r.off;
+          sqe->user_data = id;
+          sq_array_[idx] = idx;
+          tail++;
+          submitted++;
+          inflight++;
+        }
+        __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+      }
+
+      // One syscall submits every queued chunk and waits for a completion.
+      int ret;
+      do {
+        ret = (int)syscall(
+            __NR_io_uring_enter,
+            ring_fd_,
+            submitted,
+            1u,
+            IORING_ENTER_GETEVENTS,
+            nullptr,
+            0);
+        submitted = 0;
+      } while (ret < 0 && errno == EINTR);
+      if (ret < 0) {
+        // The in-flight chunks cannot be drained anymore; drop the ring so
+        // the kernel stops writing into the caller's buffers.
+        shutdown();
+        return LOG_STATUS(Status_IOError(
+            std::string("POSIX io_uring read error: ") + strerror(errno)));
+      }
+
+      // Reap completions, resubmitting short reads.
+      unsigned head = *cq_head_;
+      unsigned cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      while (head != cq_tail) {
+        const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+        auto& r = requests[cqe.user_data];
+        if (cqe.res < 0) {
+          st = LOG_STATUS(Status_IOError(
+              std::string("POSIX io_uring read error: ") +
+              strerror(-cqe.res)));
+        } else if (cqe.res == 0) {
+          st = LOG_STATUS(Status_IOError("POSIX incomplete read: EOF reached"));
+        } else if ((uint64_t)cqe.res < r.len) {
+          r.buf += cqe.res;
+          r.off += cqe.res;
+          r.len -= cqe.res;
+          retry.push_back(cqe.user_data);
+        } else {
+          num_completed++;
+        }
+        inflight--;
+        head++;
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+
+    return st;
+  }
+
+ private:
+  /** The ring file descriptor, or -1 if the ring is unavailable. */
+  int ring_fd_ = -1;
+
+  /** Mapping of the submission/completion rings and its size. */
+  void* ring_ptr_ = MAP_FAILED;
+  size_t ring_sz_ = 0;
+
+  /** Mapping of the submission queue entries and its size. */
+  void* sqes_ptr_ = MAP_FAILED;
+  size_t sqes_sz_ = 0;
+
+  /** Pointers into the ring mappings. */
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  io_uring_sqe* sqes_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+
+  /** Releases the ring resources and marks the ring unavailable. */
+  void shutdown() {
+    if (sqes_ptr_ != MAP_FAILED) {
+      munmap(sqes_ptr_, sqes_sz_);
+      sqes_ptr_ = MAP_FAILED;
+    }
+    if (ring_ptr_ != MAP_FAILED) {
+      munmap(ring_ptr_, ring_sz_);
+      ring_ptr_ = MAP_FAILED;
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+      ring_fd_ = -1;
+    }
+  }
+};
+
+#endif  // TILEDB_POSIX_IO_URING
+
+/**
+ * A read-only memory mapping of a file. The mapping is shared by concurrent
+ * readers and unmapped when the last reader releases it.
+ */
+class PosixMappedFile {
+ public:
+  DISABLE_COPY_AND_COPY_ASSIGN(PosixMappedFile);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(PosixMappedFile);
+
+  /** Constructor. Takes ownership of an established mapping. */
+  PosixMappedFile(void* addr, uint64_t size)
+      : addr_(addr)
+      , size_(size) {
+  }
+
+  /** Destructor. Unmaps the file. */
+  ~PosixMappedFile() {
+    munmap(addr_, size_);
+  }
+
+  /**
+   * Maps the first `size` bytes of `path` read-only.
+   *
+   * @return The mapping, or nullptr if the file cannot be mapped.
+   */
+  static std::shared_ptr<PosixMappedFile> map(
+      const std::string& path, uint64_t size) {
+    if (size == 0) {
+      return nullptr;
+    }
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return nullptr;
+    }
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+      return nullptr;
+    }
+    return std::make_shared<PosixMappedFile>(addr, size);
+  }
+
+  /** Returns the address of the mapping. */
+  inline void* addr() const {
+    return addr_;
+  }
+
+  /** Returns the byte size of the mapping. */
+  inline uint64_t size() const {
+    return size_;
+  }
+
+ private:
+  /** The address of the mapping. */
+  void* addr_;
+
+  /** The byte size of the mapping. */
+  uint64_t size_;
+};
+
+/**
+ * An LRU cache of read-only file mappings keyed by path. Evicting a mapping
+ * only drops the cache's reference; in-progress reads keep it alive.
+ */
+class PosixMmapCache {
+ public:
+  /** The maximum number of cached mappings. */
+  static constexpr size_t MAX_MAPPINGS = 64;
+
+  /**
+   * Returns a mapping of at least `min_size` bytes of `path`, mapping the
+   * file if necessary, or nullptr if the file cannot be mapped.
+   */
+  std::shared_ptr<PosixMappedFile> get(
+      const std::string& path, const uint64_t min_size) {
+    {
+      std::lock_guard<std::mutex> lg(mtx_);
+      const auto it = mappings_.find(path);
+      if (it != mappings_.end()) {
+        if (it->second.first->size() >= min_size) {
+          // Touch the mapping to make it the most recently used one.
+          lru_.splice(lru_.end(), lru_, it->second.second);
+          return it->second.first;
+        }
+
+        // The file has grown past the mapping, e.g. by appends; drop it
+        // and map the current size.
+        lru_.erase(it->second.second);
+        mappings_.erase(it);
+      }
+    }
+
+    // Map outside the lock; concurrent first readers may map redundantly.
+    auto mapped = PosixMappedFile::map(path, min_size);
+    if (mapped == nullptr) {
+      return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lg(mtx_);
+    const auto it = mappings_.find(path);
+    if (it != mappings_.end()) {
+      if (it->second.first->size() >= min_size) {
+        return it->second.first;
+      }
+      lru_.erase(it->second.second);
+      mappings_.erase(it);
+    }
+    const auto lru_it = lru_.insert(lru_.end(), path);
+    mappings_[path] = std::make_pair(mapped, lru_it);
+    if (mappings_.size() > MAX_MAPPINGS) {
+      mappings_.erase(lru_.front());
+      lru_.pop_front();
+    }
+    return mapped;
+  }
+
+ private:
+  /** Protects the mappings and the LRU list. */
+  std::mutex mtx_;
+
+  /** The cached paths, from least to most recently used. */
+  std::list<std::string> lru_;
+
+  /** Maps a path to its mapping and its position in the LRU list. */
+  std::unordered_map<
+      std::string,
+      std::pair<
+          std::shared_ptr<PosixMappedFile>,
+          std::list<std::string>::iterator>>
+      mappings_;
+};
+
+bool Posix::mmap_read(
+    const std::string& path,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    const uint64_t file_size) {
+  static PosixMmapCache mmap_cache;
+
+  auto mapped = mmap_cache.get(path, file_size);
+  if (mapped == nullptr) {
+    return false;
+  }
+
+  // Ask the kernel to prefetch the page-aligned requested range before the
+  // copy faults it in.
+  const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  const uint64_t advise_begin = offset - (offset % page_size);
+  madvise(
+      static_cast<uint8_t*>(mapped->addr()) + advise_begin,
+      offset + nbytes - advise_begin,
+      MADV_WILLNEED);
+
+  std::memcpy(buffer, static_cast<uint8_t*>(mapped->addr()) + offset, nbytes);
+  return true;
+}
+
 void Posix::read(
     const URI& uri,
     uint64_t offset,
@@ -265,6 +675,14 @@ void Posix::read(
   if (offset + nbytes > file_size)
     throw IOError("Cannot read from file; Read exceeds file size");
 
+  // Serve the read from a shared read-only mapping of the file when
+  // configured, so that the page cache backs the data directly instead of
+  // the read being buffered again through per-read syscalls.
+  if (mmap_reads_ && nbytes > 0 &&
+      mmap_read(path, offset, buffer, nbytes, file_size)) {
+    return;
+  }
+
   // Open file
   int fd = open(path.c_str(), O_RDONLY);
   if (fd == -1) {
@@ -280,7 +698,18 @@ void Posix::read(
         std::string("Cannot read from file ' ") + path +
         "'; nbytes > SSIZE_MAX");
   }
+#ifdef TILEDB_POSIX_IO_URING
+  // Reads spanning several chunks are batched on the per-thread ring; small
+  // reads are cheaper as a single pread.
+  static thread_local PosixIOUring uring;
+  if (uring.available() && nbytes > PosixIOUring::CHUNK_SIZE) {
+    throw_if_not_ok(uring.read(fd, buffer, nbytes, offset));
+  } else {
+    throw_if_not_ok(read_all(fd, buffer, nbytes, offset));
+  }
+#else
   throw_if_not_ok(read_all(fd, buffer, nbytes, offset));
+#endif
   // Close file
   if (close(fd)) {
     LOG_STATUS_NO_RETURN_VALUE(
@@ -369,6 +798,13 @@ void Posix::write(
   }
 }
 
+/**
+ * The minimum number of directory entries for which `ls_with_sizes` stats
+ * the entries on a thread pool instead of serially. Small listings are not
+ * worth the task dispatch overhead.
+ */
+static constexpr size_t parallel_stat_min_entries = 64;
+
 std::vector<directory_entry> Posix::ls_with_sizes(const URI& uri) const {
   std::string path = uri.to_path();
   struct dirent* next_path = nullptr;
@@ -377,32 +813,71 @@ std::vector<directory_entry> Posix::ls_with_sizes(const URI& uri) const {
     return {};
   }
 
-  std::vector<directory_entry> entries;
-
+  // Collect the entry paths and types first; `readdir` is inherently
+  // serial, whereas the per-entry stat calls below are not.
+  std::vector<std::string> paths;
+  std::vector<unsigned char> types;
   while ((next_path = readdir(dir.get())) != nullptr) {
     if (!strcmp(next_path->d_name, ".") || !strcmp(next_path->d_name, ".."))
       continue;
-    std::string abspath = path + "/" + next_path->d_name;
-
-    // Getting the file size here incurs an additional system call
-    // via file_size() and ls() calls will feel this too.
-    // If this penalty becomes noticeable, we should just duplicate
-    // this implementation in ls() and don't get the size
-    if (next_path->d_type == DT_DIR) {
-      entries.emplace_back(abspath, 0, true);
+    paths.emplace_back(path + "/" + next_path->d_name);
+    types.emplace_back(next_path->d_type);
+  }
+
+  // Stat the entries to get their sizes. Each stat is a full round trip on
+  // network filesystems, so large listings fan out on the VFS I/O thread
+  // pool. `DT_UNKNOWN` entries (returned by some filesystems, e.g. NFS) are
+  // also classified here instead of being assumed to be regular files.
+  std::vector<uint64_t> sizes(paths.size(), 0);
+  std::vector<uint8_t> dir_flags(paths.size(), 0);
+  auto stat_entry = [&](size_t i) {
+    if (types[i] == DT_DIR) {
+      dir_flags[i] = 1;
+      return Status::Ok();
+    }
+    struct stat st;
+    if (stat(paths[i].c_str(), &st) != 0) {
+      throw IOError(
+          std::string("Cannot get file size of '") + paths[i] + "'; " +
+          strerror(errno));
+    }
+    if (S_ISDIR(st.st_mode)) {
+      dir_flags[i] = 1;
     } else {
-      uint64_t size;
-      file_size(URI(abspath), &size);
-      entries.emplace_back(abspath, size, false);
+      sizes[i] = st.st_size;
+    }
+    return Status::Ok();
+  };
+  if (io_tp_ != nullptr && paths.size() >= parallel_stat_min_entries) {
+    throw_if_not_ok(parallel_for(io_tp_, 0, paths.size(), stat_entry));
+  } else {
+    for (size_t i = 0; i < paths.size(); i++) {
+      throw_if_not_ok(stat_entry(i));
     }
   }
+
+  std::vector<directory_entry> entries;
+  entries.reserve(paths.size());
+  for (size_t i = 0; i < paths.size(); i++) {
+    entries.emplace_back(std::move(paths[i]), sizes[i], dir_flags[i] != 0);
+  }
   return entries;
 }
 
 Status Posix::ls(
     const std::string& path, std::vector<std::string>* paths) const {
-  for (auto& fs : ls_with_sizes(URI(path))) {
-    paths->emplace_back(fs.path().native());
+  // A name-only listing never needs sizes, so skip the stat calls that
+  // `ls_with_sizes` performs and just read the directory entries.
+  struct dirent* next_path = nullptr;
+  auto dir = PosixDIR::open(path);
+  if (dir.empty()) {
+    return Status::Ok();
+  }
+
+  while ((next_path = readdir(dir.get())) != nullptr) {
+    if (!strcmp(next_path->d_name, ".") || !strcmp(next_path->d_name, ".."))
+      continue;
+    paths->emplace_back(path + "/" + next_path->d_name);
   }
 
   return Status::Ok();
@@ -46,6 +46,7 @@
 #include <vector>
 
 #include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool/thread_pool.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/filesystem_base.h"
 #include "tiledb/sm/filesystem/ls_scanner.h"
@@ -72,8 +73,14 @@ class Posix : public FilesystemBase {
       : Posix(Config()) {
   }
 
-  /** Constructor. */
-  explicit Posix(const Config& config);
+  /**
+   * Constructor.
+   *
+   * @param config Config parameters.
+   * @param io_tp Optional thread pool used to stat the entries of large
+   *    directory listings in parallel.
+   */
+  explicit Posix(const Config& config, ThreadPool* io_tp = nullptr);
 
   /** Destructor. */
   ~Posix() override = default;
@@ -343,6 +350,25 @@ class Posix : public FilesystemBase {
   static Status read_all(
       int fd, void* buffer, uint64_t nbytes, uint64_t offset);
 
+  /**
+   * Serves a read from a shared read-only memory mapping of the file,
+   * prefetching the requested range with `madvise`. Returns false if the
+   * file cannot be mapped; the caller then falls back to `read_all`.
+   *
+   * @param path The path of the file.
+   * @param offset The offset in the file from which the read will start.
+   * @param buffer The buffer into which the data will be written.
+   * @param nbytes The size of the data to be read from the file.
+   * @param file_size The current size of the file.
+   * @return True if the read was served from a mapping.
+   */
+  static bool mmap_read(
+      const std::string& path,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      uint64_t file_size);
+
   static int unlink_cb(
       const char* fpath,
       const struct stat* sb,
@@ -364,6 +390,17 @@ class Posix : public FilesystemBase {
 
  private:
   uint32_t file_permissions_, directory_permissions_;
+
+  /** Whether reads are served from read-only memory mappings. */
+  bool mmap_reads_;
+
+  /**
+   * Thread pool for stat-ing the entries of large directory listings in
+   * parallel, or `nullptr` for serial listings. Each stat is a round trip
+   * on network filesystems, so the fan-out dominates array open times on
+   * NFS-mounted arrays with many fragments.
+   */
+  ThreadPool* io_tp_;
 };
 
 }  // namespace sm
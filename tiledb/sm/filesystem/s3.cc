@@ -51,6 +51,7 @@
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartCopyRequest.h>
 #include <aws/sts/STSClient.h>
 #include <boost/interprocess/streams/bufferstream.hpp>
 #include <fstream>
@@ -60,8 +61,10 @@
 #include "tiledb/common/unique_rwlock.h"
 #include "tiledb/platform/platform.h"
 #include "tiledb/sm/config/config_iter.h"
+#include "tiledb/sm/global_state/global_state.h"
 #include "tiledb/sm/global_state/unit_test_config.h"
 #include "tiledb/sm/misc/tdb_math.h"
+#include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/misc/utils.h"
 
 #ifdef _WIN32
@@ -255,6 +258,12 @@ S3::S3(
           S3_BucketCannedACL_from_str(s3_params_.bucket_acl_str_))
     , ssl_config_(S3SSLConfig(config)) {
   assert(thread_pool);
+
+  // Request pacing is process-wide: the S3 instances of all contexts
+  // share the same governor bucket.
+  RequestRateGovernor::instance().set_rate(
+      RequestRateGovernor::Backend::S3, s3_params_.max_request_rate_);
+
   options_.loggingOptions.logLevel =
       aws_log_name_to_level(s3_params_.logging_level_);
 
@@ -322,6 +331,8 @@ S3::~S3() {
     assert(state_ == State::DISCONNECTED);
     for (auto& buff : file_buffers_)
       tdb_delete(buff.second);
+    for (auto& buff : file_buffer_pool_)
+      tdb_delete(buff);
   }
 }
 
@@ -389,6 +400,7 @@ bool S3::is_empty_bucket(const URI& bucket) const {
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET) {
     list_objects_request.SetRequestPayer(request_payer_);
   }
+  pace_request();
   auto list_objects_outcome = client_->ListObjectsV2(list_objects_request);
 
   if (!list_objects_outcome.IsSuccess()) {
@@ -439,10 +451,10 @@ void S3::copy_dir(const URI& old_uri, const URI& new_uri) const {
   std::string old_uri_string = old_uri.to_string();
   std::vector<std::string> paths;
   throw_if_not_ok(ls(old_uri, &paths));
+  std::vector<std::string> file_names;
   while (!paths.empty()) {
     std::string file_name_abs = paths.front();
     URI file_name_uri = URI(file_name_abs);
-    std::string file_name = file_name_abs.substr(old_uri_string.length());
     paths.erase(paths.begin());
 
     bool dir_exists;
@@ -452,11 +464,18 @@ void S3::copy_dir(const URI& old_uri, const URI& new_uri) const {
       throw_if_not_ok(ls(file_name_uri, &child_paths));
       paths.insert(paths.end(), child_paths.begin(), child_paths.end());
     } else {
-      std::string new_path_string = new_uri.to_string() + file_name;
-      URI new_path_uri = URI(new_path_string);
-      throw_if_not_ok(copy_object(file_name_uri, new_path_uri));
+      file_names.emplace_back(std::move(file_name_abs));
     }
   }
+
+  // The copies are server-side; parallelize them per object.
+  throw_if_not_ok(
+      parallel_for(vfs_thread_pool_, 0, file_names.size(), [&](size_t i) {
+        const std::string file_name =
+            file_names[i].substr(old_uri_string.length());
+        const URI new_path_uri = URI(new_uri.to_string() + file_name);
+        return copy_object(URI(file_names[i]), new_path_uri);
+      }));
 }
 
 void S3::read(
@@ -568,6 +587,7 @@ void S3::touch(const URI& uri) const {
     put_object_request.SetACL(object_canned_acl_);
   }
 
+  pace_request();
   auto put_object_outcome = client_->PutObject(put_object_request);
   if (!put_object_outcome.IsSuccess()) {
     throw S3Exception(
@@ -706,10 +726,6 @@ Status S3::disconnect() {
     Aws::Utils::Logging::ShutdownAWSLogging();
   }
 
-  if (s3_tp_executor_) {
-    s3_tp_executor_->Stop();
-  }
-
   state_ = State::DISCONNECTED;
   return ret_st;
 }
@@ -909,6 +925,7 @@ Status S3::is_object(
   head_object_request.SetKey(object_key);
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     head_object_request.SetRequestPayer(request_payer_);
+  pace_request();
   auto head_object_outcome = client_->HeadObject(head_object_request);
   *exists = head_object_outcome.IsSuccess();
 
@@ -927,38 +944,25 @@ Status S3::ls(
   return Status::Ok();
 }
 
-std::vector<directory_entry> S3::ls_with_sizes(
-    const URI& prefix, const std::string& delimiter, int max_paths) const {
-  throw_if_not_ok(init_client());
-
-  const auto prefix_dir = prefix.add_trailing_slash();
-
-  auto prefix_str = prefix_dir.to_string();
-  if (!prefix_dir.is_s3()) {
-    throw S3Exception("URI is not an S3 URI: " + prefix_str);
-  }
-
-  Aws::Http::URI aws_uri = prefix_str.c_str();
-  auto aws_prefix = remove_front_slash(aws_uri.GetPath().c_str());
-  std::string aws_auth = aws_uri.GetAuthority().c_str();
-  Aws::S3::Model::ListObjectsV2Request list_objects_request;
-  list_objects_request.SetBucket(aws_uri.GetAuthority());
-  list_objects_request.SetPrefix(aws_prefix.c_str());
-  list_objects_request.SetDelimiter(delimiter.c_str());
-  if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET) {
-    list_objects_request.SetRequestPayer(request_payer_);
-  }
-
+std::vector<directory_entry> S3::list_objects(
+    Aws::S3::Model::ListObjectsV2Request& request,
+    const std::string& prefix_str,
+    const std::string& delimiter,
+    int max_paths,
+    int max_pages,
+    bool* more_data,
+    std::string* last_key) const {
+  std::string aws_auth = request.GetBucket().c_str();
   std::vector<directory_entry> entries;
 
-  bool is_done = false;
-  while (!is_done) {
+  int num_pages = 0;
+  while (true) {
     // Not requesting more items than needed
     if (max_paths != -1) {
-      list_objects_request.SetMaxKeys(
-          max_paths - static_cast<int>(entries.size()));
+      request.SetMaxKeys(max_paths - static_cast<int>(entries.size()));
     }
-    auto list_objects_outcome = client_->ListObjectsV2(list_objects_request);
+    pace_request();
+    auto list_objects_outcome = client_->ListObjectsV2(request);
 
     if (!list_objects_outcome.IsSuccess()) {
       throw S3Exception(
@@ -970,6 +974,9 @@ std::vector<directory_entry> S3::ls_with_sizes(
     for (const auto& object : list_objects_outcome.GetResult().GetContents()) {
       std::string file(object.GetKey().c_str());
       uint64_t size = object.GetSize();
+      if (last_key != nullptr && file > *last_key) {
+        *last_key = file;
+      }
       entries.emplace_back(
           "s3://" + aws_auth + add_front_slash(file), size, false);
     }
@@ -977,6 +984,9 @@ std::vector<directory_entry> S3::ls_with_sizes(
     for (const auto& object :
          list_objects_outcome.GetResult().GetCommonPrefixes()) {
       std::string file(object.GetPrefix().c_str());
+      if (last_key != nullptr && file > *last_key) {
+        *last_key = file;
+      }
       // For "directories" it doesn't seem possible to get a shallow size in
       // S3, so the size of such an entry will be 0 in S3.
       entries.emplace_back(
@@ -985,24 +995,212 @@ std::vector<directory_entry> S3::ls_with_sizes(
           true);
     }
 
-    is_done =
-        !list_objects_outcome.GetResult().GetIsTruncated() ||
-        (max_paths != -1 && entries.size() >= static_cast<size_t>(max_paths));
-    if (!is_done) {
-      Aws::String next_marker =
-          list_objects_outcome.GetResult().GetNextContinuationToken();
-      if (next_marker.empty()) {
-        throw S3Exception(
-            "Failed to retrieve next continuation "
-            "token for ListObjectsV2 request.");
+    if (!list_objects_outcome.GetResult().GetIsTruncated() ||
+        (max_paths != -1 &&
+         entries.size() >= static_cast<size_t>(max_paths))) {
+      if (more_data != nullptr) {
+        *more_data = false;
+      }
+      break;
+    }
+
+    Aws::String next_marker =
+        list_objects_outcome.GetResult().GetNextContinuationToken();
+    if (next_marker.empty()) {
+      throw S3Exception(
+          "Failed to retrieve next continuation "
+          "token for ListObjectsV2 request.");
+    }
+    request.SetContinuationToken(std::move(next_marker));
+
+    num_pages++;
+    if (max_pages != -1 && num_pages >= max_pages) {
+      if (more_data != nullptr) {
+        *more_data = true;
       }
-      list_objects_request.SetContinuationToken(std::move(next_marker));
+      break;
     }
   }
 
   return entries;
 }
 
+bool S3::ls_sharded(
+    const Aws::String& bucket,
+    const std::string& prefix_str,
+    const std::string& aws_prefix,
+    const std::string& delimiter,
+    const std::string& last_key,
+    std::vector<directory_entry>& entries) const {
+  // Shard only directories whose entry names embed a millisecond timestamp,
+  // i.e. start with `__<13 digits>` like fragment, commit and metadata
+  // names do. Every key up to `last_key` was captured by the first page, so
+  // the timestamp prefixes partition the remaining key space into shards
+  // that can be listed independently.
+  constexpr size_t num_timestamp_digits = 13;
+  const std::string name_prefix = "__";
+  const size_t ts_pos = aws_prefix.size() + name_prefix.size();
+  if (last_key.size() < ts_pos + num_timestamp_digits ||
+      last_key.compare(aws_prefix.size(), name_prefix.size(), name_prefix) !=
+          0) {
+    return false;
+  }
+
+  uint64_t ts_lo = 0;
+  for (size_t i = 0; i < num_timestamp_digits; i++) {
+    const char c = last_key[ts_pos + i];
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    ts_lo = ts_lo * 10 + static_cast<uint64_t>(c - '0');
+  }
+
+  // Entries may carry timestamps slightly past the current time, e.g. with
+  // clock skew between writers; pad the upper bound by a day.
+  uint64_t ts_hi = utils::time::timestamp_now_ms() + 1000 * 60 * 60 * 24;
+  ts_hi = std::max(ts_hi, ts_lo + 1);
+
+  // Choose the timestamp digit prefix length: long enough to produce about
+  // two shards per VFS thread, but not so long that the listing drowns in
+  // near-empty shard requests.
+  const uint64_t target_shards =
+      std::min<uint64_t>(2 * vfs_thread_pool_->concurrency_level(), 64);
+  uint64_t divisor = 1;
+  for (size_t i = 1; i < num_timestamp_digits; i++) {
+    divisor *= 10;
+  }
+  uint64_t prev_divisor = 0;
+  while (divisor > 1 &&
+         (ts_hi / divisor - ts_lo / divisor + 1) < target_shards) {
+    prev_divisor = divisor;
+    divisor /= 10;
+  }
+  if (prev_divisor != 0 &&
+      (ts_hi / divisor - ts_lo / divisor + 1) > 4 * target_shards) {
+    divisor = prev_divisor;
+  }
+
+  const uint64_t p_lo = ts_lo / divisor;
+  const uint64_t p_hi = ts_hi / divisor;
+  const uint64_t num_shards = p_hi - p_lo + 1;
+
+  // When the first page stopped at a common prefix, resuming at it would
+  // list its keys and roll them up into a duplicate of the prefix; skip
+  // past all of them instead.
+  std::string start_after = last_key;
+  if (!delimiter.empty() && last_key.size() >= delimiter.size() &&
+      last_key.compare(
+          last_key.size() - delimiter.size(), delimiter.size(), delimiter) ==
+          0) {
+    start_after += '\xff';
+  }
+
+  // List the shards in parallel: one per timestamp prefix, plus a final
+  // unbounded one for names sorting after the last shard.
+  std::vector<std::vector<directory_entry>> shard_entries(num_shards + 1);
+  throw_if_not_ok(
+      parallel_for(vfs_thread_pool_, 0, num_shards + 1, [&](uint64_t s) {
+        Aws::S3::Model::ListObjectsV2Request request;
+        request.SetBucket(bucket);
+        request.SetDelimiter(delimiter.c_str());
+        if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET) {
+          request.SetRequestPayer(request_payer_);
+        }
+        if (s < num_shards) {
+          const std::string shard_prefix =
+              aws_prefix + name_prefix + std::to_string(p_lo + s);
+          request.SetPrefix(shard_prefix.c_str());
+          if (s == 0) {
+            // The first page already listed the head of this shard.
+            request.SetStartAfter(start_after.c_str());
+          }
+        } else {
+          request.SetPrefix(aws_prefix.c_str());
+          request.SetStartAfter(
+              (aws_prefix + name_prefix + std::to_string(p_hi) + '\xff')
+                  .c_str());
+        }
+        shard_entries[s] = list_objects(
+            request, prefix_str, delimiter, -1, -1, nullptr, nullptr);
+        return Status::Ok();
+      }));
+
+  for (auto& shard : shard_entries) {
+    entries.insert(
+        entries.end(),
+        std::make_move_iterator(shard.begin()),
+        std::make_move_iterator(shard.end()));
+  }
+
+  return true;
+}
+
+std::vector<directory_entry> S3::ls_with_sizes(
+    const URI& prefix, const std::string& delimiter, int max_paths) const {
+  throw_if_not_ok(init_client());
+
+  const auto prefix_dir = prefix.add_trailing_slash();
+
+  auto prefix_str = prefix_dir.to_string();
+  if (!prefix_dir.is_s3()) {
+    throw S3Exception("URI is not an S3 URI: " + prefix_str);
+  }
+
+  Aws::Http::URI aws_uri = prefix_str.c_str();
+  auto aws_prefix = remove_front_slash(aws_uri.GetPath().c_str());
+  Aws::S3::Model::ListObjectsV2Request list_objects_request;
+  list_objects_request.SetBucket(aws_uri.GetAuthority());
+  list_objects_request.SetPrefix(aws_prefix.c_str());
+  list_objects_request.SetDelimiter(delimiter.c_str());
+  if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET) {
+    list_objects_request.SetRequestPayer(request_payer_);
+  }
+
+  // List the first page; most directories fit in a single one.
+  bool more_data = false;
+  std::string last_key;
+  auto entries = list_objects(
+      list_objects_request,
+      prefix_str,
+      delimiter,
+      max_paths,
+      1,
+      &more_data,
+      &last_key);
+  if (!more_data) {
+    return entries;
+  }
+
+  // A full listing of a large directory fans out across key shards on the
+  // VFS thread pool, when the directory layout supports it.
+  if (max_paths == -1 &&
+      ls_sharded(
+          aws_uri.GetAuthority(),
+          prefix_str,
+          aws_prefix,
+          delimiter,
+          last_key,
+          entries)) {
+    return entries;
+  }
+
+  // Otherwise resume the sequential pagination from the first page.
+  auto remaining = list_objects(
+      list_objects_request,
+      prefix_str,
+      delimiter,
+      max_paths == -1 ? -1 : max_paths - static_cast<int>(entries.size()),
+      -1,
+      nullptr,
+      nullptr);
+  entries.insert(
+      entries.end(),
+      std::make_move_iterator(remaining.begin()),
+      std::make_move_iterator(remaining.end()));
+
+  return entries;
+}
+
 Status S3::move_object(const URI& old_uri, const URI& new_uri) const {
   RETURN_NOT_OK(init_client());
 
@@ -1027,6 +1225,7 @@ Status S3::object_size(const URI& uri, uint64_t* nbytes) const {
   head_object_request.SetKey(aws_path.c_str());
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     head_object_request.SetRequestPayer(request_payer_);
+  pace_request();
   auto head_object_outcome = client_->HeadObject(head_object_request);
 
   if (!head_object_outcome.IsSuccess())
@@ -1045,7 +1244,8 @@ Status S3::read_impl(
     void* const buffer,
     const uint64_t length,
     const uint64_t read_ahead_length,
-    uint64_t* const length_returned) const {
+    uint64_t* const length_returned,
+    const CancellationSource* cancellation) const {
   RETURN_NOT_OK(init_client());
 
   if (!uri.is_s3()) {
@@ -1055,6 +1255,14 @@ Status S3::read_impl(
 
   Aws::Http::URI aws_uri = uri.c_str();
   Aws::S3::Model::GetObjectRequest get_object_request;
+  if (cancellation != nullptr) {
+    // Returning `false` from the continuation handler makes the SDK abort
+    // the transfer mid-flight instead of draining the response.
+    get_object_request.SetContinueRequestHandler(
+        [cancellation](const Aws::Http::HttpRequest*) {
+          return !cancellation->is_cancelled();
+        });
+  }
   get_object_request.WithBucket(aws_uri.GetAuthority())
       .WithKey(aws_uri.GetPath());
   get_object_request.SetRange(
@@ -1072,6 +1280,7 @@ Status S3::read_impl(
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     get_object_request.SetRequestPayer(request_payer_);
 
+  pace_request();
   auto get_object_outcome = client_->GetObject(get_object_request);
   if (!get_object_outcome.IsSuccess()) {
     return LOG_STATUS(Status_S3Error(
@@ -1105,6 +1314,7 @@ Status S3::remove_object(const URI& uri) const {
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     delete_object_request.SetRequestPayer(request_payer_);
 
+  pace_request();
   auto delete_object_outcome = client_->DeleteObject(delete_object_request);
   if (!delete_object_outcome.IsSuccess()) {
     return LOG_STATUS(Status_S3Error(
@@ -1117,6 +1327,75 @@ Status S3::remove_object(const URI& uri) const {
   return Status::Ok();
 }
 
+void S3::remove_objects(const std::vector<URI>& uris) const {
+  throw_if_not_ok(init_client());
+
+  // The `DeleteObjects` API accepts at most 1000 keys per request, all
+  // living in the same bucket.
+  constexpr uint64_t max_delete_batch_size = 1000;
+
+  // Group the keys per bucket.
+  std::unordered_map<std::string, Aws::Vector<Aws::S3::Model::ObjectIdentifier>>
+      keys_per_bucket;
+  for (const auto& uri : uris) {
+    if (!uri.is_s3()) {
+      throw S3Exception(
+          std::string("URI is not an S3 URI: " + uri.to_string()));
+    }
+
+    Aws::Http::URI aws_uri = uri.to_string().c_str();
+    keys_per_bucket[std::string(aws_uri.GetAuthority().c_str())].emplace_back(
+        Aws::S3::Model::ObjectIdentifier().WithKey(aws_uri.GetPath()));
+  }
+
+  // Cut the keys into request batches.
+  std::vector<std::pair<Aws::String, Aws::S3::Model::Delete>> batches;
+  for (auto& [bucket, keys] : keys_per_bucket) {
+    for (uint64_t i = 0; i < keys.size(); i += max_delete_batch_size) {
+      const auto batch_size =
+          std::min<uint64_t>(max_delete_batch_size, keys.size() - i);
+      Aws::S3::Model::Delete delete_objects;
+      delete_objects.SetObjects(Aws::Vector<Aws::S3::Model::ObjectIdentifier>(
+          keys.begin() + i, keys.begin() + i + batch_size));
+      delete_objects.SetQuiet(true);
+      batches.emplace_back(
+          Aws::String(bucket.c_str()), std::move(delete_objects));
+    }
+  }
+
+  // Issue the batches in parallel. The batched responses are authoritative,
+  // so there is no per-object deletion wait like in `remove_object`; one
+  // `HeadObject` per key would defeat the batching.
+  throw_if_not_ok(
+      parallel_for(vfs_thread_pool_, 0, batches.size(), [&](size_t i) {
+        Aws::S3::Model::DeleteObjectsRequest delete_objects_request;
+        delete_objects_request.SetBucket(batches[i].first);
+        delete_objects_request.SetDelete(std::move(batches[i].second));
+        if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+          delete_objects_request.SetRequestPayer(request_payer_);
+
+        pace_request();
+        auto outcome = client_->DeleteObjects(delete_objects_request);
+        if (!outcome.IsSuccess()) {
+          return LOG_STATUS(Status_S3Error(
+              std::string("Failed to delete S3 objects in bucket '") +
+              batches[i].first.c_str() + "'" + outcome_error_message(outcome)));
+        }
+
+        // With `Quiet` set, only the keys that failed to delete are
+        // reported back.
+        const auto& errors = outcome.GetResult().GetErrors();
+        if (!errors.empty()) {
+          return LOG_STATUS(Status_S3Error(
+              std::string("Failed to delete S3 object '") +
+              errors.front().GetKey().c_str() + "': " +
+              errors.front().GetMessage().c_str()));
+        }
+
+        return Status::Ok();
+      }));
+}
+
 void S3::global_order_write_buffered(
     const URI& uri, const void* buffer, uint64_t length) {
   throw_if_not_ok(init_client());
@@ -1314,6 +1593,73 @@ std::string S3::remove_trailing_slash(const std::string& path) {
 /*          PRIVATE METHODS          */
 /* ********************************* */
 
+/**
+ * The transport state shared across contexts through the process-wide
+ * transport pool. Everything the pooled client references must be owned
+ * here, as the pool entry outlives the `S3` instance that created it.
+ */
+struct PooledS3Client {
+  /** The S3 client. */
+  shared_ptr<TileDBS3Client> client;
+
+  /** The credentials provider used by `client`. */
+  shared_ptr<Aws::Auth::AWSCredentialsProvider> credentials_provider;
+
+  /** The configuration used to build `client`. */
+  shared_ptr<Aws::Client::ClientConfiguration> client_config;
+};
+
+/**
+ * Builds the transport pool key for an S3 client. Every configuration
+ * parameter that affects the connection, the credentials or the request
+ * headers must be part of the key so that two contexts only share a client
+ * when it behaves identically for both.
+ */
+static std::string client_pool_key(
+    const S3Parameters& params, const SSLConfig& ssl_config) {
+  std::stringstream key;
+  key << "s3\n"
+      << params.region_ << "\n"
+      << params.endpoint_override_ << "\n"
+      << params.scheme_ << "\n"
+      << params.proxy_host_ << "\n"
+      << params.proxy_port_ << "\n"
+      << params.proxy_scheme_ << "\n"
+      << params.proxy_username_ << "\n"
+      << params.proxy_password_ << "\n"
+      << params.connect_timeout_ms_ << "\n"
+      << params.request_timeout_ms_ << "\n"
+      << params.connect_max_tries_ << "\n"
+      << params.connect_scale_factor_ << "\n"
+      << params.config_source_ << "\n"
+      << params.no_sign_request_ << "\n"
+      << params.aws_access_key_id_ << "\n"
+      << params.aws_secret_access_key_ << "\n"
+      << params.aws_session_token_ << "\n"
+      << params.aws_role_arn_ << "\n"
+      << params.aws_external_id_ << "\n"
+      << params.aws_load_frequency_ << "\n"
+      << params.aws_session_name_ << "\n"
+      << params.use_virtual_addressing_ << "\n"
+      << params.requester_pays_ << "\n"
+      << ssl_config.ca_file() << "\n"
+      << ssl_config.ca_path() << "\n"
+      << ssl_config.verify() << "\n";
+
+  // Iterate the headers in sorted order for a deterministic key.
+  std::map<std::string, std::string> headers(
+      params.custom_headers_.begin(), params.custom_headers_.end());
+  for (const auto& [name, value] : headers) {
+    key << name << ": " << value << "\n";
+  }
+
+  return key.str();
+}
+
+void S3::pace_request() const {
+  RequestRateGovernor::instance().acquire(RequestRateGovernor::Backend::S3);
+}
+
 Status S3::init_client() const {
   assert(state_ == State::INITIALIZED);
 
@@ -1344,6 +1690,19 @@ Status S3::init_client() const {
     return Status::Ok();
   }
 
+  // Reuse a pooled client created by a previous context with an identical
+  // connection configuration, if one exists. This skips client warm-up and
+  // keeps the SDK's TLS connection pool warm across short-lived contexts.
+  auto& transport_pool =
+      global_state::GlobalState::GetGlobalState().transport_pool();
+  const std::string pool_key = client_pool_key(s3_params_, ssl_config_);
+  if (auto pooled = transport_pool.find<PooledS3Client>(pool_key)) {
+    client_ = pooled->client;
+    credentials_provider_ = pooled->credentials_provider;
+    client_config_ = pooled->client_config;
+    return Status::Ok();
+  }
+
   // ClientConfiguration should be lazily init'ed here in init_client to avoid
   // potential slowdowns for non s3 users as the ClientConfig now attempts to
   // check for client configuration on create, which can be slow if aws is not
@@ -1351,9 +1710,9 @@ Status S3::init_client() const {
 
   client_config_ = make_shared<Aws::Client::ClientConfiguration>(HERE());
 
-  s3_tp_executor_ = make_shared<S3ThreadPoolExecutor>(HERE(), vfs_thread_pool_);
-
-  client_config_->executor = s3_tp_executor_;
+  // The client is shared across contexts through the transport pool, so no
+  // executor bound to this context's VFS thread pool is set; we never issue
+  // asynchronous SDK operations, which are the only users of the executor.
 
   auto& client_config = *client_config_.get();
 
@@ -1383,9 +1742,11 @@ Status S3::init_client() const {
   client_config.caPath = ssl_config_.ca_path();
   client_config.verifySSL = ssl_config_.verify();
 
+  // The retry strategy must not capture this context's `stats_`, as the
+  // pooled client outlives the context that created it.
   client_config.retryStrategy = Aws::MakeShared<S3RetryStrategy>(
       constants::s3_allocation_tag.c_str(),
-      stats_,
+      nullptr,
       s3_params_.connect_max_tries_,
       s3_params_.connect_scale_factor_);
 
@@ -1448,8 +1809,6 @@ Status S3::init_client() const {
         break;
       }
       case 7: {
-        s3_tp_executor_->Stop();
-
         throw S3Exception(
             "Ambiguous authentication credentials; both permanent and "
             "temporary authentication credentials are configured");
@@ -1473,8 +1832,6 @@ Status S3::init_client() const {
         break;
       }
       default: {
-        s3_tp_executor_->Stop();
-
         throw S3Exception(
             "Ambiguous authentification options; Setting vfs.s3.config_source "
             "is "
@@ -1510,12 +1867,33 @@ Status S3::init_client() const {
     }
   }
 
+  // Register the client for reuse by later contexts. If another thread with
+  // its own `S3` instance raced this initialization, adopt its client so
+  // that all contexts converge on a single client per configuration.
+  auto pooled = make_shared<PooledS3Client>(HERE());
+  pooled->client = client_;
+  pooled->credentials_provider = credentials_provider_;
+  pooled->client_config = client_config_;
+  pooled = transport_pool.insert(pool_key, pooled);
+  client_ = pooled->client;
+  credentials_provider_ = pooled->credentials_provider;
+  client_config_ = pooled->client_config;
+
   return Status::Ok();
 }
 
 Status S3::copy_object(const URI& old_uri, const URI& new_uri) const {
   RETURN_NOT_OK(init_client());
 
+  // A single `CopyObject` request can copy at most 5GB; larger objects
+  // must be copied server-side in ranged parts.
+  constexpr uint64_t max_copy_object_size = 5368709120;  // 5GB
+  uint64_t size = 0;
+  RETURN_NOT_OK(object_size(old_uri, &size));
+  if (size > max_copy_object_size) {
+    return copy_object_multipart(old_uri, new_uri, size);
+  }
+
   Aws::Http::URI src_uri = old_uri.c_str();
   Aws::Http::URI dst_uri = new_uri.c_str();
   Aws::S3::Model::CopyObjectRequest copy_object_request;
@@ -1536,6 +1914,7 @@ Status S3::copy_object(const URI& old_uri, const URI& new_uri) const {
     copy_object_request.SetACL(object_canned_acl_);
   }
 
+  pace_request();
   auto copy_object_outcome = client_->CopyObject(copy_object_request);
   if (!copy_object_outcome.IsSuccess()) {
     return LOG_STATUS(Status_S3Error(
@@ -1549,6 +1928,120 @@ Status S3::copy_object(const URI& old_uri, const URI& new_uri) const {
   return Status::Ok();
 }
 
+Status S3::copy_object_multipart(
+    const URI& old_uri, const URI& new_uri, const uint64_t size) const {
+  Aws::Http::URI src_uri = old_uri.c_str();
+  Aws::Http::URI dst_uri = new_uri.c_str();
+  const std::string copy_source = join_authority_and_path(
+      src_uri.GetAuthority().c_str(), src_uri.GetPath().c_str());
+
+  // Initiate the multipart upload for the destination object.
+  Aws::S3::Model::CreateMultipartUploadRequest multipart_upload_request;
+  multipart_upload_request.SetBucket(dst_uri.GetAuthority());
+  multipart_upload_request.SetKey(dst_uri.GetPath());
+  multipart_upload_request.SetContentType("application/octet-stream");
+  if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+    multipart_upload_request.SetRequestPayer(request_payer_);
+  if (sse_ != Aws::S3::Model::ServerSideEncryption::NOT_SET)
+    multipart_upload_request.SetServerSideEncryption(sse_);
+  if (!s3_params_.sse_kms_key_id_.empty())
+    multipart_upload_request.SetSSEKMSKeyId(
+        Aws::String(s3_params_.sse_kms_key_id_.c_str()));
+  if (storage_class_ != Aws::S3::Model::StorageClass::NOT_SET)
+    multipart_upload_request.SetStorageClass(storage_class_);
+  if (object_canned_acl_ != Aws::S3::Model::ObjectCannedACL::NOT_SET) {
+    multipart_upload_request.SetACL(object_canned_acl_);
+  }
+
+  auto multipart_upload_outcome =
+      client_->CreateMultipartUpload(multipart_upload_request);
+  if (!multipart_upload_outcome.IsSuccess()) {
+    return LOG_STATUS(Status_S3Error(
+        std::string("Failed to copy S3 object ") + old_uri.c_str() + " to " +
+        new_uri.c_str() + outcome_error_message(multipart_upload_outcome)));
+  }
+  const Aws::String upload_id =
+      multipart_upload_outcome.GetResult().GetUploadId();
+
+  // Size each part so that the copy never exceeds the 10,000-part
+  // limit of a multipart upload.
+  constexpr uint64_t max_parts = 10000;
+  const uint64_t part_size = std::max(
+      s3_params_.multipart_part_size_, utils::math::ceil(size, max_parts));
+  const uint64_t num_parts = utils::math::ceil(size, part_size);
+
+  // Copy each part server-side, in parallel.
+  std::vector<Aws::S3::Model::CompletedPart> completed_parts(num_parts);
+  auto status =
+      parallel_for(vfs_thread_pool_, 0, num_parts, [&](uint64_t i) {
+        const uint64_t first_byte = i * part_size;
+        const uint64_t last_byte = std::min(first_byte + part_size, size) - 1;
+        Aws::S3::Model::UploadPartCopyRequest upload_part_copy_request;
+        upload_part_copy_request.SetBucket(dst_uri.GetAuthority());
+        upload_part_copy_request.SetKey(dst_uri.GetPath());
+        upload_part_copy_request.SetUploadId(upload_id);
+        upload_part_copy_request.SetPartNumber(static_cast<int>(i + 1));
+        upload_part_copy_request.SetCopySource(copy_source.c_str());
+        upload_part_copy_request.SetCopySourceRange(
+            ("bytes=" + std::to_string(first_byte) + "-" +
+             std::to_string(last_byte))
+                .c_str());
+        if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+          upload_part_copy_request.SetRequestPayer(request_payer_);
+
+        pace_request();
+        auto outcome = client_->UploadPartCopy(upload_part_copy_request);
+        if (!outcome.IsSuccess()) {
+          return LOG_STATUS(Status_S3Error(
+              std::string("Failed to copy part of S3 object ") +
+              old_uri.c_str() + outcome_error_message(outcome)));
+        }
+
+        completed_parts[i] =
+            Aws::S3::Model::CompletedPart()
+                .WithETag(outcome.GetResult().GetCopyPartResult().GetETag())
+                .WithPartNumber(static_cast<int>(i + 1));
+        return Status::Ok();
+      });
+
+  if (!status.ok()) {
+    // Abort the multipart upload, best-effort.
+    Aws::S3::Model::AbortMultipartUploadRequest abort_request;
+    abort_request.SetBucket(dst_uri.GetAuthority());
+    abort_request.SetKey(dst_uri.GetPath());
+    abort_request.SetUploadId(upload_id);
+    if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+      abort_request.SetRequestPayer(request_payer_);
+    client_->AbortMultipartUpload(abort_request);
+    return status;
+  }
+
+  // Complete the multipart upload.
+  Aws::S3::Model::CompletedMultipartUpload completed_upload;
+  for (const auto& part : completed_parts) {
+    completed_upload.AddParts(part);
+  }
+  Aws::S3::Model::CompleteMultipartUploadRequest complete_request;
+  complete_request.SetBucket(dst_uri.GetAuthority());
+  complete_request.SetKey(dst_uri.GetPath());
+  complete_request.SetUploadId(upload_id);
+  complete_request.SetMultipartUpload(std::move(completed_upload));
+  if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+    complete_request.SetRequestPayer(request_payer_);
+
+  auto complete_outcome = client_->CompleteMultipartUpload(complete_request);
+  if (!complete_outcome.IsSuccess()) {
+    return LOG_STATUS(Status_S3Error(
+        std::string("Failed to copy S3 object ") + old_uri.c_str() + " to " +
+        new_uri.c_str() + outcome_error_message(complete_outcome)));
+  }
+
+  throw_if_not_ok(wait_for_object_to_propagate(
+      complete_request.GetBucket(), complete_request.GetKey()));
+
+  return Status::Ok();
+}
+
 Status S3::fill_file_buffer(
     Buffer* buff,
     const void* buffer,
@@ -1580,7 +2073,13 @@ Status S3::get_file_buffer(const URI& uri, Buffer** buff) {
   auto uri_str = uri.to_string();
   auto it = file_buffers_.find(uri_str);
   if (it == file_buffers_.end()) {
-    auto new_buff = tdb_new(Buffer);
+    Buffer* new_buff;
+    if (!file_buffer_pool_.empty()) {
+      new_buff = file_buffer_pool_.back();
+      file_buffer_pool_.pop_back();
+    } else {
+      new_buff = tdb_new(Buffer);
+    }
     file_buffers_[uri_str] = new_buff;
     *buff = new_buff;
   } else {
@@ -1590,6 +2089,19 @@ Status S3::get_file_buffer(const URI& uri, Buffer** buff) {
   return Status::Ok();
 }
 
+void S3::release_file_buffer(Buffer* buff) {
+  buff->reset_size();
+
+  std::unique_lock<std::mutex> lck(file_buffers_mtx_);
+  if (file_buffer_pool_.size() < s3_params_.max_parallel_ops_) {
+    file_buffer_pool_.emplace_back(buff);
+    return;
+  }
+  lck.unlock();
+
+  tdb_delete(buff);
+}
+
 Status S3::initiate_multipart_request(
     Aws::Http::URI aws_uri, MultiPartUploadState* state) {
   RETURN_NOT_OK(init_client());
@@ -1750,7 +2262,7 @@ Status S3::finish_flush_object(
   std::unique_lock<std::mutex> file_buffers_lck(file_buffers_mtx_);
   file_buffers_.erase(uri.to_string());
   file_buffers_lck.unlock();
-  tdb_delete(buff);
+  release_file_buffer(buff);
 
   if (!outcome.IsSuccess() || is_abort) {
     std::string error_message =
@@ -1809,6 +2321,7 @@ void S3::write_direct(const URI& uri, const void* buffer, uint64_t length) {
     put_object_request.SetACL(object_canned_acl_);
   }
 
+  pace_request();
   auto put_object_outcome = client_->PutObject(put_object_request);
   if (!put_object_outcome.IsSuccess()) {
     throw S3Exception(
@@ -1981,6 +2494,7 @@ S3::MakeUploadPartCtx S3::make_upload_part_req(
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     upload_part_request.SetRequestPayer(request_payer_);
 
+  pace_request();
   auto upload_part_outcome = client_->UploadPart(upload_part_request);
 
   MakeUploadPartCtx ctx(std::move(upload_part_outcome), upload_part_num);
@@ -39,6 +39,7 @@
 #include "ls_scanner.h"
 #include "tiledb/common/common.h"
 #include "tiledb/common/filesystem/directory_entry.h"
+#include "tiledb/common/governor/governor.h"
 #include "tiledb/common/rwlock.h"
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
@@ -46,8 +47,8 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/curl/curl_init.h"
-#include "tiledb/sm/filesystem/s3_thread_pool_executor.h"
 #include "tiledb/sm/filesystem/ssl_config.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/stats/stats.h"
@@ -72,8 +73,10 @@
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 #include <aws/s3/model/CopyObjectRequest.h>
 #include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/Delete.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/DeleteObjectsRequest.h>
 #include <aws/s3/model/GetBucketLocationRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadBucketRequest.h>
@@ -200,6 +203,8 @@ struct S3Parameters {
             config.get<int64_t>("vfs.s3.connect_max_tries", Config::must_find))
       , connect_scale_factor_(config.get<int64_t>(
             "vfs.s3.connect_scale_factor", Config::must_find))
+      , max_request_rate_(
+            config.get<float>("vfs.s3.max_request_rate", Config::must_find))
       , custom_headers_(load_headers(config))
       , logging_level_(
             config.get<std::string>("vfs.s3.logging_level", Config::must_find))
@@ -292,6 +297,9 @@ struct S3Parameters {
   /** The scale factor for exponential backoff when connecting to S3. */
   int64_t connect_scale_factor_;
 
+  /** The max aggregate request rate per process; 0 disables pacing. */
+  float max_request_rate_;
+
   /** Custom headers to add to all s3 requests. */
   Headers custom_headers_;
 
@@ -390,11 +398,11 @@ class TileDBS3Client : public Aws::S3::S3Client {
 
  protected:
   /**
-   * A reference to the S3 configuration parameters, which stores the header.
-   *
-   * @note Until the removal of init_client(), this must be const-qualified.
+   * A copy of the S3 configuration parameters, which stores the header.
+   * Stored by value so that a pooled client can outlive the `S3` instance
+   * that created it.
    */
-  const S3Parameters& params_;
+  const S3Parameters params_;
 };
 
 /**
@@ -748,6 +756,15 @@ class S3 : FilesystemBase {
     throw_if_not_ok(remove_object(uri));
   }
 
+  /**
+   * Deletes the objects with the input URIs, issuing batched
+   * `DeleteObjects` requests of up to 1000 keys each in parallel,
+   * instead of one `DeleteObject` request per key.
+   *
+   * @param uris The URIs of the objects to be deleted.
+   */
+  void remove_objects(const std::vector<URI>& uris) const;
+
   /**
    * Retrieves the size of a file.
    *
@@ -979,6 +996,8 @@ class S3 : FilesystemBase {
    * @param length The size of the data to be read from the object.
    * @param read_ahead_length The additional length to read ahead.
    * @param length_returned Returns the total length read into `buffer`.
+   * @param cancellation Optional cancellation source; when it fires, the
+   *     in-flight transfer is aborted through the SDK continuation handler.
    * @return Status
    */
   Status read_impl(
@@ -987,7 +1006,8 @@ class S3 : FilesystemBase {
       void* const buffer,
       const uint64_t length,
       const uint64_t read_ahead_length,
-      uint64_t* const length_returned) const;
+      uint64_t* const length_returned,
+      const CancellationSource* cancellation = nullptr) const;
 
   /**
    * Deletes an object with a given URI.
@@ -1086,7 +1106,13 @@ class S3 : FilesystemBase {
           return false;
         }
 
-        s3_stats_->add_counter("vfs_s3_slow_down_retries", 1);
+        if (s3_stats_ != nullptr) {
+          s3_stats_->add_counter("vfs_s3_slow_down_retries", 1);
+        }
+
+        // Feed throttling back into the process-wide pacing governor.
+        RequestRateGovernor::instance().report_throttle(
+            RequestRateGovernor::Backend::S3);
 
         return true;
       }
@@ -1120,7 +1146,10 @@ class S3 : FilesystemBase {
     }
 
    private:
-    /** The S3 `stats_`. */
+    /**
+     * The S3 `stats_`, or nullptr when the owning client is shared across
+     * contexts and must not reference per-context state.
+     */
     stats::Stats* s3_stats_;
 
     /** The maximum number of retries after an error. */
@@ -1354,9 +1383,6 @@ class S3 : FilesystemBase {
   /** Configuration object used to initialize the client. */
   mutable shared_ptr<Aws::Client::ClientConfiguration> client_config_;
 
-  /** The executor used by 'client_'. */
-  mutable shared_ptr<S3ThreadPoolExecutor> s3_tp_executor_;
-
   /** The size of the file buffers used in multipart uploads. */
   uint64_t file_buffer_size_;
 
@@ -1373,6 +1399,14 @@ class S3 : FilesystemBase {
   /** File buffers used in the multi-part uploads. */
   std::unordered_map<std::string, Buffer*> file_buffers_;
 
+  /**
+   * Pool of file buffers retired by flushed objects. Writing a fragment
+   * flushes one object per attribute file, so recycling the buffers avoids
+   * allocating `file_buffer_size_` bytes per object. Protected by
+   * `file_buffers_mtx_`.
+   */
+  std::vector<Buffer*> file_buffer_pool_;
+
   /** Pointer to thread pool owned by parent VFS instance. */
   ThreadPool* vfs_thread_pool_;
 
@@ -1416,6 +1450,12 @@ class S3 : FilesystemBase {
    */
   Status init_client() const;
 
+  /**
+   * Blocks until the process-wide request-rate governor admits one S3
+   * request. A no-op unless 'vfs.s3.max_request_rate' is set.
+   */
+  void pace_request() const;
+
   /**
    * Copies an object.
    *
@@ -1425,6 +1465,74 @@ class S3 : FilesystemBase {
    */
   Status copy_object(const URI& old_uri, const URI& new_uri) const;
 
+  /**
+   * Copies an object larger than the 5GB `CopyObject` limit by copying
+   * it server-side in ranged parts with `UploadPartCopy`, parallelized
+   * on the VFS thread pool.
+   *
+   * @param old_uri The object to be copied.
+   * @param new_uri The newly created object.
+   * @param size The size of the object to be copied, in bytes.
+   * @return Status
+   */
+  Status copy_object_multipart(
+      const URI& old_uri, const URI& new_uri, uint64_t size) const;
+
+  /**
+   * Runs a paginated ListObjectsV2 request and converts the results to
+   * directory entries.
+   *
+   * @param request The request to run. On return, the request holds the
+   * continuation token of the next page if the listing stopped at
+   * `max_pages`, so the caller may resume it.
+   * @param prefix_str The listing prefix, used in error messages.
+   * @param delimiter The delimiter of the request, used in error messages.
+   * @param max_paths The maximum number of entries to retrieve, or -1 for
+   * no limit.
+   * @param max_pages The maximum number of pages to request, or -1 for no
+   * limit.
+   * @param more_data If non-null, set to whether more entries remain after
+   * the listing stopped at `max_pages`.
+   * @param last_key If non-null, set to the key (or common prefix) at which
+   * the listing stopped, if any.
+   * @return A list of directory_entry objects.
+   */
+  std::vector<directory_entry> list_objects(
+      Aws::S3::Model::ListObjectsV2Request& request,
+      const std::string& prefix_str,
+      const std::string& delimiter,
+      int max_paths,
+      int max_pages,
+      bool* more_data,
+      std::string* last_key) const;
+
+  /**
+   * Completes a truncated listing of a large directory by fanning LIST
+   * requests out across key shards on the VFS thread pool, one shard per
+   * name timestamp prefix. Fragment, commit and metadata names all start
+   * with `__<millisecond timestamp>`, so a directory with many of them
+   * splits into evenly sized shards that can be paginated concurrently
+   * instead of walking a single continuation-token chain.
+   *
+   * @param bucket The bucket of the listed prefix.
+   * @param prefix_str The listing prefix, used in error messages.
+   * @param aws_prefix The listed key prefix within the bucket.
+   * @param delimiter The delimiter of the listing.
+   * @param last_key The key (or common prefix) at which the sequential
+   * listing of the first page stopped.
+   * @param entries The entries of the first page; the sharded results are
+   * appended to it.
+   * @return Whether sharding applied. If false, `entries` is unchanged and
+   * the caller must fall back to sequential pagination.
+   */
+  bool ls_sharded(
+      const Aws::String& bucket,
+      const std::string& prefix_str,
+      const std::string& aws_prefix,
+      const std::string& delimiter,
+      const std::string& last_key,
+      std::vector<directory_entry>& entries) const;
+
   /**
    * Fills the file buffer (given as an input `Buffer` object) from the
    * input binary `buffer`, up until the size of the file buffer becomes
@@ -1464,6 +1572,15 @@ class S3 : FilesystemBase {
    */
   Status get_file_buffer(const URI& uri, Buffer** buff);
 
+  /**
+   * Returns the file buffer of a flushed S3 object to the buffer pool so
+   * that a subsequent object can reuse its allocation. Buffers in excess
+   * of the pool capacity are freed.
+   *
+   * @param buff The retired file buffer.
+   */
+  void release_file_buffer(Buffer* buff);
+
   /**
    * Initiates a new multipart upload request for the input URI. Note: the
    * caller must hold the multipart data structure mutex.
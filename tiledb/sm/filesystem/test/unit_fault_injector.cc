@@ -0,0 +1,94 @@
+/**
+ * @file   unit_fault_injector.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `FaultInjector` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/filesystem/fault_injector.h"
+
+#include <chrono>
+
+using namespace tiledb::sm;
+
+TEST_CASE("FaultInjector: Disabled by default", "[fault-injector]") {
+  Config config;
+  FaultInjector injector(config);
+  CHECK(!injector.enabled());
+
+  // All operations are no-ops.
+  CHECK_NOTHROW(injector.inject_meta_op());
+  CHECK_NOTHROW(injector.inject_data_op(1024 * 1024));
+}
+
+TEST_CASE("FaultInjector: Latency injection", "[fault-injector]") {
+  Config config;
+  throw_if_not_ok(config.set("vfs.fault_injection.mean_latency_ms", "5"));
+  FaultInjector injector(config);
+  CHECK(injector.enabled());
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < 10; i++) {
+    injector.inject_meta_op();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+
+  // 10 operations at a 5ms mean latency sleep for 50ms in expectation;
+  // only check that some latency was injected to keep the test stable.
+  CHECK(t1 - t0 >= std::chrono::milliseconds(1));
+}
+
+TEST_CASE("FaultInjector: Bandwidth cap", "[fault-injector]") {
+  Config config;
+  throw_if_not_ok(config.set("vfs.fault_injection.bandwidth_mbps", "100"));
+  FaultInjector injector(config);
+  CHECK(injector.enabled());
+
+  // 10MB at 100MB/s takes 100ms.
+  auto t0 = std::chrono::steady_clock::now();
+  injector.inject_data_op(10 * 1024 * 1024);
+  auto t1 = std::chrono::steady_clock::now();
+  CHECK(t1 - t0 >= std::chrono::milliseconds(100));
+
+  // Metadata operations transfer no data and are not delayed.
+  CHECK_NOTHROW(injector.inject_meta_op());
+}
+
+TEST_CASE("FaultInjector: Throttling errors", "[fault-injector]") {
+  Config config;
+  throw_if_not_ok(config.set("vfs.fault_injection.throttle_rate", "1"));
+  throw_if_not_ok(config.set("vfs.fault_injection.max_retries", "1"));
+  FaultInjector injector(config);
+  CHECK(injector.enabled());
+
+  // Every attempt is throttled and the schedule has a single attempt, so
+  // the error always surfaces.
+  REQUIRE_THROWS(injector.inject_meta_op());
+  REQUIRE_THROWS(injector.inject_data_op(1024));
+}
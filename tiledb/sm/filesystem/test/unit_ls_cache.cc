@@ -0,0 +1,95 @@
+/**
+ * @file   unit_ls_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `LsCache` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/filesystem/ls_cache.h"
+
+using namespace tiledb::sm;
+
+TEST_CASE("LsCache: Lookup and insert", "[ls-cache]") {
+  LsCache cache(60, 8);
+
+  CHECK(!cache.lookup("r:s3://bucket/array/").has_value());
+
+  LsObjects objects{
+      {"s3://bucket/array/__schema", 100},
+      {"s3://bucket/array/__fragments/f1", 2000}};
+  cache.insert("r:s3://bucket/array/", objects);
+
+  auto cached = cache.lookup("r:s3://bucket/array/");
+  REQUIRE(cached.has_value());
+  CHECK(*cached == objects);
+
+  // Recursive and flat listings of the same prefix are distinct entries.
+  CHECK(!cache.lookup("f:s3://bucket/array/").has_value());
+}
+
+TEST_CASE("LsCache: Invalidation on mutation", "[ls-cache]") {
+  LsCache cache(60, 8);
+  LsObjects objects{{"s3://bucket/array/__schema", 100}};
+  cache.insert("r:s3://bucket/array/", objects);
+  cache.insert("r:s3://bucket/other/", objects);
+
+  // A write under the prefix drops the listings covering it, but not the
+  // listings of unrelated prefixes.
+  cache.invalidate(URI("s3://bucket/array/__fragments/f2"));
+  CHECK(!cache.lookup("r:s3://bucket/array/").has_value());
+  CHECK(cache.lookup("r:s3://bucket/other/").has_value());
+
+  // Removing a directory also drops the listings under it.
+  cache.insert("r:s3://bucket/other/sub/", objects);
+  cache.invalidate(URI("s3://bucket/other"));
+  CHECK(!cache.lookup("r:s3://bucket/other/sub/").has_value());
+}
+
+TEST_CASE("LsCache: TTL expiry", "[ls-cache]") {
+  // A zero TTL expires entries immediately.
+  LsCache cache(0, 8);
+  cache.insert("r:s3://bucket/array/", {{"s3://bucket/array/f", 1}});
+  CHECK(!cache.lookup("r:s3://bucket/array/").has_value());
+}
+
+TEST_CASE("LsCache: LRU eviction", "[ls-cache]") {
+  LsCache cache(60, 2);
+  LsObjects objects{{"s3://bucket/p/f", 1}};
+  cache.insert("r:s3://bucket/p1/", objects);
+  cache.insert("r:s3://bucket/p2/", objects);
+
+  // Touch p1 so that p2 is the least recently used entry.
+  CHECK(cache.lookup("r:s3://bucket/p1/").has_value());
+  cache.insert("r:s3://bucket/p3/", objects);
+
+  CHECK(cache.num_prefixes() == 2);
+  CHECK(cache.lookup("r:s3://bucket/p1/").has_value());
+  CHECK(!cache.lookup("r:s3://bucket/p2/").has_value());
+  CHECK(cache.lookup("r:s3://bucket/p3/").has_value());
+}
@@ -43,6 +43,7 @@
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <chrono>
 #include <iostream>
 #include <list>
 #include <sstream>
@@ -64,6 +65,7 @@ VFS::VFS(
     const Config& config)
     : VFSBase(parent_stats)
     , S3_within_VFS(stats_, io_tp, config)
+    , fault_injector_(config)
     , config_(config)
     , compute_tp_(compute_tp)
     , io_tp_(io_tp)
@@ -76,6 +78,23 @@ VFS::VFS(
   read_ahead_cache_ = tdb_unique_ptr<ReadAheadCache>(
       tdb_new(ReadAheadCache, vfs_params_.read_ahead_cache_size_));
 
+  // Construct the on-disk block cache, if configured.
+  if (!vfs_params_.block_cache_dir_.empty()) {
+    block_cache_ = tdb_unique_ptr<BlockCache>(tdb_new(
+        BlockCache,
+        vfs_params_.block_cache_dir_,
+        vfs_params_.block_cache_size_,
+        vfs_params_.block_cache_block_size_));
+  }
+
+  // Construct the prefix listing cache, if configured.
+  if (vfs_params_.ls_cache_ttl_sec_ > 0) {
+    ls_cache_ = tdb_unique_ptr<LsCache>(tdb_new(
+        LsCache,
+        vfs_params_.ls_cache_ttl_sec_,
+        vfs_params_.ls_cache_max_prefixes_));
+  }
+
 #ifdef HAVE_HDFS
   supported_fs_.insert(Filesystem::HDFS);
   hdfs_ = tdb_unique_ptr<hdfs::HDFS>(tdb_new(hdfs::HDFS));
@@ -108,7 +127,7 @@ VFS::VFS(
 #ifdef _WIN32
   throw_if_not_ok(win_.init(config_));
 #else
-  posix_ = Posix(config_);
+  posix_ = Posix(config_, io_tp_);
 #endif
 
   supported_fs_.insert(Filesystem::MEMFS);
@@ -154,6 +173,9 @@ Config VFS::config() const {
 }
 
 Status VFS::create_dir(const URI& uri) const {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(uri);
+  }
   if (!uri.is_s3() && !uri.is_azure() && !uri.is_gcs()) {
     bool is_dir;
     RETURN_NOT_OK(this->is_dir(uri, &is_dir));
@@ -201,6 +223,7 @@ Status VFS::create_dir(const URI& uri) const {
     }
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     return memfs_.create_dir(uri.to_path());
   }
   throw UnsupportedURI(uri.to_string());
@@ -236,6 +259,9 @@ Status VFS::dir_size(const URI& dir_name, uint64_t* dir_size) const {
 }
 
 Status VFS::touch(const URI& uri) const {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(uri);
+  }
   if (uri.is_file()) {
 #ifdef _WIN32
     return win_.touch(uri.to_path());
@@ -274,6 +300,7 @@ Status VFS::touch(const URI& uri) const {
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     return memfs_.touch(uri.to_path());
   }
   throw UnsupportedURI(uri.to_string());
@@ -390,6 +417,9 @@ Status VFS::is_empty_bucket(
 }
 
 Status VFS::remove_dir(const URI& uri) const {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(uri);
+  }
   if (uri.is_file()) {
 #ifdef _WIN32
     return win_.remove_dir(uri.to_path());
@@ -421,6 +451,7 @@ Status VFS::remove_dir(const URI& uri) const {
     throw BuiltWithout("GCS");
 #endif
   } else if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     return memfs_.remove(uri.to_path(), true);
   } else {
     throw UnsupportedURI(uri.to_string());
@@ -441,6 +472,9 @@ void VFS::remove_dirs(
 }
 
 Status VFS::remove_file(const URI& uri) const {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(uri);
+  }
   if (uri.is_file()) {
 #ifdef _WIN32
     return win_.remove_file(uri.to_path());
@@ -478,6 +512,7 @@ Status VFS::remove_file(const URI& uri) const {
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     return memfs_.remove(uri.to_path(), false);
   }
   throw UnsupportedURI(uri.to_string());
@@ -485,18 +520,40 @@ Status VFS::remove_file(const URI& uri) const {
 
 void VFS::remove_files(
     ThreadPool* compute_tp, const std::vector<URI>& uris) const {
-  throw_if_not_ok(parallel_for(compute_tp, 0, uris.size(), [&](size_t i) {
-    throw_if_not_ok(remove_file(uris[i]));
+#ifdef HAVE_S3
+  // S3 deletions go through the batched `DeleteObjects` API instead of
+  // one request per object.
+  std::vector<URI> s3_uris;
+  std::vector<URI> other_uris;
+  for (const auto& uri : uris) {
+    (uri.is_s3() ? s3_uris : other_uris).emplace_back(uri);
+  }
+  if (!s3_uris.empty()) {
+    if (ls_cache_ != nullptr) {
+      for (const auto& uri : s3_uris) {
+        ls_cache_->invalidate(uri);
+      }
+    }
+    s3().remove_objects(s3_uris);
+  }
+  const auto& to_remove = other_uris;
+#else
+  const auto& to_remove = uris;
+#endif
+  throw_if_not_ok(parallel_for(compute_tp, 0, to_remove.size(), [&](size_t i) {
+    throw_if_not_ok(remove_file(to_remove[i]));
     return Status::Ok();
   }));
 }
 
 void VFS::remove_files(
     ThreadPool* compute_tp, const std::vector<TimestampedURI>& uris) const {
-  throw_if_not_ok(parallel_for(compute_tp, 0, uris.size(), [&](size_t i) {
-    throw_if_not_ok(remove_file(uris[i].uri_));
-    return Status::Ok();
-  }));
+  std::vector<URI> plain_uris;
+  plain_uris.reserve(uris.size());
+  for (const auto& uri : uris) {
+    plain_uris.emplace_back(uri.uri_);
+  }
+  remove_files(compute_tp, plain_uris);
 }
 
 Status VFS::max_parallel_ops(const URI& uri, uint64_t* ops) const {
@@ -564,6 +621,7 @@ Status VFS::file_size(const URI& uri, uint64_t* size) const {
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     return memfs_.file_size(uri.to_path(), size);
   }
   throw UnsupportedURI(uri.to_string());
@@ -611,6 +669,7 @@ Status VFS::is_dir(const URI& uri, bool* is_dir) const {
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     *is_dir = memfs_.is_dir(uri.to_path());
     return Status::Ok();
   }
@@ -661,6 +720,7 @@ Status VFS::is_file(const URI& uri, bool* is_file) const {
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_meta_op();
     *is_file = memfs_.is_file(uri.to_path());
     return Status::Ok();
   }
@@ -756,6 +816,7 @@ std::vector<directory_entry> VFS::ls_with_sizes(const URI& parent) const {
     throw BuiltWithout("HDFS");
 #endif
   } else if (parent.is_memfs()) {
+    fault_injector_.inject_meta_op();
     entries = memfs_.ls_with_sizes(URI("mem://" + parent.to_path()));
   } else {
     throw UnsupportedURI(parent.to_string());
@@ -772,6 +833,11 @@ std::vector<directory_entry> VFS::ls_with_sizes(const URI& parent) const {
 }
 
 Status VFS::move_file(const URI& old_uri, const URI& new_uri) {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(old_uri);
+    ls_cache_->invalidate(new_uri);
+  }
+
   // If new_uri exists, delete it or raise an error based on `force`
   bool is_file;
   RETURN_NOT_OK(this->is_file(new_uri, &is_file));
@@ -838,6 +904,7 @@ Status VFS::move_file(const URI& old_uri, const URI& new_uri) {
   // In-memory filesystem
   if (old_uri.is_memfs()) {
     if (new_uri.is_memfs()) {
+      fault_injector_.inject_meta_op();
       return memfs_.move(old_uri.to_path(), new_uri.to_path());
     }
     throw UnsupportedOperation("Moving files");
@@ -848,6 +915,11 @@ Status VFS::move_file(const URI& old_uri, const URI& new_uri) {
 }
 
 Status VFS::move_dir(const URI& old_uri, const URI& new_uri) {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(old_uri);
+    ls_cache_->invalidate(new_uri);
+  }
+
   // File
   if (old_uri.is_file()) {
     if (new_uri.is_file()) {
@@ -910,6 +982,7 @@ Status VFS::move_dir(const URI& old_uri, const URI& new_uri) {
   // In-memory filesystem
   if (old_uri.is_memfs()) {
     if (new_uri.is_memfs()) {
+      fault_injector_.inject_meta_op();
       return memfs_.move(old_uri.to_path(), new_uri.to_path());
     }
     throw UnsupportedOperation("Moving directories");
@@ -920,6 +993,10 @@ Status VFS::move_dir(const URI& old_uri, const URI& new_uri) {
 }
 
 Status VFS::copy_file(const URI& old_uri, const URI& new_uri) {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(new_uri);
+  }
+
   // If new_uri exists, delete it or raise an error based on `force`
   bool is_file;
   RETURN_NOT_OK(this->is_file(new_uri, &is_file));
@@ -967,11 +1044,11 @@ Status VFS::copy_file(const URI& old_uri, const URI& new_uri) {
   // Azure
   if (old_uri.is_azure()) {
     if (new_uri.is_azure()) {
-      if constexpr (azure_enabled) {
-        throw VFSException("Copying files on Azure is not yet supported.");
-      } else {
-        throw BuiltWithout("Azure");
-      }
+#ifdef HAVE_AZURE
+      return azure_.copy_file(old_uri, new_uri);
+#else
+      throw BuiltWithout("Azure");
+#endif
     }
     throw UnsupportedOperation("Copying files");
   }
@@ -979,11 +1056,11 @@ Status VFS::copy_file(const URI& old_uri, const URI& new_uri) {
   // GCS
   if (old_uri.is_gcs()) {
     if (new_uri.is_gcs()) {
-      if constexpr (gcs_enabled) {
-        throw VFSException("Copying files on GCS is not yet supported.");
-      } else {
-        throw BuiltWithout("GCS");
-      }
+#ifdef HAVE_GCS
+      return gcs_.copy_file(old_uri, new_uri);
+#else
+      throw BuiltWithout("GCS");
+#endif
     }
     throw UnsupportedOperation("Copying files");
   }
@@ -993,6 +1070,10 @@ Status VFS::copy_file(const URI& old_uri, const URI& new_uri) {
 }
 
 Status VFS::copy_dir(const URI& old_uri, const URI& new_uri) {
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(new_uri);
+  }
+
   // File
   if (old_uri.is_file()) {
     if (new_uri.is_file()) {
@@ -1035,12 +1116,11 @@ Status VFS::copy_dir(const URI& old_uri, const URI& new_uri) {
   // Azure
   if (old_uri.is_azure()) {
     if (new_uri.is_azure()) {
-      if constexpr (azure_enabled) {
-        throw VFSException(
-            "Copying directories on Azure is not yet supported.");
-      } else {
-        throw BuiltWithout("Azure");
-      }
+#ifdef HAVE_AZURE
+      return azure_.copy_dir(old_uri, new_uri);
+#else
+      throw BuiltWithout("Azure");
+#endif
     }
     throw UnsupportedOperation("Copying directories");
   }
@@ -1048,11 +1128,11 @@ Status VFS::copy_dir(const URI& old_uri, const URI& new_uri) {
   // GCS
   if (old_uri.is_gcs()) {
     if (new_uri.is_gcs()) {
-      if constexpr (gcs_enabled) {
-        throw VFSException("Copying directories on GCS is not yet supported.");
-      } else {
-        throw BuiltWithout("GCS");
-      }
+#ifdef HAVE_GCS
+      return gcs_.copy_dir(old_uri, new_uri);
+#else
+      throw BuiltWithout("GCS");
+#endif
     }
     throw UnsupportedOperation("Copying directories");
   }
@@ -1066,7 +1146,12 @@ Status VFS::read(
     const uint64_t offset,
     void* const buffer,
     const uint64_t nbytes,
-    bool use_read_ahead) {
+    bool use_read_ahead,
+    const CancellationSource* cancellation) {
+  if (cancellation != nullptr && cancellation->is_cancelled()) {
+    return Status_VFSError("Read cancelled '" + uri.to_string() + "'");
+  }
+
   stats_->add_counter("read_byte_num", nbytes);
 
   // Get config params
@@ -1080,8 +1165,31 @@ Status VFS::read(
   uint64_t num_ops =
       std::min(std::max(nbytes / min_parallel_size, uint64_t(1)), max_ops);
 
+  // On object stores, additionally cap the fan-out by the bucket's
+  // concurrency budget. Splitting an oversized read is only useful while the
+  // bucket has idle capacity; once enough requests are in flight to saturate
+  // it, further splitting only multiplies the request count and cost.
+  std::optional<ReadConcurrencyBudget::Lease> budget_lease;
+  if (vfs_params_.max_concurrent_reads_ > 0 &&
+      (uri.is_s3() || uri.is_azure() || uri.is_gcs())) {
+    const auto& uri_str = uri.to_string();
+    auto scheme_end = uri_str.find("://");
+    auto bucket_end = uri_str.find('/', scheme_end + 3);
+
+    // The configured budget is a ceiling; the read clock scales it down
+    // while the backend is observed throttling or congested.
+    auto max_in_flight = std::max<uint64_t>(
+        static_cast<uint64_t>(
+            vfs_params_.max_concurrent_reads_ *
+            read_clock_.scale(uri_str.substr(0, scheme_end))),
+        1);
+    budget_lease.emplace(
+        read_budget_, uri_str.substr(0, bucket_end), num_ops, max_in_flight);
+    num_ops = budget_lease->ops();
+  }
+
   if (num_ops == 1) {
-    return read_impl(uri, offset, buffer, nbytes, use_read_ahead);
+    return read_impl(uri, offset, buffer, nbytes, use_read_ahead, cancellation);
   } else {
     // we don't want read-ahead when performing random access reads
     use_read_ahead = false;
@@ -1101,13 +1209,20 @@ Status VFS::read(
            thread_offset,
            thread_buffer,
            thread_nbytes,
-           use_read_ahead]() {
+           use_read_ahead,
+           cancellation]() {
+            // Queued parallel ops short-circuit once the query is cancelled.
+            if (cancellation != nullptr && cancellation->is_cancelled()) {
+              return Status_VFSError(
+                  "Read cancelled '" + uri.to_string() + "'");
+            }
             return read_impl(
                 uri,
                 thread_offset,
                 thread_buffer,
                 thread_nbytes,
-                use_read_ahead);
+                use_read_ahead,
+                cancellation);
           });
       results.push_back(std::move(task));
     }
@@ -1127,7 +1242,8 @@ Status VFS::read_impl(
     const uint64_t offset,
     void* const buffer,
     const uint64_t nbytes,
-    [[maybe_unused]] const bool use_read_ahead) {
+    [[maybe_unused]] const bool use_read_ahead,
+    [[maybe_unused]] const CancellationSource* cancellation) {
   stats_->add_counter("read_ops_num", 1);
   log_read(uri, offset, nbytes);
 
@@ -1151,17 +1267,27 @@ Status VFS::read_impl(
   }
   if (uri.is_s3()) {
 #ifdef HAVE_S3
-    const auto read_fn = std::bind(
-        &S3::read_impl,
-        &s3(),
-        std::placeholders::_1,
-        std::placeholders::_2,
-        std::placeholders::_3,
-        std::placeholders::_4,
-        std::placeholders::_5,
-        std::placeholders::_6);
-    return read_ahead_impl(
-        read_fn, uri, offset, buffer, nbytes, use_read_ahead);
+    // Bound as a lambda rather than std::bind so the cancellation source can
+    // be forwarded; the S3 backend aborts in-flight transfers through the
+    // SDK's continuation handler.
+    const auto read_fn = [this, cancellation](
+                             const URI& uri,
+                             off_t offset,
+                             void* buffer,
+                             uint64_t nbytes,
+                             uint64_t read_ahead_nbytes,
+                             uint64_t* nbytes_read) {
+      return s3().read_impl(
+          uri,
+          offset,
+          buffer,
+          nbytes,
+          read_ahead_nbytes,
+          nbytes_read,
+          cancellation);
+    };
+    return clocked_read(
+        read_fn, uri, offset, buffer, nbytes, use_read_ahead, "s3");
 #else
     throw BuiltWithout("S3");
 #endif
@@ -1177,8 +1303,8 @@ Status VFS::read_impl(
         std::placeholders::_4,
         std::placeholders::_5,
         std::placeholders::_6);
-    return read_ahead_impl(
-        read_fn, uri, offset, buffer, nbytes, use_read_ahead);
+    return clocked_read(
+        read_fn, uri, offset, buffer, nbytes, use_read_ahead, "azure");
 #else
     throw BuiltWithout("Azure");
 #endif
@@ -1194,13 +1320,14 @@ Status VFS::read_impl(
         std::placeholders::_4,
         std::placeholders::_5,
         std::placeholders::_6);
-    return read_ahead_impl(
-        read_fn, uri, offset, buffer, nbytes, use_read_ahead);
+    return clocked_read(
+        read_fn, uri, offset, buffer, nbytes, use_read_ahead, "gcs");
 #else
     throw BuiltWithout("GCS");
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_data_op(nbytes);
     return memfs_.read(uri.to_path(), offset, buffer, nbytes);
   }
 
@@ -1215,6 +1342,13 @@ Status VFS::read_ahead_impl(
     void* const buffer,
     const uint64_t nbytes,
     const bool use_read_ahead) {
+  // Serve remote reads from the on-disk block cache when configured. The
+  // cache fetches whole blocks through `read_fn` and persists them across
+  // process restarts, so it supersedes the in-memory read-ahead cache.
+  if (block_cache_ != nullptr) {
+    return block_cache_->read(read_fn, uri, offset, buffer, nbytes);
+  }
+
   // Stores the total number of bytes read.
   uint64_t nbytes_read = 0;
 
@@ -1269,6 +1403,38 @@ Status VFS::read_ahead_impl(
   return Status::Ok();
 }
 
+Status VFS::clocked_read(
+    const std::function<Status(
+        const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+    const URI& uri,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    const bool use_read_ahead,
+    const std::string& scheme) {
+  auto start = std::chrono::steady_clock::now();
+  auto st =
+      read_ahead_impl(read_fn, uri, offset, buffer, nbytes, use_read_ahead);
+  const double latency_ms =
+      std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  read_clock_.record(stats_, scheme, nbytes, latency_ms, st.ok());
+  return st;
+}
+
+void VFS::block_cache_pin(const URI& uri) {
+  if (block_cache_ != nullptr) {
+    block_cache_->pin(uri);
+  }
+}
+
+void VFS::block_cache_unpin(const URI& uri) {
+  if (block_cache_ != nullptr) {
+    block_cache_->unpin(uri);
+  }
+}
+
 bool VFS::supports_fs(Filesystem fs) const {
   return (supported_fs_.find(fs) != supported_fs_.end());
 }
@@ -1441,6 +1607,10 @@ Status VFS::write(
   stats_->add_counter("write_byte_num", buffer_size);
   stats_->add_counter("write_ops_num", 1);
 
+  if (ls_cache_ != nullptr) {
+    ls_cache_->invalidate(uri);
+  }
+
   if (uri.is_file()) {
 #ifdef _WIN32
     return win_.write(uri.to_path(), buffer, buffer_size);
@@ -1479,6 +1649,7 @@ Status VFS::write(
 #endif
   }
   if (uri.is_memfs()) {
+    fault_injector_.inject_data_op(buffer_size);
     return memfs_.write(uri.to_path(), buffer, buffer_size);
   }
   throw UnsupportedURI(uri.to_string());
@@ -35,8 +35,10 @@
 
 #include <functional>
 #include <list>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "filesystem_base.h"
@@ -48,8 +50,12 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/cache/lru_cache.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/filesystem/block_cache.h"
+#include "tiledb/sm/filesystem/fault_injector.h"
+#include "tiledb/sm/filesystem/ls_cache.h"
 #include "tiledb/sm/filesystem/mem_filesystem.h"
 #include "tiledb/sm/misc/cancelable_tasks.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/stats/stats.h"
 #include "uri.h"
 
@@ -170,6 +176,15 @@ struct VFSParameters {
   VFSParameters(const Config& config)
       : min_parallel_size_(
             config.get<uint64_t>("vfs.min_parallel_size").value())
+      , max_concurrent_reads_(
+            config.get<uint64_t>("vfs.max_concurrent_reads").value())
+      , block_cache_dir_(config.get<std::string>("vfs.block_cache.dir").value())
+      , block_cache_size_(config.get<uint64_t>("vfs.block_cache.size").value())
+      , block_cache_block_size_(
+            config.get<uint64_t>("vfs.block_cache.block_size").value())
+      , ls_cache_ttl_sec_(config.get<uint64_t>("vfs.ls_cache.ttl_sec").value())
+      , ls_cache_max_prefixes_(
+            config.get<uint64_t>("vfs.ls_cache.max_prefixes").value())
       , read_ahead_cache_size_(
             config.get<uint64_t>("vfs.read_ahead_cache_size").value())
       , read_ahead_size_(config.get<uint64_t>("vfs.read_ahead_size").value())
@@ -202,6 +217,33 @@ struct VFSParameters {
   /** The minimum number of bytes in a parallel operation. */
   uint64_t min_parallel_size_;
 
+  /**
+   * The maximum number of in-flight read operations per object-store bucket.
+   * Zero disables the budget.
+   */
+  uint64_t max_concurrent_reads_;
+
+  /**
+   * The local directory of the on-disk block cache. An empty value disables
+   * the cache.
+   */
+  std::string block_cache_dir_;
+
+  /** The byte budget of the on-disk block cache. */
+  uint64_t block_cache_size_;
+
+  /** The block size of the on-disk block cache. */
+  uint64_t block_cache_block_size_;
+
+  /**
+   * Seconds a cached prefix listing stays valid. A value of 0 disables
+   * the listing cache.
+   */
+  uint64_t ls_cache_ttl_sec_;
+
+  /** The maximum number of cached prefix listings. */
+  uint64_t ls_cache_max_prefixes_;
+
   /** The byte size of the read-ahead cache. */
   uint64_t read_ahead_cache_size_;
 
@@ -212,6 +254,214 @@ struct VFSParameters {
   ReadLoggingMode read_logging_mode_;
 };
 
+/**
+ * Tracks the number of in-flight read operations per object-store bucket so
+ * that the read splitter can size its fan-out against a concurrency budget.
+ * When a bucket is idle, an oversized read is split into parallel range
+ * requests to fill the budget; when many reads are already in flight, new
+ * reads are issued as single requests instead of multiplying the request
+ * count (and cost) without improving aggregate throughput.
+ */
+class ReadConcurrencyBudget {
+ public:
+  /**
+   * RAII lease holding the operations granted to a single read. The
+   * operations are returned to the bucket's budget on destruction.
+   */
+  class Lease {
+   public:
+    /**
+     * Constructor. Reserves up to `want` operations against the budget.
+     *
+     * @param budget The budget to reserve from.
+     * @param bucket The bucket the read targets.
+     * @param want The number of operations the splitter would like to issue.
+     * @param max_in_flight The bucket's concurrency budget.
+     */
+    Lease(
+        ReadConcurrencyBudget& budget,
+        const std::string& bucket,
+        uint64_t want,
+        uint64_t max_in_flight)
+        : budget_(budget)
+        , bucket_(bucket)
+        , ops_(budget.reserve(bucket, want, max_in_flight)) {
+    }
+
+    /** Destructor. Returns the granted operations to the budget. */
+    ~Lease() {
+      budget_.release(bucket_, ops_);
+    }
+
+    DISABLE_COPY_AND_COPY_ASSIGN(Lease);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(Lease);
+
+    /** @return The number of operations granted to this read. */
+    inline uint64_t ops() const {
+      return ops_;
+    }
+
+   private:
+    /** The budget the lease was reserved from. */
+    ReadConcurrencyBudget& budget_;
+
+    /** The bucket the read targets. */
+    const std::string bucket_;
+
+    /** The number of operations granted. */
+    const uint64_t ops_;
+  };
+
+ private:
+  /**
+   * Reserves up to `want` operations for a read against the given bucket.
+   * At least one operation is always granted so that a read can make
+   * progress even when the bucket is over its budget.
+   *
+   * @param bucket The bucket the read targets.
+   * @param want The number of operations the splitter would like to issue.
+   * @param max_in_flight The bucket's concurrency budget.
+   * @return The number of operations granted.
+   */
+  uint64_t reserve(
+      const std::string& bucket, uint64_t want, uint64_t max_in_flight) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& in_flight = in_flight_[bucket];
+    uint64_t available =
+        max_in_flight > in_flight ? max_in_flight - in_flight : 0;
+    uint64_t granted = std::max<uint64_t>(std::min(want, available), 1);
+    in_flight += granted;
+    return granted;
+  }
+
+  /**
+   * Returns granted operations to the bucket's budget.
+   *
+   * @param bucket The bucket the read targeted.
+   * @param ops The number of operations to return.
+   */
+  void release(const std::string& bucket, uint64_t ops) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = in_flight_.find(bucket);
+    it->second -= ops;
+    if (it->second == 0) {
+      in_flight_.erase(it);
+    }
+  }
+
+  /** Protects `in_flight_`. */
+  std::mutex mtx_;
+
+  /** The number of in-flight read operations per bucket. */
+  std::unordered_map<std::string, uint64_t> in_flight_;
+};
+
+/**
+ * Measures per-backend read latency and bandwidth, records them as stats
+ * counters, and derives an adaptive scale for the read concurrency budget.
+ * The static configuration only states a ceiling; the clock closes the
+ * feedback loop by shrinking the effective budget when a backend throttles
+ * or congests (failed reads, latency far above the backend's observed
+ * baseline) and restoring it gradually while reads stay healthy.
+ */
+class ReadClock {
+ public:
+  /**
+   * Records a completed backend read.
+   *
+   * Counters recorded per backend scheme: the number of reads, the bytes
+   * moved, the total latency in milliseconds and a latency histogram as
+   * `<scheme>_read_latency_ms_le_<bucket>` bucket counters.
+   *
+   * @param stats The stats instance to record counters into.
+   * @param scheme The backend scheme, e.g. "s3".
+   * @param nbytes The number of bytes read.
+   * @param latency_ms The observed latency of the read in milliseconds.
+   * @param ok Whether the read succeeded.
+   */
+  void record(
+      stats::Stats* const stats,
+      const std::string& scheme,
+      const uint64_t nbytes,
+      const double latency_ms,
+      const bool ok) {
+    stats->add_counter(scheme + "_read_ops_num", 1);
+    stats->add_counter(scheme + "_read_byte_num", nbytes);
+    stats->add_counter(
+        scheme + "_read_latency_ms", static_cast<uint64_t>(latency_ms));
+    uint64_t bucket = 1;
+    while (bucket < latency_ms && bucket < 65536) {
+      bucket *= 4;
+    }
+    stats->add_counter(
+        scheme + "_read_latency_ms_le_" + std::to_string(bucket), 1);
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& backend = backends_[scheme];
+
+    // A failed read is treated as throttling, e.g. an S3 503 slow-down;
+    // halve the effective budget and start over on the healthy streak.
+    if (!ok) {
+      backend.scale_ = std::max(backend.scale_ / 2, min_scale);
+      backend.healthy_reads_ = 0;
+      return;
+    }
+
+    // Track a smoothed latency and the best baseline observed so far.
+    if (backend.ewma_ms_ == 0) {
+      backend.ewma_ms_ = latency_ms;
+    } else {
+      backend.ewma_ms_ = 0.8 * backend.ewma_ms_ + 0.2 * latency_ms;
+    }
+    if (backend.baseline_ms_ == 0 || backend.ewma_ms_ < backend.baseline_ms_) {
+      backend.baseline_ms_ = backend.ewma_ms_;
+    }
+
+    // Latency far above the baseline signals congestion; back off. While
+    // reads stay healthy, restore the budget one doubling at a time.
+    if (backend.ewma_ms_ > 4 * backend.baseline_ms_ &&
+        backend.scale_ > min_scale) {
+      backend.scale_ = std::max(backend.scale_ / 2, min_scale);
+      backend.healthy_reads_ = 0;
+    } else if (++backend.healthy_reads_ >= 64 && backend.scale_ < 1.0) {
+      backend.scale_ = std::min(backend.scale_ * 2, 1.0);
+      backend.healthy_reads_ = 0;
+    }
+  }
+
+  /** Returns the backend's budget scale, in [1/8, 1]. */
+  double scale(const std::string& scheme) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = backends_.find(scheme);
+    return it == backends_.end() ? 1.0 : it->second.scale_;
+  }
+
+ private:
+  /** The smallest fraction the budget can be scaled down to. */
+  static constexpr double min_scale = 0.125;
+
+  /** The adaptive state of one backend. */
+  struct BackendState {
+    /** The smoothed read latency in milliseconds. */
+    double ewma_ms_ = 0;
+
+    /** The best smoothed latency observed, as the congestion baseline. */
+    double baseline_ms_ = 0;
+
+    /** The number of healthy reads since the last back-off. */
+    uint64_t healthy_reads_ = 0;
+
+    /** The current budget scale. */
+    double scale_ = 1.0;
+  };
+
+  /** Protects `backends_`. */
+  std::mutex mtx_;
+
+  /** The adaptive state per backend scheme. */
+  std::unordered_map<std::string, BackendState> backends_;
+};
+
 /** The base parameters for class VFS. */
 struct VFSBase {
   VFSBase() = delete;
@@ -515,6 +765,10 @@ class VFS : private VFSBase, protected S3_within_VFS {
    *
    * Currently this API is only supported for local files, S3 and Azure.
    *
+   * When the listing cache is enabled (`vfs.ls_cache.ttl_sec` > 0),
+   * repeated scans of the same prefix within the TTL are served from the
+   * cache and the FilePredicate runs over the cached entries.
+   *
    * @param parent The parent prefix to list sub-paths.
    * @param f The FilePredicate to invoke on each object for filtering.
    * @param d The DirectoryPredicate to invoke on each common prefix for
@@ -529,6 +783,46 @@ class VFS : private VFSBase, protected S3_within_VFS {
       [[maybe_unused]] F f,
       [[maybe_unused]] D d,
       bool recursive) const {
+    if (ls_cache_ == nullptr) {
+      return ls_filtered_impl(parent, f, d, recursive);
+    }
+
+    // Serve repeated scans of the same prefix from the listing cache. The
+    // raw listing of the prefix is cached unfiltered so that callers with
+    // different predicates share it, and the file predicate runs over the
+    // cached entries instead.
+    const std::string key =
+        (recursive ? "r:" : "f:") + parent.to_string();
+    auto raw = ls_cache_->lookup(key);
+    if (!raw.has_value()) {
+      raw = ls_filtered_impl(parent, accept_all_files, d, recursive);
+      ls_cache_->insert(key, *raw);
+    }
+
+    LsObjects results;
+    try {
+      for (auto& object : *raw) {
+        if (f(object.first, object.second)) {
+          results.emplace_back(std::move(object));
+        }
+      }
+    } catch (LsStopTraversal& e) {
+      // Do nothing, callback signaled to stop traversal.
+    }
+    return results;
+  }
+
+ private:
+  /**
+   * Dispatches a (possibly recursive) filtered listing to the backend of
+   * the parent URI. The cache-aware `ls_filtered` wraps this routine.
+   */
+  template <FilePredicate F, DirectoryPredicate D = DirectoryFilter>
+  LsObjects ls_filtered_impl(
+      const URI& parent,
+      [[maybe_unused]] F f,
+      [[maybe_unused]] D d,
+      bool recursive) const {
     LsObjects results;
     try {
       if (parent.is_file()) {
@@ -578,6 +872,7 @@ class VFS : private VFSBase, protected S3_within_VFS {
     return results;
   }
 
+ public:
   /**
    * Recursively lists objects and object information that start with `prefix`,
    * invoking the FilePredicate on each entry collected and the
@@ -644,6 +939,9 @@ class VFS : private VFSBase, protected S3_within_VFS {
    * @param buffer The buffer to read into.
    * @param nbytes Number of bytes to read.
    * @param use_read_ahead Whether to use the read-ahead cache.
+   * @param cancellation Optional cancellation source. Queued parallel ops
+   * are abandoned once it fires and, where the backend SDK supports it,
+   * in-flight transfers are aborted.
    * @return Status
    */
   Status read(
@@ -651,7 +949,8 @@ class VFS : private VFSBase, protected S3_within_VFS {
       uint64_t offset,
       void* buffer,
       uint64_t nbytes,
-      bool use_read_ahead = true);
+      bool use_read_ahead = true,
+      const CancellationSource* cancellation = nullptr);
 
   /** Checks if a given filesystem is supported. */
   bool supports_fs(Filesystem fs) const;
@@ -755,6 +1054,24 @@ class VFS : private VFSBase, protected S3_within_VFS {
     return stats_;
   }
 
+  /**
+   * Pins all present and future blocks of URIs starting with `uri` in the
+   * on-disk block cache, excluding them from eviction. Pinning a fragment
+   * URI keeps the whole fragment resident. No-op when the cache is not
+   * configured.
+   *
+   * @param uri The URI prefix to pin.
+   */
+  void block_cache_pin(const URI& uri);
+
+  /**
+   * Unpins a URI prefix previously passed to `block_cache_pin`. No-op when
+   * the cache is not configured.
+   *
+   * @param uri The URI prefix to unpin.
+   */
+  void block_cache_unpin(const URI& uri);
+
  private:
   /* ********************************* */
   /*        PRIVATE DATATYPES          */
@@ -939,6 +1256,13 @@ class VFS : private VFSBase, protected S3_within_VFS {
   /** The in-memory filesystem which is always supported */
   MemFilesystem memfs_;
 
+  /**
+   * Injects object-store behavior into in-memory filesystem operations.
+   * Mutable because drawing from the injection schedule advances its
+   * generator, while most filesystem operations are const.
+   */
+  mutable FaultInjector fault_injector_;
+
   /**
    * Config.
    *
@@ -963,6 +1287,18 @@ class VFS : private VFSBase, protected S3_within_VFS {
   /** The read-ahead cache. */
   tdb_unique_ptr<ReadAheadCache> read_ahead_cache_;
 
+  /** The on-disk block cache. Constructed only when configured. */
+  tdb_unique_ptr<BlockCache> block_cache_;
+
+  /** The prefix listing cache. Constructed only when configured. */
+  tdb_unique_ptr<LsCache> ls_cache_;
+
+  /** The per-bucket concurrency budget for object-store reads. */
+  ReadConcurrencyBudget read_budget_;
+
+  /** The per-backend read telemetry and budget controller. */
+  ReadClock read_clock_;
+
   /** The VFS configuration parameters. */
   VFSParameters vfs_params_;
 
@@ -981,6 +1317,8 @@ class VFS : private VFSBase, protected S3_within_VFS {
    * @param buffer The buffer to read into.
    * @param nbytes Number of bytes to read.
    * @param use_read_ahead Whether to use the read-ahead cache.
+   * @param cancellation Optional cancellation source forwarded to backends
+   * that can abort in-flight transfers.
    * @return Status
    */
   Status read_impl(
@@ -988,7 +1326,8 @@ class VFS : private VFSBase, protected S3_within_VFS {
       uint64_t offset,
       void* buffer,
       uint64_t nbytes,
-      bool use_read_ahead);
+      bool use_read_ahead,
+      const CancellationSource* cancellation);
 
   /**
    * Executes a read, using the read-ahead cache as necessary.
@@ -1010,6 +1349,29 @@ class VFS : private VFSBase, protected S3_within_VFS {
       const uint64_t nbytes,
       const bool use_read_ahead);
 
+  /**
+   * Executes a remote-backend read through `read_ahead_impl`, timing it
+   * and feeding the outcome into the read clock.
+   *
+   * @param read_fn The read routine to execute.
+   * @param uri The URI of the file.
+   * @param offset The offset where the read begins.
+   * @param buffer The buffer to read into.
+   * @param nbytes Number of bytes to read.
+   * @param use_read_ahead Whether to use the read-ahead cache.
+   * @param scheme The backend scheme, e.g. "s3".
+   * @return Status
+   */
+  Status clocked_read(
+      const std::function<Status(
+          const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+      const URI& uri,
+      const uint64_t offset,
+      void* const buffer,
+      const uint64_t nbytes,
+      const bool use_read_ahead,
+      const std::string& scheme);
+
   /**
    * Retrieves the backend-specific max number of parallel operations for VFS
    * read.
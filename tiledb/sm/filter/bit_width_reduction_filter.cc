@@ -80,6 +80,37 @@ static inline uint8_t bits_required(T value) {
   return bits_required(value, std::is_signed<T>());
 }
 
+/**
+ * Subtract the window minimum from each element of a window and narrow the
+ * result to type W, in a single vectorizable sweep. `packed` must have room
+ * for `window_nelts * sizeof(W)` bytes.
+ */
+template <typename W, typename T>
+static inline void pack_window(
+    const T* window_data,
+    uint32_t window_nelts,
+    T window_value_offset,
+    void* packed) {
+  auto packed_data = static_cast<W*>(packed);
+  for (uint32_t j = 0; j < window_nelts; j++)
+    packed_data[j] = static_cast<W>(window_data[j] - window_value_offset);
+}
+
+/**
+ * Widen each type W element of a packed window back to type T and add the
+ * window minimum, in a single vectorizable sweep.
+ */
+template <typename W, typename T>
+static inline void unpack_window(
+    const void* packed,
+    uint32_t window_nelts,
+    T window_value_offset,
+    T* window_data) {
+  auto packed_data = static_cast<const W*>(packed);
+  for (uint32_t j = 0; j < window_nelts; j++)
+    window_data[j] = static_cast<T>(packed_data[j]) + window_value_offset;
+}
+
 BitWidthReductionFilter::BitWidthReductionFilter(Datatype filter_data_type)
     : Filter(FilterType::FILTER_BIT_WIDTH_REDUCTION, filter_data_type) {
   max_window_size_ = 256;
@@ -239,6 +270,9 @@ Status BitWidthReductionFilter::compress_part(
   uint32_t num_windows =
       input_bytes / window_size + uint32_t(bool(input_bytes % window_size));
 
+  // Scratch space for compressing one window at a time.
+  std::vector<char> packed(window_size);
+
   // Write each window.
   for (uint32_t i = 0; i < num_windows; i++) {
     // Compute the actual size in bytes of the window (may be smaller at the end
@@ -262,15 +296,39 @@ Status BitWidthReductionFilter::compress_part(
           output->write((char*)input->data() + input->offset(), window_nbytes));
       input->advance_offset(window_nbytes);
     } else {
-      // Compress and write the relative values to output.
-      for (uint32_t j = 0; j < window_nelts; j++) {
-        T relative_value = input->value<T>() - window_value_offset;
-
-        RETURN_NOT_OK(
-            write_compressed_value(output, relative_value, compressed_bits));
-
-        input->advance_offset(sizeof(T));
+      // Compress the relative values into scratch with a single narrowing
+      // sweep, then write the packed window to the output with one call.
+      // This keeps the hot loop free of per-element FilterBuffer writes so
+      // it can vectorize.
+      auto window_data = static_cast<const T*>(input->cur_data());
+      uint32_t packed_nbytes = window_nelts * (compressed_bits / 8);
+      switch (compressed_bits) {
+        case 8: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int8_t, uint8_t>::type;
+          pack_window<W>(
+              window_data, window_nelts, window_value_offset, packed.data());
+          break;
+        }
+        case 16: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int16_t, uint16_t>::type;
+          pack_window<W>(
+              window_data, window_nelts, window_value_offset, packed.data());
+          break;
+        }
+        case 32: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int32_t, uint32_t>::type;
+          pack_window<W>(
+              window_data, window_nelts, window_value_offset, packed.data());
+          break;
+        }
+        default:
+          assert(false);
       }
+      RETURN_NOT_OK(output->write(packed.data(), packed_nbytes));
+      input->advance_offset(window_nbytes);
     }
   }
 
@@ -363,8 +421,15 @@ Status BitWidthReductionFilter::run_reverse(
   RETURN_NOT_OK(input_metadata->read(&num_windows, sizeof(uint32_t)));
 
   RETURN_NOT_OK(output->prepend_buffer(orig_length));
+  Buffer* buffer_ptr = output->buffer_ptr(0);
+  buffer_ptr->reset_offset();
+  buffer_ptr->set_size(orig_length);
   output->reset_offset();
 
+  // Scratch space for decompressing one window at a time.
+  std::vector<char> packed;
+  uint64_t out_nbytes = 0;
+
   // Read each window
   for (uint32_t i = 0; i < num_windows; i++) {
     uint32_t window_nbytes;
@@ -375,21 +440,52 @@ Status BitWidthReductionFilter::run_reverse(
     RETURN_NOT_OK(input_metadata->read(&compressed_bits, sizeof(uint8_t)));
     RETURN_NOT_OK(input_metadata->read(&window_nbytes, sizeof(uint32_t)));
 
+    if (window_nbytes > orig_length - out_nbytes)
+      return LOG_STATUS(Status_FilterError(
+          "Bit width reduction filter error; window exceeds output size."));
+    auto window_data = reinterpret_cast<T*>(buffer_ptr->data(out_nbytes));
+
     if (compressed_bits >= orig_bits || window_nbytes % sizeof(T) != 0) {
       // Window was not compressed.
-      RETURN_NOT_OK(output->write(input, window_nbytes));
-      input->advance_offset(window_nbytes);
+      RETURN_NOT_OK(input->read(window_data, window_nbytes));
     } else {
-      // Read and uncompress each window value.
+      // Read the packed window with a single call and uncompress it into
+      // the output buffer with one widening sweep. This keeps the hot loop
+      // free of per-element FilterBuffer reads and writes so it can
+      // vectorize.
       uint32_t window_nelts = window_nbytes / sizeof(T);
-      for (uint32_t j = 0; j < window_nelts; j++) {
-        T input_value = 0;
-        RETURN_NOT_OK(
-            read_compressed_value(input, compressed_bits, &input_value));
-        input_value += window_value_offset;
-        RETURN_NOT_OK(output->write(&input_value, data_type_size));
+      uint32_t packed_nbytes = window_nelts * (compressed_bits / 8);
+      if (packed.size() < packed_nbytes)
+        packed.resize(packed_nbytes);
+      RETURN_NOT_OK(input->read(packed.data(), packed_nbytes));
+      switch (compressed_bits) {
+        case 8: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int8_t, uint8_t>::type;
+          unpack_window<W>(
+              packed.data(), window_nelts, window_value_offset, window_data);
+          break;
+        }
+        case 16: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int16_t, uint16_t>::type;
+          unpack_window<W>(
+              packed.data(), window_nelts, window_value_offset, window_data);
+          break;
+        }
+        case 32: {
+          using W = typename std::
+              conditional<std::is_signed<T>::value, int32_t, uint32_t>::type;
+          unpack_window<W>(
+              packed.data(), window_nelts, window_value_offset, window_data);
+          break;
+        }
+        default:
+          assert(false);
       }
     }
+
+    out_nbytes += window_nbytes;
   }
 
   // Output metadata is a view on the input metadata, skipping what was used by
@@ -407,14 +503,12 @@ uint8_t BitWidthReductionFilter::compute_bits_required(
   // Compute the min and max element values within the window.
   T window_min = std::numeric_limits<T>::max(),
     window_max = std::numeric_limits<T>::lowest();
-  auto orig_offset = buffer->offset();
+  auto window_data = static_cast<const T*>(buffer->cur_data());
   for (uint32_t j = 0; j < num_elements; j++) {
-    T input_value = buffer->value<T>();
+    T input_value = window_data[j];
     window_min = std::min(window_min, input_value);
     window_max = std::max(window_max, input_value);
-    buffer->advance_offset(sizeof(T));
   }
-  buffer->set_offset(orig_offset);
 
   // Check for overflow
   T range = window_max - window_min;
@@ -438,87 +532,6 @@ uint8_t BitWidthReductionFilter::compute_bits_required(
   return bits;
 }
 
-template <typename T>
-Status BitWidthReductionFilter::write_compressed_value(
-    FilterBuffer* buffer, T value, uint8_t num_bits) const {
-  switch (num_bits) {
-    case 8: {
-      auto val = static_cast<
-          typename std::conditional<std::is_signed<T>::value, int8_t, uint8_t>::
-              type>(value);
-      RETURN_NOT_OK(buffer->write(&val, sizeof(val)));
-      break;
-    }
-    case 16: {
-      auto val = static_cast<
-          typename std::
-              conditional<std::is_signed<T>::value, int16_t, uint16_t>::type>(
-          value);
-      RETURN_NOT_OK(buffer->write(&val, sizeof(val)));
-      break;
-    }
-    case 32: {
-      auto val = static_cast<
-          typename std::
-              conditional<std::is_signed<T>::value, int32_t, uint32_t>::type>(
-          value);
-      RETURN_NOT_OK(buffer->write(&val, sizeof(val)));
-      break;
-    }
-    case 64: {
-      auto val = static_cast<
-          typename std::
-              conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>(
-          value);
-      RETURN_NOT_OK(buffer->write(&val, sizeof(val)));
-      break;
-    }
-    default:
-      assert(false);
-  }
-
-  return Status::Ok();
-}
-
-template <typename T>
-Status BitWidthReductionFilter::read_compressed_value(
-    FilterBuffer* buffer, uint8_t compressed_bits, T* value) const {
-  switch (compressed_bits) {
-    case 8: {
-      typename std::conditional<std::is_signed<T>::value, int8_t, uint8_t>::type
-          val;
-      RETURN_NOT_OK(buffer->read(&val, sizeof(val)));
-      *value = val;
-      break;
-    }
-    case 16: {
-      typename std::conditional<std::is_signed<T>::value, int16_t, uint16_t>::
-          type val;
-      RETURN_NOT_OK(buffer->read(&val, sizeof(val)));
-      *value = val;
-      break;
-    }
-    case 32: {
-      typename std::conditional<std::is_signed<T>::value, int32_t, uint32_t>::
-          type val;
-      RETURN_NOT_OK(buffer->read(&val, sizeof(val)));
-      *value = val;
-      break;
-    }
-    case 64: {
-      typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::
-          type val;
-      RETURN_NOT_OK(buffer->read(&val, sizeof(val)));
-      *value = val;
-      break;
-    }
-    default:
-      assert(false);
-  }
-
-  return Status::Ok();
-}
-
 Status BitWidthReductionFilter::set_option_impl(
     FilterOption option, const void* value) {
   if (value == nullptr)
@@ -177,20 +177,6 @@ class BitWidthReductionFilter : public Filter {
   /** Gets an option from this filter. */
   Status get_option_impl(FilterOption option, void* value) const override;
 
-  /**
-   * Reads a compressed value of type T from the given buffer after
-   * decompressing from a value of the given bit width.
-   *
-   * @tparam T Tile cell datatype
-   * @param buffer Buffer to read from
-   * @param compressed_bits Bit width of compressed value to read
-   * @param value Will be set to the decompressed value
-   * @return Status
-   */
-  template <typename T>
-  Status read_compressed_value(
-      FilterBuffer* buffer, uint8_t compressed_bits, T* value) const;
-
   /** Run_forward method templated on the tile cell datatype. */
   template <typename T>
   void run_forward(
@@ -216,19 +202,6 @@ class BitWidthReductionFilter : public Filter {
 
   /** Serializes this filter's metadata to the given buffer. */
   void serialize_impl(Serializer& serializer) const override;
-
-  /**
-   * Writes the given value of type T to the given buffer after compressing
-   * (casting) to a value of the given bit width.
-   *
-   * @param buffer Buffer to write to
-   * @param value Uncompressed value to write
-   * @param num_bits Bit width of compressed value to write
-   * @return Status
-   */
-  template <typename T>
-  Status write_compressed_value(
-      FilterBuffer* buffer, T value, uint8_t num_bits) const;
 };
 
 }  // namespace sm
@@ -0,0 +1,384 @@
+/**
+ * @file   checksum_crc32c_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ChecksumCRC32CFilter.
+ */
+
+#include "tiledb/sm/filter/checksum_crc32c_filter.h"
+#include "tiledb/common/heap_memory.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <array>
+#include <cstring>
+#include <sstream>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC32C_HW_X86
+#include <nmmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+/*
+ * The SSE4.2 CRC kernel is compiled with a per-function target attribute so
+ * portable builds still contain it; it is selected at runtime when the host
+ * CPU supports it.
+ */
+#define CRC32C_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define CRC32C_TARGET_SSE42
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC32C_HW_ARM
+#include <arm_acle.h>
+#if !defined(__ARM_FEATURE_CRC32)
+#define CRC32C_TARGET_CRC __attribute__((target("+crc")))
+#else
+#define CRC32C_TARGET_CRC
+#endif
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*         CRC32C KERNELS         */
+/* ****************************** */
+
+/** The CRC32C (Castagnoli) polynomial, reflected. */
+static constexpr uint32_t crc32c_polynomial = 0x82f63b78u;
+
+/** Portable table-driven CRC32C used when no CRC instructions exist. */
+static uint32_t crc32c_update_sw(
+    uint32_t crc, const uint8_t* data, uint64_t nbytes) {
+  static const auto table = []() {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++)
+        c = (c & 1) ? (c >> 1) ^ crc32c_polynomial : (c >> 1);
+      t[i] = c;
+    }
+    return t;
+  }();
+
+  for (uint64_t i = 0; i < nbytes; i++)
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  return crc;
+}
+
+#ifdef CRC32C_HW_X86
+
+/** CRC32C using the SSE4.2 CRC instructions, 8 bytes at a time. */
+CRC32C_TARGET_SSE42
+static uint32_t crc32c_update_hw(
+    uint32_t crc, const uint8_t* data, uint64_t nbytes) {
+  uint64_t crc64 = crc;
+  while (nbytes >= sizeof(uint64_t)) {
+    uint64_t chunk;
+    std::memcpy(&chunk, data, sizeof(uint64_t));
+    crc64 = _mm_crc32_u64(crc64, chunk);
+    data += sizeof(uint64_t);
+    nbytes -= sizeof(uint64_t);
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (nbytes-- > 0)
+    crc = _mm_crc32_u8(crc, *data++);
+  return crc;
+}
+
+/** Returns true if the host CPU supports the SSE4.2 CRC instructions. */
+static bool crc32c_hw_supported() {
+#if defined(__GNUC__) || defined(__clang__)
+  static const bool supported = __builtin_cpu_supports("sse4.2") != 0;
+#else
+  static const bool supported = []() {
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+  }();
+#endif
+  return supported;
+}
+
+#elif defined(CRC32C_HW_ARM)
+
+/** CRC32C using the ARMv8 CRC instructions, 8 bytes at a time. */
+CRC32C_TARGET_CRC
+static uint32_t crc32c_update_hw(
+    uint32_t crc, const uint8_t* data, uint64_t nbytes) {
+  while (nbytes >= sizeof(uint64_t)) {
+    uint64_t chunk;
+    std::memcpy(&chunk, data, sizeof(uint64_t));
+    crc = __crc32cd(crc, chunk);
+    data += sizeof(uint64_t);
+    nbytes -= sizeof(uint64_t);
+  }
+  while (nbytes-- > 0)
+    crc = __crc32cb(crc, *data++);
+  return crc;
+}
+
+/** Returns true if the host CPU supports the ARMv8 CRC instructions. */
+static bool crc32c_hw_supported() {
+#if defined(__ARM_FEATURE_CRC32)
+  return true;
+#elif defined(__linux__)
+  static const bool supported = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+  return supported;
+#elif defined(__APPLE__)
+  // All Apple arm64 CPUs implement the CRC32 extension.
+  return true;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+/** Computes the CRC32C checksum of the given bytes. */
+static uint32_t crc32c(const void* data, uint64_t nbytes) {
+  uint32_t crc = 0xffffffffu;
+  auto bytes = static_cast<const uint8_t*>(data);
+#if defined(CRC32C_HW_X86) || defined(CRC32C_HW_ARM)
+  if (crc32c_hw_supported())
+    crc = crc32c_update_hw(crc, bytes, nbytes);
+  else
+    crc = crc32c_update_sw(crc, bytes, nbytes);
+#else
+  crc = crc32c_update_sw(crc, bytes, nbytes);
+#endif
+  return crc ^ 0xffffffffu;
+}
+
+/* ****************************** */
+/*             FILTER             */
+/* ****************************** */
+
+ChecksumCRC32CFilter::ChecksumCRC32CFilter(Datatype filter_data_type)
+    : Filter(FilterType::FILTER_CHECKSUM_CRC32C, filter_data_type) {
+}
+
+ChecksumCRC32CFilter* ChecksumCRC32CFilter::clone_impl() const {
+  return tdb_new(ChecksumCRC32CFilter, filter_data_type_);
+}
+
+std::ostream& ChecksumCRC32CFilter::output(std::ostream& os) const {
+  os << "ChecksumCRC32C";
+  return os;
+}
+
+void ChecksumCRC32CFilter::run_forward(
+    const WriterTile&,
+    WriterTile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  // Set output buffer to input buffer
+  throw_if_not_ok(output->append_view(input));
+  // Add original input metadata as a view to the output metadata
+  throw_if_not_ok(output_metadata->append_view(input_metadata));
+
+  // Compute and write the metadata
+  std::vector<ConstBuffer> data_parts = input->buffers(),
+                           metadata_parts = input_metadata->buffers();
+  auto num_data_parts = (uint32_t)data_parts.size();
+  auto num_metadata_parts = (uint32_t)metadata_parts.size();
+  auto total_num_parts = num_data_parts + num_metadata_parts;
+
+  uint32_t part_md_size = digest_bytes + sizeof(uint64_t);
+  uint32_t metadata_size =
+      (total_num_parts * part_md_size) + (2 * sizeof(uint32_t));
+  throw_if_not_ok(output_metadata->prepend_buffer(metadata_size));
+  throw_if_not_ok(
+      output_metadata->write(&num_metadata_parts, sizeof(uint32_t)));
+  throw_if_not_ok(output_metadata->write(&num_data_parts, sizeof(uint32_t)));
+
+  // Checksum all parts
+  for (auto& part : metadata_parts)
+    throw_if_not_ok(checksum_part(&part, output_metadata));
+  for (auto& part : data_parts)
+    throw_if_not_ok(checksum_part(&part, output_metadata));
+}
+
+Status ChecksumCRC32CFilter::run_reverse(
+    const Tile&,
+    Tile*,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output,
+    const Config& config) const {
+  // Fetch the skip checksum configuration parameter.
+  bool found;
+  bool skip_validation;
+  RETURN_NOT_OK(config.get<bool>(
+      "sm.skip_checksum_validation", &skip_validation, &found));
+  assert(found);
+
+  // Set output buffer to input buffer
+  RETURN_NOT_OK(output->append_view(input));
+
+  // Read the number of parts from input metadata.
+  uint32_t num_metadata_parts, num_data_parts;
+  RETURN_NOT_OK(input_metadata->read(&num_metadata_parts, sizeof(uint32_t)));
+  RETURN_NOT_OK(input_metadata->read(&num_data_parts, sizeof(uint32_t)));
+
+  // Build pairs of checksummed sizes to checksums
+  std::vector<std::pair<uint64_t, uint32_t>> metadata_checksums(
+      num_metadata_parts);
+  std::vector<std::pair<uint64_t, uint32_t>> data_checksums(num_data_parts);
+
+  // First loop through the metadata to pull out the checksums
+  for (uint32_t i = 0; i < num_metadata_parts; i++) {
+    uint64_t metadata_checksummed_bytes;
+    RETURN_NOT_OK(
+        input_metadata->read(&metadata_checksummed_bytes, sizeof(uint64_t)));
+
+    // Only fetch and store checksum if we are not going to skip it
+    if (!skip_validation) {
+      uint32_t checksum;
+      RETURN_NOT_OK(input_metadata->read(&checksum, digest_bytes));
+      metadata_checksums[i] =
+          std::make_pair(metadata_checksummed_bytes, checksum);
+    } else {
+      input_metadata->advance_offset(digest_bytes);
+    }
+  }
+
+  for (uint32_t i = 0; i < num_data_parts; i++) {
+    uint64_t data_checksummed_bytes;
+    RETURN_NOT_OK(
+        input_metadata->read(&data_checksummed_bytes, sizeof(uint64_t)));
+
+    // Only fetch and store checksum if we are not going to skip it
+    if (!skip_validation) {
+      uint32_t checksum;
+      RETURN_NOT_OK(input_metadata->read(&checksum, digest_bytes));
+      data_checksums[i] = std::make_pair(data_checksummed_bytes, checksum);
+    } else {
+      input_metadata->advance_offset(digest_bytes);
+    }
+  }
+
+  // Only run checksums if we are not set to skip
+  if (!skip_validation) {
+    // Now that the checksums are fetched we an run the actual comparisons
+    // against the real metadata and data Need to save the metadata offset
+    // before we loop through to check it
+    uint64_t offset_before_checksum = input_metadata->offset();
+    for (uint32_t i = 0; i < num_metadata_parts; i++) {
+      auto& checksum_details = metadata_checksums[i];
+      RETURN_NOT_OK(compare_checksum_part(
+          input_metadata, checksum_details.first, checksum_details.second));
+    }
+    // Reset input metadata back to offset only if there was metadata that we
+    // read We check this to avoid the edge case where there was not metadata to
+    // check and the offset is actually at the end buffer
+    if (input_metadata->offset() != offset_before_checksum) {
+      input_metadata->set_offset(offset_before_checksum);
+    }
+
+    for (uint32_t i = 0; i < num_data_parts; i++) {
+      auto& checksum_details = data_checksums[i];
+      RETURN_NOT_OK(compare_checksum_part(
+          input, checksum_details.first, checksum_details.second));
+    }
+  }
+
+  // Output metadata is a view on the input metadata, skipping what was used
+  // by this filter.
+  auto md_offset = input_metadata->offset();
+  RETURN_NOT_OK(output_metadata->append_view(
+      input_metadata, md_offset, input_metadata->size() - md_offset));
+
+  return Status::Ok();
+}
+
+Status ChecksumCRC32CFilter::checksum_part(
+    ConstBuffer* part, FilterBuffer* output_metadata) const {
+  uint32_t checksum = crc32c(part->data(), part->size());
+
+  // Write metadata.
+  uint64_t part_size = part->size();
+  RETURN_NOT_OK(output_metadata->write(&part_size, sizeof(uint64_t)));
+  RETURN_NOT_OK(output_metadata->write(&checksum, digest_bytes));
+
+  return Status::Ok();
+}
+
+Status ChecksumCRC32CFilter::compare_checksum_part(
+    FilterBuffer* part, uint64_t bytes_to_compare, uint32_t checksum) const {
+  tdb_unique_ptr<Buffer> byte_buffer_to_compare =
+      tdb_unique_ptr<Buffer>(tdb_new(Buffer));
+  tdb_unique_ptr<ConstBuffer> buffer_to_compare = tdb_unique_ptr<ConstBuffer>(
+      tdb_new(ConstBuffer, byte_buffer_to_compare.get()));
+
+  // First we try to get a view on the bytes we need without copying
+  // This might fail if the bytes we need to compare are contained in multiple
+  // underlying buffers
+  if (!part->get_const_buffer(bytes_to_compare, buffer_to_compare.get()).ok()) {
+    // If the bytes we need to compare span multiple buffers we will have to
+    // copy them out
+    throw_if_not_ok(byte_buffer_to_compare->realloc(bytes_to_compare));
+    RETURN_NOT_OK(part->read(byte_buffer_to_compare->data(), bytes_to_compare));
+    // Set the buffer back
+    buffer_to_compare = tdb_unique_ptr<ConstBuffer>(
+        tdb_new(ConstBuffer, byte_buffer_to_compare.get()));
+  } else {
+    // Move offset location if we used a view so next checksum will read
+    // subsequent bytes
+    part->advance_offset(bytes_to_compare);
+  }
+
+  uint32_t computed_checksum =
+      crc32c(buffer_to_compare->data(), bytes_to_compare);
+
+  if (computed_checksum != checksum) {
+    std::stringstream message;
+    message << "Checksum mismatch for crc32c filter, expect ";
+    message << std::hex << checksum;
+    message << " got ";
+    message << std::hex << computed_checksum;
+    return Status_ChecksumError(message.str());
+  }
+
+  return Status::Ok();
+}
+
+}  // namespace sm
+}  // namespace tiledb
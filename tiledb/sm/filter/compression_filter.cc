@@ -61,6 +61,67 @@ class CompressionFilterStatusException : public StatusException {
   }
 };
 
+namespace {
+
+/**
+ * Process-wide cache of dictionary decode tables. Low-cardinality string
+ * attributes persist a byte-identical dictionary with every tile, so the
+ * decode table only needs to be deserialized once and can then be shared by
+ * all tiles and queries that carry the same bytes. The cache is dropped
+ * wholesale when it grows past its capacity; tables still in use stay alive
+ * through their shared pointers.
+ */
+class DictDecodeTableCache {
+ public:
+  /** Returns the decode table for the input serialized dictionary. */
+  shared_ptr<const std::vector<std::string>> get(
+      std::vector<std::byte>& serialized_dict, uint8_t strlen_bytesize) {
+    std::string key;
+    key.reserve(serialized_dict.size() + 1);
+    key.push_back(static_cast<char>(strlen_bytesize));
+    key.append(
+        reinterpret_cast<const char*>(serialized_dict.data()),
+        serialized_dict.size());
+
+    {
+      std::lock_guard<std::mutex> lck(mtx_);
+      auto it = tables_.find(key);
+      if (it != tables_.end()) {
+        return it->second;
+      }
+    }
+
+    shared_ptr<const std::vector<std::string>> table =
+        make_shared<std::vector<std::string>>(
+            HERE(),
+            DictEncoding::deserialize_dictionary(
+                serialized_dict, strlen_bytesize));
+
+    std::lock_guard<std::mutex> lck(mtx_);
+    if (tables_.size() >= capacity_) {
+      tables_.clear();
+    }
+    tables_.emplace(std::move(key), table);
+    return table;
+  }
+
+ private:
+  /** Maximum number of cached decode tables. */
+  static constexpr size_t capacity_ = 64;
+
+  /** Mutex guarding `tables_`. */
+  std::mutex mtx_;
+
+  /** The cached decode tables, keyed by the serialized dictionary bytes. */
+  std::unordered_map<std::string, shared_ptr<const std::vector<std::string>>>
+      tables_;
+};
+
+/** The decode table cache instance. */
+DictDecodeTableCache dict_decode_table_cache;
+
+}  // namespace
+
 CompressionFilter::CompressionFilter(
     FilterType compressor,
     int level,
@@ -169,6 +230,8 @@ FilterType CompressionFilter::compressor_to_filter(Compressor compressor) {
       return FilterType::FILTER_DICTIONARY;
     case Compressor::DELTA:
       return FilterType::FILTER_DELTA;
+    case Compressor::ADAPTIVE:
+      return FilterType::FILTER_ADAPTIVE;
     default:
       assert(false);
       return FilterType::FILTER_NONE;
@@ -195,6 +258,8 @@ Compressor CompressionFilter::filter_to_compressor(FilterType type) {
       return Compressor::DICTIONARY_ENCODING;
     case FilterType::FILTER_DELTA:
       return Compressor::DELTA;
+    case FilterType::FILTER_ADAPTIVE:
+      return Compressor::ADAPTIVE;
     default:
       assert(false);
       return Compressor::NO_COMPRESSION;
@@ -275,6 +340,9 @@ void CompressionFilter::run_forward(
   auto total_num_parts = data_parts.size() + metadata_parts.size();
   auto metadata_size =
       2 * sizeof(uint32_t) + total_num_parts * 2 * sizeof(uint32_t);
+  // Adaptive mode records the chosen compressor per part.
+  if (compressor_ == Compressor::ADAPTIVE)
+    metadata_size += total_num_parts * sizeof(uint8_t);
   auto num_metadata_parts = static_cast<uint32_t>(metadata_parts.size());
   auto num_data_parts = static_cast<uint32_t>(data_parts.size());
   throw_if_not_ok(output_metadata->prepend_buffer(metadata_size));
@@ -309,7 +377,7 @@ Status CompressionFilter::run_reverse(
     FilterBuffer* input,
     FilterBuffer* output_metadata,
     FilterBuffer* output,
-    const Config&) const {
+    const Config& config) const {
   // Easy case: no compression
   if (compressor_ == Compressor::NO_COMPRESSION) {
     RETURN_NOT_OK(output->append_view(input));
@@ -334,9 +402,16 @@ Status CompressionFilter::run_reverse(
        filter_data_type_ == Datatype::STRING_UTF8) &&
       version_ >= 12 && offsets_tile) {
     if (compressor_ == Compressor::RLE ||
-        compressor_ == Compressor::DICTIONARY_ENCODING)
+        compressor_ == Compressor::DICTIONARY_ENCODING) {
+      bool found, cache_decode_tables;
+      RETURN_NOT_OK(config.get<bool>(
+          "sm.filter.dictionary_decode_table_cache",
+          &cache_decode_tables,
+          &found));
+      assert(found);
       return decompress_var_string_coords(
-          *input, *input_metadata, offsets_tile, *output);
+          *input, *input_metadata, offsets_tile, *output, cache_decode_tables);
+    }
   }
 
   for (uint32_t i = 0; i < num_metadata_parts; i++)
@@ -358,9 +433,18 @@ Status CompressionFilter::compress_part(
 
   auto cell_size = tile.cell_size();
 
+  // In adaptive mode, choose the compressor for this part and record the
+  // choice so that the reverse pass can dispatch on it.
+  auto compressor = compressor_;
+  if (compressor == Compressor::ADAPTIVE) {
+    compressor = select_compressor(tile, part);
+    auto compressor_char = static_cast<uint8_t>(compressor);
+    RETURN_NOT_OK(output_metadata->write(&compressor_char, sizeof(uint8_t)));
+  }
+
   // Invoke the proper compressor
   uint32_t orig_size = (uint32_t)output->size();
-  switch (compressor_) {
+  switch (compressor) {
     case Compressor::GZIP:
       GZip::compress(level_, &input_buffer, output);
       break;
@@ -377,9 +461,11 @@ Status CompressionFilter::compress_part(
       BZip::compress(level_, &input_buffer, output);
       break;
     case Compressor::DOUBLE_DELTA:
+      // The array format version selects the double delta layout.
       DoubleDelta::compress(
           reinterpret_datatype_ == Datatype::ANY ? filter_data_type_ :
                                                    reinterpret_datatype_,
+          version_,
           &input_buffer,
           output);
       break;
@@ -419,6 +505,15 @@ Status CompressionFilter::decompress_part(
     FilterBuffer* input_metadata) const {
   auto cell_size = tile.cell_size();
 
+  // In adaptive mode, the compressor used for this part precedes the part
+  // sizes in the metadata.
+  auto compressor = compressor_;
+  if (compressor == Compressor::ADAPTIVE) {
+    uint8_t compressor_char;
+    RETURN_NOT_OK(input_metadata->read(&compressor_char, sizeof(uint8_t)));
+    compressor = static_cast<Compressor>(compressor_char);
+  }
+
   // Read the part metadata
   uint32_t compressed_size, uncompressed_size;
   RETURN_NOT_OK(input_metadata->read(&uncompressed_size, sizeof(uint32_t)));
@@ -439,7 +534,7 @@ Status CompressionFilter::decompress_part(
 
   // Invoke the proper decompressor
   Status st = Status::Ok();
-  switch (compressor_) {
+  switch (compressor) {
     case Compressor::NO_COMPRESSION:
       assert(0);
       break;
@@ -470,6 +565,7 @@ Status CompressionFilter::decompress_part(
       DoubleDelta::decompress(
           reinterpret_datatype_ == Datatype::ANY ? filter_data_type_ :
                                                    reinterpret_datatype_,
+          version_,
           &input_buffer,
           &output_buffer);
       break;
@@ -477,6 +573,10 @@ Status CompressionFilter::decompress_part(
       return LOG_STATUS(
           Status_FilterError("CompressionFilter error; Dictionary encoding "
                              "only applies to variable length strings"));
+    case Compressor::ADAPTIVE:
+      // Replaced by the recorded per-part compressor above.
+      assert(0);
+      break;
   }
 
   if (output->owns_data())
@@ -615,7 +715,8 @@ Status CompressionFilter::decompress_var_string_coords(
     FilterBuffer& input,
     FilterBuffer& input_metadata,
     Tile* offsets_tile,
-    FilterBuffer& output) const {
+    FilterBuffer& output,
+    bool cache_decode_tables) const {
   if (input.num_buffers() != 1) {
     throw CompressionFilterStatusException(
         "Var-sized string input has to be in single "
@@ -657,10 +758,17 @@ Status CompressionFilter::decompress_var_string_coords(
     RETURN_NOT_OK(input_metadata.read(&dict_size, sizeof(uint32_t)));
     std::vector<std::byte> flattened_dict(dict_size);
     RETURN_NOT_OK(input_metadata.read(flattened_dict.data(), dict_size));
-    std::vector<std::string> dict = DictEncoding::deserialize_dictionary(
-        flattened_dict, string_len_bytesize);
+    shared_ptr<const std::vector<std::string>> dict;
+    if (cache_decode_tables) {
+      dict = dict_decode_table_cache.get(flattened_dict, string_len_bytesize);
+    } else {
+      dict = make_shared<std::vector<std::string>>(
+          HERE(),
+          DictEncoding::deserialize_dictionary(
+              flattened_dict, string_len_bytesize));
+    }
     DictEncoding::decompress(
-        input_view, dict, ids_bytesize, output_view, offsets_view);
+        input_view, *dict, ids_bytesize, output_view, offsets_view);
   }
 
   if (output_buffer->owns_data())
@@ -671,6 +779,54 @@ Status CompressionFilter::decompress_var_string_coords(
   return Status::Ok();
 }
 
+Compressor CompressionFilter::select_compressor(
+    const WriterTile& tile, ConstBuffer* part) const {
+  // Candidates are ordered from cheapest to most expensive so that ties on
+  // the sampled ratio favor the faster compressor.
+  static constexpr Compressor candidates[] = {
+      Compressor::LZ4, Compressor::RLE, Compressor::ZSTD};
+
+  // Trial-compress a bounded, cell-aligned prefix of the part.
+  auto cell_size = tile.cell_size();
+  uint64_t sample_size = std::min(part->size(), adaptive_sample_size_);
+  sample_size = sample_size / cell_size * cell_size;
+  if (sample_size == 0)
+    sample_size = part->size();
+  ConstBuffer sample(part->data(), sample_size);
+
+  Compressor best = Compressor::ZSTD;
+  uint64_t best_size = std::numeric_limits<uint64_t>::max();
+  Buffer scratch;
+  for (auto candidate : candidates) {
+    scratch.reset_offset();
+    scratch.reset_size();
+    try {
+      switch (candidate) {
+        case Compressor::LZ4:
+          LZ4::compress(level_, &sample, &scratch);
+          break;
+        case Compressor::RLE:
+          RLE::compress(cell_size, &sample, &scratch);
+          break;
+        case Compressor::ZSTD:
+          ZStd::compress(level_, zstd_compress_ctx_pool_, &sample, &scratch);
+          break;
+        default:
+          continue;
+      }
+    } catch (...) {
+      // A candidate that cannot compress this part is simply skipped.
+      continue;
+    }
+    if (scratch.size() < best_size) {
+      best_size = scratch.size();
+      best = candidate;
+    }
+  }
+
+  return best;
+}
+
 uint64_t CompressionFilter::overhead(
     const WriterTile& tile, uint64_t nbytes) const {
   auto cell_size = tile.cell_size();
@@ -688,6 +844,12 @@ uint64_t CompressionFilter::overhead(
       return BZip::overhead(nbytes);
     case Compressor::DOUBLE_DELTA:
       return DoubleDelta::overhead(nbytes);
+    case Compressor::ADAPTIVE:
+      // Worst case among the adaptive candidates.
+      return std::max(
+          {LZ4::overhead(nbytes),
+           RLE::overhead(nbytes, cell_size),
+           ZStd::overhead(nbytes)});
     case Compressor::DICTIONARY_ENCODING:
     default:
       // No compression
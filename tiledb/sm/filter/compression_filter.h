@@ -65,6 +65,12 @@ enum class Compressor : uint8_t;
  * Where each metadata_part/data_part has the format:
  *   uint32_t - part uncompressed length
  *   uint32_t - part compressed length
+ * In adaptive mode (`Compressor::ADAPTIVE`), the compressor is chosen
+ * per part among a fixed set of candidates, and each part is prefixed
+ * with an extra byte recording the choice:
+ *   uint8_t  - compressor used for the part
+ *   uint32_t - part uncompressed length
+ *   uint32_t - part compressed length
  *
  * The forward output data format is just the concatenated compressed bytes:
  *   uint8_t[] - metadata_part0's array of compressed bytes
@@ -184,6 +190,17 @@ class CompressionFilter : public Filter {
   /** Returns a new clone of this filter. */
   CompressionFilter* clone_impl() const override;
 
+  /** Maximum number of bytes trial-compressed per part in adaptive mode. */
+  static constexpr uint64_t adaptive_sample_size_ = 16384;
+
+  /**
+   * Selects the compressor to use for a single part in adaptive mode. A
+   * bounded, cell-aligned prefix of the part is trial-compressed with each
+   * candidate compressor and the one achieving the best ratio wins, with
+   * ties going to the cheaper candidate.
+   */
+  Compressor select_compressor(const WriterTile& tile, ConstBuffer* part) const;
+
   /** Helper function to compress a single contiguous buffer (part). */
   Status compress_part(
       const WriterTile& tile,
@@ -223,12 +240,17 @@ class CompressionFilter : public Filter {
   /**
    * Helper function to decompress a buffer of variable-sized strings for
    * certain algorithms where this is a special case
+   *
+   * If `cache_decode_tables` is `true`, dictionary decode tables are fetched
+   * from a process-wide cache shared by all tiles that persist a
+   * byte-identical dictionary, instead of being deserialized per tile.
    */
   Status decompress_var_string_coords(
       FilterBuffer& input,
       FilterBuffer& input_metadata,
       Tile* offsets_tile,
-      FilterBuffer& output) const;
+      FilterBuffer& output,
+      bool cache_decode_tables) const;
 
   /** Gets an option from this filter. */
   Status get_option_impl(FilterOption option, void* value) const override;
@@ -100,6 +100,24 @@ FilterBuffer::FilterBuffer(FilterStorage* storage) {
   storage_ = storage;
 }
 
+FilterBuffer::~FilterBuffer() {
+  if (storage_ == nullptr || buffers_.empty())
+    return;
+
+  // Return any buffers still held to the storage instance so they can be
+  // reused. As in clear(), drop our references before reclaiming so that
+  // unreferenced buffers are recognized as such.
+  std::vector<Buffer*> buffer_ptrs;
+  buffer_ptrs.reserve(buffers_.size());
+  for (const auto& buf : buffers_)
+    buffer_ptrs.push_back(buf.underlying_buffer().get());
+
+  buffers_.clear();
+
+  for (Buffer* b : buffer_ptrs)
+    std::ignore = storage_->reclaim(b);
+}
+
 Status FilterBuffer::swap(FilterBuffer& other) {
   if (read_only_ || other.read_only_)
     return LOG_STATUS(Status_FilterError(
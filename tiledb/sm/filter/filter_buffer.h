@@ -68,6 +68,12 @@ class FilterBuffer {
    */
   explicit FilterBuffer(FilterStorage* storage);
 
+  /**
+   * Destructor. Returns any buffers still held to the storage instance so
+   * they can be reused by later pipeline runs.
+   */
+  ~FilterBuffer();
+
   /**
    * Advance the offset (global across buffers) by the given number of bytes.
    */
@@ -35,6 +35,7 @@
 #include "bit_width_reduction_filter.h"
 #include "bitshuffle_filter.h"
 #include "byteshuffle_filter.h"
+#include "checksum_crc32c_filter.h"
 #include "checksum_md5_filter.h"
 #include "checksum_sha256_filter.h"
 #include "compression_filter.h"
@@ -43,6 +44,7 @@
 #include "float_scaling_filter.h"
 #include "noop_filter.h"
 #include "positive_delta_filter.h"
+#include "validity_bit_pack_filter.h"
 #include "tiledb/common/logger_public.h"
 #include "tiledb/sm/crypto/encryption_key.h"
 #include "tiledb/sm/enums/compressor.h"
@@ -64,6 +66,7 @@ tiledb::sm::Filter* tiledb::sm::FilterCreate::make(FilterType type) {
     case tiledb::sm::FilterType::FILTER_DELTA:
     case tiledb::sm::FilterType::FILTER_DOUBLE_DELTA:
     case tiledb::sm::FilterType::FILTER_DICTIONARY:
+    case tiledb::sm::FilterType::FILTER_ADAPTIVE:
       return tdb_new(tiledb::sm::CompressionFilter, type, -1, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_BIT_WIDTH_REDUCTION:
       return tdb_new(tiledb::sm::BitWidthReductionFilter, Datatype::ANY);
@@ -79,6 +82,10 @@ tiledb::sm::Filter* tiledb::sm::FilterCreate::make(FilterType type) {
       return tdb_new(tiledb::sm::ChecksumMD5Filter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_CHECKSUM_SHA256:
       return tdb_new(tiledb::sm::ChecksumSHA256Filter, Datatype::ANY);
+    case tiledb::sm::FilterType::FILTER_CHECKSUM_CRC32C:
+      return tdb_new(tiledb::sm::ChecksumCRC32CFilter, Datatype::ANY);
+    case tiledb::sm::FilterType::FILTER_VALIDITY_BIT_PACK:
+      return tdb_new(tiledb::sm::ValidityBitPackFilter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_SCALE_FLOAT:
       return tdb_new(tiledb::sm::FloatScalingFilter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_XOR:
@@ -122,7 +129,8 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
     case FilterType::FILTER_BZIP2:
     case FilterType::FILTER_DELTA:
     case FilterType::FILTER_DOUBLE_DELTA:
-    case FilterType::FILTER_DICTIONARY: {
+    case FilterType::FILTER_DICTIONARY:
+    case FilterType::FILTER_ADAPTIVE: {
       uint8_t compressor_char = deserializer.read<uint8_t>();
       int compression_level = deserializer.read<int32_t>();
       Datatype reinterpret_type = Datatype::ANY;
@@ -166,6 +174,10 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
       return make_shared<ChecksumMD5Filter>(HERE(), datatype);
     case FilterType::FILTER_CHECKSUM_SHA256:
       return make_shared<ChecksumSHA256Filter>(HERE(), datatype);
+    case FilterType::FILTER_CHECKSUM_CRC32C:
+      return make_shared<ChecksumCRC32CFilter>(HERE(), datatype);
+    case FilterType::FILTER_VALIDITY_BIT_PACK:
+      return make_shared<ValidityBitPackFilter>(HERE(), datatype);
     case FilterType::FILTER_SCALE_FLOAT: {
       auto filter_config =
           deserializer.read<FloatScalingFilter::FilterConfig>();
@@ -177,7 +189,7 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
           datatype);
     };
     case FilterType::FILTER_XOR: {
-      return make_shared<XORFilter>(HERE(), datatype);
+      return make_shared<XORFilter>(HERE(), datatype, version);
     };
     case FilterType::FILTER_WEBP: {
       if constexpr (webp_filter_exists) {
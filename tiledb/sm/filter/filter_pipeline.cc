@@ -30,6 +30,9 @@
  * This file defines class FilterPipeline.
  */
 
+#include <chrono>
+#include <cstring>
+
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "filter_create.h"
 #include "tiledb/common/heap_memory.h"
@@ -58,6 +61,17 @@ class FilterPipelineStatusException : public StatusException {
   }
 };
 
+/**
+ * Returns the calling thread's reusable FilterStorage instance. Sharing one
+ * long-lived pool per worker thread lets the intermediate filter buffers be
+ * recycled across chunks and tiles instead of going back to the heap
+ * allocator on every pipeline run.
+ */
+static FilterStorage& per_thread_filter_storage() {
+  thread_local FilterStorage storage;
+  return storage;
+}
+
 FilterPipeline::FilterPipeline()
     : max_chunk_size_(constants::max_tile_chunk_size) {
 }
@@ -239,9 +253,7 @@ Status FilterPipeline::filter_chunks_forward(
 
   // Run each chunk through the entire pipeline.
   auto status = parallel_for(compute_tp, 0, nchunks, [&](uint64_t i) {
-    // TODO(ttd): can we instead allocate one FilterStorage per thread?
-    // or make it threadsafe?
-    FilterStorage storage;
+    FilterStorage& storage = per_thread_filter_storage();
     FilterBuffer input_data(&storage), output_data(&storage);
     FilterBuffer input_metadata(&storage), output_metadata(&storage);
 
@@ -284,12 +296,11 @@ Status FilterPipeline::filter_chunks_forward(
       // Next input (input_buffers) now stores this output (output_buffers).
     }
 
-    // Save the finished chunk (last stage's output). This is safe to do
-    // because when the local FilterStorage goes out of scope, it will not
-    // free the buffers saved here as their shared_ptr counters will not
-    // be zero. However, as the output may have been a view on the input, we
-    // do need to save both here to prevent the input buffer from being
-    // freed.
+    // Save the finished chunk (last stage's output). As the output may have
+    // been a view on the input, we save both here to prevent the input
+    // buffer from being reclaimed while the output still references it. The
+    // buffers are released back to their thread's storage once the chunk has
+    // been copied to the final output below.
     auto& io = final_stage_io[i];
     auto& io_input = io.first;
     auto& io_output = io.second;
@@ -363,6 +374,13 @@ Status FilterPipeline::filter_chunks_forward(
     dest_offset += metadata_size;
     // Write the chunk data
     throw_if_not_ok(final_stage_output_data.copy_to((char*)dest + dest_offset));
+
+    // Release the chunk's buffers back to the storage of the thread that
+    // allocated them, now that the chunk has been copied out.
+    throw_if_not_ok(final_stage_output_metadata.clear());
+    throw_if_not_ok(final_stage_output_data.clear());
+    throw_if_not_ok(final_stage_io[i].second.first.clear());
+    throw_if_not_ok(final_stage_io[i].second.second.clear());
     return Status::Ok();
   });
 
@@ -382,6 +400,131 @@ uint32_t FilterPipeline::max_chunk_size() const {
   return max_chunk_size_;
 }
 
+std::vector<FilterPipeline::ChunkSizeTuningResult>
+FilterPipeline::autotune_chunk_size(
+    const void* sample_data,
+    uint64_t sample_size,
+    Datatype type,
+    uint64_t cell_size,
+    ThreadPool* compute_tp,
+    const Config& config,
+    shared_ptr<MemoryTracker> memory_tracker) {
+  if (sample_data == nullptr || sample_size == 0) {
+    throw FilterPipelineStatusException(
+        "Cannot autotune chunk size; empty sample data.");
+  }
+
+  // Candidate maximum chunk sizes, swept around the 64KB default. Small
+  // chunks give more parallelism to decode and crypto, large chunks give
+  // compressors a bigger window to find redundancy in.
+  static constexpr uint32_t candidates[] = {
+      16 * 1024,
+      32 * 1024,
+      64 * 1024,
+      128 * 1024,
+      256 * 1024,
+      512 * 1024,
+      1024 * 1024};
+
+  // Repeat runs on small samples so a single timer tick doesn't decide the
+  // schema parameter.
+  const uint64_t target_bytes = 8 * 1024 * 1024;
+  const uint64_t iterations =
+      std::max<uint64_t>(1, std::min<uint64_t>(8, target_bytes / sample_size));
+
+  // Benchmark on a copy of the pipeline so that this pipeline is only
+  // modified once the winning size is known.
+  FilterPipeline bench(*this);
+  stats::Stats stats("autotune_chunk_size");
+
+  std::vector<ChunkSizeTuningResult> results;
+  for (auto candidate : candidates) {
+    // Candidates at or above the sample size all produce a single chunk,
+    // only the first of them measures anything new.
+    if (!results.empty() && results.back().chunk_size >= sample_size) {
+      break;
+    }
+
+    bench.set_max_chunk_size(candidate);
+
+    double forward_secs = 0.0;
+    double reverse_secs = 0.0;
+    uint64_t filtered_size = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+      WriterTile writer_tile(
+          constants::format_version,
+          type,
+          cell_size,
+          sample_size,
+          memory_tracker);
+      writer_tile.write(sample_data, 0, sample_size);
+
+      auto start = std::chrono::steady_clock::now();
+      bench.run_forward(&stats, &writer_tile, nullptr, compute_tp);
+      forward_secs += std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+      filtered_size = writer_tile.filtered_buffer().size();
+
+      Tile reader_tile(
+          constants::format_version,
+          type,
+          cell_size,
+          0,
+          sample_size,
+          writer_tile.filtered_buffer().data(),
+          filtered_size,
+          memory_tracker);
+      ChunkData chunk_data;
+      reader_tile.load_chunk_data(chunk_data);
+
+      start = std::chrono::steady_clock::now();
+      throw_if_not_ok(bench.run_reverse(
+          &stats, &reader_tile, nullptr, chunk_data, compute_tp, config));
+      reverse_secs += std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+
+      if (std::memcmp(reader_tile.data(), sample_data, sample_size) != 0) {
+        throw FilterPipelineStatusException(
+            "Cannot autotune chunk size; sample data did not round-trip "
+            "through the pipeline.");
+      }
+    }
+
+    const auto total_bytes = static_cast<double>(sample_size * iterations);
+    results.push_back(
+        {candidate,
+         static_cast<double>(sample_size) / static_cast<double>(filtered_size),
+         total_bytes / std::max(forward_secs, 1e-9),
+         total_bytes / std::max(reverse_secs, 1e-9)});
+  }
+
+  // Score candidates against the best observed value of each metric. The
+  // ratio is weighted the heaviest as the saved bytes are paid for on every
+  // read and write, then reverse throughput as arrays are typically read
+  // more often than written.
+  double best_ratio = 0.0, best_forward = 0.0, best_reverse = 0.0;
+  for (auto& result : results) {
+    best_ratio = std::max(best_ratio, result.compression_ratio);
+    best_forward = std::max(best_forward, result.forward_throughput);
+    best_reverse = std::max(best_reverse, result.reverse_throughput);
+  }
+
+  double best_score = -1.0;
+  for (auto& result : results) {
+    const double score = 0.5 * result.compression_ratio / best_ratio +
+                         0.3 * result.reverse_throughput / best_reverse +
+                         0.2 * result.forward_throughput / best_forward;
+    if (score > best_score) {
+      best_score = score;
+      max_chunk_size_ = result.chunk_size;
+    }
+  }
+
+  return results;
+}
+
 void FilterPipeline::run_forward(
     stats::Stats* const writer_stats,
     WriterTile* const tile,
@@ -395,8 +538,20 @@ void FilterPipeline::run_forward(
 
   uint32_t chunk_size = 0;
   if (use_chunking) {
-    chunk_size =
-        WriterTile::compute_chunk_size(tile->size(), tile->cell_size());
+    // Honor the pipeline's maximum chunk size, which defaults to
+    // constants::max_tile_chunk_size but may have been tuned per schema. A
+    // zero maximum means chunking is disabled and is handled by the caller,
+    // fall back to the default if chunking was requested anyway.
+    chunk_size = WriterTile::compute_chunk_size(
+        tile->size(),
+        tile->cell_size(),
+        max_chunk_size_ > 0 ? max_chunk_size_ : constants::max_tile_chunk_size);
+  } else if (max_chunk_size_ > 0 && has_filter(FilterType::FILTER_WEBP)) {
+    // WebP tiles are not chunked at the generic chunk size because image
+    // rows must stay whole, but large image tiles are still split into
+    // row-aligned bands so the bands encode concurrently below.
+    chunk_size = static_cast<uint32_t>(
+        get_filter<WebpFilter>()->band_chunk_size(tile->size()));
   } else {
     chunk_size = tile->size();
   }
@@ -429,16 +584,41 @@ void FilterPipeline::run_forward(
 }
 
 void FilterPipeline::run_reverse_generic_tile(
-    stats::Stats* stats, Tile& tile, const Config& config) const {
+    stats::Stats* stats,
+    Tile& tile,
+    ThreadPool* compute_tp,
+    const Config& config) const {
   ChunkData chunk_data;
   tile.load_chunk_data(chunk_data);
-  for (unsigned c = 0; c < chunk_data.filtered_chunks_.size(); c++) {
-    throw_if_not_ok(
-        run_reverse(stats, &tile, nullptr, chunk_data, c, c + 1, 1, config));
-  }
+  throw_if_not_ok(
+      run_reverse(stats, &tile, nullptr, chunk_data, compute_tp, config));
   tile.clear_filtered_buffer();
 }
 
+Status FilterPipeline::run_reverse(
+    stats::Stats* const reader_stats,
+    Tile* const tile,
+    Tile* const offsets_tile,
+    const ChunkData& chunk_data,
+    ThreadPool* compute_tp,
+    const Config& config,
+    const CancellationSource* cancellation) const {
+  auto concurrency_level = compute_tp->concurrency_level();
+  return parallel_for(
+      compute_tp, 0, chunk_data.filtered_chunks_.size(), [&](uint64_t i) {
+        return run_reverse(
+            reader_stats,
+            tile,
+            offsets_tile,
+            chunk_data,
+            i,
+            i + 1,
+            concurrency_level,
+            config,
+            cancellation);
+      });
+}
+
 Status FilterPipeline::run_reverse(
     stats::Stats* const reader_stats,
     Tile* const tile,
@@ -447,11 +627,18 @@ Status FilterPipeline::run_reverse(
     const uint64_t min_chunk_index,
     const uint64_t max_chunk_index,
     uint64_t concurrency_level,
-    const Config& config) const {
+    const Config& config,
+    const CancellationSource* cancellation) const {
   // Run each chunk through the entire pipeline.
   for (size_t i = min_chunk_index; i < max_chunk_index; i++) {
+    // Abandon the remaining chunks promptly if the query was cancelled;
+    // large unfilter loops should not run to completion for a dead query.
+    if (cancellation != nullptr && cancellation->is_cancelled()) {
+      return Status_FilterError("Unfiltering cancelled.");
+    }
+
     auto& chunk = chunk_data.filtered_chunks_[i];
-    FilterStorage storage;
+    FilterStorage& storage = per_thread_filter_storage();
     FilterBuffer input_data(&storage), output_data(&storage);
     FilterBuffer input_metadata(&storage), output_metadata(&storage);
 
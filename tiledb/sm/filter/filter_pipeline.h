@@ -44,6 +44,7 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/filter/filter.h"
 #include "tiledb/sm/filter/filter_buffer.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/stats/stats.h"
 #include "tiledb/sm/tile/filtered_buffer.h"
@@ -54,6 +55,7 @@ namespace tiledb::sm {
 
 class Buffer;
 class EncryptionKey;
+class MemoryTracker;
 class Tile;
 
 /**
@@ -63,6 +65,21 @@ class Tile;
  */
 class FilterPipeline {
  public:
+  /** Benchmark results for one candidate chunk size during autotuning. */
+  struct ChunkSizeTuningResult {
+    /** The candidate maximum chunk size, in bytes. */
+    uint32_t chunk_size;
+
+    /** Unfiltered size divided by filtered size. */
+    double compression_ratio;
+
+    /** Forward (write path) throughput, in unfiltered bytes per second. */
+    double forward_throughput;
+
+    /** Reverse (read path) throughput, in unfiltered bytes per second. */
+    double reverse_throughput;
+  };
+
   /** Constructor. Initializes an empty pipeline. */
   FilterPipeline();
 
@@ -107,6 +124,44 @@ class FilterPipeline {
    */
   void add_filter(const Filter& filter, const Datatype new_type);
 
+  /**
+   * Benchmarks candidate maximum chunk sizes for this pipeline on sample
+   * data and records the best choice on the pipeline.
+   *
+   * Each candidate is run forward and in reverse through the pipeline on a
+   * copy of the sample, measuring the compression ratio and the throughput
+   * of both directions on the given thread pool. Small samples are run
+   * multiple times to smooth out timing noise. Candidates are scored with
+   * the ratio weighted the heaviest, as the saved bytes are paid for on
+   * every read and write, then reverse throughput, as arrays are typically
+   * read more often than written. The winning size is recorded with
+   * `set_max_chunk_size` so it is serialized with the schema.
+   *
+   * The sample should be representative of real tile data for the field
+   * this pipeline filters; at least a few megabytes is recommended. Only
+   * meaningful for pipelines that chunk their input (see
+   * `use_tile_chunking`).
+   *
+   * @param sample_data Sample of unfiltered tile data.
+   * @param sample_size Size of the sample, in bytes.
+   * @param type The data type the pipeline will be run on.
+   * @param cell_size The cell size of the data.
+   * @param compute_tp The thread pool for compute-bound tasks, sized at the
+   *     deployment's concurrency.
+   * @param config The global config.
+   * @param memory_tracker The memory tracker to use for the benchmark
+   *     tiles.
+   * @return Benchmark results for every measured candidate.
+   */
+  std::vector<ChunkSizeTuningResult> autotune_chunk_size(
+      const void* sample_data,
+      uint64_t sample_size,
+      Datatype type,
+      uint64_t cell_size,
+      ThreadPool* compute_tp,
+      const Config& config,
+      shared_ptr<MemoryTracker> memory_tracker);
+
   /** Clears the pipeline (removes all filters. */
   void clear();
 
@@ -228,10 +283,40 @@ class FilterPipeline {
    *
    * @param reader_stats Stats to record in the function.
    * @param tile Current tile on which the filter pipeline is being run.
+   * @param compute_tp The thread pool for compute-bound tasks.
    * @param config Global config.
    */
   void run_reverse_generic_tile(
-      stats::Stats* stats, Tile& tile, const Config& config) const;
+      stats::Stats* stats,
+      Tile& tile,
+      ThreadPool* compute_tp,
+      const Config& config) const;
+
+  /**
+   * Runs all chunks of the given tile in reverse through the pipeline,
+   * processing the chunks in parallel on the given thread pool. Each chunk
+   * writes to a disjoint region of the shared output tile at its
+   * precomputed offset, so no synchronization on the output is needed.
+   *
+   * @param reader_stats Stats to record in the function.
+   * @param tile Current tile on which the filter pipeline is being run.
+   * @param offsets_tile Offsets tile to unfilter, null if it will be unfilered
+   * separately.
+   * @param chunk_data The tile chunk info, buffers and offsets.
+   * @param compute_tp The thread pool for compute-bound tasks.
+   * @param config The global config.
+   * @param cancellation Optional cancellation source checked before each
+   * chunk; unprocessed chunks are abandoned once it fires.
+   * @return Status.
+   */
+  Status run_reverse(
+      stats::Stats* const reader_stats,
+      Tile* const tile,
+      Tile* const offsets_tile,
+      const ChunkData& chunk_data,
+      ThreadPool* compute_tp,
+      const Config& config,
+      const CancellationSource* cancellation = nullptr) const;
 
   /**
    * Run the given chunk range in reverse through the pipeline.
@@ -245,6 +330,8 @@ class FilterPipeline {
    * @param max_chunk_index The chunk range index to end at.
    * @param concurrency_level The maximum level of concurrency.
    * @param config The global config.
+   * @param cancellation Optional cancellation source checked before each
+   * chunk; unprocessed chunks are abandoned once it fires.
    * @return Status.
    */
   Status run_reverse(
@@ -255,7 +342,8 @@ class FilterPipeline {
       const uint64_t min_chunk_index,
       const uint64_t max_chunk_index,
       uint64_t concurrency_level,
-      const Config& config) const;
+      const Config& config,
+      const CancellationSource* cancellation = nullptr) const;
 
   /**
    * Serializes the pipeline metadata into a binary buffer.
@@ -33,6 +33,7 @@
 #include "tiledb/sm/filter/filter_storage.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/misc/constants.h"
 
 using namespace tiledb::common;
 
@@ -40,6 +41,8 @@ namespace tiledb {
 namespace sm {
 
 shared_ptr<Buffer> FilterStorage::get_buffer() {
+  std::lock_guard<std::mutex> lock(mtx_);
+
   if (available_.empty())
     available_.emplace_back(tdb_new(Buffer));
 
@@ -53,14 +56,18 @@ shared_ptr<Buffer> FilterStorage::get_buffer() {
 }
 
 uint64_t FilterStorage::num_available() const {
+  std::lock_guard<std::mutex> lock(mtx_);
   return available_.size();
 }
 
 uint64_t FilterStorage::num_in_use() const {
+  std::lock_guard<std::mutex> lock(mtx_);
   return in_use_.size();
 }
 
 Status FilterStorage::reclaim(Buffer* buffer) {
+  std::lock_guard<std::mutex> lock(mtx_);
+
   auto it = in_use_list_map_.find(buffer);
 
   // If the buffer is not managed by this class, do nothing.
@@ -77,7 +84,12 @@ Status FilterStorage::reclaim(Buffer* buffer) {
     shared_ptr<Buffer> ptr = std::move(*list_node);
     in_use_.erase(list_node);
     in_use_list_map_.erase(it);
-    available_.push_front(std::move(ptr));
+
+    // Keep the buffer (and its allocation) around for reuse, unless its
+    // allocation has grown past the maximum tile chunk size, in which case
+    // release it to bound the memory retained by this instance.
+    if (buffer->alloced_size() <= constants::max_tile_chunk_size)
+      available_.push_front(std::move(ptr));
   }
 
   return Status::Ok();
@@ -35,6 +35,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "tiledb/common/common.h"
@@ -50,6 +51,13 @@ class Buffer;
 
 /**
  * Manages a ref-counted pool of buffers, used for filter I/O.
+ *
+ * Reclaimed buffers keep their heap allocation, so a long-lived instance
+ * serves repeated pipeline runs without going back to the allocator.
+ * Buffers whose allocation has grown past the maximum tile chunk size are
+ * released instead of pooled, bounding the memory retained per instance.
+ *
+ * This class is thread-safe.
  */
 class FilterStorage {
  public:
@@ -81,6 +89,9 @@ class FilterStorage {
   Status reclaim(Buffer* buffer);
 
  private:
+  /** Mutex protecting the buffer lists. */
+  mutable std::mutex mtx_;
+
   /** List of buffers that are available to be used (may be empty). */
   std::list<shared_ptr<Buffer>> available_;
 
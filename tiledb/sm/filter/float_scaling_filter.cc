@@ -77,19 +77,21 @@ void FloatScalingFilter::run_forward(
     uint32_t new_size = num_elems_in_part * sizeof(W);
     throw_if_not_ok(output_metadata->write(&new_size, sizeof(uint32_t)));
     throw_if_not_ok(output->prepend_buffer(new_size));
+    Buffer* part_buffer = output->buffer_ptr(0);
+    part_buffer->reset_offset();
 
     // Iterate through each input buffer, storing each raw float as
     // an integer with the value round((raw_float - offset) / scale).
+    // Quantize straight into the prepended buffer so the loop is free of
+    // per-element FilterBuffer calls and can vectorize.
     const T* part_data = static_cast<const T*>(i.data());
+    W* converted_part = part_buffer->cur_data_as<W>();
     for (uint32_t j = 0; j < num_elems_in_part; ++j) {
       T elem = part_data[j];
-      W converted_elem = static_cast<W>(
+      converted_part[j] = static_cast<W>(
           round((elem - static_cast<T>(offset_)) / static_cast<T>(scale_)));
-      throw_if_not_ok(output->write(&converted_elem, sizeof(W)));
-      if (j != num_elems_in_part - 1) {
-        output->advance_offset(sizeof(W));
-      }
     }
+    part_buffer->set_size(new_size);
   }
 }
 
@@ -156,18 +158,25 @@ Status FloatScalingFilter::run_reverse(
     RETURN_NOT_OK(input_metadata->read(&part_size, sizeof(uint32_t)));
     ConstBuffer part(nullptr, 0);
     RETURN_NOT_OK(input->get_const_buffer(part_size, &part));
+    input->advance_offset(part_size);
 
     uint32_t num_elems_in_part = part.size() / sizeof(W);
-    RETURN_NOT_OK(output->prepend_buffer(num_elems_in_part * sizeof(T)));
+    uint32_t new_size = num_elems_in_part * sizeof(T);
+    RETURN_NOT_OK(output->prepend_buffer(new_size));
+    Buffer* part_buffer = output->buffer_ptr(0);
+    part_buffer->reset_offset();
 
     // Iterate through each input buffer, reversing the value of the stored
     // integer value and writing in the value scale * stored_int + offset.
+    // Dequantize straight into the prepended buffer so the loop is free of
+    // per-element FilterBuffer calls and can vectorize.
     const W* part_data = static_cast<const W*>(part.data());
+    T* converted_part = part_buffer->cur_data_as<T>();
     for (uint32_t j = 0; j < num_elems_in_part; ++j) {
       T elem = static_cast<T>(part_data[j]);
-      T converted_elem = static_cast<T>(scale_ * elem + offset_);
-      RETURN_NOT_OK(output->write(&converted_elem, sizeof(T)));
+      converted_part[j] = static_cast<T>(scale_ * elem + offset_);
     }
+    part_buffer->set_size(new_size);
   }
 
   // Output metadata is a view on the input metadata, skipping what was used
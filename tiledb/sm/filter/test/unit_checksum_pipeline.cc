@@ -34,6 +34,7 @@
 
 #include <test/support/src/mem_helpers.h>
 #include <test/support/tdb_catch.h>
+#include "../checksum_crc32c_filter.h"
 #include "../checksum_md5_filter.h"
 #include "filter_test_support.h"
 #include "test/support/src/mem_helpers.h"
@@ -89,3 +90,33 @@ TEST_CASE(
     CHECK(elt == n);
   }
 }
+
+TEST_CASE(
+    "Filter: Test CRC32C checksum validation",
+    "[filter][checksum-validation]") {
+  // The default configuration validates checksums while unfiltering.
+  tiledb::sm::Config config;
+
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  const uint64_t nelts = 100;
+  auto tile = make_increasing_tile(nelts, tracker);
+
+  FilterPipeline crc32c_pipeline;
+  ThreadPool tp(4);
+  ChecksumCRC32CFilter crc32c_filter(Datatype::UINT64);
+  crc32c_pipeline.add_filter(crc32c_filter);
+  crc32c_pipeline.run_forward(&dummy_stats, tile.get(), nullptr, &tp);
+  CHECK(tile->size() == 0);
+  CHECK(tile->filtered_buffer().size() != 0);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile, tracker);
+  run_reverse(config, tp, unfiltered_tile, crc32c_pipeline);
+
+  for (uint64_t n = 0; n < nelts; n++) {
+    uint64_t elt = 0;
+    CHECK_NOTHROW(
+        unfiltered_tile.read(&elt, n * sizeof(uint64_t), sizeof(uint64_t)));
+    CHECK(elt == n);
+  }
+}
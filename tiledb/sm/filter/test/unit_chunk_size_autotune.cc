@@ -0,0 +1,134 @@
+/**
+ * @file unit_chunk_size_autotune.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This set of unit tests checks the per-pipeline maximum chunk size on the
+ * write path and the chunk size autotuner.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <test/support/src/mem_helpers.h>
+#include <test/support/tdb_catch.h>
+
+#include "../compression_filter.h"
+#include "../filter_pipeline.h"
+#include "filter_test_support.h"
+#include "tiledb/sm/enums/compressor.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/tile/tile.h"
+
+using namespace tiledb::sm;
+
+TEST_CASE(
+    "Filter: Forward run honors the pipeline max chunk size",
+    "[filter][chunk-size]") {
+  Config config;
+  ThreadPool tp(4);
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  const uint64_t tile_size = 4096;
+  std::vector<uint8_t> data(tile_size);
+  for (uint64_t i = 0; i < tile_size; i++) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+
+  WriterTile tile(
+      constants::format_version, Datatype::UINT8, 1, tile_size, tracker);
+  tile.write(data.data(), 0, tile_size);
+
+  FilterPipeline pipeline;
+  pipeline.set_max_chunk_size(1024);
+  pipeline.run_forward(&dummy_stats, &tile, nullptr, &tp);
+
+  // The filtered buffer should be cut in tile_size / max_chunk_size chunks.
+  Tile filtered_tile(
+      constants::format_version,
+      Datatype::UINT8,
+      1,
+      0,
+      tile_size,
+      tile.filtered_buffer().data(),
+      tile.filtered_buffer().size(),
+      tracker);
+  ChunkData chunk_data;
+  filtered_tile.load_chunk_data(chunk_data);
+  CHECK(chunk_data.filtered_chunks_.size() == 4);
+}
+
+TEST_CASE(
+    "Filter: Autotune chunk size on compressible data",
+    "[filter][chunk-size][autotune]") {
+  Config config;
+  ThreadPool tp(4);
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  // Compressible sample: a short repeating pattern.
+  const uint64_t sample_size = 256 * 1024;
+  std::vector<uint8_t> sample(sample_size);
+  for (uint64_t i = 0; i < sample_size; i++) {
+    sample[i] = static_cast<uint8_t>(i % 61);
+  }
+
+  FilterPipeline pipeline;
+  pipeline.add_filter(CompressionFilter(Compressor::ZSTD, 2, Datatype::ANY));
+
+  auto results = pipeline.autotune_chunk_size(
+      sample.data(), sample_size, Datatype::UINT8, 1, &tp, config, tracker);
+
+  // Candidates up to the sample size are measured, plus the first candidate
+  // that covers the whole sample in one chunk.
+  CHECK(results.size() == 5);
+
+  // The recorded choice is one of the measured candidates.
+  auto chosen = std::find_if(
+      results.begin(), results.end(), [&](const auto& result) {
+        return result.chunk_size == pipeline.max_chunk_size();
+      });
+  REQUIRE(chosen != results.end());
+
+  // The sample compresses at every candidate size and all timings ran.
+  for (const auto& result : results) {
+    CHECK(result.compression_ratio > 1.0);
+    CHECK(result.forward_throughput > 0.0);
+    CHECK(result.reverse_throughput > 0.0);
+  }
+}
+
+TEST_CASE(
+    "Filter: Autotune chunk size rejects empty sample",
+    "[filter][chunk-size][autotune]") {
+  Config config;
+  ThreadPool tp(4);
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  FilterPipeline pipeline;
+  CHECK_THROWS(pipeline.autotune_chunk_size(
+      nullptr, 0, Datatype::UINT8, 1, &tp, config, tracker));
+}
@@ -0,0 +1,110 @@
+/**
+ * @file unit_validity_bit_pack_pipeline.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This set of unit tests checks running the filter pipeline with the
+ * validity bit pack filter.
+ *
+ */
+
+#include <test/support/src/mem_helpers.h>
+#include <test/support/tdb_catch.h>
+
+#include "../compression_filter.h"
+#include "../validity_bit_pack_filter.h"
+#include "filter_test_support.h"
+
+using namespace tiledb::sm;
+
+TEST_CASE(
+    "Filter: Test validity bit pack", "[filter][validity-bit-pack]") {
+  tiledb::sm::Config config;
+
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  // Set up a validity tile with a mix of valid and null cells, including
+  // non-canonical non-zero validity values.
+  const uint64_t nelts = 1000;
+  auto tile = make_shared<WriterTile>(
+      HERE(),
+      constants::format_version,
+      Datatype::UINT8,
+      sizeof(uint8_t),
+      nelts,
+      tracker);
+
+  std::vector<uint8_t> results;
+  for (uint64_t i = 0; i < nelts; i++) {
+    uint8_t val = static_cast<uint8_t>(i % 5 == 0 ? 0 : i % 251);
+    CHECK_NOTHROW(tile->write(&val, i, sizeof(uint8_t)));
+    // Any non-zero validity byte unpacks as the canonical value 1.
+    results.push_back(val != 0 ? 1 : 0);
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(ValidityBitPackFilter(Datatype::UINT8));
+
+  SECTION("- Bit pack only") {
+  }
+
+  SECTION("- Bit pack followed by RLE") {
+    // The default cell validity pipeline compresses with RLE; packing runs
+    // before it so RLE sees the packed bytes.
+    pipeline.add_filter(CompressionFilter(
+        tiledb::sm::Compressor::RLE,
+        constants::cell_validity_compression_level,
+        Datatype::UINT8));
+  }
+
+  pipeline.run_forward(&dummy_stats, tile.get(), nullptr, &tp);
+
+  // Check new size and number of chunks
+  CHECK(tile->size() == 0);
+  CHECK(tile->filtered_buffer().size() != 0);
+  CHECK(tile->filtered_buffer().size() < nelts);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile, tracker);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    uint8_t elt = 0;
+    CHECK_NOTHROW(unfiltered_tile.read(&elt, i, sizeof(uint8_t)));
+    CHECK(elt == results[i]);
+  }
+}
+
+TEST_CASE(
+    "Filter: Validity bit pack accepted datatypes",
+    "[filter][validity-bit-pack]") {
+  ValidityBitPackFilter filter(Datatype::UINT8);
+  CHECK(filter.accepts_input_datatype(Datatype::UINT8));
+  CHECK(!filter.accepts_input_datatype(Datatype::INT8));
+  CHECK(!filter.accepts_input_datatype(Datatype::UINT16));
+  CHECK(!filter.accepts_input_datatype(Datatype::FLOAT64));
+  CHECK(!filter.accepts_input_datatype(Datatype::STRING_ASCII));
+}
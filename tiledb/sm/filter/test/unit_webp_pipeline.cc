@@ -106,3 +106,66 @@ TEST_CASE("Filter: Round trip WebpFilter RGB data", "[filter][webp]") {
     CHECK(value == expected_result[i]);
   }
 }
+
+TEST_CASE(
+    "Filter: Round trip WebpFilter banded large tile", "[filter][webp]") {
+  tiledb::sm::Config config;
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  // A tile taller than the 1024-row band height, so the pipeline splits it
+  // into row-aligned bands that are encoded as independent images.
+  uint64_t height = 2000;
+  uint64_t width = 100;
+  uint64_t row_stride = width * 3;
+  auto tile = make_shared<WriterTile>(
+      HERE(),
+      constants::format_version,
+      Datatype::UINT8,
+      sizeof(uint8_t),
+      height * row_stride,
+      tracker);
+
+  std::vector<uint8_t> data{0, 125, 255};
+  std::vector<uint8_t> expected_result(height * row_stride, 0);
+  for (uint64_t i = 0; i < height * width; i++) {
+    // Write three values for each RGB pixel.
+    for (uint64_t j = 0; j < 3; j++) {
+      CHECK_NOTHROW(tile->write(&data[j], i * 3 + j, sizeof(uint8_t)));
+      expected_result[i * 3 + j] = data[j];
+    }
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  float quality = 100.0f;
+  bool lossless = true;
+  pipeline.add_filter(WebpFilter(
+      quality,
+      WebpInputFormat::WEBP_RGB,
+      lossless,
+      height,
+      width * 3,
+      Datatype::UINT8));
+
+  // Writes never use generic chunking with WebP; the bands come from the
+  // filter's own row-aligned band size.
+  bool use_chunking = false;
+  pipeline.run_forward(&dummy_stats, tile.get(), nullptr, &tp, use_chunking);
+  CHECK(tile->size() == 0);
+  CHECK(tile->filtered_buffer().size() != 0);
+
+  // The tile was encoded as two bands of 1024 and 976 rows.
+  uint64_t num_chunks = 0;
+  memcpy(&num_chunks, tile->filtered_buffer().data(), sizeof(uint64_t));
+  CHECK(num_chunks == 2);
+
+  auto unfiltered_tile =
+      create_tile_for_unfiltering(height * row_stride, tile, tracker);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+
+  for (uint64_t i = 0; i < height * row_stride; i++) {
+    uint8_t value;
+    CHECK_NOTHROW(unfiltered_tile.read(&value, i, sizeof(uint8_t)));
+    CHECK(value == expected_result[i]);
+  }
+}
@@ -220,6 +220,92 @@ TEST_CASE("Filter: Test XOR", "[filter][xor]") {
   testing_xor_filter<int64_t>(Datatype::DATETIME_AS);
 }
 
+TEST_CASE("Filter: Test XOR interleaved channels", "[filter][xor]") {
+  tiledb::sm::Config config;
+
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  // Four interleaved channels with distinct smooth baselines, so the tuned
+  // lane count differs from the default of one.
+  const uint64_t nchannels = 4;
+  const uint64_t nelts = 400;
+  auto tile = make_shared<WriterTile>(
+      HERE(),
+      constants::format_version,
+      Datatype::INT32,
+      sizeof(int32_t),
+      nelts * sizeof(int32_t),
+      tracker);
+
+  std::vector<int32_t> results;
+  for (uint64_t i = 0; i < nelts; i++) {
+    int32_t val =
+        static_cast<int32_t>((i % nchannels) * 100000 + i / nchannels);
+    CHECK_NOTHROW(tile->write(&val, i * sizeof(int32_t), sizeof(int32_t)));
+    results.push_back(val);
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(XORFilter(Datatype::INT32));
+  pipeline.run_forward(&dummy_stats, tile.get(), nullptr, &tp);
+  CHECK(tile->size() == 0);
+  CHECK(tile->filtered_buffer().size() != 0);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile, tracker);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    int32_t elt = 0;
+    CHECK_NOTHROW(
+        unfiltered_tile.read(&elt, i * sizeof(int32_t), sizeof(int32_t)));
+    CHECK(elt == results[i]);
+  }
+}
+
+TEST_CASE("Filter: Test XOR at pre-lanes format version", "[filter][xor]") {
+  tiledb::sm::Config config;
+
+  auto tracker = tiledb::test::create_test_memory_tracker();
+
+  // Writes into arrays created before the lane metadata existed must keep
+  // the legacy single-lane layout. Use interleaved channels so that the
+  // tuned lane count would differ from one if the version were ignored.
+  const format_version_t version = constants::xor_lanes_min_format_version - 1;
+  const uint64_t nchannels = 4;
+  const uint64_t nelts = 400;
+  auto tile = make_shared<WriterTile>(
+      HERE(),
+      version,
+      Datatype::INT32,
+      sizeof(int32_t),
+      nelts * sizeof(int32_t),
+      tracker);
+
+  std::vector<int32_t> results;
+  for (uint64_t i = 0; i < nelts; i++) {
+    int32_t val =
+        static_cast<int32_t>((i % nchannels) * 100000 + i / nchannels);
+    CHECK_NOTHROW(tile->write(&val, i * sizeof(int32_t), sizeof(int32_t)));
+    results.push_back(val);
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(XORFilter(Datatype::INT32, version));
+  pipeline.run_forward(&dummy_stats, tile.get(), nullptr, &tp);
+  CHECK(tile->size() == 0);
+  CHECK(tile->filtered_buffer().size() != 0);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile, tracker);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    int32_t elt = 0;
+    CHECK_NOTHROW(
+        unfiltered_tile.read(&elt, i * sizeof(int32_t), sizeof(int32_t)));
+    CHECK(elt == results[i]);
+  }
+}
+
 TEST_CASE("Filter: Pipeline filtered output types", "[filter][pipeline]") {
   FilterPipeline pipeline;
   auto tracker = tiledb::test::create_test_memory_tracker();
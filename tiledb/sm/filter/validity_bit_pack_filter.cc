@@ -0,0 +1,176 @@
+/**
+ * @file   validity_bit_pack_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ValidityBitPackFilter.
+ */
+
+#include "tiledb/sm/filter/validity_bit_pack_filter.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/filter_buffer.h"
+
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+ValidityBitPackFilter::ValidityBitPackFilter(Datatype filter_data_type)
+    : Filter(FilterType::FILTER_VALIDITY_BIT_PACK, filter_data_type) {
+}
+
+ValidityBitPackFilter* ValidityBitPackFilter::clone_impl() const {
+  return tdb_new(ValidityBitPackFilter, filter_data_type_);
+}
+
+std::ostream& ValidityBitPackFilter::output(std::ostream& os) const {
+  os << "ValidityBitPack";
+  return os;
+}
+
+bool ValidityBitPackFilter::accepts_input_datatype(Datatype datatype) const {
+  // The packing is lossy for anything but boolean flags: non-zero bytes come
+  // back as 1. Only accept the validity datatype.
+  return datatype == Datatype::UINT8;
+}
+
+void ValidityBitPackFilter::run_forward(
+    const WriterTile&,
+    WriterTile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  auto input_size = static_cast<uint32_t>(input->size());
+
+  // Compute the packed output size.
+  std::vector<ConstBuffer> parts = input->buffers();
+  auto num_parts = (uint32_t)parts.size();
+  uint64_t output_size = 0;
+  for (unsigned i = 0; i < num_parts; i++)
+    output_size += (parts[i].size() + 7) / 8;
+
+  // Allocate a buffer for the packed bits.
+  throw_if_not_ok(output->prepend_buffer(output_size));
+  Buffer* buffer_ptr = output->buffer_ptr(0);
+  buffer_ptr->reset_offset();
+  assert(buffer_ptr != nullptr);
+
+  // Forward the existing metadata and write the header for this filter.
+  throw_if_not_ok(output_metadata->append_view(input_metadata));
+  uint32_t metadata_size = (2 + num_parts) * sizeof(uint32_t);
+  throw_if_not_ok(output_metadata->prepend_buffer(metadata_size));
+  throw_if_not_ok(output_metadata->write(&input_size, sizeof(uint32_t)));
+  throw_if_not_ok(output_metadata->write(&num_parts, sizeof(uint32_t)));
+
+  // Pack all parts.
+  for (unsigned i = 0; i < num_parts; i++) {
+    auto part_size = static_cast<uint32_t>(parts[i].size());
+    throw_if_not_ok(output_metadata->write(&part_size, sizeof(uint32_t)));
+    throw_if_not_ok(pack_part(&parts[i], output));
+  }
+}
+
+Status ValidityBitPackFilter::pack_part(
+    ConstBuffer* part, FilterBuffer* output) const {
+  auto nbytes = static_cast<uint32_t>(part->size());
+  auto packed_nbytes = (nbytes + 7) / 8;
+  auto bytes = static_cast<const uint8_t*>(part->data());
+
+  // Pack into scratch and write the part with a single call. Any non-zero
+  // validity byte is stored as a set bit, LSB-first within each packed byte.
+  std::vector<uint8_t> packed(packed_nbytes, 0);
+  for (uint32_t i = 0; i < nbytes; i++)
+    packed[i / 8] |= static_cast<uint8_t>(bytes[i] != 0) << (i % 8);
+
+  return output->write(packed.data(), packed_nbytes);
+}
+
+Status ValidityBitPackFilter::run_reverse(
+    const Tile&,
+    Tile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output,
+    const Config&) const {
+  // Read the header for this filter.
+  uint32_t orig_size, num_parts;
+  RETURN_NOT_OK(input_metadata->read(&orig_size, sizeof(uint32_t)));
+  RETURN_NOT_OK(input_metadata->read(&num_parts, sizeof(uint32_t)));
+
+  RETURN_NOT_OK(output->prepend_buffer(orig_size));
+  Buffer* buffer_ptr = output->buffer_ptr(0);
+  buffer_ptr->reset_offset();
+  buffer_ptr->set_size(orig_size);
+  output->reset_offset();
+
+  // Unpack each part back to one byte per cell.
+  uint64_t out_nbytes = 0;
+  for (uint32_t i = 0; i < num_parts; i++) {
+    uint32_t part_size;
+    RETURN_NOT_OK(input_metadata->read(&part_size, sizeof(uint32_t)));
+    if (part_size > orig_size - out_nbytes)
+      return LOG_STATUS(Status_FilterError(
+          "Validity bit pack filter error; part exceeds output size."));
+    RETURN_NOT_OK(unpack_part(
+        input,
+        part_size,
+        static_cast<uint8_t*>(buffer_ptr->data(out_nbytes))));
+    out_nbytes += part_size;
+  }
+
+  // Output metadata is a view on the input metadata, skipping what was used
+  // by this filter.
+  auto md_offset = input_metadata->offset();
+  RETURN_NOT_OK(output_metadata->append_view(
+      input_metadata, md_offset, input_metadata->size() - md_offset));
+
+  return Status::Ok();
+}
+
+Status ValidityBitPackFilter::unpack_part(
+    FilterBuffer* input, uint32_t nbytes, uint8_t* unpacked) const {
+  auto packed_nbytes = (nbytes + 7) / 8;
+
+  // Read the packed part with a single call and unpack it into the output,
+  // restoring set bits as the canonical validity value 1.
+  std::vector<uint8_t> packed(packed_nbytes);
+  RETURN_NOT_OK(input->read(packed.data(), packed_nbytes));
+  for (uint32_t i = 0; i < nbytes; i++)
+    unpacked[i] = (packed[i / 8] >> (i % 8)) & 1;
+
+  return Status::Ok();
+}
+
+}  // namespace sm
+}  // namespace tiledb
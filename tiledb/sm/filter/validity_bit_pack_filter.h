@@ -0,0 +1,147 @@
+/**
+ * @file   validity_bit_pack_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class ValidityBitPackFilter.
+ */
+
+#ifndef TILEDB_VALIDITY_BIT_PACK_FILTER_H
+#define TILEDB_VALIDITY_BIT_PACK_FILTER_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/filter/filter.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A filter that packs byte-per-cell validity values into one bit per cell,
+ * intended for the cell validity filter pipeline. Validity travels as one
+ * uint8 per cell in memory, so packing shrinks the filtered stage and the
+ * on-disk validity tiles by 8x before any compression is applied.
+ *
+ * The filter treats its input as boolean flags: on the forward path every
+ * non-zero byte is stored as a set bit and restored as the canonical value 1
+ * on the reverse path. This matches validity semantics, where any non-zero
+ * byte means the cell is valid, but makes the filter unsuitable for general
+ * uint8 attribute data.
+ *
+ * If the input comes in multiple FilterBuffer parts, each part is packed
+ * independently so that downstream filters see the same part boundaries.
+ * Bits are packed LSB-first: cell `i` of a part maps to bit `i % 8` of
+ * packed byte `i / 8`.
+ *
+ * The forward output metadata has the format:
+ *   uint32_t - original (unpacked) input size in bytes
+ *   uint32_t - number of parts
+ *   uint32_t - part0 original size in bytes
+ *   ...
+ *   uint32_t - partN original size in bytes
+ *   input_metadata
+ *
+ * The forward output data format is the concatenation of the packed parts,
+ * where each part occupies `ceil(part_size / 8)` bytes.
+ *
+ * The reverse output data format is one byte per cell, each 0 or 1.
+ */
+class ValidityBitPackFilter : public Filter {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param filter_data_type Datatype the filter will operate on.
+   */
+  ValidityBitPackFilter(Datatype filter_data_type);
+
+  /**
+   * Checks if the filter is applicable to the input datatype.
+   *
+   * @param type Input datatype to check filter compatibility.
+   */
+  bool accepts_input_datatype(Datatype datatype) const override;
+
+  /**
+   * Run forward. Packs each input part from one byte per cell down to one
+   * bit per cell.
+   */
+  void run_forward(
+      const WriterTile& tile,
+      WriterTile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const override;
+
+  /**
+   * Run reverse. Unpacks each part back to one byte per cell, restoring
+   * every set bit as the canonical validity value 1.
+   */
+  Status run_reverse(
+      const Tile& tile,
+      Tile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output,
+      const Config& config) const override;
+
+ protected:
+  /** Dumps the filter details in ASCII format in the selected output string. */
+  std::ostream& output(std::ostream& os) const override;
+
+ private:
+  /** Returns a new clone of this filter. */
+  ValidityBitPackFilter* clone_impl() const override;
+
+  /**
+   * Packs one part from one byte per cell to one bit per cell.
+   *
+   * @param part Part with byte-per-cell validity values.
+   * @param output Buffer to write the packed bytes to.
+   * @return Status
+   */
+  Status pack_part(ConstBuffer* part, FilterBuffer* output) const;
+
+  /**
+   * Unpacks `nbytes` cells of packed validity values from the input.
+   *
+   * @param input Buffer with packed validity bits.
+   * @param nbytes Original (unpacked) part size in bytes.
+   * @param unpacked Output region with room for `nbytes` bytes.
+   * @return Status
+   */
+  Status unpack_part(
+      FilterBuffer* input, uint32_t nbytes, uint8_t* unpacked) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_VALIDITY_BIT_PACK_FILTER_H
@@ -43,6 +43,14 @@ std::ostream& WebpFilter::output(std::ostream& os) const {
 bool WebpFilter::accepts_input_datatype(Datatype datatype) const {
   return datatype == Datatype::UINT8;
 }
+
+uint64_t WebpFilter::band_chunk_size(uint64_t tile_size) const {
+  auto row_stride = static_cast<uint64_t>(extents_.second);
+  if (row_stride == 0 || tile_size <= band_rows_ * row_stride) {
+    return tile_size;
+  }
+  return band_rows_ * row_stride;
+}
 }  // namespace tiledb::sm
 
 #ifndef TILEDB_WEBP
@@ -122,76 +130,64 @@ void WebpFilter::run_forward(
   throw_if_not_ok(output_metadata->prepend_buffer(metadata_size));
   throw_if_not_ok(output_metadata->write(&num_parts, sizeof(uint32_t)));
 
-  int extent_y = extents_.first, extent_x = extents_.second,
+  int extent_x = extents_.second,
       pixel_depth = format_ < WebpInputFormat::WEBP_RGBA ? 3 : 4;
   for (const auto& i : input_parts) {
     auto data = static_cast<const uint8_t*>(i.data());
-    // Number of bytes encoded; Encoded result data buffer.
-    size_t enc_size = 0;
-    uint8_t* result = nullptr;
+    // The input may be a band of whole rows rather than the full tile; the
+    // pipeline splits large image tiles into bands so they encode
+    // concurrently.
+    if (i.size() % static_cast<uint64_t>(extent_x) != 0) {
+      throw StatusException(Status_FilterError(
+          "Encoding input is not aligned to whole image rows"));
+    }
+    auto num_rows = static_cast<int>(i.size() / extent_x);
+
+    // Configure the encoder; thread_level enables WebP's internal
+    // multi-threading for the codec work on each image.
+    WebPConfig config;
+    if (WebPConfigPreset(&config, WEBP_PRESET_DEFAULT, quality_) == 0) {
+      throw StatusException(
+          Status_FilterError("Error initializing WebP encoder config"));
+    }
+    config.lossless = lossless_ ? 1 : 0;
+    config.thread_level = 1;
+
+    WebPPicture picture;
+    if (WebPPictureInit(&picture) == 0) {
+      throw StatusException(
+          Status_FilterError("Error initializing WebP picture"));
+    }
+    // We divide extent_x by colorspace value count to get pixel-width of
+    // image, extent_x currently represents row stride.
+    picture.width = extent_x / pixel_depth;
+    picture.height = num_rows;
+    picture.use_argb = 1;
+
+    WebPMemoryWriter writer;
+    WebPMemoryWriterInit(&writer);
+    picture.writer = WebPMemoryWrite;
+    picture.custom_ptr = &writer;
+
     // Cleanup allocated data when we leave scope.
     ScopedExecutor cleanup([&]() {
-      if (enc_size > 0 && result != nullptr)
-        WebPFree(result);
+      WebPPictureFree(&picture);
+      WebPMemoryWriterClear(&writer);
     });
-    // We divide extent_x by colorspace value count to get pixel-width of image,
-    // extent_x currently represents row stride.
+
+    int imported = 0;
     switch (format_) {
       case WebpInputFormat::WEBP_RGB:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessRGB(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeRGB(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        imported = WebPPictureImportRGB(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_RGBA:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessRGBA(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeRGBA(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        imported = WebPPictureImportRGBA(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_BGR:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessBGR(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeBGR(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        imported = WebPPictureImportBGR(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_BGRA:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessBGRA(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeBGRA(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        imported = WebPPictureImportBGRA(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_NONE:
         throw StatusException(Status_FilterError(
@@ -200,16 +196,20 @@ void WebpFilter::run_forward(
         throw StatusException(Status_FilterError(
             "Filter option TILEDB_FILTER_WEBP_FORMAT is invalid"));
     }
+    if (imported == 0) {
+      throw StatusException(Status_FilterError("Error importing image data"));
+    }
 
     // Check if encoding failed.
-    if (enc_size == 0) {
+    if (WebPEncode(&config, &picture) == 0) {
       throw StatusException(Status_FilterError("Error encoding image data"));
     }
+    size_t enc_size = writer.size;
 
     // Write encoded data to output buffer.
     throw_if_not_ok(output_metadata->write(&enc_size, sizeof(uint32_t)));
     throw_if_not_ok(output->prepend_buffer(enc_size));
-    throw_if_not_ok(output->write(result, enc_size));
+    throw_if_not_ok(output->write(writer.mem, enc_size));
   }
 }
 
@@ -235,45 +235,52 @@ Status WebpFilter::run_reverse(
   uint32_t num_parts;
   throw_if_not_ok(input_metadata->read(&num_parts, sizeof(uint32_t)));
   for (uint32_t i = 0; i < num_parts; i++) {
-    uint32_t enc_size;
-    uint8_t* result = nullptr;
-    // Cleanup allocated data when we leave scope.
-    ScopedExecutor cleanup([&]() {
-      if (enc_size > 0 && result != nullptr)
-        WebPFree(result);
-    });
     // Read size of data encoded from input metadata.
+    uint32_t enc_size;
     throw_if_not_ok(input_metadata->read(&enc_size, sizeof(uint32_t)));
     // Read encoded data from input buffer.
     ConstBuffer part(nullptr, 0);
     throw_if_not_ok(input->get_const_buffer(enc_size, &part));
 
-    // Decode data.
-    auto data = static_cast<const uint8_t*>(part.data());
-    int width, height;
+    // Configure the decoder; use_threads enables WebP's internal
+    // multi-threading for the codec work on each image.
+    WebPDecoderConfig config;
+    if (WebPInitDecoderConfig(&config) == 0) {
+      throw StatusException(
+          Status_FilterError("Error initializing WebP decoder config"));
+    }
+    config.options.use_threads = 1;
     switch (format_) {
       case WebpInputFormat::WEBP_RGB:
-        result = WebPDecodeRGB(data, enc_size, &width, &height);
+        config.output.colorspace = MODE_RGB;
         break;
       case WebpInputFormat::WEBP_RGBA:
-        result = WebPDecodeRGBA(data, enc_size, &width, &height);
+        config.output.colorspace = MODE_RGBA;
         break;
       case WebpInputFormat::WEBP_BGR:
-        result = WebPDecodeBGR(data, enc_size, &width, &height);
+        config.output.colorspace = MODE_BGR;
         break;
       case WebpInputFormat::WEBP_BGRA:
-        result = WebPDecodeBGRA(data, enc_size, &width, &height);
+        config.output.colorspace = MODE_BGRA;
         break;
       default:
         throw StatusException(Status_FilterError(
             "Filter option TILEDB_FILTER_WEBP_FORMAT must be set"));
     }
 
-    // Check if decoding failed.
-    if (result == nullptr) {
+    // Cleanup allocated data when we leave scope.
+    ScopedExecutor cleanup([&]() { WebPFreeDecBuffer(&config.output); });
+
+    // Decode data.
+    auto data = static_cast<const uint8_t*>(part.data());
+    if (WebPDecode(data, enc_size, &config) != VP8_STATUS_OK) {
       throw StatusException(Status_FilterError("Error decoding image data"));
     }
-    throw_if_not_ok(output->write(result, output->size()));
+
+    // Each decoded image is one band of whole rows; append it after the
+    // bands decoded before it.
+    throw_if_not_ok(
+        output->write(config.output.u.RGBA.rgba, config.output.u.RGBA.size));
   }
 
   // Output metadata is a view on the input metadata, skipping what was used
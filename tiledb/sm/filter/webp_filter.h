@@ -88,6 +88,11 @@ enum class WebpInputFormat : uint8_t;
  * dimension index 0, 1 respectively. Dimension data types must use matching
  * integral types.
  *
+ * Large image tiles are split into bands of whole rows, each encoded as an
+ * independent WebP image, so the filter pipeline can run the bands
+ * concurrently; see `band_chunk_size`. WebP's internal multi-threading is
+ * enabled for the codec work on each band.
+ *
  * The WebP filter supports attribute data types of uint8 only.
  */
 class WebpFilter : public Filter {
@@ -251,6 +256,17 @@ class WebpFilter : public Filter {
    */
   void serialize_impl(Serializer& serializer) const override;
 
+  /**
+   * Returns the size in bytes of the bands a tile of the given size is
+   * split into before encoding, aligned to whole image rows. Returns
+   * `tile_size` unchanged if the tile is small or extents are not set, in
+   * which case the tile is encoded as a single image.
+   *
+   * @param tile_size Size in bytes of the tile to be filtered.
+   * @return Band size in bytes.
+   */
+  uint64_t band_chunk_size(uint64_t tile_size) const;
+
   /**
    * Set tile extents to be used in tile-based image compression.
    * This filter references these extents only on forward pass during writes.
@@ -283,6 +299,9 @@ class WebpFilter : public Filter {
   /*           PRIVATE ATTRIBUTES      */
   /* ********************************* */
 
+  /** The number of image rows per encoded band of a large tile. */
+  static constexpr uint64_t band_rows_ = 1024;
+
   float quality_;
   WebpInputFormat format_;
   bool lossless_;
@@ -37,6 +37,10 @@
 
 #include "tiledb/sm/filter/xor_filter.h"
 
+#include <algorithm>
+#include <bit>
+#include <limits>
+
 using namespace tiledb::common;
 
 namespace tiledb {
@@ -126,26 +130,72 @@ void XORFilter::run_forward(
   Buffer* output_buf = output->buffer_ptr(0);
   assert(output_buf != nullptr);
 
-  // Write the metadata
+  // Write the metadata. Writes at older format versions must keep the
+  // legacy single-lane layout without the per-part lane byte, so that
+  // readers opening the fragment at that version parse the metadata
+  // correctly.
+  const bool write_lanes = version_ >= constants::xor_lanes_min_format_version;
   auto parts = input->buffers();
   auto num_parts = (uint32_t)parts.size();
-  uint32_t metadata_size = sizeof(uint32_t) + num_parts * sizeof(uint32_t);
+  uint32_t metadata_size =
+      sizeof(uint32_t) +
+      num_parts * (sizeof(uint32_t) + (write_lanes ? sizeof(uint8_t) : 0));
   throw_if_not_ok(output_metadata->append_view(input_metadata));
   throw_if_not_ok(output_metadata->prepend_buffer(metadata_size));
   throw_if_not_ok(output_metadata->write(&num_parts, sizeof(uint32_t)));
 
-  // XOR all parts
+  // XOR all parts, tuning the lane count per part.
   for (const auto& part : parts) {
     auto part_size = (uint32_t)part.size();
+    uint8_t lanes =
+        write_lanes ? tune_lanes<T>(
+                          static_cast<const T*>(part.data()),
+                          part_size / sizeof(T)) :
+                      1;
     throw_if_not_ok(output_metadata->write(&part_size, sizeof(uint32_t)));
-    throw_if_not_ok(xor_part<T>(&part, output_buf));
+    if (write_lanes) {
+      throw_if_not_ok(output_metadata->write(&lanes, sizeof(uint8_t)));
+    }
+    throw_if_not_ok(xor_part<T>(&part, output_buf, lanes));
   }
 }
 
 template <
     typename T,
     typename std::enable_if<std::is_integral<T>::value>::type*>
-Status XORFilter::xor_part(const ConstBuffer* part, Buffer* output) const {
+uint8_t XORFilter::tune_lanes(const T* data, uint32_t num_elems) const {
+  // Lane counts covering the common channel counts of interleaved data.
+  static constexpr uint8_t candidates[] = {1, 2, 3, 4, 8, 16};
+  constexpr uint32_t max_lag = 16;
+
+  // Score all candidates over the same sampled elements so the population
+  // counts are comparable.
+  const uint32_t sample = std::min<uint32_t>(num_elems, 4096);
+  if (sample <= max_lag)
+    return 1;
+
+  uint8_t best_lanes = 1;
+  uint64_t best_cost = std::numeric_limits<uint64_t>::max();
+  for (auto lanes : candidates) {
+    uint64_t cost = 0;
+    for (uint32_t j = max_lag; j < sample; ++j) {
+      auto v = static_cast<std::make_unsigned_t<T>>(data[j] ^ data[j - lanes]);
+      cost += std::popcount(static_cast<uint64_t>(v));
+    }
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_lanes = lanes;
+    }
+  }
+
+  return best_lanes;
+}
+
+template <
+    typename T,
+    typename std::enable_if<std::is_integral<T>::value>::type*>
+Status XORFilter::xor_part(
+    const ConstBuffer* part, Buffer* output, uint8_t lanes) const {
   uint32_t s = part->size();
   assert(s % sizeof(T) == 0);
   uint32_t num_elems_in_part = s / sizeof(T);
@@ -154,19 +204,23 @@ Status XORFilter::xor_part(const ConstBuffer* part, Buffer* output) const {
     return Status::Ok();
   }
 
-  // Write starting element.
+  RETURN_NOT_OK(output->realloc(output->offset() + s));
   const T* part_array = static_cast<const T*>(part->data());
-  RETURN_NOT_OK(output->write(part_array, sizeof(T)));
-  output->advance_offset(sizeof(T));
-
-  for (uint32_t j = 1; j < num_elems_in_part; ++j) {
-    T value = part_array[j] ^ part_array[j - 1];
-    RETURN_NOT_OK(output->write(&value, sizeof(T)));
+  T* output_array = static_cast<T*>(output->cur_data());
 
-    if (j != num_elems_in_part - 1) {
-      output->advance_offset(sizeof(T));
-    }
+  // Write the starting elements, then XOR each element against the element
+  // `lanes` positions before it. The loop has no carried dependency, so it
+  // vectorizes.
+  uint32_t l = std::clamp<uint32_t>(lanes, 1, num_elems_in_part);
+  for (uint32_t j = 0; j < l; ++j) {
+    output_array[j] = part_array[j];
   }
+  for (uint32_t j = l; j < num_elems_in_part; ++j) {
+    output_array[j] = part_array[j] ^ part_array[j - l];
+  }
+
+  output->advance_size(s);
+  output->advance_offset(s);
 
   return Status::Ok();
 }
@@ -228,10 +282,17 @@ Status XORFilter::run_reverse(
   for (uint32_t i = 0; i < num_parts; i++) {
     uint32_t part_size;
     RETURN_NOT_OK(input_metadata->read(&part_size, sizeof(uint32_t)));
+
+    // Arrays written before the lane metadata existed use a single lane.
+    uint8_t lanes = 1;
+    if (version_ >= constants::xor_lanes_min_format_version) {
+      RETURN_NOT_OK(input_metadata->read(&lanes, sizeof(uint8_t)));
+    }
+
     ConstBuffer part(nullptr, 0);
     RETURN_NOT_OK(input->get_const_buffer(part_size, &part));
 
-    RETURN_NOT_OK(unxor_part<T>(&part, output_buf));
+    RETURN_NOT_OK(unxor_part<T>(&part, output_buf, lanes));
 
     if (output_buf->owns_data()) {
       output_buf->advance_size(part_size);
@@ -252,7 +313,8 @@ Status XORFilter::run_reverse(
 template <
     typename T,
     typename std::enable_if<std::is_integral<T>::value>::type*>
-Status XORFilter::unxor_part(const ConstBuffer* part, Buffer* output) const {
+Status XORFilter::unxor_part(
+    const ConstBuffer* part, Buffer* output, uint8_t lanes) const {
   uint32_t s = part->size();
   assert(s % sizeof(T) == 0);
   uint32_t num_elems_in_part = s / sizeof(T);
@@ -261,16 +323,16 @@ Status XORFilter::unxor_part(const ConstBuffer* part, Buffer* output) const {
     return Status::Ok();
   }
 
-  // Write starting element.
+  // Write the starting elements, then XOR each stored value against the
+  // reconstructed element `lanes` positions before it.
   const T* part_array = static_cast<const T*>(part->data());
   T* output_array = static_cast<T*>(output->cur_data());
-  output_array[0] = part_array[0];
-
-  T last_element = part_array[0];
-  for (uint32_t j = 1; j < num_elems_in_part; ++j) {
-    T value = last_element ^ part_array[j];
-    output_array[j] = value;
-    last_element = value;
+  uint32_t l = std::clamp<uint32_t>(lanes, 1, num_elems_in_part);
+  for (uint32_t j = 0; j < l; ++j) {
+    output_array[j] = part_array[j];
+  }
+  for (uint32_t j = l; j < num_elems_in_part; ++j) {
+    output_array[j] = output_array[j - l] ^ part_array[j];
   }
 
   return Status::Ok();
@@ -278,7 +340,7 @@ Status XORFilter::unxor_part(const ConstBuffer* part, Buffer* output) const {
 
 /** Returns a new clone of this filter. */
 XORFilter* XORFilter::clone_impl() const {
-  return tdb_new(XORFilter, filter_data_type_);
+  return tdb_new(XORFilter, filter_data_type_, version_);
 }
 
 }  // namespace sm
@@ -36,6 +36,7 @@
 #include "tiledb/common/status.h"
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/filter/filter.h"
+#include "tiledb/sm/misc/constants.h"
 
 using namespace tiledb::common;
 
@@ -44,12 +45,16 @@ namespace sm {
 
 /**
  * The XOR filter stores the input data passed into it as the starting
- * element and all the differences between the consecutive pairs of
- * elements.
+ * elements and the differences between pairs of elements a fixed number of
+ * lanes apart.
  *
- * On write, the XOR filter stores an array of integers (with size n) by storing
- * the starting element and then storing the XOR between the next
- * n-1 consecutive pairs of elements.
+ * On write, the XOR filter stores an array of integers (with size n) by
+ * storing the starting `lanes` elements and then storing the XOR between
+ * each element and the element `lanes` positions before it. The lane count
+ * is tuned per part from a sample of the data, so that interleaved
+ * multi-channel data is differenced channel-against-channel, and is stored
+ * in the part metadata. Arrays written before version 23 always use a
+ * single lane.
  *
  * On read, the XOR filter reverses this transformation and returns the values
  * of the original elements.
@@ -61,9 +66,13 @@ class XORFilter : public Filter {
    * Constructor.
    *
    * @param filter_data_type Datatype the filter will operate on.
+   * @param version Format version of the array the filter operates on.
    */
-  XORFilter(Datatype filter_data_type)
-      : Filter(FilterType::FILTER_XOR, filter_data_type) {
+  XORFilter(
+      Datatype filter_data_type,
+      const format_version_t version = constants::format_version)
+      : Filter(FilterType::FILTER_XOR, filter_data_type)
+      , version_(version) {
   }
 
   /**
@@ -139,26 +148,40 @@ class XORFilter : public Filter {
       FilterBuffer* output) const;
 
   /**
-   * XORs the input buffer by storing the first element, then
-   * storing the XORed value between each consecutive element pair.
+   * XORs the input buffer by storing the first `lanes` elements, then
+   * storing the XORed value between each pair of elements `lanes` positions
+   * apart.
    */
   template <
       typename T,
       typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
-  Status xor_part(const ConstBuffer* part, Buffer* output) const;
+  Status xor_part(const ConstBuffer* part, Buffer* output, uint8_t lanes) const;
 
   /**
    * Un-XORs the input buffer by restoring the input buffer (which
-   * contains the starting element and the XORs between each
-   * consecutive element pair) to the original array.
+   * contains the starting elements and the XORs between each pair of
+   * elements `lanes` positions apart) to the original array.
    */
   template <
       typename T,
       typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
-  Status unxor_part(const ConstBuffer* part, Buffer* output) const;
+  Status unxor_part(
+      const ConstBuffer* part, Buffer* output, uint8_t lanes) const;
+
+  /**
+   * Picks the lane count that minimizes the population count of the XORed
+   * values over a sample of the part, favoring smaller lane counts on ties.
+   */
+  template <
+      typename T,
+      typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+  uint8_t tune_lanes(const T* data, uint32_t num_elems) const;
 
   /** Returns a new clone of this filter. */
   XORFilter* clone_impl() const override;
+
+  /** The format version of the array the filter operates on. */
+  format_version_t version_;
 };
 
 }  // namespace sm
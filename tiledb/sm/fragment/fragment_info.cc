@@ -37,6 +37,7 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/ndrectangle.h"
 #include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_identifier.h"
@@ -86,7 +87,7 @@ void FragmentInfo::expand_anterior_ndrange(
 }
 
 void FragmentInfo::dump(FILE* out) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (out == nullptr)
     out = stdout;
 
@@ -115,7 +116,7 @@ void FragmentInfo::dump(FILE* out) const {
 }
 
 Status FragmentInfo::get_dense(uint32_t fid, int32_t* dense) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (dense == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot check if fragment is dense; Dense argument cannot be null"));
@@ -130,7 +131,7 @@ Status FragmentInfo::get_dense(uint32_t fid, int32_t* dense) const {
 }
 
 Status FragmentInfo::get_sparse(uint32_t fid, int32_t* sparse) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (sparse == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot check if fragment is sparse; Sparse argument cannot be null"));
@@ -146,11 +147,14 @@ Status FragmentInfo::get_sparse(uint32_t fid, int32_t* sparse) const {
 
 uint32_t FragmentInfo::fragment_num() const {
   ensure_loaded();
+  if (!details_loaded_) {
+    return (uint32_t)lazy_fragments_.size();
+  }
   return (uint32_t)single_fragment_info_vec_.size();
 }
 
 Status FragmentInfo::get_cell_num(uint32_t fid, uint64_t* cell_num) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (cell_num == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get fragment URI; Cell number argument cannot be null"));
@@ -165,7 +169,7 @@ Status FragmentInfo::get_cell_num(uint32_t fid, uint64_t* cell_num) const {
 }
 
 Status FragmentInfo::get_total_cell_num(uint64_t* cell_num) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (cell_num == nullptr)
     return LOG_STATUS(
         Status_FragmentInfoError("Cell number argument cannot be null"));
@@ -187,7 +191,7 @@ Status FragmentInfo::get_total_cell_num(uint64_t* cell_num) const {
 }
 
 const std::string& FragmentInfo::fragment_name(uint32_t fid) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     throw FragmentInfoException(
         "Cannot get fragment URI; Invalid fragment index");
@@ -196,7 +200,7 @@ const std::string& FragmentInfo::fragment_name(uint32_t fid) const {
 }
 
 Status FragmentInfo::get_fragment_size(uint32_t fid, uint64_t* size) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (size == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get fragment URI; Size argument cannot be null"));
@@ -220,6 +224,11 @@ Status FragmentInfo::get_fragment_uri(uint32_t fid, const char** uri) const {
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get fragment URI; Invalid fragment index"));
 
+  if (!details_loaded_) {
+    *uri = lazy_fragments_[fid].uri().c_str();
+    return Status::Ok();
+  }
+
   *uri = single_fragment_info_vec_[fid].uri().c_str();
 
   return Status::Ok();
@@ -255,6 +264,13 @@ Status FragmentInfo::get_timestamp_range(
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get fragment URI; Invalid fragment index"));
 
+  if (!details_loaded_) {
+    auto range = lazy_fragments_[fid].timestamp_range();
+    *start = range.first;
+    *end = range.second;
+    return Status::Ok();
+  }
+
   auto range = single_fragment_info_vec_[fid].timestamp_range();
   *start = range.first;
   *end = range.second;
@@ -264,7 +280,7 @@ Status FragmentInfo::get_timestamp_range(
 
 Status FragmentInfo::get_non_empty_domain(
     uint32_t fid, uint32_t did, void* domain) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (domain == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get non-empty domain; Domain argument cannot be null"));
@@ -293,7 +309,7 @@ Status FragmentInfo::get_non_empty_domain(
 
 Status FragmentInfo::get_non_empty_domain(
     uint32_t fid, const char* dim_name, void* domain) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get non-empty domain; Invalid fragment index"));
@@ -327,7 +343,7 @@ Status FragmentInfo::get_non_empty_domain_var_size(
     uint32_t did,
     uint64_t* start_size,
     uint64_t* end_size) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (start_size == nullptr)
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get non-empty domain var size; Start "
@@ -365,7 +381,7 @@ Status FragmentInfo::get_non_empty_domain_var_size(
     const char* dim_name,
     uint64_t* start_size,
     uint64_t* end_size) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get var-sized non-empty domain; Invalid fragment index"));
@@ -398,7 +414,7 @@ Status FragmentInfo::get_non_empty_domain_var_size(
 
 Status FragmentInfo::get_non_empty_domain_var(
     uint32_t fid, uint32_t did, void* start, void* end) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (start == nullptr)
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get non-empty domain var; Domain "
@@ -434,7 +450,7 @@ Status FragmentInfo::get_non_empty_domain_var(
 
 Status FragmentInfo::get_non_empty_domain_var(
     uint32_t fid, const char* dim_name, void* start, void* end) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get non-empty domain var; Invalid fragment index"));
@@ -466,7 +482,7 @@ Status FragmentInfo::get_non_empty_domain_var(
 }
 
 Status FragmentInfo::get_mbr_num(uint32_t fid, uint64_t* mbr_num) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (mbr_num == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get fragment URI; MBR number argument cannot be null"));
@@ -489,7 +505,7 @@ Status FragmentInfo::get_mbr_num(uint32_t fid, uint64_t* mbr_num) {
 
 Status FragmentInfo::get_mbr(
     uint32_t fid, uint32_t mid, uint32_t did, void* mbr) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (mbr == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get MBR; mbr argument cannot be null"));
@@ -530,7 +546,7 @@ Status FragmentInfo::get_mbr(
 
 Status FragmentInfo::get_mbr(
     uint32_t fid, uint32_t mid, const char* dim_name, void* mbr) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR; Invalid fragment index"));
@@ -565,7 +581,7 @@ Status FragmentInfo::get_mbr_var_size(
     uint32_t did,
     uint64_t* start_size,
     uint64_t* end_size) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (start_size == nullptr)
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR var size; Start "
@@ -615,7 +631,7 @@ Status FragmentInfo::get_mbr_var_size(
     const char* dim_name,
     uint64_t* start_size,
     uint64_t* end_size) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get MBR var size; Invalid fragment index"));
@@ -647,7 +663,7 @@ Status FragmentInfo::get_mbr_var_size(
 
 Status FragmentInfo::get_mbr_var(
     uint32_t fid, uint32_t mid, uint32_t did, void* start, void* end) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (start == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get MBR var; Start argument cannot be null"));
@@ -693,7 +709,7 @@ Status FragmentInfo::get_mbr_var(
 
 Status FragmentInfo::get_mbr_var(
     uint32_t fid, uint32_t mid, const char* dim_name, void* start, void* end) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR var; Invalid fragment index"));
@@ -725,7 +741,7 @@ Status FragmentInfo::get_mbr_var(
 }
 
 Status FragmentInfo::get_version(uint32_t fid, uint32_t* version) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (version == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get version; Version argument cannot be null"));
@@ -740,7 +756,7 @@ Status FragmentInfo::get_version(uint32_t fid, uint32_t* version) const {
 }
 
 shared_ptr<ArraySchema> FragmentInfo::get_array_schema(uint32_t fid) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (fid >= fragment_num()) {
     auto st = Status_FragmentInfoError(
         "Cannot get array schema; Invalid fragment index");
@@ -765,7 +781,7 @@ shared_ptr<ArraySchema> FragmentInfo::get_array_schema(uint32_t fid) {
 
 Status FragmentInfo::get_array_schema_name(
     uint32_t fid, const char** schema_name) {
-  ensure_loaded();
+  ensure_details_loaded();
   if (schema_name == nullptr)
     return LOG_STATUS(Status_FragmentInfoError(
         "Cannot get array schema URI; schema name argument cannot be null"));
@@ -786,7 +802,7 @@ Status FragmentInfo::get_array_schema_name(
 
 Status FragmentInfo::has_consolidated_metadata(
     uint32_t fid, int32_t* has) const {
-  ensure_loaded();
+  ensure_details_loaded();
   if (has == nullptr)
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot check if fragment has consolidated "
@@ -864,6 +880,38 @@ Status FragmentInfo::load(const ArrayDirectory& array_dir) {
     throw std::runtime_error("Cannot get fragment info config setting");
   }
 
+  bool from_summary = false;
+  status = config_.get<bool>(
+      "sm.fragment_info.load_from_summary", &from_summary, &found);
+  if (!status.ok() || !found) {
+    throw std::runtime_error("Cannot get fragment info config setting");
+  }
+
+  bool lazy_load = false;
+  status = config_.get<bool>("sm.fragment_info.lazy_load", &lazy_load, &found);
+  if (!status.ok() || !found) {
+    throw std::runtime_error("Cannot get fragment info config setting");
+  }
+
+  // Serve the fragment info from the consolidated fragment metadata
+  // summaries when they cover all fragments to load. MBR preloading needs
+  // the full per-fragment metadata, so it keeps the regular path.
+  if (from_summary && !preload_rtrees && load_from_summary(array_dir)) {
+    details_loaded_ = true;
+    return Status::Ok();
+  }
+
+  // Defer the per-fragment metadata when only the listing is needed. MBR
+  // preloading requires the full metadata, so it keeps the eager path.
+  if (lazy_load && !preload_rtrees) {
+    return load_index(array_dir);
+  }
+
+  return load_details(array_dir, preload_rtrees);
+}
+
+Status FragmentInfo::load_details(
+    const ArrayDirectory& array_dir, bool preload_rtrees) {
   // Get the array schemas and fragment metadata.
   auto memory_tracker = resources_->create_memory_tracker();
   std::vector<std::shared_ptr<FragmentMetadata>> fragment_metadata;
@@ -937,6 +985,40 @@ Status FragmentInfo::load(const ArrayDirectory& array_dir) {
     unconsolidated_metadata_num_ += (uint32_t)!f.has_consolidated_footer();
   }
 
+  loaded_ = true;
+  details_loaded_ = true;
+  return Status::Ok();
+}
+
+Status FragmentInfo::load_index(const ArrayDirectory& array_dir) {
+  auto timer_se =
+      resources_->stats().start_timer("sm_fragment_info_load_index");
+
+  // Only the array schemas and the directory listing are read here; the
+  // per-fragment metadata is deferred until an accessor needs it.
+  auto tracker = resources_->ephemeral_memory_tracker();
+  std::tie(array_schema_latest_, array_schemas_all_) =
+      array_dir.load_array_schemas(enc_key_, tracker);
+
+  const auto filtered_fragment_uris =
+      array_dir.filtered_fragment_uris(array_schema_latest_->dense());
+  lazy_fragments_.clear();
+  for (const auto& sf : filtered_fragment_uris.fragment_uris()) {
+    if (sf.timestamp_range().first >= timestamp_start_ &&
+        sf.timestamp_range().second <= timestamp_end_) {
+      lazy_fragments_.emplace_back(sf);
+    }
+  }
+
+  // Get the URIs to vacuum
+  to_vacuum_ = array_dir.filtered_fragment_uris(true).fragment_uris_to_vacuum();
+
+  // The remaining info is computed when the details are materialized.
+  single_fragment_info_vec_.clear();
+  anterior_ndrange_.clear();
+  unconsolidated_metadata_num_ = 0;
+  lazy_array_dir_.emplace(array_dir);
+  details_loaded_ = false;
   loaded_ = true;
   return Status::Ok();
 }
@@ -947,9 +1029,27 @@ void FragmentInfo::ensure_loaded() const {
   }
 }
 
+void FragmentInfo::ensure_details_loaded() const {
+  ensure_loaded();
+  if (details_loaded_) {
+    return;
+  }
+
+  // Materialize all deferred fragments in one batch; the detail load is
+  // parallel across fragments, so the first accessor that needs details
+  // pays the cost of a single eager load instead of one serial load per
+  // fragment.
+  auto self = const_cast<FragmentInfo*>(this);
+  throw_if_not_ok(self->load_details(*lazy_array_dir_, false));
+  lazy_array_dir_.reset();
+  lazy_fragments_.clear();
+}
+
 Status FragmentInfo::load_and_replace(
     const URI& new_fragment_uri,
     const std::vector<TimestampedURI>& to_replace) {
+  ensure_details_loaded();
+
   // Load the new single fragment info
   auto&& [st, new_single_fragment_info] = load(new_fragment_uri);
   RETURN_NOT_OK(st);
@@ -975,6 +1075,21 @@ load_consolidated_fragment_meta(
     throw StatusException(Status_FragmentInfoError(
         "Cannot load consolidated fragment metadata; URI is empty."));
 
+  // Probe the context-level cache first. Consolidated fragment metadata
+  // files are immutable, so a hit for a URI is always valid.
+  auto& cache = resources.fragment_meta_cache();
+  if (cache.enabled()) {
+    auto cached = cache.lookup(uri.to_string());
+    if (cached.tile_ != nullptr) {
+      resources.stats().add_counter("consolidated_frag_meta_cache_hit", 1);
+      return {cached.tile_, *cached.offsets_};
+    }
+
+    // Allocate the tile through the cache's memory tracker, so that the
+    // entry can outlive the array open that inserted it.
+    memory_tracker = cache.memory_tracker();
+  }
+
   auto tile = GenericTileIO::load(resources, uri, 0, enc_key, memory_tracker);
 
   resources.stats().add_counter("consolidated_frag_meta_size", tile->size());
@@ -995,9 +1110,73 @@ load_consolidated_fragment_meta(
     ret.emplace_back(name, offset);
   }
 
+  if (cache.enabled()) {
+    cache.insert(uri.to_string(), tile, ret);
+  }
+
   return {tile, std::move(ret)};
 }
 
+/**
+ * A compact per-fragment summary stored in consolidated fragment metadata.
+ */
+struct FragmentSummary {
+  std::pair<uint64_t, uint64_t> timestamp_range_;
+  uint64_t cell_num_;
+  uint64_t fragment_size_;
+  bool sparse_;
+  std::string array_schema_name_;
+  NDRange non_empty_domain_;
+};
+
+std::vector<FragmentSummary> load_consolidated_fragment_summary(
+    const shared_ptr<Tile>& tile,
+    uint32_t fragment_num,
+    shared_ptr<Domain> domain) {
+  std::vector<FragmentSummary> ret;
+
+  // The summary is appended after the footers, with a trailer pointing
+  // back to it. Files written before the summary existed end with footer
+  // bytes instead of the trailer.
+  auto trailer_size = 2 * sizeof(uint64_t);
+  if (tile->size() < trailer_size)
+    return ret;
+  auto tile_data = static_cast<const uint8_t*>(tile->data());
+  Deserializer trailer(
+      tile_data + tile->size() - trailer_size, trailer_size);
+  auto summary_offset = trailer.read<uint64_t>();
+  auto magic = trailer.read<uint64_t>();
+  if (magic != constants::consolidated_fragment_summary_magic ||
+      summary_offset >= tile->size() - trailer_size)
+    return ret;
+
+  Deserializer deserializer(
+      tile_data + summary_offset,
+      tile->size() - trailer_size - summary_offset);
+  auto version = deserializer.read<uint32_t>();
+  if (version != constants::consolidated_fragment_summary_version)
+    return ret;
+
+  ret.resize(fragment_num);
+  for (auto& summary : ret) {
+    summary.timestamp_range_.first = deserializer.read<uint64_t>();
+    summary.timestamp_range_.second = deserializer.read<uint64_t>();
+    summary.cell_num_ = deserializer.read<uint64_t>();
+    summary.fragment_size_ = deserializer.read<uint64_t>();
+    summary.sparse_ = deserializer.read<uint8_t>() != 0;
+    auto name_size = deserializer.read<uint64_t>();
+    summary.array_schema_name_.resize(name_size);
+    deserializer.read(summary.array_schema_name_.data(), name_size);
+    auto null_non_empty_domain = deserializer.read<uint8_t>();
+    if (null_non_empty_domain == 0) {
+      summary.non_empty_domain_ =
+          NDRectangle::deserialize_ndranges(deserializer, domain);
+    }
+  }
+
+  return ret;
+}
+
 std::tuple<
     shared_ptr<ArraySchema>,
     std::unordered_map<std::string, shared_ptr<ArraySchema>>,
@@ -1010,35 +1189,44 @@ FragmentInfo::load_array_schemas_and_fragment_metadata(
   auto timer_se = resources.stats().start_timer(
       "sm_load_array_schemas_and_fragment_metadata");
 
-  // Load array schemas
   auto tracker = resources.ephemeral_memory_tracker();
   std::shared_ptr<ArraySchema> array_schema_latest;
   std::unordered_map<std::string, std::shared_ptr<ArraySchema>>
       array_schemas_all;
-  std::tie(array_schema_latest, array_schemas_all) =
-      array_dir.load_array_schemas(enc_key, tracker);
+  const auto& meta_uris = array_dir.fragment_meta_uris();
+
+  // Load the array schemas and the consolidated fragment metadata
+  // concurrently. Both depend only on the directory listing, so issuing
+  // them as one parallel I/O plan saves a round of storage latency on
+  // every array open; the name-to-offset tables do not need the schemas.
+  std::vector<ThreadPool::Task> tasks;
+  tasks.emplace_back(resources.compute_tp().execute([&]() {
+    std::tie(array_schema_latest, array_schemas_all) =
+        array_dir.load_array_schemas(enc_key, tracker);
+    return Status::Ok();
+  }));
+
+  std::vector<shared_ptr<Tile>> fragment_metadata_tiles(meta_uris.size());
+  std::vector<std::vector<std::pair<std::string, uint64_t>>> offsets_vectors(
+      meta_uris.size());
+  for (size_t i = 0; i < meta_uris.size(); i++) {
+    tasks.emplace_back(resources.compute_tp().execute([&, i]() {
+      auto&& [tile_opt, offsets] = load_consolidated_fragment_meta(
+          resources, meta_uris[i], enc_key, memory_tracker);
+      fragment_metadata_tiles[i] = tile_opt;
+      offsets_vectors[i] = std::move(offsets);
+      return Status::Ok();
+    }));
+  }
+  throw_if_not_ok(resources.compute_tp().wait_all(tasks));
 
   const auto filtered_fragment_uris = [&]() {
     auto timer_se =
         resources.stats().start_timer("sm_load_filtered_fragment_uris");
     return array_dir.filtered_fragment_uris(array_schema_latest->dense());
   }();
-  const auto& meta_uris = array_dir.fragment_meta_uris();
   const auto& fragments_to_load = filtered_fragment_uris.fragment_uris();
 
-  // Get the consolidated fragment metadatas
-  std::vector<shared_ptr<Tile>> fragment_metadata_tiles(meta_uris.size());
-  std::vector<std::vector<std::pair<std::string, uint64_t>>> offsets_vectors(
-      meta_uris.size());
-  throw_if_not_ok(
-      parallel_for(&resources.compute_tp(), 0, meta_uris.size(), [&](size_t i) {
-        auto&& [tile_opt, offsets] = load_consolidated_fragment_meta(
-            resources, meta_uris[i], enc_key, memory_tracker);
-        fragment_metadata_tiles[i] = tile_opt;
-        offsets_vectors[i] = std::move(offsets);
-        return Status::Ok();
-      }));
-
   // Get the unique fragment metadatas into a map.
   std::unordered_map<std::string, std::pair<Tile*, uint64_t>> offsets;
   for (uint64_t i = 0; i < offsets_vectors.size(); i++) {
@@ -1064,12 +1252,133 @@ FragmentInfo::load_array_schemas_and_fragment_metadata(
   return {array_schema_latest, array_schemas_all, fragment_metadata};
 }
 
+bool FragmentInfo::load_from_summary(const ArrayDirectory& array_dir) {
+  auto timer_se =
+      resources_->stats().start_timer("sm_fragment_info_load_from_summary");
+
+  auto tracker = resources_->ephemeral_memory_tracker();
+  const auto& meta_uris = array_dir.fragment_meta_uris();
+
+  // Load the array schemas and the consolidated fragment metadata
+  // concurrently, as in `load_array_schemas_and_fragment_metadata`.
+  auto memory_tracker = resources_->create_memory_tracker();
+  std::vector<ThreadPool::Task> tasks;
+  tasks.emplace_back(resources_->compute_tp().execute([&]() {
+    std::tie(array_schema_latest_, array_schemas_all_) =
+        array_dir.load_array_schemas(enc_key_, tracker);
+    return Status::Ok();
+  }));
+
+  std::vector<shared_ptr<Tile>> fragment_metadata_tiles(meta_uris.size());
+  std::vector<std::vector<std::pair<std::string, uint64_t>>> offsets_vectors(
+      meta_uris.size());
+  for (size_t i = 0; i < meta_uris.size(); i++) {
+    tasks.emplace_back(resources_->compute_tp().execute([&, i]() {
+      auto&& [tile, offsets] = load_consolidated_fragment_meta(
+          *resources_, meta_uris[i], enc_key_, memory_tracker);
+      fragment_metadata_tiles[i] = tile;
+      offsets_vectors[i] = std::move(offsets);
+      return Status::Ok();
+    }));
+  }
+  throw_if_not_ok(resources_->compute_tp().wait_all(tasks));
+
+  const auto filtered_fragment_uris =
+      array_dir.filtered_fragment_uris(array_schema_latest_->dense());
+  const auto& fragments_to_load = filtered_fragment_uris.fragment_uris();
+
+  // Parse the summaries; unlike the offset tables, they need the domain
+  // from the schema to deserialize the non-empty domains.
+  auto domain = array_schema_latest_->shared_domain();
+  std::vector<std::vector<FragmentSummary>> summary_vectors(meta_uris.size());
+  throw_if_not_ok(parallel_for(
+      &resources_->compute_tp(), 0, meta_uris.size(), [&](size_t i) {
+        summary_vectors[i] = load_consolidated_fragment_summary(
+            fragment_metadata_tiles[i],
+            (uint32_t)offsets_vectors[i].size(),
+            domain);
+        return Status::Ok();
+      }));
+
+  // Map each summarized fragment to its summary. As for the footer
+  // offsets, the first summary encountered for a fragment wins.
+  std::unordered_map<std::string, const FragmentSummary*> summaries;
+  for (uint64_t i = 0; i < summary_vectors.size(); i++) {
+    if (summary_vectors[i].empty())
+      continue;
+    for (uint64_t j = 0; j < offsets_vectors[i].size(); j++) {
+      summaries.emplace(offsets_vectors[i][j].first, &summary_vectors[i][j]);
+    }
+  }
+
+  // The summaries can serve the fragment info only if they cover every
+  // fragment to load; fragments written after the last metadata
+  // consolidation require their footers.
+  auto summary_key = [](const TimestampedURI& sf) {
+    FragmentID fragment_id{sf.uri_};
+    return fragment_id.array_format_version() >= 9 ?
+               fragment_id.name() :
+               sf.uri_.to_string();
+  };
+  for (const auto& sf : fragments_to_load) {
+    if (summaries.count(summary_key(sf)) == 0)
+      return false;
+  }
+
+  // Clear single fragment info vec and anterior range
+  single_fragment_info_vec_.clear();
+  anterior_ndrange_.clear();
+
+  // Create the vector that will store the SingleFragmentInfo objects.
+  // Note that the domain cannot change through schema evolution, so the
+  // latest schema can expand the non-empty domains of all fragments.
+  for (const auto& sf : fragments_to_load) {
+    const auto* summary = summaries[summary_key(sf)];
+    const auto& non_empty_domain = summary->non_empty_domain_;
+
+    if (summary->timestamp_range_.first < timestamp_start_) {
+      expand_anterior_ndrange(array_schema_latest_->domain(), non_empty_domain);
+    } else if (summary->timestamp_range_.second <= timestamp_end_) {
+      // compute expanded non-empty domain (only for dense fragments)
+      auto expanded_non_empty_domain = non_empty_domain;
+      if (!summary->sparse_) {
+        array_schema_latest_->domain().expand_to_tiles(
+            &expanded_non_empty_domain);
+      }
+
+      // Push new fragment info
+      FragmentID fragment_id{sf.uri_};
+      single_fragment_info_vec_.emplace_back(SingleFragmentInfo(
+          sf.uri_,
+          summary->sparse_,
+          summary->timestamp_range_,
+          summary->cell_num_,
+          summary->fragment_size_,
+          fragment_id.array_format_version(),
+          summary->array_schema_name_,
+          non_empty_domain,
+          expanded_non_empty_domain));
+    }
+  }
+
+  // Get the URIs to vacuum
+  to_vacuum_ = array_dir.filtered_fragment_uris(true).fragment_uris_to_vacuum();
+
+  // All summarized fragments have consolidated footers by construction
+  unconsolidated_metadata_num_ = 0;
+
+  loaded_ = true;
+  return true;
+}
+
 const std::vector<SingleFragmentInfo>& FragmentInfo::single_fragment_info_vec()
     const {
+  ensure_details_loaded();
   return single_fragment_info_vec_;
 }
 
 const NDRange& FragmentInfo::anterior_ndrange() const {
+  ensure_details_loaded();
   return anterior_ndrange_;
 }
 
@@ -1078,6 +1387,7 @@ uint32_t FragmentInfo::to_vacuum_num() const {
 }
 
 uint32_t FragmentInfo::unconsolidated_metadata_num() const {
+  ensure_details_loaded();
   return unconsolidated_metadata_num_;
 }
 
@@ -439,6 +439,18 @@ class FragmentInfo {
   /** Whether the fragment info have been loaded. */
   bool loaded_ = false;
 
+  /** The array directory retained for a deferred detail load. */
+  mutable optional<ArrayDirectory> lazy_array_dir_;
+
+  /**
+   * The fragments in the timestamp range, used to serve counts, URIs and
+   * timestamp ranges while the per-fragment details are deferred.
+   */
+  mutable std::vector<TimestampedURI> lazy_fragments_;
+
+  /** Whether the per-fragment details have been loaded. */
+  mutable bool details_loaded_ = true;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -456,11 +468,45 @@ class FragmentInfo {
    */
   Status load(const ArrayDirectory& array_directory);
 
+  /**
+   * Attempts to load the fragment info from the compact summaries in the
+   * consolidated fragment metadata, without loading any per-fragment
+   * metadata. Returns `false` if some fragment to load is not covered by
+   * a summary, in which case the caller must fall back to a full load.
+   */
+  bool load_from_summary(const ArrayDirectory& array_directory);
+
+  /**
+   * Loads only the array schemas and the fragment listing, deferring the
+   * per-fragment metadata until `ensure_details_loaded` materializes it.
+   * Fragment counts, URIs and timestamp ranges are served from the
+   * listing alone.
+   */
+  Status load_index(const ArrayDirectory& array_directory);
+
+  /**
+   * Loads the per-fragment metadata and builds the fragment info from it.
+   *
+   * @param array_directory The array directory to load the fragments.
+   * @param preload_rtrees If `true`, the R-trees of sparse fragments are
+   *     loaded along with the rest of the metadata.
+   */
+  Status load_details(
+      const ArrayDirectory& array_directory, bool preload_rtrees);
+
   /**
    * Throws if the info have not been loaded.
    */
   void ensure_loaded() const;
 
+  /**
+   * Throws if the info have not been loaded, and materializes any details
+   * deferred by a lazy load. All deferred fragments are loaded in one
+   * parallel batch, so the first accessor that needs details pays the
+   * cost of an eager load once instead of one serial load per fragment.
+   */
+  void ensure_details_loaded() const;
+
   /**
    * Loads the fragment metadata of the input URI and returns a
    * SingleFragmentInfo object that wraps it.
@@ -60,6 +60,7 @@
 #include "tiledb/type/range/range.h"
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -753,6 +754,10 @@ std::vector<shared_ptr<FragmentMetadata>> FragmentMetadata::load(
         offsets) {
   auto timer_se = resources.stats().start_timer("sm_load_fragment_metadata");
 
+  // Fragment metadata loads gate array opens; schedule them on the
+  // interactive lane so they are not queued behind bulk query tasks.
+  ThreadPool::PriorityScope priority_scope(ThreadPool::Priority::INTERACTIVE);
+
   // Load the metadata for each fragment
   auto fragment_num = fragments_to_load.size();
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata;
@@ -925,6 +930,9 @@ void FragmentMetadata::store_v7_v10(const EncryptionKey& encryption_key) {
     offset += nbytes;
   }
 
+  // Write the buffered generic tiles with a single VFS write
+  flush_buffered_tiles();
+
   // Store footer
   store_footer(encryption_key);
 
@@ -1007,6 +1015,9 @@ void FragmentMetadata::store_v11(const EncryptionKey& encryption_key) {
     offset += nbytes;
   }
 
+  // Write the buffered generic tiles with a single VFS write
+  flush_buffered_tiles();
+
   // Store footer
   store_footer(encryption_key);
 
@@ -1094,6 +1105,9 @@ void FragmentMetadata::store_v12_v14(const EncryptionKey& encryption_key) {
   store_fragment_min_max_sum_null_count(num, encryption_key, &nbytes);
   offset += nbytes;
 
+  // Write the buffered generic tiles with a single VFS write
+  flush_buffered_tiles();
+
   // Store footer
   store_footer(encryption_key);
 
@@ -1187,6 +1201,9 @@ void FragmentMetadata::store_v15_or_higher(
   store_processed_conditions(encryption_key, &nbytes);
   offset += nbytes;
 
+  // Write the buffered generic tiles with a single VFS write
+  flush_buffered_tiles();
+
   // Store footer
   store_footer(encryption_key);
 
@@ -1557,6 +1574,31 @@ std::string_view FragmentMetadata::get_tile_max_as<std::string_view>(
   }
 }
 
+const void* FragmentMetadata::tile_constant_value(
+    const std::string& name, uint64_t tile_idx) const {
+  // Only sparse fragments store MBRs; dense fragments never read dimension
+  // tiles in the first place.
+  if (dense_ || !array_schema_->is_dim(name) ||
+      array_schema_->var_size(name)) {
+    return nullptr;
+  }
+
+  // The MBRs may not be resident, e.g. before the R-tree is loaded or after
+  // it has been evicted.
+  if (!loaded_metadata_ptr_->loaded_metadata().rtree_) {
+    return nullptr;
+  }
+
+  const auto dim_idx = array_schema_->domain().get_dimension_index(name);
+  const auto& range = mbr(tile_idx)[dim_idx];
+  const auto cell_size = array_schema_->cell_size(name);
+  if (std::memcmp(range.start_fixed(), range.end_fixed(), cell_size) != 0) {
+    return nullptr;
+  }
+
+  return range.start_fixed();
+}
+
 TileMetadata FragmentMetadata::get_tile_metadata(
     const std::string& name, const uint64_t tile_idx) const {
   auto var_size = array_schema_->var_size(name);
@@ -2077,7 +2119,7 @@ void FragmentMetadata::load_mbrs(Deserializer& deserializer) {
 
   // Build R-tree bottom-up
   if (mbr_num > 0) {
-    loaded_metadata_ptr_->rtree().build_tree();
+    loaded_metadata_ptr_->rtree().build_tree(&resources_->compute_tp());
   }
 
   sparse_tile_num_ = mbr_num;
@@ -2683,7 +2725,7 @@ void FragmentMetadata::store_rtree(
 }
 
 shared_ptr<WriterTile> FragmentMetadata::write_rtree() {
-  loaded_metadata_ptr_->rtree().build_tree();
+  loaded_metadata_ptr_->rtree().build_tree(&resources_->compute_tp());
   SizeComputationSerializer size_computation_serializer;
   loaded_metadata_ptr_->rtree().serialize(size_computation_serializer);
 
@@ -2771,12 +2813,21 @@ void FragmentMetadata::read_file_footer(
 void FragmentMetadata::write_generic_tile_to_file(
     const EncryptionKey& encryption_key,
     shared_ptr<WriterTile> tile,
-    uint64_t* nbytes) const {
+    uint64_t* nbytes) {
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
   GenericTileIO tile_io(*resources_, fragment_metadata_uri);
-  tile_io.write_generic(tile, encryption_key, nbytes);
+  tile_io.write_generic(tile, encryption_key, nbytes, buffered_tiles_);
+}
+
+void FragmentMetadata::flush_buffered_tiles() {
+  URI fragment_metadata_uri = fragment_uri_.join_path(
+      std::string(constants::fragment_metadata_filename));
+
+  GenericTileIO::flush_buffer_list(
+      *resources_, fragment_metadata_uri, buffered_tiles_);
+  buffered_tiles_ = BufferList();
 }
 
 void FragmentMetadata::write_footer_to_file(shared_ptr<WriterTile> tile) const {
@@ -3564,6 +3615,8 @@ template double FragmentMetadata::get_tile_min_as<double>(
     const std::string& name, uint64_t tile_idx) const;
 template std::byte FragmentMetadata::get_tile_min_as<std::byte>(
     const std::string& name, uint64_t tile_idx) const;
+template const void* FragmentMetadata::get_tile_min_as<const void*>(
+    const std::string& name, uint64_t tile_idx) const;
 template int8_t FragmentMetadata::get_tile_max_as<int8_t>(
     const std::string& name, uint64_t tile_idx) const;
 template uint8_t FragmentMetadata::get_tile_max_as<uint8_t>(
@@ -3588,5 +3641,7 @@ template std::byte FragmentMetadata::get_tile_max_as<std::byte>(
     const std::string& name, uint64_t tile_idx) const;
 template char FragmentMetadata::get_tile_max_as<char>(
     const std::string& name, uint64_t tile_idx) const;
+template const void* FragmentMetadata::get_tile_max_as<const void*>(
+    const std::string& name, uint64_t tile_idx) const;
 
 }  // namespace tiledb::sm
@@ -42,6 +42,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/pmr.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/filesystem/uri.h"
 #include "tiledb/sm/fragment/loaded_fragment_metadata.h"
 #include "tiledb/sm/misc/types.h"
@@ -684,6 +685,20 @@ class FragmentMetadata {
   template <typename T>
   T get_tile_max_as(const std::string& name, uint64_t tile_idx) const;
 
+  /**
+   * Returns a pointer to the value every cell of a tile holds for a
+   * fixed-size dimension, or `nullptr` if the tile is not known to be
+   * constant. A tile is constant in a dimension when the tile MBR starts
+   * and ends on the same value for that dimension. Returns `nullptr` when
+   * the R-tree is not resident.
+   *
+   * @param name The input dimension.
+   * @param tile_idx The index of the tile in the metadata.
+   * @return Pointer to the constant cell value, or `nullptr`.
+   */
+  const void* tile_constant_value(
+      const std::string& name, uint64_t tile_idx) const;
+
   /**
    * Returns the tile metadata for a tile.
    *
@@ -903,6 +918,12 @@ class FragmentMetadata {
   /** The size of the fragment metadata file. */
   uint64_t meta_file_size_;
 
+  /**
+   * Generic tiles buffered by `write_generic_tile_to_file`, written to the
+   * metadata file with a single VFS write by `flush_buffered_tiles`.
+   */
+  BufferList buffered_tiles_;
+
   /** Local mutex for thread-safety. */
   std::mutex mtx_;
 
@@ -1405,17 +1426,26 @@ class FragmentMetadata {
       uint64_t* footer_size) const;
 
   /**
-   * Writes the contents of the input tile as a separate
-   * generic tile to the metadata file.
+   * Buffers the contents of the input tile as a separate generic tile
+   * destined for the metadata file. The tile is not written until
+   * `flush_buffered_tiles` is called.
    *
    * @param encryption_key The encryption key.
    * @param tile The tile whose contents the function will write.
-   * @param nbytes The total number of bytes written to the file.
+   * @param nbytes The total number of bytes the tile occupies in the file.
    */
   void write_generic_tile_to_file(
       const EncryptionKey& encryption_key,
       shared_ptr<WriterTile> tile,
-      uint64_t* nbytes) const;
+      uint64_t* nbytes);
+
+  /**
+   * Writes all generic tiles buffered by `write_generic_tile_to_file` to the
+   * metadata file with a single VFS write. Batching the many small generic
+   * tiles of a fragment into one write keeps the per-object request count
+   * low on remote storage backends.
+   */
+  void flush_buffered_tiles();
 
   /**
    * Writes the contents of the input buffer at the end of the fragment
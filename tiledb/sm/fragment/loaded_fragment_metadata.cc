@@ -33,6 +33,8 @@
 #include "tiledb/common/common.h"
 
 #include "tiledb/common/memory_tracker.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/fragment/ondemand_fragment_metadata.h"
 #include "tiledb/sm/fragment/v1v2preloaded_fragment_metadata.h"
@@ -43,6 +45,82 @@ using namespace tiledb::type;
 
 namespace tiledb::sm {
 
+/**
+ * Registry of the loaded fragment metadata charged to each memory tracker.
+ *
+ * The memory tracker is shared by all fragments of an open array, so the
+ * entries under one tracker are exactly the candidates for LRU eviction
+ * when that array's metadata budget is exceeded.
+ */
+static std::mutex registry_mtx;
+static std::unordered_map<
+    const MemoryTracker*,
+    std::vector<LoadedFragmentMetadata*>>
+    registry;
+
+/* ********************************* */
+/*           PACKED OFFSETS          */
+/* ********************************* */
+
+void PackedOffsets::pack(const uint64_t* values, uint64_t num) {
+  clear();
+  size_ = num;
+
+  const uint64_t page_num = (num + page_size_ - 1) / page_size_;
+  page_bases_.reserve(page_num);
+  page_word_offsets_.reserve(page_num);
+  page_widths_.reserve(page_num);
+
+  for (uint64_t p = 0; p < page_num; p++) {
+    const uint64_t start = p * page_size_;
+    const uint64_t end = std::min(start + page_size_, num);
+
+    // Compute the page base and the smallest bit width that fits the
+    // largest delta from the base.
+    uint64_t min_v = values[start];
+    uint64_t max_v = values[start];
+    for (uint64_t i = start + 1; i < end; i++) {
+      min_v = std::min(min_v, values[i]);
+      max_v = std::max(max_v, values[i]);
+    }
+    uint64_t width = 0;
+    for (auto range = max_v - min_v; range != 0; range >>= 1) {
+      width++;
+    }
+
+    page_bases_.push_back(min_v);
+    page_word_offsets_.push_back(words_.size());
+    page_widths_.push_back(static_cast<uint8_t>(width));
+    if (width == 0) {
+      continue;
+    }
+
+    // Bit-pack the deltas.
+    const auto word_start = words_.size();
+    words_.resize(word_start + ((end - start) * width + 63) / 64, 0);
+    for (uint64_t i = start; i < end; i++) {
+      const uint64_t delta = values[i] - min_v;
+      const uint64_t bit = (i - start) * width;
+      const auto word = word_start + bit / 64;
+      const auto shift = bit % 64;
+      words_[word] |= delta << shift;
+      if (shift + width > 64) {
+        words_[word + 1] |= delta >> (64 - shift);
+      }
+    }
+  }
+
+  words_.shrink_to_fit();
+}
+
+void PackedOffsets::clear() {
+  page_bases_ = {};
+  page_word_offsets_ = {};
+  page_widths_ = {};
+  words_ = {};
+  size_ = 0;
+}
+
 /* ********************************* */
 /*     CONSTRUCTORS & DESTRUCTORS    */
 /* ********************************* */
@@ -69,6 +147,19 @@ LoadedFragmentMetadata::LoadedFragmentMetadata(
     , tile_sums_(memory_tracker_->get_resource(MemoryType::TILE_SUMS))
     , tile_null_counts_(
           memory_tracker_->get_resource(MemoryType::TILE_NULL_COUNTS)) {
+  std::lock_guard<std::mutex> lg(registry_mtx);
+  registry[memory_tracker_.get()].emplace_back(this);
+}
+
+LoadedFragmentMetadata::~LoadedFragmentMetadata() {
+  std::lock_guard<std::mutex> lg(registry_mtx);
+  auto it = registry.find(memory_tracker_.get());
+  if (it != registry.end()) {
+    std::erase(it->second, this);
+    if (it->second.empty()) {
+      registry.erase(it);
+    }
+  }
 }
 
 /* ********************************* */
@@ -100,13 +191,15 @@ uint64_t LoadedFragmentMetadata::persisted_tile_size(
 
   auto tile_size =
       (tile_idx != tile_num - 1) ?
-          tile_offsets_[idx][tile_idx + 1] - tile_offsets_[idx][tile_idx] :
-          parent_fragment_.file_sizes_[idx] - tile_offsets_[idx][tile_idx];
+          tile_offset_value(idx, tile_idx + 1) -
+              tile_offset_value(idx, tile_idx) :
+          parent_fragment_.file_sizes_[idx] - tile_offset_value(idx, tile_idx);
   return tile_size;
 }
 
 void LoadedFragmentMetadata::load_tile_offsets(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  touch();
   sort_names_by_index(names);
 
   // The fixed offsets are located before the
@@ -138,8 +231,15 @@ void LoadedFragmentMetadata::free_tile_offsets() {
     if (memory_tracker_ != nullptr) {
       memory_tracker_->release_memory(
           tile_offsets_[i].size() * sizeof(uint64_t), MemoryType::TILE_OFFSETS);
+      if (i < packed_tile_offsets_.size()) {
+        memory_tracker_->release_memory(
+            packed_tile_offsets_[i].memory_size(), MemoryType::TILE_OFFSETS);
+      }
     }
     tile_offsets_[i].clear();
+    if (i < packed_tile_offsets_.size()) {
+      packed_tile_offsets_[i].clear();
+    }
     loaded_metadata_.tile_offsets_[i] = false;
   }
 
@@ -149,8 +249,16 @@ void LoadedFragmentMetadata::free_tile_offsets() {
       memory_tracker_->release_memory(
           tile_var_offsets_[i].size() * sizeof(uint64_t),
           MemoryType::TILE_OFFSETS);
+      if (i < packed_tile_var_offsets_.size()) {
+        memory_tracker_->release_memory(
+            packed_tile_var_offsets_[i].memory_size(),
+            MemoryType::TILE_OFFSETS);
+      }
     }
     tile_var_offsets_[i].clear();
+    if (i < packed_tile_var_offsets_.size()) {
+      packed_tile_var_offsets_[i].clear();
+    }
     loaded_metadata_.tile_var_offsets_[i] = false;
   }
 
@@ -170,8 +278,16 @@ void LoadedFragmentMetadata::free_tile_offsets() {
       memory_tracker_->release_memory(
           tile_validity_offsets_[i].size() * sizeof(uint64_t),
           MemoryType::TILE_OFFSETS);
+      if (i < packed_tile_validity_offsets_.size()) {
+        memory_tracker_->release_memory(
+            packed_tile_validity_offsets_[i].memory_size(),
+            MemoryType::TILE_OFFSETS);
+      }
     }
     tile_validity_offsets_[i].clear();
+    if (i < packed_tile_validity_offsets_.size()) {
+      packed_tile_validity_offsets_[i].clear();
+    }
     loaded_metadata_.tile_validity_offsets_[i] = false;
   }
 
@@ -197,24 +313,55 @@ uint64_t LoadedFragmentMetadata::file_offset(
         "Trying to access tile offsets metadata that's not loaded");
   }
 
+  return tile_offset_value(idx, tile_idx);
+}
+
+uint64_t LoadedFragmentMetadata::tile_offset_value(
+    unsigned idx, uint64_t tile_idx) const {
+  if (idx < packed_tile_offsets_.size() && !packed_tile_offsets_[idx].empty()) {
+    return packed_tile_offsets_[idx].get(tile_idx);
+  }
+
   return tile_offsets_[idx][tile_idx];
 }
 
+uint64_t LoadedFragmentMetadata::tile_var_offset_value(
+    unsigned idx, uint64_t tile_idx) const {
+  if (idx < packed_tile_var_offsets_.size() &&
+      !packed_tile_var_offsets_[idx].empty()) {
+    return packed_tile_var_offsets_[idx].get(tile_idx);
+  }
+
+  return tile_var_offsets_[idx][tile_idx];
+}
+
+uint64_t LoadedFragmentMetadata::tile_validity_offset_value(
+    unsigned idx, uint64_t tile_idx) const {
+  if (idx < packed_tile_validity_offsets_.size() &&
+      !packed_tile_validity_offsets_[idx].empty()) {
+    return packed_tile_validity_offsets_[idx].get(tile_idx);
+  }
+
+  return tile_validity_offsets_[idx][tile_idx];
+}
+
 void LoadedFragmentMetadata::resize_tile_offsets_vectors(uint64_t size) {
   tile_offsets_mtx_.resize(size);
   tile_offsets_.resize(size);
+  packed_tile_offsets_.resize(size);
 }
 
 void LoadedFragmentMetadata::resize_tile_var_offsets_vectors(uint64_t size) {
   tile_var_offsets_mtx_.resize(size);
   tile_var_offsets_.resize(size);
+  packed_tile_var_offsets_.resize(size);
 }
 
 void LoadedFragmentMetadata::resize_offsets(uint64_t size) {
   resize_tile_offsets_vectors(size);
   resize_tile_var_offsets_vectors(size);
   resize_tile_var_sizes_vectors(size);
-  tile_validity_offsets().resize(size);
+  resize_tile_validity_offsets_vectors(size);
   tile_min_buffer().resize(size);
   tile_min_var_buffer().resize(size);
   tile_max_buffer().resize(size);
@@ -245,7 +392,7 @@ uint64_t LoadedFragmentMetadata::file_var_offset(
         "Trying to access tile var offsets metadata that's not loaded");
   }
 
-  return tile_var_offsets_[idx][tile_idx];
+  return tile_var_offset_value(idx, tile_idx);
 }
 
 uint64_t LoadedFragmentMetadata::persisted_tile_var_size(
@@ -263,10 +410,10 @@ uint64_t LoadedFragmentMetadata::persisted_tile_var_size(
   auto tile_num = parent_fragment_.tile_num();
 
   auto tile_size = (tile_idx != tile_num - 1) ?
-                       tile_var_offsets_[idx][tile_idx + 1] -
-                           tile_var_offsets_[idx][tile_idx] :
+                       tile_var_offset_value(idx, tile_idx + 1) -
+                           tile_var_offset_value(idx, tile_idx) :
                        parent_fragment_.file_var_sizes_[idx] -
-                           tile_var_offsets_[idx][tile_idx];
+                           tile_var_offset_value(idx, tile_idx);
   return tile_size;
 }
 
@@ -285,6 +432,7 @@ uint64_t LoadedFragmentMetadata::tile_var_size(
 
 void LoadedFragmentMetadata::load_tile_var_sizes(
     const EncryptionKey& encryption_key, const std::string& name) {
+  touch();
   auto it = parent_fragment_.idx_map_.find(name);
   assert(it != parent_fragment_.idx_map_.end());
   auto idx = it->second;
@@ -492,6 +640,7 @@ const void* LoadedFragmentMetadata::get_tile_sum(
 void LoadedFragmentMetadata::resize_tile_validity_offsets_vectors(
     uint64_t size) {
   tile_validity_offsets().resize(size);
+  packed_tile_validity_offsets_.resize(size);
 }
 
 uint64_t LoadedFragmentMetadata::file_validity_offset(
@@ -504,7 +653,7 @@ uint64_t LoadedFragmentMetadata::file_validity_offset(
         "Trying to access tile validity offsets metadata that's not loaded");
   }
 
-  return tile_validity_offsets_[idx][tile_idx];
+  return tile_validity_offset_value(idx, tile_idx);
 }
 
 uint64_t LoadedFragmentMetadata::persisted_tile_validity_size(
@@ -521,13 +670,49 @@ uint64_t LoadedFragmentMetadata::persisted_tile_validity_size(
   auto tile_num = parent_fragment_.tile_num();
 
   auto tile_size = (tile_idx != tile_num - 1) ?
-                       tile_validity_offsets_[idx][tile_idx + 1] -
-                           tile_validity_offsets_[idx][tile_idx] :
+                       tile_validity_offset_value(idx, tile_idx + 1) -
+                           tile_validity_offset_value(idx, tile_idx) :
                        parent_fragment_.file_validity_sizes_[idx] -
-                           tile_validity_offsets_[idx][tile_idx];
+                           tile_validity_offset_value(idx, tile_idx);
   return tile_size;
 }
 
+void LoadedFragmentMetadata::get_tile_overlaps(
+    const std::vector<NDRange>& ranges,
+    std::vector<bool>& is_default,
+    const std::vector<TileOverlap*>& tile_overlaps) {
+  assert(ranges.size() == tile_overlaps.size());
+  touch();
+
+  // Resolve ranges that cover the whole non-empty domain directly and
+  // batch the rest into a single bulk R-tree traversal.
+  std::vector<const NDRange*> rtree_ranges;
+  std::vector<uint64_t> rtree_idx;
+  rtree_ranges.reserve(ranges.size());
+  rtree_idx.reserve(ranges.size());
+  auto tile_num = parent_fragment_.tile_num();
+  for (uint64_t r = 0; r < ranges.size(); ++r) {
+    if (range_covers_non_empty_domain(ranges[r], is_default)) {
+      *tile_overlaps[r] = TileOverlap();
+      if (tile_num > 0) {
+        tile_overlaps[r]->tile_ranges_.emplace_back(0, tile_num - 1);
+      }
+    } else {
+      rtree_ranges.emplace_back(&ranges[r]);
+      rtree_idx.emplace_back(r);
+    }
+  }
+
+  if (rtree_ranges.empty()) {
+    return;
+  }
+
+  auto overlaps = rtree_.get_tile_overlaps(rtree_ranges, is_default);
+  for (uint64_t i = 0; i < overlaps.size(); ++i) {
+    *tile_overlaps[rtree_idx[i]] = std::move(overlaps[i]);
+  }
+}
+
 // TODO: maybe remove, this is unused at the moment
 void LoadedFragmentMetadata::free_rtree() {
   auto freed = rtree_.free_memory();
@@ -537,8 +722,185 @@ void LoadedFragmentMetadata::free_rtree() {
   loaded_metadata_.rtree_ = false;
 }
 
+void LoadedFragmentMetadata::touch() {
+  static std::atomic<uint64_t> current_generation{0};
+  last_used_generation_.store(
+      current_generation.fetch_add(1, std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+}
+
+bool LoadedFragmentMetadata::evict_lru(
+    const MemoryTracker* tracker, const LoadedFragmentMetadata* requester) {
+  // The registry lock is held for the whole eviction so that no candidate
+  // is destroyed while being evicted. Eviction only runs when the budget
+  // is already exceeded, so the serialization is not a hot path concern.
+  std::lock_guard<std::mutex> lg(registry_mtx);
+  auto it = registry.find(tracker);
+  if (it == registry.end()) {
+    return false;
+  }
+
+  // Try the candidates from least to most recently used; a candidate may
+  // hold nothing evictable or be locked by a concurrent loader, in which
+  // case the next one is tried.
+  std::vector<LoadedFragmentMetadata*> candidates;
+  candidates.reserve(it->second.size());
+  for (auto* fragment : it->second) {
+    if (fragment != requester) {
+      candidates.emplace_back(fragment);
+    }
+  }
+  std::sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const LoadedFragmentMetadata* a, const LoadedFragmentMetadata* b) {
+        return a->last_used_generation() < b->last_used_generation();
+      });
+
+  for (auto* fragment : candidates) {
+    if (fragment->try_evict()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /* ********************************* */
 /*           PRIVATE METHODS         */
 /* ********************************* */
 
+bool LoadedFragmentMetadata::try_evict() {
+  // Queries access loaded metadata lock-free, so fragments pinned by an
+  // active query must never be evicted. A reader pins its fragments before
+  // issuing any load, and loads publish their data by releasing the mutexes
+  // below; re-checking the pin after acquiring each mutex therefore
+  // guarantees that anything a pinned query has observed as loaded is never
+  // freed here.
+  if (pinned()) {
+    return false;
+  }
+
+  bool evicted = false;
+
+  // The R-tree, validity offsets and var sizes are guarded by the parent
+  // fragment mutex; the fixed and var tile offsets by per-column mutexes.
+  // Every lock is taken with `try_to_lock` so that eviction never blocks
+  // on a concurrent load of this fragment's metadata.
+  {
+    std::unique_lock<std::mutex> lock(parent_fragment_.mtx_, std::try_to_lock);
+    if (lock.owns_lock() && !pinned()) {
+      if (loaded_metadata_.rtree_) {
+        free_rtree();
+        evicted = true;
+      }
+
+      for (uint64_t i = 0; i < tile_validity_offsets_.size(); i++) {
+        if (!loaded_metadata_.tile_validity_offsets_[i]) {
+          continue;
+        }
+        if (memory_tracker_ != nullptr) {
+          memory_tracker_->release_memory(
+              tile_validity_offsets_[i].size() * sizeof(uint64_t),
+              MemoryType::TILE_OFFSETS);
+          if (i < packed_tile_validity_offsets_.size()) {
+            memory_tracker_->release_memory(
+                packed_tile_validity_offsets_[i].memory_size(),
+                MemoryType::TILE_OFFSETS);
+          }
+        }
+        tile_validity_offsets_[i].clear();
+        if (i < packed_tile_validity_offsets_.size()) {
+          packed_tile_validity_offsets_[i].clear();
+        }
+        loaded_metadata_.tile_validity_offsets_[i] = false;
+        evicted = true;
+      }
+
+      for (uint64_t i = 0; i < tile_var_sizes_.size(); i++) {
+        if (!loaded_metadata_.tile_var_sizes_[i]) {
+          continue;
+        }
+        if (memory_tracker_ != nullptr) {
+          memory_tracker_->release_memory(
+              tile_var_sizes_[i].size() * sizeof(uint64_t),
+              MemoryType::TILE_OFFSETS);
+        }
+        tile_var_sizes_[i].clear();
+        loaded_metadata_.tile_var_sizes_[i] = false;
+        evicted = true;
+      }
+    }
+  }
+
+  for (uint64_t i = 0; i < tile_offsets_.size(); i++) {
+    std::unique_lock<std::mutex> lock(tile_offsets_mtx_[i], std::try_to_lock);
+    if (!lock.owns_lock() || pinned() || !loaded_metadata_.tile_offsets_[i]) {
+      continue;
+    }
+    if (memory_tracker_ != nullptr) {
+      memory_tracker_->release_memory(
+          tile_offsets_[i].size() * sizeof(uint64_t), MemoryType::TILE_OFFSETS);
+      if (i < packed_tile_offsets_.size()) {
+        memory_tracker_->release_memory(
+            packed_tile_offsets_[i].memory_size(), MemoryType::TILE_OFFSETS);
+      }
+    }
+    tile_offsets_[i].clear();
+    if (i < packed_tile_offsets_.size()) {
+      packed_tile_offsets_[i].clear();
+    }
+    loaded_metadata_.tile_offsets_[i] = false;
+    evicted = true;
+  }
+
+  for (uint64_t i = 0; i < tile_var_offsets_.size(); i++) {
+    std::unique_lock<std::mutex> lock(
+        tile_var_offsets_mtx_[i], std::try_to_lock);
+    if (!lock.owns_lock() || pinned() ||
+        !loaded_metadata_.tile_var_offsets_[i]) {
+      continue;
+    }
+    if (memory_tracker_ != nullptr) {
+      memory_tracker_->release_memory(
+          tile_var_offsets_[i].size() * sizeof(uint64_t),
+          MemoryType::TILE_OFFSETS);
+      if (i < packed_tile_var_offsets_.size()) {
+        memory_tracker_->release_memory(
+            packed_tile_var_offsets_[i].memory_size(),
+            MemoryType::TILE_OFFSETS);
+      }
+    }
+    tile_var_offsets_[i].clear();
+    if (i < packed_tile_var_offsets_.size()) {
+      packed_tile_var_offsets_[i].clear();
+    }
+    loaded_metadata_.tile_var_offsets_[i] = false;
+    evicted = true;
+  }
+
+  return evicted;
+}
+
+bool LoadedFragmentMetadata::range_covers_non_empty_domain(
+    const NDRange& range, const std::vector<bool>& is_default) const {
+  const auto& non_empty_domain = parent_fragment_.non_empty_domain();
+  if (non_empty_domain.empty()) {
+    return false;
+  }
+
+  auto& domain = parent_fragment_.array_schema()->domain();
+  for (unsigned d = 0; d < domain.dim_num(); ++d) {
+    if (is_default[d]) {
+      continue;
+    }
+
+    if (!domain.dimension_ptr(d)->covered(non_empty_domain[d], range[d])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace tiledb::sm
@@ -44,6 +44,96 @@ namespace sm {
 
 class FragmentMetadata;
 
+/**
+ * A compressed, random-access representation of a tile offset vector.
+ *
+ * The values are split into fixed-size pages. Each page stores the minimum
+ * value of the page as a 64-bit base and the remaining values bit-packed as
+ * deltas from that base, using the smallest bit width that fits the largest
+ * delta in the page. Since tile offsets grow by roughly the tile size from
+ * one tile to the next, the deltas within a page are small and the packed
+ * form is typically several times smaller than the raw `uint64_t` vector,
+ * while `get` remains O(1).
+ */
+class PackedOffsets {
+ public:
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Replaces the contents with the packed form of the input values.
+   *
+   * @param values The values to pack.
+   * @param num The number of values.
+   */
+  void pack(const uint64_t* values, uint64_t num);
+
+  /** Returns the value at the input index. */
+  inline uint64_t get(uint64_t idx) const {
+    const auto page = idx / page_size_;
+    const uint64_t width = page_widths_[page];
+    if (width == 0) {
+      return page_bases_[page];
+    }
+
+    const uint64_t bit = (idx % page_size_) * width;
+    const auto word = page_word_offsets_[page] + bit / 64;
+    const auto shift = bit % 64;
+    uint64_t delta = words_[word] >> shift;
+    if (shift + width > 64) {
+      delta |= words_[word + 1] << (64 - shift);
+    }
+    const uint64_t mask =
+        (width == 64) ? ~uint64_t(0) : ((uint64_t(1) << width) - 1);
+
+    return page_bases_[page] + (delta & mask);
+  }
+
+  /** Returns the number of packed values. */
+  inline uint64_t size() const {
+    return size_;
+  }
+
+  /** Returns `true` if no values are packed. */
+  inline bool empty() const {
+    return size_ == 0;
+  }
+
+  /** Frees the packed data. */
+  void clear();
+
+  /** Returns the memory used by the packed data, in bytes. */
+  inline uint64_t memory_size() const {
+    return (page_bases_.size() + page_word_offsets_.size() + words_.size()) *
+               sizeof(uint64_t) +
+           page_widths_.size();
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of values per page. */
+  static constexpr uint64_t page_size_ = 1024;
+
+  /** The minimum value of each page. */
+  std::vector<uint64_t> page_bases_;
+
+  /** The index into `words_` where each page starts. */
+  std::vector<uint64_t> page_word_offsets_;
+
+  /** The delta bit width of each page. */
+  std::vector<uint8_t> page_widths_;
+
+  /** The bit-packed deltas of all pages. */
+  std::vector<uint64_t> words_;
+
+  /** The number of packed values. */
+  uint64_t size_ = 0;
+};
+
 /** Collection of lazily loaded fragment metadata */
 class LoadedFragmentMetadata {
  public:
@@ -71,7 +161,7 @@ class LoadedFragmentMetadata {
   /* ********************************* */
 
   /* Destructor */
-  virtual ~LoadedFragmentMetadata() = default;
+  virtual ~LoadedFragmentMetadata();
 
   /**
    * Constructor.
@@ -483,6 +573,21 @@ class LoadedFragmentMetadata {
       std::vector<bool>& is_default,
       TileOverlap* tile_overlap) = 0;
 
+  /**
+   * Retrieves the overlap of all MBRs with a batch of input ND ranges,
+   * traversing the R-tree only once for the whole batch. Ranges that
+   * cover the whole non-empty domain are resolved without consulting
+   * the R-tree.
+   *
+   * @param ranges The ranges to use
+   * @param is_default If default range should be used
+   * @param tile_overlaps The resulting tile overlap per range
+   */
+  void get_tile_overlaps(
+      const std::vector<NDRange>& ranges,
+      std::vector<bool>& is_default,
+      const std::vector<TileOverlap*>& tile_overlaps);
+
   /**
    * Compute tile bitmap for the curent fragment/range/dimension.
    *
@@ -496,6 +601,57 @@ class LoadedFragmentMetadata {
   /** Frees the memory associated with the rtree. */
   void free_rtree();
 
+  /**
+   * Marks this fragment metadata as used by the current query.
+   *
+   * The stamp is taken from a process-wide monotonically increasing
+   * generation counter and orders the fragments of an open array for
+   * least-recently-used eviction under memory pressure.
+   */
+  void touch();
+
+  /** Returns the generation of the last query touch. */
+  inline uint64_t last_used_generation() const {
+    return last_used_generation_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Pins this fragment metadata, excluding it from eviction under memory
+   * pressure.
+   *
+   * Queries access loaded metadata lock-free, so every reader pins the
+   * metadata of all its fragments for the duration of the query. Eviction
+   * only ever frees metadata of unpinned (idle) fragments, and the next
+   * query to use them reloads it through the on-demand load functions.
+   */
+  inline void pin() {
+    pin_count_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  /** Unpins this fragment metadata, making it evictable again. */
+  inline void unpin() {
+    pin_count_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  /**
+   * Frees the tile offsets and R-tree of the least recently used idle
+   * fragment charged to the input memory tracker.
+   *
+   * Called when loading fragment metadata exceeds the memory budget of the
+   * array. Fragments pinned by an active query are never evicted, so only
+   * metadata no running query can access is freed; the next query to use
+   * it reloads it through the on-demand load functions, and exceeding the
+   * budget degrades to extra I/O instead of a hard error when idle
+   * metadata exists. Locks are only acquired opportunistically; fragments
+   * whose metadata is concurrently being loaded are skipped.
+   *
+   * @param tracker The memory tracker whose budget is under pressure.
+   * @param requester The fragment performing the load; never evicted.
+   * @return `true` if any metadata was freed.
+   */
+  static bool evict_lru(
+      const MemoryTracker* tracker, const LoadedFragmentMetadata* requester);
+
   /**
    * Sets loaded metadata, used in serialization
    *
@@ -633,6 +789,24 @@ class LoadedFragmentMetadata {
    */
   tdb::pmr::vector<tdb::pmr::vector<uint64_t>> tile_validity_offsets_;
 
+  /**
+   * The packed tile offsets, used in place of `tile_offsets_` when
+   * `sm.compress_tile_offsets` is enabled.
+   */
+  std::vector<PackedOffsets> packed_tile_offsets_;
+
+  /**
+   * The packed variable tile offsets, used in place of `tile_var_offsets_`
+   * when `sm.compress_tile_offsets` is enabled.
+   */
+  std::vector<PackedOffsets> packed_tile_var_offsets_;
+
+  /**
+   * The packed validity tile offsets, used in place of
+   * `tile_validity_offsets_` when `sm.compress_tile_offsets` is enabled.
+   */
+  std::vector<PackedOffsets> packed_tile_validity_offsets_;
+
   /**
    * The tile min buffers, for variable attributes/dimensions, this will store
    * offsets.
@@ -697,6 +871,12 @@ class LoadedFragmentMetadata {
   /** Keeps track of which metadata has been loaded. */
   LoadedMetadata loaded_metadata_;
 
+  /** The generation of the last query touch, for LRU eviction. */
+  std::atomic<uint64_t> last_used_generation_{0};
+
+  /** The number of active queries pinning this fragment metadata. */
+  std::atomic<uint64_t> pin_count_{0};
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -708,6 +888,66 @@ class LoadedFragmentMetadata {
    */
   void sort_names_by_index(std::vector<std::string>& names);
 
+  /** Returns `true` if this fragment metadata is pinned by a query. */
+  inline bool pinned() const {
+    return pin_count_.load(std::memory_order_acquire) != 0;
+  }
+
+  /**
+   * Opportunistically frees this fragment's R-tree and tile offsets.
+   *
+   * Pinned fragments are never evicted, and the pin is re-checked under
+   * every lock so that metadata loaded on behalf of a pinning query is
+   * never freed. Every lock is taken with `try_to_lock` so that eviction
+   * never blocks on, or deadlocks with, a concurrent load; entries whose
+   * lock is held are simply skipped.
+   *
+   * @return `true` if any metadata was freed.
+   */
+  bool try_evict();
+
+  /**
+   * Returns `true` if the input ND range fully covers the fragment's
+   * non-empty domain, in which case every tile in the fragment fully
+   * overlaps the range.
+   *
+   * @param range The range to check.
+   * @param is_default If default range should be used, per dimension.
+   * @return True if the range covers the whole non-empty domain.
+   */
+  bool range_covers_non_empty_domain(
+      const NDRange& range, const std::vector<bool>& is_default) const;
+
+  /**
+   * Returns the tile offset for the input column and tile index, reading
+   * from the packed representation when present.
+   *
+   * @param idx The column index.
+   * @param tile_idx The index of the tile in the metadata.
+   * @return The tile offset.
+   */
+  uint64_t tile_offset_value(unsigned idx, uint64_t tile_idx) const;
+
+  /**
+   * Returns the variable tile offset for the input column and tile index,
+   * reading from the packed representation when present.
+   *
+   * @param idx The column index.
+   * @param tile_idx The index of the tile in the metadata.
+   * @return The variable tile offset.
+   */
+  uint64_t tile_var_offset_value(unsigned idx, uint64_t tile_idx) const;
+
+  /**
+   * Returns the validity tile offset for the input column and tile index,
+   * reading from the packed representation when present.
+   *
+   * @param idx The column index.
+   * @param tile_idx The index of the tile in the metadata.
+   * @return The validity tile offset.
+   */
+  uint64_t tile_validity_offset_value(unsigned idx, uint64_t tile_idx) const;
+
   /**
    * Loads the tile offsets for the input attribute or dimension idx
    * from storage.
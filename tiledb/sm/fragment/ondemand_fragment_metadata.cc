@@ -58,6 +58,7 @@ OndemandFragmentMetadata::OndemandFragmentMetadata(
 /* ********************************* */
 
 void OndemandFragmentMetadata::load_rtree(const EncryptionKey& encryption_key) {
+  touch();
   std::lock_guard<std::mutex> lock(parent_fragment_.mtx_);
 
   if (loaded_metadata_.rtree_) {
@@ -70,8 +71,7 @@ void OndemandFragmentMetadata::load_rtree(const EncryptionKey& encryption_key) {
       "read_rtree_size", tile->size());
 
   // Use the serialized buffer size to approximate memory usage of the rtree.
-  if (memory_tracker_ != nullptr &&
-      !memory_tracker_->take_memory(tile->size(), MemoryType::RTREE)) {
+  if (!take_memory_with_eviction(tile->size(), MemoryType::RTREE)) {
     throw FragmentMetadataStatusException(
         "Cannot load R-tree; Insufficient memory budget; Needed " +
         std::to_string(tile->size()) + " but only had " +
@@ -140,6 +140,53 @@ void OndemandFragmentMetadata::load_processed_conditions(
 /*           PRIVATE METHODS         */
 /* ********************************* */
 
+bool OndemandFragmentMetadata::compress_offsets() const {
+  return parent_fragment_.resources_ != nullptr &&
+         parent_fragment_.resources_->config().get<bool>(
+             "sm.compress_tile_offsets", Config::must_find);
+}
+
+bool OndemandFragmentMetadata::take_memory_with_eviction(
+    uint64_t size, MemoryType mem_type) const {
+  if (memory_tracker_ == nullptr) {
+    return true;
+  }
+
+  if (memory_tracker_->take_memory(size, mem_type)) {
+    return true;
+  }
+
+  // Eviction relies on queries pinning their fragment metadata; only array
+  // read trackers have that protocol. Other consumers, such as fragment
+  // info loads, keep the hard error at budget.
+  if (memory_tracker_->get_type() != MemoryTrackerType::ARRAY_READ) {
+    return false;
+  }
+
+  // Under memory pressure, free the tile offsets and R-trees of the least
+  // recently used idle fragments of the array before failing; fragments
+  // pinned by an active query are never evicted, and the next query to use
+  // the evicted metadata reloads it through the on-demand load functions.
+  while (evict_lru(memory_tracker_.get(), this)) {
+    if (memory_tracker_->take_memory(size, mem_type)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void OndemandFragmentMetadata::take_packed_offsets_memory(
+    uint64_t size) const {
+  if (!take_memory_with_eviction(size, MemoryType::TILE_OFFSETS)) {
+    throw FragmentMetadataStatusException(
+        "Cannot load tile offsets; Insufficient memory budget; Needed " +
+        std::to_string(size) + " but only had " +
+        std::to_string(memory_tracker_->get_memory_available()) +
+        " from budget " + std::to_string(memory_tracker_->get_memory_budget()));
+  }
+}
+
 void OndemandFragmentMetadata::load_tile_offsets(
     const EncryptionKey& encryption_key, unsigned idx) {
   // If the tile offset is already loaded, exit early to avoid the lock
@@ -175,6 +222,16 @@ void OndemandFragmentMetadata::load_tile_offsets(
   if (tile_offsets_num != 0) {
     auto size = tile_offsets_num * sizeof(uint64_t);
 
+    if (compress_offsets()) {
+      // Bit-pack the offsets through a scratch buffer, so that the full
+      // uncompressed vector is never kept in memory.
+      std::vector<uint64_t> scratch(tile_offsets_num);
+      deserializer.read(scratch.data(), size);
+      packed_tile_offsets_[idx].pack(scratch.data(), tile_offsets_num);
+      take_packed_offsets_memory(packed_tile_offsets_[idx].memory_size());
+      return;
+    }
+
     // Get tile offsets
     tile_offsets_[idx].resize(tile_offsets_num);
     deserializer.read(&tile_offsets_[idx][0], size);
@@ -216,6 +273,16 @@ void OndemandFragmentMetadata::load_tile_var_offsets(
   if (tile_var_offsets_num != 0) {
     auto size = tile_var_offsets_num * sizeof(uint64_t);
 
+    if (compress_offsets()) {
+      // Bit-pack the offsets through a scratch buffer, so that the full
+      // uncompressed vector is never kept in memory.
+      std::vector<uint64_t> scratch(tile_var_offsets_num);
+      deserializer.read(scratch.data(), size);
+      packed_tile_var_offsets_[idx].pack(scratch.data(), tile_var_offsets_num);
+      take_packed_offsets_memory(packed_tile_var_offsets_[idx].memory_size());
+      return;
+    }
+
     // Get tile var offsets
     tile_var_offsets_[idx].resize(tile_var_offsets_num);
     deserializer.read(&tile_var_offsets_[idx][0], size);
@@ -296,6 +363,22 @@ void OndemandFragmentMetadata::load_tile_validity_offsets(
   if (tile_validity_offsets_num != 0) {
     auto size = tile_validity_offsets_num * sizeof(uint64_t);
 
+    if (compress_offsets()) {
+      // Bit-pack the offsets through a scratch buffer, so that the full
+      // uncompressed vector is never kept in memory.
+      std::vector<uint64_t> scratch(tile_validity_offsets_num);
+      if (!buff->read(scratch.data(), size).ok()) {
+        throw FragmentMetadataStatusException(
+            "Cannot load fragment metadata; Reading validity tile offsets "
+            "failed");
+      }
+      packed_tile_validity_offsets_[idx].pack(
+          scratch.data(), tile_validity_offsets_num);
+      take_packed_offsets_memory(
+          packed_tile_validity_offsets_[idx].memory_size());
+      return;
+    }
+
     // Get tile validity offsets
     tile_validity_offsets_[idx].resize(tile_validity_offsets_num);
     if (!buff->read(&tile_validity_offsets_[idx][0], size).ok()) {
@@ -330,8 +413,7 @@ void OndemandFragmentMetadata::load_tile_min_values(
   // Get tile mins
   if (buffer_size != 0) {
     auto size = buffer_size + var_buffer_size;
-    if (memory_tracker_ != nullptr &&
-        !memory_tracker_->take_memory(size, MemoryType::TILE_MIN_VALS)) {
+    if (!take_memory_with_eviction(size, MemoryType::TILE_MIN_VALS)) {
       throw FragmentMetadataStatusException(
           "Cannot load min values; Insufficient memory budget; Needed " +
           std::to_string(size) + " but only had " +
@@ -374,8 +456,7 @@ void OndemandFragmentMetadata::load_tile_max_values(
   // Get tile maxs
   if (buffer_size != 0) {
     auto size = buffer_size + var_buffer_size;
-    if (memory_tracker_ != nullptr &&
-        !memory_tracker_->take_memory(size, MemoryType::TILE_MAX_VALS)) {
+    if (!take_memory_with_eviction(size, MemoryType::TILE_MAX_VALS)) {
       throw FragmentMetadataStatusException(
           "Cannot load max values; Insufficient memory budget; Needed " +
           std::to_string(size) + " but only had " +
@@ -412,8 +493,7 @@ void OndemandFragmentMetadata::load_tile_sum_values(
   // Get tile sums
   if (tile_sum_num != 0) {
     auto size = tile_sum_num * sizeof(uint64_t);
-    if (memory_tracker_ != nullptr &&
-        !memory_tracker_->take_memory(size, MemoryType::TILE_SUMS)) {
+    if (!take_memory_with_eviction(size, MemoryType::TILE_SUMS)) {
       throw FragmentMetadataStatusException(
           "Cannot load sum values; Insufficient memory budget; Needed " +
           std::to_string(size) + " but only had " +
@@ -444,8 +524,7 @@ void OndemandFragmentMetadata::load_tile_null_count_values(
   // Get tile null count
   if (tile_null_count_num != 0) {
     auto size = tile_null_count_num * sizeof(uint64_t);
-    if (memory_tracker_ != nullptr &&
-        !memory_tracker_->take_memory(size, MemoryType::TILE_NULL_COUNTS)) {
+    if (!take_memory_with_eviction(size, MemoryType::TILE_NULL_COUNTS)) {
       throw FragmentMetadataStatusException(
           "Cannot load null count values; Insufficient memory budget; "
           "Needed " +
@@ -627,6 +706,17 @@ void OndemandFragmentMetadata::get_tile_overlap(
     const NDRange& range,
     std::vector<bool>& is_default,
     TileOverlap* tile_overlap) {
+  // If the range covers the whole non-empty domain, every tile fully
+  // overlaps the range and the R-tree does not need to be traversed.
+  if (range_covers_non_empty_domain(range, is_default)) {
+    *tile_overlap = TileOverlap();
+    auto tile_num = parent_fragment_.tile_num();
+    if (tile_num > 0) {
+      tile_overlap->tile_ranges_.emplace_back(0, tile_num - 1);
+    }
+    return;
+  }
+
   assert(loaded_metadata_.rtree_);
   *tile_overlap = rtree_.get_tile_overlap(range, is_default);
 }
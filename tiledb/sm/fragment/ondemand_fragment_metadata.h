@@ -114,6 +114,32 @@ class OndemandFragmentMetadata : public LoadedFragmentMetadata {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
+  /**
+   * Returns `true` if tile offsets should be stored in the packed
+   * in-memory representation, per `sm.compress_tile_offsets`.
+   */
+  bool compress_offsets() const;
+
+  /**
+   * Accounts for packed tile offsets memory with the memory tracker,
+   * throwing if the budget is exceeded.
+   *
+   * @param size The size of the packed data, in bytes.
+   */
+  void take_packed_offsets_memory(uint64_t size) const;
+
+  /**
+   * Takes memory from the budget, evicting the tile offsets and R-trees
+   * of the least recently used fragments of the array to make room when
+   * the budget is exceeded.
+   *
+   * @param size The memory size.
+   * @param mem_type The type of memory being taken.
+   * @return `true` if the memory was taken, `false` if the budget remains
+   * exceeded after evicting everything evictable.
+   */
+  bool take_memory_with_eviction(uint64_t size, MemoryType mem_type) const;
+
   /**
    * Loads the tile offsets for the input attribute or dimension idx
    * from storage.
@@ -87,6 +87,35 @@ class SingleFragmentInfo {
       , meta_(meta) {
   }
 
+  /**
+   * Constructor used when the fragment is described by a consolidated
+   * fragment metadata summary. No metadata object is attached; accessors
+   * that require one (e.g. `meta()`) are not usable on such an instance.
+   */
+  SingleFragmentInfo(
+      const URI& uri,
+      bool sparse,
+      const std::pair<uint64_t, uint64_t>& timestamp_range,
+      uint64_t cell_num,
+      uint64_t fragment_size,
+      format_version_t version,
+      const std::string& array_schema_name,
+      const NDRange& non_empty_domain,
+      const NDRange& expanded_non_empty_domain)
+      : uri_(uri)
+      , name_(uri.remove_trailing_slash().last_path_part())
+      , version_(version)
+      , sparse_(sparse)
+      , timestamp_range_(timestamp_range)
+      , cell_num_(cell_num)
+      , fragment_size_(fragment_size)
+      , has_consolidated_footer_(true)
+      , non_empty_domain_(non_empty_domain)
+      , expanded_non_empty_domain_(expanded_non_empty_domain)
+      , array_schema_name_(array_schema_name)
+      , meta_(nullptr) {
+  }
+
   /** Copy constructor. */
   SingleFragmentInfo(const SingleFragmentInfo& info)
       : SingleFragmentInfo() {
@@ -227,6 +227,17 @@ void V1V2PreloadedFragmentMetadata::get_tile_overlap(
     const NDRange& range,
     std::vector<bool>& is_default,
     TileOverlap* tile_overlap) {
+  // If the range covers the whole non-empty domain, every tile fully
+  // overlaps the range and the R-tree does not need to be traversed.
+  if (range_covers_non_empty_domain(range, is_default)) {
+    *tile_overlap = TileOverlap();
+    auto tile_num = parent_fragment_.tile_num();
+    if (tile_num > 0) {
+      tile_overlap->tile_ranges_.emplace_back(0, tile_num - 1);
+    }
+    return;
+  }
+
   *tile_overlap = rtree_.get_tile_overlap(range, is_default);
 }
 
@@ -93,4 +93,8 @@ std::set<StorageManager*> GlobalState::storage_managers() {
   return storage_managers_;
 }
 
+TransportPool& GlobalState::transport_pool() {
+  return transport_pool_;
+}
+
 }  // namespace tiledb::sm::global_state
@@ -38,6 +38,7 @@
 #include <string>
 
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/global_state/transport_pool.h"
 #include "tiledb/sm/storage_manager/storage_manager_declaration.h"
 
 using namespace tiledb::common;
@@ -86,6 +87,11 @@ class GlobalState {
    */
   std::set<StorageManager*> storage_managers();
 
+  /**
+   * Returns the process-wide pool of remote storage transport clients.
+   */
+  TransportPool& transport_pool();
+
  private:
   /** The TileDB configuration parameters. */
   Config config_;
@@ -102,6 +108,9 @@ class GlobalState {
   /** Mutex protecting list of StorageManagers. */
   std::mutex storage_managers_mtx_;
 
+  /** The process-wide pool of remote storage transport clients. */
+  TransportPool transport_pool_;
+
   /** Constructor. */
   GlobalState();
 };
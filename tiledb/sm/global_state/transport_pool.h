@@ -0,0 +1,108 @@
+/**
+ * @file   transport_pool.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the TransportPool class.
+ */
+
+#ifndef TILEDB_TRANSPORT_POOL_H
+#define TILEDB_TRANSPORT_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace tiledb {
+namespace sm {
+namespace global_state {
+
+/**
+ * Process-wide pool of remote storage transport clients, shared across
+ * Context instances.
+ *
+ * Each cloud SDK client owns its own connection pool, so a freshly created
+ * Context pays for TLS handshakes and client warm-up on its first request.
+ * Filesystem backends register their clients here, keyed by the
+ * connection-affecting configuration (endpoint, credentials, TLS settings),
+ * so that later Contexts with an identical configuration reuse the warm
+ * client instead of building a new one.
+ *
+ * Pooled clients must not reference state owned by the Context that created
+ * them, as they outlive it. Entries live for the remainder of the process.
+ */
+class TransportPool {
+ public:
+  /**
+   * Finds a pooled client.
+   *
+   * @tparam T The client type the key was registered with.
+   * @param key The connection configuration key.
+   * @return The pooled client, or nullptr if none is registered.
+   */
+  template <class T>
+  std::shared_ptr<T> find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = clients_.find(key);
+    if (it == clients_.end()) {
+      return nullptr;
+    }
+    return std::static_pointer_cast<T>(it->second);
+  }
+
+  /**
+   * Registers a client, if the key is not already registered. The key must
+   * encode the backend as well as the connection configuration so that the
+   * stored type is unambiguous.
+   *
+   * @tparam T The client type.
+   * @param key The connection configuration key.
+   * @param client The client to register.
+   * @return The registered client: `client`, or the already registered one
+   * if another thread raced this call.
+   */
+  template <class T>
+  std::shared_ptr<T> insert(const std::string& key, std::shared_ptr<T> client) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = clients_.emplace(key, std::static_pointer_cast<void>(client));
+    return std::static_pointer_cast<T>(it.first->second);
+  }
+
+ private:
+  /** Protects `clients_`. */
+  std::mutex mtx_;
+
+  /** The pooled clients, keyed by connection configuration. */
+  std::unordered_map<std::string, std::shared_ptr<void>> clients_;
+};
+
+}  // namespace global_state
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TRANSPORT_POOL_H
@@ -78,6 +78,7 @@ Group::Group(ContextResources& resources, const URI& group_uri)
     , timestamp_start_(0)
     , timestamp_end_(UINT64_MAX)
     , encryption_key_(tdb::make_shared<EncryptionKey>(HERE()))
+    , group_details_loaded_(false)
     , resources_(resources) {
   memory_tracker_->set_type(MemoryTrackerType::GROUP);
 }
@@ -195,6 +196,7 @@ void Group::open(
     group_details_ = tdb::make_shared<GroupDetailsV2>(HERE(), group_uri_);
 
     throw_if_not_ok(rest_client->post_group_from_rest(group_uri_, this));
+    group_details_loaded_ = true;
   } else if (query_type == QueryType::READ) {
     group_dir_ = make_shared<GroupDirectory>(
         HERE(),
@@ -694,6 +696,7 @@ const std::vector<shared_ptr<GroupMember>>& Group::members_to_modify() const {
 const std::unordered_map<std::string, shared_ptr<GroupMember>>& Group::members()
     const {
   std::lock_guard<std::mutex> lck(mtx_);
+  ensure_group_details_loaded();
   return group_details_->members();
 }
 
@@ -730,6 +733,9 @@ uint64_t Group::member_count() const {
         "Cannot get member; Group was not opened in read mode");
   }
 
+  // Load the group details, if not loaded yet
+  ensure_group_details_loaded();
+
   return group_details_->member_count();
 }
 
@@ -748,6 +754,9 @@ tuple<std::string, ObjectType, optional<std::string>> Group::member_by_index(
         "Cannot get member; Group was not opened in read mode");
   }
 
+  // Load the group details, if not loaded yet
+  ensure_group_details_loaded();
+
   return group_details_->member_by_index(index);
 }
 
@@ -766,6 +775,9 @@ Group::member_by_name(const std::string& name) {
         "Cannot get member; Group was not opened in read mode");
   }
 
+  // Load the group details, if not loaded yet
+  ensure_group_details_loaded();
+
   return group_details_->member_by_name(name);
 }
 
@@ -784,25 +796,59 @@ std::string Group::dump(
        << object_type_str(ObjectType::GROUP) << std::endl;
   }
 
-  for (const auto& member_entry : members()) {
-    const auto& it = member_entry.second;
-    ss << "|" << indent << l_indent << " " << *it;
-    if (it->type() == ObjectType::GROUP && recursive) {
+  // Open all subgroup members in parallel first, so that enumerating a
+  // large group issues the storage listings of its children concurrently
+  // instead of one by one.
+  std::unordered_map<std::string, shared_ptr<Group>> subgroups;
+  if (recursive) {
+    std::vector<std::pair<std::string, URI>> to_open;
+    for (const auto& member_entry : members()) {
+      const auto& it = member_entry.second;
+      if (it->type() != ObjectType::GROUP) {
+        continue;
+      }
+
       URI member_uri = it->uri();
       if (it->relative()) {
         member_uri = group_uri_.join_path(it->uri().to_string());
       }
+      to_open.emplace_back(member_entry.first, member_uri);
+    }
 
-      Group group_rec(resources_, member_uri);
-      try {
-        group_rec.open(QueryType::READ);
-        ss << std::endl;
-        ss << group_rec.dump(indent_size, num_indents + 2, recursive, false);
-        group_rec.close();
-      } catch (GroupNotFoundException&) {
-        // If the group no longer exists in storage it will be listed but we
-        // won't be able to dump its members
+    std::vector<shared_ptr<Group>> opened(to_open.size());
+    throw_if_not_ok(parallel_for(
+        &resources_.compute_tp(), 0, to_open.size(), [&](size_t i) {
+          auto subgroup =
+              tdb::make_shared<Group>(HERE(), resources_, to_open[i].second);
+          try {
+            subgroup->open(QueryType::READ);
+            // Load the member details here as well, so the recursion
+            // below finds them ready
+            subgroup->members();
+            opened[i] = subgroup;
+          } catch (GroupNotFoundException&) {
+            // If the group no longer exists in storage it will be listed
+            // but we won't be able to dump its members
+          }
+          return Status::Ok();
+        }));
+
+    for (size_t i = 0; i < to_open.size(); i++) {
+      subgroups[to_open[i].first] = opened[i];
+    }
+  }
+
+  for (const auto& member_entry : members()) {
+    const auto& it = member_entry.second;
+    ss << "|" << indent << l_indent << " " << *it;
+    if (it->type() == ObjectType::GROUP && recursive) {
+      auto subgroup = subgroups[member_entry.first];
+      if (subgroup == nullptr) {
         ss << " (does not exist)" << std::endl;
+      } else {
+        ss << std::endl;
+        ss << subgroup->dump(indent_size, num_indents + 2, recursive, false);
+        subgroup->close();
       }
     } else {
       ss << std::endl;
@@ -874,11 +920,22 @@ void Group::group_open_for_reads() {
   [[maybe_unused]] auto timer_se =
       resources_.stats().start_timer("group_open_for_reads");
 
-  // Load group data
+  // Defer loading the group details until members are accessed, so that
+  // opening a large group for metadata access alone does not pay for
+  // reading its member details.
+  group_details_loaded_ = false;
+}
+
+void Group::ensure_group_details_loaded() const {
+  if (group_details_loaded_) {
+    return;
+  }
+
   load_group_details();
+  group_details_loaded_ = true;
 }
 
-void Group::load_group_details() {
+void Group::load_group_details() const {
   [[maybe_unused]] auto timer_se =
       resources_.stats().start_timer("load_group_details");
   const URI& latest_group_uri = group_directory()->latest_group_details_uri();
@@ -903,7 +960,7 @@ void Group::load_group_details() {
   load_group_from_all_uris(group_directory()->group_detail_uris());
 }
 
-void Group::load_group_from_uri(const URI& uri) {
+void Group::load_group_from_uri(const URI& uri) const {
   [[maybe_unused]] auto timer_se =
       resources_.stats().start_timer("load_group_from_uri");
 
@@ -926,19 +983,29 @@ void Group::load_group_from_uri(const URI& uri) {
   }
 }
 
-void Group::load_group_from_all_uris(const std::vector<TimestampedURI>& uris) {
+void Group::load_group_from_all_uris(
+    const std::vector<TimestampedURI>& uris) const {
   [[maybe_unused]] auto timer_se =
       resources_.stats().start_timer("load_group_from_all_uris");
 
-  std::vector<shared_ptr<Deserializer>> deserializers;
-  for (auto& uri : uris) {
-    auto tile = GenericTileIO::load(
-        resources_,
-        uri.uri_,
-        0,
-        *encryption_key(),
-        resources_.ephemeral_memory_tracker());
+  // Load all the group detail tiles in parallel
+  auto details_num = uris.size();
+  std::vector<shared_ptr<Tile>> tiles(details_num);
+  throw_if_not_ok(
+      parallel_for(&resources_.compute_tp(), 0, details_num, [&](size_t i) {
+        tiles[i] = GenericTileIO::load(
+            resources_,
+            uris[i].uri_,
+            0,
+            *encryption_key(),
+            resources_.ephemeral_memory_tracker());
 
+        return Status::Ok();
+      }));
+
+  std::vector<shared_ptr<Deserializer>> deserializers;
+  deserializers.reserve(details_num);
+  for (auto& tile : tiles) {
     resources_.stats().add_counter("read_group_size", tile->size());
 
     // Deserialize
@@ -960,6 +1027,7 @@ void Group::group_open_for_writes() {
       resources_.stats().start_timer("group_open_for_writes");
 
   load_group_details();
+  group_details_loaded_ = true;
 }
 
 }  // namespace tiledb::sm
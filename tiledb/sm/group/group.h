@@ -472,8 +472,14 @@ class Group {
    */
   shared_ptr<EncryptionKey> encryption_key_;
 
-  /** Group Details. */
-  shared_ptr<GroupDetails> group_details_;
+  /**
+   * Group Details. Loaded lazily for reads; `mutable` so that the const
+   * member accessors can trigger the load.
+   */
+  mutable shared_ptr<GroupDetails> group_details_;
+
+  /** True if the group details are loaded. */
+  mutable bool group_details_loaded_;
 
   /** Mutex for thread safety. */
   mutable std::mutex mtx_;
@@ -500,24 +506,33 @@ class Group {
   /** Opens an group for reads. */
   void group_open_for_reads();
 
+  /**
+   * Loads the group details if they have not been loaded yet. Groups
+   * opened for reads defer loading their details, so that opening a
+   * group for metadata access alone does not pay for reading the member
+   * details of large groups. Must be called with `mtx_` held.
+   */
+  void ensure_group_details_loaded() const;
+
   /**
    * Load group details from disk
    */
-  void load_group_details();
+  void load_group_details() const;
 
   /**
    * Load a group detail from URI
    *
    * @param uri location to load
    */
-  void load_group_from_uri(const URI& uri);
+  void load_group_from_uri(const URI& uri) const;
 
   /**
    * Load a group detail from URIs
    *
    * @param uris locations to load
    */
-  void load_group_from_all_uris(const std::vector<TimestampedURI>& uris);
+  void load_group_from_all_uris(
+      const std::vector<TimestampedURI>& uris) const;
 
   /** Opens an group for writes. */
   void group_open_for_writes();
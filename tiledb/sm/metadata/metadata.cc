@@ -36,6 +36,7 @@
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/tile/generic_tile_io.h"
 #include "tiledb/storage_format/uri/generate_uri.h"
@@ -54,6 +55,50 @@ class MetadataException : public StatusException {
   }
 };
 
+/**
+ * Returns the size of the serialized metadata items in a tile, excluding
+ * the key index trailer if the tile carries one. The trailer is
+ * `offsets (uint64_t*) | num (uint64_t) | version (uint32_t) |
+ * magic (uint64_t)`, with the magic last so that it can be detected
+ * without knowing the index size.
+ */
+static storage_size_t metadata_records_size(const Tile& tile) {
+  auto size = tile.size();
+  auto fixed_size =
+      2 * sizeof(uint64_t) + sizeof(uint32_t);  // num, version, magic
+  if (size < fixed_size) {
+    return size;
+  }
+
+  auto data = static_cast<const uint8_t*>(tile.data());
+  uint64_t magic;
+  std::memcpy(&magic, data + size - sizeof(uint64_t), sizeof(uint64_t));
+  if (magic != constants::array_metadata_index_magic) {
+    return size;
+  }
+
+  uint32_t version;
+  std::memcpy(
+      &version,
+      data + size - sizeof(uint64_t) - sizeof(uint32_t),
+      sizeof(uint32_t));
+  if (version > constants::array_metadata_index_version) {
+    throw MetadataException(
+        "Cannot read array metadata key index; a newer library version is "
+        "required to read it");
+  }
+
+  uint64_t num;
+  std::memcpy(&num, data + size - fixed_size, sizeof(uint64_t));
+  auto trailer_size = fixed_size + num * sizeof(uint64_t);
+  if (trailer_size > size) {
+    throw MetadataException(
+        "Cannot read array metadata key index; the index is truncated");
+  }
+
+  return size - trailer_size;
+}
+
 /* ********************************* */
 /*     CONSTRUCTORS & DESTRUCTORS    */
 /* ********************************* */
@@ -133,8 +178,8 @@ std::map<std::string, Metadata::MetadataValue> Metadata::deserialize(
   char del;
   size_t value_len;
   for (const auto& tile : metadata_tiles) {
-    // Iterate over all items
-    Deserializer deserializer(tile->data(), tile->size());
+    // Iterate over all items, skipping the key index trailer if present
+    Deserializer deserializer(tile->data(), metadata_records_size(*tile));
     while (deserializer.remaining_bytes()) {
       key_len = deserializer.read<uint32_t>();
       std::string key(deserializer.get_ptr<char>(key_len), key_len);
@@ -166,25 +211,148 @@ std::map<std::string, Metadata::MetadataValue> Metadata::deserialize(
   return metadata_map;
 }
 
+std::optional<Metadata::MetadataValue> Metadata::get_from_tiles(
+    const std::vector<shared_ptr<Tile>>& metadata_tiles,
+    const std::string& key) {
+  std::optional<MetadataValue> result;
+  for (const auto& tile : metadata_tiles) {
+    auto records_size = metadata_records_size(*tile);
+    auto data = static_cast<const uint8_t*>(tile->data());
+    if (records_size < tile->size()) {
+      // Indexed tile; binary-search the sorted key offsets.
+      uint64_t num;
+      std::memcpy(
+          &num,
+          data + tile->size() - 2 * sizeof(uint64_t) - sizeof(uint32_t),
+          sizeof(uint64_t));
+      auto offsets = data + records_size;
+      uint64_t lo = 0, hi = num;
+      while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        uint64_t offset;
+        std::memcpy(&offset, offsets + mid * sizeof(uint64_t), sizeof(offset));
+        if (offset >= records_size) {
+          throw MetadataException(
+              "Cannot read array metadata key index; an item offset is out "
+              "of bounds");
+        }
+
+        Deserializer deserializer(data + offset, records_size - offset);
+        auto key_len = deserializer.read<uint32_t>();
+        std::string_view item_key(
+            deserializer.get_ptr<char>(key_len), key_len);
+        auto cmp = item_key.compare(key);
+        if (cmp < 0) {
+          lo = mid + 1;
+        } else if (cmp > 0) {
+          hi = mid;
+        } else {
+          if (deserializer.read<char>()) {
+            // Handle deletion
+            result = nullopt;
+          } else {
+            MetadataValue value_struct;
+            value_struct.type_ = deserializer.read<char>();
+            value_struct.num_ = deserializer.read<uint32_t>();
+            if (value_struct.num_) {
+              auto value_len =
+                  value_struct.num_ *
+                  datatype_size(static_cast<Datatype>(value_struct.type_));
+              value_struct.value_.resize(value_len);
+              deserializer.read(value_struct.value_.data(), value_len);
+            }
+            result = std::move(value_struct);
+          }
+          break;
+        }
+      }
+    } else {
+      // Plain tile; scan all items, the latest one for the key wins.
+      Deserializer deserializer(data, records_size);
+      while (deserializer.remaining_bytes()) {
+        auto key_len = deserializer.read<uint32_t>();
+        std::string_view item_key(
+            deserializer.get_ptr<char>(key_len), key_len);
+        auto match = (item_key == key);
+        if (deserializer.read<char>()) {
+          // Handle deletion
+          if (match) {
+            result = nullopt;
+          }
+          continue;
+        }
+
+        auto type = deserializer.read<char>();
+        auto num = deserializer.read<uint32_t>();
+        auto value_len = num * datatype_size(static_cast<Datatype>(type));
+        if (!match) {
+          deserializer.get_ptr<uint8_t>(value_len);
+          continue;
+        }
+
+        MetadataValue value_struct;
+        value_struct.type_ = type;
+        value_struct.num_ = num;
+        if (num) {
+          value_struct.value_.resize(value_len);
+          deserializer.read(value_struct.value_.data(), value_len);
+        }
+        result = std::move(value_struct);
+      }
+    }
+  }
+
+  return result;
+}
+
 void Metadata::serialize(Serializer& serializer) const {
   // Do nothing if there are no metadata to serialize
   if (metadata_map_.empty()) {
     return;
   }
 
+  std::vector<uint64_t> offsets;
+  if (store_index_) {
+    offsets.reserve(metadata_map_.size());
+  }
+
+  uint64_t offset = 0;
   for (const auto& meta : metadata_map_) {
+    if (store_index_) {
+      offsets.push_back(offset);
+    }
+
     auto key_len = (uint32_t)meta.first.size();
     serializer.write<uint32_t>(key_len);
     serializer.write(meta.first.data(), meta.first.size());
     const auto& value = meta.second;
     serializer.write<char>(value.del_);
+    offset += sizeof(uint32_t) + key_len + sizeof(char);
     if (!value.del_) {
       serializer.write<char>(value.type_);
       serializer.write<uint32_t>(value.num_);
-      if (value.num_)
+      offset += sizeof(char) + sizeof(uint32_t);
+      if (value.num_) {
         serializer.write(value.value_.data(), value.value_.size());
+        offset += value.value_.size();
+      }
     }
   }
+
+  // Append the key index trailer. The map iterates in key order, so the
+  // offsets are already sorted on key for binary search.
+  if (store_index_) {
+    for (auto o : offsets) {
+      serializer.write<uint64_t>(o);
+    }
+    serializer.write<uint64_t>(offsets.size());
+    serializer.write<uint32_t>(constants::array_metadata_index_version);
+    serializer.write<uint64_t>(constants::array_metadata_index_magic);
+  }
+}
+
+void Metadata::set_store_index(bool store_index) {
+  store_index_ = store_index;
 }
 
 void Metadata::store(
@@ -134,9 +134,32 @@ class Metadata {
   static std::map<std::string, MetadataValue> deserialize(
       const std::vector<shared_ptr<Tile>>& metadata_tiles);
 
+  /**
+   * Looks up a single key in the input metadata buffers without
+   * deserializing them in full. The buffers are assumed to be sorted on
+   * time; the latest item for the key wins. Buffers that carry a key
+   * index (written by consolidation when requested) are binary-searched,
+   * the rest are scanned linearly.
+   *
+   * @return The latest value for the key, or `nullopt` if the key does
+   *     not exist or its latest item is a deletion.
+   */
+  static std::optional<MetadataValue> get_from_tiles(
+      const std::vector<shared_ptr<Tile>>& metadata_tiles,
+      const std::string& key);
+
   /** Serializes all key-value metadata items into the input buffer. */
   void serialize(Serializer& serializer) const;
 
+  /**
+   * If `true`, `serialize` appends a sorted key index (an offset table
+   * over the serialized items plus a magic trailer) after the items, so
+   * that readers can look up a single key without parsing the whole
+   * buffer. Only set for consolidated metadata, on request; readers that
+   * predate the index parse the whole buffer as items.
+   */
+  void set_store_index(bool store_index);
+
   /**
    * Stores the metadata into persistent storage.
    *
@@ -279,6 +302,9 @@ class Metadata {
   /** Timestamped name. */
   std::string timestamped_name_;
 
+  /** If `true`, `serialize` appends a sorted key index after the items. */
+  bool store_index_ = false;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
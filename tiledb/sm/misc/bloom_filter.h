@@ -0,0 +1,165 @@
+/**
+ * @file   bloom_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class BloomFilter.
+ */
+
+#ifndef TILEDB_BLOOM_FILTER_H
+#define TILEDB_BLOOM_FILTER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace tiledb::sm {
+
+/**
+ * Bloom filter over the byte representation of a set of values.
+ *
+ * The filter answers "is this value possibly in the set" with no false
+ * negatives: `maybe_contains` returns `true` for every inserted value and
+ * may return `true` for values that were never inserted, with a false
+ * positive rate determined by the number of bits per inserted value.
+ *
+ * Values are hashed with two independent FNV-1a variants over their bytes
+ * and the probe positions are derived by double hashing. The hashes are
+ * fixed, not seeded per process, so filters computed at different times
+ * answer consistently for the same data.
+ */
+class BloomFilter {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param num_values Expected number of values to insert.
+   * @param bits_per_value Number of filter bits per inserted value.
+   */
+  BloomFilter(uint64_t num_values, uint32_t bits_per_value) {
+    // Round the size up to a full number of words, with a floor of one
+    // word for degenerate inputs.
+    auto num_bits = std::max<uint64_t>(
+        64, num_values * std::max<uint32_t>(1, bits_per_value));
+    bits_.resize((num_bits + 63) / 64, 0);
+    num_bits_ = bits_.size() * 64;
+
+    // The optimal number of probes is ln(2) bits per value.
+    num_probes_ = std::clamp<uint32_t>(
+        static_cast<uint32_t>(bits_per_value * 0.693), 1, 16);
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Inserts the bytes of a value in the filter.
+   *
+   * @param data Pointer to the value data.
+   * @param size Size of the value data, in bytes.
+   */
+  void insert(const void* data, uint64_t size) {
+    auto h1 = hash(data, size, 0xcbf29ce484222325);
+    auto h2 = hash(data, size, 0x84222325cbf29ce4) | 1;
+    for (uint32_t p = 0; p < num_probes_; p++) {
+      auto bit = (h1 + p * h2) % num_bits_;
+      bits_[bit / 64] |= 1ULL << (bit % 64);
+    }
+  }
+
+  /**
+   * Returns `false` if the value is definitely not in the filter and
+   * `true` if it may be.
+   *
+   * @param data Pointer to the value data.
+   * @param size Size of the value data, in bytes.
+   * @return `true` if the value may have been inserted.
+   */
+  bool maybe_contains(const void* data, uint64_t size) const {
+    auto h1 = hash(data, size, 0xcbf29ce484222325);
+    auto h2 = hash(data, size, 0x84222325cbf29ce4) | 1;
+    for (uint32_t p = 0; p < num_probes_; p++) {
+      auto bit = (h1 + p * h2) % num_bits_;
+      if ((bits_[bit / 64] & (1ULL << (bit % 64))) == 0) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /** Returns the size of the filter, in bytes. */
+  uint64_t size() const {
+    return bits_.size() * sizeof(uint64_t);
+  }
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Hashes the bytes of a value.
+   *
+   * @param data Pointer to the value data.
+   * @param size Size of the value data, in bytes.
+   * @param seed Hash seed.
+   * @return 64-bit hash.
+   */
+  static uint64_t hash(const void* data, uint64_t size, uint64_t seed) {
+    // FNV-1a, 64-bit.
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t h = seed;
+    for (uint64_t i = 0; i < size; i++) {
+      h = (h ^ bytes[i]) * 0x100000001b3;
+    }
+
+    return h;
+  }
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Filter bits. */
+  std::vector<uint64_t> bits_;
+
+  /** Number of filter bits. */
+  uint64_t num_bits_;
+
+  /** Number of probe positions per value. */
+  uint32_t num_probes_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_BLOOM_FILTER_H
@@ -0,0 +1,78 @@
+/**
+ * @file   cancellation_source.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class CancellationSource.
+ */
+
+#ifndef TILEDB_CANCELLATION_SOURCE_H
+#define TILEDB_CANCELLATION_SOURCE_H
+
+#include <atomic>
+
+#include "tiledb/common/common.h"
+
+namespace tiledb::sm {
+
+/**
+ * A cooperative cancellation token shared between the code that requests
+ * cancellation and the code that performs work.
+ *
+ * A CancellationSource is a cheap copyable handle over shared state. The
+ * cancelling side calls cancel() once; workers poll is_cancelled() at
+ * natural checkpoints (per tile read, per filter chunk, per merge iteration)
+ * and abort promptly instead of running in-flight work to completion. Copies
+ * of a source observe the same state, so a token can be handed down through
+ * layers (readers, the filter pipeline, the VFS) without reference lifetime
+ * concerns.
+ */
+class CancellationSource {
+ public:
+  /** Constructor. */
+  CancellationSource()
+      : cancelled_(make_shared<std::atomic<bool>>(HERE(), false)) {
+  }
+
+  /** Request cancellation of the work observing this source. */
+  void cancel() {
+    cancelled_->store(true, std::memory_order_release);
+  }
+
+  /** Return true if cancellation has been requested. */
+  bool is_cancelled() const {
+    return cancelled_->load(std::memory_order_acquire);
+  }
+
+ private:
+  /** The shared cancellation flag. */
+  shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_CANCELLATION_SOURCE_H
@@ -38,6 +38,7 @@
 #include <cinttypes>
 #include <vector>
 
+#include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/query/readers/result_coords.h"
@@ -350,6 +351,19 @@ class GlobalCmp : public CellCmpBase {
    */
   template <class RCType>
   bool operator()(const RCType& a, const RCType& b) const {
+    // Precomputed global order keys decide most comparisons with a single
+    // integer compare; equal keys fall through to the full comparison.
+    if constexpr (requires { a.tile_->global_order_key(a.pos_); }) {
+      if (a.tile_->has_global_order_keys() &&
+          b.tile_->has_global_order_keys()) {
+        const uint64_t key_a{a.tile_->global_order_key(a.pos_)};
+        const uint64_t key_b{b.tile_->global_order_key(b.pos_)};
+        if (key_a != key_b) {
+          return key_a < key_b;
+        }
+      }
+    }
+
     if (tile_order_ == Layout::ROW_MAJOR) {
       for (unsigned d = 0; d < dim_num_; ++d) {
         // Not applicable to var-sized dimensions
@@ -470,6 +484,211 @@ class GlobalCmpReverse {
   GlobalCmp cmp_;
 };
 
+/**
+ * Global order comparator specialized for a compile time dimension count
+ * and coordinate type. The domain lows and tile extents are cached at
+ * construction so that comparisons run as tight loops of typed value
+ * compares, without the per-dimension virtual dispatch of `GlobalCmp`.
+ * Only applicable to domains where every dimension is fixed sized and of
+ * type `T`.
+ */
+template <class T, unsigned DimNum>
+class GlobalCmpSpecialized : public CellCmpBase {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param use_timestamps Use timestamps or not for this comparator.
+   * @param strict_ordering Enforce strict ordering for the comparator if used
+   * in a queue.
+   * @param frag_md Pointer to the fragment metadata.
+   */
+  explicit GlobalCmpSpecialized(
+      const Domain& domain,
+      const bool use_timestamps = false,
+      const bool strict_ordering = false,
+      const std::vector<shared_ptr<FragmentMetadata>>* frag_md = nullptr)
+      : CellCmpBase(domain, use_timestamps, strict_ordering, frag_md)
+      , tile_order_(domain.tile_order())
+      , cell_order_(domain.cell_order()) {
+    assert(domain.dim_num() == DimNum);
+    for (unsigned d = 0; d < DimNum; ++d) {
+      const auto& dim{*domain.dimension_ptr(d)};
+      assert(!dim.var_size());
+      has_tile_extent_[d] = static_cast<bool>(dim.tile_extent());
+      tile_extent_[d] =
+          has_tile_extent_[d] ? dim.tile_extent().rvalue_as<T>() : T(0);
+      domain_low_[d] = static_cast<const T*>(dim.domain().data())[0];
+    }
+  }
+
+  /**
+   * Comparison operator for a vector of `ResultCoords`.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    // Precomputed global order keys decide most comparisons with a single
+    // integer compare; equal keys fall through to the full comparison.
+    if constexpr (requires { a.tile_->global_order_key(a.pos_); }) {
+      if (a.tile_->has_global_order_keys() &&
+          b.tile_->has_global_order_keys()) {
+        const uint64_t key_a{a.tile_->global_order_key(a.pos_)};
+        const uint64_t key_b{b.tile_->global_order_key(b.pos_)};
+        if (key_a != key_b) {
+          return key_a < key_b;
+        }
+      }
+    }
+
+    T coords_a[DimNum], coords_b[DimNum];
+    for (unsigned d = 0; d < DimNum; ++d) {
+      coords_a[d] = *static_cast<const T*>(a.coord(d));
+      coords_b[d] = *static_cast<const T*>(b.coord(d));
+    }
+
+    // Compare tile order
+    if (tile_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        auto res = tile_order_cmp(d, coords_a[d], coords_b[d]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      assert(tile_order_ == Layout::COL_MAJOR);
+      for (unsigned d = DimNum; d > 0; --d) {
+        auto res = tile_order_cmp(d - 1, coords_a[d - 1], coords_b[d - 1]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    }
+
+    // Compare cell order
+    if (cell_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        if (coords_a[d] < coords_b[d])
+          return true;
+        if (coords_a[d] > coords_b[d])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      assert(cell_order_ == Layout::COL_MAJOR);
+      for (unsigned d = DimNum; d > 0; --d) {
+        if (coords_a[d - 1] < coords_b[d - 1])
+          return true;
+        if (coords_a[d - 1] > coords_b[d - 1])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    }
+
+    // Compare timestamps
+    if (use_timestamps_) {
+      return get_timestamp(a) > get_timestamp(b);
+    } else if (strict_ordering_) {
+      if (a.tile_->frag_idx() == b.tile_->frag_idx()) {
+        if (a.tile_->tile_idx() == b.tile_->tile_idx()) {
+          return a.pos_ > b.pos_;
+        }
+
+        return a.tile_->tile_idx() > b.tile_->tile_idx();
+      }
+
+      return a.tile_->frag_idx() > b.tile_->frag_idx();
+    }
+
+    return false;
+  }
+
+ private:
+  /**
+   * Compares two coordinates on the tile order of a dimension.
+   *
+   * @param d The dimension to compare on.
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return -1 if `a` precedes `b`, 0 if they are in the same tile and +1
+   * if `a` succeeds `b` on the tile order.
+   */
+  inline int tile_order_cmp(unsigned d, T a, T b) const {
+    if (!has_tile_extent_[d])
+      return 0;
+
+    auto ta = Dimension::tile_idx(a, domain_low_[d], tile_extent_[d]);
+    auto tb = Dimension::tile_idx(b, domain_low_[d], tile_extent_[d]);
+    if (ta < tb)
+      return -1;
+    if (ta > tb)
+      return 1;
+    return 0;
+  }
+
+  /** The tile order. */
+  Layout tile_order_;
+  /** The cell order. */
+  Layout cell_order_;
+  /** Per dimension, is there a tile extent? */
+  bool has_tile_extent_[DimNum];
+  /** Per dimension tile extent, `0` if there is none. */
+  T tile_extent_[DimNum];
+  /** Per dimension domain low. */
+  T domain_low_[DimNum];
+};
+
+/**
+ * Wrapper of the specialized global order comparator for sorting coords in
+ * reverse order.
+ */
+template <class T, unsigned DimNum>
+class GlobalCmpReverseSpecialized {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param use_timestamps Use timestamps or not for this comparator.
+   * @param strict_ordering Enforce strict ordering for the comparator if used
+   * in a queue.
+   * @param frag_md Pointer to the fragment metadata.
+   */
+  explicit GlobalCmpReverseSpecialized(
+      const Domain& domain,
+      const bool use_timestamps = false,
+      const bool strict_ordering = false,
+      const std::vector<shared_ptr<FragmentMetadata>>* frag_md = nullptr)
+      : cmp_(domain, use_timestamps, strict_ordering, frag_md) {
+  }
+
+  /**
+   * Comparison operator for a vector of `ResultCoords`.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    return !cmp_.operator()(a, b);
+  }
+
+ private:
+  /** GlobalCmpSpecialized. */
+  GlobalCmpSpecialized<T, DimNum> cmp_;
+};
+
 /**
  * Base class for comparison function classes whose operands are domain values
  * residing in QueryBuffer objects.
@@ -546,6 +765,140 @@ class GlobalCmpQB : protected DomainValueCmpBaseQB {
   }
 };
 
+/**
+ * Global order comparator on query buffers specialized for a compile time
+ * dimension count and coordinate type. The typed coordinate buffers, domain
+ * lows and tile extents are cached at construction so that comparisons run
+ * as tight loops of typed value compares, without the per-dimension dynamic
+ * dispatch of `GlobalCmpQB`. Only applicable to domains where every
+ * dimension is fixed sized and of type `T`.
+ */
+template <class T, unsigned DimNum>
+class GlobalCmpQBSpecialized {
+ public:
+  /// Default constructor is prohibited.
+  GlobalCmpQBSpecialized() = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param db The coordinate query buffers, one per dimension.
+   */
+  GlobalCmpQBSpecialized(const Domain& domain, const DomainBuffersView& db)
+      : tile_order_(domain.tile_order())
+      , cell_order_(domain.cell_order()) {
+    assert(domain.dim_num() == DimNum);
+    for (unsigned d = 0; d < DimNum; ++d) {
+      const auto& dim{*domain.dimension_ptr(d)};
+      assert(!dim.var_size());
+      coords_[d] = static_cast<const T*>(db[d]->buffer_);
+      has_tile_extent_[d] = static_cast<bool>(dim.tile_extent());
+      tile_extent_[d] =
+          has_tile_extent_[d] ? dim.tile_extent().rvalue_as<T>() : T(0);
+      domain_low_[d] = static_cast<const T*>(dim.domain().data())[0];
+    }
+  }
+
+  /**
+   * Positional comparison operator.
+   *
+   * @param a The first cell position.
+   * @param b The second cell position.
+   * @return `true` if cell at `a` across all coordinate buffers precedes
+   *     cell at `b`, and `false` otherwise.
+   */
+  bool operator()(uint64_t a, uint64_t b) const {
+    T coords_a[DimNum], coords_b[DimNum];
+    for (unsigned d = 0; d < DimNum; ++d) {
+      coords_a[d] = coords_[d][a];
+      coords_b[d] = coords_[d][b];
+    }
+
+    // Compare tile order
+    if (tile_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        auto res = tile_order_cmp(d, coords_a[d], coords_b[d]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      assert(tile_order_ == Layout::COL_MAJOR);
+      for (unsigned d = DimNum; d > 0; --d) {
+        auto res = tile_order_cmp(d - 1, coords_a[d - 1], coords_b[d - 1]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    }
+
+    // Compare cell order
+    if (cell_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        if (coords_a[d] < coords_b[d])
+          return true;
+        if (coords_a[d] > coords_b[d])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      assert(cell_order_ == Layout::COL_MAJOR);
+      for (unsigned d = DimNum; d > 0; --d) {
+        if (coords_a[d - 1] < coords_b[d - 1])
+          return true;
+        if (coords_a[d - 1] > coords_b[d - 1])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    }
+
+    return false;
+  }
+
+ private:
+  /**
+   * Compares two coordinates on the tile order of a dimension.
+   *
+   * @param d The dimension to compare on.
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return -1 if `a` precedes `b`, 0 if they are in the same tile and +1
+   * if `a` succeeds `b` on the tile order.
+   */
+  inline int tile_order_cmp(unsigned d, T a, T b) const {
+    if (!has_tile_extent_[d])
+      return 0;
+
+    auto ta = Dimension::tile_idx(a, domain_low_[d], tile_extent_[d]);
+    auto tb = Dimension::tile_idx(b, domain_low_[d], tile_extent_[d]);
+    if (ta < tb)
+      return -1;
+    if (ta > tb)
+      return 1;
+    return 0;
+  }
+
+  /** The tile order. */
+  Layout tile_order_;
+  /** The cell order. */
+  Layout cell_order_;
+  /** Per dimension typed coordinate buffer. */
+  const T* coords_[DimNum];
+  /** Per dimension, is there a tile extent? */
+  bool has_tile_extent_[DimNum];
+  /** Per dimension tile extent, `0` if there is none. */
+  T tile_extent_[DimNum];
+  /** Per dimension domain low. */
+  T domain_low_[DimNum];
+};
+
 /**
  * (Hilbert) Comparsion (Cmp) function class that operates on values that
  * reside in QueryBuffers (QB) for a domain.
@@ -256,9 +256,39 @@ const std::string update_file_suffix = ".upd";
 /** Suffix for the special metadata files used in TileDB. */
 const std::string meta_file_suffix = ".meta";
 
+/**
+ * Magic trailer value of the compact per-fragment summary appended to
+ * consolidated fragment metadata files. Readers that predate the summary
+ * never read past the footers, so the section is backwards compatible.
+ */
+const uint64_t consolidated_fragment_summary_magic = 0x46524147534d5259;
+
+/** Current version of the consolidated fragment metadata summary. */
+const uint32_t consolidated_fragment_summary_version = 1;
+
+/**
+ * Magic trailer value of the sorted key index appended to consolidated
+ * array metadata tiles. Readers that predate the index parse the whole
+ * tile as records, so the index is written only on request.
+ */
+const uint64_t array_metadata_index_magic = 0x4d45544149445831;
+
+/** Current version of the array metadata key index. */
+const uint32_t array_metadata_index_version = 1;
+
 /** Suffix for the special commits files used in TileDB. */
 const std::string con_commits_file_suffix = ".con";
 
+/**
+ * Magic prefix of the binary manifest variant of consolidated commits
+ * files. Text consolidated commits files always start with a relative
+ * commit URI, so the prefix unambiguously identifies the format.
+ */
+const std::string con_commits_manifest_magic = "tiledb.commits_manifest";
+
+/** Current version of the binary consolidated commits manifest. */
+const uint32_t con_commits_manifest_version = 1;
+
 /** Suffix for the special ignore files used in TileDB. */
 const std::string ignore_file_suffix = ".ign";
 
@@ -412,6 +442,9 @@ const std::string double_delta_str = "DOUBLE_DELTA";
 /** String describing DELTA. */
 const std::string delta_str = "DELTA";
 
+/** String describing ADAPTIVE. */
+const std::string adaptive_str = "ADAPTIVE";
+
 /** String describing FILTER_NONE. */
 const std::string filter_none_str = "NONE";
 
@@ -433,6 +466,12 @@ const std::string filter_checksum_md5_str = "CHECKSUM_MD5";
 /** String describing FILTER_CHECKSUM_SHA256. */
 const std::string filter_checksum_sha256_str = "CHECKSUM_SHA256";
 
+/** String describing FILTER_CHECKSUM_CRC32C. */
+const std::string filter_checksum_crc32c_str = "CHECKSUM_CRC32C";
+
+/** String describing FILTER_VALIDITY_BIT_PACK. */
+const std::string filter_validity_bit_pack_str = "VALIDITY_BIT_PACK";
+
 /** String describing FILTER_DICTIONARY. */
 const std::string filter_dictionary_str = "DICTIONARY_ENCODING";
 
@@ -691,7 +730,7 @@ const int32_t library_version[3] = {
     TILEDB_VERSION_MAJOR, TILEDB_VERSION_MINOR, TILEDB_VERSION_PATCH};
 
 /** The TileDB serialization base format version number. */
-const format_version_t base_format_version = 22;
+const format_version_t base_format_version = 23;
 
 /**
  * The TileDB serialization format version number.
@@ -731,6 +770,12 @@ const format_version_t current_domain_min_format_version = 22;
 /** The current CurrentDomain API version. */
 const format_version_t current_domain_version = 0;
 
+/** The lowest format version that uses the blocked double delta layout. */
+const format_version_t double_delta_blocked_min_format_version = 23;
+
+/** The lowest format version that stores per-part XOR filter lane counts. */
+const format_version_t xor_lanes_min_format_version = 23;
+
 /** The NDRectangle current domain */
 const std::string current_domain_ndrectangle_str = "NDRECTANGLE";
 
@@ -68,6 +68,12 @@ static const std::string aggregate_null_count_str = "NULL_COUNT";
 /** The name of MEAN aggregator. */
 static const std::string aggregate_mean_str = "MEAN";
 
+/** The name of DISTINCT_COUNT aggregator. */
+static const std::string aggregate_distinct_count_str = "DISTINCT_COUNT";
+
+/** The name of MEDIAN aggregator. */
+static const std::string aggregate_median_str = "MEDIAN";
+
 /**
  * Reduction factor (must be in [0.0, 1.0]) for the multi_range subarray
  * split by the partitioner. If the number is equal to 0.3, then this
@@ -252,9 +258,27 @@ extern const std::string update_file_suffix;
 /** Suffix for the special metadata files used in TileDB. */
 extern const std::string meta_file_suffix;
 
+/** Magic trailer value of the consolidated fragment metadata summary. */
+extern const uint64_t consolidated_fragment_summary_magic;
+
+/** Current version of the consolidated fragment metadata summary. */
+extern const uint32_t consolidated_fragment_summary_version;
+
+/** Magic trailer value of the array metadata key index. */
+extern const uint64_t array_metadata_index_magic;
+
+/** Current version of the array metadata key index. */
+extern const uint32_t array_metadata_index_version;
+
 /** Suffix for the special consolidated commits files used in TileDB. */
 extern const std::string con_commits_file_suffix;
 
+/** Magic prefix of the binary consolidated commits manifest. */
+extern const std::string con_commits_manifest_magic;
+
+/** Current version of the binary consolidated commits manifest. */
+extern const uint32_t con_commits_manifest_version;
+
 /** Suffix for the special ignore files used in TileDB. */
 extern const std::string ignore_file_suffix;
 
@@ -408,6 +432,9 @@ extern const std::string double_delta_str;
 /** String describing DELTA. */
 extern const std::string delta_str;
 
+/** String describing ADAPTIVE. */
+extern const std::string adaptive_str;
+
 /** String describing FILTER_NONE. */
 extern const std::string filter_none_str;
 
@@ -429,6 +456,12 @@ extern const std::string filter_checksum_md5_str;
 /** String describing FILTER_CHECKSUM_SHA256. */
 extern const std::string filter_checksum_sha256_str;
 
+/** String describing FILTER_CHECKSUM_CRC32C. */
+extern const std::string filter_checksum_crc32c_str;
+
+/** String describing FILTER_VALIDITY_BIT_PACK. */
+extern const std::string filter_validity_bit_pack_str;
+
 /** String describing FILTER_DICTIONARY. */
 extern const std::string filter_dictionary_str;
 
@@ -715,6 +748,12 @@ extern const format_version_t current_domain_min_format_version;
 /** The current CurrentDomain API version. */
 extern const format_version_t current_domain_version;
 
+/** The lowest format version that uses the blocked double delta layout. */
+extern const format_version_t double_delta_blocked_min_format_version;
+
+/** The lowest format version that stores per-part XOR filter lane counts. */
+extern const format_version_t xor_lanes_min_format_version;
+
 /** The NDRectangle current_domain */
 extern const std::string current_domain_ndrectangle_str;
 
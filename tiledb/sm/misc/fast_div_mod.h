@@ -0,0 +1,192 @@
+/**
+ * @file   fast_div_mod.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This defines a precomputed magic-number divisor for unsigned 64-bit
+ * integers.
+ */
+
+#ifndef TILEDB_FAST_DIV_MOD_H
+#define TILEDB_FAST_DIV_MOD_H
+
+#include <cassert>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A divisor by a runtime constant, precomputed so that division and modulo
+ * reduce to a high multiply and shifts (Granlund-Montgomery magic-number
+ * division).
+ *
+ * Multi-dimensional address math turns linear positions into coordinates
+ * with one integer division and modulo per dimension; on a hardware divider
+ * these dominate the address computation. A `FastDivMod` is built once per
+ * divisor (e.g. per dimension of a tile domain) and then divides any 64-bit
+ * dividend exactly, including divisors of one, powers of two and divisors
+ * with the high bit set.
+ */
+class FastDivMod {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Default constructor, creating a divisor by 1. */
+  FastDivMod()
+      : FastDivMod(1) {
+  }
+
+  /**
+   * Constructor.
+   *
+   * @param divisor The divisor to precompute. Must be non-zero.
+   */
+  explicit FastDivMod(uint64_t divisor)
+      : divisor_(divisor)
+      , magic_(0)
+      , shift_(0)
+      , add_(false) {
+    assert(divisor != 0);
+
+    // Position of the highest set bit of the divisor.
+    uint32_t p = 63;
+    while ((divisor & (UINT64_C(1) << p)) == 0) {
+      --p;
+    }
+
+    if ((divisor & (divisor - 1)) == 0) {
+      // Power of two (including 1); `magic_ == 0` selects a pure shift.
+      shift_ = p;
+      return;
+    }
+
+    // Compute `m = floor(2^(64 + p) / divisor)` and the remainder with a
+    // bit-at-a-time restoring division, so no 128-bit arithmetic is needed.
+    // Since `2^p < divisor`, the quotient fits in 64 bits. This runs only
+    // at construction.
+    uint64_t m = 0;
+    uint64_t rem = 1;
+    for (uint32_t i = 0; i < 64 + p; ++i) {
+      auto wrapped = (rem >> 63) != 0;
+      rem <<= 1;
+      m <<= 1;
+      if (wrapped || rem >= divisor) {
+        rem -= divisor;
+        m |= 1;
+      }
+    }
+
+    shift_ = p;
+    if (divisor - rem < (UINT64_C(1) << p)) {
+      // Rounding the magic up keeps every 64-bit dividend exact.
+      magic_ = m + 1;
+    } else {
+      // The rounded-up magic is off by one for some dividends; double the
+      // precision and fix up with an extra average step in `div`.
+      add_ = true;
+      auto twice_rem = rem + rem;
+      magic_ = m + m + (twice_rem >= divisor || twice_rem < rem ? 1 : 0) + 1;
+    }
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the divisor. */
+  inline uint64_t divisor() const {
+    return divisor_;
+  }
+
+  /** Returns `n / divisor`. */
+  inline uint64_t div(uint64_t n) const {
+    if (magic_ == 0) {
+      return n >> shift_;
+    }
+
+    auto q = mul_hi(magic_, n);
+    if (add_) {
+      q += (n - q) >> 1;
+    }
+    return q >> shift_;
+  }
+
+  /** Returns `n % divisor`. */
+  inline uint64_t mod(uint64_t n) const {
+    return n - div(n) * divisor_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The divisor. */
+  uint64_t divisor_;
+
+  /** The magic multiplier, or 0 if the divisor is a power of two. */
+  uint64_t magic_;
+
+  /** The post-multiply shift. */
+  uint32_t shift_;
+
+  /** Whether `div` needs the extra average step for exactness. */
+  bool add_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns the high 64 bits of the 128-bit product `a * b`. */
+  static inline uint64_t mul_hi(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return __umulh(a, b);
+#else
+    auto a_lo = a & 0xffffffff;
+    auto a_hi = a >> 32;
+    auto b_lo = b & 0xffffffff;
+    auto b_hi = b >> 32;
+    auto cross = a_hi * b_lo + ((a_lo * b_lo) >> 32);
+    auto carry = a_lo * b_hi + (cross & 0xffffffff);
+    return a_hi * b_hi + (cross >> 32) + (carry >> 32);
+#endif
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FAST_DIV_MOD_H
@@ -186,6 +186,56 @@ class Hilbert {
     return ret;
   }
 
+  /**
+   * Converts a batch of coordinate tuples to Hilbert values.
+   *
+   * The transpose step is identical to `coords_to_hilbert`, but the
+   * final bit interleave, which dominates the per-coordinate cost, is
+   * performed with a byte-wide bit-spread table built once for the
+   * whole batch instead of bit-at-a-time shifts.
+   *
+   * @param coords The coordinates to be converted, `dim_num_` contiguous
+   *     values per cell (converted in place to transpose form).
+   * @param cell_num The number of cells in the batch.
+   * @param hilbert_values The output Hilbert values, one per cell.
+   */
+  void coords_to_hilbert(
+      uint64_t* coords, uint64_t cell_num, uint64_t* hilbert_values) {
+    assert(coords != nullptr);
+    assert(hilbert_values != nullptr);
+
+    // Byte-wide bit-spread table: bit `j` of a byte maps to bit
+    // `j * dim_num_` of the spread value.
+    // Positions past 64 bits can only come from coordinate bits at or
+    // beyond `bits_`, which are always zero, so they can be skipped.
+    uint64_t spread[256];
+    for (uint32_t v = 0; v < 256; ++v) {
+      uint64_t s = 0;
+      for (int j = 0; j < 8 && j * dim_num_ < 64; ++j)
+        s |= (uint64_t)((v >> j) & 1) << (j * dim_num_);
+      spread[v] = s;
+    }
+
+    auto byte_num = (bits_ + 7) / 8;
+    for (uint64_t c = 0; c < cell_num; ++c) {
+      auto X = &coords[c * dim_num_];
+
+      // Convert coords to the transpose form of the hilbert value
+      axes_to_transpose(X, bits_, dim_num_);
+
+      // Interleave: bit `j` of `X[i]` maps to bit
+      // `j * dim_num_ + (dim_num_ - 1 - i)` of the hilbert value.
+      uint64_t ret = 0;
+      for (int i = 0; i < dim_num_; ++i) {
+        uint64_t s = 0;
+        for (int k = 0; k < byte_num; ++k)
+          s |= spread[(X[i] >> (8 * k)) & 0xFF] << (8 * k * dim_num_);
+        ret |= s << (dim_num_ - 1 - i);
+      }
+      hilbert_values[c] = ret;
+    }
+  }
+
   /**
    * Converts a Hilbert value into a set of coordinates.
    *
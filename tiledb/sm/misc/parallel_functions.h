@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 using namespace tiledb::common;
 
@@ -156,6 +157,126 @@ void parallel_sort(
   throw_if_not_ok(quick_sort(0, begin, end));
 }
 
+/**
+ * Sort the given contiguous range by the 64-bit sort key of each element,
+ * possibly in parallel. The sort is stable: elements with equal keys keep
+ * their relative order.
+ *
+ * @tparam IterT Iterator type, must point into contiguous storage.
+ * @param tp The threadpool to use.
+ * @param begin Beginning of range to sort (inclusive).
+ * @param end End of range to sort (exclusive).
+ * @param keys The sort keys, indexed by the values in the range.
+ */
+template <typename IterT>
+void parallel_radix_sort(
+    ThreadPool* const tp,
+    IterT begin,
+    IterT end,
+    const std::vector<uint64_t>& keys) {
+  // Sort the range with a least significant digit radix sort over the keys,
+  // one byte per pass. Each pass computes per-chunk digit histograms in
+  // parallel, derives the destination of the first element of every
+  // (digit, chunk) pair with a prefix sum and scatters the elements to a
+  // scratch buffer in parallel. Visiting the chunks of a digit in order
+  // keeps the sort stable. Bytes in which all keys are identical are
+  // skipped.
+  assert(tp);
+
+  using ValueT = typename std::iterator_traits<IterT>::value_type;
+  const uint64_t num_elements = std::distance(begin, end);
+
+  // For small ranges, the histogram passes cost more than a direct sort.
+  if (num_elements < 1024) {
+    std::stable_sort(begin, end, [&](const ValueT& a, const ValueT& b) {
+      return keys[a] < keys[b];
+    });
+    return;
+  }
+
+  constexpr uint64_t radix_bits = 8;
+  constexpr uint64_t num_buckets = uint64_t(1) << radix_bits;
+  const uint64_t num_chunks =
+      std::max<uint64_t>(tp->concurrency_level(), 1);
+  const uint64_t chunk_size = num_elements / num_chunks + 1;
+
+  // Determine which bytes differ between keys, the others need no pass.
+  std::vector<uint64_t> chunk_or(num_chunks, 0);
+  std::vector<uint64_t> chunk_and(num_chunks, ~uint64_t(0));
+  throw_if_not_ok(parallel_for(tp, 0, num_chunks, [&](uint64_t c) {
+    const uint64_t start = c * chunk_size;
+    const uint64_t stop = std::min(start + chunk_size, num_elements);
+    for (uint64_t i = start; i < stop; i++) {
+      chunk_or[c] |= keys[begin[i]];
+      chunk_and[c] &= keys[begin[i]];
+    }
+    return Status::Ok();
+  }));
+  uint64_t differing_bits = 0;
+  for (uint64_t c = 0; c < num_chunks; c++) {
+    differing_bits |= chunk_or[c] ^ chunk_and[c];
+  }
+
+  std::vector<ValueT> scratch(num_elements);
+  ValueT* src = &*begin;
+  ValueT* dst = scratch.data();
+  std::vector<std::vector<uint64_t>> counts(
+      num_chunks, std::vector<uint64_t>(num_buckets));
+  for (uint64_t shift = 0; shift < 64; shift += radix_bits) {
+    if (((differing_bits >> shift) & (num_buckets - 1)) == 0) {
+      continue;
+    }
+
+    // Per-chunk digit histograms.
+    throw_if_not_ok(parallel_for(tp, 0, num_chunks, [&](uint64_t c) {
+      auto& chunk_counts = counts[c];
+      std::fill(chunk_counts.begin(), chunk_counts.end(), 0);
+      const uint64_t start = c * chunk_size;
+      const uint64_t stop = std::min(start + chunk_size, num_elements);
+      for (uint64_t i = start; i < stop; i++) {
+        chunk_counts[(keys[src[i]] >> shift) & (num_buckets - 1)]++;
+      }
+      return Status::Ok();
+    }));
+
+    // An exclusive prefix sum in (digit, chunk) order turns the histograms
+    // into the scratch offset of the first element of every pair.
+    uint64_t offset = 0;
+    for (uint64_t b = 0; b < num_buckets; b++) {
+      for (uint64_t c = 0; c < num_chunks; c++) {
+        const uint64_t count = counts[c][b];
+        counts[c][b] = offset;
+        offset += count;
+      }
+    }
+
+    // Scatter the elements to their destination for this digit.
+    throw_if_not_ok(parallel_for(tp, 0, num_chunks, [&](uint64_t c) {
+      auto& chunk_offsets = counts[c];
+      const uint64_t start = c * chunk_size;
+      const uint64_t stop = std::min(start + chunk_size, num_elements);
+      for (uint64_t i = start; i < stop; i++) {
+        dst[chunk_offsets[(keys[src[i]] >> shift) & (num_buckets - 1)]++] =
+            src[i];
+      }
+      return Status::Ok();
+    }));
+
+    std::swap(src, dst);
+  }
+
+  // After an odd number of passes the sorted elements are in the scratch
+  // buffer, move them back to the input range.
+  if (src == scratch.data()) {
+    throw_if_not_ok(parallel_for(tp, 0, num_chunks, [&](uint64_t c) {
+      const uint64_t start = std::min(c * chunk_size, num_elements);
+      const uint64_t stop = std::min(start + chunk_size, num_elements);
+      std::copy(src + start, src + stop, begin + start);
+      return Status::Ok();
+    }));
+  }
+}
+
 /**
  * Call the given function on each element in the given iterator range.
  *
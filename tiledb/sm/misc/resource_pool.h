@@ -34,7 +34,12 @@
 #ifndef RESOURCE_POOL_H
 #define RESOURCE_POOL_H
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "tiledb/common/common.h"
@@ -95,6 +100,126 @@ class ResourceGuard {
   typename P<T>::resource_handle h_;
 };
 
+/**
+ * Lock-free book keeping of the unused resource indexes of a pool.
+ *
+ * Acquisition first tries a per-thread cached slot, so that a thread
+ * releasing and re-acquiring gets its last (hot) resource back without
+ * touching shared state, and falls back to a global free list maintained
+ * as a lock-free stack. The head of the stack carries a modification
+ * counter next to the index to rule out ABA problems. When the list runs
+ * dry, takers steal from the cached slots of other threads so that cached
+ * indexes never starve them.
+ */
+class FreeIndexList {
+ public:
+  /** Value denoting the absence of an index. */
+  static constexpr unsigned int no_index =
+      std::numeric_limits<unsigned int>::max();
+
+  /** Constructor taking the number of pooled indexes. */
+  explicit FreeIndexList(unsigned int n)
+      : next_(n)
+      , head_(pack(0, n == 0 ? no_index : 0))
+      , cached_(
+            std::max(1u, std::min(n, std::thread::hardware_concurrency()))) {
+    for (unsigned int i = 0; i < n; i++) {
+      next_[i].store(i + 1 == n ? no_index : i + 1, std::memory_order_relaxed);
+    }
+    for (auto& slot : cached_) {
+      slot.store(no_index, std::memory_order_relaxed);
+    }
+  }
+
+  /** Takes an index, returning `no_index` when none is free. */
+  unsigned int take() {
+    // Fast path: the slot this thread released into last.
+    auto n = cached_[thread_slot()].exchange(no_index);
+    if (n != no_index) {
+      return n;
+    }
+
+    return pop();
+  }
+
+  /**
+   * Takes an index cached by another thread, returning `no_index` when all
+   * slots are empty.
+   */
+  unsigned int steal() {
+    for (auto& slot : cached_) {
+      auto n = slot.exchange(no_index);
+      if (n != no_index) {
+        return n;
+      }
+    }
+
+    return no_index;
+  }
+
+  /** Releases an index, caching it in the thread's slot when possible. */
+  void release(unsigned int n) {
+    unsigned int expected = no_index;
+    if (!cached_[thread_slot()].compare_exchange_strong(expected, n)) {
+      push(n);
+    }
+  }
+
+ private:
+  /** Packs a modification counter and an index into a stack head. */
+  static constexpr uint64_t pack(uint64_t counter, unsigned int n) {
+    return (counter << 32) | n;
+  }
+
+  /** Pops an index off the free list, `no_index` when it is empty. */
+  unsigned int pop() {
+    auto head = head_.load();
+    for (;;) {
+      const auto n = static_cast<unsigned int>(head);
+      if (n == no_index) {
+        return no_index;
+      }
+
+      // A stale next value makes the compare exchange fail on the
+      // modification counter.
+      const auto next = next_[n].load();
+      if (head_.compare_exchange_weak(head, pack((head >> 32) + 1, next))) {
+        return n;
+      }
+    }
+  }
+
+  /** Pushes an index onto the free list. */
+  void push(unsigned int n) {
+    auto head = head_.load();
+    for (;;) {
+      next_[n].store(static_cast<unsigned int>(head));
+      if (head_.compare_exchange_weak(head, pack((head >> 32) + 1, n))) {
+        return;
+      }
+    }
+  }
+
+  /** Returns the cached slot index of the calling thread. */
+  unsigned int thread_slot() const {
+    static thread_local const size_t hash =
+        std::hash<std::thread::id>()(std::this_thread::get_id());
+    return static_cast<unsigned int>(hash % cached_.size());
+  }
+
+  /** Next free index after each index, when on the free list. */
+  std::vector<std::atomic<unsigned int>> next_;
+
+  /**
+   * Top of the free list: modification counter in the high 32 bits, index
+   * in the low 32 bits.
+   */
+  std::atomic<uint64_t> head_;
+
+  /** Per-thread cached indexes, indexed by hashed thread id. */
+  std::vector<std::atomic<unsigned int>> cached_;
+};
+
 template <class T>
 class ResourcePool {
  public:
@@ -103,28 +228,27 @@ class ResourcePool {
   /** Constructor. */
   ResourcePool(unsigned int n)
       : resources_(n)
-      , unused_(n)
-      , unused_idx_(n - 1) {
-    for (unsigned int i = 0; i < n; i++)
-      unused_[i] = i;
+      , unused_(n) {
   }
 
   /** Take a resource from the pool. */
   resource_handle take() {
-    std::lock_guard x(m_);
-    if (unused_idx_ == -1)
+    auto n = unused_.take();
+    if (n == FreeIndexList::no_index) {
+      n = unused_.steal();
+    }
+    if (n == FreeIndexList::no_index)
       throw std::runtime_error(
           std::string(
               "Ran out of resources in resource pool with contained type: ") +
           typeid(T).name());
-    return ResourceHandle(*this, unused_[unused_idx_--]);
+    return ResourceHandle(*this, n);
   }
 
  private:
   /** Release a resource from the pool. */
   void release(unsigned int n) {
-    std::lock_guard x(m_);
-    unused_[++unused_idx_] = n;
+    unused_.release(n);
   }
 
   /** Access a resource from the internal vector. */
@@ -135,14 +259,8 @@ class ResourcePool {
   /** Vector of resources. */
   std::vector<T> resources_;
 
-  /** Vector of unused resource indexes. */
-  std::vector<unsigned int> unused_;
-
-  /** Index of the last valid resource in the unused vector. */
-  int unused_idx_;
-
-  /** Mutex protecting unused_ and unused_idx_. */
-  std::mutex m_;
+  /** Unused resource indexes. */
+  FreeIndexList unused_;
 
   friend class ResourceHandle<T, tiledb::sm::ResourcePool>;
 };
@@ -156,31 +274,43 @@ class BlockingResourcePool {
   BlockingResourcePool(unsigned int n)
       : resources_(n)
       , unused_(n)
-      , unused_idx_(n - 1)
       , num_blocked_threads_(0) {
-    for (unsigned int i = 0; i < n; i++)
-      unused_[i] = i;
   }
 
   /** Take a resource from the pool. */
   resource_handle take() {
+    auto n = try_take();
+    if (n != FreeIndexList::no_index) {
+      return {*this, n};
+    }
+
+    // Slow path: block until a resource is released.
     std::unique_lock<std::mutex> lck(m_);
-    while (resources_exhausted()) {
-      // block until available again
+    for (;;) {
+      // Publish the wait before the last attempt so that a concurrent
+      // release either sees a blocked thread and notifies, or this attempt
+      // sees the released resource.
       num_blocked_threads_++;
+      n = try_take();
+      if (n != FreeIndexList::no_index) {
+        num_blocked_threads_--;
+        return {*this, n};
+      }
       exhaustion_cv_.wait(lck);
       num_blocked_threads_--;
     }
-    return {*this, unused_[unused_idx_--]};
   }
 
  private:
   /** Release a resource from the pool. */
   void release(unsigned int n) {
-    std::unique_lock<std::mutex> lck(m_);
-    unused_[++unused_idx_] = n;
-    if (blocked_threads())
+    unused_.release(n);
+    if (blocked_threads()) {
+      // The lock pairs the notification with the wait: a thread between its
+      // last failed attempt and the wait still holds the mutex.
+      std::lock_guard<std::mutex> lck(m_);
       exhaustion_cv_.notify_one();
+    }
   }
 
   /** Access a resource from the internal vector. */
@@ -188,33 +318,37 @@ class BlockingResourcePool {
     return resources_.at(n);
   }
 
-  /** Check if resource pool is full without acquiring a lock */
-  inline bool resources_exhausted() {
-    return (unused_idx_ == -1);
+  /**
+   * Take an unused resource index, stealing the cached index of another
+   * thread when the global list is exhausted. Returns
+   * `FreeIndexList::no_index` when no resource is free.
+   */
+  unsigned int try_take() {
+    auto n = unused_.take();
+    if (n == FreeIndexList::no_index) {
+      n = unused_.steal();
+    }
+    return n;
   }
 
   /** Check if there is any blocked thread without acquiring a lock */
   inline bool blocked_threads() {
-    return (num_blocked_threads_ > 0);
+    return (num_blocked_threads_.load() > 0);
   }
 
   /** Vector of resources. */
   std::vector<T> resources_;
 
-  /** Vector of unused resource indexes. */
-  std::vector<unsigned int> unused_;
-
-  /** Index of the last valid resource in the unused vector. */
-  int unused_idx_;
+  /** Unused resource indexes. */
+  FreeIndexList unused_;
 
   /** Number of threads blocked waiting for resource availability. */
-  int num_blocked_threads_;
+  std::atomic<int> num_blocked_threads_;
 
   /** For signal-and-waiting on resource availability. */
   std::condition_variable exhaustion_cv_;
 
-  /** Mutex protecting unused_, unused_idx_, exhaustion_cv_ and
-   * num_blocked_threads_ */
+  /** Mutex pairing exhaustion_cv_ waits with notifications. */
   std::mutex m_;
 
   friend class ResourceHandle<T, tiledb::sm::BlockingResourcePool>;
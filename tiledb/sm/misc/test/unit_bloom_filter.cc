@@ -0,0 +1,92 @@
+/**
+ * @file   unit_bloom_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `BloomFilter` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/bloom_filter.h"
+
+#include <string>
+
+using namespace tiledb::sm;
+
+TEST_CASE("BloomFilter: No false negatives", "[bloom-filter]") {
+  BloomFilter filter(1000, 10);
+  for (uint64_t v = 0; v < 1000; v++) {
+    filter.insert(&v, sizeof(v));
+  }
+
+  for (uint64_t v = 0; v < 1000; v++) {
+    CHECK(filter.maybe_contains(&v, sizeof(v)));
+  }
+}
+
+TEST_CASE("BloomFilter: False positive rate", "[bloom-filter]") {
+  BloomFilter filter(1000, 10);
+  for (uint64_t v = 0; v < 1000; v++) {
+    filter.insert(&v, sizeof(v));
+  }
+
+  // At 10 bits per value the theoretical false positive rate is under 1%,
+  // leave generous headroom for hash quality.
+  uint64_t false_positives = 0;
+  for (uint64_t v = 1000; v < 101000; v++) {
+    false_positives += filter.maybe_contains(&v, sizeof(v));
+  }
+  CHECK(false_positives < 5000);
+}
+
+TEST_CASE("BloomFilter: Variable sized values", "[bloom-filter]") {
+  BloomFilter filter(100, 10);
+  for (uint64_t v = 0; v < 100; v++) {
+    auto str = "value-" + std::to_string(v);
+    filter.insert(str.data(), str.size());
+  }
+
+  for (uint64_t v = 0; v < 100; v++) {
+    auto str = "value-" + std::to_string(v);
+    CHECK(filter.maybe_contains(str.data(), str.size()));
+  }
+
+  // Prefixes and the empty value were not inserted.
+  CHECK(!filter.maybe_contains("value-", 6));
+  CHECK(!filter.maybe_contains("", 0));
+}
+
+TEST_CASE("BloomFilter: Degenerate sizes", "[bloom-filter]") {
+  // Zero expected values and zero bits per value still yield a usable,
+  // minimally sized filter.
+  BloomFilter filter(0, 0);
+  CHECK(filter.size() == 8);
+
+  uint64_t v = 42;
+  filter.insert(&v, sizeof(v));
+  CHECK(filter.maybe_contains(&v, sizeof(v)));
+}
@@ -0,0 +1,128 @@
+/**
+ * @file   unit_fast_div_mod.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `FastDivMod` magic-number divisor.
+ */
+
+#include <random>
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/fast_div_mod.h"
+
+using tiledb::sm::FastDivMod;
+
+/** Checks `div` and `mod` against the hardware divider. */
+static void check_divisor(uint64_t divisor, uint64_t dividend) {
+  FastDivMod d(divisor);
+  CHECK(d.divisor() == divisor);
+  CHECK(d.div(dividend) == dividend / divisor);
+  CHECK(d.mod(dividend) == dividend % divisor);
+}
+
+TEST_CASE("FastDivMod: edge divisors and dividends", "[fast_div_mod]") {
+  std::vector<uint64_t> divisors = {
+      1,
+      2,
+      3,
+      5,
+      7,
+      10,
+      641,
+      1000,
+      (UINT64_C(1) << 32) - 1,
+      (UINT64_C(1) << 32),
+      (UINT64_C(1) << 32) + 1,
+      (UINT64_C(1) << 63) - 1,
+      (UINT64_C(1) << 63),
+      (UINT64_C(1) << 63) + 1,
+      UINT64_MAX - 1,
+      UINT64_MAX};
+  for (auto divisor : divisors) {
+    std::vector<uint64_t> dividends = {
+        0,
+        1,
+        divisor - 1,
+        divisor,
+        divisor + 1,
+        2 * divisor - 1,
+        2 * divisor,
+        UINT64_MAX - 1,
+        UINT64_MAX};
+    for (auto dividend : dividends) {
+      check_divisor(divisor, dividend);
+    }
+  }
+}
+
+TEST_CASE("FastDivMod: small exhaustive sweep", "[fast_div_mod]") {
+  for (uint64_t divisor = 1; divisor <= 64; ++divisor) {
+    FastDivMod d(divisor);
+    for (uint64_t dividend = 0; dividend <= 4096; ++dividend) {
+      REQUIRE(d.div(dividend) == dividend / divisor);
+      REQUIRE(d.mod(dividend) == dividend % divisor);
+    }
+  }
+}
+
+TEST_CASE("FastDivMod: random divisors and dividends", "[fast_div_mod]") {
+  std::mt19937_64 rng(0xdeadbeef);
+  for (int i = 0; i < 1000; ++i) {
+    auto divisor = rng() | 1;
+    // Mix full-range, small and power-of-two-ish divisors.
+    if (i % 3 == 1) {
+      divisor = (divisor % 1000) + 1;
+    } else if (i % 3 == 2) {
+      divisor = UINT64_C(1) << (rng() % 64);
+    }
+    FastDivMod d(divisor);
+    for (int j = 0; j < 100; ++j) {
+      auto dividend = rng();
+      REQUIRE(d.div(dividend) == dividend / divisor);
+      REQUIRE(d.mod(dividend) == dividend % divisor);
+    }
+  }
+}
+
+TEST_CASE("FastDivMod: coordinate decomposition", "[fast_div_mod]") {
+  // Decompose linear positions in a 3x4x5 grid, as the dense tiler does.
+  const uint64_t strides[3] = {20, 5, 1};
+  FastDivMod divisors[3] = {
+      FastDivMod(strides[0]), FastDivMod(strides[1]), FastDivMod(strides[2])};
+  for (uint64_t pos = 0; pos < 60; ++pos) {
+    auto tmp = pos;
+    uint64_t coords[3];
+    for (unsigned d = 0; d < 3; ++d) {
+      coords[d] = divisors[d].div(tmp);
+      tmp -= coords[d] * strides[d];
+    }
+    CHECK(coords[0] == pos / 20);
+    CHECK(coords[1] == (pos % 20) / 5);
+    CHECK(coords[2] == pos % 5);
+  }
+}
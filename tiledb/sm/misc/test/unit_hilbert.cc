@@ -90,3 +90,31 @@ TEST_CASE("Hilbert: Test default bits, getter", "[hilbert][bits][getter]") {
   CHECK(h.bits() == 21);
   CHECK(h.dim_num() == 3);
 }
+
+TEST_CASE("Hilbert: Test batch conversion", "[hilbert][batch]") {
+  // The batch conversion must agree with the cell-at-a-time conversion.
+  for (int dim_num : {1, 2, 3, 4}) {
+    Hilbert h(dim_num);
+    Hilbert h_scalar(dim_num);
+    uint64_t max_val = ((uint64_t)1 << h.bits()) - 1;
+
+    uint64_t cell_num = 256;
+    std::vector<uint64_t> coords(cell_num * dim_num);
+    uint64_t seed = 0x9e3779b97f4a7c15;
+    for (auto& c : coords) {
+      seed = seed * 6364136223846793005 + 1442695040888963407;
+      c = seed % (max_val + 1);
+    }
+
+    std::vector<uint64_t> expected(cell_num);
+    for (uint64_t c = 0; c < cell_num; ++c) {
+      std::vector<uint64_t> cell_coords(
+          coords.begin() + c * dim_num, coords.begin() + (c + 1) * dim_num);
+      expected[c] = h_scalar.coords_to_hilbert(cell_coords.data());
+    }
+
+    std::vector<uint64_t> hilbert_values(cell_num);
+    h.coords_to_hilbert(coords.data(), cell_num, hilbert_values.data());
+    CHECK(hilbert_values == expected);
+  }
+}
@@ -0,0 +1,155 @@
+/**
+ * @file unit_resource_pool.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file tests the resource pools.
+ */
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/resource_pool.h"
+
+using namespace tiledb::sm;
+
+TEST_CASE(
+    "ResourcePool: hand out every resource at most once",
+    "[resource-pool]") {
+  ResourcePool<int> pool(3);
+
+  std::vector<ResourcePool<int>::resource_handle> handles;
+  for (int i = 0; i < 3; i++) {
+    handles.emplace_back(pool.take());
+    handles.back().get() = i;
+  }
+
+  // The pool is exhausted.
+  CHECK_THROWS(pool.take());
+
+  // A released resource can be taken again and keeps its state.
+  handles.back().release();
+  handles.pop_back();
+  auto handle = pool.take();
+  CHECK(handle.get() == 2);
+  CHECK_THROWS(pool.take());
+  handle.release();
+
+  for (auto& h : handles) {
+    h.release();
+  }
+}
+
+TEST_CASE(
+    "ResourcePool: a released resource is cached for the thread",
+    "[resource-pool]") {
+  ResourcePool<int> pool(4);
+
+  auto handle = pool.take();
+  handle.get() = 42;
+  handle.release();
+
+  // The same thread gets its last resource back.
+  auto again = pool.take();
+  CHECK(again.get() == 42);
+  again.release();
+}
+
+TEST_CASE(
+    "BlockingResourcePool: blocked takers are served by releases",
+    "[resource-pool]") {
+  BlockingResourcePool<int> pool(2);
+
+  auto h1 = pool.take();
+  auto h2 = pool.take();
+
+  // A third taker blocks until a resource is released.
+  std::atomic<bool> taken{false};
+  std::thread taker([&]() {
+    auto h = pool.take();
+    taken = true;
+    h.release();
+  });
+
+  CHECK(!taken);
+  h1.release();
+  taker.join();
+  CHECK(taken);
+  h2.release();
+}
+
+TEST_CASE(
+    "BlockingResourcePool: concurrent take and release", "[resource-pool]") {
+  const unsigned int num_resources = 4;
+  const unsigned int num_threads = 8;
+  const unsigned int num_iterations = 1000;
+
+  BlockingResourcePool<unsigned int> pool(num_resources);
+
+  // Every resource holds its own index so that concurrent owners would be
+  // detected as a torn counter below.
+  {
+    std::vector<BlockingResourcePool<unsigned int>::resource_handle> handles;
+    for (unsigned int i = 0; i < num_resources; i++) {
+      handles.emplace_back(pool.take());
+      handles.back().get() = 0;
+    }
+    for (auto& h : handles) {
+      h.release();
+    }
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&]() {
+      for (unsigned int i = 0; i < num_iterations; i++) {
+        auto handle = pool.take();
+        // No other thread may hold the resource while we increment it.
+        handle.get()++;
+        handle.release();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // All increments are accounted for.
+  unsigned int total = 0;
+  std::vector<BlockingResourcePool<unsigned int>::resource_handle> handles;
+  for (unsigned int i = 0; i < num_resources; i++) {
+    handles.emplace_back(pool.take());
+    total += handles.back().get();
+  }
+  CHECK(total == num_threads * num_iterations);
+  for (auto& h : handles) {
+    h.release();
+  }
+}
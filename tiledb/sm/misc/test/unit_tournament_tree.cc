@@ -0,0 +1,143 @@
+/**
+ * @file   unit_tournament_tree.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `TournamentTree` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/tournament_tree.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace tiledb::sm;
+
+/**
+ * Min-first queue of `uint64_t`, following `std::priority_queue` semantics
+ * where `top()` is the element all others compare greater to.
+ */
+using MinTree = TournamentTree<uint64_t, std::greater<uint64_t>>;
+
+TEST_CASE("TournamentTree: Empty", "[tournament-tree][empty]") {
+  MinTree tree(4, std::greater<uint64_t>());
+  CHECK(tree.empty());
+  CHECK(tree.size() == 0);
+
+  tree.emplace(2, 10);
+  CHECK(!tree.empty());
+  CHECK(tree.size() == 1);
+  CHECK(tree.top() == 10);
+
+  tree.pop();
+  CHECK(tree.empty());
+  CHECK(tree.size() == 0);
+}
+
+TEST_CASE("TournamentTree: Single source", "[tournament-tree][single-source]") {
+  MinTree tree(1, std::greater<uint64_t>());
+  for (uint64_t v = 0; v < 10; v++) {
+    tree.emplace(0, v);
+  }
+
+  for (uint64_t v = 0; v < 10; v++) {
+    CHECK(tree.top() == v);
+    tree.pop();
+  }
+  CHECK(tree.empty());
+}
+
+TEST_CASE("TournamentTree: Merge sorted runs", "[tournament-tree][merge]") {
+  const size_t num_sources = GENERATE(1, 2, 3, 7, 8, 100);
+  const size_t run_length = 50;
+
+  std::mt19937_64 rng(1234);
+  std::vector<uint64_t> expected;
+  MinTree tree(num_sources, std::greater<uint64_t>());
+  for (size_t s = 0; s < num_sources; s++) {
+    std::vector<uint64_t> run(run_length);
+    for (auto& v : run) {
+      v = rng();
+      expected.emplace_back(v);
+    }
+    std::sort(run.begin(), run.end());
+
+    for (auto v : run) {
+      tree.emplace(s, v);
+    }
+  }
+  std::sort(expected.begin(), expected.end());
+
+  CHECK(tree.size() == expected.size());
+  for (auto v : expected) {
+    CHECK(tree.top() == v);
+    tree.pop();
+  }
+  CHECK(tree.empty());
+}
+
+TEST_CASE("TournamentTree: Interleaved pushes and pops", "[tournament-tree][refill]") {
+  const size_t num_sources = 5;
+  const size_t run_length = 20;
+
+  // Pop each winner and immediately refill its source with the next element
+  // of that source's run, mirroring how the sparse global order reader
+  // advances fragments.
+  std::vector<std::vector<uint64_t>> runs(num_sources);
+  std::vector<size_t> positions(num_sources, 0);
+  std::mt19937_64 rng(5678);
+  std::vector<uint64_t> expected;
+  for (auto& run : runs) {
+    run.resize(run_length);
+    for (auto& v : run) {
+      v = rng();
+      expected.emplace_back(v);
+    }
+    std::sort(run.begin(), run.end());
+  }
+  std::sort(expected.begin(), expected.end());
+
+  MinTree tree(num_sources, std::greater<uint64_t>());
+  for (size_t s = 0; s < num_sources; s++) {
+    tree.emplace(s, runs[s][positions[s]++]);
+  }
+
+  for (auto v : expected) {
+    CHECK(tree.top() == v);
+
+    // Find the source of the winner and refill it before popping.
+    for (size_t s = 0; s < num_sources; s++) {
+      if (positions[s] < run_length && runs[s][positions[s] - 1] == v) {
+        tree.emplace(s, runs[s][positions[s]++]);
+        break;
+      }
+    }
+    tree.pop();
+  }
+  CHECK(tree.empty());
+}
@@ -0,0 +1,203 @@
+/**
+ * @file   tournament_tree.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This defines a tournament-tree (tournament tree) priority queue for k-way
+ * merging of sorted runs.
+ */
+
+#ifndef TILEDB_TOURNAMENT_TREE_H
+#define TILEDB_TOURNAMENT_TREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include "tiledb/common/common.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A tournament tree merging a fixed number of sorted runs, one per source.
+ *
+ * The interface follows `std::priority_queue`: with comparator `cmp`,
+ * `top()` is the element for which `cmp(top, other)` is `false` for every
+ * other queued element. Unlike a binary heap, popping an element performs a
+ * single leaf-to-root replay of `ceil(log2(k))` comparisons with no sift
+ * branches, which makes merges over many sources (e.g. hundreds of
+ * fragments) considerably cheaper.
+ *
+ * Elements are pushed to a specific source and queue in FIFO order within
+ * that source. The caller must push elements of a source in run order, that
+ * is a newly pushed element may not beat the element pushed before it. Only
+ * the front of each run participates in the tournament, so pushing to a
+ * non-empty source is O(1).
+ *
+ * @tparam T Element type.
+ * @tparam Compare Strict weak ordering, `std::priority_queue` semantics.
+ */
+template <class T, class Compare>
+class TournamentTree {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param num_sources Number of sources to merge.
+   * @param cmp Comparator.
+   */
+  TournamentTree(size_t num_sources, const Compare& cmp)
+      : cmp_(cmp)
+      , num_sources_(std::max<size_t>(num_sources, 1))
+      , runs_(num_sources_)
+      , tree_(2 * num_sources_, invalid_source)
+      , size_(0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if no elements are queued. */
+  inline bool empty() const {
+    return size_ == 0;
+  }
+
+  /** Returns the number of queued elements. */
+  inline size_t size() const {
+    return size_;
+  }
+
+  /** Returns the current tournament winner. */
+  inline const T& top() const {
+    assert(size_ > 0);
+    return runs_[tree_[1]].front();
+  }
+
+  /**
+   * Adds an element to the run of a source.
+   *
+   * @param source Source the element belongs to.
+   * @param args Arguments forwarded to the element constructor.
+   */
+  template <class... Args>
+  void emplace(size_t source, Args&&... args) {
+    assert(source < num_sources_);
+    runs_[source].emplace_back(std::forward<Args>(args)...);
+    size_++;
+
+    // The front of the run only changes when the run was empty.
+    if (runs_[source].size() == 1) {
+      replay(source);
+    }
+  }
+
+  /** Removes the current tournament winner. */
+  void pop() {
+    assert(size_ > 0);
+    auto source = tree_[1];
+    runs_[source].pop_front();
+    size_--;
+    replay(source);
+  }
+
+ private:
+  /* ********************************* */
+  /*       PRIVATE DECLARATIONS        */
+  /* ********************************* */
+
+  /** Sentinel for a source with no queued elements. */
+  static constexpr size_t invalid_source = std::numeric_limits<size_t>::max();
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Comparator. */
+  Compare cmp_;
+
+  /** Number of sources. */
+  size_t num_sources_;
+
+  /** Queued elements, in run order, per source. */
+  std::vector<std::deque<T>> runs_;
+
+  /**
+   * Tournament nodes, holding source indices. Source `i` sits at leaf
+   * `num_sources_ + i`, each internal node holds the winner among the
+   * sources below it and the overall winner is at index 1.
+   */
+  std::vector<size_t> tree_;
+
+  /** Number of queued elements. */
+  size_t size_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns `true` if source `a` beats source `b` in the tournament. */
+  inline bool beats(size_t a, size_t b) const {
+    if (a == invalid_source || runs_[a].empty()) {
+      return false;
+    }
+
+    if (b == invalid_source || runs_[b].empty()) {
+      return true;
+    }
+
+    return cmp_(runs_[b].front(), runs_[a].front());
+  }
+
+  /**
+   * Replays the tournament on the path from the leaf of a source to the
+   * root, after the front of that source's run changed.
+   */
+  void replay(size_t source) {
+    auto node = num_sources_ + source;
+    tree_[node] = runs_[source].empty() ? invalid_source : source;
+    for (node /= 2; node >= 1; node /= 2) {
+      auto left = tree_[2 * node];
+      auto right = tree_[2 * node + 1];
+      tree_[node] = beats(right, left) ? right : left;
+    }
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TOURNAMENT_TREE_H
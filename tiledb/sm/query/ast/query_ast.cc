@@ -223,12 +223,18 @@ void ASTNodeVal::rewrite_enumeration_conditions(
     uint64_t curr_offset = 0;
     uint64_t num_offsets = 0;
 
+    // Compile the set members to a membership table over the enumeration
+    // code domain so that set lookups on the rewritten codes become a
+    // single indexed load per cell.
+    member_code_table_.assign(enumeration->elem_count(), 0);
+
     for (auto& member : members_) {
       auto idx = enumeration->index_of(member.data(), member.size());
       if (idx == constants::enumeration_missing_value) {
         continue;
       }
 
+      member_code_table_[idx] = 1;
       utils::safe_integral_cast_to_datatype(idx, attr->type(), curr_data);
       data_writer.write(curr_data.data(), curr_data.size());
       offsets_writer.write(curr_offset);
@@ -411,6 +417,10 @@ const QueryConditionOp& ASTNodeVal::get_op() const {
   return op_;
 }
 
+const std::vector<uint8_t>& ASTNodeVal::get_member_code_table() const {
+  return member_code_table_;
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeVal::get_children() const {
   throw std::runtime_error(
       "ASTNodeVal::get_children: Cannot get children from an AST value node.");
@@ -582,6 +592,12 @@ const QueryConditionOp& ASTNodeExpr::get_op() const {
       "ASTNodeExpr::get_op: Cannot get op from an AST expression node.");
 }
 
+const std::vector<uint8_t>& ASTNodeExpr::get_member_code_table() const {
+  throw std::runtime_error(
+      "ASTNodeExpr::get_member_code_table: Cannot get a member code table "
+      "from an AST expression node.");
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeExpr::get_children() const {
   return nodes_;
 }
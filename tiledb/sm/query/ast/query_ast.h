@@ -198,6 +198,18 @@ class ASTNode {
    */
   virtual const QueryConditionOp& get_op() const = 0;
 
+  /**
+   * @brief Get the set membership table over the enumeration code domain.
+   * Element `c` is `1` if code `c` is a member of this node's IN/NOT_IN
+   * list. Only built when the node was rewritten for an enumerated
+   * attribute, empty otherwise.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const std::vector<uint8_t>& The membership table.
+   */
+  virtual const std::vector<uint8_t>& get_member_code_table() const = 0;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -312,6 +324,7 @@ class ASTNodeVal : public ASTNode {
       , data_(rhs.data_)
       , offsets_(rhs.offsets_)
       , is_null_(rhs.is_null_)
+      , member_code_table_(rhs.member_code_table_)
       , op_(rhs.op_)
       , use_enumeration_(rhs.use_enumeration_) {
     generate_members();
@@ -326,6 +339,7 @@ class ASTNodeVal : public ASTNode {
       , offsets_(rhs.offsets_)
       , is_null_(rhs.is_null_)
       , members_(rhs.members_)
+      , member_code_table_(rhs.member_code_table_)
       , op_(negate_query_condition_op(rhs.op_))
       , use_enumeration_(rhs.use_enumeration_) {
     generate_members();
@@ -478,6 +492,15 @@ class ASTNodeVal : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the set membership table over the enumeration code domain.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const std::vector<uint8_t>& The membership table.
+   */
+  const std::vector<uint8_t>& get_member_code_table() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -533,6 +556,12 @@ class ASTNodeVal : public ASTNode {
   /** The set members if this is a set membership node. */
   std::unordered_set<std::string_view> members_;
 
+  /**
+   * Membership table over the enumeration code domain for IN/NOT_IN nodes
+   * rewritten for an enumerated attribute, empty otherwise.
+   */
+  std::vector<uint8_t> member_code_table_;
+
   /** The comparison operator. */
   QueryConditionOp op_;
 
@@ -726,6 +755,15 @@ class ASTNodeExpr : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the set membership table over the enumeration code domain.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const std::vector<uint8_t>& The membership table.
+   */
+  const std::vector<uint8_t>& get_member_code_table() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
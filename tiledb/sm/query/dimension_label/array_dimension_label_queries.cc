@@ -59,6 +59,9 @@ ArrayDimensionLabelQueries::ArrayDimensionLabelQueries(
     const optional<std::string>& fragment_name)
     : resources_(resources)
     , storage_manager_(storage_manager)
+    , label_range_cache_(array->label_range_cache())
+    , label_range_cache_keys_by_dim_idx_(subarray.dim_num())
+    , cached_label_ranges_by_dim_idx_(subarray.dim_num(), nullptr)
     , label_range_queries_by_dim_idx_(subarray.dim_num(), nullptr)
     , label_data_queries_by_dim_idx_(subarray.dim_num())
     , range_query_status_{QueryStatus::UNINITIALIZED}
@@ -118,8 +121,16 @@ ArrayDimensionLabelQueries::ArrayDimensionLabelQueries(
           "Failed to add dimension label queries. Unknown query type " +
           query_type_str(array->get_query_type()) + ".");
   }
-  range_query_status_ =
-      range_queries_.empty() ? QueryStatus::COMPLETED : QueryStatus::INPROGRESS;
+  // Cached label range resolutions still need to be applied to the parent
+  // query in `process_range_queries`, so only mark the range queries as
+  // completed if there are neither queries nor cached resolutions.
+  const bool has_cached_ranges = std::any_of(
+      cached_label_ranges_by_dim_idx_.cbegin(),
+      cached_label_ranges_by_dim_idx_.cend(),
+      [](const auto& cached) { return cached != nullptr; });
+  range_query_status_ = (range_queries_.empty() && !has_cached_ranges) ?
+                            QueryStatus::COMPLETED :
+                            QueryStatus::INPROGRESS;
 }
 
 bool ArrayDimensionLabelQueries::completed() const {
@@ -178,6 +189,25 @@ void ArrayDimensionLabelQueries::process_range_queries(Query* parent_query) {
       [&](const uint32_t dim_idx) {
         auto& range_query = label_range_queries_by_dim_idx_[dim_idx];
         try {
+          // Update data queries and the parent query with cached dimension
+          // ranges, if the resolution was found in the cache.
+          const auto& cached = cached_label_ranges_by_dim_idx_[dim_idx];
+          if (cached != nullptr) {
+            for (auto& data_query : label_data_queries_by_dim_idx_[dim_idx]) {
+              data_query->add_index_ranges_from_label(
+                  0,
+                  cached->ranges_are_points_,
+                  cached->data_.data(),
+                  cached->count_);
+            }
+            parent_query->add_index_ranges_from_label(
+                dim_idx,
+                cached->ranges_are_points_,
+                cached->data_.data(),
+                cached->count_);
+            return Status::Ok();
+          }
+
           if (range_query) {
             // Process the query.
             range_query->init();
@@ -200,12 +230,27 @@ void ArrayDimensionLabelQueries::process_range_queries(Query* parent_query) {
             }
             parent_query->add_index_ranges_from_label(
                 dim_idx, is_point_ranges, range_data, count);
+
+            // Cache the resolution for subsequent queries with the same
+            // label ranges.
+            const auto& key = label_range_cache_keys_by_dim_idx_[dim_idx];
+            if (!key.empty()) {
+              label_range_cache_.insert(
+                  key,
+                  is_point_ranges,
+                  count,
+                  range_data,
+                  *index_data->data_size());
+            }
           }
           return Status::Ok();
         } catch (const StatusException& err) {
+          const std::string label_desc = range_query ?
+              "label '" + range_query->dim_label_name() + "'" :
+              "dimension " + std::to_string(dim_idx);
           throw DimensionLabelQueryException(
-              "Failed to process and update index ranges for label '" +
-              range_query->dim_label_name() + "'. " + err.what());
+              "Failed to process and update index ranges for " + label_desc +
+              ". " + err.what());
         }
       }));
 
@@ -247,6 +292,22 @@ void ArrayDimensionLabelQueries::add_read_queries(
       // Get subarray ranges.
       auto& label_ranges = subarray.ranges_for_label(label_name);
 
+      // Check the cache of resolved label ranges on the parent array. On a
+      // hit, skip the range query entirely; the cached index ranges are
+      // applied in `process_range_queries`.
+      if (label_range_cache_.enabled()) {
+        auto key =
+            label_range_cache_key(label_name, *dim_label, label_ranges);
+        auto cached = label_range_cache_.lookup(key);
+        if (cached != nullptr) {
+          cached_label_ranges_by_dim_idx_[dim_idx] = cached;
+          continue;
+        }
+
+        // Remember the key to insert the resolution after processing.
+        label_range_cache_keys_by_dim_idx_[dim_idx] = std::move(key);
+      }
+
       // Create the range query.
       range_queries_.emplace_back(tdb_new(
           DimensionLabelQuery,
@@ -355,6 +416,35 @@ void ArrayDimensionLabelQueries::add_write_queries(
   }
 }
 
+std::string ArrayDimensionLabelQueries::label_range_cache_key(
+    const std::string& label_name,
+    Array& dim_label,
+    const std::vector<Range>& label_ranges) {
+  std::string key = label_name;
+  key.push_back('\0');
+
+  // The fragment list of the opened dimension label acts as the version of
+  // the label data: any write changes the list and thus the key.
+  for (const auto& frag_md : dim_label.fragment_metadata()) {
+    key += frag_md->fragment_uri().to_string();
+    key.push_back('\0');
+  }
+
+  // Append the raw range data, with sizes to keep the key unambiguous for
+  // var sized label ranges.
+  for (const auto& range : label_ranges) {
+    const auto range_size = range.size();
+    const auto start_size = range.start_size();
+    key.append(reinterpret_cast<const char*>(&range_size), sizeof(range_size));
+    key.append(reinterpret_cast<const char*>(&start_size), sizeof(start_size));
+    if (range_size != 0) {
+      key.append(static_cast<const char*>(range.data()), range_size);
+    }
+  }
+
+  return key;
+}
+
 shared_ptr<Array> ArrayDimensionLabelQueries::open_dimension_label(
     Array* array,
     const URI& dim_label_uri,
@@ -34,6 +34,7 @@
 #define TILEDB_ARRAY_DIMENSION_LABEL_QUERIES_H
 
 #include "tiledb/common/common.h"
+#include "tiledb/sm/cache/label_range_cache.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/query/dimension_label/dimension_label_query.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -176,6 +177,29 @@ class ArrayDimensionLabelQueries {
   /** Map from label name to dimension label opened by this query. */
   std::unordered_map<std::string, shared_ptr<Array>> dimension_labels_;
 
+  /** Cache of resolved label ranges on the parent array. */
+  LabelRangeCache& label_range_cache_;
+
+  /**
+   * Cache keys for pending label range queries, by dimension index.
+   *
+   * Note: This vector is always sized to the number of dimensions in the
+   * array. The key is empty if there is no range query on the dimension or
+   * the cache is disabled.
+   */
+  std::vector<std::string> label_range_cache_keys_by_dim_idx_;
+
+  /**
+   * Cached label range resolutions, by dimension index.
+   *
+   * Note: This vector is always sized to the number of dimensions in the
+   * array. Dimensions with a cache hit skip their range query and apply the
+   * cached index ranges instead; if there is no hit on the dimension, it
+   * contains a null pointer.
+   */
+  std::vector<shared_ptr<const CachedLabelRanges>>
+      cached_label_ranges_by_dim_idx_;
+
   /** Dimension label range queries */
   std::vector<tdb_unique_ptr<DimensionLabelQuery>> range_queries_;
 
@@ -244,6 +268,23 @@ class ArrayDimensionLabelQueries {
       const std::unordered_map<std::string, QueryBuffer>& label_buffers,
       const std::unordered_map<std::string, QueryBuffer>& array_buffers);
 
+  /**
+   * Returns the cache key for resolving a set of label ranges.
+   *
+   * The key covers the label name, the fragment list of the opened dimension
+   * label and the label ranges, so any write to the dimension label changes
+   * the key and the cached resolution cannot be hit stale.
+   *
+   * @param label_name Name of the dimension label.
+   * @param dim_label Opened dimension label.
+   * @param label_ranges Label ranges to resolve index ranges from.
+   * @returns The cache key.
+   */
+  static std::string label_range_cache_key(
+      const std::string& label_name,
+      Array& dim_label,
+      const std::vector<Range>& label_ranges);
+
   /**
    * Opens a dimension label.
    *
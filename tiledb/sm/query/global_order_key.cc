@@ -0,0 +1,223 @@
+/**
+ * @file tiledb/sm/query/global_order_key.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class GlobalOrderKey.
+ */
+
+#include "tiledb/sm/query/global_order_key.h"
+
+#include <bit>
+
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/domain.h"
+#include "tiledb/sm/enums/layout.h"
+#include "tiledb/sm/query/readers/result_tile.h"
+#include "tiledb/type/apply_with_type.h"
+
+namespace tiledb::sm {
+
+namespace {
+
+/** Maps a coordinate to its tile index along a dimension. */
+template <class T>
+uint64_t map_tile_idx(const Dimension* dim, const void* coord) {
+  auto tile_extent = *(const T*)dim->tile_extent().data();
+  auto domain = (const T*)dim->domain().data();
+  return Dimension::tile_idx(*(const T*)coord, domain[0], tile_extent);
+}
+
+/**
+ * Maps a coordinate to an unsigned integer ordered like the coordinate
+ * values: integral values as their offset from the domain low, floating
+ * point values through an order preserving reinterpretation of their IEEE
+ * representation.
+ */
+template <class T>
+uint64_t map_cell_value(const Dimension* dim, const void* coord) {
+  if constexpr (std::is_integral_v<T>) {
+    typedef typename std::make_unsigned<T>::type unsigned_t;
+    auto domain = (const T*)dim->domain().data();
+    return static_cast<unsigned_t>(
+        static_cast<unsigned_t>(*(const T*)coord) -
+        static_cast<unsigned_t>(domain[0]));
+  } else {
+    typedef std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t> unsigned_t;
+    auto v = *(const T*)coord;
+    // Collapse -0.0 onto +0.0 so that equal coordinates get equal keys.
+    auto bits = v == T(0) ? unsigned_t(0) : std::bit_cast<unsigned_t>(v);
+    constexpr unsigned_t sign = unsigned_t(1) << (sizeof(T) * 8 - 1);
+    return (bits & sign) ? static_cast<unsigned_t>(~bits) : (bits | sign);
+  }
+}
+
+}  // namespace
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+GlobalOrderKey::GlobalOrderKey(const Domain& domain) {
+  // Hilbert cell order sorts on precomputed hilbert values already.
+  if (domain.cell_order() == Layout::HILBERT) {
+    return;
+  }
+
+  // Gather the fields the global order comparators inspect, in comparison
+  // order, with the number of bits needed to represent each one exactly.
+  struct PlannedField {
+    Field field;
+    unsigned bits;
+  };
+  std::vector<PlannedField> planned;
+
+  // Tile index along a dimension. Dimensions without a tile extent are
+  // skipped, like the comparators skip them.
+  auto plan_tile_field = [&](unsigned d) {
+    auto dim = domain.dimension_ptr(d);
+    if (dim->var_size() || !dim->tile_extent()) {
+      return true;
+    }
+
+    return type::apply_with_type(
+        [&](auto v) {
+          using T = decltype(v);
+          if constexpr (type::TileDBNumeric<T>) {
+            auto dom = (const T*)dim->domain().data();
+            auto tile_extent = *(const T*)dim->tile_extent().data();
+            const uint64_t max_idx =
+                Dimension::tile_idx(dom[1], dom[0], tile_extent);
+            planned.emplace_back(PlannedField{
+                {map_tile_idx<T>, dim, d, 0, 0},
+                static_cast<unsigned>(std::bit_width(max_idx))});
+            return true;
+          } else {
+            return false;
+          }
+        },
+        dim->type());
+  };
+
+  // Coordinate value along a dimension.
+  auto plan_cell_field = [&](unsigned d) {
+    auto dim = domain.dimension_ptr(d);
+    if (dim->var_size()) {
+      return false;
+    }
+
+    return type::apply_with_type(
+        [&](auto v) {
+          using T = decltype(v);
+          if constexpr (type::TileDBNumeric<T>) {
+            unsigned bits;
+            if constexpr (std::is_integral_v<T>) {
+              typedef typename std::make_unsigned<T>::type unsigned_t;
+              auto dom = (const T*)dim->domain().data();
+              const uint64_t span = static_cast<unsigned_t>(
+                  static_cast<unsigned_t>(dom[1]) -
+                  static_cast<unsigned_t>(dom[0]));
+              bits = static_cast<unsigned>(std::bit_width(span));
+            } else {
+              bits = sizeof(T) * 8;
+            }
+            planned.emplace_back(
+                PlannedField{{map_cell_value<T>, dim, d, 0, 0}, bits});
+            return true;
+          } else {
+            return false;
+          }
+        },
+        dim->type());
+  };
+
+  // Plan the comparison sequence, stopping at the first field that cannot
+  // be packed: the fields before it still form an order consistent prefix.
+  const auto dim_num = domain.dim_num();
+  bool packable = true;
+  if (domain.tile_order() == Layout::ROW_MAJOR) {
+    for (unsigned d = 0; packable && d < dim_num; ++d) {
+      packable = plan_tile_field(d);
+    }
+  } else {  // COL_MAJOR
+    for (int32_t d = static_cast<int32_t>(dim_num) - 1; packable && d >= 0;
+         d--) {
+      packable = plan_tile_field(static_cast<unsigned>(d));
+    }
+  }
+  if (packable) {
+    if (domain.cell_order() == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; packable && d < dim_num; ++d) {
+        packable = plan_cell_field(d);
+      }
+    } else {  // COL_MAJOR
+      for (int32_t d = static_cast<int32_t>(dim_num) - 1; packable && d >= 0;
+           d--) {
+        packable = plan_cell_field(static_cast<unsigned>(d));
+      }
+    }
+  }
+
+  // Assign each field its position in the key, most significant first.
+  // Fields are packed exactly while they fit; the first field that does
+  // not fit is truncated to the remaining bits and ends the key.
+  unsigned remaining = 64;
+  for (auto& planned_field : planned) {
+    if (planned_field.bits == 0) {
+      // A single tile or a single coordinate value: nothing to compare.
+      continue;
+    }
+
+    auto field = planned_field.field;
+    if (planned_field.bits >= remaining) {
+      field.shift_in = planned_field.bits - remaining;
+      fields_.emplace_back(field);
+      break;
+    }
+
+    remaining -= planned_field.bits;
+    field.shift_out = remaining;
+    fields_.emplace_back(field);
+  }
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+uint64_t GlobalOrderKey::key(const ResultTile& tile, uint64_t pos) const {
+  uint64_t key = 0;
+  for (const auto& field : fields_) {
+    key |= (field.map(field.dim, tile.coord(pos, field.dim_idx)) >>
+            field.shift_in)
+           << field.shift_out;
+  }
+
+  return key;
+}
+
+}  // namespace tiledb::sm
@@ -0,0 +1,124 @@
+/**
+ * @file tiledb/sm/query/global_order_key.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class GlobalOrderKey.
+ */
+
+#ifndef TILEDB_QUERY_GLOBAL_ORDER_KEY_H
+#define TILEDB_QUERY_GLOBAL_ORDER_KEY_H
+
+#include <vector>
+
+#include "tiledb/common/common.h"
+
+namespace tiledb::sm {
+
+class Dimension;
+class Domain;
+class ResultTile;
+
+/**
+ * Computes per-cell packed keys that sort like the global order of a
+ * domain.
+ *
+ * A key concatenates, most significant first, the quantities the global
+ * order comparators inspect: the tile index along every dimension in tile
+ * order, followed by the coordinate value along every dimension in cell
+ * order, each mapped monotonically to an unsigned integer. Fields are
+ * packed exactly while they fit into 64 bits; the first field that does
+ * not fit is truncated to the remaining bits and ends the key. Two keys
+ * therefore sort like the cells they were computed from whenever they
+ * differ, and only comparisons of equal keys have to fall back to the full
+ * multi-dimension comparison.
+ */
+class GlobalOrderKey {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   */
+  explicit GlobalOrderKey(const Domain& domain);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Returns `true` if keys can be computed for the domain, `false` when no
+   * field of the comparison sequence could be packed or the cell order is
+   * Hilbert.
+   */
+  inline bool enabled() const {
+    return !fields_.empty();
+  }
+
+  /**
+   * Computes the key of one cell.
+   *
+   * @param tile The result tile holding the cell.
+   * @param pos The position of the cell in the tile.
+   * @return The packed key.
+   */
+  uint64_t key(const ResultTile& tile, uint64_t pos) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** One packed field of the key. */
+  struct Field {
+    /** Maps a coordinate to an unsigned integer ordered like the field. */
+    uint64_t (*map)(const Dimension*, const void*);
+
+    /** The dimension the field is computed on. */
+    const Dimension* dim;
+
+    /** The index of the dimension in the domain. */
+    unsigned dim_idx;
+
+    /** Right shift truncating the mapped value to the field width. */
+    unsigned shift_in;
+
+    /** Left shift placing the field inside the key. */
+    unsigned shift_out;
+  };
+
+  /** The packed fields, most significant first. */
+  std::vector<Field> fields_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_QUERY_GLOBAL_ORDER_KEY_H
@@ -224,14 +224,6 @@ Reader::ReadState* Reader::read_state() {
   return &read_state_;
 }
 
-Status Reader::complete_read_loop() {
-  if (offsets_extra_element_) {
-    RETURN_NOT_OK(add_extra_offset());
-  }
-
-  return Status::Ok();
-}
-
 uint64_t Reader::get_timestamp(const ResultCoords& rc) const {
   const auto f = rc.tile_->frag_idx();
   if (fragment_metadata_[f]->has_timestamps()) {
@@ -289,7 +281,7 @@ Status Reader::dowork() {
       RETURN_NOT_OK(read_state_.split_current());
 
       if (read_state_.unsplittable_) {
-        return complete_read_loop();
+        return Status::Ok();
       }
     } else {
       bool has_results = false;
@@ -303,7 +295,7 @@ Status Reader::dowork() {
         read_state_.unsplittable_ = false;
 
       if (has_results || read_state_.done()) {
-        return complete_read_loop();
+        return Status::Ok();
       }
 
       RETURN_NOT_OK(read_state_.next());
@@ -1039,6 +1031,11 @@ Status Reader::copy_partitioned_fixed_cells(
   uint64_t fill_value_size = (uint64_t)fill_value.size();
   const bool is_timestamps = *name == constants::timestamps;
 
+  // A copy plan resolves the source buffers and copy strategy once per
+  // tile; consecutive cell slabs usually come from the same tile.
+  const ResultTile* plan_tile = nullptr;
+  optional<ResultTile::CopyPlan> plan;
+
   // Calculate the partition to operate on.
   const uint64_t cs_idx_start =
       partition_idx == 0 ? 0 : cs_partitions->at(partition_idx - 1);
@@ -1086,27 +1083,17 @@ Status Reader::copy_partitioned_fixed_cells(
         timestamp = fragment_timestamp(cs.tile_);
       }
 
-      if (stride == UINT64_MAX) {
-        if (!nullable)
-          RETURN_NOT_OK(cs.tile_->read(
-              *name, buffer, offset, cs.start_, cs_length, timestamp));
-        else
-          RETURN_NOT_OK(cs.tile_->read_nullable(
-              *name, buffer, offset, cs.start_, cs_length, buffer_validity));
-      } else {
-        auto cell_offset = offset;
-        auto start = cs.start_;
-        for (uint64_t j = 0; j < cs_length; ++j) {
-          if (!nullable)
-            RETURN_NOT_OK(cs.tile_->read(
-                *name, buffer, cell_offset, start, 1, timestamp));
-          else
-            RETURN_NOT_OK(cs.tile_->read_nullable(
-                *name, buffer, cell_offset, start, 1, buffer_validity));
-          cell_offset += cell_size;
-          start += stride;
-        }
+      if (cs.tile_ != plan_tile) {
+        plan.emplace(*cs.tile_, *name, nullable, timestamp);
+        plan_tile = cs.tile_;
       }
+
+      plan->copy(
+          cs.start_,
+          cs_length,
+          stride == UINT64_MAX ? 1 : stride,
+          buffer + offset,
+          buffer_validity + offset / cell_size * constants::cell_validity_size);
     }
   }
 
@@ -1148,9 +1135,13 @@ Status Reader::copy_var_cells(
     return Status::Ok();
   }
 
-  // Copy result cell slabs in parallel
+  // Copy result cell slabs in parallel. Dispatch on the configured offsets
+  // bitsize so that 32-bit offsets are written directly at 4 bytes/cell.
+  auto copy_partitioned = offsets_bitsize_ == 32 ?
+                              &Reader::copy_partitioned_var_cells<uint32_t> :
+                              &Reader::copy_partitioned_var_cells<uint64_t>;
   std::function<Status(size_t)> copy_fn = std::bind(
-      &Reader::copy_partitioned_var_cells,
+      copy_partitioned,
       this,
       std::placeholders::_1,
       &name,
@@ -1170,6 +1161,21 @@ Status Reader::copy_var_cells(
   if (array_schema_.is_nullable(name))
     *(buffers_[name].validity_vector_.buffer_size()) = total_validity_size;
 
+  // The offset one past the last cell is the total var size, writing it here
+  // produces the final buffer layout without revisiting it after the copy.
+  // The destination computation already accounted for the extra element.
+  if (offsets_extra_element_) {
+    uint64_t extra = total_var_size;
+    if (offsets_format_mode_ == "elements") {
+      extra /= datatype_size(array_schema_.type(name));
+    }
+    auto buffer = static_cast<unsigned char*>(buffers_[name].buffer_);
+    memcpy(
+        buffer + total_offset_size - offsets_bytesize(),
+        &extra,
+        offsets_bytesize());
+  }
+
   return Status::Ok();
 }
 
@@ -1316,6 +1322,7 @@ Status Reader::compute_var_cell_destinations(
   return Status::Ok();
 }
 
+template <class OffType>
 Status Reader::copy_partitioned_var_cells(
     const size_t partition_idx,
     const std::string* const name,
@@ -1331,7 +1338,6 @@ Status Reader::copy_partitioned_var_cells(
   auto buffer = (unsigned char*)it->second.buffer_;
   auto buffer_var = (unsigned char*)it->second.buffer_var_;
   auto buffer_validity = (unsigned char*)it->second.validity_vector_.buffer();
-  auto offset_size = offsets_bytesize();
   ByteVecValue fill_value;
   uint8_t fill_value_validity = 0;
   if (array_schema_.is_attr(*name)) {
@@ -1380,14 +1386,14 @@ Status Reader::copy_partitioned_var_cells(
       auto offset_dest = buffer + offset_offsets;
       auto var_offset = (*var_offsets_per_cs)[arr_offset + dest_vec_idx];
       auto var_dest = buffer_var + var_offset;
-      auto validity_dest = buffer_validity + (offset_offsets / offset_size);
+      auto validity_dest = buffer_validity + (offset_offsets / sizeof(OffType));
 
       if (offsets_format_mode_ == "elements") {
         var_offset = var_offset / attr_datatype_size;
       }
 
-      // Copy offset
-      std::memcpy(offset_dest, &var_offset, offset_size);
+      // Write the offset at the configured width.
+      *reinterpret_cast<OffType*>(offset_dest) = (OffType)var_offset;
 
       // Copy variable-sized value
       if (cs.tile_ == nullptr || cs.tile_->tile_tuple(*name) == nullptr) {
@@ -2085,42 +2091,6 @@ Status Reader::sparse_read() {
   return Status::Ok();
 }
 
-Status Reader::add_extra_offset() {
-  for (const auto& it : buffers_) {
-    const auto& name = it.first;
-    if (!array_schema_.var_size(name))
-      continue;
-
-    // Do not apply offset for empty results because we will
-    // write backwards and corrupt memory we don't own.
-    if (*it.second.buffer_size_ == 0)
-      continue;
-
-    // The buffer should always be 0 or divisible by the bytesize.
-    assert(!(*it.second.buffer_size_ < offsets_bytesize()));
-
-    auto buffer = static_cast<unsigned char*>(it.second.buffer_);
-    if (offsets_format_mode_ == "bytes") {
-      memcpy(
-          buffer + *it.second.buffer_size_ - offsets_bytesize(),
-          it.second.buffer_var_size_,
-          offsets_bytesize());
-    } else if (offsets_format_mode_ == "elements") {
-      auto elements =
-          *it.second.buffer_var_size_ / datatype_size(array_schema_.type(name));
-      memcpy(
-          buffer + *it.second.buffer_size_ - offsets_bytesize(),
-          &elements,
-          offsets_bytesize());
-    } else {
-      return logger_->status(Status_ReaderError(
-          "Cannot add extra offset to buffer; Unsupported offsets format"));
-    }
-  }
-
-  return Status::Ok();
-}
-
 bool Reader::sparse_tile_overwritten(
     unsigned frag_idx, uint64_t tile_idx) const {
   const auto& mbr = fragment_metadata_[frag_idx]->mbr(tile_idx);
@@ -567,6 +567,8 @@ class Reader : public ReaderBase, public IQueryStrategy {
    * cell slabs into the corresponding result buffers for the
    * partition in `cs_partitions` at index `partition_idx`.
    *
+   * @tparam OffType The offset type to write to the user offsets buffer
+   *     (`uint32_t` or `uint64_t`, per `sm.var_offsets.bitsize`).
    * @param name The partition index.
    * @param name The targeted attribute/dimension.
    * @param stride If it is `UINT64_MAX`, then the cells in the result
@@ -580,6 +582,7 @@ class Reader : public ReaderBase, public IQueryStrategy {
    * @param cs_partitions The cell slab partitions to operate on.
    * @return Status
    */
+  template <class OffType>
   Status copy_partitioned_var_cells(
       size_t partition_idx,
       const std::string* name,
@@ -676,11 +679,6 @@ class Reader : public ReaderBase, public IQueryStrategy {
   /** Performs a read on a sparse array. */
   Status sparse_read();
 
-  /**
-   * Adds an extra offset in the end of the offsets buffer indicating the
-   * returned data size if an attribute is var-sized.
-   */
-  Status add_extra_offset();
 
   /**
    * Returns true if the input tile's MBR of the input fragment is fully
@@ -736,8 +734,6 @@ class Reader : public ReaderBase, public IQueryStrategy {
       std::vector<ResultCoords>::iterator iter_begin,
       std::vector<ResultCoords>::iterator iter_end) const;
 
-  /** Perform necessary checks before exiting a read loop */
-  Status complete_read_loop();
 
   /**
    * Get the timestamp value for a result coords.
@@ -55,9 +55,12 @@
 #include "tiledb/sm/query/writers/ordered_writer.h"
 #include "tiledb/sm/query/writers/unordered_writer.h"
 #include "tiledb/sm/rest/rest_client.h"
+#include "tiledb/sm/serialization/query.h"
+#include "tiledb/sm/stats/trace.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/tile/writer_tile_tuple.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -101,6 +104,7 @@ Query::Query(
     , opened_array_(array->opened_array())
     , array_schema_(array->array_schema_latest_ptr())
     , config_(resources_.config())
+    , query_config_(config_)
     , type_(array_->get_query_type())
     , layout_(
           (type_ == QueryType::READ || array_schema_->dense()) ?
@@ -154,11 +158,7 @@ Query::Query(
 }
 
 Query::~Query() {
-  bool found = false;
-  bool use_malloc_trim = false;
-  const Status& st =
-      config_.get<bool>("sm.mem.malloc_trim", &use_malloc_trim, &found);
-  if (st.ok() && found && use_malloc_trim) {
+  if (query_config_.malloc_trim()) {
     tdb_malloc_trim();
   }
 };
@@ -465,6 +465,11 @@ Status Query::finalize() {
 
   throw_if_not_ok(strategy_->finalize());
 
+  // A completed global order write no longer needs its checkpoint file.
+  if (type_ == QueryType::WRITE && layout_ == Layout::GLOBAL_ORDER) {
+    RETURN_NOT_OK(remove_global_write_state_checkpoint());
+  }
+
   status_ = QueryStatus::COMPLETED;
   return Status::Ok();
 }
@@ -498,6 +503,10 @@ Status Query::submit_and_finalize() {
   throw_if_not_ok(storage_manager_->query_submit(this));
 
   throw_if_not_ok(strategy_->finalize());
+
+  // A completed global order write no longer needs its checkpoint file.
+  RETURN_NOT_OK(remove_global_write_state_checkpoint());
+
   status_ = QueryStatus::COMPLETED;
 
   return Status::Ok();
@@ -766,6 +775,7 @@ const std::vector<UpdateValue>& Query::update_values() const {
 }
 
 Status Query::cancel() {
+  cancellation_source_.cancel();
   status_ = QueryStatus::FAILED;
   return Status::Ok();
 }
@@ -779,6 +789,9 @@ Status Query::process() {
 
   status_ = QueryStatus::INPROGRESS;
 
+  // Tag the spans traced during this submission with a fresh query id.
+  stats::Tracer::ScopedQuery trace_query;
+
   // Check if we need to process label ranges and update subarray before
   // continuing to the main query.
   if (dim_label_queries_ && !dim_label_queries_->completed_range_queries()) {
@@ -837,39 +850,21 @@ Status Query::process() {
   }
 
   if (type_ == QueryType::READ) {
-    auto cd = array_schema_->get_current_domain();
-    if (!cd->empty()) {
-      // See if any data was written outside of the current domain.
-      bool all_ned_contained_in_current_domain = true;
-      for (auto& meta : fragment_metadata_) {
-        if (!cd->includes(meta->non_empty_domain())) {
-          all_ned_contained_in_current_domain = false;
-        }
-      }
-
-      for (Domain::dimension_size_type d = 0; d < array_schema_->dim_num();
-           d++) {
-        if (subarray_.is_set(d)) {
-          // Make sure all ranges are contained in the current domain.
-          for (auto& range : subarray_.ranges_for_dim(d)) {
-            if (!cd->includes(d, range)) {
-              throw QueryException(
-                  "A range was set outside of the current domain.");
-            }
-          }
-        } else if (!all_ned_contained_in_current_domain) {
-          // Add ranges to make sure all data read is contained in the current
-          // domain.
-          auto range_copy = cd->ndrectangle()->get_range(d);
-          subarray_.add_range(d, std::move(range_copy));
-        }
-      }
-    }
+    // Constrain the subarray to the current domain before any range
+    // computation, so that regions retired by a domain shrink are never
+    // considered by tile overlap or relevant fragment computations.
+    subarray_.clip_to_current_domain();
   }
 
   // Update query status.
   status_ = QueryStatus::INPROGRESS;
 
+  // Resume a checkpointed global order write before the first submission.
+  if (type_ == QueryType::WRITE && layout_ == Layout::GLOBAL_ORDER &&
+      !only_dim_label_query()) {
+    RETURN_NOT_OK(restore_global_write_state());
+  }
+
   // Process query
   Status st{Status::Ok()};
   if (!only_dim_label_query()) {
@@ -887,6 +882,13 @@ Status Query::process() {
     return st;
   }
 
+  // Persist the write state of a checkpointed global order write so that
+  // a restarted process can resume from this submission.
+  if (type_ == QueryType::WRITE && layout_ == Layout::GLOBAL_ORDER &&
+      !only_dim_label_query()) {
+    RETURN_NOT_OK(checkpoint_global_write_state());
+  }
+
   // Check if the query is completed or not.
   if ((only_dim_label_query() || !strategy_->incomplete()) &&
       (!dim_label_queries_ || dim_label_queries_->completed())) {
@@ -906,6 +908,76 @@ Status Query::process() {
   return Status::Ok();
 }
 
+Status Query::restore_global_write_state() {
+  auto resume =
+      config_.get<bool>("sm.query.global_writer.resume", Config::must_find);
+  if (!resume) {
+    return Status::Ok();
+  }
+
+  auto checkpoint_file = config_.get<std::string>(
+      "sm.query.global_writer.checkpoint_file", Config::must_find);
+  if (checkpoint_file.empty()) {
+    return logger_->status(Status_QueryError(
+        "Cannot resume global order write; "
+        "'sm.query.global_writer.checkpoint_file' is not set"));
+  }
+
+  // Only the first submission restores state; subsequent submissions of
+  // the same query carry it in memory.
+  auto global_writer = dynamic_cast<GlobalOrderWriter*>(strategy_.get());
+  if (global_writer == nullptr ||
+      global_writer->get_global_state() != nullptr) {
+    return Status::Ok();
+  }
+
+  URI checkpoint_uri(checkpoint_file);
+  bool exists;
+  RETURN_NOT_OK(resources_.vfs().is_file(checkpoint_uri, &exists));
+  if (!exists) {
+    return logger_->status(Status_QueryError(
+        "Cannot resume global order write; checkpoint file '" +
+        checkpoint_file + "' does not exist"));
+  }
+
+  return serialization::global_write_state_checkpoint_deserialize(
+      this, checkpoint_uri, resources_);
+}
+
+Status Query::checkpoint_global_write_state() {
+  auto checkpoint_file = config_.get<std::string>(
+      "sm.query.global_writer.checkpoint_file", Config::must_find);
+  if (checkpoint_file.empty()) {
+    return Status::Ok();
+  }
+
+  auto global_writer = dynamic_cast<GlobalOrderWriter*>(strategy_.get());
+  if (global_writer == nullptr ||
+      global_writer->get_global_state() == nullptr) {
+    return Status::Ok();
+  }
+
+  return serialization::global_write_state_checkpoint_serialize(
+      this, URI(checkpoint_file), resources_);
+}
+
+Status Query::remove_global_write_state_checkpoint() {
+  auto checkpoint_file = config_.get<std::string>(
+      "sm.query.global_writer.checkpoint_file", Config::must_find);
+  if (checkpoint_file.empty()) {
+    return Status::Ok();
+  }
+
+  URI checkpoint_uri(checkpoint_file);
+  bool exists;
+  RETURN_NOT_OK(resources_.vfs().is_file(checkpoint_uri, &exists));
+  if (exists) {
+    RETURN_NOT_OK(resources_.vfs().remove_file(checkpoint_uri));
+  }
+
+  return Status::Ok();
+}
+
 IQueryStrategy* Query::strategy(bool skip_checks_serialization) {
   if (strategy_ == nullptr) {
     throw_if_not_ok(create_strategy(skip_checks_serialization));
@@ -976,6 +1048,7 @@ void Query::set_config(const Config& config) {
         "[set_config] Cannot set config after initialization.");
   }
   config_.inherit(config);
+  query_config_ = QueryConfig(config_);
 
   query_memory_tracker_->refresh_memory_budget(
       get_effective_memory_budget(config_, memory_budget_));
@@ -1267,7 +1340,7 @@ Status Query::set_offsets_buffer(
         *buffer_offsets_size / constants::cell_var_offset_size;
 
     const bool offsets_extra_element_ =
-        config_.get<bool>("sm.var_offsets.extra_element", Config::must_find);
+        query_config_.var_offsets_extra_element();
 
     if (offsets_extra_element_) {
       // the offsets buffer has `ncoords + 1` elements so that each coordinate
@@ -1683,6 +1756,54 @@ void Query::set_stats(const stats::StatsData& data) {
   stats_->populate_with_data(data);
 }
 
+std::string Query::resource_report() const {
+  auto data = stats_->snapshot();
+
+  // Sort the maps so that the report is deterministic.
+  std::vector<std::pair<std::string, double>> sorted_timers(
+      data.timers().begin(), data.timers().end());
+  std::vector<std::pair<std::string, uint64_t>> sorted_counters(
+      data.counters().begin(), data.counters().end());
+  std::sort(sorted_timers.begin(), sorted_timers.end());
+  std::sort(sorted_counters.begin(), sorted_counters.end());
+
+  std::stringstream ss;
+  ss << "{\n";
+
+  ss << "  \"counters\": {\n";
+  bool printed_first = false;
+  for (const auto& counter : sorted_counters) {
+    if (printed_first) {
+      ss << ",\n";
+    }
+    ss << "    \"" << counter.first << "\": " << counter.second;
+    printed_first = true;
+  }
+  ss << (printed_first ? "\n" : "") << "  },\n";
+
+  ss << "  \"timers\": {\n";
+  printed_first = false;
+  for (const auto& timer : sorted_timers) {
+    if (printed_first) {
+      ss << ",\n";
+    }
+    ss << "    \"" << timer.first << "\": " << timer.second;
+    printed_first = true;
+  }
+  ss << (printed_first ? "\n" : "") << "  },\n";
+
+  ss << "  \"memory\": {\n";
+  ss << "    \"peak_bytes\": "
+     << query_memory_tracker_->get_peak_memory_usage() << ",\n";
+  ss << "    \"budget_bytes\": "
+     << query_memory_tracker_->get_modern_memory_budget() << "\n";
+  ss << "  }\n";
+
+  ss << "}";
+
+  return ss.str();
+}
+
 shared_ptr<Buffer> Query::rest_scratch() const {
   return rest_scratch_;
 }
@@ -1824,6 +1945,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
       layout_,
       condition_,
       default_channel_aggregates_,
+      cancellation_source_,
       skip_checks_serialization);
   if (type_ == QueryType::WRITE || type_ == QueryType::MODIFY_EXCLUSIVE) {
     if (layout_ == Layout::COL_MAJOR || layout_ == Layout::ROW_MAJOR) {
@@ -43,8 +43,10 @@
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
+#include "tiledb/sm/config/query_config.h"
 #include "tiledb/sm/enums/query_status_details.h"
 #include "tiledb/sm/fragment/written_fragment_info.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -314,13 +316,19 @@ class Query {
   QueryBuffer buffer(const std::string& name) const;
 
   /**
-   * Marks a query that has not yet been started as failed. This should not be
-   * called asynchronously to cancel an in-progress query; for that use the
-   * parent StorageManager's cancellation mechanism.
+   * Marks a query as failed and requests cooperative cancellation of its
+   * in-progress work through the query's cancellation source. In-flight
+   * processing observes the source at its checkpoints (tile reads, filter
+   * chunks, merge iterations) and aborts promptly.
    * @return Status
    */
   Status cancel();
 
+  /** Returns the cancellation source observed by the query's strategy. */
+  inline const CancellationSource& cancellation_source() const {
+    return cancellation_source_;
+  }
+
   /**
    * Finalizes the query, flushing all internal state.
    * Applicable to write queries only.
@@ -610,6 +618,16 @@ class Query {
    */
   const Config& config() const;
 
+  /**
+   * Get the typed snapshot of the config parameters consulted on hot
+   * paths.
+   *
+   * @return QueryConfig from query
+   */
+  inline const QueryConfig& query_config() const {
+    return query_config_;
+  }
+
   /**
    * Used by serialization to set the estimated result size
    *
@@ -733,6 +751,16 @@ class Query {
    */
   void set_stats(const stats::StatsData& data);
 
+  /**
+   * Returns a structured JSON report of the resources consumed by this
+   * query: the counters and timers of the query's stats subtree (IO
+   * bytes and requests, unfilter and copy CPU, etc.) and the memory
+   * high-water mark and budget of the query's memory tracker. The report
+   * is built from data collected on the query's own stats child, so
+   * concurrent queries on the same context do not pollute it.
+   */
+  std::string resource_report() const;
+
   /** Returns the scratch space used for REST requests. */
   shared_ptr<Buffer> rest_scratch() const;
 
@@ -756,8 +784,7 @@ class Query {
 
   /** Returns true if the config is set to allow separate attribute writes. */
   inline bool allow_separate_attribute_writes() const {
-    return config_.get<bool>(
-        "sm.allow_separate_attribute_writes", Config::must_find);
+    return query_config_.allow_separate_attribute_writes();
   }
 
   /** Returns a reference to the internal WrittenFragmentInfo list */
@@ -952,6 +979,12 @@ class Query {
   /** The config for query-level parameters only. */
   Config config_;
 
+  /**
+   * Typed snapshot of the config parameters consulted on hot paths.
+   * Rebuilt by `set_config`.
+   */
+  QueryConfig query_config_;
+
   /** A function that will be called upon the completion of an async query. */
   std::function<void(void*)> callback_;
 
@@ -970,6 +1003,9 @@ class Query {
   /** The query status. */
   QueryStatus status_;
 
+  /** Cancellation source handed to the strategy for cooperative aborts. */
+  CancellationSource cancellation_source_;
+
   /** The storage manager. */
   StorageManager* storage_manager_;
 
@@ -1170,6 +1206,29 @@ class Query {
    */
   Status check_tile_alignment() const;
 
+  /**
+   * Applicable only to global order writes. If
+   * `sm.query.global_writer.resume` is set, restores the global write
+   * state from the configured checkpoint file before the first
+   * submission, so that the write resumes the in-progress fragment of a
+   * previous process.
+   */
+  Status restore_global_write_state();
+
+  /**
+   * Applicable only to global order writes. If a checkpoint file is
+   * configured via `sm.query.global_writer.checkpoint_file`, persists the
+   * global write state to it after a successful submission.
+   */
+  Status checkpoint_global_write_state();
+
+  /**
+   * Applicable only to global order writes. Removes the configured
+   * checkpoint file, if any, once the write has been finalized and the
+   * checkpoint is no longer needed.
+   */
+  Status remove_global_write_state_checkpoint();
+
   /**
    * Reset coord buffer markers at end of a global write submit.
    * This will allow for the user to properly set the next write batch.
@@ -42,6 +42,7 @@
 #include "tiledb/sm/query/readers/result_cell_slab.h"
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -89,13 +90,15 @@ QueryCondition::QueryCondition(
 QueryCondition::QueryCondition(const QueryCondition& rhs)
     : condition_marker_(rhs.condition_marker_)
     , condition_index_(rhs.condition_index_)
-    , tree_(rhs.tree_ == nullptr ? nullptr : rhs.tree_->clone()) {
+    , tree_(rhs.tree_ == nullptr ? nullptr : rhs.tree_->clone())
+    , adaptive_order_(rhs.adaptive_order_) {
 }
 
 QueryCondition::QueryCondition(QueryCondition&& rhs)
     : condition_marker_(std::move(rhs.condition_marker_))
     , condition_index_(rhs.condition_index_)
-    , tree_(std::move(rhs.tree_)) {
+    , tree_(std::move(rhs.tree_))
+    , adaptive_order_(rhs.adaptive_order_) {
 }
 
 QueryCondition::~QueryCondition() {
@@ -106,6 +109,8 @@ QueryCondition& QueryCondition::operator=(const QueryCondition& rhs) {
     condition_marker_ = rhs.condition_marker_;
     condition_index_ = rhs.condition_index_;
     tree_ = rhs.tree_ == nullptr ? nullptr : rhs.tree_->clone();
+    adaptive_order_ = rhs.adaptive_order_;
+    adaptive_tree_ = nullptr;
   }
 
   return *this;
@@ -115,6 +120,8 @@ QueryCondition& QueryCondition::operator=(QueryCondition&& rhs) {
   condition_marker_ = std::move(rhs.condition_marker_);
   condition_index_ = std::move(rhs.condition_index_);
   tree_ = std::move(rhs.tree_);
+  adaptive_order_ = rhs.adaptive_order_;
+  adaptive_tree_ = nullptr;
   return *this;
 }
 
@@ -190,6 +197,10 @@ Status QueryCondition::negate(
   return Status::Ok();
 }
 
+void QueryCondition::set_adaptive_order(const bool adaptive_order) {
+  adaptive_order_ = adaptive_order;
+}
+
 bool QueryCondition::empty() const {
   return tree_ == nullptr;
 }
@@ -607,6 +618,16 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NOT_IN> {
   }
 };
 
+/**
+ * Returns `true` for comparison operators that vectorize over numeric cells.
+ * The set membership operators chase pointers and cannot be vectorized.
+ */
+static constexpr bool vectorizable_op(QueryConditionOp op) {
+  return op == QueryConditionOp::LT || op == QueryConditionOp::LE ||
+         op == QueryConditionOp::GT || op == QueryConditionOp::GE ||
+         op == QueryConditionOp::EQ || op == QueryConditionOp::NE;
+}
+
 template <typename T, QueryConditionOp Op, typename CombinationOp>
 void QueryCondition::apply_ast_node(
     const tdb_unique_ptr<ASTNode>& node,
@@ -1460,6 +1481,28 @@ void QueryCondition::apply_ast_node_dense(
       uint64_t buffer_offset = ((start * stride) + src_cell) * cell_size;
       const uint64_t buffer_offset_inc = stride * cell_size;
 
+      // Columnar fast path for numeric comparisons: typed loads with the
+      // condition value hoisted into a local let the compiler emit SIMD
+      // compares.
+      if constexpr (std::is_arithmetic_v<T> && vectorizable_op(Op)) {
+        if (cell_size == sizeof(T)) {
+          const T* values = tile.data_as<T>() + (start * stride) + src_cell;
+          const T condition_value =
+              *static_cast<const T*>(condition_value_content);
+          for (uint64_t c = 0; c < result_buffer.size(); ++c) {
+            const bool cmp = BinaryCmp<T, Op>::cmp(
+                &values[c * stride], sizeof(T), &condition_value, sizeof(T));
+            bool buffer_validity_val =
+                buffer_validity == nullptr ?
+                    true :
+                    buffer_validity[(start + c) * stride] != 0;
+            result_buffer[c] = combination_op(
+                result_buffer[c], (uint8_t)cmp && buffer_validity_val);
+          }
+          return;
+        }
+      }
+
       // Iterate through each cell in this slab.
       for (uint64_t c = 0; c < result_buffer.size(); ++c) {
         // Get the cell value.
@@ -2428,6 +2471,22 @@ void QueryCondition::apply_ast_node_sparse(
 
     // Iterate through each cell.
     for (uint64_t c = 0; c < buffer_offsets_el; ++c) {
+      // Skip cells whose result is already decided: under AND a zero stays
+      // zero and under OR a set cell stays set, as the comparison result is
+      // at most one. Var-sized comparisons are expensive and this loop does
+      // not vectorize anyway.
+      if constexpr (std::is_same_v<
+                        CombinationOp,
+                        std::multiplies<BitmapType>>) {
+        if (result_bitmap[c] == 0) {
+          continue;
+        }
+      } else if constexpr (std::is_same_v<CombinationOp, QCMax<BitmapType>>) {
+        if (result_bitmap[c] != 0) {
+          continue;
+        }
+      }
+
       // Check the previous cell here, which breaks vectorization but as this
       // is string data requiring a strcmp which cannot be vectorized, this is
       // ok.
@@ -2459,6 +2518,60 @@ void QueryCondition::apply_ast_node_sparse(
     const uint64_t cell_size = tile.cell_size();
     const uint64_t buffer_el = tile.size() / cell_size;
 
+    // Columnar fast path for numeric comparisons: typed loads with the
+    // condition value hoisted into a local let the compiler emit SIMD
+    // compares, which the generic loop's untyped, variable-stride accesses
+    // prevent.
+    if constexpr (std::is_arithmetic_v<T> && vectorizable_op(Op)) {
+      if (cell_size == sizeof(T)) {
+        const T* values = tile.data_as<T>();
+        const T condition_value =
+            *static_cast<const T*>(condition_value_content);
+        for (uint64_t c = 0; c < buffer_el; ++c) {
+          const bool cmp = BinaryCmp<T, Op>::cmp(
+              &values[c], sizeof(T), &condition_value, sizeof(T));
+          if constexpr (
+              std::is_same_v<CombinationOp, QCMax<BitmapType>> &&
+              nullable::value) {
+            result_bitmap[c] = combination_op(
+                result_bitmap[c], cmp && (buffer_validity[c] != 0));
+          } else {
+            result_bitmap[c] = combination_op(result_bitmap[c], cmp);
+          }
+        }
+        return;
+      }
+    }
+
+    // Set membership on an enumerated attribute: the members were rewritten
+    // to enumeration codes, so the lookup is a single indexed load into the
+    // membership table instead of a hashed string compare.
+    if constexpr (
+        std::is_integral_v<T> &&
+        (Op == QueryConditionOp::IN || Op == QueryConditionOp::NOT_IN)) {
+      const auto& code_table = node->get_member_code_table();
+      if (!code_table.empty() && cell_size == sizeof(T)) {
+        const T* values = tile.data_as<T>();
+        const uint64_t code_num = code_table.size();
+        for (uint64_t c = 0; c < buffer_el; ++c) {
+          const auto code = static_cast<uint64_t>(values[c]);
+          bool cmp = code < code_num && code_table[code] != 0;
+          if constexpr (Op == QueryConditionOp::NOT_IN) {
+            cmp = !cmp;
+          }
+          if constexpr (
+              std::is_same_v<CombinationOp, QCMax<BitmapType>> &&
+              nullable::value) {
+            result_bitmap[c] = combination_op(
+                result_bitmap[c], cmp && (buffer_validity[c] != 0));
+          } else {
+            result_bitmap[c] = combination_op(result_bitmap[c], cmp);
+          }
+        }
+        return;
+      }
+    }
+
     // Iterate through each cell without checking the bitmap to enable
     // vectorization.
     for (uint64_t c = 0; c < buffer_el; ++c) {
@@ -2858,13 +2971,83 @@ void QueryCondition::apply_tree_sparse(
   }
 }
 
+template <typename BitmapType>
+void QueryCondition::sample_adaptive_order(
+    const QueryCondition::Params& params, ResultTile& result_tile) {
+  const auto& children = tree_->get_children();
+  auto resource =
+      params.GetMemoryTracker()->get_resource(MemoryType::QUERY_CONDITION);
+  const auto cell_num = result_tile.cell_num();
+
+  // Evaluate every child on its own so that its selectivity and cost can
+  // be observed in isolation.
+  const bool is_and =
+      tree_->get_combination_op() == QueryConditionCombinationOp::AND;
+  std::vector<std::pair<double, size_t>> ranks;
+  ranks.reserve(children.size());
+  for (size_t i = 0; i < children.size(); i++) {
+    tdb::pmr::vector<BitmapType> bitmap(cell_num, 1, resource);
+    const auto start = std::chrono::high_resolution_clock::now();
+    apply_tree_sparse<BitmapType>(
+        children[i],
+        params,
+        result_tile,
+        std::multiplies<BitmapType>(),
+        bitmap);
+    const double cost =
+        1.0 + std::chrono::duration<double, std::nano>(
+                  std::chrono::high_resolution_clock::now() - start)
+                  .count();
+
+    uint64_t passed = 0;
+    for (uint64_t c = 0; c < cell_num; c++) {
+      passed += bitmap[c] != 0;
+    }
+    const double selectivity = static_cast<double>(passed) / cell_num;
+
+    // For AND, the clauses that eliminate the most cells per unit of cost
+    // should run first; for OR, the clauses that accept the most.
+    const double gain = is_and ? 1.0 - selectivity : selectivity;
+    ranks.emplace_back(gain / cost, i);
+  }
+
+  std::stable_sort(
+      ranks.begin(), ranks.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+      });
+
+  std::vector<tdb_unique_ptr<ASTNode>> ordered_children;
+  ordered_children.reserve(children.size());
+  for (auto& [rank, i] : ranks) {
+    ordered_children.emplace_back(children[i]->clone());
+  }
+
+  adaptive_tree_ = tdb_unique_ptr<ASTNode>(tdb_new(
+      ASTNodeExpr, std::move(ordered_children), tree_->get_combination_op()));
+}
+
 template <typename BitmapType>
 Status QueryCondition::apply_sparse(
     const QueryCondition::Params& params,
     ResultTile& result_tile,
     tdb::pmr::vector<BitmapType>& result_bitmap) {
+  // Sample the evaluation order of the root children on the first tile with
+  // cells, if adaptive ordering is enabled.
+  if (adaptive_order_ && tree_->is_expr() &&
+      tree_->get_children().size() > 1 &&
+      tree_->get_combination_op() != QueryConditionCombinationOp::NOT &&
+      result_tile.cell_num() > 0) {
+    std::call_once(adaptive_order_flag_, [&]() {
+      sample_adaptive_order<BitmapType>(params, result_tile);
+    });
+  }
+
   apply_tree_sparse<BitmapType>(
-      tree_, params, result_tile, std::multiplies<BitmapType>(), result_bitmap);
+      adaptive_tree_ ? adaptive_tree_ : tree_,
+      params,
+      result_tile,
+      std::multiplies<BitmapType>(),
+      result_bitmap);
 
   return Status::Ok();
 }
@@ -35,6 +35,7 @@
 
 #include "external/include/span/span.hpp"
 
+#include <mutex>
 #include <unordered_set>
 
 #include "tiledb/common/status.h"
@@ -217,6 +218,19 @@ class QueryCondition {
       QueryConditionCombinationOp combination_op,
       QueryCondition* combined_cond) const;
 
+  /**
+   * Enables or disables adaptive evaluation ordering. When enabled, the
+   * first sparse tile this condition is applied to is used to sample the
+   * selectivity and evaluation cost of every child of the root AND/OR
+   * node, and the children are reordered so that the most decisive clause
+   * per unit of cost runs first. The ordering is cached on this object for
+   * the rest of the query. Reordering AND/OR children does not change the
+   * result of the condition.
+   *
+   * @param adaptive_order Enable adaptive ordering or not.
+   */
+  void set_adaptive_order(bool adaptive_order);
+
   /**
    * Returns true if this condition does not have any nodes in the AST
    * representing the query condition.
@@ -377,6 +391,19 @@ class QueryCondition {
   /** Caches all field names that references enumerations in the AST. */
   mutable std::unordered_set<std::string> enumeration_field_names_;
 
+  /** Use adaptive evaluation ordering for sparse applies or not. */
+  bool adaptive_order_ = false;
+
+  /**
+   * Copy of the AST with the root children reordered by observed
+   * selectivity and cost. Built on the first sparse apply when adaptive
+   * ordering is enabled, `nullptr` until then.
+   */
+  tdb_unique_ptr<tiledb::sm::ASTNode> adaptive_tree_{};
+
+  /** Ensures the adaptive ordering is sampled only once. */
+  std::once_flag adaptive_order_flag_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -694,6 +721,20 @@ class QueryCondition {
       ResultTile& result_tile,
       CombinationOp combination_op,
       tdb::pmr::vector<BitmapType>& result_bitmap) const;
+
+  /**
+   * Samples the selectivity and evaluation cost of every child of the root
+   * AND/OR node on a result tile and builds `adaptive_tree_` with the
+   * children reordered so that the most decisive clause per unit of cost
+   * runs first. The sampled tile is evaluated once more afterwards through
+   * the regular apply path, which is a one tile overhead.
+   *
+   * @param params Query condition parameters.
+   * @param result_tile The result tile to sample on.
+   */
+  template <typename BitmapType>
+  void sample_adaptive_order(
+      const QueryCondition::Params& params, ResultTile& result_tile);
 };
 
 }  // namespace sm
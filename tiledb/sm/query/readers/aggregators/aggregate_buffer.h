@@ -126,6 +126,40 @@ class AggregateBuffer {
     }
   }
 
+  /**
+   * Get a pointer to the fixed data, starting at the first cell to
+   * aggregate.
+   *
+   * @tparam T Value type.
+   * @return Pointer to the fixed data.
+   */
+  template <typename T>
+  inline const T* fixed_data_as() const {
+    return static_cast<const T*>(fixed_data_) + min_cell_;
+  }
+
+  /**
+   * Get a pointer to the validity data, starting at the first cell to
+   * aggregate.
+   *
+   * @return Pointer to the validity data.
+   */
+  inline const uint8_t* validity_data() const {
+    return validity_data_.value() + min_cell_;
+  }
+
+  /**
+   * Get a pointer to the bitmap data, starting at the first cell to
+   * aggregate.
+   *
+   * @tparam BitmapType Bitmap type.
+   * @return Pointer to the bitmap data.
+   */
+  template <class BitmapType>
+  inline const BitmapType* bitmap_data_as() const {
+    return static_cast<BitmapType*>(bitmap_data_.value()) + min_cell_;
+  }
+
   /**
    * Get the validity value at a certain cell index.
    *
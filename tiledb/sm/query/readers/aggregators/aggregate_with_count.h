@@ -35,6 +35,7 @@
 
 #include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
 #include "tiledb/sm/query/readers/aggregators/field_info.h"
+#include "tiledb/sm/query/readers/aggregators/min_max.h"
 #include "tiledb/sm/query/readers/aggregators/no_op.h"
 
 namespace tiledb::sm {
@@ -52,6 +53,13 @@ struct type_data<std::string> {
   typedef std::string_view value_type;
 };
 
+/** Whether an aggregation policy is a min/max. **/
+template <class AggPolicy>
+struct is_min_max_policy : std::false_type {};
+
+template <class Op>
+struct is_min_max_policy<MinMax<Op>> : std::true_type {};
+
 template <typename T, typename AGG_T, class AggPolicy, class ValidityPolicy>
 class AggregateWithCount {
  public:
@@ -79,6 +87,20 @@ class AggregateWithCount {
    */
   template <typename BITMAP_T>
   tuple<AGG_T, uint64_t> aggregate(AggregateBuffer& input_data) {
+    // Dispatch count and arithmetic min/max to the branch free kernels:
+    // count never reads cell values and min/max can replace its per-cell
+    // branch with a select, so both compile down to vectorized loops. The
+    // checked sums stay on the generic loops below, as overflow must be
+    // detected on the exact cell where the running sum would wrap.
+    if constexpr (std::is_same<AggPolicy, NoOp>::value) {
+      return count_cells<BITMAP_T>(input_data);
+    } else if constexpr (
+        is_min_max_policy<AggPolicy>::value && std::is_arithmetic_v<AGG_T>) {
+      if (!field_info_.is_dense_dim_) {
+        return min_max_cells<BITMAP_T>(input_data);
+      }
+    }
+
     AggPolicy agg_policy;
     ValidityPolicy val_policy;
     AGG_T res;
@@ -168,6 +190,139 @@ class AggregateWithCount {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
+  /**
+   * Count the cells included in the aggregation without reading any cell
+   * values. The loops only reduce over the bitmap and validity buffers, so
+   * the compiler can vectorize them.
+   *
+   * @tparam BITMAP_T Bitmap type.
+   * @param input_data Input data for the aggregation.
+   * @return {Default aggregate value, count of cells}.
+   */
+  template <typename BITMAP_T>
+  tuple<AGG_T, uint64_t> count_cells(AggregateBuffer& input_data) {
+    ValidityPolicy val_policy;
+    AGG_T res;
+    if constexpr (std::is_same<AGG_T, std::string_view>::value) {
+      res = "";
+    } else {
+      res = 0;
+    }
+    uint64_t count{0};
+
+    const uint64_t num_cells = input_data.size();
+    if (input_data.has_bitmap()) {
+      const auto* bitmap = input_data.bitmap_data_as<BITMAP_T>();
+      if (field_info_.is_nullable_) {
+        const auto* validity = input_data.validity_data();
+        for (uint64_t c = 0; c < num_cells; c++) {
+          count +=
+              val_policy.op(validity[c]) ? static_cast<uint64_t>(bitmap[c]) :
+                                           0;
+        }
+      } else {
+        for (uint64_t c = 0; c < num_cells; c++) {
+          count += bitmap[c];
+        }
+      }
+    } else {
+      if (field_info_.is_nullable_) {
+        const auto* validity = input_data.validity_data();
+        for (uint64_t c = 0; c < num_cells; c++) {
+          count += val_policy.op(validity[c]) ? 1 : 0;
+        }
+      } else {
+        count = num_cells;
+      }
+    }
+
+    return {res, count};
+  }
+
+  /**
+   * Compute an arithmetic min/max. The running value is seeded with the
+   * first included cell, after which every cell updates it with a select
+   * instead of a branch, so the main loops can run as masked vector loops.
+   *
+   * @tparam BITMAP_T Bitmap type.
+   * @param input_data Input data for the aggregation.
+   * @return {Aggregate value, count of cells}.
+   */
+  template <typename BITMAP_T>
+  tuple<AGG_T, uint64_t> min_max_cells(AggregateBuffer& input_data) {
+    AggPolicy agg_policy;
+    ValidityPolicy val_policy;
+    AGG_T res{0};
+    uint64_t count{0};
+
+    const uint64_t num_cells = input_data.size();
+    const auto* values = input_data.fixed_data_as<AGG_T>();
+    if (input_data.has_bitmap()) {
+      const auto* bitmap = input_data.bitmap_data_as<BITMAP_T>();
+      if (field_info_.is_nullable_) {
+        const auto* validity = input_data.validity_data();
+        uint64_t c = 0;
+        for (; c < num_cells; c++) {
+          if (val_policy.op(validity[c]) && bitmap[c] != 0) {
+            res = values[c];
+            count += bitmap[c];
+            c++;
+            break;
+          }
+        }
+        for (; c < num_cells; c++) {
+          const bool included = val_policy.op(validity[c]) && bitmap[c] != 0;
+          count += included ? static_cast<uint64_t>(bitmap[c]) : 0;
+          res = included && agg_policy.replaces(values[c], res) ? values[c] :
+                                                                  res;
+        }
+      } else {
+        uint64_t c = 0;
+        for (; c < num_cells; c++) {
+          if (bitmap[c] != 0) {
+            res = values[c];
+            count += bitmap[c];
+            c++;
+            break;
+          }
+        }
+        for (; c < num_cells; c++) {
+          count += bitmap[c];
+          res = bitmap[c] != 0 && agg_policy.replaces(values[c], res) ?
+                    values[c] :
+                    res;
+        }
+      }
+    } else {
+      if (field_info_.is_nullable_) {
+        const auto* validity = input_data.validity_data();
+        uint64_t c = 0;
+        for (; c < num_cells; c++) {
+          if (val_policy.op(validity[c])) {
+            res = values[c];
+            count++;
+            c++;
+            break;
+          }
+        }
+        for (; c < num_cells; c++) {
+          const bool included = val_policy.op(validity[c]);
+          count += included ? 1 : 0;
+          res = included && agg_policy.replaces(values[c], res) ? values[c] :
+                                                                  res;
+        }
+      } else if (num_cells > 0) {
+        res = values[0];
+        count = num_cells;
+        for (uint64_t c = 1; c < num_cells; c++) {
+          res = agg_policy.replaces(values[c], res) ? values[c] : res;
+        }
+      }
+    }
+
+    return {res, count};
+  }
+
   /**
    * Returns the value at the specified cell if needed.
    *
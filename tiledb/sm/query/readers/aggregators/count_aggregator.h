@@ -74,6 +74,11 @@ class CountAggregatorBase : public OutputBufferValidator, public IAggregator {
     return true;
   }
 
+  /** Returns if the aggregate can be computed from fragment tile metadata. */
+  bool can_aggregate_with_frag_md() override {
+    return true;
+  }
+
   /**
    * Validate the result buffer.
    *
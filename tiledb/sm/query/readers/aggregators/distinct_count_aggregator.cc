@@ -0,0 +1,175 @@
+/**
+ * @file   distinct_count_aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class DistinctCountAggregator.
+ */
+
+#include "tiledb/sm/query/readers/aggregators/distinct_count_aggregator.h"
+
+#include "tiledb/sm/query/query_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+
+namespace tiledb::sm {
+
+class DistinctCountAggregatorStatusException : public StatusException {
+ public:
+  explicit DistinctCountAggregatorStatusException(const std::string& message)
+      : StatusException("DistinctCountAggregator", message) {
+  }
+};
+
+template <typename T>
+DistinctCountAggregator<T>::DistinctCountAggregator(FieldInfo field_info)
+    : OutputBufferValidator(field_info)
+    , field_info_(field_info) {
+}
+
+template <typename T>
+void DistinctCountAggregator<T>::validate_output_buffer(
+    std::string output_field_name,
+    std::unordered_map<std::string, QueryBuffer>& buffers) {
+  if (buffers.count(output_field_name) == 0) {
+    throw DistinctCountAggregatorStatusException(
+        "Result buffer doesn't exist.");
+  }
+
+  ensure_output_buffer_count(buffers[output_field_name]);
+}
+
+template <typename T>
+void DistinctCountAggregator<T>::aggregate_data(AggregateBuffer& input_data) {
+  // Scan the tile into a local sketch so concurrent tiles don't contend on
+  // the query level sketch, then merge under lock.
+  HyperLogLog sketch;
+  if (input_data.is_count_bitmap()) {
+    aggregate_cells<uint64_t>(sketch, input_data);
+  } else {
+    aggregate_cells<uint8_t>(sketch, input_data);
+  }
+
+  std::unique_lock<std::mutex> lock(sketch_mtx_);
+  sketch_.merge(sketch);
+}
+
+template <typename T>
+void DistinctCountAggregator<T>::aggregate_tile_with_frag_md(TileMetadata&) {
+  // Fragment metadata has no cardinality sketch, so the readers never route
+  // distinct count aggregates through the tile metadata path; see
+  // `can_aggregate_with_frag_md`.
+  throw DistinctCountAggregatorStatusException(
+      "Distinct count cannot be computed from fragment metadata.");
+}
+
+template <typename T>
+void DistinctCountAggregator<T>::copy_to_user_buffer(
+    std::string output_field_name,
+    std::unordered_map<std::string, QueryBuffer>& buffers) {
+  auto& result_buffer = buffers[output_field_name];
+  *static_cast<uint64_t*>(result_buffer.buffer_) = sketch_.estimate();
+
+  if (result_buffer.buffer_size_) {
+    *result_buffer.buffer_size_ = sizeof(uint64_t);
+  }
+}
+
+template <typename T>
+template <typename BITMAP_T>
+void DistinctCountAggregator<T>::aggregate_cells(
+    HyperLogLog& sketch, AggregateBuffer& input_data) {
+  // Run different loops for bitmap versus no bitmap and nullable versus non
+  // nullable, like `AggregateWithCount` does. Bitmap multiplicities only
+  // decide whether a cell is included, as duplicates don't add distinct
+  // values.
+  if (input_data.has_bitmap()) {
+    if (field_info_.is_nullable_) {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        if (input_data.validity_at(c) != 0 &&
+            input_data.bitmap_at<BITMAP_T>(c) != 0) {
+          sketch.add(hash_value(input_data, c));
+        }
+      }
+    } else {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        if (input_data.bitmap_at<BITMAP_T>(c) != 0) {
+          sketch.add(hash_value(input_data, c));
+        }
+      }
+    }
+  } else {
+    if (field_info_.is_nullable_) {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        if (input_data.validity_at(c) != 0) {
+          sketch.add(hash_value(input_data, c));
+        }
+      }
+    } else {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        sketch.add(hash_value(input_data, c));
+      }
+    }
+  }
+}
+
+template <typename T>
+uint64_t DistinctCountAggregator<T>::hash_value(
+    AggregateBuffer& input_data, uint64_t c) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto value = input_data.value_at<std::string_view>(c);
+    return HyperLogLog::hash(value.data(), value.size());
+  } else {
+    auto value = input_data.value_at<T>(c);
+    return HyperLogLog::hash(&value, sizeof(T));
+  }
+}
+
+// Explicit template instantiations
+template DistinctCountAggregator<int8_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<int16_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<int32_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<int64_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<uint8_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<uint16_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<uint32_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<uint64_t>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<float>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<double>::DistinctCountAggregator(
+    const FieldInfo);
+template DistinctCountAggregator<std::string>::DistinctCountAggregator(
+    const FieldInfo);
+
+}  // namespace tiledb::sm
@@ -0,0 +1,222 @@
+/**
+ * @file   group_by_aggregator.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class GroupByAggregator.
+ */
+
+#ifndef TILEDB_GROUP_BY_AGGREGATOR_H
+#define TILEDB_GROUP_BY_AGGREGATOR_H
+
+#include <unordered_map>
+
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_with_count.h"
+#include "tiledb/sm/query/readers/aggregators/field_info.h"
+
+namespace tiledb::sm {
+
+/**
+ * Grouped aggregation engine, evaluated tile-by-tile inside the readers.
+ *
+ * Cells are bucketed by a group key and one aggregate value and count is
+ * maintained per group. The key for a cell comes either from a second field
+ * processed alongside the input data, typically a dimension, or is constant
+ * for a whole tile, typically the tile index. The per-group results stay
+ * compact, so readers can reduce tiles as they are processed instead of
+ * shipping raw cells to the client.
+ */
+template <
+    typename KEY_T,
+    typename T,
+    typename AGG_T,
+    class AggPolicy,
+    class ValidityPolicy>
+class GroupByAggregator {
+  static_assert(
+      !std::is_same<AGG_T, std::string_view>::value,
+      "Grouped aggregation does not support var sized data.");
+
+ public:
+  /* ********************************* */
+  /*         TYPE DEFINITIONS          */
+  /* ********************************* */
+
+  /** Aggregate value and count of cells for a single group. */
+  struct GroupResult {
+    /** Aggregate value. */
+    AGG_T value_{0};
+
+    /** Count of cells. */
+    uint64_t count_{0};
+  };
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  GroupByAggregator(const FieldInfo field_info)
+      : field_info_(field_info) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Aggregate the input data, grouping cells by the key field values.
+   *
+   * The key data must cover the same cell range as the input data. Keys are
+   * only read for cells included in the aggregation.
+   *
+   * @tparam BITMAP_T Bitmap type.
+   * @param key_data Key field data for the grouping.
+   * @param input_data Input data for the aggregation.
+   */
+  template <typename BITMAP_T>
+  void aggregate(AggregateBuffer& key_data, AggregateBuffer& input_data) {
+    AggPolicy agg_policy;
+    ValidityPolicy val_policy;
+
+    // Run different loops for bitmap versus no bitmap and nullable versus
+    // non nullable, like `AggregateWithCount` does for ungrouped data.
+    if (input_data.has_bitmap()) {
+      if (field_info_.is_nullable_) {
+        for (uint64_t c = 0; c < input_data.size(); c++) {
+          auto bitmap_val = input_data.bitmap_at<BITMAP_T>(c);
+          if (val_policy.op(input_data.validity_at(c)) && bitmap_val != 0) {
+            auto& group = groups_[key_data.value_at<KEY_T>(c)];
+            auto value = value_at(input_data, c);
+            for (BITMAP_T i = 0; i < bitmap_val; i++) {
+              agg_policy.op(value, group.value_, group.count_);
+              group.count_++;
+            }
+          }
+        }
+      } else {
+        for (uint64_t c = 0; c < input_data.size(); c++) {
+          auto bitmap_val = input_data.bitmap_at<BITMAP_T>(c);
+          if (bitmap_val != 0) {
+            auto& group = groups_[key_data.value_at<KEY_T>(c)];
+            auto value = value_at(input_data, c);
+            for (BITMAP_T i = 0; i < bitmap_val; i++) {
+              agg_policy.op(value, group.value_, group.count_);
+              group.count_++;
+            }
+          }
+        }
+      }
+    } else {
+      if (field_info_.is_nullable_) {
+        for (uint64_t c = 0; c < input_data.size(); c++) {
+          if (val_policy.op(input_data.validity_at(c))) {
+            auto& group = groups_[key_data.value_at<KEY_T>(c)];
+            auto value = value_at(input_data, c);
+            agg_policy.op(value, group.value_, group.count_);
+            group.count_++;
+          }
+        }
+      } else {
+        for (uint64_t c = 0; c < input_data.size(); c++) {
+          auto& group = groups_[key_data.value_at<KEY_T>(c)];
+          auto value = value_at(input_data, c);
+          agg_policy.op(value, group.value_, group.count_);
+          group.count_++;
+        }
+      }
+    }
+  }
+
+  /**
+   * Aggregate the input data into a single group with a constant key.
+   *
+   * This is the path for group keys that do not vary within a tile, like the
+   * tile index. The tile is reduced with the ungrouped kernels first and the
+   * partial result is combined into the group, so it benefits from the same
+   * vectorization.
+   *
+   * @tparam BITMAP_T Bitmap type.
+   * @param key Group key for all cells of the input data.
+   * @param input_data Input data for the aggregation.
+   */
+  template <typename BITMAP_T>
+  void aggregate(KEY_T key, AggregateBuffer& input_data) {
+    AggregateWithCount<T, AGG_T, AggPolicy, ValidityPolicy> aggregator(
+        field_info_);
+    auto res = aggregator.template aggregate<BITMAP_T>(input_data);
+
+    const auto value = std::get<0>(res);
+    const auto count = std::get<1>(res);
+    if (count != 0) {
+      AggPolicy agg_policy;
+      auto& group = groups_[key];
+      agg_policy.op(value, group.value_, group.count_);
+      group.count_ += count;
+    }
+  }
+
+  /** Returns the per-group results. */
+  const std::unordered_map<KEY_T, GroupResult>& groups() const {
+    return groups_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Field information. */
+  const FieldInfo field_info_;
+
+  /** Aggregate value and count of cells, per group. */
+  std::unordered_map<KEY_T, GroupResult> groups_;
+
+  /* ********************************* */
+  /*           PRIVATE METHODS         */
+  /* ********************************* */
+
+  /**
+   * Returns the value at the specified cell if needed.
+   *
+   * @param input_data Input data.
+   * @param c Cell index.
+   * @return Value.
+   */
+  inline AGG_T value_at(AggregateBuffer& input_data, uint64_t c) {
+    typedef typename type_data<T>::value_type VALUE_T;
+    if constexpr (!std::is_same<AggPolicy, NoOp>::value) {
+      return input_data.value_at<VALUE_T>(c);
+    }
+
+    return AGG_T();
+  }
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_GROUP_BY_AGGREGATOR_H
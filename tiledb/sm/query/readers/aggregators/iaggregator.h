@@ -66,6 +66,9 @@ class IAggregator {
   /** Returns if the aggregate needs to be recomputed on overflow. */
   virtual bool need_recompute_on_overflow() = 0;
 
+  /** Returns if the aggregate can be computed from fragment tile metadata. */
+  virtual bool can_aggregate_with_frag_md() = 0;
+
   /** Returns if the aggregation is var sized or not. */
   virtual bool aggregation_var_sized() = 0;
 
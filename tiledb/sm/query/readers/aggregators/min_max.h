@@ -54,6 +54,17 @@ struct MinMax {
     }
   }
 
+  /**
+   * Returns `true` if the value should replace the current min/max.
+   *
+   * @param value Value to compare against.
+   * @param min_max Current min/max.
+   */
+  template <typename MIN_MAX_T>
+  inline bool replaces(MIN_MAX_T value, MIN_MAX_T min_max) {
+    return op_(value, min_max);
+  }
+
  private:
   Op op_;
 };
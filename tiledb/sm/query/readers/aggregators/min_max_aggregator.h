@@ -160,6 +160,11 @@ class ComparatorAggregator : public ComparatorAggregatorBase<T>,
     return false;
   }
 
+  /** Returns if the aggregate can be computed from fragment tile metadata. */
+  bool can_aggregate_with_frag_md() override {
+    return true;
+  }
+
   /**
    * Validate the result buffer.
    *
@@ -48,6 +48,10 @@ shared_ptr<Operation> Operation::make_operation(
     return common::make_shared<MeanOperation>(HERE(), fi.value());
   } else if (name == constants::aggregate_null_count_str) {
     return common::make_shared<NullCountOperation>(HERE(), fi.value());
+  } else if (name == constants::aggregate_distinct_count_str) {
+    return common::make_shared<DistinctCountOperation>(HERE(), fi.value());
+  } else if (name == constants::aggregate_median_str) {
+    return common::make_shared<MedianOperation>(HERE(), fi.value());
   }
 
   throw std::logic_error(
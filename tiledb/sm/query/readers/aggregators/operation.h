@@ -36,7 +36,9 @@
 #include "tiledb/common/common.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/query/readers/aggregators/count_aggregator.h"
+#include "tiledb/sm/query/readers/aggregators/distinct_count_aggregator.h"
 #include "tiledb/sm/query/readers/aggregators/min_max_aggregator.h"
+#include "tiledb/sm/query/readers/aggregators/percentile_aggregator.h"
 #include "tiledb/sm/query/readers/aggregators/sum_aggregator.h"
 #include "tiledb/sm/query/readers/aggregators/sum_type.h"
 #include "tiledb/type/apply_with_type.h"
@@ -231,6 +233,68 @@ class MeanOperation : public Operation {
   }
 };
 
+class DistinctCountOperation : public Operation {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+  DistinctCountOperation() = delete;
+
+  /**
+   * Construct the operation where the internal aggregator object
+   * is instantiated to the correct type given the input field type.
+   * @param fi The FieldInfo for the input field
+   */
+  explicit DistinctCountOperation(const tiledb::sm::FieldInfo& fi) {
+    auto g = [&](auto T) {
+      if constexpr (tiledb::type::TileDBFundamental<decltype(T)>) {
+        // This is a distinct count on strings, should be refactored out once
+        // we change (STRING_ASCII,CHAR) mapping in apply_with_type
+        if constexpr (std::is_same_v<char, decltype(T)>) {
+          aggregator_ = tdb::make_shared<
+              tiledb::sm::DistinctCountAggregator<std::string>>(HERE(), fi);
+        } else {
+          aggregator_ = tdb::make_shared<
+              tiledb::sm::DistinctCountAggregator<decltype(T)>>(HERE(), fi);
+        }
+      } else {
+        throw std::logic_error(
+            "DISTINCT_COUNT aggregates can only be requested on numeric and "
+            "string types");
+      }
+    };
+    type::apply_with_type(g, fi.type_);
+  }
+};
+
+class MedianOperation : public Operation {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+  MedianOperation() = delete;
+
+  /**
+   * Construct the operation where the internal aggregator object
+   * is instantiated to the correct type given the input field type.
+   * @param fi The FieldInfo for the input field
+   */
+  explicit MedianOperation(const tiledb::sm::FieldInfo& fi) {
+    auto g = [&](auto T) {
+      if constexpr (tiledb::type::TileDBNumeric<decltype(T)>) {
+        ensure_field_numeric(fi);
+        aggregator_ =
+            tdb::make_shared<tiledb::sm::PercentileAggregator<decltype(T)>>(
+                HERE(), fi, 0.5);
+      } else {
+        throw std::logic_error(
+            "MEDIAN aggregates can only be requested on numeric types");
+      }
+    };
+    type::apply_with_type(g, fi.type_);
+  }
+};
+
 class NullCountOperation : public Operation {
  public:
   /* ********************************* */
@@ -0,0 +1,169 @@
+/**
+ * @file   percentile_aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class PercentileAggregator.
+ */
+
+#include "tiledb/sm/query/readers/aggregators/percentile_aggregator.h"
+
+#include "tiledb/sm/query/query_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+
+namespace tiledb::sm {
+
+class PercentileAggregatorStatusException : public StatusException {
+ public:
+  explicit PercentileAggregatorStatusException(const std::string& message)
+      : StatusException("PercentileAggregator", message) {
+  }
+};
+
+template <typename T>
+PercentileAggregator<T>::PercentileAggregator(
+    FieldInfo field_info, double percentile)
+    : OutputBufferValidator(field_info)
+    , field_info_(field_info)
+    , percentile_(percentile) {
+  if (percentile < 0.0 || percentile > 1.0) {
+    throw PercentileAggregatorStatusException(
+        "Percentile must be between 0 and 1.");
+  }
+}
+
+template <typename T>
+void PercentileAggregator<T>::validate_output_buffer(
+    std::string output_field_name,
+    std::unordered_map<std::string, QueryBuffer>& buffers) {
+  if (buffers.count(output_field_name) == 0) {
+    throw PercentileAggregatorStatusException("Result buffer doesn't exist.");
+  }
+
+  ensure_output_buffer_arithmetic(buffers[output_field_name]);
+}
+
+template <typename T>
+void PercentileAggregator<T>::aggregate_data(AggregateBuffer& input_data) {
+  // Scan the tile into a local digest so concurrent tiles don't contend on
+  // the query level digest, then merge under lock.
+  TDigest digest;
+  if (input_data.is_count_bitmap()) {
+    aggregate_cells<uint64_t>(digest, input_data);
+  } else {
+    aggregate_cells<uint8_t>(digest, input_data);
+  }
+
+  std::unique_lock<std::mutex> lock(digest_mtx_);
+  digest_.merge(digest);
+}
+
+template <typename T>
+void PercentileAggregator<T>::aggregate_tile_with_frag_md(TileMetadata&) {
+  // Fragment metadata has no quantile sketch, so the readers never route
+  // percentile aggregates through the tile metadata path; see
+  // `can_aggregate_with_frag_md`.
+  throw PercentileAggregatorStatusException(
+      "Percentile cannot be computed from fragment metadata.");
+}
+
+template <typename T>
+void PercentileAggregator<T>::copy_to_user_buffer(
+    std::string output_field_name,
+    std::unordered_map<std::string, QueryBuffer>& buffers) {
+  auto& result_buffer = buffers[output_field_name];
+  *static_cast<double*>(result_buffer.buffer_) = digest_.quantile(percentile_);
+
+  if (result_buffer.buffer_size_) {
+    *result_buffer.buffer_size_ = sizeof(double);
+  }
+}
+
+template <typename T>
+template <typename BITMAP_T>
+void PercentileAggregator<T>::aggregate_cells(
+    TDigest& digest, AggregateBuffer& input_data) {
+  // Run different loops for bitmap versus no bitmap and nullable versus non
+  // nullable, like `AggregateWithCount` does. Count bitmap multiplicities
+  // add a cell once per count, as duplicated cells shift the quantiles.
+  if (input_data.has_bitmap()) {
+    if (field_info_.is_nullable_) {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        if (input_data.validity_at(c) != 0) {
+          const auto value =
+              static_cast<double>(input_data.value_at<T>(c));
+          for (BITMAP_T n = 0; n < input_data.bitmap_at<BITMAP_T>(c); n++) {
+            digest.add(value);
+          }
+        }
+      }
+    } else {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        const auto value = static_cast<double>(input_data.value_at<T>(c));
+        for (BITMAP_T n = 0; n < input_data.bitmap_at<BITMAP_T>(c); n++) {
+          digest.add(value);
+        }
+      }
+    }
+  } else {
+    if (field_info_.is_nullable_) {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        if (input_data.validity_at(c) != 0) {
+          digest.add(static_cast<double>(input_data.value_at<T>(c)));
+        }
+      }
+    } else {
+      for (uint64_t c = 0; c < input_data.size(); c++) {
+        digest.add(static_cast<double>(input_data.value_at<T>(c)));
+      }
+    }
+  }
+}
+
+// Explicit template instantiations
+template PercentileAggregator<int8_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<int16_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<int32_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<int64_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<uint8_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<uint16_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<uint32_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<uint64_t>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<float>::PercentileAggregator(
+    const FieldInfo, double);
+template PercentileAggregator<double>::PercentileAggregator(
+    const FieldInfo, double);
+
+}  // namespace tiledb::sm
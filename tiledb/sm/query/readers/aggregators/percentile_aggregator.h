@@ -0,0 +1,198 @@
+/**
+ * @file   percentile_aggregator.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class PercentileAggregator.
+ */
+
+#ifndef TILEDB_PERCENTILE_AGGREGATOR_H
+#define TILEDB_PERCENTILE_AGGREGATOR_H
+
+#include <mutex>
+
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/query/readers/aggregators/field_info.h"
+#include "tiledb/sm/query/readers/aggregators/iaggregator.h"
+#include "tiledb/sm/query/readers/aggregators/t_digest.h"
+
+namespace tiledb::sm {
+
+class QueryBuffer;
+
+/**
+ * Approximate percentile aggregator, backed by a t-digest sketch.
+ *
+ * Each tile is scanned into a local digest which is then merged into the
+ * query level digest, so tiles can be processed concurrently without locking
+ * the scan. Null cells are excluded and count bitmap multiplicities add
+ * weight, as duplicated cells shift the quantiles.
+ *
+ * The aggregator computes any quantile, but the only channel operation
+ * registered today is MEDIAN (the 0.5 quantile); exposing arbitrary
+ * percentiles needs operator arguments in the C API.
+ */
+template <typename T>
+class PercentileAggregator : public InputFieldValidator,
+                             public OutputBufferValidator,
+                             public IAggregator {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  PercentileAggregator() = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param field_info Field info.
+   * @param percentile Percentile to compute, in [0, 1].
+   */
+  PercentileAggregator(FieldInfo field_info, double percentile);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(PercentileAggregator);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(PercentileAggregator);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the field name for the aggregator. */
+  std::string field_name() override {
+    return field_info_.name_;
+  }
+
+  /** Returns if the aggregation is var sized or not. */
+  bool aggregation_var_sized() override {
+    return false;
+  }
+
+  /** Returns if the aggregation is nullable or not. */
+  bool aggregation_nullable() override {
+    return false;
+  }
+
+  /** Returns if the aggregation is for validity only data. */
+  bool aggregation_validity_only() override {
+    return false;
+  }
+
+  /** Returns if the aggregate needs to be recomputed on overflow. */
+  bool need_recompute_on_overflow() override {
+    return false;
+  }
+
+  /** Returns if the aggregate can be computed from fragment tile metadata. */
+  bool can_aggregate_with_frag_md() override {
+    return false;
+  }
+
+  /**
+   * Validate the result buffer.
+   *
+   * @param output_field_name Name for the output buffer.
+   * @param buffers Query buffers.
+   */
+  void validate_output_buffer(
+      std::string output_field_name,
+      std::unordered_map<std::string, QueryBuffer>& buffers) override;
+
+  /**
+   * Aggregate data using the aggregator.
+   *
+   * @param input_data Input data for aggregation.
+   */
+  void aggregate_data(AggregateBuffer& input_data) override;
+
+  /**
+   * Aggregate a tile with fragment metadata.
+   *
+   * @param tile_metadata Tile metadata for aggregation.
+   */
+  void aggregate_tile_with_frag_md(TileMetadata& tile_metadata) override;
+
+  /**
+   * Copy final data to the user buffer.
+   *
+   * @param output_field_name Name for the output buffer.
+   * @param buffers Query buffers.
+   */
+  void copy_to_user_buffer(
+      std::string output_field_name,
+      std::unordered_map<std::string, QueryBuffer>& buffers) override;
+
+  /** Returns name of the aggregate. */
+  std::string aggregate_name() override {
+    return constants::aggregate_median_str;
+  }
+
+  /** Returns the TileDB datatype of the output field for the aggregate. */
+  Datatype output_datatype() override {
+    return Datatype::FLOAT64;
+  }
+
+  /** Returns the digest of the aggregator. */
+  TDigest& digest() {
+    return digest_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Field information. */
+  const FieldInfo field_info_;
+
+  /** Percentile to compute. */
+  const double percentile_;
+
+  /** Mutex protecting `digest_`. */
+  std::mutex digest_mtx_;
+
+  /** Computed digest. */
+  TDigest digest_;
+
+  /* ********************************* */
+  /*           PRIVATE METHODS         */
+  /* ********************************* */
+
+  /**
+   * Add the included cells of the input data to a digest.
+   *
+   * @tparam BITMAP_T Bitmap type.
+   * @param digest Digest to add the cells to.
+   * @param input_data Input data for the aggregation.
+   */
+  template <typename BITMAP_T>
+  void aggregate_cells(TDigest& digest, AggregateBuffer& input_data);
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_PERCENTILE_AGGREGATOR_H
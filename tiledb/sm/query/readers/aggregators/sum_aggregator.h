@@ -96,6 +96,11 @@ class SumWithCountAggregator : public InputFieldValidator,
     return true;
   }
 
+  /** Returns if the aggregate can be computed from fragment tile metadata. */
+  bool can_aggregate_with_frag_md() override {
+    return true;
+  }
+
   /**
    * Validate the result buffer.
    *
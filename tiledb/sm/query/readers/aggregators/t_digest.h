@@ -0,0 +1,279 @@
+/**
+ * @file   t_digest.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TDigest.
+ */
+
+#ifndef TILEDB_T_DIGEST_H
+#define TILEDB_T_DIGEST_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+namespace tiledb::sm {
+
+/**
+ * Merging t-digest quantile sketch.
+ *
+ * The digest summarizes a distribution as a sorted list of centroids whose
+ * allowed weight shrinks towards the tails, so extreme quantiles stay
+ * accurate while the sketch size is bounded by the compression factor
+ * independently of the number of values added. Digests are mergeable by
+ * concatenating centroid lists and compressing, so partial digests computed
+ * per tile combine into a quantile estimate for the whole result without
+ * rescanning data.
+ *
+ * Incoming values are buffered and compressed in batches, making additions
+ * amortized constant time.
+ */
+class TDigest {
+ public:
+  /* ********************************* */
+  /*          STATIC CONSTANTS         */
+  /* ********************************* */
+
+  /**
+   * Compression factor, bounding the number of retained centroids. With a
+   * factor of 100 the relative quantile error is typically well under 1%.
+   */
+  static constexpr double compression = 100.0;
+
+  /** Number of buffered values that triggers a compression. */
+  static constexpr uint64_t buffer_capacity = 1024;
+
+  /* ********************************* */
+  /*       PUBLIC TYPE DEFINITIONS     */
+  /* ********************************* */
+
+  /** Weighted centroid, the unit of storage of the digest. */
+  struct Centroid {
+    /** Weighted mean of the values summarized by the centroid. */
+    double mean_;
+
+    /** Total weight of the values summarized by the centroid. */
+    double weight_;
+  };
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  TDigest()
+      : min_(std::numeric_limits<double>::max())
+      , max_(std::numeric_limits<double>::lowest())
+      , total_weight_(0.0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Adds a value to the digest.
+   *
+   * @param value Value to add.
+   */
+  void add(double value) {
+    buffer_.emplace_back(Centroid{value, 1.0});
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    if (buffer_.size() >= buffer_capacity) {
+      compress();
+    }
+  }
+
+  /**
+   * Merges another digest into this one.
+   *
+   * @param other Digest to merge.
+   */
+  void merge(const TDigest& other) {
+    buffer_.insert(
+        buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+    buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    compress();
+  }
+
+  /**
+   * Returns the estimated value at a quantile.
+   *
+   * @param q Quantile, in [0, 1].
+   * @return Estimated value, NaN if the digest is empty.
+   */
+  double quantile(double q) {
+    compress();
+    if (centroids_.empty()) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    if (q <= 0.0) {
+      return min_;
+    }
+
+    if (q >= 1.0) {
+      return max_;
+    }
+
+    // Interpolate linearly between centroid means, each centroid's mass
+    // centered at the midpoint of its cumulative weight range. The minimum
+    // and maximum anchor the tails.
+    const double target = q * total_weight_;
+    double prev_pos = 0.0;
+    double prev_mean = min_;
+    double cumulative = 0.0;
+    for (const auto& c : centroids_) {
+      const double pos = cumulative + c.weight_ / 2.0;
+      if (target <= pos) {
+        if (pos == prev_pos) {
+          return c.mean_;
+        }
+
+        return prev_mean +
+               (c.mean_ - prev_mean) * (target - prev_pos) / (pos - prev_pos);
+      }
+
+      prev_pos = pos;
+      prev_mean = c.mean_;
+      cumulative += c.weight_;
+    }
+
+    if (total_weight_ == prev_pos) {
+      return max_;
+    }
+
+    return prev_mean + (max_ - prev_mean) * (target - prev_pos) /
+                           (total_weight_ - prev_pos);
+  }
+
+  /** Returns the total weight added to the digest. */
+  double total_weight() {
+    compress();
+    return total_weight_;
+  }
+
+  /** Returns the centroids of the digest. */
+  const std::vector<Centroid>& centroids() {
+    compress();
+    return centroids_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Compressed centroids, sorted by mean. */
+  std::vector<Centroid> centroids_;
+
+  /** Values added since the last compression. */
+  std::vector<Centroid> buffer_;
+
+  /** Minimum value added. */
+  double min_;
+
+  /** Maximum value added. */
+  double max_;
+
+  /** Total weight of the compressed centroids. */
+  double total_weight_;
+
+  /* ********************************* */
+  /*           PRIVATE METHODS         */
+  /* ********************************* */
+
+  /**
+   * Scale function mapping a quantile to a centroid size unit. The arcsine
+   * form grows fastest at the tails, forcing small centroids there.
+   *
+   * @param q Quantile, in [0, 1].
+   * @return Scale function value.
+   */
+  static double scale(double q) {
+    return compression * std::asin(2.0 * q - 1.0) / (2.0 * std::numbers::pi);
+  }
+
+  /** Folds the buffered values into the compressed centroid list. */
+  void compress() {
+    if (buffer_.empty()) {
+      return;
+    }
+
+    centroids_.insert(centroids_.end(), buffer_.begin(), buffer_.end());
+    buffer_.clear();
+    std::sort(
+        centroids_.begin(),
+        centroids_.end(),
+        [](const Centroid& a, const Centroid& b) { return a.mean_ < b.mean_; });
+
+    double total = 0.0;
+    for (const auto& c : centroids_) {
+      total += c.weight_;
+    }
+
+    // Merge adjacent centroids as long as the merged centroid spans less
+    // than one unit of the scale function. The scale function is flattest
+    // at the tails, which keeps extreme quantiles accurate, and its total
+    // range bounds the number of retained centroids by the compression
+    // factor.
+    std::vector<Centroid> merged;
+    merged.reserve(static_cast<size_t>(compression));
+    double weight_so_far = 0.0;
+    Centroid current = centroids_.front();
+    for (uint64_t i = 1; i < centroids_.size(); i++) {
+      const auto& c = centroids_[i];
+      const double q0 = weight_so_far / total;
+      const double q2 =
+          (weight_so_far + current.weight_ + c.weight_) / total;
+      if (scale(q2) - scale(q0) <= 1.0) {
+        current.weight_ += c.weight_;
+        current.mean_ +=
+            (c.mean_ - current.mean_) * c.weight_ / current.weight_;
+      } else {
+        weight_so_far += current.weight_;
+        merged.emplace_back(current);
+        current = c;
+      }
+    }
+    merged.emplace_back(current);
+
+    centroids_ = std::move(merged);
+    total_weight_ = total;
+  }
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_T_DIGEST_H
@@ -0,0 +1,177 @@
+/**
+ * @file unit_distinct_count_aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `HyperLogLog` and `DistinctCountAggregator` classes.
+ */
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/distinct_count_aggregator.h"
+#include "tiledb/sm/query/readers/aggregators/hyper_log_log.h"
+
+#include <test/support/src/helper_type.h>
+#include <test/support/tdb_catch.h>
+
+using namespace tiledb::sm;
+using namespace tiledb::test;
+
+TEST_CASE("HyperLogLog: estimates", "[hyper-log-log]") {
+  SECTION("Empty") {
+    HyperLogLog sketch;
+    CHECK(sketch.estimate() == 0);
+  }
+
+  SECTION("Small cardinalities are exact") {
+    HyperLogLog sketch;
+    for (uint64_t v = 0; v < 100; v++) {
+      // Add every value a few times, duplicates don't count.
+      for (uint64_t dup = 0; dup < 3; dup++) {
+        sketch.add(HyperLogLog::hash(&v, sizeof(v)));
+      }
+    }
+    CHECK(sketch.estimate() == 100);
+  }
+
+  SECTION("Large cardinalities are approximate") {
+    HyperLogLog sketch;
+    const uint64_t distinct = 100000;
+    for (uint64_t v = 0; v < distinct; v++) {
+      sketch.add(HyperLogLog::hash(&v, sizeof(v)));
+    }
+
+    // The relative standard error with 2^12 registers is about 1.6%, check
+    // for 5% to keep the test stable.
+    const auto est = static_cast<double>(sketch.estimate());
+    CHECK(est > distinct * 0.95);
+    CHECK(est < distinct * 1.05);
+  }
+
+  SECTION("Merge") {
+    HyperLogLog sketch1;
+    HyperLogLog sketch2;
+    for (uint64_t v = 0; v < 1000; v++) {
+      sketch1.add(HyperLogLog::hash(&v, sizeof(v)));
+
+      // Half of the values of the second sketch overlap with the first.
+      const uint64_t v2 = v + 500;
+      sketch2.add(HyperLogLog::hash(&v2, sizeof(v2)));
+    }
+
+    sketch1.merge(sketch2);
+    const auto est = static_cast<double>(sketch1.estimate());
+    CHECK(est > 1500 * 0.95);
+    CHECK(est < 1500 * 1.05);
+  }
+}
+
+TEST_CASE(
+    "Distinct count aggregator: basic aggregation",
+    "[distinct-count-aggregator][basic]") {
+  typedef int32_t T;
+  DistinctCountAggregator<T> aggregator(
+      FieldInfo("a1", false, false, 1, tdb_type<T>));
+  DistinctCountAggregator<T> aggregator_nullable(
+      FieldInfo("a2", false, true, 1, tdb_type<T>));
+
+  std::vector<T> fixed_data = {1, 2, 3, 4, 5, 5, 4, 3, 2, 1};
+  std::vector<uint8_t> validity_data = {0, 0, 1, 0, 1, 0, 1, 0, 1, 0};
+
+  SECTION("No bitmap") {
+    // Regular attribute, values 3, 4, 5, 5, 4, 3, 2, 1.
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.sketch().estimate() == 5);
+
+    // Nullable attribute, valid values 3, 5, 4, 2.
+    AggregateBuffer input_data2{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        validity_data.data(),
+        false,
+        nullopt,
+        0};
+    aggregator_nullable.aggregate_data(input_data2);
+    CHECK(aggregator_nullable.sketch().estimate() == 4);
+  }
+
+  SECTION("Regular bitmap") {
+    // Included values 5, 4, 2.
+    std::vector<uint8_t> bitmap = {1, 1, 0, 0, 0, 1, 1, 0, 1, 0};
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, bitmap.data(), 0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.sketch().estimate() == 3);
+  }
+
+  SECTION("Count bitmap") {
+    // Included values 3, 5, 4, 2, 1, multiplicities don't add distinct
+    // values.
+    std::vector<uint64_t> bitmap_count = {1, 2, 4, 0, 0, 1, 2, 0, 1, 2};
+    AggregateBuffer input_data{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        nullopt,
+        true,
+        bitmap_count.data(),
+        0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.sketch().estimate() == 5);
+  }
+
+  SECTION("Multiple tiles") {
+    AggregateBuffer input_data{
+        0, 5, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.aggregate_data(input_data);
+    AggregateBuffer input_data2{
+        5, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.aggregate_data(input_data2);
+    CHECK(aggregator.sketch().estimate() == 5);
+  }
+}
+
+TEST_CASE(
+    "Distinct count aggregator: var sized strings",
+    "[distinct-count-aggregator][var-sized]") {
+  DistinctCountAggregator<std::string> aggregator(
+      FieldInfo("a1", true, false, constants::var_num, Datatype::STRING_ASCII));
+
+  std::string var_data = "foobarfoobazbar";
+  std::vector<uint64_t> offsets = {0, 3, 6, 9, 12, 15};
+  AggregateBuffer input_data{
+      0, 5, offsets.data(), var_data.data(), nullopt, false, nullopt, 1};
+  aggregator.aggregate_data(input_data);
+
+  // Distinct values are foo, bar and baz.
+  CHECK(aggregator.sketch().estimate() == 3);
+}
@@ -0,0 +1,173 @@
+/**
+ * @file unit_group_by_aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `GroupByAggregator` class.
+ */
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/group_by_aggregator.h"
+#include "tiledb/sm/query/readers/aggregators/min_max.h"
+#include "tiledb/sm/query/readers/aggregators/safe_sum.h"
+#include "tiledb/sm/query/readers/aggregators/sum_type.h"
+#include "tiledb/sm/query/readers/aggregators/validity_policies.h"
+
+#include <test/support/src/helper_type.h>
+#include <test/support/tdb_catch.h>
+
+using namespace tiledb::sm;
+using namespace tiledb::test;
+
+typedef tuple<
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    float,
+    double>
+    FixedTypesUnderTest;
+TEMPLATE_LIST_TEST_CASE(
+    "Group by aggregator: safe sum",
+    "[group-by-aggregator][safe-sum]",
+    FixedTypesUnderTest) {
+  typedef TestType T;
+  typedef typename sum_type_data<T>::sum_type SUM_T;
+  GroupByAggregator<uint32_t, T, SUM_T, SafeSum, NonNull> aggregator(
+      FieldInfo("a1", false, false, 1, tdb_type<T>));
+  GroupByAggregator<uint32_t, T, SUM_T, SafeSum, NonNull> aggregator_nullable(
+      FieldInfo("a2", false, true, 1, tdb_type<T>));
+
+  std::vector<uint32_t> key_data = {1, 2, 1, 2, 1, 2, 1, 2, 1, 2};
+  std::vector<T> fixed_data = {1, 2, 3, 4, 5, 5, 4, 3, 2, 1};
+  std::vector<uint8_t> validity_data = {0, 0, 1, 0, 1, 0, 1, 0, 1, 0};
+
+  AggregateBuffer keys{
+      2, 10, key_data.data(), nullopt, nullopt, false, nullopt, 0};
+
+  SECTION("No bitmap") {
+    // Regular attribute.
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.template aggregate<uint8_t>(keys, input_data);
+    auto& groups = aggregator.groups();
+    CHECK(groups.size() == 2);
+    CHECK(groups.at(1).value_ == 14);
+    CHECK(groups.at(1).count_ == 4);
+    CHECK(groups.at(2).value_ == 13);
+    CHECK(groups.at(2).count_ == 4);
+
+    // Nullable attribute, only cells with key 1 are valid.
+    AggregateBuffer input_data2{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        validity_data.data(),
+        false,
+        nullopt,
+        0};
+    aggregator_nullable.template aggregate<uint8_t>(keys, input_data2);
+    auto& groups_nullable = aggregator_nullable.groups();
+    CHECK(groups_nullable.size() == 1);
+    CHECK(groups_nullable.at(1).value_ == 14);
+    CHECK(groups_nullable.at(1).count_ == 4);
+  }
+
+  SECTION("Regular bitmap") {
+    std::vector<uint8_t> bitmap = {1, 1, 0, 0, 0, 1, 1, 0, 1, 0};
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, bitmap.data(), 0};
+    aggregator.template aggregate<uint8_t>(keys, input_data);
+    auto& groups = aggregator.groups();
+    CHECK(groups.size() == 2);
+    CHECK(groups.at(1).value_ == 6);
+    CHECK(groups.at(1).count_ == 2);
+    CHECK(groups.at(2).value_ == 5);
+    CHECK(groups.at(2).count_ == 1);
+  }
+
+  SECTION("Count bitmap") {
+    std::vector<uint64_t> bitmap_count = {1, 2, 4, 0, 0, 1, 2, 0, 1, 2};
+    AggregateBuffer input_data{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        nullopt,
+        true,
+        bitmap_count.data(),
+        0};
+    aggregator.template aggregate<uint64_t>(keys, input_data);
+    auto& groups = aggregator.groups();
+    CHECK(groups.size() == 2);
+    CHECK(groups.at(1).value_ == 22);
+    CHECK(groups.at(1).count_ == 7);
+    CHECK(groups.at(2).value_ == 7);
+    CHECK(groups.at(2).count_ == 3);
+  }
+
+  SECTION("Constant key") {
+    // Two tiles combined into the same group.
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.template aggregate<uint8_t>(7, input_data);
+    AggregateBuffer input_data2{
+        0, 2, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.template aggregate<uint8_t>(7, input_data2);
+    auto& groups = aggregator.groups();
+    CHECK(groups.size() == 1);
+    CHECK(groups.at(7).value_ == 30);
+    CHECK(groups.at(7).count_ == 10);
+  }
+}
+
+TEST_CASE("Group by aggregator: min", "[group-by-aggregator][min]") {
+  typedef int32_t T;
+  GroupByAggregator<uint32_t, T, T, MinMax<std::less<T>>, NonNull> aggregator(
+      FieldInfo("a1", false, false, 1, tdb_type<T>));
+
+  std::vector<uint32_t> key_data = {1, 2, 1, 2, 1, 2, 1, 2, 1, 2};
+  std::vector<T> fixed_data = {1, 2, 3, 4, 5, 5, 4, 3, 2, 1};
+
+  AggregateBuffer keys{
+      2, 10, key_data.data(), nullopt, nullopt, false, nullopt, 0};
+  AggregateBuffer input_data{
+      2, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+  aggregator.template aggregate<uint8_t>(keys, input_data);
+  auto& groups = aggregator.groups();
+  CHECK(groups.size() == 2);
+  CHECK(groups.at(1).value_ == 2);
+  CHECK(groups.at(1).count_ == 4);
+  CHECK(groups.at(2).value_ == 1);
+  CHECK(groups.at(2).count_ == 4);
+}
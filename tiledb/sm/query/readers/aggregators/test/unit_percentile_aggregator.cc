@@ -0,0 +1,158 @@
+/**
+ * @file unit_percentile_aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `TDigest` and `PercentileAggregator` classes.
+ */
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
+#include "tiledb/sm/query/readers/aggregators/percentile_aggregator.h"
+#include "tiledb/sm/query/readers/aggregators/t_digest.h"
+
+#include <test/support/src/helper_type.h>
+#include <test/support/tdb_catch.h>
+
+using namespace tiledb::sm;
+using namespace tiledb::test;
+
+TEST_CASE("TDigest: quantiles", "[t-digest]") {
+  SECTION("Empty") {
+    TDigest digest;
+    CHECK(std::isnan(digest.quantile(0.5)));
+  }
+
+  SECTION("Single value") {
+    TDigest digest;
+    digest.add(42.0);
+    CHECK(digest.quantile(0.0) == 42.0);
+    CHECK(digest.quantile(0.5) == 42.0);
+    CHECK(digest.quantile(1.0) == 42.0);
+  }
+
+  SECTION("Uniform distribution") {
+    TDigest digest;
+    const uint64_t n = 100000;
+    for (uint64_t v = 0; v < n; v++) {
+      digest.add(static_cast<double>(v));
+    }
+
+    CHECK(digest.quantile(0.0) == 0.0);
+    CHECK(digest.quantile(1.0) == n - 1);
+
+    // The relative error with a compression of 100 is typically well under
+    // 1%, check for 2% to keep the test stable.
+    for (double q : {0.01, 0.25, 0.5, 0.75, 0.99}) {
+      const double est = digest.quantile(q);
+      CHECK(est > q * n - 0.02 * n);
+      CHECK(est < q * n + 0.02 * n);
+    }
+
+    // The digest size is bounded by the compression factor, not the number
+    // of values added.
+    CHECK(digest.centroids().size() < 2 * TDigest::compression);
+  }
+
+  SECTION("Merge") {
+    TDigest digest1;
+    TDigest digest2;
+    for (uint64_t v = 0; v < 1000; v++) {
+      digest1.add(static_cast<double>(v));
+      digest2.add(static_cast<double>(v + 1000));
+    }
+
+    digest1.merge(digest2);
+    CHECK(digest1.total_weight() == 2000.0);
+    const double est = digest1.quantile(0.5);
+    CHECK(est > 1000.0 - 40.0);
+    CHECK(est < 1000.0 + 40.0);
+  }
+}
+
+TEST_CASE(
+    "Percentile aggregator: basic aggregation",
+    "[percentile-aggregator][basic]") {
+  typedef int32_t T;
+  PercentileAggregator<T> aggregator(
+      FieldInfo("a1", false, false, 1, tdb_type<T>), 0.5);
+  PercentileAggregator<T> aggregator_nullable(
+      FieldInfo("a2", false, true, 1, tdb_type<T>), 0.5);
+
+  std::vector<T> fixed_data = {1, 2, 3, 4, 5, 5, 4, 3, 2, 1};
+  std::vector<uint8_t> validity_data = {0, 0, 1, 0, 1, 0, 1, 0, 1, 0};
+
+  SECTION("No bitmap") {
+    // Regular attribute, values 3, 4, 5, 5, 4, 3, 2, 1.
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, nullopt, 0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.digest().quantile(0.5) == 3.5);
+    CHECK(aggregator.digest().quantile(0.0) == 1.0);
+    CHECK(aggregator.digest().quantile(1.0) == 5.0);
+
+    // Nullable attribute, valid values 3, 5, 4, 2.
+    AggregateBuffer input_data2{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        validity_data.data(),
+        false,
+        nullopt,
+        0};
+    aggregator_nullable.aggregate_data(input_data2);
+    CHECK(aggregator_nullable.digest().quantile(0.5) == 3.5);
+  }
+
+  SECTION("Regular bitmap") {
+    // Included values 5, 4, 2.
+    std::vector<uint8_t> bitmap = {1, 1, 0, 0, 0, 1, 1, 0, 1, 0};
+    AggregateBuffer input_data{
+        2, 10, fixed_data.data(), nullopt, nullopt, false, bitmap.data(), 0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.digest().quantile(0.5) == 4.0);
+  }
+
+  SECTION("Count bitmap") {
+    // Included values 1, 1, 2, 3, 3, 3, 3, 4, 4, 5, multiplicities shift
+    // the quantiles.
+    std::vector<uint64_t> bitmap_count = {1, 2, 4, 0, 0, 1, 2, 0, 1, 2};
+    AggregateBuffer input_data{
+        2,
+        10,
+        fixed_data.data(),
+        nullopt,
+        nullopt,
+        true,
+        bitmap_count.data(),
+        0};
+    aggregator.aggregate_data(input_data);
+    CHECK(aggregator.digest().total_weight() == 10.0);
+    CHECK(aggregator.digest().quantile(0.5) == 3.0);
+  }
+}
@@ -0,0 +1,249 @@
+/**
+ * @file   cell_copy_kernels.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the cell copy kernels used on the dense reader cell slab
+ * copy path and on the dense tiler layout conversion path. The kernels copy
+ * fixed-size cells between a tile and a user buffer, reading every
+ * `stride`-th cell from the source. The generic
+ * path dispatches on the cell size, like `Dimension` dispatches on datatype,
+ * so the common sizes run as tight typed loops the compiler can vectorize.
+ * On x86-64, strided copies of 4 and 8 byte cells additionally use AVX2
+ * gathers, selected at runtime so binaries built for a generic baseline
+ * still benefit on newer CPUs. On other architectures (including AArch64
+ * NEON targets), the typed loops are left to the compiler's auto-vectorizer.
+ */
+
+#ifndef TILEDB_CELL_COPY_KERNELS_H
+#define TILEDB_CELL_COPY_KERNELS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_MSC_VER)
+#define TILEDB_CELL_COPY_AVX2
+#include <immintrin.h>
+#endif
+
+namespace tiledb::sm::cellcopy {
+
+/** Returns `true` if the AVX2 kernels can run on this CPU. */
+inline bool avx2_supported() {
+#if defined(TILEDB_CELL_COPY_AVX2)
+  static const bool supported{__builtin_cpu_supports("avx2") != 0};
+  return supported;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Returns `true` if a strided gather with the given stride can be indexed
+ * with the 32-bit lane indices the AVX2 kernels use.
+ */
+inline bool gather_stride_ok(uint64_t stride) {
+  return stride <= std::numeric_limits<int32_t>::max() / 8;
+}
+
+#if defined(TILEDB_CELL_COPY_AVX2)
+
+/** AVX2 strided copy of 4 byte cells using 32-bit gathers. */
+__attribute__((target("avx2"))) inline void copy_cells_strided_4_avx2(
+    uint8_t* dest, const uint8_t* src, uint64_t num_cells, uint64_t stride) {
+  const auto src32 = reinterpret_cast<const int*>(src);
+  const __m256i vindex = _mm256_mullo_epi32(
+      _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0),
+      _mm256_set1_epi32(static_cast<int32_t>(stride)));
+
+  uint64_t i = 0;
+  for (; i + 8 <= num_cells; i += 8) {
+    const __m256i v = _mm256_i32gather_epi32(src32 + i * stride, vindex, 4);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i * 4), v);
+  }
+
+  for (; i < num_cells; i++) {
+    std::memcpy(dest + i * 4, src32 + i * stride, 4);
+  }
+}
+
+/** AVX2 strided copy of 8 byte cells using 64-bit gathers. */
+__attribute__((target("avx2"))) inline void copy_cells_strided_8_avx2(
+    uint8_t* dest, const uint8_t* src, uint64_t num_cells, uint64_t stride) {
+  const auto src64 = reinterpret_cast<const long long*>(src);
+  const __m128i vindex = _mm_mullo_epi32(
+      _mm_set_epi32(3, 2, 1, 0), _mm_set1_epi32(static_cast<int32_t>(stride)));
+
+  uint64_t i = 0;
+  for (; i + 4 <= num_cells; i += 4) {
+    const __m256i v = _mm256_i32gather_epi64(src64 + i * stride, vindex, 8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i * 8), v);
+  }
+
+  for (; i < num_cells; i++) {
+    std::memcpy(dest + i * 8, src64 + i * stride, 8);
+  }
+}
+
+#endif  // TILEDB_CELL_COPY_AVX2
+
+/** Strided copy of cells of a fixed, compile-time size. */
+template <uint64_t cell_size>
+inline void copy_cells_strided(
+    uint8_t* dest, const uint8_t* src, uint64_t num_cells, uint64_t stride) {
+  for (uint64_t i = 0; i < num_cells; i++) {
+    std::memcpy(dest + i * cell_size, src + i * cell_size * stride, cell_size);
+  }
+}
+
+/**
+ * Copies `num_cells` cells of `cell_size` bytes from `src` to `dest`,
+ * reading every `stride`-th cell from `src` and writing contiguously.
+ *
+ * @param dest Destination buffer.
+ * @param src Source buffer.
+ * @param cell_size Size of a cell, in bytes.
+ * @param num_cells Number of cells to copy.
+ * @param stride Source stride, in cells.
+ */
+inline void copy_cells(
+    uint8_t* dest,
+    const uint8_t* src,
+    uint64_t cell_size,
+    uint64_t num_cells,
+    uint64_t stride) {
+  if (stride == 1) {
+    std::memcpy(dest, src, cell_size * num_cells);
+    return;
+  }
+
+  switch (cell_size) {
+    case 1:
+      copy_cells_strided<1>(dest, src, num_cells, stride);
+      break;
+    case 2:
+      copy_cells_strided<2>(dest, src, num_cells, stride);
+      break;
+    case 4:
+#if defined(TILEDB_CELL_COPY_AVX2)
+      if (avx2_supported() && gather_stride_ok(stride)) {
+        copy_cells_strided_4_avx2(dest, src, num_cells, stride);
+        break;
+      }
+#endif
+      copy_cells_strided<4>(dest, src, num_cells, stride);
+      break;
+    case 8:
+#if defined(TILEDB_CELL_COPY_AVX2)
+      if (avx2_supported() && gather_stride_ok(stride)) {
+        copy_cells_strided_8_avx2(dest, src, num_cells, stride);
+        break;
+      }
+#endif
+      copy_cells_strided<8>(dest, src, num_cells, stride);
+      break;
+    case 16:
+      copy_cells_strided<16>(dest, src, num_cells, stride);
+      break;
+    default:
+      for (uint64_t i = 0; i < num_cells; i++) {
+        std::memcpy(
+            dest + i * cell_size, src + i * cell_size * stride, cell_size);
+      }
+      break;
+  }
+}
+
+/**
+ * Transposes a `rows` x `cols` matrix of cells of `cell_size` bytes.
+ * Cell (i, j) is read from `src + (i + j * src_col_stride) * cell_size`
+ * and written to `dest + (i * dest_row_stride + j) * cell_size`, so the
+ * destination rows are written contiguously while the source is walked
+ * column by column.
+ *
+ * @param dest Destination buffer.
+ * @param src Source buffer.
+ * @param cell_size Size of a cell, in bytes.
+ * @param rows Number of destination rows.
+ * @param cols Number of destination columns.
+ * @param src_col_stride Source stride between columns, in cells.
+ * @param dest_row_stride Destination stride between rows, in cells.
+ */
+inline void transpose_cells(
+    uint8_t* dest,
+    const uint8_t* src,
+    uint64_t cell_size,
+    uint64_t rows,
+    uint64_t cols,
+    uint64_t src_col_stride,
+    uint64_t dest_row_stride) {
+  // Process the matrix in blocks so the strided source cells stay cached
+  // while the destination rows of a block are filled. Each block row is a
+  // strided copy, so it goes through the gather kernels.
+  const uint64_t block = std::max<uint64_t>(128 / cell_size, 8);
+  for (uint64_t jb = 0; jb < cols; jb += block) {
+    const uint64_t je = std::min(jb + block, cols);
+    for (uint64_t ib = 0; ib < rows; ib += block) {
+      const uint64_t ie = std::min(ib + block, rows);
+      for (uint64_t i = ib; i < ie; i++) {
+        copy_cells(
+            dest + (i * dest_row_stride + jb) * cell_size,
+            src + (i + jb * src_col_stride) * cell_size,
+            cell_size,
+            je - jb,
+            src_col_stride);
+      }
+    }
+  }
+}
+
+/**
+ * Copies `num_cells` validity bytes from `src` to `dest`, reading every
+ * `stride`-th byte from `src` and writing contiguously.
+ *
+ * @param dest Destination validity buffer.
+ * @param src Source validity buffer.
+ * @param num_cells Number of cells to copy.
+ * @param stride Source stride, in cells.
+ */
+inline void copy_validity(
+    uint8_t* dest, const uint8_t* src, uint64_t num_cells, uint64_t stride) {
+  if (stride == 1) {
+    std::memcpy(dest, src, num_cells);
+    return;
+  }
+
+  for (uint64_t i = 0; i < num_cells; i++) {
+    dest[i] = src[i * stride];
+  }
+}
+
+}  // namespace tiledb::sm::cellcopy
+
+#endif  // TILEDB_CELL_COPY_KERNELS_H
@@ -41,6 +41,7 @@
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/query/legacy/cell_slab_iter.h"
 #include "tiledb/sm/query/query_macros.h"
+#include "tiledb/sm/query/readers/cell_copy_kernels.h"
 #include "tiledb/sm/query/readers/filtered_data.h"
 #include "tiledb/sm/query/readers/result_tile.h"
 #include "tiledb/sm/stats/global_stats.h"
@@ -140,14 +141,6 @@ DenseReader::ReadState* DenseReader::read_state() {
   return &read_state_;
 }
 
-Status DenseReader::complete_read_loop() {
-  if (offsets_extra_element_) {
-    RETURN_NOT_OK(add_extra_offset());
-  }
-
-  return Status::Ok();
-}
-
 Status DenseReader::dowork() {
   auto timer_se = stats_->start_timer("dowork");
 
@@ -184,11 +177,11 @@ Status DenseReader::dowork() {
       RETURN_NOT_OK(read_state_.split_current());
 
       if (read_state_.unsplittable_) {
-        return complete_read_loop();
+        return Status::Ok();
       }
     } else {
       read_state_.unsplittable_ = false;
-      return complete_read_loop();
+      return Status::Ok();
     }
   } while (true);
 
@@ -227,6 +220,12 @@ Status DenseReader::dense_read() {
   // For easy reference.
   const auto dim_num = array_schema_.dim_num();
   auto& subarray = read_state_.partitioner_.current();
+
+  // The tile coordinates are deduplicated across ranges: a multi-range
+  // subarray with many ranges landing in the same tile yields that tile
+  // once, and the per-tile subarray below crops every range into it. Each
+  // tile is therefore read and unfiltered a single time, with the cell
+  // slabs of all its ranges emitted from the warm tile.
   subarray.compute_tile_coords<DimType>();
   const auto& domain{array_schema_.domain()};
 
@@ -237,6 +236,36 @@ Status DenseReader::dense_read() {
         *reinterpret_cast<const DimType*>(domain.tile_extent(d).data());
   }
 
+  // Point-read fast path: a single-cell subarray touches one cell per space
+  // tile, so only the tile chunk holding that cell needs to be unfiltered.
+  // Dense fragments align to the array tile grid, so the position of the
+  // cell within its space tile is the same for every fragment.
+  point_cell_pos_ = std::nullopt;
+  if (subarray.cell_num() == 1) {
+    uint64_t pos = 0;
+    auto accumulate_dim = [&](uint32_t d) {
+      const auto dim_dom = static_cast<const DimType*>(
+          domain.dimension_ptr(d)->domain().data());
+      const auto coord = *static_cast<const DimType*>(
+          subarray.ranges_for_dim(d)[0].start_fixed());
+      const auto pos_in_dim =
+          static_cast<uint64_t>(coord - dim_dom[0]) %
+          static_cast<uint64_t>(tile_extents[d]);
+      pos = pos * static_cast<uint64_t>(tile_extents[d]) + pos_in_dim;
+    };
+    if (array_schema_.cell_order() == Layout::COL_MAJOR) {
+      for (int32_t d = static_cast<int32_t>(dim_num) - 1; d >= 0; d--) {
+        accumulate_dim(static_cast<uint32_t>(d));
+      }
+    } else {
+      for (uint32_t d = 0; d < dim_num; d++) {
+        accumulate_dim(d);
+      }
+    }
+    point_cell_pos_ = pos;
+    stats_->add_counter("point_reads", 1);
+  }
+
   // Cache tile domains.
   const auto&& [array_tile_domain, frag_tile_domains] =
       compute_tile_domains<DimType>(read_state_.partitioner_.subarray());
@@ -338,13 +367,27 @@ Status DenseReader::dense_read() {
     var_buffer_sizes.emplace(name, 0);
   }
 
-  // The compute task is used to let the compute work happen while we reach the
-  // next read. There should ever be only one compute task at any given time and
-  // we wait for it to finish before we start any other piece of compute work.
-  // This is as far as we should go before implementing this properly in a task
-  // graph, where the start and end of every piece of work can clearly be
-  // identified.
+  // The compute work is pipelined in two stages so it can happen while we
+  // reach the next read. The unfilter task decompresses the tiles of one
+  // attribute while the compute task copies the previously unfiltered
+  // attribute to the user buffers; the stages use different resources
+  // (CPU for unfiltering, memory bandwidth for the copy) so overlapping
+  // them shortens the critical path. There should only ever be one task
+  // per stage at any given time and we wait for a stage to finish before
+  // we start another piece of work in it. This is as far as we should go
+  // before implementing this properly in a task graph, where the start and
+  // end of every piece of work can clearly be identified.
   ThreadPool::Task compute_task;
+  ThreadPool::Task unfilter_task;
+
+  // The attribute whose tiles are unfiltering (or that needs no unfilter)
+  // and whose copy has not started yet.
+  struct PendingCopy {
+    std::string name;
+    bool dense_dim;
+    std::vector<ResultTile*> result_tiles;
+  };
+  optional<PendingCopy> pending_copy;
 
   // Allow to disable the parallel read/compute in case the memory budget
   // doesn't allow it.
@@ -359,9 +402,14 @@ Status DenseReader::dense_read() {
   //   compute_task = proccess qc attributes
   //   for all attributes
   //     read attribute
+  //     wait(unfilter_task)
+  //     unfilter_task = unfilter attribute
   //     wait(compute_task)
-  //     compute_task = proccess attributes
+  //     compute_task = copy previous attribute
   //   end for
+  //   wait(unfilter_task)
+  //   wait(compute_task)
+  //   compute_task = copy last attribute
   // end for
   while (t_end < tile_coords.size()) {
     stats_->add_counter("internal_loop_num", 1);
@@ -431,9 +479,66 @@ Status DenseReader::dense_read() {
       continue;
     }
 
+    // Launches the copy stage for an attribute whose tiles are fully
+    // unfiltered. A name in names might not be in the user buffers so we
+    // might skip the copy but still clear the memory.
+    auto launch_copy = [&,
+                        iteration_tile_data,
+                        subarray_start_cell,
+                        subarray_end_cell,
+                        num_range_threads](PendingCopy&& pending) {
+      compute_task = resources_.compute_tp().execute(
+          [&,
+           iteration_tile_data,
+           subarray_start_cell,
+           subarray_end_cell,
+           num_range_threads,
+           pending = std::move(pending)]() mutable {
+            const auto& name = pending.name;
+
+            // Only copy names that are present in the user buffers.
+            if (!pending.dense_dim && buffers_.count(name) != 0) {
+              // Copy attribute data to users buffers.
+              auto& var_buffer_size = var_buffer_sizes[name];
+              auto status = copy_attribute<DimType, OffType>(
+                  name,
+                  tile_extents,
+                  subarray,
+                  subarray_start_cell,
+                  subarray_end_cell,
+                  tile_offsets,
+                  var_buffer_size,
+                  range_info,
+                  iteration_tile_data,
+                  qc_result,
+                  num_range_threads);
+              RETURN_CANCEL_OR_ERROR(status);
+            }
+
+            if (aggregates_.count(name) != 0) {
+              auto status = process_aggregates<DimType, OffType>(
+                  name,
+                  tile_extents,
+                  subarray,
+                  tiles_cell_num,
+                  tile_offsets,
+                  range_info,
+                  iteration_tile_data,
+                  qc_result,
+                  num_range_threads);
+              RETURN_CANCEL_OR_ERROR(status);
+            }
+
+            if (!pending.dense_dim) {
+              clear_tiles(name, pending.result_tiles);
+            }
+
+            return Status::Ok();
+          });
+    };
+
     // Process all attributes, names starts with the query condition names to
-    // clear the memory. Also, a name in names might not be in the user buffers
-    // so we might skip the copy but still clear the memory.
+    // clear the memory.
     for (auto& name : names) {
       shared_ptr<std::list<FilteredData>> filtered_data;
       std::vector<ResultTile*> result_tiles;
@@ -449,84 +554,82 @@ Status DenseReader::dense_read() {
             iteration_tile_data,
             tiles_cell_num);
 
-        // Wait for the compute task to finish before we read more tiles. This
-        // is to prevent using too much memory when the budget is small and
-        // doesn't allow to process more than one batch at a time.
-        if (wait_compute_task_before_read && compute_task.valid()) {
-          throw_if_not_ok(resources_.compute_tp().wait(compute_task));
+        // Wait for both pipeline stages to finish before we read more
+        // tiles. This is to prevent using too much memory when the budget
+        // is small and doesn't allow to process more than one batch at a
+        // time.
+        if (wait_compute_task_before_read) {
+          if (unfilter_task.valid()) {
+            throw_if_not_ok(resources_.compute_tp().wait(unfilter_task));
+          }
+          if (compute_task.valid()) {
+            throw_if_not_ok(resources_.compute_tp().wait(compute_task));
+          }
         }
 
-        // Read and unfilter tiles.
+        // Read tiles.
         std::vector<ReaderBase::NameToLoad> to_load;
         to_load.emplace_back(name, validity_only);
         filtered_data = make_shared<std::list<FilteredData>>(
             read_attribute_tiles(to_load, result_tiles));
       }
 
+      // Wait for the previous attribute to finish unfiltering so there is
+      // only ever one unfilter stage in flight, then start unfiltering this
+      // attribute. It runs while the previous attribute copies below.
+      if (unfilter_task.valid()) {
+        throw_if_not_ok(resources_.compute_tp().wait(unfilter_task));
+      }
+      if (!dense_dim) {
+        unfilter_task = resources_.compute_tp().execute(
+            [this,
+             iteration_tile_data,
+             filtered_data,
+             name,
+             validity_only,
+             result_tiles]() mutable {
+              // Unfilter tiles.
+              RETURN_NOT_OK(unfilter_tiles(name, validity_only, result_tiles));
+
+              // The filtered data is no longer required, release it.
+              filtered_data.reset();
+
+              return Status::Ok();
+            });
+      }
+
+      // Wait for the copy stage of the attribute before the previous one,
+      // then copy the previous attribute, now fully unfiltered, while this
+      // attribute unfilters.
       if (compute_task.valid()) {
         throw_if_not_ok(resources_.compute_tp().wait(compute_task));
         if (read_state_.overflowed_) {
+          // Don't return with an unfilter task still in flight.
+          if (unfilter_task.valid()) {
+            throw_if_not_ok(resources_.compute_tp().wait(unfilter_task));
+          }
           return Status::Ok();
         }
       }
+      if (pending_copy.has_value()) {
+        launch_copy(std::move(*pending_copy));
+      }
+      pending_copy = PendingCopy{name, dense_dim, std::move(result_tiles)};
+    }
 
-      compute_task = resources_.compute_tp().execute([&,
-                                                      iteration_tile_data,
-                                                      filtered_data,
-                                                      dense_dim,
-                                                      name,
-                                                      validity_only,
-                                                      subarray_start_cell,
-                                                      subarray_end_cell,
-                                                      num_range_threads,
-                                                      result_tiles]() mutable {
-        if (!dense_dim) {
-          // Unfilter tiles.
-          RETURN_NOT_OK(unfilter_tiles(name, validity_only, result_tiles));
-
-          // The filtered data is no longer required, release it.
-          filtered_data.reset();
-
-          // Only copy names that are present in the user buffers.
-          if (buffers_.count(name) != 0) {
-            // Copy attribute data to users buffers.
-            auto& var_buffer_size = var_buffer_sizes[name];
-            auto status = copy_attribute<DimType, OffType>(
-                name,
-                tile_extents,
-                subarray,
-                subarray_start_cell,
-                subarray_end_cell,
-                tile_offsets,
-                var_buffer_size,
-                range_info,
-                iteration_tile_data,
-                qc_result,
-                num_range_threads);
-            RETURN_CANCEL_OR_ERROR(status);
-          }
-        }
-
-        if (aggregates_.count(name) != 0) {
-          auto status = process_aggregates<DimType, OffType>(
-              name,
-              tile_extents,
-              subarray,
-              tiles_cell_num,
-              tile_offsets,
-              range_info,
-              iteration_tile_data,
-              qc_result,
-              num_range_threads);
-          RETURN_CANCEL_OR_ERROR(status);
-        }
-
-        if (!dense_dim) {
-          clear_tiles(name, result_tiles);
+    // Drain the pipeline: copy the last attribute of the batch.
+    if (pending_copy.has_value()) {
+      if (unfilter_task.valid()) {
+        throw_if_not_ok(resources_.compute_tp().wait(unfilter_task));
+      }
+      if (compute_task.valid()) {
+        throw_if_not_ok(resources_.compute_tp().wait(compute_task));
+        if (read_state_.overflowed_) {
+          return Status::Ok();
         }
-
-        return Status::Ok();
-      });
+      }
+      launch_copy(std::move(*pending_copy));
+      pending_copy.reset();
     }
 
     // Process count aggregates.
@@ -625,6 +728,20 @@ void DenseReader::init_read_state() {
         "sm.query.dense.qc_coords_mode requires a query condition");
   }
 
+  if (!config_
+           .get<bool>(
+               "sm.query.dense.qc_coords_ranges", &qc_coords_ranges_, &found)
+           .ok()) {
+    throw DenseReaderException("Cannot get setting");
+  }
+  assert(found);
+
+  if (qc_coords_ranges_ && !qc_coords_mode_) {
+    throw DenseReaderException(
+        "sm.query.dense.qc_coords_ranges requires "
+        "sm.query.dense.qc_coords_mode");
+  }
+
   // Create read state.
   read_state_.partitioner_ = SubarrayPartitioner(
       &config_,
@@ -761,6 +878,14 @@ DenseReader::compute_result_space_tiles(
     aggregate_only_field[n - condition_names.size()] = aggregate_only(name);
   }
 
+  // Resolve the schema properties of each field once, the loops below
+  // compute tile sizes for every result tile of every space tile.
+  std::vector<ResolvedField> resolved_fields;
+  resolved_fields.reserve(names.size());
+  for (auto& name : names) {
+    resolved_fields.emplace_back(resolve_field(name));
+  }
+
   // Here we estimate the size of the tile structures. First, we have to account
   // the size of the space tile structure. We could go deeper in the class to
   // account for other things but for now we keep it simpler. Second, we try to
@@ -834,10 +959,10 @@ DenseReader::compute_result_space_tiles(
     for (const auto& result_tile : result_space_tile.result_tiles()) {
       auto& rt = result_tile.second;
       for (uint64_t n = 0; n < condition_names.size(); n++) {
-        unfiltered_condition_memory +=
-            get_attribute_tile_size(names[n], rt.frag_idx(), rt.tile_idx());
+        unfiltered_condition_memory += get_attribute_tile_size(
+            resolved_fields[n], rt.frag_idx(), rt.tile_idx());
         filtered_condition_memory += get_attribute_persisted_tile_size(
-            names[n], rt.frag_idx(), rt.tile_idx());
+            resolved_fields[n], rt.frag_idx(), rt.tile_idx());
       }
     }
 
@@ -881,10 +1006,10 @@ DenseReader::compute_result_space_tiles(
       // Compute memory usage for all result tiles in the space tile.
       for (const auto& result_tile : result_space_tile.result_tiles()) {
         auto& rt = result_tile.second;
-        tile_memory_unfiltered +=
-            get_attribute_tile_size(names[n], rt.frag_idx(), rt.tile_idx());
+        tile_memory_unfiltered += get_attribute_tile_size(
+            resolved_fields[n], rt.frag_idx(), rt.tile_idx());
         tile_memory_filtered += get_attribute_persisted_tile_size(
-            names[n], rt.frag_idx(), rt.tile_idx());
+            resolved_fields[n], rt.frag_idx(), rt.tile_idx());
       }
 
       // - We always include the first tile, so if t_end == t_start, we don't
@@ -1184,7 +1309,7 @@ Status DenseReader::apply_query_condition(
 }
 
 template <class OffType>
-void DenseReader::fix_offsets_buffer(
+void DenseReader::fix_offsets_and_copy_var_buffer(
     const std::string& name,
     const bool nullable,
     const uint64_t subarray_start_cell,
@@ -1194,29 +1319,98 @@ void DenseReader::fix_offsets_buffer(
   // For easy reference.
   const auto& fill_value = array_schema_.attribute(name)->fill_value();
   const auto fill_value_size = (OffType)fill_value.size();
+  const uint64_t mult =
+      elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
   auto offsets_buffer = (OffType*)buffers_[name].buffer_;
+  auto var_buffer = static_cast<uint8_t*>(buffers_[name].buffer_var_);
+
+  // Split the cells into per-thread chunks. The scan below runs in two
+  // parallel passes with only the per-chunk totals reduced serially.
+  const uint64_t cell_num = subarray_end_cell - subarray_start_cell;
+  const auto num_threads = resources_.compute_tp().concurrency_level();
+  const uint64_t num_chunks =
+      std::max<uint64_t>(1, std::min<uint64_t>(num_threads, cell_num));
+  const uint64_t chunk_size = cell_num / num_chunks + 1;
+
+  // First pass: switch the fill value sentinels to sizes and compute the
+  // total var size of each chunk.
+  std::vector<uint64_t> chunk_var_size(num_chunks);
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, num_chunks, [&](uint64_t ch) {
+        const uint64_t start = subarray_start_cell + ch * chunk_size;
+        const uint64_t end = std::min(start + chunk_size, subarray_end_cell);
+        uint64_t total = 0;
+        for (uint64_t i = start; i < end; ++i) {
+          // The maximum value is used as a sentinel to request the fill
+          // value.
+          if (offsets_buffer[i] == std::numeric_limits<OffType>::max()) {
+            offsets_buffer[i] = fill_value_size;
+
+            // Set the pointer for the var data.
+            var_data[i - subarray_start_cell] = (void*)fill_value.data();
+          }
+          total += offsets_buffer[i];
+        }
+        chunk_var_size[ch] = total;
+        return Status::Ok();
+      }));
 
-  // Switch offsets from sizes to real offsets.
-  for (uint64_t i = subarray_start_cell; i < subarray_end_cell; ++i) {
-    auto tmp = offsets_buffer[i];
-
-    // The maximum value is used as a sentinel to request the fill value.
-    if (tmp == std::numeric_limits<OffType>::max()) {
-      tmp = fill_value_size;
-
-      // Set the pointer for the var data.
-      var_data[i - subarray_start_cell] = (void*)fill_value.data();
-    }
-    offsets_buffer[i] = var_buffer_size;
-    var_buffer_size += tmp;
+  // Compute the start offset of every chunk serially.
+  std::vector<uint64_t> chunk_offset(num_chunks);
+  for (uint64_t ch = 0; ch < num_chunks; ++ch) {
+    chunk_offset[ch] = var_buffer_size;
+    var_buffer_size += chunk_var_size[ch];
   }
 
-  // Set the output offset buffer sizes.
-  *buffers_[name].buffer_size_ = subarray_end_cell * sizeof(OffType);
+  // Set the output offset buffer sizes, accounting for the extra element.
+  *buffers_[name].buffer_size_ =
+      (subarray_end_cell + offsets_extra_element_) * sizeof(OffType);
 
   if (nullable) {
     *buffers_[name].validity_vector_.buffer_size() = subarray_end_cell;
   }
+
+  // Make sure the user var buffer is big enough.
+  const uint64_t required_var_size = var_buffer_size * mult;
+  const bool overflow = read_state_.overflowed_ ||
+                        required_var_size >
+                            buffers_[name].original_buffer_var_size_;
+
+  // Second pass: switch the sizes to real offsets and compact the var data
+  // into the user buffer in the same sweep. On overflow the var copy is
+  // skipped as the results will be discarded.
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, num_chunks, [&](uint64_t ch) {
+        const uint64_t start = subarray_start_cell + ch * chunk_size;
+        const uint64_t end = std::min(start + chunk_size, subarray_end_cell);
+        uint64_t offset = chunk_offset[ch];
+        for (uint64_t i = start; i < end; ++i) {
+          const uint64_t size = offsets_buffer[i];
+          offsets_buffer[i] = (OffType)offset;
+          if (!overflow) {
+            std::memcpy(
+                var_buffer + offset * mult,
+                var_data[i - subarray_start_cell],
+                size * mult);
+          }
+          offset += size;
+        }
+        return Status::Ok();
+      }));
+
+  // Exit early in case of overflow.
+  if (overflow) {
+    read_state_.overflowed_ = true;
+    return;
+  }
+
+  // The offset one past the last cell is the total var size, writing it here
+  // produces the final buffer layout without revisiting it after the copy.
+  if (offsets_extra_element_) {
+    offsets_buffer[subarray_end_cell] = (OffType)var_buffer_size;
+  }
+
+  *buffers_[name].buffer_var_size_ = required_var_size;
 }
 
 template <class DimType, class OffType>
@@ -1285,10 +1479,11 @@ Status DenseReader::copy_attribute(
     }
 
     {
-      // We have the cell lengths in the users buffer, convert to offsets.
+      // We have the cell lengths in the users buffer, convert them to
+      // offsets and compact the var data in the same sweep.
       auto timer_se = stats_->start_timer("fix_offset_tiles");
       const bool nullable = array_schema_.is_nullable(name);
-      fix_offsets_buffer<OffType>(
+      fix_offsets_and_copy_var_buffer<OffType>(
           name,
           nullable,
           subarray_start_cell,
@@ -1296,54 +1491,10 @@ Status DenseReader::copy_attribute(
           var_buffer_size,
           var_data);
 
-      // Make sure the user var buffer is big enough.
-      uint64_t required_var_size = var_buffer_size;
-      if (elements_mode_) {
-        required_var_size *= datatype_size(array_schema_.type(name));
-      }
-
       // Exit early in case of overflow.
-      if (read_state_.overflowed_ ||
-          required_var_size > buffers_[name].original_buffer_var_size_) {
-        read_state_.overflowed_ = true;
+      if (read_state_.overflowed_) {
         return Status::Ok();
       }
-
-      *buffers_[name].buffer_var_size_ = required_var_size;
-    }
-
-    {
-      auto timer_se = stats_->start_timer("copy_var_tiles");
-      // Process var data in parallel.
-      auto status = parallel_for_2d(
-          &resources_.compute_tp(),
-          iteration_tile_data->t_start(),
-          iteration_tile_data->t_end(),
-          0,
-          num_range_threads,
-          [&](uint64_t t, uint64_t range_thread_idx) {
-            // Find out result space tile and tile subarray.
-            const DimType* tc = (DimType*)&tile_coords[t][0];
-            auto& result_space_tile = result_space_tiles.at(tc);
-
-            throw_if_not_ok(copy_var_tiles<DimType, OffType>(
-                name,
-                tile_extents,
-                result_space_tile,
-                subarray,
-                iteration_tile_data->tile_subarray(t),
-                subarray_start_cell,
-                global_order ? tile_offsets[t] : 0,
-                var_data,
-                range_info,
-                t == iteration_tile_data->t_end() - 1,
-                var_buffer_size,
-                range_thread_idx,
-                num_range_threads));
-
-            return Status::Ok();
-          });
-      RETURN_NOT_OK(status);
     }
   } else {
     // Make sure the user fixed buffer is big enough.
@@ -1564,6 +1715,48 @@ Status DenseReader::copy_fixed_tiles(
     stride = 1;
   }
 
+  // Fast path: when the tile is fully covered by the subarray and a single
+  // fragment domain, the tile data and the destination buffer hold the same
+  // cells in the same order, so the whole tile can be copied at once, split
+  // between the range threads.
+  if (tile_tuples.size() == 1 && tile_tuples[0] != nullptr &&
+      can_copy_full_tile(result_space_tile, tile_subarray, tile_extents)) {
+    uint64_t tile_cell_num = 1;
+    for (auto e : tile_extents) {
+      tile_cell_num *= static_cast<uint64_t>(e);
+    }
+
+    const uint64_t thread_cell_num =
+        1 + ((tile_cell_num - 1) / num_range_threads);
+    const uint64_t min_cell =
+        std::min(range_thread_idx * thread_cell_num, tile_cell_num);
+    const uint64_t max_cell =
+        std::min(min_cell + thread_cell_num, tile_cell_num);
+    if (min_cell == max_cell) {
+      return Status::Ok();
+    }
+
+    if (range_thread_idx == 0) {
+      stats_->add_counter("copy_full_tiles", 1);
+    }
+
+    const auto& tile = tile_tuples[0]->fixed_tile();
+    std::memcpy(
+        dst_buf + (global_cell_offset + min_cell) * cell_size,
+        tile.data_as<char>() + min_cell * cell_size,
+        (max_cell - min_cell) * cell_size);
+
+    if (nullable) {
+      const auto& tile_nullable = tile_tuples[0]->validity_tile();
+      std::memcpy(
+          dst_val_buf + global_cell_offset + min_cell,
+          tile_nullable.data_as<char>() + min_cell,
+          max_cell - min_cell);
+    }
+
+    return Status::Ok();
+  }
+
   // Iterate over all coordinates, retrieved in cell slab.
   TileCellSlabIter<DimType> iter(
       range_thread_idx,
@@ -1624,24 +1817,21 @@ Status DenseReader::copy_fixed_tiles(
                 (end - start + 1));
           }
         } else {
-          // Go cell by cell.
-          auto src = tile.data_as<char>() + cell_size * src_offset;
-          auto dest = dest_ptr + cell_size * start;
-          for (uint64_t i = 0; i < end - start + 1; ++i) {
-            std::memcpy(dest, src, cell_size);
-            src += cell_size * stride;
-            dest += cell_size;
-          }
+          // Gather every `stride`-th cell from the tile.
+          cellcopy::copy_cells(
+              dest_ptr + cell_size * start,
+              tile.data_as<uint8_t>() + cell_size * src_offset,
+              cell_size,
+              end - start + 1,
+              stride);
 
           if (nullable) {
             const auto& tile_nullable = tile_tuples[fd]->validity_tile();
-            auto src_validity = tile_nullable.data_as<char>() + src_offset;
-            auto dest_validity = dest_validity_ptr + start;
-            for (uint64_t i = 0; i < end - start + 1; ++i) {
-              memcpy(dest_validity, src_validity, 1);
-              src_validity += stride;
-              dest_validity++;
-            }
+            cellcopy::copy_validity(
+                dest_validity_ptr + start,
+                tile_nullable.data_as<uint8_t>() + src_offset,
+                end - start + 1,
+                stride);
           }
         }
 
@@ -1902,87 +2092,6 @@ Status DenseReader::copy_offset_tiles(
   return Status::Ok();
 }
 
-template <class DimType, class OffType>
-Status DenseReader::copy_var_tiles(
-    const std::string& name,
-    const std::vector<DimType>& tile_extents,
-    ResultSpaceTile<DimType>& result_space_tile,
-    const Subarray& subarray,
-    const DenseTileSubarray<DimType>& tile_subarray,
-    const uint64_t subarray_start_cell,
-    const uint64_t global_cell_offset,
-    std::vector<void*>& var_data,
-    const std::vector<RangeInfo<DimType>>& range_info,
-    bool last_tile,
-    uint64_t var_buffer_size,
-    const uint64_t range_thread_idx,
-    const uint64_t num_range_threads) {
-  // For easy reference
-  const auto cell_order = array_schema_.cell_order();
-  auto dst_buf = static_cast<uint8_t*>(buffers_[name].buffer_var_);
-  auto offsets_buf = static_cast<OffType*>(buffers_[name].buffer_);
-  const auto data_type_size = datatype_size(array_schema_.type(name));
-
-  // Iterate over all coordinates, retrieved in cell slabs
-  TileCellSlabIter<DimType> iter(
-      range_thread_idx,
-      num_range_threads,
-      subarray,
-      tile_subarray,
-      tile_extents,
-      result_space_tile.start_coords(),
-      range_info,
-      cell_order);
-
-  // Initialise for global order, will be adjusted later for row/col major.
-  uint64_t cell_offset = global_cell_offset + iter.global_offset();
-  while (!iter.end()) {
-    // Compute cell offset for row/col major orders.
-    if (layout_ != Layout::GLOBAL_ORDER) {
-      cell_offset = iter.dest_offset_row_col();
-    }
-
-    auto cell_slab_length = iter.cell_slab_length();
-    ++iter;
-
-    // Setup variables for the copy.
-    auto mult = elements_mode_ ? data_type_size : 1;
-    uint64_t size = 0;
-    uint64_t offset = 0;
-    uint64_t i = 0;
-
-    // Copy the data cell by cell, last copy was taken out to take advantage
-    // of vectorization.
-    for (; i < cell_slab_length - 1; i++) {
-      offset = offsets_buf[cell_offset + i] * mult;
-      size = offsets_buf[cell_offset + i + 1] * mult - offset;
-      std::memcpy(
-          dst_buf + offset,
-          var_data[cell_offset + i - subarray_start_cell],
-          size);
-    }
-
-    // Do the last copy.
-    offset = offsets_buf[cell_offset + i] * mult;
-    if (last_tile && iter.last_slab() && i == cell_slab_length - 1) {
-      size = var_buffer_size * mult - offset;
-    } else {
-      size = offsets_buf[cell_offset + i + 1] * mult - offset;
-    }
-    std::memcpy(
-        dst_buf + offset,
-        var_data[cell_offset + i - subarray_start_cell],
-        size);
-
-    // Adjust cell offset for global order.
-    if (layout_ == Layout::GLOBAL_ORDER) {
-      cell_offset += cell_slab_length;
-    }
-  }
-
-  return Status::Ok();
-}
-
 template <class DimType>
 Status DenseReader::aggregate_tiles(
     const std::string& name,
@@ -2044,6 +2153,15 @@ Status DenseReader::aggregate_tiles(
       range_info,
       cell_order);
 
+  // The query condition was evaluated once into `qc_result` and the same
+  // bytes feed both the cell copy and all aggregate channels. A private
+  // copy of the slab is only required when older fragment domains must
+  // skip cells already aggregated from more recent ones, as that zeroes
+  // out parts of the bitmap. The scratch vector lives outside of the slab
+  // loop so its allocation is reused across slabs.
+  const bool needs_scratch_bitmap = frag_domains.size() > 1;
+  std::vector<uint8_t> scratch_bitmap;
+
   // Initialise for global order, will be adjusted later for row/col major.
   uint64_t cell_offset = global_cell_offset + iter.global_offset();
   while (!iter.end()) {
@@ -2052,14 +2170,30 @@ Status DenseReader::aggregate_tiles(
       cell_offset = iter.dest_offset_row_col();
     }
 
-    std::vector<uint8_t> aggregate_bitmap(iter.cell_slab_length(), 1);
-    if (condition_.has_value()) {
-      memcpy(
-          aggregate_bitmap.data(),
-          qc_result.data() + cell_offset,
-          iter.cell_slab_length());
+    const uint8_t* qc_slab =
+        condition_.has_value() ? qc_result.data() + cell_offset : nullptr;
+    if (needs_scratch_bitmap) {
+      if (qc_slab != nullptr) {
+        scratch_bitmap.assign(qc_slab, qc_slab + iter.cell_slab_length());
+      } else {
+        scratch_bitmap.assign(iter.cell_slab_length(), 1);
+      }
     }
 
+    // Returns the bitmap to aggregate with, starting at cell `c` of the
+    // slab. Without a query condition or a scratch copy, no bitmap is
+    // passed at all, which lets the aggregators run their bitmap-free
+    // loops. The const cast is safe as aggregation only reads the bitmap.
+    auto bitmap_at = [&](uint64_t c) -> optional<void*> {
+      if (needs_scratch_bitmap) {
+        return scratch_bitmap.data() + c;
+      } else if (qc_slab != nullptr) {
+        return const_cast<uint8_t*>(qc_slab) + c;
+      }
+
+      return nullopt;
+    };
+
     // Iterate through all fragment domains and copy data.
     for (uint64_t fd = 0; fd < frag_domains.size(); fd++) {
       // If the cell slab overlaps this fragment domain range, copy data.
@@ -2094,7 +2228,7 @@ Status DenseReader::aggregate_tiles(
               iter.pos_in_tile() + start,
               iter.pos_in_tile() + end + 1,
               tile_tuples[fd],
-              aggregate_bitmap.data() + start)};
+              bitmap_at(start))};
           for (auto& aggregate : aggregates) {
             aggregate->aggregate_data(aggregate_buffer);
           }
@@ -2117,7 +2251,7 @@ Status DenseReader::aggregate_tiles(
                 start_cell,
                 start_cell + 1,
                 tile_tuples[fd],
-                aggregate_bitmap.data() + start + i)};
+                bitmap_at(start + i))};
             for (auto& aggregate : aggregates) {
               aggregate->aggregate_data(aggregate_buffer);
             }
@@ -2129,7 +2263,7 @@ Status DenseReader::aggregate_tiles(
         // fragments.
         if (fd != frag_domains.size() - 1) {
           for (uint64_t c = start; c <= end; c++) {
-            aggregate_bitmap[c] = 0;
+            scratch_bitmap[c] = 0;
           }
         }
 
@@ -2148,41 +2282,6 @@ Status DenseReader::aggregate_tiles(
   return Status::Ok();
 }
 
-Status DenseReader::add_extra_offset() {
-  // Add extra offset element for all var size offset buffers.
-  for (const auto& it : buffers_) {
-    const auto& name = it.first;
-    if (!array_schema_.var_size(name)) {
-      continue;
-    }
-
-    // Do not apply offset for empty results because we will
-    // write backwards and corrupt memory we don't own.
-    if (*it.second.buffer_size_ == 0) {
-      continue;
-    }
-
-    auto buffer = static_cast<unsigned char*>(it.second.buffer_);
-    if (offsets_format_mode_ == "bytes") {
-      memcpy(
-          buffer + *it.second.buffer_size_,
-          it.second.buffer_var_size_,
-          offsets_bytesize());
-    } else if (offsets_format_mode_ == "elements") {
-      auto elements =
-          *it.second.buffer_var_size_ / datatype_size(array_schema_.type(name));
-      memcpy(buffer + *it.second.buffer_size_, &elements, offsets_bytesize());
-    } else {
-      return LOG_STATUS(Status_ReaderError(
-          "Cannot add extra offset to buffer; Unsupported offsets format"));
-    }
-
-    *it.second.buffer_size_ += offsets_bytesize();
-  }
-
-  return Status::Ok();
-}
-
 template <class T>
 void DenseReader::fill_dense_coords(
     const Subarray& subarray, const optional<std::vector<uint8_t>> qc_results) {
@@ -2202,9 +2301,11 @@ void DenseReader::fill_dense_coords(
   auto coords_it = buffers_.find(constants::coords);
   auto dim_num = array_schema_.dim_num();
   if (coords_it != buffers_.end()) {
-    // Check for overflow.
-    if (coords_it->second.original_buffer_size_ <
-        cell_num * array_schema_.cell_size(constants::coords)) {
+    // Check for overflow. In ranges mode, the number of runs is not known
+    // up front, so the check happens as runs are written instead.
+    if (!qc_coords_ranges_ &&
+        coords_it->second.original_buffer_size_ <
+            cell_num * array_schema_.cell_size(constants::coords)) {
       read_state_.overflowed_ = true;
       return;
     }
@@ -2216,8 +2317,9 @@ void DenseReader::fill_dense_coords(
       auto it = buffers_.find(dim->name());
       if (it != buffers_.end()) {
         // Check for overflow.
-        if (it->second.original_buffer_size_ <
-            cell_num * array_schema_.cell_size(dim->name())) {
+        if (!qc_coords_ranges_ &&
+            it->second.original_buffer_size_ <
+                cell_num * array_schema_.cell_size(dim->name())) {
           read_state_.overflowed_ = true;
           return;
         }
@@ -2238,6 +2340,12 @@ void DenseReader::fill_dense_coords(
         subarray, qc_results, qc_results_index, dim_idx, buffers, offsets);
   }
 
+  // In ranges mode a run might not have fit in the buffers, in which case
+  // the partial results are not committed.
+  if (read_state_.overflowed_) {
+    return;
+  }
+
   // Update buffer sizes.
   for (size_t i = 0; i < buffers.size(); ++i) {
     *(buffers[i]->buffer_size_) = offsets[i];
@@ -2259,6 +2367,9 @@ void DenseReader::fill_dense_coords_global(
     auto tile_subarray = subarray.crop_to_tile((const T*)&tc[0], cell_order);
     fill_dense_coords_row_col<T>(
         tile_subarray, qc_results, qc_results_index, dim_idx, buffers, offsets);
+    if (read_state_.overflowed_) {
+      return;
+    }
   }
 }
 
@@ -2280,10 +2391,35 @@ void DenseReader::fill_dense_coords_row_col(
   while (!iter.end()) {
     auto cell_slab = iter.cell_slab();
     auto coords_num = cell_slab.length_;
+    bool row_slabs = layout_ == Layout::ROW_MAJOR ||
+                     (layout_ == Layout::GLOBAL_ORDER &&
+                      cell_order == Layout::ROW_MAJOR);
 
     // Copy slab.
-    if (layout_ == Layout::ROW_MAJOR ||
-        (layout_ == Layout::GLOBAL_ORDER && cell_order == Layout::ROW_MAJOR))
+    if (qc_coords_ranges_) {
+      // Emit [first, last] coordinate runs of the matching cells instead of
+      // one coordinate per matching cell.
+      bool fit = row_slabs ? fill_dense_coords_row_slab_ranges(
+                                 &cell_slab.coords_[0],
+                                 qc_results,
+                                 qc_results_index,
+                                 coords_num,
+                                 dim_idx,
+                                 buffers,
+                                 offsets) :
+                             fill_dense_coords_col_slab_ranges(
+                                 &cell_slab.coords_[0],
+                                 qc_results,
+                                 qc_results_index,
+                                 coords_num,
+                                 dim_idx,
+                                 buffers,
+                                 offsets);
+      if (!fit) {
+        read_state_.overflowed_ = true;
+        return;
+      }
+    } else if (row_slabs) {
       fill_dense_coords_row_slab(
           &cell_slab.coords_[0],
           qc_results,
@@ -2292,7 +2428,7 @@ void DenseReader::fill_dense_coords_row_col(
           dim_idx,
           buffers,
           offsets);
-    else
+    } else {
       fill_dense_coords_col_slab(
           &cell_slab.coords_[0],
           qc_results,
@@ -2301,6 +2437,7 @@ void DenseReader::fill_dense_coords_row_col(
           dim_idx,
           buffers,
           offsets);
+    }
 
     ++iter;
   }
@@ -2421,4 +2558,175 @@ void DenseReader::fill_dense_coords_col_slab(
   }
 }
 
+template <class T>
+bool DenseReader::fill_dense_coords_row_slab_ranges(
+    const T* start,
+    const optional<std::vector<uint8_t>>& qc_results,
+    uint64_t& qc_results_index,
+    uint64_t num,
+    const std::vector<unsigned>& dim_idx,
+    const std::vector<QueryBuffer*>& buffers,
+    std::vector<uint64_t>& offsets) const {
+  // For easy reference.
+  auto dim_num = array_schema_.dim_num();
+
+  uint64_t i = 0;
+  while (i < num) {
+    // Skip non-matching cells.
+    if (qc_results.has_value() && !qc_results.value()[qc_results_index + i]) {
+      i++;
+      continue;
+    }
+
+    // Find the inclusive end of the run of matching cells starting at `i`.
+    uint64_t run_end = i;
+    while (run_end + 1 < num &&
+           (!qc_results.has_value() ||
+            qc_results.value()[qc_results_index + run_end + 1])) {
+      run_end++;
+    }
+
+    // Special zipped coordinates.
+    if (dim_idx.size() == 1 && dim_idx[0] == dim_num) {
+      auto c_buff = (char*)buffers[0]->buffer_;
+      auto offset = &offsets[0];
+
+      // Make sure both run endpoints fit before writing either.
+      if (*offset + 2 * dim_num * sizeof(T) >
+          buffers[0]->original_buffer_size_) {
+        return false;
+      }
+
+      for (auto run_i : {i, run_end}) {
+        // First dim-1 dimensions are copied as they are.
+        if (dim_num > 1) {
+          auto bytes_to_copy = (dim_num - 1) * sizeof(T);
+          std::memcpy(c_buff + *offset, start, bytes_to_copy);
+          *offset += bytes_to_copy;
+        }
+
+        // Last dimension is incremented by the cell position.
+        auto new_coord = start[dim_num - 1] + run_i;
+        std::memcpy(c_buff + *offset, &new_coord, sizeof(T));
+        *offset += sizeof(T);
+      }
+    } else {  // Set of separate coordinate buffers.
+      // Make sure both run endpoints fit before writing either.
+      for (size_t b = 0; b < buffers.size(); ++b) {
+        if (offsets[b] + 2 * sizeof(T) > buffers[b]->original_buffer_size_) {
+          return false;
+        }
+      }
+
+      for (auto run_i : {i, run_end}) {
+        for (size_t b = 0; b < buffers.size(); ++b) {
+          auto c_buff = (char*)buffers[b]->buffer_;
+          auto offset = &offsets[b];
+
+          // First dim-1 dimensions are copied as they are.
+          if (dim_num > 1 && dim_idx[b] < dim_num - 1) {
+            std::memcpy(c_buff + *offset, &start[dim_idx[b]], sizeof(T));
+            *offset += sizeof(T);
+          } else {
+            // Last dimension is incremented by the cell position.
+            auto new_coord = start[dim_num - 1] + run_i;
+            std::memcpy(c_buff + *offset, &new_coord, sizeof(T));
+            *offset += sizeof(T);
+          }
+        }
+      }
+    }
+
+    i = run_end + 1;
+  }
+
+  qc_results_index += num;
+  return true;
+}
+
+template <class T>
+bool DenseReader::fill_dense_coords_col_slab_ranges(
+    const T* start,
+    const optional<std::vector<uint8_t>>& qc_results,
+    uint64_t& qc_results_index,
+    uint64_t num,
+    const std::vector<unsigned>& dim_idx,
+    const std::vector<QueryBuffer*>& buffers,
+    std::vector<uint64_t>& offsets) const {
+  // For easy reference.
+  auto dim_num = array_schema_.dim_num();
+
+  uint64_t i = 0;
+  while (i < num) {
+    // Skip non-matching cells.
+    if (qc_results.has_value() && !qc_results.value()[qc_results_index + i]) {
+      i++;
+      continue;
+    }
+
+    // Find the inclusive end of the run of matching cells starting at `i`.
+    uint64_t run_end = i;
+    while (run_end + 1 < num &&
+           (!qc_results.has_value() ||
+            qc_results.value()[qc_results_index + run_end + 1])) {
+      run_end++;
+    }
+
+    // Special zipped coordinates.
+    if (dim_idx.size() == 1 && dim_idx[0] == dim_num) {
+      auto c_buff = (char*)buffers[0]->buffer_;
+      auto offset = &offsets[0];
+
+      // Make sure both run endpoints fit before writing either.
+      if (*offset + 2 * dim_num * sizeof(T) >
+          buffers[0]->original_buffer_size_) {
+        return false;
+      }
+
+      for (auto run_i : {i, run_end}) {
+        // First dimension is incremented by the cell position.
+        auto new_coord = start[0] + run_i;
+        std::memcpy(c_buff + *offset, &new_coord, sizeof(T));
+        *offset += sizeof(T);
+
+        // Last dim-1 dimensions are copied as they are.
+        if (dim_num > 1) {
+          auto bytes_to_copy = (dim_num - 1) * sizeof(T);
+          std::memcpy(c_buff + *offset, &start[1], bytes_to_copy);
+          *offset += bytes_to_copy;
+        }
+      }
+    } else {  // Separate coordinate buffers.
+      // Make sure both run endpoints fit before writing either.
+      for (size_t b = 0; b < buffers.size(); ++b) {
+        if (offsets[b] + 2 * sizeof(T) > buffers[b]->original_buffer_size_) {
+          return false;
+        }
+      }
+
+      for (auto run_i : {i, run_end}) {
+        for (size_t b = 0; b < buffers.size(); ++b) {
+          auto c_buff = (char*)buffers[b]->buffer_;
+          auto offset = &offsets[b];
+
+          // First dimension is incremented by the cell position.
+          if (dim_idx[b] == 0) {
+            auto new_coord = start[0] + run_i;
+            std::memcpy(c_buff + *offset, &new_coord, sizeof(T));
+            *offset += sizeof(T);
+          } else {  // Last dim-1 dimensions are copied as they are
+            std::memcpy(c_buff + *offset, &start[dim_idx[b]], sizeof(T));
+            *offset += sizeof(T);
+          }
+        }
+      }
+    }
+
+    i = run_end + 1;
+  }
+
+  qc_results_index += num;
+  return true;
+}
+
 }  // namespace tiledb::sm
@@ -204,6 +204,15 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
    */
   bool qc_coords_mode_;
 
+  /**
+   * Refinement of `qc_coords_mode_` that returns the matching cells as
+   * inclusive coordinate ranges instead of one coordinate per matching
+   * cell. Each maximal run of consecutive matching cells along the fastest
+   * varying dimension writes two entries to every coordinate buffer: the
+   * coordinates of the first and of the last cell of the run.
+   */
+  bool qc_coords_ranges_;
+
   /** Total memory budget. */
   uint64_t memory_budget_;
 
@@ -287,9 +296,17 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const uint64_t num_range_threads,
       std::vector<uint8_t>& qc_result);
 
-  /** Fix offsets buffer after reading all offsets. */
+  /**
+   * Fix the offsets buffer after reading all offsets and copy the var data
+   * to the user buffer.
+   *
+   * The offsets buffer contains cell sizes after the copy of the offset
+   * tiles. This switches them to real offsets with a two pass parallel scan,
+   * chunked on the compute thread pool, and compacts the var data into the
+   * user buffer in the same sweep as the second pass.
+   */
   template <class OffType>
-  void fix_offsets_buffer(
+  void fix_offsets_and_copy_var_buffer(
       const std::string& name,
       const bool nullable,
       const uint64_t subarray_start_cell,
@@ -343,6 +360,12 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       return false;
     }
 
+    // Some aggregates, like distinct count, cannot be computed from tile
+    // metadata.
+    if (!aggregates_use_frag_md(name)) {
+      return false;
+    }
+
     // Make sure there are no filtered results by the query condition and that
     // there are only one fragment domain for this tile. Having more fragment
     // domains for a tile means we'll have to merge data for many sources so we
@@ -376,6 +399,63 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
     return true;
   }
 
+  /**
+   * Returns whether the cell slabs of a space tile can be copied with a
+   * whole-tile copy. This is possible for global order results when the
+   * subarray covers the tile fully and the data comes from a single fragment
+   * domain that also covers the tile fully, with no cells filtered by the
+   * query condition. The tile data and the destination buffer then hold the
+   * same cells, contiguously and in the same order, so the per-slab offset
+   * math can be skipped entirely.
+   *
+   * @param result_space_tile Result space tile.
+   * @param tile_subarray Tile subarray.
+   * @param tile_extents Tile extents.
+   * @return If the space tile can be copied as a whole tile.
+   */
+  template <class DimType>
+  inline bool can_copy_full_tile(
+      ResultSpaceTile<DimType>& result_space_tile,
+      const DenseTileSubarray<DimType>& tile_subarray,
+      const std::vector<DimType>& tile_extents) const {
+    // The destination covers the tile contiguously only in global order.
+    if (layout_ != Layout::GLOBAL_ORDER) {
+      return false;
+    }
+
+    // Cells filtered by the query condition are replaced per cell slab.
+    if (condition_.has_value() && result_space_tile.qc_filtered_results()) {
+      return false;
+    }
+
+    // The data must come from a single fragment domain.
+    const auto& frag_domains = result_space_tile.frag_domains();
+    if (frag_domains.size() != 1) {
+      return false;
+    }
+
+    // The subarray and the fragment domain must cover the tile fully.
+    const auto& start_coords = result_space_tile.start_coords();
+    for (unsigned d = 0; d < tile_extents.size(); d++) {
+      const DimType tile_start = start_coords[d];
+      const DimType tile_end = tile_start + tile_extents[d] - 1;
+
+      const auto& ranges = tile_subarray.ranges()[d];
+      if (ranges.size() != 1 || ranges[0].start_ != tile_start ||
+          ranges[0].end_ != tile_end) {
+        return false;
+      }
+
+      auto dom =
+          static_cast<const DimType*>(frag_domains[0].domain()[d].data());
+      if (dom[0] > tile_start || dom[1] < tile_end) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   /** Process aggregates for a given field. */
   template <class DimType, class OffType>
   Status process_aggregates(
@@ -430,23 +510,6 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const uint64_t range_thread_idx,
       const uint64_t num_range_threads);
 
-  /** Copy a var tile to the output buffers. */
-  template <class DimType, class OffType>
-  Status copy_var_tiles(
-      const std::string& name,
-      const std::vector<DimType>& tile_extents,
-      ResultSpaceTile<DimType>& result_space_tile,
-      const Subarray& subarray,
-      const DenseTileSubarray<DimType>& tile_subarray,
-      const uint64_t subarray_start_cell,
-      const uint64_t global_cell_offset,
-      std::vector<void*>& var_data,
-      const std::vector<RangeInfo<DimType>>& range_info,
-      bool last_tile,
-      uint64_t var_buffer_sizes,
-      const uint64_t range_thread_idx,
-      const uint64_t num_range_threads);
-
   /** Aggregate tiles. */
   template <class DimType>
   Status aggregate_tiles(
@@ -461,15 +524,6 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const uint64_t range_thread_idx,
       const uint64_t num_range_threads);
 
-  /**
-   * Adds an extra offset in the end of the offsets buffer indicating the
-   * returned data size if an attribute is var-sized.
-   */
-  Status add_extra_offset();
-
-  /** Perform necessary checks before exiting a read loop */
-  Status complete_read_loop();
-
   /**
    * Fills the coordinate buffer with coordinates. Applicable only to dense
    * arrays when the user explicitly requests the coordinates to be
@@ -599,6 +653,70 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const std::vector<unsigned>& dim_idx,
       const std::vector<QueryBuffer*>& buffers,
       std::vector<uint64_t>& offsets) const;
+
+  /**
+   * Fills coordinate ranges in the input buffers for a particular cell
+   * slab, following a row-major layout. Each maximal run of consecutive
+   * cells in the slab that match the query condition writes two entries to
+   * every buffer: the coordinates of the first and of the last cell of the
+   * run.
+   *
+   * @tparam T Domain type.
+   * @param start Starting coordinates in the slab.
+   * @param qc_results Results from the query condition.
+   * @param qc_results_index Current index in the `qc_results` buffer.
+   * @param num Number of cells in the slab.
+   * @param dim_idx Dimension indices of the corresponding `buffers`.
+   *     For the special zipped coordinates, `dim_idx`, `buffers` and
+   *     `offsets` contain a single element and `dim_idx` contains `dim_num`
+   *     as the dimension index.
+   * @param buffers Buffers to copy from. It could be the special zipped
+   *     coordinates or separate coordinate buffers.
+   * @param offsets Offsets that will be used eventually to update the buffer
+   *     sizes, determining the useful results written in the buffers.
+   * @return `false` if a run did not fit in the buffers, `true` otherwise.
+   */
+  template <class T>
+  bool fill_dense_coords_row_slab_ranges(
+      const T* start,
+      const optional<std::vector<uint8_t>>& qc_results,
+      uint64_t& qc_results_index,
+      uint64_t num,
+      const std::vector<unsigned>& dim_idx,
+      const std::vector<QueryBuffer*>& buffers,
+      std::vector<uint64_t>& offsets) const;
+
+  /**
+   * Fills coordinate ranges in the input buffers for a particular cell
+   * slab, following a col-major layout. Each maximal run of consecutive
+   * cells in the slab that match the query condition writes two entries to
+   * every buffer: the coordinates of the first and of the last cell of the
+   * run.
+   *
+   * @tparam T Domain type.
+   * @param start Starting coordinates in the slab.
+   * @param qc_results Results from the query condition.
+   * @param qc_results_index Current index in the `qc_results` buffer.
+   * @param num Number of cells in the slab.
+   * @param dim_idx Dimension indices of the corresponding `buffers`.
+   *     For the special zipped coordinates, `dim_idx`, `buffers` and
+   *     `offsets` contain a single element and `dim_idx` contains `dim_num`
+   *     as the dimension index.
+   * @param buffers Buffers to copy from. It could be the special zipped
+   *     coordinates or separate coordinate buffers.
+   * @param offsets Offsets that will be used eventually to update the buffer
+   *     sizes, determining the useful results written in the buffers.
+   * @return `false` if a run did not fit in the buffers, `true` otherwise.
+   */
+  template <class T>
+  bool fill_dense_coords_col_slab_ranges(
+      const T* start,
+      const optional<std::vector<uint8_t>>& qc_results,
+      uint64_t& qc_results_index,
+      uint64_t num,
+      const std::vector<unsigned>& dim_idx,
+      const std::vector<QueryBuffer*>& buffers,
+      std::vector<uint64_t>& offsets) const;
 };
 
 }  // namespace tiledb::sm
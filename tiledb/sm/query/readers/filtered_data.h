@@ -33,9 +33,13 @@
 #ifndef TILEDB_FILTERED_DATA_H
 #define TILEDB_FILTERED_DATA_H
 
+#include <unordered_map>
+
 #include "tiledb/common/common.h"
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/status.h"
+#include "tiledb/sm/cache/tile_cache.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/storage_manager/context_resources.h"
 
 using namespace tiledb::common;
@@ -106,6 +110,11 @@ class FilteredDataBlock {
     return filtered_data_.get();
   }
 
+  /** @return Shared ownership of the buffer backing the data block. */
+  inline std::shared_ptr<std::byte> shared_data() {
+    return filtered_data_;
+  }
+
   /** @return Size of the data block. */
   inline storage_size_t size() const {
     return size_;
@@ -138,7 +147,7 @@ class FilteredDataBlock {
   storage_size_t size_;
 
   /** Data for the data block. */
-  tdb::pmr::unique_ptr<std::byte> filtered_data_;
+  std::shared_ptr<std::byte> filtered_data_;
 };
 
 /**
@@ -172,6 +181,10 @@ class FilteredData {
    * @param var_sized Is the field var sized?
    * @param nullable Is the field nullable?
    * @param validity_only Is the field read for validity only?
+   * @param stream_var Should eligible var tiles be excluded from the var
+   * data blocks so that only the selected cells' byte ranges are read later?
+   * @param cached_tiles Result tiles served from the tile cache, excluded
+   * from the read batches.
    * @param read_tasks Read tasks to queue new tasks on for new data blocks.
    * @param memory_tracker Memory tracker.
    */
@@ -187,6 +200,9 @@ class FilteredData {
       const bool var_sized,
       const bool nullable,
       const bool validity_only,
+      const bool stream_var,
+      const std::unordered_map<const ResultTile*, CachedTileData>&
+          cached_tiles,
       std::vector<ThreadPool::Task>& read_tasks,
       shared_ptr<MemoryTracker> memory_tracker)
       : resources_(resources)
@@ -201,7 +217,9 @@ class FilteredData {
       , fragment_metadata_(fragment_metadata)
       , var_sized_(var_sized)
       , nullable_(nullable)
-      , read_tasks_(read_tasks) {
+      , read_tasks_(read_tasks)
+      , cancellation_source_(reader.cancellation_source())
+      , stats_(reader.stats()) {
     if (result_tiles.size() == 0) {
       return;
     }
@@ -226,6 +244,11 @@ class FilteredData {
         continue;
       }
 
+      // Tiles served from the tile cache don't need their data read.
+      if (cached_tiles.count(rt) != 0) {
+        continue;
+      }
+
       // Make new blocks, if required as we go for fixed, var and nullable data.
       auto fragment{fragment_metadata[rt->frag_idx()].get()};
       if (!validity_only) {
@@ -242,7 +265,13 @@ class FilteredData {
             TileType::FIXED);
       }
 
-      if (var_sized && !validity_only) {
+      // Tiles eligible for streamed partial reads only batch their var data
+      // once the offsets are unfiltered.
+      const bool stream_var_tile{
+          stream_var && !validity_only &&
+          reader.can_stream_var_tile(name, rt->frag_idx(), rt->tile_idx())};
+
+      if (var_sized && !validity_only && !stream_var_tile) {
         tiles_allocated++;
         make_new_block_if_required(
             fragment,
@@ -371,6 +400,72 @@ class FilteredData {
     return current_data_block(TileType::NULLABLE)->data_at(offset);
   }
 
+  /**
+   * Get shared ownership of the data block holding the fixed filtered data
+   * for the result tile, for the zero-copy read path.
+   *
+   * @param fragment Fragment metadata for the tile.
+   * @param rt Result tile.
+   * @return Shared ownership of the data block's buffer.
+   */
+  inline std::shared_ptr<std::byte> fixed_data_owner(
+      const FragmentMetadata* fragment, const ResultTile* rt) {
+    auto offset{
+        fragment->loaded_metadata()->file_offset(name_, rt->tile_idx())};
+    ensure_data_block_current(TileType::FIXED, fragment, rt, offset);
+    return current_data_block(TileType::FIXED)->shared_data();
+  }
+
+  /**
+   * Get shared ownership of the data block holding the var filtered data
+   * for the result tile, for the zero-copy read path.
+   *
+   * @param fragment Fragment metadata for the tile.
+   * @param rt Result tile.
+   * @return Shared ownership of the data block's buffer.
+   */
+  inline std::shared_ptr<std::byte> var_data_owner(
+      const FragmentMetadata* fragment, const ResultTile* rt) {
+    if (!var_sized_) {
+      return nullptr;
+    }
+
+    auto offset{
+        fragment->loaded_metadata()->file_var_offset(name_, rt->tile_idx())};
+    ensure_data_block_current(TileType::VAR, fragment, rt, offset);
+    return current_data_block(TileType::VAR)->shared_data();
+  }
+
+  /**
+   * Get shared ownership of the data block holding the validity filtered
+   * data for the result tile, for the zero-copy read path.
+   *
+   * @param fragment Fragment metadata for the tile.
+   * @param rt Result tile.
+   * @return Shared ownership of the data block's buffer.
+   */
+  inline std::shared_ptr<std::byte> nullable_data_owner(
+      const FragmentMetadata* fragment, const ResultTile* rt) {
+    if (!nullable_) {
+      return nullptr;
+    }
+
+    auto offset{fragment->loaded_metadata()->file_validity_offset(
+        name_, rt->tile_idx())};
+    ensure_data_block_current(TileType::NULLABLE, fragment, rt, offset);
+    return current_data_block(TileType::NULLABLE)->shared_data();
+  }
+
+  /**
+   * @return Indexes, in the read tasks vector passed to the constructor, of
+   * the tasks reading the data blocks of each fragment. Data blocks never
+   * span fragments, so the task indexes of two fragments never intersect.
+   */
+  inline const std::unordered_map<unsigned, std::vector<size_t>>&
+  tasks_by_fragment() const {
+    return tasks_by_fragment_;
+  }
+
  private:
   /* ********************************* */
   /*           PRIVATE ENUMS           */
@@ -390,12 +485,16 @@ class FilteredData {
    */
   void queue_last_block_for_read(TileType type) {
     auto& block{data_blocks(type).back()};
+    tasks_by_fragment_[block.frag_idx()].emplace_back(read_tasks_.size());
     auto offset{block.offset()};
     auto data{block.data()};
     auto size{block.size()};
     URI uri{file_uri(fragment_metadata_[block.frag_idx()].get(), type)};
+    stats_->add_counter("read_ops_num", 1);
+    stats_->add_counter("read_byte_num", size);
     auto task = resources_.io_tp().execute([this, offset, data, size, uri]() {
-      throw_if_not_ok(resources_.vfs().read(uri, offset, data, size, false));
+      throw_if_not_ok(resources_.vfs().read(
+          uri, offset, data, size, false, &cancellation_source_));
       return Status::Ok();
     });
     read_tasks_.push_back(std::move(task));
@@ -637,6 +736,23 @@ class FilteredData {
 
   /** Read tasks. */
   std::vector<ThreadPool::Task>& read_tasks_;
+
+  /** Cancellation source of the parent query, checked by queued reads. */
+  CancellationSource cancellation_source_;
+
+  /**
+   * Stats of the parent reader. The reads issued for the data blocks are
+   * counted here, on top of the context-wide VFS stats, so that IO can be
+   * attributed to the individual query.
+   */
+  stats::Stats* stats_;
+
+  /**
+   * Indexes, in the read tasks vector, of the tasks reading the data blocks
+   * of each fragment. Used to unfilter the tiles of a fragment as soon as
+   * its own reads have completed.
+   */
+  std::unordered_map<unsigned, std::vector<size_t>> tasks_by_fragment_;
 };
 
 }  // namespace tiledb::sm
@@ -35,6 +35,7 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/utils.h"
@@ -46,6 +47,7 @@
 #include "tiledb/sm/subarray/subarray.h"
 #include "tiledb/type/apply_with_type.h"
 
+#include <algorithm>
 #include <numeric>
 
 using namespace tiledb;
@@ -131,6 +133,11 @@ OrderedDimLabelReader::OrderedDimLabelReader(
     throw OrderedDimLabelReaderException("Cannot get setting");
   }
   assert(found);
+
+  // Partial unfiltering needs fixed-size, non-nullable labels so that every
+  // inspected cell maps to a single filtered chunk.
+  partial_unfilter_ =
+      !label_var_size_ && !array_schema_.attributes()[0]->nullable();
 }
 
 /* ****************************** */
@@ -241,9 +248,17 @@ void OrderedDimLabelReader::label_read() {
     }
     std::sort(result_tiles.begin(), result_tiles.end(), result_tile_cmp);
 
-    // Read/unfilter tiles.
-    throw_if_not_ok(
-        read_and_unfilter_attribute_tiles({label_name_}, result_tiles));
+    // Read/unfilter tiles. With partial unfiltering, only the filtered tile
+    // data is read here and the search below unfilters individual chunks on
+    // demand. The filtered data blocks must outlive the search.
+    std::list<FilteredData> filtered_data;
+    if (partial_unfilter_) {
+      filtered_data = read_attribute_tiles({label_name_}, result_tiles);
+      prepare_partial_unfilter_states(result_tiles);
+    } else {
+      throw_if_not_ok(
+          read_and_unfilter_attribute_tiles({label_name_}, result_tiles));
+    }
 
     // Compute/copy results.
     throw_if_not_ok(
@@ -253,6 +268,7 @@ void OrderedDimLabelReader::label_read() {
         }));
 
     // Truncate ranges_ for the next iteration.
+    partial_unfilter_states_.clear();
     for (auto& rt_map : result_tiles_) {
       rt_map.clear();
     }
@@ -539,10 +555,77 @@ uint64_t OrderedDimLabelReader::create_result_tiles() {
   return max_range + 1;
 }
 
+void OrderedDimLabelReader::prepare_partial_unfilter_states(
+    const std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("prepare_partial_unfilter_states");
+
+  partial_unfilter_states_.clear();
+  for (auto rt : result_tiles) {
+    auto tile_tuple = rt->tile_tuple(label_name_);
+
+    // Skip tiles that are already unfiltered, e.g. from the tile cache.
+    if (tile_tuple == nullptr ||
+        tile_tuple->fixed_tile().filtered_size() == 0) {
+      continue;
+    }
+
+    auto& state = partial_unfilter_states_[rt];
+    tile_tuple->fixed_tile().load_chunk_data(state.chunk_data);
+    state.unfiltered.resize(state.chunk_data.chunk_offsets_.size());
+  }
+}
+
+void OrderedDimLabelReader::unfilter_label_chunk(
+    ResultTile& rt, const uint64_t cell_idx) {
+  auto state_iter = partial_unfilter_states_.find(&rt);
+
+  // Tiles without a state are already fully unfiltered.
+  if (state_iter == partial_unfilter_states_.end()) {
+    return;
+  }
+
+  // Find the chunk containing the cell from the unfiltered chunk offsets.
+  auto& state = state_iter->second;
+  const uint64_t cell_offset = cell_idx * array_schema_.cell_size(label_name_);
+  auto& chunk_offsets = state.chunk_data.chunk_offsets_;
+  const uint64_t chunk_idx =
+      std::distance(
+          chunk_offsets.begin(),
+          std::upper_bound(
+              chunk_offsets.begin(), chunk_offsets.end(), cell_offset)) -
+      1;
+
+  // Unfilter the chunk if it hasn't been done already. Concurrent range
+  // searches can inspect the same chunk; call_once makes sure only one of
+  // them runs the pipeline while the others wait for the data.
+  std::call_once(state.unfiltered[chunk_idx], [&]() {
+    FilterPipeline filters = array_schema_.filters(label_name_);
+    throw_if_not_ok(FilterPipeline::append_encryption_filter(
+        &filters, array_->get_encryption_key()));
+
+    stats_->add_counter("label_chunks_unfiltered", 1);
+    throw_if_not_ok(filters.run_reverse(
+        stats_,
+        &rt.tile_tuple(label_name_)->fixed_tile(),
+        nullptr,
+        state.chunk_data,
+        chunk_idx,
+        chunk_idx + 1,
+        1,
+        resources_.config()));
+  });
+}
+
 template <typename LabelType>
 LabelType OrderedDimLabelReader::get_label_value(
     const unsigned f, const uint64_t tile_idx, const uint64_t cell_idx) {
   auto& rt = result_tiles_[f].at(tile_idx);
+
+  // Make sure the chunk containing the cell is unfiltered.
+  if (partial_unfilter_) {
+    unfilter_label_chunk(rt, cell_idx);
+  }
+
   return rt.attribute_value<LabelType>(label_name_, cell_idx);
 }
 
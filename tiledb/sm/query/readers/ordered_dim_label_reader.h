@@ -34,6 +34,8 @@
 #define TILEDB_ORDERED_DIM_LABEL_READER
 
 #include <atomic>
+#include <deque>
+#include <mutex>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
@@ -341,6 +343,28 @@ class OrderedDimLabelReader : public ReaderBase, public IQueryStrategy {
   /** Total memory budget. */
   uint64_t memory_budget_;
 
+  /**
+   * Are candidate tiles unfiltered one chunk at a time during the binary
+   * search? When enabled, only the filtered tile data is read up front and
+   * the search unfilters the chunk containing each inspected cell, instead
+   * of unfiltering every candidate tile in full. Enabled for fixed-size,
+   * non-nullable labels, where a cell always maps to a single chunk.
+   */
+  bool partial_unfilter_;
+
+  /** Per-chunk unfiltering state of a partially unfiltered label tile. */
+  struct PartialUnfilterState {
+    /** Chunk info, buffers and offsets of the filtered tile. */
+    ChunkData chunk_data;
+
+    /** One flag per chunk; a deque as std::once_flag is not movable. */
+    std::deque<std::once_flag> unfiltered;
+  };
+
+  /** Partial unfiltering states, by result tile. */
+  std::unordered_map<ResultTile*, PartialUnfilterState>
+      partial_unfilter_states_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -431,6 +455,25 @@ class OrderedDimLabelReader : public ReaderBase, public IQueryStrategy {
   template <typename IndexType>
   uint64_t create_result_tiles();
 
+  /**
+   * Prepare the partial unfiltering states (chunk offsets and per-chunk
+   * flags) for freshly read label tiles. Tiles that are already unfiltered,
+   * e.g. served from the tile cache, get no state.
+   *
+   * @param result_tiles Result tiles to process.
+   */
+  void prepare_partial_unfilter_states(
+      const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Unfilter the chunk of a label tile containing a cell, if it hasn't been
+   * unfiltered already.
+   *
+   * @param rt Result tile.
+   * @param cell_idx Cell index in the tile.
+   */
+  void unfilter_label_chunk(ResultTile& rt, uint64_t cell_idx);
+
   /**
    * Get the fixed label value in a specific fragment/tile/cell.
    *
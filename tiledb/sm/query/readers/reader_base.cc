@@ -33,6 +33,7 @@
 #include "tiledb/sm/query/readers/reader_base.h"
 #include "tiledb/common/indexed_list.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/enums/encryption_type.h"
@@ -67,6 +68,14 @@ class ReaderBaseStatusException : public StatusException {
   }
 };
 
+/**
+ * On-disk size of the chunk prologue of a single-chunk tile: the number of
+ * chunks and the sizes of the chunk's unfiltered data, filtered data and
+ * filtered metadata.
+ */
+constexpr uint64_t single_chunk_prologue_size =
+    sizeof(uint64_t) + 3 * sizeof(uint32_t);
+
 /* ****************************** */
 /*          CONSTRUCTORS          */
 /* ****************************** */
@@ -82,17 +91,38 @@ ReaderBase::ReaderBase(
     , max_batch_size_(config_.get<uint64_t>("vfs.max_batch_size").value())
     , min_batch_gap_(config_.get<uint64_t>("vfs.min_batch_gap").value())
     , min_batch_size_(config_.get<uint64_t>("vfs.min_batch_size").value())
+    , zero_copy_unfiltered_tiles_(config_.get<bool>(
+          "sm.query.zero_copy_unfiltered_tiles", Config::must_find))
+    , streamed_var_read_min_tile_size_(config_.get<uint64_t>(
+          "sm.query.streamed_var_read_min_tile_size", Config::must_find))
+    , tile_major_unfilter_(config_.get<bool>(
+          "sm.query.tile_major_unfilter", Config::must_find))
+    , stage_incomplete_tiles_(config_.get<bool>(
+          "sm.query.stage_incomplete_tiles", Config::must_find))
     , aggregate_buffers_(params.aggregate_buffers()) {
   if (params.array() != nullptr)
     fragment_metadata_ = params.array()->fragment_metadata();
   timestamps_needed_for_deletes_and_updates_.resize(fragment_metadata_.size());
 
+  // Pin the fragment metadata for the duration of the query: readers access
+  // loaded metadata lock-free, so it must never be evicted under memory
+  // pressure while this query may touch it.
+  for (auto& fragment : fragment_metadata_) {
+    fragment->loaded_metadata()->pin();
+  }
+
   if (layout_ == Layout::GLOBAL_ORDER && subarray_.range_num() > 1) {
     throw ReaderBaseStatusException(
         "Cannot initialize reader; Multi-range reads are not supported on a "
         "global order query.");
   }
 
+  // Let the user condition adapt its evaluation order, if enabled.
+  if (condition_.has_value()) {
+    condition_->set_adaptive_order(config_.get<bool>(
+        "sm.query.condition.adaptive_order", Config::must_find));
+  }
+
   // Validate the aggregates and store the requested aggregates by field name.
   for (auto& aggregate : params.default_channel_aggregates()) {
     aggregate.second->validate_output_buffer(
@@ -101,6 +131,12 @@ ReaderBase::ReaderBase(
   }
 }
 
+ReaderBase::~ReaderBase() {
+  for (auto& fragment : fragment_metadata_) {
+    fragment->loaded_metadata()->unpin();
+  }
+}
+
 /* ****************************** */
 /*         PUBLIC METHODS         */
 /* ****************************** */
@@ -141,6 +177,36 @@ bool ReaderBase::skip_field(
   return false;
 }
 
+bool ReaderBase::can_stream_var_tile(
+    const std::string& name,
+    const unsigned frag_idx,
+    const uint64_t tile_idx) const {
+  if (streamed_var_read_min_tile_size_ == 0 ||
+      !array_schema_.var_size(name) || !array_schema_.filters(name).empty()) {
+    return false;
+  }
+
+  auto& fragment = fragment_metadata_[frag_idx];
+  if (!fragment->array_schema()->is_field(name)) {
+    return false;
+  }
+
+  const auto tile_var_size =
+      fragment->loaded_metadata()->tile_var_size(name, tile_idx);
+  if (tile_var_size < streamed_var_read_min_tile_size_) {
+    return false;
+  }
+
+  // With an empty filter pipeline and no encryption, a single-chunk var
+  // tile stores the cell data verbatim right after the chunk prologue, so
+  // the byte ranges of individual cells can be read directly. This is
+  // validated structurally: the filter pipeline adds exactly the prologue
+  // bytes to the tile in that case and strictly more in any other.
+  const auto persisted_size =
+      fragment->loaded_metadata()->persisted_tile_var_size(name, tile_idx);
+  return persisted_size == tile_var_size + single_chunk_prologue_size;
+}
+
 /* ****************************** */
 /*        PROTECTED METHODS       */
 /* ****************************** */
@@ -512,7 +578,15 @@ Status ReaderBase::read_and_unfilter_attribute_tiles(
   // eventually get rid of it altogether so that we can clarify the data flow.
   // At the end of this function call, all memory inside of 'filtered_data' has
   // been used and the tiles are unfiltered so the data can be deleted.
+  if (pipelined_unfilter_) {
+    return read_and_unfilter_tiles_pipelined(names, result_tiles);
+  }
+
   auto filtered_data{read_attribute_tiles(names, result_tiles)};
+  if (tile_major_unfilter_ && names.size() > 1) {
+    return unfilter_tiles_tile_major(names, result_tiles);
+  }
+
   for (auto& name : names) {
     RETURN_NOT_OK(
         unfilter_tiles(name.name(), name.validity_only(), result_tiles));
@@ -526,7 +600,17 @@ Status ReaderBase::read_and_unfilter_coordinate_tiles(
     const std::vector<ResultTile*>& result_tiles) const {
   // See the comment in 'read_and_unfilter_attribute_tiles' to get more
   // information about the lifetime of this object.
+  if (pipelined_unfilter_) {
+    return read_and_unfilter_tiles_pipelined(
+        NameToLoad::from_string_vec(names), result_tiles);
+  }
+
   auto filtered_data{read_coordinate_tiles(names, result_tiles)};
+  if (tile_major_unfilter_ && names.size() > 1) {
+    return unfilter_tiles_tile_major(
+        NameToLoad::from_string_vec(names), result_tiles);
+  }
+
   for (auto& name : names) {
     RETURN_NOT_OK(unfilter_tiles(name, false, result_tiles));
   }
@@ -548,9 +632,102 @@ std::list<FilteredData> ReaderBase::read_coordinate_tiles(
   return read_tiles(NameToLoad::from_string_vec(names), result_tiles);
 }
 
+Status ReaderBase::read_and_unfilter_tiles_pipelined(
+    const std::vector<NameToLoad>& names,
+    const std::vector<ResultTile*>& result_tiles) const {
+  auto timer_se = stats_->start_timer("read_and_unfilter_tiles_pipelined");
+
+  if (result_tiles.empty() || names.empty()) {
+    return Status::Ok();
+  }
+
+  // Issue the reads for every field up front, keeping the read tasks of each
+  // field separate so that unfiltering can start as soon as the relevant
+  // bytes have landed.
+  std::list<FilteredData> filtered_data;
+  std::vector<std::vector<ThreadPool::Task>> read_tasks(names.size());
+  for (uint64_t n = 0; n < names.size(); n++) {
+    filtered_data.splice(
+        filtered_data.end(),
+        read_tiles({names[n]}, result_tiles, read_tasks[n]));
+  }
+
+  // Unfilter the tiles of each field per fragment, as soon as the reads for
+  // that fragment have completed. Data blocks never span fragments, so the
+  // read tasks of two groups never intersect and each read task is waited on
+  // exactly once. The waits run on the compute pool, which executes pending
+  // tasks while waiting, so worker threads unfilter tiles already in memory
+  // instead of parking on reads still in flight.
+  std::vector<ThreadPool::Task> unfilter_tasks;
+  auto data_it = filtered_data.begin();
+  for (uint64_t n = 0; n < names.size(); n++, data_it++) {
+    // Group the result tiles of this field by fragment, along with the read
+    // tasks of the fragment's data blocks. The result tiles are sorted by
+    // fragment, so each fragment forms a single contiguous group.
+    std::vector<std::vector<ResultTile*>> tile_groups;
+    std::vector<std::vector<ThreadPool::Task>> task_groups;
+    const auto& tasks_by_fragment = data_it->tasks_by_fragment();
+    for (auto rt : result_tiles) {
+      if (tile_groups.empty() ||
+          tile_groups.back().back()->frag_idx() != rt->frag_idx()) {
+        tile_groups.emplace_back();
+        auto& tasks = task_groups.emplace_back();
+        auto indexes = tasks_by_fragment.find(rt->frag_idx());
+        if (indexes != tasks_by_fragment.end()) {
+          for (auto idx : indexes->second) {
+            tasks.emplace_back(std::move(read_tasks[n][idx]));
+          }
+        }
+      }
+
+      tile_groups.back().emplace_back(rt);
+    }
+
+    for (uint64_t g = 0; g < tile_groups.size(); g++) {
+      unfilter_tasks.emplace_back(resources_.compute_tp().execute(
+          [this,
+           &names,
+           n,
+           tiles = std::move(tile_groups[g]),
+           tasks = std::move(task_groups[g])]() mutable {
+            auto statuses{resources_.io_tp().wait_all_status(tasks)};
+            for (const auto& st : statuses) {
+              RETURN_NOT_OK(st);
+            }
+
+            return unfilter_tiles(
+                names[n].name(), names[n].validity_only(), tiles);
+          }));
+    }
+  }
+
+  auto statuses{resources_.compute_tp().wait_all_status(unfilter_tasks)};
+  for (const auto& st : statuses) {
+    RETURN_NOT_OK(st);
+  }
+
+  return Status::Ok();
+}
+
 std::list<FilteredData> ReaderBase::read_tiles(
     const std::vector<NameToLoad>& names,
     const std::vector<ResultTile*>& result_tiles) const {
+  std::vector<ThreadPool::Task> read_tasks;
+  auto filtered_data{read_tiles(names, result_tiles, read_tasks)};
+
+  // Wait for the read tasks to finish.
+  auto statuses{resources_.io_tp().wait_all_status(read_tasks)};
+  for (const auto& st : statuses) {
+    throw_if_not_ok(st);
+  }
+
+  return filtered_data;
+}
+
+std::list<FilteredData> ReaderBase::read_tiles(
+    const std::vector<NameToLoad>& names,
+    const std::vector<ResultTile*>& result_tiles,
+    std::vector<ThreadPool::Task>& read_tasks) const {
   auto timer_se = stats_->start_timer("read_tiles");
   std::list<FilteredData> filtered_data;
 
@@ -560,18 +737,50 @@ std::list<FilteredData> ReaderBase::read_tiles(
   }
 
   uint64_t num_tiles_read{0};
-  std::vector<ThreadPool::Task> read_tasks;
 
   // Run all attributes independently.
   for (auto n : names) {
     auto& name = n.name();
     auto val_only = n.validity_only();
+    auto stream_var = n.stream_var();
+
+    // Probe the tile cache so that tiles unfiltered by an earlier query are
+    // excluded from the read batches below.
+    const bool var_sized{array_schema_.var_size(name)};
+    const bool nullable{array_schema_.is_nullable(name)};
+    auto cached_tiles{probe_tile_cache(n, result_tiles)};
+
+    // Coordinate tiles where the dimension is constant across all cells are
+    // synthesized from the fragment MBRs instead of being read: the MBR
+    // starts and ends on the same value, so every cell holds that value.
+    // Inserting them into the cached tile map excludes them from the read
+    // batches below. The constant value is copied out here as the R-tree
+    // may be evicted before the tiles are filled.
+    std::unordered_map<const ResultTile*, std::vector<uint8_t>>
+        constant_tiles;
+    if (array_schema_.is_dim(name) && !var_sized && !val_only) {
+      const auto cell_size{array_schema_.cell_size(name)};
+      for (auto tile : result_tiles) {
+        if (skip_field(tile->frag_idx(), name) ||
+            cached_tiles.count(tile) != 0) {
+          continue;
+        }
+
+        const auto& fragment{fragment_metadata_[tile->frag_idx()]};
+        const auto value{
+            fragment->tile_constant_value(name, tile->tile_idx())};
+        if (value != nullptr) {
+          const auto bytes{static_cast<const uint8_t*>(value)};
+          constant_tiles.emplace(
+              tile, std::vector<uint8_t>(bytes, bytes + cell_size));
+          cached_tiles.emplace(tile, CachedTileData{});
+        }
+      }
+    }
 
     // Create the filtered data blocks. This will also kick off the read for the
     // data blocks right after the memory is allocated so that we can optimize
     // read and memory allocations.
-    const bool var_sized{array_schema_.var_size(name)};
-    const bool nullable{array_schema_.is_nullable(name)};
     filtered_data.emplace_back(
         resources_,
         *this,
@@ -584,6 +793,8 @@ std::list<FilteredData> ReaderBase::read_tiles(
         var_sized,
         nullable,
         val_only,
+        stream_var,
+        cached_tiles,
         read_tasks,
         memory_tracker_);
 
@@ -596,12 +807,37 @@ std::list<FilteredData> ReaderBase::read_tiles(
         continue;
       }
 
-      num_tiles_read++;
+      const auto cached_tile{cached_tiles.find(tile)};
+      const bool cached{cached_tile != cached_tiles.end()};
+      if (!cached) {
+        num_tiles_read++;
+      }
+
+      const auto constant_value{constant_tiles.find(tile)};
+      const bool synthesized{constant_value != constant_tiles.end()};
+
       const auto tile_idx{tile->tile_idx()};
 
-      // Construct a TileSizes class.
-      ResultTile::TileSizes tile_sizes{
-          fragment, name, var_sized, nullable, val_only, tile_idx};
+      // Streamed var tiles are excluded from the var data blocks above and
+      // filled by targeted range reads once the offsets are unfiltered.
+      const bool stream_var_tile{
+          stream_var && !val_only && !cached &&
+          can_stream_var_tile(name, tile->frag_idx(), tile_idx)};
+
+      // Construct a TileSizes class. Synthesized tiles have no persisted
+      // data; the zero persisted size leaves the filtered buffer empty so
+      // that unfiltering skips them.
+      ResultTile::TileSizes tile_sizes =
+          synthesized ?
+              ResultTile::TileSizes(
+                  fragment->tile_size(name, tile_idx),
+                  0,
+                  std::nullopt,
+                  std::nullopt,
+                  std::nullopt,
+                  std::nullopt) :
+              ResultTile::TileSizes(
+                  fragment, name, var_sized, nullable, val_only, tile_idx);
 
       // Construct a tile data class.
       // See the explanation in 'read_and_unfilter_attribute_tiles' for more
@@ -611,15 +847,30 @@ std::list<FilteredData> ReaderBase::read_tiles(
       // the 'ResultTile' object to access the data. Eventually, these
       // 'TileData' objects should be returned by this function and passed into
       // 'unfilter_tiles' so that the filter pipeline can stop using the
-      // 'ResultTile' object to get access to the filtered data.
-      ResultTile::TileData tile_data{
-          val_only ?
-              nullptr :
-              filtered_data.back().fixed_filtered_data(fragment.get(), tile),
-          val_only ?
-              nullptr :
-              filtered_data.back().var_filtered_data(fragment.get(), tile),
-          filtered_data.back().nullable_filtered_data(fragment.get(), tile)};
+      // 'ResultTile' object to get access to the filtered data. Tiles served
+      // from the tile cache have no filtered data to point to.
+      ResultTile::TileData tile_data =
+          cached ?
+              ResultTile::TileData{nullptr, nullptr, nullptr} :
+              ResultTile::TileData{
+                  val_only ? nullptr :
+                             filtered_data.back().fixed_filtered_data(
+                                 fragment.get(), tile),
+                  val_only || stream_var_tile ?
+                      nullptr :
+                      filtered_data.back().var_filtered_data(
+                          fragment.get(), tile),
+                  filtered_data.back().nullable_filtered_data(
+                      fragment.get(), tile),
+                  val_only ?
+                      nullptr :
+                      filtered_data.back().fixed_data_owner(
+                          fragment.get(), tile),
+                  val_only || stream_var_tile ?
+                      nullptr :
+                      filtered_data.back().var_data_owner(fragment.get(), tile),
+                  filtered_data.back().nullable_data_owner(
+                      fragment.get(), tile)};
 
       // Initialize the tile(s)
       const format_version_t format_version{fragment->format_version()};
@@ -637,18 +888,337 @@ std::list<FilteredData> ReaderBase::read_tiles(
         tile->init_attr_tile(
             format_version, array_schema_, name, tile_sizes, tile_data);
       }
+
+      if (stream_var_tile) {
+        tile->tile_tuple(name)->var_tile().set_streamed();
+      }
+
+      // Fill synthesized tiles by repeating the constant value. Their
+      // filtered buffers are empty, so unfiltering skips them like cache
+      // hits.
+      if (synthesized) {
+        stats_->add_counter("constant_tiles_synthesized", 1);
+        auto& t{tile->tile_tuple(name)->fixed_tile()};
+        const auto& value{constant_value->second};
+        for (uint64_t offset = 0; offset < t.size(); offset += value.size()) {
+          t.write(value.data(), offset, value.size());
+        }
+        continue;
+      }
+
+      // Serve the tile data from the cached buffers, which also clears the
+      // filtered buffers so that unfiltering skips the tile.
+      if (cached) {
+        stats_->add_counter("tiles_cache_hit", 1);
+        auto tile_tuple = tile->tile_tuple(name);
+        tile_tuple->fixed_tile().use_cached_data(cached_tile->second.fixed_);
+        if (var_sized) {
+          tile_tuple->var_tile().use_cached_data(cached_tile->second.var_);
+        }
+        if (nullable) {
+          tile_tuple->validity_tile().use_cached_data(
+              cached_tile->second.validity_);
+        }
+      }
     }
   }
 
   stats_->add_counter("num_tiles_read", num_tiles_read);
 
-  // Wait for the read tasks to finish.
-  auto statuses{resources_.io_tp().wait_all_status(read_tasks)};
-  for (const auto& st : statuses) {
-    throw_if_not_ok(st);
+  return filtered_data;
+}
+
+std::string ReaderBase::tile_cache_key(
+    const unsigned frag_idx,
+    const uint64_t tile_idx,
+    const std::string& name) const {
+  return fragment_metadata_[frag_idx]->fragment_uri().to_string() + "/" +
+         std::to_string(tile_idx) + "/" + name;
+}
+
+std::unordered_map<const ResultTile*, CachedTileData>
+ReaderBase::probe_tile_cache(
+    const NameToLoad& name_to_load,
+    const std::vector<ResultTile*>& result_tiles) const {
+  std::unordered_map<const ResultTile*, CachedTileData> cached_tiles;
+
+  // Validity only loads process the fixed tile partially so they cannot be
+  // served from the cache.
+  auto& tile_cache = resources_.tile_cache();
+  if ((!tile_cache.enabled() && staged_unfiltered_tiles_.empty()) ||
+      name_to_load.validity_only()) {
+    return cached_tiles;
   }
 
-  return filtered_data;
+  auto& name = name_to_load.name();
+  const bool var_sized{array_schema_.var_size(name)};
+  const bool nullable{array_schema_.is_nullable(name)};
+  for (auto tile : result_tiles) {
+    if (skip_field(tile->frag_idx(), name)) {
+      continue;
+    }
+
+    auto key{tile_cache_key(tile->frag_idx(), tile->tile_idx(), name)};
+
+    // Serve staged entries first: they hold the payloads this query
+    // unfiltered for the tile before dropping it on a full user buffer.
+    // Entries are consumed as the tile data becomes resident again.
+    CachedTileData entry;
+    auto staged = staged_unfiltered_tiles_.find(key);
+    if (staged != staged_unfiltered_tiles_.end()) {
+      entry = std::move(staged->second);
+      staged_unfiltered_tiles_.erase(staged);
+      stats_->add_counter("tiles_staging_hit", 1);
+    } else if (tile_cache.enabled()) {
+      entry = tile_cache.lookup(key);
+    }
+
+    if (entry.fixed_ == nullptr) {
+      continue;
+    }
+
+    // Only serve entries that match the sizes computed from the fragment
+    // metadata, for all the components this field needs.
+    auto const fragment{fragment_metadata_[tile->frag_idx()]};
+    ResultTile::TileSizes tile_sizes{
+        fragment, name, var_sized, nullable, false, tile->tile_idx()};
+    if (entry.fixed_size_ != tile_sizes.tile_size()) {
+      continue;
+    }
+
+    if (var_sized && (entry.var_ == nullptr ||
+                      entry.var_size_ != tile_sizes.tile_var_size())) {
+      continue;
+    }
+
+    if (nullable && (entry.validity_ == nullptr ||
+                     entry.validity_size_ != tile_sizes.tile_validity_size())) {
+      continue;
+    }
+
+    cached_tiles.emplace(tile, std::move(entry));
+  }
+
+  return cached_tiles;
+}
+
+void ReaderBase::cache_unfiltered_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable) const {
+  if (skip_field(tile->frag_idx(), name)) {
+    return;
+  }
+
+  auto tile_tuple = tile->tile_tuple(name);
+  if (tile_tuple == nullptr) {
+    return;
+  }
+
+  // Only cache tiles unfiltered into their own allocation. Tiles aliasing
+  // external memory are either cache hits or zero-copy tiles that skipped
+  // the filter pipeline entirely.
+  auto& t = tile_tuple->fixed_tile();
+  if (t.filtered() || t.has_data_alias() || t.data() == nullptr) {
+    return;
+  }
+
+  auto& tile_cache = resources_.tile_cache();
+  auto key{tile_cache_key(tile->frag_idx(), tile->tile_idx(), name)};
+  if (tile_cache.contains(key)) {
+    return;
+  }
+
+  const void* var_data = nullptr;
+  uint64_t var_tile_size = 0;
+  if (var_size) {
+    auto& t_var = tile_tuple->var_tile();
+
+    // Streamed var tiles only hold the data of the selected cells.
+    if (t_var.has_data_alias() || t_var.streamed()) {
+      return;
+    }
+
+    var_data = t_var.data();
+    var_tile_size = t_var.size();
+  }
+
+  const void* validity_data = nullptr;
+  uint64_t validity_size = 0;
+  if (nullable) {
+    auto& t_validity = tile_tuple->validity_tile();
+    if (t_validity.has_data_alias()) {
+      return;
+    }
+
+    validity_data = t_validity.data();
+    validity_size = t_validity.size();
+  }
+
+  stats_->add_counter("tiles_cached", 1);
+  tile_cache.insert(
+      key,
+      t.data(),
+      t.size(),
+      var_data,
+      var_tile_size,
+      validity_data,
+      validity_size);
+}
+
+void ReaderBase::stage_unfiltered_tiles(
+    const std::string& name,
+    const std::vector<ResultTile*>& result_tiles,
+    const uint64_t min_result_tile) const {
+  const bool var_size{array_schema_.var_size(name)};
+  const bool nullable{array_schema_.is_nullable(name)};
+  for (uint64_t i = min_result_tile; i < result_tiles.size(); i++) {
+    stage_unfiltered_tile(name, result_tiles[i], var_size, nullable);
+  }
+}
+
+void ReaderBase::stage_unfiltered_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable) const {
+  if (skip_field(tile->frag_idx(), name)) {
+    return;
+  }
+
+  auto tile_tuple = tile->tile_tuple(name);
+  if (tile_tuple == nullptr) {
+    return;
+  }
+
+  // Same restrictions as the tile cache: only tiles unfiltered into their
+  // own allocation hold a complete payload.
+  auto& t = tile_tuple->fixed_tile();
+  if (t.filtered() || t.has_data_alias() || t.data() == nullptr) {
+    return;
+  }
+
+  auto key{tile_cache_key(tile->frag_idx(), tile->tile_idx(), name)};
+  if (staged_unfiltered_tiles_.count(key) != 0) {
+    return;
+  }
+
+  const void* var_data = nullptr;
+  uint64_t var_tile_size = 0;
+  if (var_size) {
+    auto& t_var = tile_tuple->var_tile();
+
+    // Streamed var tiles only hold the data of the selected cells.
+    if (t_var.has_data_alias() || t_var.streamed()) {
+      return;
+    }
+
+    var_data = t_var.data();
+    var_tile_size = t_var.size();
+  }
+
+  const void* validity_data = nullptr;
+  uint64_t validity_size = 0;
+  if (nullable) {
+    auto& t_validity = tile_tuple->validity_tile();
+    if (t_validity.has_data_alias()) {
+      return;
+    }
+
+    validity_data = t_validity.data();
+    validity_size = t_validity.size();
+  }
+
+  CachedTileData entry;
+  entry.fixed_ = copy_into_staging(t.data(), t.size());
+  entry.fixed_size_ = t.size();
+  if (var_data != nullptr) {
+    entry.var_ = copy_into_staging(var_data, var_tile_size);
+    entry.var_size_ = var_tile_size;
+  }
+
+  if (validity_data != nullptr) {
+    entry.validity_ = copy_into_staging(validity_data, validity_size);
+    entry.validity_size_ = validity_size;
+  }
+
+  stats_->add_counter("tiles_staged", 1);
+  staged_unfiltered_tiles_.emplace(std::move(key), std::move(entry));
+}
+
+std::shared_ptr<std::byte> ReaderBase::copy_into_staging(
+    const void* data, uint64_t size) const {
+  auto resource = memory_tracker_->get_resource(MemoryType::TILE_DATA);
+  auto copy = static_cast<std::byte*>(resource->allocate(size));
+  memcpy(copy, data, size);
+
+  // The deleter keeps the memory tracker alive so that entries can outlive
+  // the reader while the tile data still references them.
+  auto memory_tracker = memory_tracker_;
+  return std::shared_ptr<std::byte>(copy, [memory_tracker, size](std::byte* p) {
+    memory_tracker->get_resource(MemoryType::TILE_DATA)->deallocate(p, size);
+  });
+}
+
+void ReaderBase::read_streamed_var_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const std::vector<std::pair<uint64_t, uint64_t>>& cell_ranges,
+    std::vector<ThreadPool::Task>& read_tasks) const {
+  auto tile_tuple = tile->tile_tuple(name);
+  auto& t_var = tile_tuple->var_tile();
+  assert(t_var.streamed());
+
+  // Compute the byte ranges to read from the cell ranges, using the
+  // unfiltered offsets tile. The extra offset added in post-processing
+  // makes the size of the last cell computable like any other. Byte ranges
+  // closer than the minimum batch gap are merged into a single read.
+  auto offsets = tile_tuple->fixed_tile().data_as<uint64_t>();
+  std::vector<std::pair<uint64_t, uint64_t>> byte_ranges;
+  for (auto& [start_cell, end_cell] : cell_ranges) {
+    const uint64_t start = offsets[start_cell];
+    const uint64_t end = offsets[end_cell];
+    if (end == start) {
+      continue;
+    }
+
+    if (!byte_ranges.empty() && start <= byte_ranges.back().first +
+                                             byte_ranges.back().second +
+                                             min_batch_gap_) {
+      byte_ranges.back().second = end - byte_ranges.back().first;
+    } else {
+      byte_ranges.emplace_back(start, end - start);
+    }
+  }
+
+  // Queue the reads, straight into the var tile data. The cell data starts
+  // right after the chunk prologue of the on-disk tile.
+  auto& fragment = fragment_metadata_[tile->frag_idx()];
+  const auto tile_offset =
+      fragment->loaded_metadata()->file_var_offset(name, tile->tile_idx()) +
+      single_chunk_prologue_size;
+  const URI uri = fragment->var_uri(name);
+  auto dest = t_var.data_as<char>();
+  uint64_t bytes_read = 0;
+  for (auto& [offset, size] : byte_ranges) {
+    bytes_read += size;
+    read_tasks.emplace_back(resources_.io_tp().execute(
+        [this, uri, tile_offset, offset, size, dest]() {
+          return resources_.vfs().read(
+              uri,
+              tile_offset + offset,
+              dest + offset,
+              size,
+              false,
+              &cancellation_source_);
+        }));
+  }
+
+  stats_->add_counter("var_tiles_streamed", 1);
+  stats_->add_counter("var_tiles_streamed_bytes_read", bytes_read);
+  stats_->add_counter(
+      "var_tiles_streamed_bytes_skipped", t_var.size() - bytes_read);
 }
 
 tuple<Status, optional<uint64_t>, optional<uint64_t>, optional<uint64_t>>
@@ -694,7 +1264,9 @@ ReaderBase::load_tile_chunk_data(
       }
     }
 
-    if (var_size) {
+    // Streamed var tiles are filled by targeted range reads and skip the
+    // filter pipeline.
+    if (var_size && !t_var->streamed()) {
       unfiltered_tile_var_size = t_var->load_chunk_data(tile_chunk_var_data);
     }
   }
@@ -857,6 +1429,100 @@ Status ReaderBase::unfilter_tiles(
         name, validity_only, result_tiles[i], var_size, nullable));
   }
 
+  // Cache the unfiltered, post-processed tiles for future queries. Tiles of
+  // a point read are only unfiltered for the chunk holding the cell, so they
+  // must not be cached.
+  if (!validity_only && !point_cell_pos_.has_value() &&
+      resources_.tile_cache().enabled()) {
+    for (size_t i = 0; i < num_tiles; i++) {
+      cache_unfiltered_tile(name, result_tiles[i], var_size, nullable);
+    }
+  }
+
+  return Status::Ok();
+}
+
+Status ReaderBase::unfilter_tiles_tile_major(
+    const std::vector<NameToLoad>& names,
+    const std::vector<ResultTile*>& result_tiles) const {
+  const auto timer_se = stats_->start_timer("unfilter_tiles_tile_major");
+  auto num_tiles = static_cast<uint64_t>(result_tiles.size());
+  if (num_tiles == 0 || names.empty()) {
+    return Status::Ok();
+  }
+
+  // Per-field schema properties.
+  std::vector<bool> var_size(names.size());
+  std::vector<bool> nullable(names.size());
+  for (uint64_t n = 0; n < names.size(); n++) {
+    var_size[n] = array_schema_.var_size(names[n].name());
+    nullable[n] = array_schema_.is_nullable(names[n].name());
+  }
+
+  // Walk the tiles in (fragment, tile index) order so that neighboring
+  // tasks touch neighboring filtered data, and unfilter all fields of one
+  // tile on the same worker so that its working set stays cache resident
+  // until every field of the tile has been unfiltered.
+  std::vector<ResultTile*> tiles(result_tiles);
+  std::sort(
+      tiles.begin(), tiles.end(), [](const ResultTile* a, const ResultTile* b) {
+        return a->frag_idx() != b->frag_idx() ? a->frag_idx() < b->frag_idx() :
+                                                a->tile_idx() < b->tile_idx();
+      });
+
+  auto status = parallel_for(
+      &resources_.compute_tp(), 0, num_tiles, [&, this](uint64_t i) {
+        for (uint64_t n = 0; n < names.size(); n++) {
+          ChunkData chunk_data, chunk_var_data, chunk_validity_data;
+          auto&& [st, tile_size, tile_var_size, tile_validity_size] =
+              load_tile_chunk_data(
+                  names[n].name(),
+                  names[n].validity_only(),
+                  tiles[i],
+                  var_size[n],
+                  nullable[n],
+                  chunk_data,
+                  chunk_var_data,
+                  chunk_validity_data);
+          RETURN_NOT_OK(st);
+          (void)tile_size;
+          (void)tile_var_size;
+          (void)tile_validity_size;
+          RETURN_NOT_OK(unfilter_tile(
+              names[n].name(),
+              names[n].validity_only(),
+              tiles[i],
+              var_size[n],
+              nullable[n],
+              0,
+              1,
+              chunk_data,
+              chunk_var_data,
+              chunk_validity_data));
+          RETURN_NOT_OK(post_process_unfiltered_tile(
+              names[n].name(),
+              names[n].validity_only(),
+              tiles[i],
+              var_size[n],
+              nullable[n]));
+        }
+        return Status::Ok();
+      });
+  RETURN_CANCEL_OR_ERROR(status);
+
+  // Cache the unfiltered, post-processed tiles for future queries, under the
+  // same conditions as `unfilter_tiles`.
+  if (!point_cell_pos_.has_value() && resources_.tile_cache().enabled()) {
+    for (uint64_t n = 0; n < names.size(); n++) {
+      if (names[n].validity_only()) {
+        continue;
+      }
+      for (auto tile : tiles) {
+        cache_unfiltered_tile(names[n].name(), tile, var_size[n], nullable[n]);
+      }
+    }
+  }
+
   return Status::Ok();
 }
 
@@ -924,6 +1590,31 @@ Status ReaderBase::unfilter_tile(
 
   auto concurrency_level = resources_.compute_tp().concurrency_level();
 
+  // With an empty filter pipeline, the filtered bytes of a single-chunk tile
+  // are exactly its unfiltered bytes, so the tile can alias the read buffer
+  // directly instead of copying out of it. Zipped coordinate tiles are
+  // excluded as they are rearranged in place after unfiltering.
+  auto try_zero_copy = [&](const FilterPipeline& filters,
+                           Tile* tile_to_unfilter,
+                           const ChunkData& chunk_data) -> bool {
+    if (!zero_copy_unfiltered_tiles_ || !filters.empty() ||
+        chunk_data.filtered_chunks_.size() != 1 ||
+        tile_to_unfilter->stores_coords() ||
+        !tile_to_unfilter->has_filtered_data_owner()) {
+      return false;
+    }
+
+    const auto& chunk = chunk_data.filtered_chunks_[0];
+    if (chunk.filtered_metadata_size_ != 0 ||
+        chunk.unfiltered_data_size_ != tile_to_unfilter->size()) {
+      return false;
+    }
+
+    stats_->add_counter("tiles_zero_copy", 1);
+    tile_to_unfilter->use_filtered_data_view(chunk.filtered_data_);
+    return true;
+  };
+
   if (!validity_only) {
     // Unfiltered fixed data
     if (!skip_offsets_filtering &&
@@ -932,36 +1623,53 @@ Status ReaderBase::unfilter_tile(
       auto&& [t_min, t_max] = compute_chunk_min_max(
           tile_chunk_fixed_data.chunk_offsets_.size(), num_threads, thread_idx);
 
+      // Point-read fast path: only decompress the chunk holding the cell.
+      if (point_cell_pos_.has_value() && !var_size) {
+        std::tie(t_min, t_max) = point_chunk_range(
+            tile_chunk_fixed_data,
+            *point_cell_pos_,
+            t->cell_size(),
+            t_min,
+            t_max);
+      }
+
       // Reverse the tile filters.
       stats_->add_counter("tiles_unfiltered", 1);
-      RETURN_NOT_OK(fixed_filters.run_reverse(
-          stats_,
-          t,
-          nullptr,
-          tile_chunk_fixed_data,
-          t_min,
-          t_max,
-          concurrency_level,
-          resources_.config()));
+      if (!try_zero_copy(fixed_filters, t, tile_chunk_fixed_data)) {
+        RETURN_NOT_OK(fixed_filters.run_reverse(
+            stats_,
+            t,
+            nullptr,
+            tile_chunk_fixed_data,
+            t_min,
+            t_max,
+            concurrency_level,
+            resources_.config(),
+            &cancellation_source_));
+      }
     }
 
     // Prevent processing past the end of chunks in case there are more
-    // threads than chunks.
-    if (var_size &&
+    // threads than chunks. Streamed var tiles skip the filter pipeline.
+    if (var_size && !t_var->streamed() &&
         thread_idx <= tile_chunk_var_data.filtered_chunks_.size() - 1) {
       auto&& [tvar_min, tvar_max] = compute_chunk_min_max(
           tile_chunk_var_data.chunk_offsets_.size(), num_threads, thread_idx);
       // Reverse the filters of tile var data
       stats_->add_counter("tiles_unfiltered", 1);
-      RETURN_NOT_OK(var_filters.run_reverse(
-          stats_,
-          t_var,
-          skip_offsets_filtering ? t : nullptr,
-          tile_chunk_var_data,
-          tvar_min,
-          tvar_max,
-          concurrency_level,
-          resources_.config()));
+      if (skip_offsets_filtering ||
+          !try_zero_copy(var_filters, t_var, tile_chunk_var_data)) {
+        RETURN_NOT_OK(var_filters.run_reverse(
+            stats_,
+            t_var,
+            skip_offsets_filtering ? t : nullptr,
+            tile_chunk_var_data,
+            tvar_min,
+            tvar_max,
+            concurrency_level,
+            resources_.config(),
+            &cancellation_source_));
+      }
     }
   }
 
@@ -975,17 +1683,31 @@ Status ReaderBase::unfilter_tile(
         num_threads,
         thread_idx);
 
+    // Point-read fast path: only decompress the chunk holding the cell.
+    if (point_cell_pos_.has_value()) {
+      std::tie(tval_min, tval_max) = point_chunk_range(
+          tile_chunk_validity_data,
+          *point_cell_pos_,
+          t_validity->cell_size(),
+          tval_min,
+          tval_max);
+    }
+
     // Reverse the tile validity filters.
     stats_->add_counter("tiles_unfiltered", 1);
-    RETURN_NOT_OK(validity_filters.run_reverse(
-        stats_,
-        t_validity,
-        nullptr,
-        tile_chunk_validity_data,
-        tval_min,
-        tval_max,
-        concurrency_level,
-        resources_.config()));
+    if (!try_zero_copy(
+            validity_filters, t_validity, tile_chunk_validity_data)) {
+      RETURN_NOT_OK(validity_filters.run_reverse(
+          stats_,
+          t_validity,
+          nullptr,
+          tile_chunk_validity_data,
+          tval_min,
+          tval_max,
+          concurrency_level,
+          resources_.config(),
+          &cancellation_source_));
+    }
   }
 
   return Status::Ok();
@@ -1043,6 +1765,64 @@ uint64_t ReaderBase::get_attribute_persisted_tile_size(
   return tile_size;
 }
 
+ReaderBase::ResolvedField ReaderBase::resolve_field(
+    const std::string& name) const {
+  ResolvedField field;
+  field.name = name;
+  field.var_sized = array_schema_.var_size(name);
+  field.nullable = array_schema_.is_nullable(name);
+  field.cell_size = field.var_sized ? 0 : array_schema_.cell_size(name);
+  field.present.reserve(fragment_metadata_.size());
+  for (auto& frag_md : fragment_metadata_) {
+    field.present.emplace_back(frag_md->array_schema()->is_field(name));
+  }
+  return field;
+}
+
+uint64_t ReaderBase::get_attribute_tile_size(
+    const ResolvedField& field, unsigned f, uint64_t t) const {
+  uint64_t tile_size = 0;
+  if (!field.present[f]) {
+    return tile_size;
+  }
+
+  const auto cell_num = fragment_metadata_[f]->cell_num(t);
+  if (field.var_sized) {
+    tile_size += (cell_num + 1) * constants::cell_var_offset_size;
+    tile_size +=
+        fragment_metadata_[f]->loaded_metadata()->tile_var_size(field.name, t);
+  } else {
+    tile_size += cell_num * field.cell_size;
+  }
+
+  if (field.nullable) {
+    tile_size += cell_num * constants::cell_validity_size;
+  }
+
+  return tile_size;
+}
+
+uint64_t ReaderBase::get_attribute_persisted_tile_size(
+    const ResolvedField& field, unsigned f, uint64_t t) const {
+  uint64_t tile_size = 0;
+  if (!field.present[f]) {
+    return tile_size;
+  }
+
+  auto& loaded_metadata = *fragment_metadata_[f]->loaded_metadata();
+  tile_size += loaded_metadata.persisted_tile_size(field.name, t);
+
+  if (field.var_sized) {
+    tile_size += loaded_metadata.persisted_tile_var_size(field.name, t);
+  }
+
+  if (field.nullable) {
+    tile_size += loaded_metadata.persisted_tile_validity_size(field.name, t);
+  }
+
+  return tile_size;
+}
+
 template <class T>
 std::pair<TileDomain<T>, std::vector<TileDomain<T>>>
 ReaderBase::compute_tile_domains(const Subarray& partitioner_subarray) const {
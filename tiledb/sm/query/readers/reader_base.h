@@ -39,6 +39,7 @@
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/tile_domain.h"
+#include "tiledb/sm/cache/tile_cache.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -86,9 +87,11 @@ class ReaderBase : public StrategyBase {
     /* ********************************* */
 
     /** Constructor. */
-    NameToLoad(std::string name, bool validity_only = false)
+    NameToLoad(
+        std::string name, bool validity_only = false, bool stream_var = false)
         : name_(name)
-        , validity_only_(validity_only) {
+        , validity_only_(validity_only)
+        , stream_var_(stream_var) {
     }
 
     /* ********************************* */
@@ -105,6 +108,16 @@ class ReaderBase : public StrategyBase {
       return validity_only_;
     }
 
+    /**
+     * @returns if eligible var tiles of the field should be loaded with
+     * targeted range reads of the selected cells instead of reading the
+     * whole var tile. The caller is responsible for issuing the range
+     * reads once the offsets tiles are unfiltered.
+     */
+    bool stream_var() const {
+      return stream_var_;
+    }
+
    private:
     /* ********************************* */
     /*        PRIVATE ATTRIBUTES         */
@@ -115,6 +128,31 @@ class ReaderBase : public StrategyBase {
 
     /** Load validity only for the field. */
     const bool validity_only_;
+
+    /** Load eligible var tiles of the field with targeted range reads. */
+    const bool stream_var_;
+  };
+
+  /**
+   * Schema properties of a field, resolved once so that per-tile loops do
+   * not repeat string-keyed schema lookups for every tile. See
+   * `resolve_field`.
+   */
+  struct ResolvedField {
+    /** The field name. */
+    std::string name;
+
+    /** Is the field var-sized? */
+    bool var_sized;
+
+    /** Is the field nullable? */
+    bool nullable;
+
+    /** The cell size, zero for var-sized fields. */
+    uint64_t cell_size;
+
+    /** Whether each fragment's schema contains the field. */
+    std::vector<uint8_t> present;
   };
 
   /** The state for a read query. */
@@ -166,8 +204,8 @@ class ReaderBase : public StrategyBase {
   ReaderBase(
       stats::Stats* stats, shared_ptr<Logger> logger, StrategyParams& params);
 
-  /** Destructor. */
-  ~ReaderBase() = default;
+  /** Destructor. Unpins the fragment metadata pinned at construction. */
+  ~ReaderBase();
 
   /* ********************************* */
   /*          STATIC FUNCTIONS         */
@@ -208,6 +246,41 @@ class ReaderBase : public StrategyBase {
     return {t_min, t_max};
   }
 
+  /**
+   * Intersects a chunk range with the single chunk containing the given
+   * cell, for point-read queries that only need one chunk of a tile
+   * unfiltered. Chunks of a fixed-size tile hold consecutive cells, so the
+   * chunk is found from the cell's byte position in the unfiltered tile.
+   *
+   * @param chunk_data The tile chunk info, buffers and offsets.
+   * @param cell_pos Position of the cell within the tile.
+   * @param cell_size Size of a cell, in bytes.
+   * @param t_min The chunk range index to start from.
+   * @param t_max The chunk range index to end at.
+   * @return {min, max}, empty if the chunk falls outside [t_min, t_max).
+   */
+  static tuple<uint64_t, uint64_t> point_chunk_range(
+      const ChunkData& chunk_data,
+      const uint64_t cell_pos,
+      const uint64_t cell_size,
+      const uint64_t t_min,
+      const uint64_t t_max) {
+    const auto& offsets = chunk_data.chunk_offsets_;
+    const auto byte_pos = cell_pos * cell_size;
+    auto it = std::upper_bound(offsets.begin(), offsets.end(), byte_pos);
+    if (it == offsets.begin()) {
+      return {t_min, t_max};
+    }
+
+    const auto chunk_idx =
+        static_cast<uint64_t>(std::distance(offsets.begin(), it)) - 1;
+    if (chunk_idx < t_min || chunk_idx >= t_max) {
+      return {0, 0};
+    }
+
+    return {chunk_idx, chunk_idx + 1};
+  }
+
   /* ********************************* */
   /*          PUBLIC METHODS           */
   /* ********************************* */
@@ -221,6 +294,24 @@ class ReaderBase : public StrategyBase {
    */
   bool skip_field(const unsigned frag_idx, const std::string& name) const;
 
+  /**
+   * Check if the var tile of a field can be loaded with targeted range
+   * reads of the selected cells instead of reading the whole var tile.
+   * Only var tiles written as a single chunk with an empty filter pipeline
+   * and no encryption have their cell data stored verbatim at computable
+   * offsets, which is validated structurally against the persisted tile
+   * size from the fragment metadata.
+   *
+   * @param name Name of the field.
+   * @param frag_idx Fragment index.
+   * @param tile_idx Tile index.
+   * @return True if the var tile can be loaded with targeted range reads.
+   */
+  bool can_stream_var_tile(
+      const std::string& name,
+      const unsigned frag_idx,
+      const uint64_t tile_idx) const;
+
  protected:
   /* ********************************* */
   /*       PROTECTED ATTRIBUTES        */
@@ -296,6 +387,60 @@ class ReaderBase : public StrategyBase {
   /** The minimum number of bytes in a batched read operation. */
   uint64_t min_batch_size_;
 
+  /**
+   * If `true`, unfiltering of a field starts as soon as the reads for that
+   * field complete instead of after the reads for all fields complete.
+   */
+  bool pipelined_unfilter_ = false;
+
+  /**
+   * If `true`, tiles whose filter pipeline is empty are served directly from
+   * the read buffers instead of being copied into their own allocations.
+   */
+  bool zero_copy_unfiltered_tiles_ = false;
+
+  /**
+   * Minimum in-memory var tile size for which eligible var tiles are loaded
+   * with targeted range reads of the selected cells instead of reading the
+   * whole var tile. 0 disables streamed var reads.
+   */
+  uint64_t streamed_var_read_min_tile_size_ = 0;
+
+  /**
+   * If set, the position within its space tile of the only cell the query
+   * touches. Set by readers that detect a single-cell subarray, so that
+   * unfiltering a tile decompresses only the chunk containing that cell
+   * instead of every chunk. Tiles unfiltered this way are not cached.
+   */
+  std::optional<uint64_t> point_cell_pos_;
+
+  /**
+   * If `true`, tiles are unfiltered tile-major: all requested fields of one
+   * tile are unfiltered together on the same worker, walking the tiles in
+   * (fragment, tile index) order, instead of field by field across all
+   * tiles.
+   */
+  bool tile_major_unfilter_ = false;
+
+  /**
+   * If `true`, unfiltered tiles dropped because the user buffers filled up
+   * are staged in `staged_unfiltered_tiles_` instead of being discarded, so
+   * that the next iteration copies their cells without reading and
+   * unfiltering them again.
+   */
+  bool stage_incomplete_tiles_ = false;
+
+  /**
+   * Spillover staging area for incomplete queries: the unfiltered payloads,
+   * keyed like the tile cache, of result tiles that were processed but whose
+   * cells could not all be delivered. The staged buffers are charged to the
+   * query memory tracker and entries are consumed by the iteration that
+   * reprocesses the tile. Only accessed from the serial sections of the
+   * copy path, so it is not synchronized.
+   */
+  mutable std::unordered_map<std::string, CachedTileData>
+      staged_unfiltered_tiles_;
+
   /** Default channel aggregates, stored by field name. */
   std::unordered_map<std::string, std::vector<shared_ptr<IAggregator>>>
       aggregates_;
@@ -322,6 +467,25 @@ class ReaderBase : public StrategyBase {
     return true;
   }
 
+  /**
+   * Returns wether all aggregates for the field can be computed from
+   * fragment tile metadata or not.
+   */
+  bool aggregates_use_frag_md(const std::string& name) const {
+    auto it = aggregates_.find(name);
+    if (it == aggregates_.end()) {
+      return true;
+    }
+
+    for (auto& aggregate : it->second) {
+      if (!aggregate->can_aggregate_with_frag_md()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   /** Returns wether the field is for null count aggregation only or not. */
   bool null_count_aggregate_only(const std::string& name) const {
     if (!aggregate_only(name)) {
@@ -522,6 +686,23 @@ class ReaderBase : public StrategyBase {
       const std::vector<std::string>& names,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Read and unfilter tiles with the read and unfilter stages pipelined.
+   *
+   * Reads for all fields are issued up front, but the read tasks of each
+   * field are tracked separately so that unfiltering of a field can start
+   * as soon as its own bytes have landed, while reads for the remaining
+   * fields are still in flight.
+   *
+   * @param names The field names.
+   * @param result_tiles The retrieved tiles will be stored inside the
+   *     `ResultTile` instances in this vector.
+   * @return Status.
+   */
+  Status read_and_unfilter_tiles_pipelined(
+      const std::vector<NameToLoad>& names,
+      const std::vector<ResultTile*>& result_tiles) const;
+
   /**
    * Concurrently executes across each name in `names` and each result tile
    * in 'result_tiles'.
@@ -571,6 +752,25 @@ class ReaderBase : public StrategyBase {
       const std::vector<NameToLoad>& names,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Retrieves the tiles on a list of attribute or dimension and stores it
+   * in the appropriate result tile.
+   *
+   * This overload does not wait for the read tasks to finish; they are
+   * appended to `read_tasks` so the caller can overlap other work with the
+   * reads before waiting on them.
+   *
+   * @param names The field names.
+   * @param result_tiles The retrieved tiles will be stored inside the
+   *     `ResultTile` instances in this vector.
+   * @param read_tasks Output vector the read tasks are appended to.
+   * @return Filtered data blocks.
+   */
+  std::list<FilteredData> read_tiles(
+      const std::vector<NameToLoad>& names,
+      const std::vector<ResultTile*>& result_tiles,
+      std::vector<ThreadPool::Task>& read_tasks) const;
+
   /**
    * Filters the tiles on a particular field from all input
    * fragments based on the tile info in `result_tiles`.
@@ -585,6 +785,21 @@ class ReaderBase : public StrategyBase {
       const bool validity_only,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Filters the tiles on a list of fields tile-major: the tiles are walked
+   * in (fragment, tile index) order and all fields of one tile are
+   * unfiltered consecutively on the same worker, so that the working set of
+   * a worker stays within one tile instead of churning the last level cache
+   * across interleaved fields and fragments.
+   *
+   * @param names Fields whose tiles will be unfiltered.
+   * @param result_tiles Vector containing the tiles to be unfiltered.
+   * @return Status
+   */
+  Status unfilter_tiles_tile_major(
+      const std::vector<NameToLoad>& names,
+      const std::vector<ResultTile*>& result_tiles) const;
+
   /**
    * Unfilter a specific range of chunks in tile
    *
@@ -642,6 +857,37 @@ class ReaderBase : public StrategyBase {
   uint64_t get_attribute_persisted_tile_size(
       const std::string& name, unsigned f, uint64_t t) const;
 
+  /**
+   * Resolves the schema properties of a field once, for use by per-tile
+   * loops.
+   *
+   * @param name The field name.
+   * @return The resolved field.
+   */
+  ResolvedField resolve_field(const std::string& name) const;
+
+  /**
+   * Get the size of an attribute tile for a resolved field.
+   *
+   * @param field The resolved field.
+   * @param f The fragment idx.
+   * @param t The tile idx.
+   * @return Tile size.
+   */
+  uint64_t get_attribute_tile_size(
+      const ResolvedField& field, unsigned f, uint64_t t) const;
+
+  /**
+   * Get the on disk size of an attribute tile for a resolved field.
+   *
+   * @param field The resolved field.
+   * @param f The fragment idx.
+   * @param t The tile idx.
+   * @return Tile size.
+   */
+  uint64_t get_attribute_persisted_tile_size(
+      const ResolvedField& field, unsigned f, uint64_t t) const;
+
   /**
    * Computes the tile domains based on the current partition.
    *
@@ -668,6 +914,108 @@ class ReaderBase : public StrategyBase {
    */
   Status zip_tile_coordinates(const std::string& name, Tile* tile) const;
 
+  /**
+   * Returns the tile cache key for a tile of a field. Keyed on the fragment
+   * URI, which is never reused, so stale entries cannot be served.
+   *
+   * @param frag_idx Fragment index of the tile.
+   * @param tile_idx Tile index.
+   * @param name Name of the field.
+   * @return Tile cache key.
+   */
+  std::string tile_cache_key(
+      const unsigned frag_idx,
+      const uint64_t tile_idx,
+      const std::string& name) const;
+
+  /**
+   * Probes the tile cache for the result tiles of a field. The returned
+   * tiles are served directly from the cached buffers, skipping both the
+   * reads and the filter pipeline.
+   *
+   * @param name_to_load field to load.
+   * @param result_tiles The retrieved tiles will be stored inside the
+   * `result_tiles` structure.
+   * @return Result tiles served from the cache, with their cached data.
+   */
+  std::unordered_map<const ResultTile*, CachedTileData> probe_tile_cache(
+      const NameToLoad& name_to_load,
+      const std::vector<ResultTile*>& result_tiles) const;
+
+  /**
+   * Queues the targeted range reads for a streamed var tile, now that its
+   * offsets tile is unfiltered. The byte ranges covering the input cell
+   * ranges are computed from the offsets tile, merged when closer than the
+   * minimum batch gap and read directly into the var tile data.
+   *
+   * @param name Name of the field.
+   * @param tile Result tile with a streamed var tile.
+   * @param cell_ranges Selected cell ranges (start included, end excluded),
+   * in ascending order.
+   * @param read_tasks Output vector the read tasks are appended to.
+   */
+  void read_streamed_var_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const std::vector<std::pair<uint64_t, uint64_t>>& cell_ranges,
+      std::vector<ThreadPool::Task>& read_tasks) const;
+
+  /**
+   * Inserts the unfiltered, post-processed data of a result tile into the
+   * tile cache for future queries.
+   *
+   * @param name field the tile belongs to.
+   * @param tile Result tile to cache.
+   * @param var_size True if the field is var-sized, false otherwise.
+   * @param nullable True if the field is nullable, false otherwise.
+   */
+  void cache_unfiltered_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable) const;
+
+  /**
+   * Stages the unfiltered data of the result tiles starting at
+   * `min_result_tile`, which could not be delivered in this iteration, so
+   * that the iteration that reprocesses them serves their data without
+   * reading and unfiltering it again.
+   *
+   * @param name field the tiles belong to.
+   * @param result_tiles Result tiles to stage.
+   * @param min_result_tile Index of the first tile to stage.
+   */
+  void stage_unfiltered_tiles(
+      const std::string& name,
+      const std::vector<ResultTile*>& result_tiles,
+      const uint64_t min_result_tile = 0) const;
+
+  /**
+   * Stages the unfiltered data of one undelivered result tile in the
+   * spillover staging area, copying the payloads into buffers charged to
+   * the query memory tracker.
+   *
+   * @param name field the tile belongs to.
+   * @param tile Result tile to stage.
+   * @param var_size True if the field is var-sized, false otherwise.
+   * @param nullable True if the field is nullable, false otherwise.
+   */
+  void stage_unfiltered_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable) const;
+
+  /**
+   * Copies a staged buffer into memory charged to the query memory tracker.
+   *
+   * @param data The data to copy.
+   * @param size The size of the data.
+   * @return Shared ownership of the copy.
+   */
+  std::shared_ptr<std::byte> copy_into_staging(
+      const void* data, uint64_t size) const;
+
   /**
    * Reads the chunk data of all tile buffers and stores them in a data
    * structure together with the offsets between them
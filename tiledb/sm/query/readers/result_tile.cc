@@ -35,6 +35,7 @@
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/query/readers/cell_copy_kernels.h"
 #include "tiledb/type/apply_with_type.h"
 #include "tiledb/type/range/range.h"
 
@@ -467,6 +468,113 @@ Status ResultTile::read_nullable(
   return Status::Ok();
 }
 
+ResultTile::CopyPlan::CopyPlan(
+    ResultTile& tile,
+    const std::string& name,
+    const bool nullable,
+    const uint64_t timestamp_val)
+    : strategy_(Strategy::DIRECT)
+    , src_(nullptr)
+    , src_validity_(nullptr)
+    , cell_size_(0)
+    , src_stride_(1)
+    , timestamp_(timestamp_val) {
+  bool is_dim = false;
+  throw_if_not_ok(tile.domain_->has_dimension(name, &is_dim));
+
+  // Boolean value indicating we will copy the fragment timestamp value into
+  // the buffer for this tile.
+  const bool use_fragment_ts =
+      name == constants::timestamps && timestamp_val != UINT64_MAX;
+
+  // The strategy selection mirrors `read`, resolved once per tile instead
+  // of per cell range.
+  if ((!is_dim && name != constants::coords && !use_fragment_ts) ||
+      (is_dim && !tile.coord_tiles_[0].first.empty()) ||
+      (name == constants::coords && tile.coords_tile_.has_value())) {
+    // Typical case where the field is stored in its own tile.
+    auto tile_tuple = tile.tile_tuple(name);
+    const auto& t = tile_tuple->fixed_tile();
+    src_ = t.data_as<uint8_t>();
+    cell_size_ = t.cell_size();
+    if (nullable) {
+      src_validity_ = tile_tuple->validity_tile().data_as<uint8_t>();
+    }
+  } else if (
+      name == constants::coords && !tile.coord_tiles_[0].first.empty() &&
+      !tile.coords_tile_.has_value()) {
+    // Special case where zipped coordinates are requested, but the
+    // result tile stores separate coordinates.
+    strategy_ = Strategy::ZIP_COORDS;
+    dim_srcs_.reserve(tile.coord_tiles_.size());
+    for (auto& coord_tile : tile.coord_tiles_) {
+      const auto& t = coord_tile.second->fixed_tile();
+      dim_srcs_.emplace_back(t.data_as<uint8_t>(), t.cell_size());
+      cell_size_ += t.cell_size();
+    }
+  } else if (use_fragment_ts) {
+    strategy_ = Strategy::FRAGMENT_TIMESTAMP;
+    cell_size_ = constants::timestamp_size;
+  } else {
+    // Last case which is zipped coordinates but split buffers.
+    // This is only for backwards compatibility of pre format 5 (v2.0) arrays
+    assert(tile.coords_tile_.has_value());
+    assert(name != constants::coords);
+    const auto& t = tile.coords_tile_->fixed_tile();
+    const auto dim_num = tile.domain_->dim_num();
+    cell_size_ = t.cell_size() / dim_num;
+    src_stride_ = dim_num;
+    unsigned dim_offset = 0;
+    for (unsigned d = 0; d < dim_num; ++d) {
+      if (tile.domain_->dimension_ptr(d)->name() == name) {
+        dim_offset = d;
+        break;
+      }
+    }
+    src_ = t.data_as<uint8_t>() + dim_offset * cell_size_;
+  }
+}
+
+void ResultTile::CopyPlan::copy(
+    const uint64_t pos,
+    const uint64_t len,
+    const uint64_t stride,
+    void* const buffer,
+    void* const buffer_validity) const {
+  auto dest = static_cast<uint8_t*>(buffer);
+  switch (strategy_) {
+    case Strategy::DIRECT:
+      cellcopy::copy_cells(
+          dest,
+          src_ + pos * src_stride_ * cell_size_,
+          cell_size_,
+          len,
+          stride * src_stride_);
+      if (src_validity_ != nullptr) {
+        cellcopy::copy_validity(
+            static_cast<uint8_t*>(buffer_validity),
+            src_validity_ + pos,
+            len,
+            stride);
+      }
+      break;
+    case Strategy::ZIP_COORDS:
+      for (uint64_t c = 0; c < len; ++c) {
+        for (const auto& [src, size] : dim_srcs_) {
+          memcpy(dest, src + (pos + c * stride) * size, size);
+          dest += size;
+        }
+      }
+      break;
+    case Strategy::FRAGMENT_TIMESTAMP:
+      for (uint64_t c = 0; c < len; ++c) {
+        memcpy(dest, &timestamp_, constants::timestamp_size);
+        dest += constants::timestamp_size;
+      }
+      break;
+  }
+}
+
 bool ResultTile::stores_zipped_coords() const {
   return coords_tile_.has_value();
 }
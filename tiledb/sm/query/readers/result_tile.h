@@ -33,6 +33,7 @@
 #ifndef TILEDB_RESULT_TILE_H
 #define TILEDB_RESULT_TILE_H
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <numeric>
@@ -221,6 +222,26 @@ class ResultTile {
         , validity_filtered_data_(validity_filtered_data) {
     }
 
+    /**
+     * Constructor with shared ownership of the buffers backing the filtered
+     * data pointers, enabling the zero-copy read path.
+     */
+    TileData(
+        void* fixed_filtered_data,
+        void* var_filtered_data,
+        void* validity_filtered_data,
+        std::shared_ptr<std::byte> fixed_filtered_data_owner,
+        std::shared_ptr<std::byte> var_filtered_data_owner,
+        std::shared_ptr<std::byte> validity_filtered_data_owner)
+        : fixed_filtered_data_(fixed_filtered_data)
+        , var_filtered_data_(var_filtered_data)
+        , validity_filtered_data_(validity_filtered_data)
+        , fixed_filtered_data_owner_(std::move(fixed_filtered_data_owner))
+        , var_filtered_data_owner_(std::move(var_filtered_data_owner))
+        , validity_filtered_data_owner_(
+              std::move(validity_filtered_data_owner)) {
+    }
+
     /* ********************************* */
     /*                API                */
     /* ********************************* */
@@ -240,6 +261,23 @@ class ResultTile {
       return validity_filtered_data_;
     }
 
+    /** @return Shared owner of the fixed filtered data, may be `nullptr`. */
+    inline std::shared_ptr<std::byte> fixed_filtered_data_owner() const {
+      return fixed_filtered_data_owner_;
+    }
+
+    /** @return Shared owner of the var filtered data, may be `nullptr`. */
+    inline std::shared_ptr<std::byte> var_filtered_data_owner() const {
+      return var_filtered_data_owner_;
+    }
+
+    /**
+     * @return Shared owner of the validity filtered data, may be `nullptr`.
+     */
+    inline std::shared_ptr<std::byte> validity_filtered_data_owner() const {
+      return validity_filtered_data_owner_;
+    }
+
    private:
     /* ********************************* */
     /*        PRIVATE ATTRIBUTES         */
@@ -253,6 +291,15 @@ class ResultTile {
 
     /** Stores the validity filtered data pointer. */
     void* validity_filtered_data_;
+
+    /** Shared owner of the fixed filtered data, may be `nullptr`. */
+    std::shared_ptr<std::byte> fixed_filtered_data_owner_;
+
+    /** Shared owner of the var filtered data, may be `nullptr`. */
+    std::shared_ptr<std::byte> var_filtered_data_owner_;
+
+    /** Shared owner of the validity filtered data, may be `nullptr`. */
+    std::shared_ptr<std::byte> validity_filtered_data_owner_;
   };
 
   /**
@@ -286,7 +333,8 @@ class ResultTile {
               tile_sizes.tile_size(),
               tile_data.fixed_filtered_data(),
               tile_sizes.tile_persisted_size(),
-              memory_tracker_) {
+              memory_tracker_,
+              tile_data.fixed_filtered_data_owner()) {
       if (tile_sizes.has_var_tile()) {
         auto type = array_schema.type(name);
         var_tile_.emplace(
@@ -297,7 +345,8 @@ class ResultTile {
             tile_sizes.tile_var_size(),
             tile_data.var_filtered_data(),
             tile_sizes.tile_var_persisted_size(),
-            memory_tracker_);
+            memory_tracker_,
+            tile_data.var_filtered_data_owner());
       }
 
       if (tile_sizes.has_validity_tile()) {
@@ -309,7 +358,8 @@ class ResultTile {
             tile_sizes.tile_validity_size(),
             tile_data.validity_filtered_data(),
             tile_sizes.tile_validity_persisted_size(),
-            memory_tracker_);
+            memory_tracker_,
+            tile_data.validity_filtered_data_owner());
       }
     }
 
@@ -365,6 +415,78 @@ class ResultTile {
     optional<Tile> validity_tile_;
   };
 
+  /**
+   * A copy plan for one fixed-sized attribute/dimension of this tile.
+   *
+   * The plan resolves the source buffers, cell size and copy strategy once,
+   * so that repeated copies out of the same tile run as tight loops instead
+   * of re-deriving them per cell range like `read` does.
+   */
+  class CopyPlan {
+   public:
+    /**
+     * Constructor.
+     *
+     * @param tile The result tile to copy from.
+     * @param name The name of the attribute/dimension to copy.
+     * @param nullable Whether the field is nullable.
+     * @param timestamp_val Fragment timestamp to copy for the timestamps
+     *     field of fragments without cell timestamps, `UINT64_MAX` otherwise.
+     */
+    CopyPlan(
+        ResultTile& tile,
+        const std::string& name,
+        bool nullable,
+        uint64_t timestamp_val = UINT64_MAX);
+
+    /**
+     * Copies `len` cells to `buffer`, reading every `stride`-th cell
+     * starting at position `pos`. The validity values of nullable fields
+     * are copied to `buffer_validity`.
+     */
+    void copy(
+        uint64_t pos,
+        uint64_t len,
+        uint64_t stride,
+        void* buffer,
+        void* buffer_validity) const;
+
+   private:
+    /** How the destination cells are produced. */
+    enum class Strategy {
+      /** Strided copy from a single source buffer. */
+      DIRECT,
+      /** Zip split coordinate tiles into the destination. */
+      ZIP_COORDS,
+      /** Broadcast the fragment timestamp. */
+      FRAGMENT_TIMESTAMP
+    };
+
+    /** The copy strategy. */
+    Strategy strategy_;
+
+    /** The resolved source buffer, for the direct strategy. */
+    const uint8_t* src_;
+
+    /** The resolved validity source buffer, `nullptr` if not nullable. */
+    const uint8_t* src_validity_;
+
+    /** Size of a destination cell, in bytes. */
+    uint64_t cell_size_;
+
+    /**
+     * Stride between consecutive source cells, in cells. This is 1 except
+     * when a single dimension is copied out of a zipped coordinates tile.
+     */
+    uint64_t src_stride_;
+
+    /** Source buffer and cell size per dimension, for the zip strategy. */
+    std::vector<std::pair<const uint8_t*, uint64_t>> dim_srcs_;
+
+    /** The fragment timestamp to broadcast. */
+    uint64_t timestamp_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -957,6 +1079,35 @@ class ResultTileWithBitmap : public ResultTile {
     return false;
   }
 
+  /**
+   * Returns whether every cell in the tile is included in the results exactly
+   * once. Contrary to 'copy_full_tile', this can also detect full tiles for
+   * overlapping ranges, at the cost of a scan of the bitmap.
+   */
+  inline bool all_cells_selected_once() {
+    // No bitmap, all cells are in the results.
+    if (bitmap_.size() == 0) {
+      return true;
+    }
+
+    if (result_num_ != cell_num_) {
+      return false;
+    }
+
+    // For non overlapping ranges, a cell can be counted at most once, so a
+    // matching result count means the bitmap is all ones.
+    const bool non_overlapping = std::is_same<BitmapType, uint8_t>::value;
+    if (non_overlapping) {
+      return true;
+    }
+
+    // For overlapping ranges, a cell counted twice can hide a cell counted
+    // zero times, so every count needs to be validated.
+    return std::all_of(bitmap_.begin(), bitmap_.end(), [](BitmapType count) {
+      return count == 1;
+    });
+  }
+
  protected:
   /* ********************************* */
   /*       PROTECTED ATTRIBUTES        */
@@ -990,6 +1141,8 @@ class GlobalOrderResultTile : public ResultTileWithBitmap<BitmapType> {
             frag_idx, tile_idx, frag_md, memory_tracker)
       , hilbert_values_(this->memory_tracker_->get_resource(
             MemoryType::TILE_HILBERT_VALUES))
+      , global_order_keys_(this->memory_tracker_->get_resource(
+            MemoryType::TILE_GLOBAL_ORDER_KEYS))
       , post_dedup_bitmap_(nullopt)
       , per_cell_delete_condition_(
             this->memory_tracker_->get_resource(MemoryType::QUERY_CONDITION))
@@ -1091,6 +1244,26 @@ class GlobalOrderResultTile : public ResultTileWithBitmap<BitmapType> {
     hilbert_values_[i] = v;
   }
 
+  /** Allocate space for the global order keys vector. */
+  inline void allocate_global_order_keys_vector() {
+    global_order_keys_.resize(ResultTile::cell_num_);
+  }
+
+  /** Returns `true` if global order keys were computed for this tile. */
+  inline bool has_global_order_keys() {
+    return !global_order_keys_.empty();
+  }
+
+  /** Get the global order key at an index. */
+  inline uint64_t global_order_key(uint64_t i) {
+    return global_order_keys_[i];
+  }
+
+  /** Set a global order key. */
+  inline void set_global_order_key(uint64_t i, uint64_t v) {
+    global_order_keys_[i] = v;
+  }
+
   /** Return first cell index in bitmap. */
   uint64_t first_cell_in_bitmap() {
     uint64_t ret = 0;
@@ -1161,6 +1334,9 @@ class GlobalOrderResultTile : public ResultTileWithBitmap<BitmapType> {
   /** Hilbert values for this tile. */
   tdb::pmr::vector<uint64_t> hilbert_values_;
 
+  /** Packed global order keys for this tile. */
+  tdb::pmr::vector<uint64_t> global_order_keys_;
+
   /**
    * An extra bitmap will be needed for array with no duplicates. For those,
    * deduplication need to be run before query condition is applied. So bitmap_
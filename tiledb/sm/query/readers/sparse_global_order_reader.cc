@@ -81,7 +81,9 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
     , memory_used_for_coords_(array_->fragment_metadata().size())
     , consolidation_with_timestamps_(consolidation_with_timestamps)
     , last_cells_(array_->fragment_metadata().size())
-    , tile_offsets_loaded_(false) {
+    , tile_offsets_loaded_(false)
+    , shadowed_tiles_computed_(false)
+    , global_order_key_(array_schema_.domain()) {
   // Initialize memory budget variables.
   refresh_config();
 }
@@ -110,6 +112,8 @@ SparseGlobalOrderReader<BitmapType>::status_incomplete_reason() const {
 template <class BitmapType>
 void SparseGlobalOrderReader<BitmapType>::refresh_config() {
   memory_budget_.refresh_config(config_, "sparse_global_order");
+  pipelined_unfilter_ = config_.get<bool>(
+      "sm.query.sparse_global_order.pipelined_unfilter", Config::must_find);
 }
 
 template <class BitmapType>
@@ -146,6 +150,9 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
   // Load tile offsets, if required.
   load_all_tile_offsets();
 
+  // Skip tiles wholly shadowed by newer fragments, if applicable.
+  compute_shadowed_tiles();
+
   // Field names to process.
   std::vector<std::string> names = field_names_to_process();
 
@@ -171,9 +178,11 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
       // Run deduplication for tiles with timestamps, if required.
       dedup_tiles_with_timestamps(created_tiles);
 
-      // Compute hilbert values.
+      // Compute hilbert values or packed global order keys.
       if (array_schema_.cell_order() == Layout::HILBERT) {
         compute_hilbert_values(created_tiles);
+      } else if (global_order_key_.enabled()) {
+        compute_global_order_keys(created_tiles);
       }
 
       // Clear result tiles that are not necessary anymore.
@@ -194,7 +203,7 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
       user_buffers_full = user_buffs_full;
       result_cell_slabs = std::move(rcs);
     } else {
-      auto&& [user_buffs_full, rcs] = merge_result_cell_slabs<GlobalCmpReverse>(
+      auto&& [user_buffs_full, rcs] = merge_result_cell_slabs_dispatch(
           max_num_cells_to_copy(), result_tiles);
       user_buffers_full = user_buffs_full;
       result_cell_slabs = std::move(rcs);
@@ -221,12 +230,11 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
   stats_->add_counter("result_num", cells);
   resize_output_buffers(cells);
 
-  if (offsets_extra_element_) {
-    add_extra_offset();
-  }
-
   stats_->add_counter("ignored_tiles", tmp_read_state_.num_ignored_tiles());
 
+  // Record execution feedback for subsequent queries on this array.
+  record_read_profile();
+
   return Status::Ok();
 }
 
@@ -262,6 +270,139 @@ void SparseGlobalOrderReader<BitmapType>::load_all_tile_offsets() {
   }
 }
 
+template <class BitmapType>
+void SparseGlobalOrderReader<BitmapType>::compute_shadowed_tiles() {
+  if (shadowed_tiles_computed_) {
+    return;
+  }
+  shadowed_tiles_computed_ = true;
+
+  // Only run when fragment order alone decides precedence between cell
+  // versions. Timestamps or delete conditions can resurface an older
+  // version, which makes it unsafe to drop tiles from metadata alone.
+  if (fragment_metadata_.size() <= 1 || array_schema_.allows_dups() ||
+      consolidation_with_timestamps_ ||
+      !delete_and_update_conditions_.empty()) {
+    return;
+  }
+
+  const auto& relevant_fragments = subarray_.relevant_fragments();
+  for (auto f : relevant_fragments) {
+    if (fragment_metadata_[f]->has_timestamps() ||
+        fragment_metadata_[f]->has_delete_meta()) {
+      return;
+    }
+  }
+
+  auto timer_se = stats_->start_timer("compute_shadowed_tiles");
+
+  // Make sure the tile MBRs are loaded for all relevant fragments.
+  subarray_.load_relevant_fragment_rtrees(&resources_.compute_tp());
+
+  // Collect, per fragment, the MBRs of tiles whose cell count equals the
+  // number of coordinates in their MBR. Those tiles contain every coordinate
+  // of their MBR and are the only ones guaranteed to supersede all older
+  // cell versions in the region they cover.
+  auto& domain = array_schema_.domain();
+  const auto dim_num = array_schema_.dim_num();
+  const auto fragment_num = fragment_metadata_.size();
+  std::vector<std::vector<const NDRange*>> covering_mbrs(fragment_num);
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, relevant_fragments.size(), [&](uint64_t i) {
+        auto f = relevant_fragments[i];
+        auto& frag_md = fragment_metadata_[f];
+        for (uint64_t t = 0; t < frag_md->tile_num(); t++) {
+          const auto& mbr = frag_md->mbr(t);
+          uint64_t mbr_cells = 1;
+          bool discrete = true;
+          for (unsigned d = 0; d < dim_num; d++) {
+            auto range_cells = domain.dimension_ptr(d)->domain_range(mbr[d]);
+            if (range_cells == 0 ||
+                mbr_cells >
+                    std::numeric_limits<uint64_t>::max() / range_cells) {
+              discrete = false;
+              break;
+            }
+            mbr_cells *= range_cells;
+          }
+
+          if (discrete && mbr_cells == frag_md->cell_num(t)) {
+            covering_mbrs[f].emplace_back(&mbr);
+          }
+        }
+
+        return Status::Ok();
+      }));
+
+  // Does any fragment newer than 'f' have covering tiles?
+  std::vector<uint8_t> has_newer_covering(fragment_num, 0);
+  bool any_covering = false;
+  for (uint64_t f = fragment_num - 1; f-- > 0;) {
+    any_covering |= !covering_mbrs[f + 1].empty();
+    has_newer_covering[f] = any_covering;
+  }
+
+  if (!any_covering) {
+    return;
+  }
+
+  // Mark tiles wholly contained in a covering MBR of a newer fragment as
+  // ignored so they are never fetched.
+  std::atomic<uint64_t> shadowed_tiles{0};
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, relevant_fragments.size(), [&](uint64_t i) {
+        auto f = relevant_fragments[i];
+        if (!has_newer_covering[f]) {
+          return Status::Ok();
+        }
+
+        auto shadowed = [&](uint64_t t) {
+          const auto& mbr = fragment_metadata_[f]->mbr(t);
+          for (auto g = f + 1; g < fragment_num; g++) {
+            for (auto covering_mbr : covering_mbrs[g]) {
+              bool covered = true;
+              for (unsigned d = 0; d < dim_num; d++) {
+                if (!domain.dimension_ptr(d)->covered(
+                        mbr[d], (*covering_mbr)[d])) {
+                  covered = false;
+                  break;
+                }
+              }
+
+              if (covered) {
+                return true;
+              }
+            }
+          }
+
+          return false;
+        };
+
+        auto process_tile = [&](uint64_t t) {
+          if (shadowed(t)) {
+            tmp_read_state_.add_ignored_tile(f, t);
+            shadowed_tiles++;
+          }
+        };
+
+        if (subarray_.is_set()) {
+          for (auto& range : tmp_read_state_.tile_ranges(f)) {
+            for (uint64_t t = range.first; t <= range.second; t++) {
+              process_tile(t);
+            }
+          }
+        } else {
+          for (uint64_t t = 0; t < fragment_metadata_[f]->tile_num(); t++) {
+            process_tile(t);
+          }
+        }
+
+        return Status::Ok();
+      }));
+
+  stats_->add_counter("shadowed_tiles", shadowed_tiles.load());
+}
+
 template <class BitmapType>
 uint64_t SparseGlobalOrderReader<BitmapType>::get_coord_tiles_size(
     unsigned dim_num, unsigned f, uint64_t t) {
@@ -272,8 +413,9 @@ uint64_t SparseGlobalOrderReader<BitmapType>::get_coord_tiles_size(
   // Add the result tile structure size.
   tiles_size += sizeof(GlobalOrderResultTile<BitmapType>);
 
-  // Account for hilbert data.
-  if (array_schema_.cell_order() == Layout::HILBERT) {
+  // Account for hilbert data or global order keys.
+  if (array_schema_.cell_order() == Layout::HILBERT ||
+      global_order_key_.enabled()) {
     tiles_size += fragment_metadata_[f]->cell_num(t) * sizeof(uint64_t);
   }
 
@@ -308,8 +450,21 @@ bool SparseGlobalOrderReader<BitmapType>::add_result_tile(
     return false;
   }
 
+  // Skip tiles the cached bloom filters prove cannot satisfy a mandatory
+  // equality clause of the query condition.
+  if (bloom_prune_tile(f, t)) {
+    return false;
+  }
+
+  // Skip tiles whose MBR proves a mandatory dimension clause of the query
+  // condition matches no cell.
+  if (mbr_prune_tile(f, t)) {
+    return false;
+  }
+
   // Calculate memory consumption for this tile.
   auto tiles_size = get_coord_tiles_size(dim_num, f, t);
+  observe_coord_tiles_size(tiles_size);
 
   // Don't load more tiles than the memory budget.
   if (memory_used_for_coords_[f] + tiles_size > memory_budget_coords_tiles) {
@@ -351,6 +506,22 @@ SparseGlobalOrderReader<BitmapType>::create_result_tiles(
                          memory_budget_.ratio_coords() /
                          num_fragments_to_process;
 
+  // A read profile from an earlier query on this array knows the largest
+  // coordinate tile footprint. A fragment whose tiles are larger than an
+  // even split of the coordinate budget cannot load a single tile, so floor
+  // the per fragment budget at the measured footprint, within the overall
+  // coordinate budget.
+  const auto profile =
+      resources_.read_profiles().profile(
+          array_->array_directory().uri().to_string());
+  if (profile.max_coord_tiles_size_ > 0) {
+    per_fragment_memory_ = std::min(
+        memory_budget_.total_budget() * memory_budget_.ratio_coords(),
+        std::max(
+            per_fragment_memory_,
+            static_cast<double>(profile.max_coord_tiles_size_)));
+  }
+
   // Save which result tile list is empty.
   std::vector<uint64_t> rt_list_num_tiles(result_tiles.size());
   for (uint64_t i = 0; i < result_tiles.size(); i++) {
@@ -703,7 +874,7 @@ bool SparseGlobalOrderReader<BitmapType>::add_all_dups_to_queue(
     // Construct a new result coords that specifies it has no next cell.
     // A cell will be added after this one so we don't want to process it
     // twice.
-    tile_queue.emplace(rc.tile_, rc.pos_, false);
+    tile_queue.emplace(frag_idx, rc.tile_, rc.pos_, false);
     rc.advance_to_next_cell();
 
     // For arrays with no duplicates, we cannot use the last cell of a
@@ -727,7 +898,7 @@ bool SparseGlobalOrderReader<BitmapType>::add_all_dups_to_queue(
 
         // Next tile starts with the same coords, switch to it.
         if (rc.same_coords(rc2)) {
-          tile_queue.emplace(rc.tile_, rc.pos_, false);
+          tile_queue.emplace(frag_idx, rc.tile_, rc.pos_, false);
 
           // Remove the current tile if not used.
           if (!rc.tile_->used()) {
@@ -822,7 +993,7 @@ bool SparseGlobalOrderReader<BitmapType>::add_next_cell_to_queue(
         return true;
       }
     }
-    tile_queue.emplace(std::move(rc));
+    tile_queue.emplace(frag_idx, std::move(rc));
   }
 
   // We don't need more tiles as a tile was found.
@@ -850,21 +1021,57 @@ void SparseGlobalOrderReader<BitmapType>::compute_hilbert_values(
         auto cell_num =
             fragment_metadata_[tile->frag_idx()]->cell_num(tile->tile_idx());
         auto rc = GlobalOrderResultCoords(tile, 0);
-        std::vector<uint64_t> coords(dim_num);
 
-        tile->allocate_hilbert_vector();
+        // Gather the mapped coordinates of the cells in the bitmap and
+        // convert them with a single batched call per tile.
+        std::vector<uint64_t> coords;
+        std::vector<uint64_t> positions;
+        coords.reserve(cell_num * dim_num);
+        positions.reserve(cell_num);
         for (rc.pos_ = 0; rc.pos_ < cell_num; rc.pos_++) {
           // Process only values in bitmap.
           if (!tile->has_bmp() || tile->bitmap()[rc.pos_]) {
-            // Compute Hilbert number for all dimensions first.
             for (uint32_t d = 0; d < dim_num; ++d) {
               auto dim{array_schema_.dimension_ptr(d)};
-              coords[d] = hilbert_order::map_to_uint64(
-                  *dim, rc, d, bits, max_bucket_val);
+              coords.emplace_back(hilbert_order::map_to_uint64(
+                  *dim, rc, d, bits, max_bucket_val));
             }
+            positions.emplace_back(rc.pos_);
+          }
+        }
+
+        std::vector<uint64_t> hilbert_values(positions.size());
+        h.coords_to_hilbert(
+            coords.data(), positions.size(), hilbert_values.data());
+
+        tile->allocate_hilbert_vector();
+        for (uint64_t i = 0; i < positions.size(); ++i) {
+          tile->set_hilbert_value(positions[i], hilbert_values[i]);
+        }
+
+        return Status::Ok();
+      }));
+}
+
+template <class BitmapType>
+void SparseGlobalOrderReader<BitmapType>::compute_global_order_keys(
+    std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("compute_global_order_keys");
 
-            // Now we are ready to get the final number.
-            tile->set_hilbert_value(rc.pos_, h.coords_to_hilbert(&coords[0]));
+  // Parallelize on tiles.
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, result_tiles.size(), [&](uint64_t t) {
+        auto tile =
+            static_cast<GlobalOrderResultTile<BitmapType>*>(result_tiles[t]);
+        auto cell_num =
+            fragment_metadata_[tile->frag_idx()]->cell_num(tile->tile_idx());
+
+        tile->allocate_global_order_keys_vector();
+        for (uint64_t pos = 0; pos < cell_num; pos++) {
+          // Process only values in bitmap.
+          if (!tile->has_bmp() || tile->bitmap()[pos]) {
+            tile->set_global_order_key(
+                pos, global_order_key_.key(*tile, pos));
           }
         }
 
@@ -905,15 +1112,14 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   const bool return_all_dups =
       array_schema_.allows_dups() || consolidation_with_timestamps_;
 
-  // A tile min heap, contains one GlobalOrderResultCoords per fragment.
-  std::vector<GlobalOrderResultCoords<BitmapType>> container;
-  container.reserve(result_tiles.size());
+  // A tournament tree merging one sorted run of GlobalOrderResultCoords per
+  // fragment.
   CompType cmp(
       array_schema_.domain(),
       !array_schema_.allows_dups(),
       true,
       &fragment_metadata_);
-  TileMinHeap<CompType> tile_queue(cmp, std::move(container));
+  TileMinHeap<CompType> tile_queue(result_tiles.size(), cmp);
 
   // If any fragments needs to load more tiles.
   bool need_more_tiles = false;
@@ -951,6 +1157,10 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   // Process all elements.
   bool user_buffers_full = false;
   while (!tile_queue.empty() && !need_more_tiles && num_cells > 0) {
+    // This merge can run for a long time on large fragment counts; bail out
+    // promptly if the query was cancelled.
+    throw_if_cancelled();
+
     auto to_process = tile_queue.top();
     auto tile = to_process.tile_;
     tile_queue.pop();
@@ -1131,6 +1341,57 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   return {user_buffers_full, std::move(result_cell_slabs)};
 };
 
+template <class BitmapType>
+tuple<bool, std::vector<ResultCellSlab>>
+SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs_dispatch(
+    uint64_t num_cells, std::vector<ResultTilesList>& result_tiles) {
+  // See if the domain shape allows a specialized comparator. All dimensions
+  // need to be fixed sized and of the same physical type.
+  auto& domain = array_schema_.domain();
+  const auto dim_num = domain.dim_num();
+  const auto type = domain.dimension_ptr(0)->type();
+  bool specialize = dim_num <= 3;
+  for (unsigned d = 0; specialize && d < dim_num; ++d) {
+    const auto dim{domain.dimension_ptr(d)};
+    specialize = !dim->var_size() && dim->type() == type;
+  }
+
+  if (specialize) {
+    // Datetime and time dimensions are backed by int64 values.
+    if (type == Datatype::INT64 || datatype_is_datetime(type) ||
+        datatype_is_time(type)) {
+      switch (dim_num) {
+        case 1:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<int64_t, 1>>(
+              num_cells, result_tiles);
+        case 2:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<int64_t, 2>>(
+              num_cells, result_tiles);
+        case 3:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<int64_t, 3>>(
+              num_cells, result_tiles);
+      }
+    } else if (type == Datatype::FLOAT64) {
+      switch (dim_num) {
+        case 1:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<double, 1>>(num_cells, result_tiles);
+        case 2:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<double, 2>>(num_cells, result_tiles);
+        case 3:
+          return merge_result_cell_slabs<
+              GlobalCmpReverseSpecialized<double, 3>>(num_cells, result_tiles);
+      }
+    }
+  }
+
+  return merge_result_cell_slabs<GlobalCmpReverse>(num_cells, result_tiles);
+}
+
 template <class BitmapType>
 tuple<uint64_t, uint64_t, uint64_t, bool>
 SparseGlobalOrderReader<BitmapType>::compute_parallelization_parameters(
@@ -1230,12 +1491,14 @@ void SparseGlobalOrderReader<BitmapType>::copy_offsets_tiles(
             var_data_buffer++;
           }
         } else {
-          for (uint64_t c = min_pos; c < max_pos; c++) {
-            *buffer = fill_value_size / offset_div;
-            buffer++;
-            *var_data_buffer = src_var_buff;
-            var_data_buffer++;
-          }
+          // The output cells are all identical, broadcast the fill value
+          // once.
+          const auto num = max_pos - min_pos;
+          std::fill(buffer, buffer + num, fill_value_size / offset_div);
+          std::fill(
+              var_data_buffer,
+              var_data_buffer + num,
+              static_cast<const void*>(src_var_buff));
         }
 
         // Copy nullable values.
@@ -1249,10 +1512,7 @@ void SparseGlobalOrderReader<BitmapType>::copy_offsets_tiles(
             }
           } else {
             uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-            for (uint64_t c = min_pos; c < max_pos; c++) {
-              *val_buffer = v;
-              val_buffer++;
-            }
+            memset(val_buffer, v, max_pos - min_pos);
           }
         }
 
@@ -1403,11 +1663,9 @@ void SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
                 src_buff + min_pos * cell_size,
                 (max_pos - min_pos) * cell_size);
           } else {
-            // Copy tile using the fill value.
-            for (uint64_t i = 0; i < max_pos - min_pos; i++) {
-              memcpy(buffer, src_buff, cell_size);
-              buffer += cell_size;
-            }
+            // Copy tile using the fill value, broadcast once.
+            broadcast_fill_value(
+                buffer, src_buff, cell_size, max_pos - min_pos);
           }
         } else {  // Copy for zipped coords.
           const auto dim_num = rt->domain()->dim_num();
@@ -1427,10 +1685,7 @@ void SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
           } else {
             // Copy the fill value for validity.
             uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-            for (uint64_t i = 0; i < max_pos - min_pos; i++) {
-              *val_buffer = v;
-              val_buffer++;
-            }
+            memset(val_buffer, v, max_pos - min_pos);
           }
         }
 
@@ -1647,6 +1902,9 @@ SparseGlobalOrderReader<BitmapType>::respect_copy_memory_budget(
           return Status::Ok();
         }
 
+        // Resolve the field once, the loop below runs per tile.
+        const auto field = resolve_field(name);
+
         // Get the size for all tiles.
         uint64_t idx = 0;
         for (; idx < max_cs_idx; idx++) {
@@ -1657,7 +1915,7 @@ SparseGlobalOrderReader<BitmapType>::respect_copy_memory_budget(
 
           // Skip this tile if it's aggregate only and we can aggregate it with
           // the fragment metadata only.
-          if (agg_only && can_aggregate_tile_with_frag_md(rcs)) {
+          if (agg_only && can_aggregate_tile_with_frag_md(name, rcs)) {
             continue;
           }
 
@@ -1677,12 +1935,12 @@ SparseGlobalOrderReader<BitmapType>::respect_copy_memory_budget(
             }
 
             // Skip for fields added in schema evolution.
-            if (!fragment_metadata_[f]->array_schema()->is_field(name)) {
+            if (!field.present[f]) {
               continue;
             }
 
             // Size of the tile in memory.
-            auto tile_size = get_attribute_tile_size(name, f, t);
+            auto tile_size = get_attribute_tile_size(field, f, t);
 
             // Account for the pointers to the var data that is created in
             // copy_tiles for var sized attributes.
@@ -1809,7 +2067,8 @@ SparseGlobalOrderReader<BitmapType>::compute_var_size_offsets(
 template <class BitmapType>
 std::vector<ResultTile*>
 SparseGlobalOrderReader<BitmapType>::result_tiles_to_load(
-    std::vector<ResultCellSlab>& result_cell_slabs, bool aggregate_only) {
+    std::vector<ResultCellSlab>& result_cell_slabs,
+    optional<std::string> agg_only_name) {
   std::vector<ResultTile*> result_tiles;
   {
     std::unordered_set<ResultTile*> found_tiles;
@@ -1818,7 +2077,8 @@ SparseGlobalOrderReader<BitmapType>::result_tiles_to_load(
         if (found_tiles.count(rcs.tile_) == 0) {
           found_tiles.emplace(rcs.tile_);
 
-          if (!aggregate_only || !can_aggregate_tile_with_frag_md(rcs))
+          if (agg_only_name == nullopt ||
+              !can_aggregate_tile_with_frag_md(*agg_only_name, rcs))
             result_tiles.emplace_back(rcs.tile_);
         }
       }
@@ -1868,15 +2128,22 @@ void SparseGlobalOrderReader<BitmapType>::process_slabs(
 
   // Read a few attributes a a time.
   std::vector<ResultTile*> result_tiles =
-      result_tiles_to_load(result_cell_slabs, false);
+      result_tiles_to_load(result_cell_slabs, nullopt);
   std::optional<std::string> last_field_to_overflow{std::nullopt};
   uint64_t buffer_idx{0};
   optional<std::vector<ResultTile*>> result_tiles_agg_only;
+  bool result_tiles_agg_only_frag_md{false};
   while (buffer_idx < names.size()) {
     // Generate a list of filtered result tiles for aggregates only fields.
+    // The list depends on whether the field's aggregates can use fragment
+    // metadata, so it is regenerated when that capability changes.
     bool agg_only = aggregate_only(names[buffer_idx]);
-    if (agg_only && result_tiles_agg_only == nullopt) {
-      result_tiles_agg_only = result_tiles_to_load(result_cell_slabs, true);
+    if (agg_only && (result_tiles_agg_only == nullopt ||
+                     result_tiles_agg_only_frag_md !=
+                         aggregates_use_frag_md(names[buffer_idx]))) {
+      result_tiles_agg_only =
+          result_tiles_to_load(result_cell_slabs, names[buffer_idx]);
+      result_tiles_agg_only_frag_md = aggregates_use_frag_md(names[buffer_idx]);
 
       // If we hit an overflow, it might have changed the tiles we need to load.
       // Recompute the memory usage. This is because a tile where we might have
@@ -1930,6 +2197,22 @@ void SparseGlobalOrderReader<BitmapType>::process_slabs(
       if (!is_dim && qc_loaded_attr_names_set_.count(name) == 0 &&
           name != constants::timestamps &&
           name != constants::delete_timestamps) {
+        // Tiles the read state still points to hold cells that did not fit
+        // in the user buffers and will be processed again; stage their
+        // unfiltered data so that it only gets copied instead of read and
+        // unfiltered again. The read state was already updated when the
+        // cell slabs were merged.
+        if (stage_incomplete_tiles_ && user_buffers_full) {
+          const bool var_sized = array_schema_.var_size(name);
+          const bool nullable = array_schema_.is_nullable(name);
+          for (auto rt : result_tiles) {
+            if (read_state_.frag_idx()[rt->frag_idx()].tile_idx_ <=
+                rt->tile_idx()) {
+              stage_unfiltered_tile(name, rt, var_sized, nullable);
+            }
+          }
+        }
+
         clear_tiles(name, result_tiles);
       }
     }
@@ -2051,9 +2334,16 @@ bool SparseGlobalOrderReader<BitmapType>::copy_tiles(
   if (var_sized) {
     *query_buffer.buffer_size_ = total_cells * sizeof(OffType);
 
-    if (offsets_extra_element_)
+    if (offsets_extra_element_) {
       (*query_buffer.buffer_size_) += sizeof(OffType);
 
+      // The offset one past the last cell is the total var size, writing it
+      // here produces the final buffer layout without revisiting it after
+      // the copy.
+      static_cast<OffType*>(query_buffer.buffer_)[total_cells] =
+          (OffType)var_buffer_size;
+    }
+
     *query_buffer.buffer_var_size_ = var_buffer_size * offset_div;
   } else {
     *query_buffer.buffer_size_ = total_cells * cell_size;
@@ -2128,7 +2418,7 @@ void SparseGlobalOrderReader<BitmapType>::process_aggregates(
       [&](uint64_t i, uint64_t range_thread_idx) {
         // For easy reference.
         auto& rcs = result_cell_slabs[i];
-        if (can_aggregate_tile_with_frag_md(result_cell_slabs[i])) {
+        if (can_aggregate_tile_with_frag_md(name, result_cell_slabs[i])) {
           if (range_thread_idx == 0) {
             auto rt = result_cell_slabs[i].tile_;
             auto md = fragment_metadata_[rt->frag_idx()]->get_tile_metadata(
@@ -2181,8 +2471,10 @@ void SparseGlobalOrderReader<BitmapType>::remove_result_tile(
   // Adjust per fragment memory usage.
   memory_used_for_coords_[frag_idx] -= tiles_size;
 
-  // Adjust total memory usage.
-  memory_used_for_coords_total_ -= tiles_size;
+  // Adjust total memory usage. The tiles of condition-only fields were
+  // already released and discounted when the conditions were applied.
+  memory_used_for_coords_total_ -=
+      tiles_size - get_condition_only_tiles_size(frag_idx, tile_idx);
 
   // Delete the tile.
   result_tiles[frag_idx].erase(rt);
@@ -38,6 +38,8 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/misc/tournament_tree.h"
+#include "tiledb/sm/query/global_order_key.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -170,16 +172,24 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Are tile offsets loaded? */
   bool tile_offsets_loaded_;
 
+  /** Have we computed the tiles shadowed by newer fragments? */
+  bool shadowed_tiles_computed_;
+
+  /** Packs per-cell global order keys, when the domain allows it. */
+  GlobalOrderKey global_order_key_;
+
   /* ********************************* */
   /*       PRIVATE DECLARATIONS        */
   /* ********************************* */
 
-  /** Tile min heap. */
+  /**
+   * Tile merge queue, a tournament tree with one sorted run per fragment.
+   * Pops cost a single leaf-to-root replay, which keeps merges over many
+   * fragments off the critical path.
+   */
   template <typename CompType>
-  using TileMinHeap = std::priority_queue<
-      GlobalOrderResultCoords<BitmapType>,
-      std::vector<GlobalOrderResultCoords<BitmapType>>,
-      CompType>;
+  using TileMinHeap =
+      TournamentTree<GlobalOrderResultCoords<BitmapType>, CompType>;
 
   /** Tile list iterator. */
   using TileListIt = typename ResultTilesList::iterator;
@@ -191,6 +201,22 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Load all tile offsets required for the read operation. */
   void load_all_tile_offsets();
 
+  /**
+   * Mark tiles wholly shadowed by newer fragments as ignored, before any of
+   * them is fetched.
+   *
+   * For arrays that do not allow duplicates, a cell version in an older
+   * fragment is superseded by any newer version at the same coordinates. A
+   * tile whose cell count equals the number of coordinates in its MBR
+   * contains every coordinate of that MBR, so an older tile with an MBR
+   * contained in it can produce no results and its coordinates never need to
+   * be read. This only runs for reads where fragment order alone decides
+   * precedence between cell versions: no consolidation with timestamps, no
+   * fragments with timestamps or delete metadata and no delete or update
+   * conditions.
+   */
+  void compute_shadowed_tiles();
+
   /**
    * Get the coordinate tiles size for a dimension.
    *
@@ -329,6 +355,13 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
    */
   void compute_hilbert_values(std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Compute the global order keys of all cells in the passed result tiles.
+   *
+   * @param result_tiles The result tiles.
+   */
+  void compute_global_order_keys(std::vector<ResultTile*>& result_tiles);
+
   /**
    * Update the fragment index to the larger between current one and the one
    * passed in.
@@ -350,6 +383,21 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs(
       uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
 
+  /**
+   * Compute the result cell slabs for global order (non Hilbert) domains,
+   * selecting a comparator specialized for the domain shape when possible.
+   * Domains with up to three fixed sized dimensions, all of the same
+   * integer or floating point type, use a compile time specialized
+   * comparator that avoids per-dimension virtual dispatch in the merge.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   * @param result_tiles Result tiles per fragment.
+   *
+   * @return user_buffers_full, result_cell_slabs.
+   */
+  tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs_dispatch(
+      uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
+
   /**
    * Compute parallelization parameters for a tile copy operation.
    *
@@ -504,11 +552,13 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
    * Get the sorted unique result tile list from the result cell slabs.
    *
    * @param result_cell_slabs Result cell slabs.
-   * @param aggregate_only Are we generating the list for aggregate only fields?
+   * @param agg_only_name Name of the field if we are generating the list for
+   * an aggregate only field, `nullopt` otherwise.
    * @return vector of result tiles.
    */
   std::vector<ResultTile*> result_tiles_to_load(
-      std::vector<ResultCellSlab>& result_cell_slabs, bool aggregate_only);
+      std::vector<ResultCellSlab>& result_cell_slabs,
+      optional<std::string> agg_only_name);
 
   /**
    * Copy cell slabs.
@@ -569,15 +619,24 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
    * Returns wether or not we can aggregate the tile with only the fragment
    * metadata.
    *
+   * @param name Name of the field to process.
    * @param rcs Result cell slab.
    * @return If we can do the aggregation with the frag md or not.
    */
-  inline bool can_aggregate_tile_with_frag_md(ResultCellSlab& rcs) {
+  inline bool can_aggregate_tile_with_frag_md(
+      const std::string& name, ResultCellSlab& rcs) {
+    // Some aggregates, like distinct count, cannot be computed from tile
+    // metadata.
+    if (!aggregates_use_frag_md(name)) {
+      return false;
+    }
+
     auto rt = static_cast<GlobalOrderResultTile<BitmapType>*>(rcs.tile_);
     auto& frag_md = fragment_metadata_[rt->frag_idx()];
 
-    // Here we only aggregate a full tile if first of all there are no missing
-    // cells in the bitmap. This can be validated with 'copy_full_tile'. Second,
+    // Here we only aggregate a full tile if first of all every cell of the
+    // tile is included in the results exactly once. This can be validated
+    // with 'all_cells_selected_once'. Second,
     // we only do it when a full tile is used in the result cell slab structure
     // by making sure that the cell slab starts at 0 and ends at the end of the
     // tile. When we perform the merge to order everything in global order for
@@ -587,7 +646,7 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
     // moment so the best we can do for now is to use fragment metadata only
     // when a full tile was merged in the cell slab structure. Finally, we check
     // the fragment metadata has indeed tile metadata.
-    return rt->copy_full_tile() && rcs.start_ == 0 &&
+    return rt->all_cells_selected_once() && rcs.start_ == 0 &&
            rcs.length_ == rt->cell_num() && frag_md->has_tile_metadata();
   }
 
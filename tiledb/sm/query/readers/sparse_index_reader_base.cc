@@ -46,6 +46,7 @@
 #include "tiledb/sm/query/strategy_base.h"
 #include "tiledb/sm/query/update_value.h"
 #include "tiledb/sm/subarray/subarray.h"
+#include "tiledb/type/apply_with_type.h"
 
 #include <numeric>
 
@@ -74,6 +75,7 @@ SparseIndexReaderBase::SparseIndexReaderBase(
     , memory_budget_(config_, reader_string, params.memory_budget())
     , include_coords_(include_coords)
     , memory_used_for_coords_total_(0)
+    , dim_clauses_cover_condition_(false)
     , deletes_consolidation_no_purge_(
           buffers_.count(constants::delete_timestamps) != 0)
     , partial_tile_offsets_loading_(false) {
@@ -108,6 +110,9 @@ SparseIndexReaderBase::SparseIndexReaderBase(
         "configuration");
   }
 
+  bloom_filter_bits_per_cell_ = config_.get<uint32_t>(
+      "sm.query.bloom_filter_bits_per_cell", Config::must_find);
+
   // Cache information about dimensions.
   const auto dim_num = array_schema_.dim_num();
   dim_names_.reserve(dim_num);
@@ -121,6 +126,14 @@ SparseIndexReaderBase::SparseIndexReaderBase(
   check_validity_buffer_sizes();
 }
 
+SparseIndexReaderBase::~SparseIndexReaderBase() {
+  // Drain any in-flight prefetch reads before the memory that backs them
+  // goes away.
+  if (!prefetch_read_tasks_.empty()) {
+    (void)resources_.io_tp().wait_all_status(prefetch_read_tasks_);
+  }
+}
+
 /* ****************************** */
 /*        PROTECTED METHODS       */
 /* ****************************** */
@@ -380,6 +393,16 @@ Status SparseIndexReaderBase::load_initial_data() {
     }
   }
 
+  // Collect the equality clauses eligible for bloom filter pruning.
+  if (bloom_filter_bits_per_cell_ > 0 && condition_.has_value()) {
+    collect_bloom_eq_values();
+  }
+
+  // Collect the dimension clauses to classify against the tile MBRs.
+  if (condition_.has_value()) {
+    collect_dim_clauses();
+  }
+
   // Calculate ranges of tiles in the subarray, if set.
   if (subarray_.is_set()) {
     // At this point, full memory budget is available.
@@ -402,12 +425,16 @@ Status SparseIndexReaderBase::load_initial_data() {
       return logger_->status(
           Status_ReaderError("Exceeded memory budget for result tile ranges"));
   } else {
+    bool load_rtrees = !dim_clauses_.empty();
     for (const auto& [name, _] : aggregates_) {
       if (array_schema_.is_dim(name)) {
-        subarray_.load_relevant_fragment_rtrees(&resources_.compute_tp());
+        load_rtrees = true;
         break;
       }
     }
+    if (load_rtrees) {
+      subarray_.load_relevant_fragment_rtrees(&resources_.compute_tp());
+    }
   }
 
   // Compute tile offsets to load and var size to load for attributes.
@@ -519,6 +546,35 @@ Status SparseIndexReaderBase::read_and_unfilter_coords(
     const std::vector<ResultTile*>& result_tiles) {
   auto timer_se = stats_->start_timer("read_and_unfilter_coords");
 
+  if (!prefetch_result_tiles_.empty()) {
+    if (prefetch_result_tiles_ == result_tiles) {
+      // The reads for these tiles were already started speculatively; wait
+      // for them and only run the unfilter stage.
+      auto statuses{resources_.io_tp().wait_all_status(prefetch_read_tasks_)};
+      for (const auto& st : statuses) {
+        throw_if_not_ok(st);
+      }
+      prefetch_read_tasks_.clear();
+      prefetch_result_tiles_.clear();
+
+      for (auto& name : coords_load_names()) {
+        RETURN_CANCEL_OR_ERROR(
+            unfilter_tiles(name.name(), name.validity_only(), result_tiles));
+      }
+      prefetch_filtered_data_.clear();
+
+      logger_->debug("Done unfiltering prefetched coords tiles");
+      return Status::Ok();
+    }
+
+    // The prefetched tiles do not match the tiles to process; drain the
+    // reads before dropping the memory that backs them.
+    (void)resources_.io_tp().wait_all_status(prefetch_read_tasks_);
+    prefetch_read_tasks_.clear();
+    prefetch_result_tiles_.clear();
+    prefetch_filtered_data_.clear();
+  }
+
   if (include_coords_) {
     // Read and unfilter zipped coordinate tiles. Note that
     // this will ignore fragments with a version >= 5.
@@ -562,6 +618,60 @@ Status SparseIndexReaderBase::read_and_unfilter_coords(
   return Status::Ok();
 }
 
+std::vector<ReaderBase::NameToLoad> SparseIndexReaderBase::coords_load_names() {
+  std::vector<NameToLoad> names;
+  names.reserve(
+      include_coords_ * (1 + dim_names_.size()) + 2 +
+      deletes_consolidation_no_purge_ + qc_loaded_attr_names_.size());
+
+  if (include_coords_) {
+    // Zipped coordinate tiles (fragments with a version < 5).
+    names.emplace_back(constants::coords);
+
+    // Unzipped coordinate tiles (fragments with a version >= 5).
+    for (auto& name : dim_names_) {
+      names.emplace_back(name);
+    }
+  }
+
+  if (use_timestamps_) {
+    names.emplace_back(constants::timestamps);
+  }
+
+  names.emplace_back(constants::delete_timestamps);
+
+  if (deletes_consolidation_no_purge_) {
+    names.emplace_back(constants::delete_condition_index);
+  }
+
+  for (auto& name : qc_loaded_attr_names_) {
+    names.emplace_back(name);
+  }
+
+  return names;
+}
+
+void SparseIndexReaderBase::start_coords_prefetch(
+    const std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("start_coords_prefetch");
+
+  if (result_tiles.empty()) {
+    return;
+  }
+
+  // Issue the reads for all coordinate fields without waiting on them. The
+  // filtered data blocks are kept alive until the tiles are unfiltered in
+  // `read_and_unfilter_coords`.
+  for (auto& name : coords_load_names()) {
+    prefetch_filtered_data_.splice(
+        prefetch_filtered_data_.end(),
+        read_tiles({name}, result_tiles, prefetch_read_tasks_));
+  }
+
+  prefetch_result_tiles_ = result_tiles;
+  stats_->add_counter("prefetched_tiles", result_tiles.size());
+}
+
 template <class BitmapType>
 void SparseIndexReaderBase::compute_tile_bitmaps(
     std::vector<ResultTile*>& result_tiles) {
@@ -708,6 +818,79 @@ void SparseIndexReaderBase::compute_tile_bitmaps(
   logger_->debug("Done computing tile bitmaps");
 }
 
+void SparseIndexReaderBase::broadcast_fill_value(
+    uint8_t* buffer,
+    const void* value,
+    const uint64_t cell_size,
+    const uint64_t num) {
+  if (num == 0) {
+    return;
+  }
+
+  if (cell_size == 1) {
+    memset(buffer, *static_cast<const uint8_t*>(value), num);
+    return;
+  }
+
+  memcpy(buffer, value, cell_size);
+  uint64_t filled = 1;
+  while (filled < num) {
+    auto to_copy = std::min(filled, num - filled);
+    memcpy(buffer + filled * cell_size, buffer, to_copy * cell_size);
+    filled += to_copy;
+  }
+}
+
+template <class BitmapType>
+shared_ptr<const std::vector<uint8_t>>
+SparseIndexReaderBase::compute_tombstone_mask(
+    ResultTile& rt, FragmentMetadata& frag_meta) {
+  const auto cell_num = rt.cell_num();
+  tdb::pmr::vector<BitmapType> mask_bitmap(
+      cell_num,
+      1,
+      query_memory_tracker_->get_resource(MemoryType::RESULT_TILE_BITMAP));
+
+  bool any_applied = false;
+  for (uint64_t i = 0; i < delete_and_update_conditions_.size(); i++) {
+    if (!frag_meta.has_delete_meta() ||
+        frag_meta.loaded_metadata()->get_processed_conditions_set().count(
+            delete_and_update_conditions_[i].condition_marker()) == 0) {
+      auto delete_timestamp =
+          delete_and_update_conditions_[i].condition_timestamp();
+
+      // Check the delete condition timestamp is after the fragment start.
+      if (delete_timestamp >= frag_meta.timestamp_range().first) {
+        // Apply timestamped condition or regular condition.
+        QueryCondition::Params params(
+            query_memory_tracker_, *(frag_meta.array_schema().get()));
+        if (!frag_meta.has_timestamps() ||
+            delete_timestamp > frag_meta.timestamp_range().second) {
+          throw_if_not_ok(
+              delete_and_update_conditions_[i].apply_sparse<BitmapType>(
+                  params, rt, mask_bitmap));
+        } else {
+          throw_if_not_ok(
+              timestamped_delete_and_update_conditions_[i]
+                  .apply_sparse<BitmapType>(params, rt, mask_bitmap));
+        }
+        any_applied = true;
+      }
+    }
+  }
+
+  // Return an empty mask when no condition applies to this tile
+  auto mask = make_shared<std::vector<uint8_t>>(HERE());
+  if (any_applied) {
+    mask->resize(cell_num);
+    for (uint64_t c = 0; c < cell_num; c++) {
+      (*mask)[c] = mask_bitmap[c] ? 1 : 0;
+    }
+  }
+
+  return mask;
+}
+
 template <class ResultTileType, class BitmapType>
 void SparseIndexReaderBase::apply_query_condition(
     std::vector<ResultTile*>& result_tiles) {
@@ -758,8 +941,13 @@ void SparseIndexReaderBase::apply_query_condition(
             }
           }
 
-          // Compute the result of the query condition for this tile.
-          if (condition_.has_value()) {
+          // Compute the result of the query condition for this tile. Skip
+          // the evaluation when the tile MBR proves that every cell passes
+          // the entire condition.
+          if (condition_.has_value() &&
+              (!dim_clauses_cover_condition_ ||
+               classify_tile_mbr(rt->frag_idx(), rt->tile_idx()) !=
+                   MbrClassification::ALL_PASS)) {
             QueryCondition::Params params(
                 query_memory_tracker_, *(frag_meta->array_schema().get()));
             throw_if_not_ok(condition_->apply_sparse<BitmapType>(
@@ -771,75 +959,395 @@ void SparseIndexReaderBase::apply_query_condition(
 
           // Apply delete conditions.
           if (!delete_and_update_conditions_.empty()) {
-            // Allocate delete condition idx vector if required. This vector
-            // is used to store which delete condition deleted a particular
-            // cell.
             if (deletes_consolidation_no_purge_) {
+              // Allocate the delete condition idx vector. This vector is
+              // used to store which delete condition deleted a particular
+              // cell, so every condition has to be applied separately.
               rt->allocate_per_cell_delete_condition_vector();
-            }
 
-            for (uint64_t i = 0; i < delete_and_update_conditions_.size();
-                 i++) {
-              if (!frag_meta->has_delete_meta() ||
-                  frag_meta->loaded_metadata()
-                          ->get_processed_conditions_set()
-                          .count(delete_and_update_conditions_[i]
-                                     .condition_marker()) == 0) {
-                auto delete_timestamp =
-                    delete_and_update_conditions_[i].condition_timestamp();
-
-                // Check the delete condition timestamp is after the fragment
-                // start.
-                if (delete_timestamp >= frag_meta->timestamp_range().first) {
-                  // Apply timestamped condition or regular condition.
-                  QueryCondition::Params params(
-                      query_memory_tracker_,
-                      *(frag_meta->array_schema().get()));
-                  if (!frag_meta->has_timestamps() ||
-                      delete_timestamp > frag_meta->timestamp_range().second) {
-                    throw_if_not_ok(
-                        delete_and_update_conditions_[i]
-                            .apply_sparse<BitmapType>(
-                                params, *rt, rt->post_dedup_bitmap()));
-                  } else {
-                    throw_if_not_ok(
-                        timestamped_delete_and_update_conditions_[i]
-                            .apply_sparse<BitmapType>(
-                                params, *rt, rt->post_dedup_bitmap()));
-                  }
+              for (uint64_t i = 0; i < delete_and_update_conditions_.size();
+                   i++) {
+                if (!frag_meta->has_delete_meta() ||
+                    frag_meta->loaded_metadata()
+                            ->get_processed_conditions_set()
+                            .count(delete_and_update_conditions_[i]
+                                       .condition_marker()) == 0) {
+                  auto delete_timestamp =
+                      delete_and_update_conditions_[i].condition_timestamp();
+
+                  // Check the delete condition timestamp is after the
+                  // fragment start.
+                  if (delete_timestamp >= frag_meta->timestamp_range().first) {
+                    // Apply timestamped condition or regular condition.
+                    QueryCondition::Params params(
+                        query_memory_tracker_,
+                        *(frag_meta->array_schema().get()));
+                    if (!frag_meta->has_timestamps() ||
+                        delete_timestamp >
+                            frag_meta->timestamp_range().second) {
+                      throw_if_not_ok(
+                          delete_and_update_conditions_[i]
+                              .apply_sparse<BitmapType>(
+                                  params, *rt, rt->post_dedup_bitmap()));
+                    } else {
+                      throw_if_not_ok(
+                          timestamped_delete_and_update_conditions_[i]
+                              .apply_sparse<BitmapType>(
+                                  params, *rt, rt->post_dedup_bitmap()));
+                    }
 
-                  if (deletes_consolidation_no_purge_) {
                     // This is a post processing step during deletes
                     // consolidation to set the delete condition pointer to
                     // the current delete condition if the cells was cleared
                     // by this condition and not any previous conditions.
                     rt->compute_per_cell_delete_condition(
                         &delete_and_update_conditions_[i]);
-                  } else {
-                    // Count cells is dups are allowed as the regular bitmap was
-                    // modified.
-                    if (array_schema_.allows_dups()) {
-                      rt->count_cells();
-                    }
                   }
                 }
               }
+            } else {
+              // The cells cleared by the delete conditions only depend on
+              // the opened array, so the tombstone mask of each tile is
+              // computed once and shared across queries; applying it is a
+              // bitmap multiply instead of re-running the condition trees.
+              auto mask =
+                  array_->tombstone_mask(rt->frag_idx(), rt->tile_idx());
+              if (mask == nullptr) {
+                mask = compute_tombstone_mask<BitmapType>(*rt, *frag_meta);
+                array_->set_tombstone_mask(
+                    rt->frag_idx(), rt->tile_idx(), mask);
+              }
+
+              // An empty mask means no condition applies to this tile.
+              if (!mask->empty()) {
+                auto& bitmap = rt->post_dedup_bitmap();
+                for (uint64_t c = 0; c < mask->size(); c++) {
+                  bitmap[c] *= (*mask)[c];
+                }
+
+                // Count cells if dups are allowed as the regular bitmap was
+                // modified.
+                if (array_schema_.allows_dups()) {
+                  rt->count_cells();
+                }
+              }
             }
           }
 
           return Status::Ok();
         }));
+
+    // Build the bloom filters of the eligible equality clause attributes
+    // while their tiles are resident, before the condition-only tiles are
+    // released below.
+    if (!bloom_eq_values_.empty()) {
+      build_bloom_filters(result_tiles);
+    }
+
+    // The condition bitmaps now hold the result of the conditions, so the
+    // data of fields loaded only for condition evaluation is dead.
+    clear_condition_only_tiles(result_tiles);
   }
 
   logger_->debug("Done applying query condition");
 }
 
+bool SparseIndexReaderBase::condition_only_field(
+    const std::string& name) const {
+  // Dimension tiles might still be needed to merge or copy coordinates and
+  // fields with a user buffer or an aggregate are still to be processed;
+  // only fields with no other use are condition-only.
+  return qc_loaded_attr_names_set_.count(name) != 0 &&
+         !array_schema_.is_dim(name) && buffers_.count(name) == 0 &&
+         aggregates_.count(name) == 0;
+}
+
+uint64_t SparseIndexReaderBase::get_condition_only_tiles_size(
+    const unsigned f, const uint64_t t) {
+  uint64_t tiles_size = 0;
+  for (auto& name : qc_loaded_attr_names_) {
+    if (condition_only_field(name)) {
+      tiles_size += get_attribute_tile_size(name, f, t);
+    }
+  }
+
+  return tiles_size;
+}
+
+void SparseIndexReaderBase::clear_condition_only_tiles(
+    const std::vector<ResultTile*>& result_tiles) {
+  bool any_cleared = false;
+  for (auto& name : qc_loaded_attr_names_) {
+    if (condition_only_field(name)) {
+      clear_tiles(name, result_tiles);
+      any_cleared = true;
+    }
+  }
+
+  // Release the cleared tiles from the total memory budget. The removal of
+  // the result tiles will only discount the remaining fields.
+  if (any_cleared) {
+    for (auto rt : result_tiles) {
+      memory_used_for_coords_total_ -=
+          get_condition_only_tiles_size(rt->frag_idx(), rt->tile_idx());
+    }
+  }
+}
+
+void SparseIndexReaderBase::collect_bloom_eq_values() {
+  // Without duplicates the condition is evaluated after deduplication, so
+  // a tile with no matching cell can still shadow older versions of its
+  // cells in other fragments and cannot be skipped.
+  if (!array_schema_.allows_dups()) {
+    return;
+  }
+
+  // Gather the clauses every result cell must satisfy: the root clause
+  // itself or the direct value children of a top-level AND.
+  std::vector<const ASTNode*> clauses;
+  const auto& ast = condition_->ast();
+  if (!ast->is_expr()) {
+    clauses.emplace_back(ast.get());
+  } else if (ast->get_combination_op() == QueryConditionCombinationOp::AND) {
+    for (auto& child : ast->get_children()) {
+      if (!child->is_expr()) {
+        clauses.emplace_back(child.get());
+      }
+    }
+  }
+
+  for (auto node : clauses) {
+    if (node->get_op() != QueryConditionOp::EQ) {
+      continue;
+    }
+
+    const auto& name = node->get_field_name();
+    if (!array_schema_.is_attr(name)) {
+      continue;
+    }
+
+    // Enumerated attributes are compared against enumeration indexes and
+    // floating point values do not equate byte-wise (-0.0, NaN), so the
+    // byte-hashing filters cannot serve them.
+    const auto attr = array_schema_.attribute(name);
+    if (attr->get_enumeration_name().has_value() ||
+        attr->type() == Datatype::FLOAT32 ||
+        attr->type() == Datatype::FLOAT64) {
+      continue;
+    }
+
+    const auto data = static_cast<const uint8_t*>(node->get_value_ptr());
+    if (data == nullptr) {
+      continue;
+    }
+
+    bloom_eq_values_.emplace_back(
+        name, std::vector<uint8_t>(data, data + node->get_value_size()));
+  }
+}
+
+void SparseIndexReaderBase::build_bloom_filters(
+    const std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("build_bloom_filters");
+
+  for (auto& eq_value : bloom_eq_values_) {
+    const auto& name = eq_value.first;
+    throw_if_not_ok(parallel_for(
+        &resources_.compute_tp(), 0, result_tiles.size(), [&](uint64_t t) {
+          auto rt = result_tiles[t];
+          const auto f = rt->frag_idx();
+          if (array_->bloom_filter(name, f, rt->tile_idx()) != nullptr) {
+            return Status::Ok();
+          }
+
+          // The tile might not be loaded if the attribute was added by
+          // schema evolution after this fragment was written.
+          const auto tile_tuple = rt->tile_tuple(name);
+          if (tile_tuple == nullptr) {
+            return Status::Ok();
+          }
+
+          // Hash all cells, valid or not: extra values can only raise the
+          // false positive rate, never cause a false negative.
+          const auto cell_num = rt->cell_num();
+          auto filter = make_shared<BloomFilter>(
+              HERE(), cell_num, bloom_filter_bits_per_cell_);
+          if (fragment_metadata_[f]->array_schema()->var_size(name)) {
+            const auto& var_tile = tile_tuple->var_tile();
+            const auto offsets = tile_tuple->fixed_tile().data_as<uint64_t>();
+            const auto data = var_tile.data_as<char>();
+            for (uint64_t c = 0; c < cell_num; c++) {
+              const auto end =
+                  c == cell_num - 1 ? var_tile.size() : offsets[c + 1];
+              filter->insert(data + offsets[c], end - offsets[c]);
+            }
+          } else {
+            const auto& tile = tile_tuple->fixed_tile();
+            const auto cell_size = tile.cell_size();
+            const auto data = tile.data_as<char>();
+            for (uint64_t c = 0; c < cell_num; c++) {
+              filter->insert(data + c * cell_size, cell_size);
+            }
+          }
+
+          array_->set_bloom_filter(name, f, rt->tile_idx(), filter);
+          return Status::Ok();
+        }));
+  }
+}
+
+bool SparseIndexReaderBase::bloom_prune_tile(
+    const unsigned f, const uint64_t t) {
+  for (auto& [name, value] : bloom_eq_values_) {
+    auto filter = array_->bloom_filter(name, f, t);
+    if (filter != nullptr &&
+        !filter->maybe_contains(value.data(), value.size())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void SparseIndexReaderBase::collect_dim_clauses() {
+  // Gather the clauses every result cell must satisfy: the root clause
+  // itself or the direct value children of a top-level AND.
+  std::vector<const ASTNode*> clauses;
+  uint64_t num_children = 1;
+  const auto& ast = condition_->ast();
+  if (!ast->is_expr()) {
+    clauses.emplace_back(ast.get());
+  } else if (ast->get_combination_op() == QueryConditionCombinationOp::AND) {
+    num_children = ast->get_children().size();
+    for (auto& child : ast->get_children()) {
+      if (!child->is_expr()) {
+        clauses.emplace_back(child.get());
+      }
+    }
+  }
+
+  for (auto node : clauses) {
+    const auto op = node->get_op();
+    if (op != QueryConditionOp::LT && op != QueryConditionOp::LE &&
+        op != QueryConditionOp::GT && op != QueryConditionOp::GE &&
+        op != QueryConditionOp::EQ && op != QueryConditionOp::NE) {
+      continue;
+    }
+
+    const auto& name = node->get_field_name();
+    if (!array_schema_.is_dim(name)) {
+      continue;
+    }
+
+    // Only fixed-size dimensions of ordered types can be classified
+    // against the MBR ranges.
+    const auto dim_idx = array_schema_.domain().get_dimension_index(name);
+    const auto dim = array_schema_.dimension_ptr(dim_idx);
+    const auto type = dim->type();
+    if (dim->var_size() ||
+        (!datatype_is_integer(type) && !datatype_is_real(type) &&
+         !datatype_is_datetime(type) && !datatype_is_time(type))) {
+      continue;
+    }
+
+    const auto data = static_cast<const uint8_t*>(node->get_value_ptr());
+    if (data == nullptr || node->get_value_size() != dim->coord_size()) {
+      continue;
+    }
+
+    dim_clauses_.push_back(
+        {dim_idx,
+         op,
+         type,
+         std::vector<uint8_t>(data, data + node->get_value_size())});
+  }
+
+  // The clauses cover the whole condition when every direct child is an
+  // eligible dimension clause.
+  dim_clauses_cover_condition_ =
+      !dim_clauses_.empty() && dim_clauses_.size() == num_children;
+}
+
+SparseIndexReaderBase::MbrClassification
+SparseIndexReaderBase::classify_tile_mbr(
+    const unsigned f, const uint64_t t) const {
+  const auto& mbr = fragment_metadata_[f]->mbr(t);
+  bool all_pass = true;
+  for (const auto& clause : dim_clauses_) {
+    const auto& range = mbr[clause.dim_idx];
+    auto result = type::apply_with_type(
+        [&](auto type_value) {
+          using T = decltype(type_value);
+          if constexpr (type::TileDBNumeric<T>) {
+            const auto min = *static_cast<const T*>(range.start_fixed());
+            const auto max = *static_cast<const T*>(range.end_fixed());
+            T value;
+            memcpy(&value, clause.value.data(), sizeof(T));
+            switch (clause.op) {
+              case QueryConditionOp::LT:
+                return max < value  ? MbrClassification::ALL_PASS :
+                       min >= value ? MbrClassification::ALL_FAIL :
+                                      MbrClassification::PARTIAL;
+              case QueryConditionOp::LE:
+                return max <= value ? MbrClassification::ALL_PASS :
+                       min > value  ? MbrClassification::ALL_FAIL :
+                                      MbrClassification::PARTIAL;
+              case QueryConditionOp::GT:
+                return min > value  ? MbrClassification::ALL_PASS :
+                       max <= value ? MbrClassification::ALL_FAIL :
+                                      MbrClassification::PARTIAL;
+              case QueryConditionOp::GE:
+                return min >= value ? MbrClassification::ALL_PASS :
+                       max < value  ? MbrClassification::ALL_FAIL :
+                                      MbrClassification::PARTIAL;
+              case QueryConditionOp::EQ:
+                return min == value && max == value ?
+                           MbrClassification::ALL_PASS :
+                       value < min || value > max ?
+                           MbrClassification::ALL_FAIL :
+                           MbrClassification::PARTIAL;
+              case QueryConditionOp::NE:
+                return value < min || value > max ?
+                           MbrClassification::ALL_PASS :
+                       min == value && max == value ?
+                           MbrClassification::ALL_FAIL :
+                           MbrClassification::PARTIAL;
+              default:
+                return MbrClassification::PARTIAL;
+            }
+          } else {
+            return MbrClassification::PARTIAL;
+          }
+        },
+        clause.type);
+    if (result == MbrClassification::ALL_FAIL) {
+      return MbrClassification::ALL_FAIL;
+    }
+    all_pass &= result == MbrClassification::ALL_PASS;
+  }
+
+  return all_pass ? MbrClassification::ALL_PASS : MbrClassification::PARTIAL;
+}
+
+bool SparseIndexReaderBase::mbr_prune_tile(
+    const unsigned f, const uint64_t t) const {
+  // Without duplicates the condition is evaluated after deduplication, so
+  // a tile with no matching cell can still shadow older versions of its
+  // cells in other fragments and cannot be skipped.
+  if (dim_clauses_.empty() || !array_schema_.allows_dups()) {
+    return false;
+  }
+
+  return classify_tile_mbr(f, t) == MbrClassification::ALL_FAIL;
+}
+
 std::vector<std::string> SparseIndexReaderBase::read_and_unfilter_attributes(
     const std::vector<std::string>& names,
     const std::vector<uint64_t>& mem_usage_per_attr,
     uint64_t* buffer_idx,
     std::vector<ResultTile*>& result_tiles,
-    bool agg_only) {
+    bool agg_only,
+    bool stream_var) {
   auto timer_se = stats_->start_timer("read_and_unfilter_attributes");
   const uint64_t memory_budget = available_memory();
 
@@ -860,9 +1368,14 @@ std::vector<std::string> SparseIndexReaderBase::read_and_unfilter_attributes(
     if (memory_used + attr_mem_usage < memory_budget) {
       memory_used += attr_mem_usage;
 
-      // We only read attributes, so dimensions have 0 cost.
+      // We only read attributes, so dimensions have 0 cost. Fields with
+      // aggregates need all cells and are excluded from streamed reads.
       if (attr_mem_usage != 0) {
-        names_to_read.emplace_back(name, null_count_aggregate_only(name));
+        names_to_read.emplace_back(
+            name,
+            null_count_aggregate_only(name),
+            stream_var && array_schema_.var_size(name) &&
+                aggregates_.count(name) == 0);
       }
 
       names_to_copy.emplace_back(name);
@@ -993,35 +1506,10 @@ void SparseIndexReaderBase::resize_output_buffers(uint64_t cells_copied) {
   }
 }
 
-void SparseIndexReaderBase::add_extra_offset() {
-  for (const auto& it : buffers_) {
-    const auto& name = it.first;
-    if (!array_schema_.var_size(name))
-      continue;
-
-    // Do not apply offset for empty results because we will
-    // write backwards and corrupt memory we don't own.
-    if (*it.second.buffer_size_ == 0)
-      continue;
-
-    auto buffer = static_cast<unsigned char*>(it.second.buffer_);
-    if (offsets_format_mode_ == "bytes") {
-      memcpy(
-          buffer + *it.second.buffer_size_ - offsets_bytesize(),
-          it.second.buffer_var_size_,
-          offsets_bytesize());
-    } else if (offsets_format_mode_ == "elements") {
-      auto elements =
-          *it.second.buffer_var_size_ / datatype_size(array_schema_.type(name));
-      memcpy(
-          buffer + *it.second.buffer_size_ - offsets_bytesize(),
-          &elements,
-          offsets_bytesize());
-    } else {
-      throw std::logic_error(
-          "Cannot add extra offset to buffer; Unsupported offsets format");
-    }
-  }
+void SparseIndexReaderBase::record_read_profile() const {
+  resources_.read_profiles().record_read(
+      array_->array_directory().uri().to_string(),
+      max_coord_tiles_size_.load());
 }
 
 // Explicit template instantiations
@@ -520,6 +520,18 @@ class SparseIndexReaderBase : public ReaderBase {
       ignored_tiles_.emplace(rt.frag_idx(), rt.tile_idx());
     }
 
+    /**
+     * Add a tile that should be ignored by later iterations because it
+     * contains no results, before a result tile was created for it.
+     *
+     * @param f Fragment index.
+     * @param t Tile index.
+     */
+    void add_ignored_tile(unsigned f, uint64_t t) {
+      std::unique_lock<std::mutex> lck(ignored_tiles_mutex_);
+      ignored_tiles_.emplace(f, t);
+    }
+
     /**
      * Returns true if the tile should be ignored.
      *
@@ -573,7 +585,7 @@ class SparseIndexReaderBase : public ReaderBase {
       bool include_coords);
 
   /** Destructor. */
-  ~SparseIndexReaderBase() = default;
+  ~SparseIndexReaderBase();
 
   /* ********************************* */
   /*          PUBLIC METHODS           */
@@ -619,12 +631,55 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Memory used for coordinates tiles. */
   std::atomic<uint64_t> memory_used_for_coords_total_;
 
+  /** Largest coordinate tile footprint seen by this query. */
+  std::atomic<uint64_t> max_coord_tiles_size_{0};
+
   /** Are we in elements mode. */
   bool elements_mode_;
 
   /** Names of dim/attr loaded for query condition. */
   std::vector<std::string> qc_loaded_attr_names_;
 
+  /** Bits per cell for the per-tile bloom filters, 0 disables them. */
+  uint32_t bloom_filter_bits_per_cell_;
+
+  /**
+   * Attribute name and value of each mandatory equality clause of the
+   * query condition that is eligible for bloom filter pruning.
+   */
+  std::vector<std::pair<std::string, std::vector<uint8_t>>> bloom_eq_values_;
+
+  /** Classification of a tile's cells against the dimension clauses. */
+  enum class MbrClassification { ALL_PASS, ALL_FAIL, PARTIAL };
+
+  /** A mandatory condition clause on a fixed-size dimension. */
+  struct DimClause {
+    /** Index of the dimension the clause compares. */
+    unsigned dim_idx;
+
+    /** The comparison operator. */
+    QueryConditionOp op;
+
+    /** The dimension datatype. */
+    Datatype type;
+
+    /** The value compared against. */
+    std::vector<uint8_t> value;
+  };
+
+  /**
+   * The mandatory clauses of the query condition on fixed-size
+   * dimensions, classified per tile against the tile MBRs.
+   */
+  std::vector<DimClause> dim_clauses_;
+
+  /**
+   * `true` if the dimension clauses make up the entire query condition,
+   * in which case a tile where every clause is all-pass needs no
+   * condition evaluation at all.
+   */
+  bool dim_clauses_cover_condition_;
+
   /** Are we doing deletes consolidation (without purge option). */
   bool deletes_consolidation_no_purge_;
 
@@ -640,6 +695,15 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Per fragment tile offsets memory usage. */
   std::vector<uint64_t> per_frag_tile_offsets_usage_;
 
+  /** Filtered data blocks backing the prefetched coordinate reads. */
+  std::list<FilteredData> prefetch_filtered_data_;
+
+  /** In-flight read tasks for the prefetched coordinate tiles. */
+  std::vector<ThreadPool::Task> prefetch_read_tasks_;
+
+  /** Result tiles the in-flight prefetch reads were issued for. */
+  std::vector<ResultTile*> prefetch_result_tiles_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -678,6 +742,12 @@ class SparseIndexReaderBase : public ReaderBase {
   /**
    * Get the coordinate tiles size for a dimension.
    *
+   * The returned size is the exact in-memory footprint of the unfiltered
+   * tiles, computed from the loaded fragment metadata: actual cell counts
+   * for fixed-size fields and recorded var data sizes for var-size fields.
+   * It is not a capacity-based upper bound, so batches planned against the
+   * memory budget with these sizes are as wide as the budget allows.
+   *
    * @param dim_num Number of dimensions.
    * @param f Fragment index.
    * @param t Tile index.
@@ -713,12 +783,35 @@ class SparseIndexReaderBase : public ReaderBase {
   /**
    * Read and unfilter coord tiles.
    *
+   * If a prefetch was started for exactly `result_tiles` with
+   * `start_coords_prefetch`, this waits for the speculative reads and only
+   * runs the unfilter stage.
+   *
    * @param result_tiles The result tiles to process.
    *
    * @return Status.
    */
   Status read_and_unfilter_coords(const std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Computes the fields to load to process coordinates, in the order
+   * `read_and_unfilter_coords` loads them.
+   *
+   * @return Field names to load.
+   */
+  std::vector<NameToLoad> coords_load_names();
+
+  /**
+   * Speculatively start the VFS reads for the coordinate tiles of
+   * `result_tiles` without waiting for them, so that object-store latency
+   * for the next window of result tiles is hidden behind the processing of
+   * the current window. The reads are consumed by a later
+   * `read_and_unfilter_coords` call on the same tiles.
+   *
+   * @param result_tiles The result tiles to prefetch.
+   */
+  void start_coords_prefetch(const std::vector<ResultTile*>& result_tiles);
+
   /**
    * Compute tile bitmaps.
    *
@@ -735,6 +828,133 @@ class SparseIndexReaderBase : public ReaderBase {
   template <class ResultTileType, class BitmapType>
   void apply_query_condition(std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Returns `true` if a field is loaded for the query or delete conditions
+   * only: it is not a dimension and has no user buffer and no aggregate, so
+   * its tiles can be released as soon as the conditions are evaluated.
+   *
+   * @param name Name of the field.
+   * @return `true` for condition-only fields.
+   */
+  bool condition_only_field(const std::string& name) const;
+
+  /**
+   * Returns the memory size of the condition-only field tiles for a
+   * fragment/tile pair, as accounted in `get_coord_tiles_size`.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return Tiles size.
+   */
+  uint64_t get_condition_only_tiles_size(unsigned f, uint64_t t);
+
+  /**
+   * Clears the tiles of condition-only fields and releases their memory
+   * from the total memory budget. Their data is dead once the condition
+   * bitmaps are computed, so the tiles are released eagerly instead of
+   * staying resident for the lifetime of the result tiles.
+   *
+   * @param result_tiles Result tiles the condition was applied to.
+   */
+  void clear_condition_only_tiles(const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Collects the mandatory equality clauses of the query condition that
+   * are eligible for bloom filter pruning: `attr == value` clauses that
+   * are either the whole condition or direct children of a top-level AND,
+   * on non-enumerated, non-floating-point attributes. Only arrays that
+   * allow duplicates are eligible: without duplicates a tile with no
+   * matching cell can still shadow cells of other fragments during
+   * deduplication. Called once from `load_initial_data` when the filters
+   * are enabled.
+   */
+  void collect_bloom_eq_values();
+
+  /**
+   * Builds and caches on the opened array the bloom filters of the
+   * eligible equality clause attributes for tiles that do not have one
+   * yet. Called while the condition field tiles are resident, so the
+   * filters come for free from data already in memory.
+   *
+   * @param result_tiles Result tiles to process.
+   */
+  void build_bloom_filters(const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Returns `true` if the cached bloom filters prove that a mandatory
+   * equality clause of the query condition matches no cell of the tile,
+   * in which case the tile can be skipped without being read.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return `true` if the tile cannot contribute any result.
+   */
+  bool bloom_prune_tile(unsigned f, uint64_t t);
+
+  /**
+   * Collects the mandatory clauses of the query condition that compare a
+   * fixed-size dimension to a value: clauses that are either the whole
+   * condition or direct value children of a top-level AND. These clauses
+   * are classified per tile against the tile MBRs in the fragment
+   * metadata, before the coordinate tiles are fetched. Called once from
+   * `load_initial_data` when a condition is set.
+   */
+  void collect_dim_clauses();
+
+  /**
+   * Classifies a tile against the collected dimension clauses using its
+   * MBR: `ALL_FAIL` if some clause cannot be satisfied by any coordinate
+   * in the MBR, `ALL_PASS` if every coordinate in the MBR satisfies every
+   * clause and `PARTIAL` otherwise.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return The classification.
+   */
+  MbrClassification classify_tile_mbr(unsigned f, uint64_t t) const;
+
+  /**
+   * Returns `true` if the tile MBR proves that a mandatory dimension
+   * clause of the query condition matches no cell of the tile, in which
+   * case the tile can be skipped without being read. Only arrays that
+   * allow duplicates are eligible: without duplicates a tile with no
+   * matching cell can still shadow cells of other fragments during
+   * deduplication.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return `true` if the tile cannot contribute any result.
+   */
+  bool mbr_prune_tile(unsigned f, uint64_t t) const;
+
+  /**
+   * Computes the tombstone mask of a tile: the cells cleared by the
+   * delete conditions of the opened array. An empty mask is returned when
+   * no condition applies to the tile. The mask is cached on the opened
+   * array and reused by concurrent and subsequent queries.
+   *
+   * @param rt Result tile to process.
+   * @param frag_meta Fragment metadata of the tile's fragment.
+   * @return Tombstone mask, one byte per cell.
+   */
+  template <class BitmapType>
+  shared_ptr<const std::vector<uint8_t>> compute_tombstone_mask(
+      ResultTile& rt, FragmentMetadata& frag_meta);
+
+  /**
+   * Fills `num` contiguous cells of `buffer` with a constant cell value.
+   * The value is written once and then broadcast with doubling memcpys
+   * instead of being written cell by cell. Used for attributes added by
+   * schema evolution that are missing from older fragments.
+   *
+   * @param buffer Destination buffer.
+   * @param value Cell value to broadcast.
+   * @param cell_size Size of the cell value, in bytes.
+   * @param num Number of cells to fill.
+   */
+  static void broadcast_fill_value(
+      uint8_t* buffer, const void* value, uint64_t cell_size, uint64_t num);
+
   /**
    * Read and unfilter as many attributes as can fit in the memory budget and
    * return the names loaded in 'names_to_copy'. Also keep the 'buffer_idx'
@@ -745,6 +965,8 @@ class SparseIndexReaderBase : public ReaderBase {
    * @param buffer_idx Stores/return the current buffer index in process.
    * @param result_tiles Result tiles to process.
    * @param agg_only Are we loading for aggregates only field.
+   * @param stream_var Should eligible var tiles be loaded with streamed
+   * partial reads.
    *
    * @return names_to_copy.
    */
@@ -753,7 +975,8 @@ class SparseIndexReaderBase : public ReaderBase {
       const std::vector<uint64_t>& mem_usage_per_attr,
       uint64_t* buffer_idx,
       std::vector<ResultTile*>& result_tiles,
-      bool agg_only);
+      bool agg_only,
+      bool stream_var = false);
 
   /**
    * Get the field names to process.
@@ -780,10 +1003,23 @@ class SparseIndexReaderBase : public ReaderBase {
   void resize_output_buffers(uint64_t cells_copied);
 
   /**
-   * Adds an extra offset in the end of the offsets buffer indicating the
-   * returned data size if an attribute is var-sized.
+   * Track the footprint of a coordinate tile considered for loading, so the
+   * largest one can be recorded in the array's read profile.
+   *
+   * @param tiles_size Coordinate tiles size.
+   */
+  inline void observe_coord_tiles_size(uint64_t tiles_size) {
+    auto prev = max_coord_tiles_size_.load();
+    while (prev < tiles_size &&
+           !max_coord_tiles_size_.compare_exchange_weak(prev, tiles_size)) {
+    }
+  }
+
+  /**
+   * Record the execution feedback of this query in the array's read
+   * profile, to inform parameter choices of subsequent queries.
    */
-  void add_extra_offset();
+  void record_read_profile() const;
 };
 
 }  // namespace tiledb::sm
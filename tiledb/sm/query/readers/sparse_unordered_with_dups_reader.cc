@@ -67,6 +67,7 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
     stats::Stats* stats, shared_ptr<Logger> logger, StrategyParams& params)
     : SparseIndexReaderBase(
           "sparse_unordered_with_dups", stats, logger, params, false)
+    , create_tile_cursor_(array_->fragment_metadata().size())
     , tile_offsets_min_frag_idx_(std::numeric_limits<unsigned>::max())
     , tile_offsets_max_frag_idx_(0) {
   // Initialize memory budget variables.
@@ -93,7 +94,7 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
 template <class BitmapType>
 bool SparseUnorderedWithDupsReader<BitmapType>::incomplete() const {
   return !read_state_.done_adding_result_tiles() ||
-         !result_tiles_leftover_.empty();
+         !result_tiles_leftover_.empty() || !prefetched_tiles_.empty();
 }
 
 template <class BitmapType>
@@ -115,6 +116,11 @@ SparseUnorderedWithDupsReader<BitmapType>::status_incomplete_reason() const {
 template <class BitmapType>
 void SparseUnorderedWithDupsReader<BitmapType>::refresh_config() {
   memory_budget_.refresh_config(config_, "sparse_unordered_with_dups");
+  prefetch_tile_count_ = config_.get<uint64_t>(
+      "sm.query.sparse_unordered_with_dups.prefetch_tile_count",
+      Config::must_find);
+  deduplicate_ = config_.get<bool>(
+      "sm.query.sparse_unordered_with_dups.dedup", Config::must_find);
 }
 
 template <class BitmapType>
@@ -147,9 +153,10 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
     return Status::Ok();
   }
 
-  // Subarray is not known to be explicitly set until buffers are deserialized
+  // Subarray is not known to be explicitly set until buffers are deserialized.
+  // Coordinates are also required when deduplicating, to hash them.
   subarray_.reset_default_ranges();
-  include_coords_ = subarray_.is_set();
+  include_coords_ = subarray_.is_set() || deduplicate_;
 
   // Load initial data, if not loaded already. Coords are only included if the
   // subarray is set.
@@ -168,9 +175,14 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
     ResultTilesList result_tiles;
     std::vector<ResultTile*> result_tiles_ptr;
     if (result_tiles_leftover_.size() == 0) {
-      // Create the result tiles we are going to process or use the ones from a
-      // previous iteration.
-      result_tiles = create_result_tiles();
+      // Create the result tiles we are going to process, or use the ones the
+      // prefetcher created or the ones from a previous iteration.
+      if (!prefetched_tiles_.empty()) {
+        result_tiles = std::move(prefetched_tiles_);
+        prefetched_tiles_.clear();
+      } else {
+        result_tiles = create_result_tiles();
+      }
 
       // No more tiles to process, done.
       if (result_tiles.empty()) {
@@ -193,6 +205,11 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
           UnorderedWithDupsResultTile<BitmapType>,
           BitmapType>(result_tiles_ptr);
 
+      // Clear duplicate coordinates from the bitmaps, if requested.
+      if (deduplicate_) {
+        dedup_result_tiles(result_tiles_ptr);
+      }
+
       clean_tile_list(result_tiles, result_tiles_ptr);
 
       // No more tiles to process, continue.
@@ -208,6 +225,10 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
       }
     }
 
+    // Speculatively start the reads for the next window of result tiles
+    // while the current window is copied.
+    prefetch_next_window();
+
     // Copy tiles.
     if (offsets_bitsize_ == 64) {
       user_buffers_full = process_tiles<uint64_t>(names, result_tiles_ptr);
@@ -224,12 +245,11 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
   stats_->add_counter("result_num", cells);
   resize_output_buffers(cells);
 
-  if (offsets_extra_element_) {
-    add_extra_offset();
-  }
-
   stats_->add_counter("ignored_tiles", tmp_read_state_.num_ignored_tiles());
 
+  // Record execution feedback for subsequent queries on this array.
+  record_read_profile();
+
   return Status::Ok();
 }
 
@@ -359,11 +379,24 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
     const uint64_t t,
     const uint64_t last_t,
     const FragmentMetadata& frag_md,
-    ResultTilesList& result_tiles) {
+    ResultTilesList& result_tiles,
+    const bool allow_empty) {
   if (tmp_read_state_.is_ignored_tile(f, t)) {
     return false;
   }
 
+  // Skip tiles the cached bloom filters prove cannot satisfy a mandatory
+  // equality clause of the query condition.
+  if (bloom_prune_tile(f, t)) {
+    return false;
+  }
+
+  // Skip tiles whose MBR proves a mandatory dimension clause of the query
+  // condition matches no cell.
+  if (mbr_prune_tile(f, t)) {
+    return false;
+  }
+
   // Use either the coordinate portion of the total budget or the tile upper
   // memory limit as the upper memory limit, whichever is smaller.
   const uint64_t upper_memory_limit = std::min<uint64_t>(
@@ -372,6 +405,7 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
 
   // Calculate memory consumption for this tile.
   auto tiles_size = get_coord_tiles_size(dim_num, f, t);
+  observe_coord_tiles_size(tiles_size);
 
   // Don't load more tiles than the memory budget.
   if (memory_used_for_coords_total_ + tiles_size > upper_memory_limit) {
@@ -385,7 +419,7 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
           t);
 
       // Make sure we can add at least one tile.
-      if (result_tiles.empty()) {
+      if (result_tiles.empty() && !allow_empty) {
         throw SparseUnorderedWithDupsReaderException(
             "Cannot load a single tile, increase memory budget");
       }
@@ -410,7 +444,8 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
 
 template <class BitmapType>
 std::list<UnorderedWithDupsResultTile<BitmapType>>
-SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
+SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles(
+    uint64_t max_tiles, bool allow_empty) {
   auto timer_se = stats_->start_timer("create_result_tiles");
 
   ResultTilesList result_tiles;
@@ -437,12 +472,23 @@ SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
           // Add all tiles for this range.
           for (uint64_t t = range.first; t <= range.second; t++) {
             budget_exceeded = add_result_tile(
-                dim_num, f, t, last_t, *fragment_metadata_[f], result_tiles);
+                dim_num,
+                f,
+                t,
+                last_t,
+                *fragment_metadata_[f],
+                result_tiles,
+                allow_empty);
             if (budget_exceeded) {
               break;
             }
 
             range.first++;
+
+            if (result_tiles.size() >= max_tiles) {
+              budget_exceeded = true;
+              break;
+            }
           }
 
           if (budget_exceeded) {
@@ -463,8 +509,11 @@ SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
       if (!tmp_read_state_.all_tiles_loaded(f)) {
         auto tile_num = fragment_metadata_[f]->tile_num();
 
-        // Figure out the start index.
-        auto start = read_state_.frag_idx()[f].tile_idx_;
+        // Figure out the start index. The creation cursor is ahead of the
+        // read state when tiles were created by the prefetcher before the
+        // current window was fully processed.
+        auto start = std::max(
+            read_state_.frag_idx()[f].tile_idx_, create_tile_cursor_[f]);
 
         // Add all tiles for this fragment.
         if (start == tile_num) {
@@ -478,10 +527,18 @@ SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
               t,
               tile_num - 1,
               *fragment_metadata_[f],
-              result_tiles);
+              result_tiles,
+              allow_empty);
           if (budget_exceeded) {
             break;
           }
+
+          create_tile_cursor_[f] = t + 1;
+
+          if (result_tiles.size() >= max_tiles) {
+            budget_exceeded = true;
+            break;
+          }
         }
       }
       f++;
@@ -503,6 +560,27 @@ SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
   return result_tiles;
 }
 
+template <class BitmapType>
+void SparseUnorderedWithDupsReader<BitmapType>::prefetch_next_window() {
+  if (prefetch_tile_count_ == 0 || !prefetched_tiles_.empty() ||
+      read_state_.done_adding_result_tiles()) {
+    return;
+  }
+
+  prefetched_tiles_ = create_result_tiles(prefetch_tile_count_, true);
+  if (prefetched_tiles_.empty()) {
+    return;
+  }
+
+  std::vector<ResultTile*> prefetched_tiles_ptr;
+  prefetched_tiles_ptr.reserve(prefetched_tiles_.size());
+  for (auto& result_tile : prefetched_tiles_) {
+    prefetched_tiles_ptr.emplace_back(&result_tile);
+  }
+
+  start_coords_prefetch(prefetched_tiles_ptr);
+}
+
 template <class BitmapType>
 void SparseUnorderedWithDupsReader<BitmapType>::clean_tile_list(
     ResultTilesList& result_tiles, std::vector<ResultTile*>& result_tiles_ptr) {
@@ -529,6 +607,174 @@ void SparseUnorderedWithDupsReader<BitmapType>::clean_tile_list(
   }
 }
 
+template <class BitmapType>
+std::vector<std::pair<uint64_t, uint64_t>>
+SparseUnorderedWithDupsReader<BitmapType>::compute_coord_hashes(
+    UnorderedWithDupsResultTile<BitmapType>* rt) {
+  auto dim_num = array_schema_.dim_num();
+  auto cell_num = rt->cell_num();
+
+  // Cache which dimensions are var sized and the fixed coordinate sizes.
+  std::vector<bool> var_sized(dim_num);
+  std::vector<uint64_t> coord_sizes(dim_num);
+  for (unsigned d = 0; d < dim_num; d++) {
+    var_sized[d] = array_schema_.dimension_ptr(d)->var_size();
+    coord_sizes[d] = var_sized[d] ? 0 : rt->coord_size(d);
+  }
+
+  // Compute, for every cell, two independent 64 bit FNV-1a hashes of the
+  // coordinate bytes. Var sized coordinates also hash their length so that
+  // concatenations of adjacent coordinates cannot collide.
+  std::vector<std::pair<uint64_t, uint64_t>> hashes(cell_num);
+  for (uint64_t pos = 0; pos < cell_num; pos++) {
+    uint64_t h1 = 0xcbf29ce484222325;
+    uint64_t h2 = 0x84222325cbf29ce4;
+    auto hash_bytes = [&](const void* data, uint64_t size) {
+      auto bytes = static_cast<const uint8_t*>(data);
+      for (uint64_t b = 0; b < size; b++) {
+        h1 = (h1 ^ bytes[b]) * 0x100000001b3;
+        h2 = (h2 ^ bytes[b]) * 0x100000001b3;
+      }
+    };
+
+    for (unsigned d = 0; d < dim_num; d++) {
+      if (var_sized[d]) {
+        auto coord = rt->coord_string(pos, d);
+        uint64_t size = coord.size();
+        hash_bytes(&size, sizeof(size));
+        hash_bytes(coord.data(), size);
+      } else {
+        hash_bytes(rt->coord(pos, d), coord_sizes[d]);
+      }
+    }
+
+    hashes[pos] = {h1, h2};
+  }
+
+  return hashes;
+}
+
+template <class BitmapType>
+void SparseUnorderedWithDupsReader<BitmapType>::dedup_result_tiles(
+    std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("dedup_result_tiles");
+
+  // Size the hash partitions on the first iteration only, the seen sets
+  // persist afterwards to catch duplicates spanning iterations.
+  if (dedup_seen_.empty()) {
+    dedup_seen_.resize(
+        std::max<size_t>(1, resources_.compute_tp().concurrency_level()));
+  }
+  const uint64_t num_partitions = dedup_seen_.size();
+
+  // Hash the coordinates of all tiles, allocating the bitmaps that
+  // duplicates will be cleared in if the tiles don't have one yet.
+  std::vector<std::vector<std::pair<uint64_t, uint64_t>>> hashes(
+      result_tiles.size());
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, result_tiles.size(), [&](uint64_t t) {
+        auto rt = static_cast<UnorderedWithDupsResultTile<BitmapType>*>(
+            result_tiles[t]);
+        if (!rt->has_bmp()) {
+          rt->alloc_bitmap();
+        }
+        hashes[t] = compute_coord_hashes(rt);
+        return Status::Ok();
+      }));
+
+  // Walk the tiles from the most recent fragment to the oldest so that the
+  // kept occurrence of a duplicate coordinate is the most recently written
+  // one. Each thread owns a disjoint partition of the hash space, so the
+  // bitmaps can be updated without synchronization.
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, num_partitions, [&](uint64_t p) {
+        auto& seen = dedup_seen_[p];
+        for (uint64_t t = result_tiles.size(); t > 0; t--) {
+          auto rt = static_cast<UnorderedWithDupsResultTile<BitmapType>*>(
+              result_tiles[t - 1]);
+          auto cell_num = rt->cell_num();
+          for (uint64_t pos = 0; pos < cell_num; pos++) {
+            const auto& hash = hashes[t - 1][pos];
+            if (hash.first % num_partitions != p || rt->bitmap()[pos] == 0) {
+              continue;
+            }
+
+            // Collapse the kept occurrence to a single result so that
+            // duplicates introduced by overlapping ranges are eliminated
+            // as well.
+            rt->bitmap()[pos] = seen.emplace(hash).second ? 1 : 0;
+          }
+        }
+        return Status::Ok();
+      }));
+
+  // Recount the results and compute the number of eliminated cells.
+  uint64_t cells_deduped = 0;
+  for (auto result_tile : result_tiles) {
+    auto rt =
+        static_cast<UnorderedWithDupsResultTile<BitmapType>*>(result_tile);
+    const auto result_num = rt->result_num();
+    rt->count_cells();
+    cells_deduped += result_num - rt->result_num();
+  }
+  stats_->add_counter("cells_deduped", cells_deduped);
+}
+
+template <class BitmapType>
+void SparseUnorderedWithDupsReader<BitmapType>::read_streamed_var_tiles(
+    const std::vector<std::string>& names,
+    std::vector<ResultTile*>& result_tiles) {
+  if (streamed_var_read_min_tile_size_ == 0) {
+    return;
+  }
+
+  auto timer_se = stats_->start_timer("read_streamed_var_tiles");
+  std::vector<ThreadPool::Task> read_tasks;
+  for (auto& name : names) {
+    if (!array_schema_.var_size(name)) {
+      continue;
+    }
+
+    for (auto result_tile : result_tiles) {
+      auto rt =
+          static_cast<UnorderedWithDupsResultTile<BitmapType>*>(result_tile);
+      auto tile_tuple = rt->tile_tuple(name);
+      if (tile_tuple == nullptr || !tile_tuple->var_tile().streamed()) {
+        continue;
+      }
+
+      // Compute the selected cell ranges from the tile bitmap.
+      const auto cell_num = rt->cell_num();
+      std::vector<std::pair<uint64_t, uint64_t>> cell_ranges;
+      if (!rt->has_bmp()) {
+        cell_ranges.emplace_back(0, cell_num);
+      } else {
+        uint64_t pos = 0;
+        while (pos < cell_num) {
+          if (rt->bitmap()[pos] == 0) {
+            pos++;
+            continue;
+          }
+
+          const uint64_t start = pos;
+          while (pos < cell_num && rt->bitmap()[pos] != 0) {
+            pos++;
+          }
+          cell_ranges.emplace_back(start, pos);
+        }
+      }
+
+      read_streamed_var_tile(name, rt, cell_ranges, read_tasks);
+    }
+  }
+
+  // Wait for the read tasks to finish.
+  auto statuses{resources_.io_tp().wait_all_status(read_tasks)};
+  for (const auto& st : statuses) {
+    throw_if_not_ok(st);
+  }
+}
+
 template <class BitmapType>
 tuple<bool, uint64_t, uint64_t, uint64_t>
 SparseUnorderedWithDupsReader<BitmapType>::compute_parallelization_parameters(
@@ -609,14 +855,10 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_offsets_tile(
       }
     }
   } else {
-    for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-      for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-        *buffer = fill_value_size / offset_div;
-        buffer++;
-        *var_data = src_var_buff;
-        var_data++;
-      }
-    }
+    // The output cells are all identical, broadcast the fill value once.
+    const auto num = rt->result_num_between_pos(src_min_pos, src_max_pos);
+    std::fill(buffer, buffer + num, fill_value_size / offset_div);
+    std::fill(var_data, var_data + num, static_cast<const void*>(src_var_buff));
   }
 
   // Copy nullable values.
@@ -632,12 +874,8 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_offsets_tile(
       }
     } else {
       uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          *val_buffer = v;
-          val_buffer++;
-        }
-      }
+      memset(
+          val_buffer, v, rt->result_num_between_pos(src_min_pos, src_max_pos));
     }
   }
 }
@@ -689,14 +927,11 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_offsets_tile(
         }
       }
     } else {
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        if (!rt->has_bmp() || rt->bitmap()[c]) {
-          *buffer = fill_value_size / offset_div;
-          buffer++;
-          *var_data = src_var_buff;
-          var_data++;
-        }
-      }
+      // The output cells are all identical, broadcast the fill value once.
+      const auto num = rt->result_num_between_pos(src_min_pos, src_max_pos);
+      std::fill(buffer, buffer + num, fill_value_size / offset_div);
+      std::fill(
+          var_data, var_data + num, static_cast<const void*>(src_var_buff));
     }
 
     // Copy nullable values.
@@ -712,12 +947,10 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_offsets_tile(
         }
       } else {
         uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-        for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          if (rt->bitmap()[c]) {
-            *val_buffer = v;
-            val_buffer++;
-          }
-        }
+        memset(
+            val_buffer,
+            v,
+            rt->result_num_between_pos(src_min_pos, src_max_pos));
       }
     }
   } else {
@@ -944,12 +1177,9 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_fixed_data_tile(
         }
       }
     } else {
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          memcpy(buffer, src_buff, cell_size);
-          buffer += cell_size;
-        }
-      }
+      // The output cells are all identical, broadcast the fill value once.
+      const auto num = rt->result_num_between_pos(src_min_pos, src_max_pos);
+      broadcast_fill_value(buffer, src_buff, cell_size, num);
     }
   } else {  // Copy for zipped coords.
     const auto dim_num = rt->domain()->dim_num();
@@ -975,12 +1205,8 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_fixed_data_tile(
       }
     } else {
       uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          *val_buffer = v;
-          val_buffer++;
-        }
-      }
+      memset(
+          val_buffer, v, rt->result_num_between_pos(src_min_pos, src_max_pos));
     }
   }
 }
@@ -1044,12 +1270,9 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_fixed_data_tile(
           buffer += length * cell_size;
         }
       } else {
-        for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          if (!rt->has_bmp() || rt->bitmap()[c]) {
-            memcpy(buffer, src_buff, cell_size);
-            buffer += cell_size;
-          }
-        }
+        // The output cells are all identical, broadcast the fill value once.
+        const auto num = rt->result_num_between_pos(src_min_pos, src_max_pos);
+        broadcast_fill_value(buffer, src_buff, cell_size, num);
       }
     } else {  // Copy for zipped coords.
       const auto dim_num = rt->domain()->dim_num();
@@ -1092,12 +1315,10 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_fixed_data_tile(
         }
       } else {
         uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-        for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-            *val_buffer = v;
-            val_buffer++;
-          }
-        }
+        memset(
+            val_buffer,
+            v,
+            rt->result_num_between_pos(src_min_pos, src_max_pos));
       }
     }
   } else {  // Copy full tile.
@@ -1459,6 +1680,9 @@ SparseUnorderedWithDupsReader<BitmapType>::respect_copy_memory_budget(
           return Status::Ok();
         }
 
+        // Resolve the field once, the loop below runs per tile.
+        const auto field = resolve_field(name);
+
         // Get the size for all tiles.
         uint64_t idx = 0;
         for (; idx < max_rt_idx; idx++) {
@@ -1468,18 +1692,17 @@ SparseUnorderedWithDupsReader<BitmapType>::respect_copy_memory_budget(
 
           // Skip this tile if it's aggregate only and we can aggregate it with
           // the fragment metadata only.
-          if (agg_only && can_aggregate_tile_with_frag_md(rt)) {
+          if (agg_only && can_aggregate_tile_with_frag_md(name, rt)) {
             continue;
           }
 
           // Skip for fields added in schema evolution.
-          if (!fragment_metadata_[rt->frag_idx()]->array_schema()->is_field(
-                  name)) {
+          if (!field.present[rt->frag_idx()]) {
             continue;
           }
 
           auto tile_size =
-              get_attribute_tile_size(name, rt->frag_idx(), rt->tile_idx());
+              get_attribute_tile_size(field, rt->frag_idx(), rt->tile_idx());
 
           // Account for the pointers to the var data that is created in
           // copy_tiles for var sized attributes.
@@ -1626,17 +1849,42 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
     num_range_threads = 1 + ((num_threads - 1) / result_tiles.size());
   }
 
+  // Returns true if the last result tile will only be partially copied, in
+  // which case the next iteration processes it again. Evaluated at clear
+  // time as var size overflows can shrink the cell offsets and the result
+  // tiles while fields are processed.
+  auto last_tile_partial = [&]() {
+    auto last_tile =
+        (UnorderedWithDupsResultTile<BitmapType>*)result_tiles.back();
+    auto& frag_tile_idx = read_state_.frag_idx()[last_tile->frag_idx()];
+    uint64_t cells_copied = cell_offsets[result_tiles.size()] -
+                            cell_offsets[result_tiles.size() - 1];
+    if (frag_tile_idx.tile_idx_ == last_tile->tile_idx()) {
+      cells_copied +=
+          last_tile->result_num_between_pos(0, frag_tile_idx.cell_idx_);
+    }
+
+    return last_tile->result_num() != cells_copied;
+  };
+
   // Read a few attributes at a time.
   std::optional<std::string> last_field_to_overflow{std::nullopt};
   uint64_t buffer_idx{0};
   optional<std::vector<ResultTile*>> result_tiles_agg_only;
+  bool result_tiles_agg_only_frag_md{false};
   while (buffer_idx < names.size()) {
     // Generate a list of filtered result tiles for aggregates only fields.
+    // The list depends on whether the field's aggregates can use fragment
+    // metadata, so it is regenerated when that capability changes.
     bool agg_only = aggregate_only(names[buffer_idx]);
-    if (agg_only && result_tiles_agg_only == nullopt) {
+    if (agg_only && (result_tiles_agg_only == nullopt ||
+                     result_tiles_agg_only_frag_md !=
+                         aggregates_use_frag_md(names[buffer_idx]))) {
       result_tiles_agg_only = std::vector<ResultTile*>();
+      result_tiles_agg_only_frag_md = aggregates_use_frag_md(names[buffer_idx]);
       for (auto& rt : result_tiles) {
         if (!can_aggregate_tile_with_frag_md(
+                names[buffer_idx],
                 static_cast<UnorderedWithDupsResultTile<BitmapType>*>(rt))) {
           result_tiles_agg_only->emplace_back(rt);
         }
@@ -1649,7 +1897,13 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
         mem_usage_per_attr,
         &buffer_idx,
         agg_only ? *result_tiles_agg_only : result_tiles,
-        agg_only);
+        agg_only,
+        streamed_var_read_min_tile_size_ > 0);
+
+    // Fill the var tiles loaded with streamed partial reads, now that their
+    // offsets are unfiltered.
+    read_streamed_var_tiles(
+        names_to_copy, agg_only ? *result_tiles_agg_only : result_tiles);
 
     // Process one field at a time for buffers in memory.
     for (const auto& name : names_to_copy) {
@@ -1677,6 +1931,14 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
       if (qc_loaded_attr_names_set_.count(name) == 0 &&
           (!include_coords_ || !is_dim) && name != constants::timestamps &&
           name != constants::delete_timestamps) {
+        // A partially copied last tile is processed again by the next
+        // iteration; stage its unfiltered data so that it is copied without
+        // being read and unfiltered again.
+        if (stage_incomplete_tiles_ && !result_tiles.empty() &&
+            last_tile_partial()) {
+          stage_unfiltered_tiles(name, result_tiles, result_tiles.size() - 1);
+        }
+
         clear_tiles(name, result_tiles);
       }
     }
@@ -1823,6 +2085,14 @@ bool SparseUnorderedWithDupsReader<BitmapType>::copy_tiles(
       const auto is_dim_to_clear = array_schema_.is_dim(name_to_clear);
       if (qc_loaded_attr_names_set_.count(name_to_clear) == 0 &&
           (!include_coords_ || !is_dim_to_clear)) {
+        // Tiles that did not fit will be processed again by the next
+        // iteration; stage their unfiltered data so that it only gets
+        // copied instead of read and unfiltered again.
+        if (stage_incomplete_tiles_) {
+          stage_unfiltered_tiles(
+              name_to_clear, result_tiles, new_result_tiles_size);
+        }
+
         clear_tiles(name_to_clear, result_tiles, new_result_tiles_size);
       }
     }
@@ -1852,9 +2122,16 @@ bool SparseUnorderedWithDupsReader<BitmapType>::copy_tiles(
   if (var_sized) {
     *query_buffer.buffer_size_ = total_cells * sizeof(OffType);
 
-    if (offsets_extra_element_)
+    if (offsets_extra_element_) {
       (*query_buffer.buffer_size_) += sizeof(OffType);
 
+      // The offset one past the last cell is the total var size, writing it
+      // here produces the final buffer layout without revisiting it after
+      // the copy.
+      static_cast<OffType*>(query_buffer.buffer_)[total_cells] =
+          (OffType)var_buffer_size;
+    }
+
     *query_buffer.buffer_var_size_ = var_buffer_size * offset_div;
   } else {
     *query_buffer.buffer_size_ = total_cells * cell_size;
@@ -1936,7 +2213,7 @@ void SparseUnorderedWithDupsReader<BitmapType>::process_aggregates(
           return Status::Ok();
         }
 
-        if (can_aggregate_tile_with_frag_md(rt)) {
+        if (can_aggregate_tile_with_frag_md(name, rt)) {
           if (range_thread_idx == 0) {
             auto t = rt->tile_idx();
             auto md =
@@ -1989,7 +2266,10 @@ void SparseUnorderedWithDupsReader<BitmapType>::remove_result_tile(
   auto tiles_size =
       get_coord_tiles_size(array_schema_.dim_num(), frag_idx, tile_idx);
 
-  memory_used_for_coords_total_ -= tiles_size;
+  // The tiles of condition-only fields were already released and
+  // discounted when the conditions were applied.
+  memory_used_for_coords_total_ -=
+      tiles_size - get_condition_only_tiles_size(frag_idx, tile_idx);
 
   // Delete the tile.
   result_tiles.erase(rt);
@@ -34,10 +34,12 @@
 #define TILEDB_SPARSE_UNORDERED_WITH_DUPS_READER
 
 #include <atomic>
+#include <unordered_set>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/misc/hash.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -175,6 +177,42 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
    * process in the previous iteration.
    */
   std::list<UnorderedWithDupsResultTile<BitmapType>> result_tiles_leftover_;
+
+  /**
+   * Result tiles created ahead of time by the prefetcher, with coordinate
+   * reads already in flight.
+   */
+  ResultTilesList prefetched_tiles_;
+
+  /**
+   * Maximum number of result tiles to prefetch ahead of the tiles being
+   * processed. A value of 0 disables prefetching.
+   */
+  uint64_t prefetch_tile_count_;
+
+  /**
+   * If `true`, eliminate duplicate coordinates from the results, keeping
+   * the occurrence from the most recent fragment.
+   */
+  bool deduplicate_;
+
+  /**
+   * Coordinate hashes seen so far, one set per hash partition. The sets
+   * persist across iterations of the reader so that duplicates spanning
+   * iterations are still eliminated.
+   */
+  std::vector<std::unordered_set<
+      std::pair<uint64_t, uint64_t>,
+      utils::hash::pair_hash>>
+      dedup_seen_;
+
+  /**
+   * Per fragment index of the next tile to create. Tracks tile creation
+   * separately from the read state, which only advances once tiles have been
+   * processed, so the prefetcher can create tiles ahead of processing.
+   */
+  std::vector<uint64_t> create_tile_cursor_;
+
   /** Minimum fragment index for loaded tile offsets data. */
   unsigned tile_offsets_min_frag_idx_;
 
@@ -208,6 +246,7 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
    * @param last_t Last tile index.
    * @param frag_md Fragment metadata.
    * @param result_tiles Result tile list to add to.
+   * @param allow_empty Do not throw if not even one tile can be created.
    *
    * @return user_buffers_full.
    */
@@ -217,10 +256,27 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
       const uint64_t t,
       const uint64_t last_t,
       const FragmentMetadata& frag_md,
-      ResultTilesList& result_tiles);
+      ResultTilesList& result_tiles,
+      const bool allow_empty = false);
+
+  /**
+   * Create the result tiles.
+   *
+   * @param max_tiles Maximum number of tiles to create.
+   * @param allow_empty Do not throw if not even one tile can be created.
+   */
+  ResultTilesList create_result_tiles(
+      uint64_t max_tiles = std::numeric_limits<uint64_t>::max(),
+      bool allow_empty = false);
 
-  /** Create the result tiles. */
-  ResultTilesList create_result_tiles();
+  /**
+   * Speculatively create the next window of result tiles and start the VFS
+   * reads for their coordinate tiles, bounded by
+   * `sm.query.sparse_unordered_with_dups.prefetch_tile_count`, so that the
+   * read latency for the next window is hidden behind the processing of the
+   * current window.
+   */
+  void prefetch_next_window();
 
   /**
    * Clean tiles that have 0 results from the tile lists.
@@ -232,6 +288,41 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
       ResultTilesList& result_tiles,
       std::vector<ResultTile*>& result_tiles_ptr);
 
+  /**
+   * Compute a 128 bit hash of the coordinates of every cell of a result
+   * tile. The hash is used as the coordinate identity by the deduplication
+   * stage, which allows seen coordinates to be remembered after the tiles
+   * of previous iterations have been freed.
+   *
+   * @param rt Result tile to process.
+   *
+   * @return Hash pair, per cell of the tile.
+   */
+  std::vector<std::pair<uint64_t, uint64_t>> compute_coord_hashes(
+      UnorderedWithDupsResultTile<BitmapType>* rt);
+
+  /**
+   * Eliminate duplicate coordinates from the result tiles, keeping the
+   * occurrence from the most recent fragment. Cells are partitioned by
+   * coordinate hash across the compute thread pool and duplicates are
+   * cleared in the existing per-tile bitmaps.
+   *
+   * @param result_tiles Result tiles to process.
+   */
+  void dedup_result_tiles(std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Fill the var tiles that were loaded with streamed partial reads. Only
+   * the byte ranges of the cells selected in the tile bitmaps are read from
+   * storage, using the already unfiltered offsets tiles.
+   *
+   * @param names Fields to process.
+   * @param result_tiles Result tiles to process.
+   */
+  void read_streamed_var_tiles(
+      const std::vector<std::string>& names,
+      std::vector<ResultTile*>& result_tiles);
+
   /**
    * Compute parallelization parameters for a tile copy operation.
    *
@@ -502,17 +593,25 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
    * Returns wether or not we can aggregate the tile with only the fragment
    * metadata.
    *
+   * @param name Name of the field to process.
    * @param rt Result tile.
    * @return If we can do the aggregation with the frag md or not.
    */
   inline bool can_aggregate_tile_with_frag_md(
-      UnorderedWithDupsResultTile<BitmapType>* rt) {
+      const std::string& name, UnorderedWithDupsResultTile<BitmapType>* rt) {
+    // Some aggregates, like distinct count, cannot be computed from tile
+    // metadata.
+    if (!aggregates_use_frag_md(name)) {
+      return false;
+    }
+
     auto& frag_md = fragment_metadata_[rt->frag_idx()];
 
-    // Here we only aggregate a full tile if first of all there are no missing
-    // cells in the bitmap. This can be validated with 'copy_full_tile'.
-    // Finally, we check the fragment metadata has indeed tile metadata.
-    return rt->copy_full_tile() && frag_md->has_tile_metadata();
+    // Here we only aggregate a full tile if first of all every cell of the
+    // tile is included in the results exactly once, which can be validated
+    // with 'all_cells_selected_once'. Finally, we check the fragment metadata
+    // has indeed tile metadata.
+    return rt->all_cells_selected_once() && frag_md->has_tile_metadata();
   }
 
   /**
@@ -0,0 +1,140 @@
+/**
+ * @file tiledb/sm/query/readers/test/unit_cell_copy_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the cell copy kernels used by the dense reader.
+ */
+
+#include "tiledb/sm/query/readers/cell_copy_kernels.h"
+
+#include <test/support/tdb_catch.h>
+
+#include <vector>
+
+using namespace tiledb::sm;
+
+TEST_CASE(
+    "Cell copy kernels: strided copy matches scalar reference",
+    "[cellcopy][strided]") {
+  const uint64_t cell_size =
+      GENERATE(uint64_t(1), 2, 4, 8, 16, 3, 12, 100);
+  const uint64_t stride = GENERATE(uint64_t(2), 3, 7, 64);
+  const uint64_t num_cells = GENERATE(uint64_t(0), 1, 7, 8, 9, 1000);
+
+  // Fill the source with a recognizable byte pattern.
+  std::vector<uint8_t> src(cell_size * stride * (num_cells + 1));
+  for (uint64_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+
+  // Scalar reference.
+  std::vector<uint8_t> expected(cell_size * num_cells);
+  for (uint64_t c = 0; c < num_cells; c++) {
+    memcpy(
+        expected.data() + c * cell_size,
+        src.data() + c * cell_size * stride,
+        cell_size);
+  }
+
+  std::vector<uint8_t> dest(cell_size * num_cells, 0);
+  cellcopy::copy_cells(dest.data(), src.data(), cell_size, num_cells, stride);
+  CHECK(dest == expected);
+}
+
+TEST_CASE(
+    "Cell copy kernels: contiguous copy matches memcpy",
+    "[cellcopy][contiguous]") {
+  const uint64_t cell_size = GENERATE(uint64_t(4), 8);
+  const uint64_t num_cells = 333;
+
+  std::vector<uint8_t> src(cell_size * num_cells);
+  for (uint64_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i);
+  }
+
+  std::vector<uint8_t> dest(cell_size * num_cells, 0);
+  cellcopy::copy_cells(dest.data(), src.data(), cell_size, num_cells, 1);
+  CHECK(dest == src);
+}
+
+TEST_CASE(
+    "Cell copy kernels: validity copy gathers every stride-th byte",
+    "[cellcopy][validity]") {
+  const uint64_t stride = GENERATE(uint64_t(1), 2, 5);
+  const uint64_t num_cells = 100;
+
+  std::vector<uint8_t> src(num_cells * stride);
+  for (uint64_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i % 2);
+  }
+
+  std::vector<uint8_t> dest(num_cells, 255);
+  cellcopy::copy_validity(dest.data(), src.data(), num_cells, stride);
+
+  for (uint64_t c = 0; c < num_cells; c++) {
+    CHECK(dest[c] == src[c * stride]);
+  }
+}
+
+TEST_CASE(
+    "Cell copy kernels: blocked transpose matches scalar reference",
+    "[cellcopy][transpose]") {
+  const uint64_t cell_size = GENERATE(uint64_t(1), 4, 8, 12);
+  const uint64_t rows = GENERATE(uint64_t(1), 7, 33, 100);
+  const uint64_t cols = GENERATE(uint64_t(1), 5, 64);
+  const uint64_t src_col_stride = rows + 3;
+  const uint64_t dest_row_stride = cols + 2;
+
+  // Fill the source with a recognizable byte pattern.
+  std::vector<uint8_t> src(cell_size * src_col_stride * cols);
+  for (uint64_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i * 17 + 3);
+  }
+
+  // Scalar reference.
+  std::vector<uint8_t> expected(cell_size * dest_row_stride * rows, 0);
+  for (uint64_t i = 0; i < rows; i++) {
+    for (uint64_t j = 0; j < cols; j++) {
+      memcpy(
+          expected.data() + (i * dest_row_stride + j) * cell_size,
+          src.data() + (i + j * src_col_stride) * cell_size,
+          cell_size);
+    }
+  }
+
+  std::vector<uint8_t> dest(cell_size * dest_row_stride * rows, 0);
+  cellcopy::transpose_cells(
+      dest.data(),
+      src.data(),
+      cell_size,
+      rows,
+      cols,
+      src_col_stride,
+      dest_row_stride);
+  CHECK(dest == expected);
+}
@@ -83,3 +83,43 @@ TEST_CASE(
         "Range thread index is greater than number of range threads");
   }
 }
+
+TEST_CASE(
+    "ReaderBase::point_chunk_range",
+    "[readerbase][point_chunk_range]") {
+  // Four chunks of 1024 unfiltered bytes each.
+  ChunkData chunk_data;
+  chunk_data.chunk_offsets_ = {0, 1024, 2048, 3072};
+
+  std::tuple<uint64_t, uint64_t> expected_min_max{0, 0};
+  uint64_t cell_pos{0};
+  uint64_t cell_size{8};
+  uint64_t t_min{0};
+  uint64_t t_max{4};
+
+  SECTION("First cell selects the first chunk") {
+    cell_pos = 0;
+    expected_min_max = {0, 1};
+  }
+
+  SECTION("Cell in the middle of a chunk") {
+    cell_pos = 300;  // Byte 2400, inside the third chunk.
+    expected_min_max = {2, 3};
+  }
+
+  SECTION("Cell on a chunk boundary") {
+    cell_pos = 128;  // Byte 1024, first cell of the second chunk.
+    expected_min_max = {1, 2};
+  }
+
+  SECTION("Chunk outside the thread's range is empty") {
+    cell_pos = 300;
+    t_min = 0;
+    t_max = 2;
+    expected_min_max = {0, 0};
+  }
+
+  auto res = ReaderBase::point_chunk_range(
+      chunk_data, cell_pos, cell_size, t_min, t_max);
+  CHECK(res == expected_min_max);
+}
@@ -59,6 +59,7 @@ StrategyBase::StrategyBase(
     , buffers_(params.buffers())
     , layout_(params.layout())
     , storage_manager_(params.storage_manager())
+    , cancellation_source_(params.cancellation_source())
     , subarray_(params.subarray())
     , offsets_format_mode_(Config::SM_OFFSETS_FORMAT_MODE)
     , offsets_extra_element_(false)
@@ -103,7 +104,8 @@ void StrategyBase::get_dim_attr_stats() const {
 }
 
 void StrategyBase::throw_if_cancelled() const {
-  if (storage_manager_->cancellation_in_progress()) {
+  if (cancellation_source_.is_cancelled() ||
+      storage_manager_->cancellation_in_progress()) {
     throw QueryException("Query was cancelled");
   }
 }
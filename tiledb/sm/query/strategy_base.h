@@ -36,6 +36,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/misc/cancellation_source.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/storage_manager/context_resources.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -78,6 +79,7 @@ class StrategyParams {
       Layout layout,
       std::optional<QueryCondition>& condition,
       DefaultChannelAggregates& default_channel_aggregates,
+      CancellationSource cancellation_source,
       bool skip_checks_serialization)
       : resources_(resources)
       , array_memory_tracker_(array_memory_tracker)
@@ -92,6 +94,7 @@ class StrategyParams {
       , layout_(layout)
       , condition_(condition)
       , default_channel_aggregates_(default_channel_aggregates)
+      , cancellation_source_(cancellation_source)
       , skip_checks_serialization_(skip_checks_serialization) {
   }
 
@@ -165,6 +168,11 @@ class StrategyParams {
     return default_channel_aggregates_;
   }
 
+  /** Return the cancellation source of the parent query. */
+  inline CancellationSource cancellation_source() {
+    return cancellation_source_;
+  }
+
   /** Return if we should skip checks for serialization. */
   inline bool skip_checks_serialization() {
     return skip_checks_serialization_;
@@ -217,6 +225,9 @@ class StrategyParams {
   /** Default channel aggregates. */
   DefaultChannelAggregates& default_channel_aggregates_;
 
+  /** Cancellation source of the parent query. */
+  CancellationSource cancellation_source_;
+
   /** Skip checks for serialization. */
   bool skip_checks_serialization_;
 };
@@ -244,6 +255,11 @@ class StrategyBase {
     return stats_;
   }
 
+  /** Returns the cancellation source of the parent query. */
+  inline const CancellationSource& cancellation_source() const {
+    return cancellation_source_;
+  }
+
   /**
    * Populate the owned stats instance with data.
    * To be removed when the class will get a C41 constructor.
@@ -315,6 +331,9 @@ class StrategyBase {
   /** The storage manager. */
   StorageManager* storage_manager_;
 
+  /** Cancellation source of the parent query. */
+  CancellationSource cancellation_source_;
+
   /** The query subarray (initially the whole domain by default). */
   Subarray& subarray_;
 
@@ -39,6 +39,7 @@
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/query/readers/cell_copy_kernels.h"
 #include "tiledb/sm/tile/writer_tile_tuple.h"
 
 using namespace tiledb::common;
@@ -282,10 +283,20 @@ Status DenseTiler<T>::get_tile(
     auto buff = (uint8_t*)buffers_->find(name)->second.buffer_;
     assert(buff != nullptr);
 
-    memset(tile.fixed_tile().data(), 0, tile_size);
-
-    // Copy tile from buffer
-    RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.fixed_tile()));
+    // If the tile is one contiguous, fully covering slab of the user
+    // buffer, back the tile with the slab instead of copying it. The
+    // filter pipeline treats its input as read-only, so the user bytes
+    // are only read until the tile is filtered.
+    auto contig_el = contiguous_tile_offset(copy_plan(id));
+    if (contig_el.has_value()) {
+      tile.fixed_tile().alias_data(
+          (std::byte*)buff + *contig_el * cell_size);
+    } else {
+      memset(tile.fixed_tile().data(), 0, tile_size);
+
+      // Copy tile from buffer
+      RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.fixed_tile()));
+    }
   }
 
   if (tile.nullable()) {
@@ -295,10 +306,17 @@ Status DenseTiler<T>::get_tile(
         (uint8_t*)buffers_->find(name)->second.validity_vector_.buffer();
     assert(buff != nullptr);
 
-    memset(tile.validity_tile().data(), 0, tile_size);
+    // The validity buffer has the same cell layout as the data buffer, so
+    // the same zero-copy condition applies.
+    auto contig_el = contiguous_tile_offset(copy_plan(id));
+    if (contig_el.has_value()) {
+      tile.validity_tile().alias_data((std::byte*)buff + *contig_el);
+    } else {
+      memset(tile.validity_tile().data(), 0, tile_size);
 
-    // Copy tile from buffer
-    RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.validity_tile()));
+      // Copy tile from buffer
+      RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.validity_tile()));
+    }
   }
 
   compute_tile_metadata(name, id, tile);
@@ -382,6 +400,13 @@ void DenseTiler<T>::calculate_subarray_tile_coord_strides() {
           sub_tile_coord_strides_.back() * tile_num);
     }
   }
+
+  // Precompute the divisors once; `tile_coords_in_sub` divides by these
+  // strides for every tile of every attribute.
+  sub_tile_coord_divisors_.reserve(dim_num);
+  for (auto stride : sub_tile_coord_strides_) {
+    sub_tile_coord_divisors_.emplace_back(stride);
+  }
 }
 
 template <class T>
@@ -458,13 +483,15 @@ std::vector<uint64_t> DenseTiler<T>::tile_coords_in_sub(uint64_t id) const {
 
   if (layout == Layout::ROW_MAJOR) {
     for (int32_t d = 0; d < dim_num; ++d) {
-      ret.push_back(tmp_idx / sub_tile_coord_strides_[d]);
-      tmp_idx %= sub_tile_coord_strides_[d];
+      auto coord = sub_tile_coord_divisors_[d].div(tmp_idx);
+      ret.push_back(coord);
+      tmp_idx -= coord * sub_tile_coord_strides_[d];
     }
   } else {  // COL_MAJOR
     for (auto d = dim_num - 1; d >= 0; --d) {
-      ret.push_back(tmp_idx / sub_tile_coord_strides_[d]);
-      tmp_idx %= sub_tile_coord_strides_[d];
+      auto coord = sub_tile_coord_divisors_[d].div(tmp_idx);
+      ret.push_back(coord);
+      tmp_idx -= coord * sub_tile_coord_strides_[d];
     }
     std::reverse(ret.begin(), ret.end());
   }
@@ -507,6 +534,17 @@ Status DenseTiler<T>::copy_tile(
   // Calculate copy plan
   const CopyPlan copy_plan = this->copy_plan(id);
 
+  // A plan that moves a single element per copy iteration while the tile is
+  // written contiguously along the innermost loop level is a layout
+  // transposition: run it through the blocked copy kernels instead of one
+  // write call per cell.
+  const auto plan_dim_num = (int64_t)copy_plan.dim_ranges_.size();
+  if (copy_plan.copy_el_ == 1 && plan_dim_num > 0 &&
+      copy_plan.tile_strides_el_[plan_dim_num - 1 + copy_plan.first_d_] == 1) {
+    copy_tile_transposed(copy_plan, cell_size, buff, tile);
+    return Status::Ok();
+  }
+
   // For easy reference
   auto sub_offset = copy_plan.sub_start_el_ * cell_size;
   auto tile_offset = copy_plan.tile_start_el_ * cell_size;
@@ -574,6 +612,129 @@ Status DenseTiler<T>::copy_tile(
   return Status::Ok();
 }
 
+template <class T>
+std::optional<uint64_t> DenseTiler<T>::contiguous_tile_offset(
+    const CopyPlan& copy_plan) const {
+  // The tile is a contiguous slab of the buffer when the plan performs a
+  // single copy (every loop level is a singleton) that covers the full
+  // tile from its first element.
+  if (copy_plan.tile_start_el_ != 0 ||
+      copy_plan.copy_el_ != array_schema_.domain().cell_num_per_tile()) {
+    return std::nullopt;
+  }
+
+  for (const auto& r : copy_plan.dim_ranges_) {
+    if (r[0] != r[1]) {
+      return std::nullopt;
+    }
+  }
+
+  return copy_plan.sub_start_el_;
+}
+
+template <class T>
+void DenseTiler<T>::copy_tile_transposed(
+    const CopyPlan& copy_plan,
+    uint64_t cell_size,
+    uint8_t* buff,
+    WriterTile& tile) const {
+  // For easy reference
+  const auto& dim_ranges = copy_plan.dim_ranges_;
+  auto first_d = copy_plan.first_d_;
+  auto dim_num = (int64_t)dim_ranges.size();
+  auto tile_data = tile.data_as<uint8_t>();
+
+  // The innermost loop level writes the tile contiguously while reading
+  // every `inner_sub_stride`-th cell from the buffer.
+  const auto inner_d = dim_num - 1;
+  const uint64_t inner_cells =
+      dim_ranges[inner_d][1] - dim_ranges[inner_d][0] + 1;
+  const uint64_t inner_sub_stride =
+      copy_plan.sub_strides_el_[inner_d + first_d];
+
+  // When the buffer is contiguous along the next loop level, the two
+  // innermost levels form a 2D transpose that is handled by one blocked
+  // kernel call.
+  const bool transpose_2d =
+      dim_num >= 2 && copy_plan.sub_strides_el_[inner_d - 1 + first_d] == 1;
+  const int64_t collapsed_num = transpose_2d ? 2 : 1;
+  const uint64_t rows =
+      transpose_2d ?
+          dim_ranges[inner_d - 1][1] - dim_ranges[inner_d - 1][0] + 1 :
+          1;
+  const uint64_t dest_row_stride =
+      transpose_2d ? copy_plan.tile_strides_el_[inner_d - 1 + first_d] : 0;
+
+  auto copy_slab = [&](uint64_t tile_offset, uint64_t sub_offset) {
+    if (transpose_2d) {
+      cellcopy::transpose_cells(
+          tile_data + tile_offset,
+          buff + sub_offset,
+          cell_size,
+          rows,
+          inner_cells,
+          inner_sub_stride,
+          dest_row_stride);
+    } else {
+      cellcopy::copy_cells(
+          tile_data + tile_offset,
+          buff + sub_offset,
+          cell_size,
+          inner_cells,
+          inner_sub_stride);
+    }
+  };
+
+  auto tile_offset = copy_plan.tile_start_el_ * cell_size;
+  auto sub_offset = copy_plan.sub_start_el_ * cell_size;
+
+  // If the kernels collapsed every loop level, a single call remains.
+  auto walk_num = dim_num - collapsed_num;
+  if (walk_num <= 0) {
+    copy_slab(tile_offset, sub_offset);
+    return;
+  }
+
+  // Walk the remaining outer loop levels like the generic copy loop does.
+  std::vector<uint64_t> tile_offsets(walk_num, tile_offset);
+  std::vector<uint64_t> sub_offsets(walk_num, sub_offset);
+  std::vector<uint64_t> cell_coords(walk_num);
+  for (int64_t i = 0; i < walk_num; ++i) {
+    cell_coords[i] = dim_ranges[i][0];
+  }
+
+  auto d = walk_num - 1;
+  while (true) {
+    copy_slab(tile_offsets[d], sub_offsets[d]);
+
+    // Advance cell coordinates, tile and buffer offsets
+    auto last_dim_changed = d;
+    for (; last_dim_changed >= 0; --last_dim_changed) {
+      ++cell_coords[last_dim_changed];
+      if (cell_coords[last_dim_changed] > dim_ranges[last_dim_changed][1]) {
+        cell_coords[last_dim_changed] = dim_ranges[last_dim_changed][0];
+      } else {
+        break;
+      }
+    }
+
+    // Check if copy loop is done
+    if (last_dim_changed < 0) {
+      break;
+    }
+
+    // Update the offsets
+    tile_offsets[last_dim_changed] +=
+        copy_plan.tile_strides_el_[last_dim_changed + first_d] * cell_size;
+    sub_offsets[last_dim_changed] +=
+        copy_plan.sub_strides_el_[last_dim_changed + first_d] * cell_size;
+    for (auto i = last_dim_changed + 1; i < walk_num; ++i) {
+      tile_offsets[i] = tile_offsets[i - 1];
+      sub_offsets[i] = sub_offsets[i - 1];
+    }
+  }
+}
+
 template <class T>
 void DenseTiler<T>::compute_tile_metadata(
     const std::string& name, uint64_t id, WriterTileTuple& tile) const {
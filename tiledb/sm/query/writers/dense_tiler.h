@@ -35,11 +35,13 @@
 
 #include <atomic>
 #include <functional>
+#include <optional>
 #include <unordered_map>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/misc/fast_div_mod.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/stats/stats.h"
 #include "tiledb/sm/subarray/subarray.h"
@@ -255,6 +257,13 @@ class DenseTiler {
    */
   std::vector<uint64_t> sub_tile_coord_strides_;
 
+  /**
+   * Precomputed magic-number divisors for `sub_tile_coord_strides_`, so
+   * that decomposing a serial tile id into tile coordinates avoids one
+   * hardware division and modulo per dimension.
+   */
+  std::vector<FastDivMod> sub_tile_coord_divisors_;
+
   /** The coordinates of the first tile intersecting the subarray. */
   std::vector<uint64_t> first_sub_tile_coords_;
 
@@ -323,6 +332,38 @@ class DenseTiler {
   Status copy_tile(
       uint64_t id, uint64_t cell_size, uint8_t* buff, WriterTile& tile) const;
 
+  /**
+   * Returns the position (in cells) of the tile in the subarray buffer if
+   * the copy plan is a single copy of the full tile, i.e., the write is
+   * tile-aligned and the buffer layout matches the tile layout, so that
+   * the tile is one contiguous slab of the buffer. Returns `nullopt`
+   * otherwise.
+   *
+   * @param copy_plan The copy plan computed for the tile.
+   */
+  std::optional<uint64_t> contiguous_tile_offset(
+      const CopyPlan& copy_plan) const;
+
+  /**
+   * Copies a fixed-sized tile for a copy plan that moves a single element
+   * per copy iteration with a contiguous tile destination along the
+   * innermost loop level, i.e., a layout transposition. The innermost loop
+   * level runs as a strided copy kernel and, when the buffer is contiguous
+   * along the next level, the two levels run as one blocked 2D transpose
+   * kernel.
+   *
+   * @param copy_plan The copy plan computed for the tile.
+   * @param cell_size The cell size in `buff`.
+   * @param buff The subarray buffer from which the copy will occur.
+   * @param tile The tile to be retrieved. This needs to
+   *     be preallocated and initialized before passed to the function.
+   */
+  void copy_tile_transposed(
+      const CopyPlan& copy_plan,
+      uint64_t cell_size,
+      uint8_t* buff,
+      WriterTile& tile) const;
+
   /**
    * Computes the tile metadata according to the copy plan.
    *
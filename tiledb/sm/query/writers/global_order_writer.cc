@@ -525,9 +525,6 @@ Status GlobalOrderWriter::filter_last_tiles(uint64_t cell_num) {
   auto mbrs = compute_mbrs(global_write_state_->last_tiles_);
   set_coords_metadata(0, 1, global_write_state_->last_tiles_, mbrs, meta);
 
-  // Compute tile metadata.
-  RETURN_NOT_OK(compute_tiles_metadata(1, global_write_state_->last_tiles_));
-
   // Gather stats
   stats_->add_counter(
       "cell_num",
@@ -769,27 +766,60 @@ Status GlobalOrderWriter::global_write() {
   // Compute coordinate metadata (if coordinates are present)
   auto mbrs = compute_mbrs(tiles);
 
-  // Compute tile metadata.
-  RETURN_CANCEL_OR_ERROR(compute_tiles_metadata(tile_num, tiles));
-
-  // Filter all tiles
-  RETURN_CANCEL_OR_ERROR(filter_tiles(&tiles));
+  // Filter and write the tiles through a staged pipeline. Every batch of
+  // tiles is filtered on the compute thread pool while the previously
+  // filtered batch is flushed by an asynchronous task on the IO thread pool,
+  // so that the compression of one batch overlaps the VFS writes (and
+  // potential multipart uploads) of the previous one. Writes to the
+  // attribute files stay ordered as only a single write task is in flight at
+  // any given time.
+  const uint64_t batch_size =
+      std::max<uint64_t>(resources_.compute_tp().concurrency_level(), 1);
+  ThreadPool::Task write_task;
+  auto wait_for_write = [&]() {
+    return write_task.valid() ? resources_.io_tp().wait(write_task) :
+                                Status::Ok();
+  };
+
+  for (uint64_t idx = 0; idx < tile_num; idx += batch_size) {
+    const uint64_t end_idx = std::min(idx + batch_size, tile_num);
+
+    // Filter the current batch while the previous one is being written.
+    auto filter_st = filter_tiles(idx, end_idx, &tiles);
+
+    // Wait for the in-flight write before acting on any error as the write
+    // task references state owned by this function.
+    RETURN_NOT_OK(wait_for_write());
+    RETURN_CANCEL_OR_ERROR(filter_st);
+
+    write_task = resources_.io_tp().execute([&, idx, end_idx]() {
+      return write_tile_batch(idx, end_idx, tiles, mbrs);
+    });
+  }
 
-  uint64_t idx = 0;
-  while (idx < tile_num) {
-    auto frag_meta = global_write_state_->frag_meta_;
+  return wait_for_write();
+}
 
+Status GlobalOrderWriter::write_tile_batch(
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx,
+    tdb::pmr::unordered_map<std::string, WriterTileTupleVector>& tiles,
+    const std::vector<NDRange>& mbrs) {
+  uint64_t idx = start_tile_idx;
+  while (idx < end_tile_idx) {
     // Compute the number of tiles that will fit in this fragment.
-    auto num = num_tiles_to_write(idx, tile_num, tiles);
+    auto num = num_tiles_to_write(idx, end_tile_idx, tiles);
 
     // If we're resuming a fragment write and the first tile doesn't fit into
     // the previous fragment, we need to start a new fragment and recalculate
     // the number of tiles to write.
     if (current_fragment_size_ > 0 && num == 0) {
       RETURN_CANCEL_OR_ERROR(start_new_fragment());
-      num = num_tiles_to_write(idx, tile_num, tiles);
+      num = num_tiles_to_write(idx, end_tile_idx, tiles);
     }
 
+    auto frag_meta = global_write_state_->frag_meta_;
+
     // Set new number of tiles in the fragment metadata
     auto new_num_tiles = frag_meta->tile_index_base() + num;
     frag_meta->set_num_tiles(new_num_tiles);
@@ -805,8 +835,10 @@ Status GlobalOrderWriter::global_write() {
     RETURN_CANCEL_OR_ERROR(write_tiles(idx, idx + num, frag_meta, &tiles));
     idx += num;
 
-    // If we didn't write all tiles, close this fragment and start another.
-    if (idx != tile_num) {
+    // If the fragment is full, close it and start another. A batch that ends
+    // on a partially full fragment leaves it open for the next batch to
+    // resume.
+    if (idx != end_tile_idx) {
       RETURN_CANCEL_OR_ERROR(start_new_fragment());
     }
 
@@ -1414,6 +1446,19 @@ uint64_t GlobalOrderWriter::num_tiles_to_write(
     }
 
     if (current_fragment_size_ + tile_size > fragment_size_) {
+      // Close the fragment on whichever side of the target is nearer: take
+      // the straddling tile when overshooting leaves the fragment closer to
+      // the target size than stopping short would. Fragment sizes then
+      // deviate from the target symmetrically by at most half a filtered
+      // tile on average, instead of always undershooting.
+      const auto overshoot =
+          current_fragment_size_ + tile_size - fragment_size_;
+      const auto undershoot = fragment_size_ - current_fragment_size_;
+      if (overshoot <= undershoot) {
+        current_fragment_size_ += tile_size;
+        return t - start + 1;
+      }
+
       return t - start;
     }
 
@@ -281,6 +281,25 @@ class GlobalOrderWriter : public WriterBase {
    */
   Status global_write();
 
+  /**
+   * Applicable only to global writes. Writes the filtered tiles in the range
+   * [start_tile_idx, end_tile_idx) for all attributes, closing the current
+   * fragment and starting a new one whenever the fragment size budget is
+   * reached. A fragment left partially full by one batch is resumed by the
+   * next one.
+   *
+   * @param start_tile_idx Index of the first tile to write.
+   * @param end_tile_idx Index past the last tile to write.
+   * @param tiles Map of vector of tiles, per attribute.
+   * @param mbrs MBRs of the tiles (if coordinates are present).
+   * @return Status
+   */
+  Status write_tile_batch(
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx,
+      tdb::pmr::unordered_map<std::string, WriterTileTupleVector>& tiles,
+      const std::vector<NDRange>& mbrs);
+
   /**
    * Applicable only to global writes. Writes the last tiles for each
    * attribute remaining in the state, and records the metadata for
@@ -37,6 +37,7 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/consolidator/consolidator.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/comparators.h"
@@ -90,7 +91,8 @@ UnorderedWriter::UnorderedWriter(
     , frag_uri_(std::nullopt)
     , cell_pos_(query_memory_tracker_->get_resource(MemoryType::WRITER_DATA))
     , written_buffers_(written_buffers)
-    , is_coords_pass_(true) {
+    , is_coords_pass_(true)
+    , streaming_ingest_(false) {
   // Check the layout is unordered.
   if (layout_ != Layout::UNORDERED) {
     throw UnorderWriterException(
@@ -112,6 +114,17 @@ UnorderedWriter::UnorderedWriter(
         "Failed to initialize UnorderedWriter; The unordered writer does not "
         "support ordered attributes.");
   }
+
+  bool found = false;
+  if (!config_
+           .get<bool>(
+               "sm.query.unordered_writer.streaming_ingest",
+               &streaming_ingest_,
+               &found)
+           .ok()) {
+    throw UnorderWriterException("Cannot get setting");
+  }
+  assert(found);
 }
 
 UnorderedWriter::~UnorderedWriter() {
@@ -126,6 +139,15 @@ Status UnorderedWriter::dowork() {
 
   auto timer_se = stats_->start_timer("dowork");
 
+  // In streaming ingest mode, a submission arriving after a complete buffer
+  // set starts a new batch: the fragment of the completed batch becomes a
+  // run and the per-batch state is reset.
+  if (streaming_ingest_ &&
+      written_buffers_.size() >=
+          array_schema_.dim_num() + array_schema_.attribute_num()) {
+    start_new_run();
+  }
+
   // In case the user has provided a coordinates buffer
   RETURN_NOT_OK(split_coords_buffer());
 
@@ -155,6 +177,13 @@ Status UnorderedWriter::finalize() {
     throw UnorderWriterException("Not all buffers already written");
   }
 
+  if (streaming_ingest_) {
+    group_commit_runs();
+    if (!streamed_run_uris_.empty()) {
+      merge_streamed_runs();
+    }
+  }
+
   return Status::Ok();
 }
 
@@ -184,6 +213,89 @@ void UnorderedWriter::clean_up() {
   }
 }
 
+void UnorderedWriter::start_new_run() {
+  if (frag_uri_.has_value()) {
+    streamed_run_uris_.emplace_back(frag_uri_.value().to_string());
+  }
+
+  frag_uri_ = std::nullopt;
+  cell_pos_.clear();
+  coord_dups_.clear();
+  frag_meta_ = nullptr;
+  written_buffers_.clear();
+  is_coords_pass_ = true;
+}
+
+void UnorderedWriter::group_commit_runs() {
+  auto timer_se = stats_->start_timer("group_commit_runs");
+
+  if (streamed_run_meta_.empty()) {
+    return;
+  }
+
+  // Flush the deferred fragment metadata of all runs in one window.
+  throw_if_not_ok(parallel_for(
+      &resources_.io_tp(), 0, streamed_run_meta_.size(), [&](uint64_t i) {
+        streamed_run_meta_[i]->store(array_->get_encryption_key());
+        return Status::Ok();
+      }));
+
+  // Make all runs visible at once, either with a single commit file or
+  // with one consolidated commits file when multiple runs were written.
+  std::vector<URI> commit_uris;
+  commit_uris.reserve(streamed_run_meta_.size());
+  for (auto& meta : streamed_run_meta_) {
+    commit_uris.emplace_back(
+        array_->array_directory().get_commit_uri(meta->fragment_uri()));
+  }
+
+  if (commit_uris.size() == 1) {
+    throw_if_not_ok(resources_.vfs().touch(commit_uris[0]));
+  } else {
+    auto write_version = array_->array_schema_latest().write_version();
+    Consolidator::write_consolidated_commits_file(
+        write_version, array_->array_directory(), commit_uris, resources_);
+  }
+
+  streamed_run_meta_.clear();
+}
+
+void UnorderedWriter::merge_streamed_runs() {
+  auto timer_se = stats_->start_timer("merge_streamed_runs");
+
+  // Include the fragment of the final batch.
+  auto run_uris = streamed_run_uris_;
+  if (frag_uri_.has_value()) {
+    run_uris.emplace_back(frag_uri_.value().to_string());
+  }
+
+  if (run_uris.size() < 2) {
+    return;
+  }
+
+  // Merge the runs into a single fragment written in global order. The
+  // consolidator streams the runs through a global order read with bounded
+  // buffers, so the merge does not need the batches resident at once.
+  const auto& array_uri = array_->array_uri();
+  Consolidator::fragments_consolidate(
+      resources_,
+      array_uri.c_str(),
+      EncryptionType::NO_ENCRYPTION,
+      nullptr,
+      0,
+      run_uris,
+      config_,
+      storage_manager_);
+
+  // Vacuum the consolidated runs so that only the merged fragment remains.
+  Config vacuum_config = config_;
+  throw_if_not_ok(vacuum_config.set("sm.vacuum.mode", "fragments"));
+  Consolidator::array_vacuum(
+      resources_, array_uri.c_str(), vacuum_config, storage_manager_);
+
+  streamed_run_uris_.clear();
+}
+
 Status UnorderedWriter::check_coord_dups() const {
   auto timer_se = stats_->start_timer("check_coord_dups");
 
@@ -434,48 +546,49 @@ Status UnorderedWriter::prepare_tiles_fixed(
         query_memory_tracker_);
   }
 
-  // Write all cells one by one
-  uint64_t cell_idx = 0;
-  auto tile_it = tiles->begin();
-  if (dups_num == 0) {
-    for (uint64_t i = 0; i < cell_num; ++i, ++cell_idx) {
-      if (cell_idx == cell_num_per_tile) {
-        tile_it++;
-        cell_idx = 0;
-      }
-
-      tile_it->fixed_tile().write(
-          buffer + cell_pos_[i] * cell_size, cell_idx * cell_size, cell_size);
-      if (nullable)
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i] * constants::cell_validity_size,
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
-    }
-  } else {
+  // Compact away the duplicates so that cells map to tiles by index, with
+  // tile `t` holding the cells [t * cell_num_per_tile, (t + 1) *
+  // cell_num_per_tile).
+  std::vector<uint64_t> positions;
+  const uint64_t* pos_data = cell_pos_.data();
+  uint64_t pos_num = cell_num;
+  if (dups_num != 0) {
+    positions.reserve(cell_num - dups_num);
     for (uint64_t i = 0; i < cell_num; ++i) {
-      if (coord_dups_.find(cell_pos_[i]) != coord_dups_.end())
-        continue;
-
-      if (cell_idx == cell_num_per_tile) {
-        tile_it++;
-        cell_idx = 0;
+      if (coord_dups_.find(cell_pos_[i]) == coord_dups_.end()) {
+        positions.emplace_back(cell_pos_[i]);
       }
-
-      tile_it->fixed_tile().write(
-          buffer + cell_pos_[i] * cell_size, cell_idx * cell_size, cell_size);
-      if (nullable)
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i] * constants::cell_validity_size,
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
-      ++cell_idx;
     }
+    pos_data = positions.data();
+    pos_num = positions.size();
   }
 
+  // Each tile only depends on its own cell range, so the copies
+  // parallelize over tiles.
+  auto status = parallel_for(
+      &resources_.compute_tp(), 0, tile_num, [&](uint64_t t) {
+        auto& tile = (*tiles)[t];
+        const uint64_t start = t * cell_num_per_tile;
+        const uint64_t end = std::min(start + cell_num_per_tile, pos_num);
+        for (uint64_t i = start; i < end; ++i) {
+          const auto pos = pos_data[i];
+          const uint64_t cell_idx = i - start;
+          tile.fixed_tile().write(
+              buffer + pos * cell_size, cell_idx * cell_size, cell_size);
+          if (nullable) {
+            tile.validity_tile().write(
+                buffer_validity + pos * constants::cell_validity_size,
+                cell_idx * constants::cell_validity_size,
+                constants::cell_validity_size);
+          }
+        }
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
   uint64_t last_tile_cell_num = (cell_num - dups_num) % cell_num_per_tile;
   if (last_tile_cell_num != 0) {
-    tile_it->set_final_size(last_tile_cell_num);
+    tiles->back().set_final_size(last_tile_cell_num);
   }
 
   return Status::Ok();
@@ -511,90 +624,71 @@ Status UnorderedWriter::prepare_tiles_var(
         query_memory_tracker_);
   }
 
-  // Write all cells one by one
-  uint64_t cell_idx = 0;
-  auto tile_it = tiles->begin();
-  uint64_t offset = 0;
-  if (dups_num == 0) {
-    for (uint64_t i = 0; i < cell_num; ++i, ++cell_idx) {
-      if (cell_idx == cell_num_per_tile) {
-        tile_it->var_tile().set_size(offset);
-        cell_idx = 0;
-        offset = 0;
-        tile_it++;
-      }
-
-      // Write offset.
-      tile_it->offset_tile().write(
-          &offset, cell_idx * sizeof(offset), sizeof(offset));
-
-      // Write var-sized value(s).
-      auto buff_offset =
-          prepare_buffer_offset(buffer, cell_pos_[i], attr_datatype_size);
-      uint64_t var_size =
-          (cell_pos_[i] == cell_num - 1) ?
-              *buffer_var_size - buff_offset :
-              prepare_buffer_offset(
-                  buffer, cell_pos_[i] + 1, attr_datatype_size) -
-                  buff_offset;
-      tile_it->var_tile().write_var(buffer_var + buff_offset, offset, var_size);
-      offset += var_size;
-
-      // Write validity value(s).
-      if (nullable) {
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i],
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
-      }
-    }
-  } else {
+  // Compact away the duplicates so that cells map to tiles by index, with
+  // tile `t` holding the cells [t * cell_num_per_tile, (t + 1) *
+  // cell_num_per_tile).
+  std::vector<uint64_t> positions;
+  const uint64_t* pos_data = cell_pos_.data();
+  uint64_t pos_num = cell_num;
+  if (dups_num != 0) {
+    positions.reserve(cell_num - dups_num);
     for (uint64_t i = 0; i < cell_num; ++i) {
-      if (coord_dups_.find(cell_pos_[i]) != coord_dups_.end())
-        continue;
-
-      if (cell_idx == cell_num_per_tile) {
-        tile_it->var_tile().set_size(offset);
-        cell_idx = 0;
-        offset = 0;
-        tile_it++;
-      }
-
-      // Write offset.
-      tile_it->offset_tile().write(
-          &offset, cell_idx * sizeof(offset), sizeof(offset));
-
-      // Write var-sized value(s).
-      auto buff_offset =
-          prepare_buffer_offset(buffer, cell_pos_[i], attr_datatype_size);
-      uint64_t var_size =
-          (cell_pos_[i] == cell_num - 1) ?
-              *buffer_var_size - buff_offset :
-              prepare_buffer_offset(
-                  buffer, cell_pos_[i] + 1, attr_datatype_size) -
-                  buff_offset;
-      tile_it->var_tile().write_var(buffer_var + buff_offset, offset, var_size);
-      offset += var_size;
-
-      // Write validity value(s).
-      if (nullable) {
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i],
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
+      if (coord_dups_.find(cell_pos_[i]) == coord_dups_.end()) {
+        positions.emplace_back(cell_pos_[i]);
       }
-
-      ++cell_idx;
     }
+    pos_data = positions.data();
+    pos_num = positions.size();
   }
 
-  if (cell_num > 0) {
-    tile_it->var_tile().set_size(offset);
-  }
+  // The offsets-mode conversion multiplier is loop invariant; hoist it out
+  // of the per-cell offset reads.
+  const uint64_t off_mul =
+      offsets_format_mode_ == "elements" ? attr_datatype_size : 1;
+
+  // The var offsets of each tile restart at zero, so the offset scan and
+  // the copies only depend on the tile's own cell range and parallelize
+  // over tiles.
+  auto status = parallel_for(
+      &resources_.compute_tp(), 0, tile_num, [&](uint64_t t) {
+        auto& tile = (*tiles)[t];
+        const uint64_t start = t * cell_num_per_tile;
+        const uint64_t end = std::min(start + cell_num_per_tile, pos_num);
+        uint64_t offset = 0;
+        for (uint64_t i = start; i < end; ++i) {
+          const auto pos = pos_data[i];
+          const uint64_t cell_idx = i - start;
+
+          // Write offset.
+          tile.offset_tile().write(
+              &offset, cell_idx * sizeof(offset), sizeof(offset));
+
+          // Write var-sized value(s).
+          auto buff_offset = get_offset_buffer_element(buffer, pos) * off_mul;
+          uint64_t var_size =
+              (pos == cell_num - 1) ?
+                  *buffer_var_size - buff_offset :
+                  get_offset_buffer_element(buffer, pos + 1) * off_mul -
+                      buff_offset;
+          tile.var_tile().write_var(buffer_var + buff_offset, offset, var_size);
+          offset += var_size;
+
+          // Write validity value(s).
+          if (nullable) {
+            tile.validity_tile().write(
+                buffer_validity + pos,
+                cell_idx * constants::cell_validity_size,
+                constants::cell_validity_size);
+          }
+        }
+        tile.var_tile().set_size(offset);
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
 
   uint64_t last_tile_cell_num = (cell_num - dups_num) % cell_num_per_tile;
   if (last_tile_cell_num != 0) {
-    tile_it->set_final_size(last_tile_cell_num);
+    tiles->back().set_final_size(last_tile_cell_num);
   }
 
   return Status::Ok();
@@ -613,24 +707,100 @@ Status UnorderedWriter::sort_coords() {
   const Domain& domain = array_schema_.domain();
   DomainBuffersView domain_buffs{array_schema_, buffers_};
   if (cell_order != Layout::HILBERT) {  // Row- or col-major
-    parallel_sort(
-        &resources_.compute_tp(),
-        cell_pos_.begin(),
-        cell_pos_.end(),
-        GlobalCmpQB(domain, domain_buffs));
+    sort_coords_global_dispatch(domain, domain_buffs);
   } else {  // Hilbert order
     std::vector<uint64_t> hilbert_values(coords_info_.coords_num_);
     RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
-    parallel_sort(
+
+    // The hilbert values are 64-bit integers, so the cells can be ordered
+    // with a radix sort instead of a comparison sort.
+    parallel_radix_sort(
         &resources_.compute_tp(),
         cell_pos_.begin(),
         cell_pos_.end(),
-        HilbertCmpQB(domain, domain_buffs, hilbert_values));
+        hilbert_values);
+
+    // Cells that map to the same hilbert value are ordered on cell order,
+    // matching the tie-break of `HilbertCmpQB`. Collect the runs of equal
+    // hilbert values and sort each one with the comparator, runs are
+    // typically tiny compared to the full range.
+    std::vector<std::pair<uint64_t, uint64_t>> runs;
+    uint64_t run_start = 0;
+    for (uint64_t i = 1; i <= cell_pos_.size(); i++) {
+      if (i == cell_pos_.size() || hilbert_values[cell_pos_[i]] !=
+                                       hilbert_values[cell_pos_[run_start]]) {
+        if (i - run_start > 1) {
+          runs.emplace_back(run_start, i);
+        }
+        run_start = i;
+      }
+    }
+
+    HilbertCmpQB cmp(domain, domain_buffs, hilbert_values);
+    auto status = parallel_for(
+        &resources_.compute_tp(), 0, runs.size(), [&](uint64_t r) {
+          std::sort(
+              cell_pos_.begin() + runs[r].first,
+              cell_pos_.begin() + runs[r].second,
+              cmp);
+          return Status::Ok();
+        });
+    RETURN_NOT_OK(status);
   }
 
   return Status::Ok();
 }
 
+void UnorderedWriter::sort_coords_global_dispatch(
+    const Domain& domain, const DomainBuffersView& domain_buffs) {
+  auto sort_global = [&](auto&& cmp) {
+    parallel_sort(
+        &resources_.compute_tp(), cell_pos_.begin(), cell_pos_.end(), cmp);
+  };
+
+  // See if the domain shape allows a specialized comparator. All dimensions
+  // need to be fixed sized and of the same physical type.
+  const auto dim_num = domain.dim_num();
+  const auto type = domain.dimension_ptr(0)->type();
+  bool specialize = dim_num <= 3;
+  for (unsigned d = 0; specialize && d < dim_num; ++d) {
+    const auto dim{domain.dimension_ptr(d)};
+    specialize = !dim->var_size() && dim->type() == type;
+  }
+
+  if (specialize) {
+    // Datetime and time dimensions are backed by int64 values.
+    if (type == Datatype::INT64 || datatype_is_datetime(type) ||
+        datatype_is_time(type)) {
+      switch (dim_num) {
+        case 1:
+          return sort_global(
+              GlobalCmpQBSpecialized<int64_t, 1>(domain, domain_buffs));
+        case 2:
+          return sort_global(
+              GlobalCmpQBSpecialized<int64_t, 2>(domain, domain_buffs));
+        case 3:
+          return sort_global(
+              GlobalCmpQBSpecialized<int64_t, 3>(domain, domain_buffs));
+      }
+    } else if (type == Datatype::FLOAT64) {
+      switch (dim_num) {
+        case 1:
+          return sort_global(
+              GlobalCmpQBSpecialized<double, 1>(domain, domain_buffs));
+        case 2:
+          return sort_global(
+              GlobalCmpQBSpecialized<double, 2>(domain, domain_buffs));
+        case 3:
+          return sort_global(
+              GlobalCmpQBSpecialized<double, 3>(domain, domain_buffs));
+      }
+    }
+  }
+
+  sort_global(GlobalCmpQB(domain, domain_buffs));
+}
+
 Status UnorderedWriter::unordered_write() {
   // Applicable only to unordered write on sparse arrays
   assert(layout_ == Layout::UNORDERED);
@@ -698,9 +868,6 @@ Status UnorderedWriter::unordered_write() {
     set_coords_metadata(0, tile_num, tiles, mbrs, frag_meta_);
   }
 
-  // Compute tile metadata.
-  RETURN_CANCEL_OR_ERROR(compute_tiles_metadata(tile_num, tiles));
-
   // Filter all tiles
   RETURN_CANCEL_OR_ERROR(filter_tiles(&tiles));
 
@@ -717,15 +884,24 @@ Status UnorderedWriter::unordered_write() {
       array_schema_.dim_num() + array_schema_.attribute_num()) {
     // Compute fragment min/max/sum/null count and write the fragment metadata
     frag_meta_->compute_fragment_min_max_sum_null_count();
-    frag_meta_->store(array_->get_encryption_key());
+
+    if (streaming_ingest_) {
+      // Defer the metadata and commit writes; finalize() group commits all
+      // runs of the query in a single flush window.
+      streamed_run_meta_.emplace_back(frag_meta_);
+    } else {
+      frag_meta_->store(array_->get_encryption_key());
+    }
 
     // Add written fragment info
     RETURN_NOT_OK(add_written_fragment_info(frag_uri_.value()));
 
-    // The following will make the fragment visible
-    URI commit_uri =
-        array_->array_directory().get_commit_uri(frag_uri_.value());
-    throw_if_not_ok(resources_.vfs().touch(commit_uri));
+    if (!streaming_ingest_) {
+      // The following will make the fragment visible
+      URI commit_uri =
+          array_->array_directory().get_commit_uri(frag_uri_.value());
+      throw_if_not_ok(resources_.vfs().touch(commit_uri));
+    }
 
     // Clear some data to prevent it from being serialized.
     cell_pos_.clear();
@@ -136,6 +136,23 @@ class UnorderedWriter : public WriterBase {
    */
   bool is_coords_pass_;
 
+  /**
+   * If `true`, the writer accepts repeated complete buffer sets on the same
+   * query. Each batch is sorted and written as its own fragment (a run) and
+   * the runs are merged into a single fragment in global order when the
+   * query is finalized.
+   */
+  bool streaming_ingest_;
+
+  /** URIs of the run fragments written by the completed batches. */
+  std::vector<std::string> streamed_run_uris_;
+
+  /**
+   * Fragment metadata of the runs whose metadata and commit writes have
+   * been deferred to the group commit on finalize.
+   */
+  std::vector<shared_ptr<FragmentMetadata>> streamed_run_meta_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -143,6 +160,30 @@ class UnorderedWriter : public WriterBase {
   /** Invoked on error. It removes the directory of the input URI. */
   void clean_up();
 
+  /**
+   * Applicable only to streaming ingest. Records the fragment of the
+   * completed batch as a run and resets the per-batch state so that the
+   * buffers of the current submission start a new batch.
+   */
+  void start_new_run();
+
+  /**
+   * Applicable only to streaming ingest. Flushes the deferred fragment
+   * metadata of all runs in parallel and makes the runs visible with a
+   * single commit write, batching the per-fragment commit round trips of
+   * the query into one flush window. The fragments are durable once this
+   * returns.
+   */
+  void group_commit_runs();
+
+  /**
+   * Applicable only to streaming ingest. Merges the run fragments written
+   * by the batches into a single fragment in global order and vacuums the
+   * runs. The merge streams the runs through the consolidator, so it does
+   * not require the batches to be resident in memory at once.
+   */
+  void merge_streamed_runs();
+
   /**
    * Throws an error if there are coordinate duplicates.
    *
@@ -218,6 +259,19 @@ class UnorderedWriter : public WriterBase {
    */
   Status sort_coords();
 
+  /**
+   * Sorts the coordinates on the global (non Hilbert) order, selecting a
+   * comparator specialized for the domain shape when possible. Domains with
+   * up to three fixed sized dimensions, all of the same integer or floating
+   * point type, use a compile time specialized comparator that avoids
+   * per-dimension dynamic dispatch in the sort.
+   *
+   * @param domain The array domain.
+   * @param domain_buffs The coordinate query buffers, one per dimension.
+   */
+  void sort_coords_global_dispatch(
+      const Domain& domain, const DomainBuffersView& domain_buffs);
+
   /**
    * Writes in unordered layout. Applicable to both dense and sparse arrays.
    * Explicit coordinates must be provided for this write.
@@ -323,17 +323,25 @@ Status WriterBase::calculate_hilbert_values(
   auto bits = h.bits();
   auto max_bucket_val = ((uint64_t)1 << bits) - 1;
 
-  // Calculate Hilbert values in parallel
+  // Calculate Hilbert values in parallel, one batch of cells per task so
+  // that the batched conversion can amortize its setup across the batch.
   assert(hilbert_values.size() >= coords_info_.coords_num_);
+  constexpr uint64_t batch_size = 1024;
+  auto batch_num = (coords_info_.coords_num_ + batch_size - 1) / batch_size;
   auto status = parallel_for(
-      &resources_.compute_tp(), 0, coords_info_.coords_num_, [&](uint64_t c) {
-        std::vector<uint64_t> coords(dim_num);
-        for (uint32_t d = 0; d < dim_num; ++d) {
-          auto dim{array_schema_.dimension_ptr(d)};
-          coords[d] = hilbert_order::map_to_uint64(
-              *dim, domain_buffers[d], c, bits, max_bucket_val);
+      &resources_.compute_tp(), 0, batch_num, [&](uint64_t b) {
+        auto c_start = b * batch_size;
+        auto c_end = std::min(c_start + batch_size, coords_info_.coords_num_);
+        std::vector<uint64_t> coords((c_end - c_start) * dim_num);
+        for (uint64_t c = c_start; c < c_end; ++c) {
+          for (uint32_t d = 0; d < dim_num; ++d) {
+            auto dim{array_schema_.dimension_ptr(d)};
+            coords[(c - c_start) * dim_num + d] = hilbert_order::map_to_uint64(
+                *dim, domain_buffers[d], c, bits, max_bucket_val);
+          }
         }
-        hilbert_values[c] = h.coords_to_hilbert(&coords[0]);
+        h.coords_to_hilbert(
+            coords.data(), c_end - c_start, &hilbert_values[c_start]);
 
         return Status::Ok();
       });
@@ -689,57 +697,6 @@ void WriterBase::set_coords_metadata(
   meta->set_last_tile_cell_num(cell_num);
 }
 
-Status WriterBase::compute_tiles_metadata(
-    uint64_t tile_num,
-    tdb::pmr::unordered_map<std::string, WriterTileTupleVector>& tiles) const {
-  auto* compute_tp = &resources_.compute_tp();
-
-  // Parallelize over attributes?
-  if (tiles.size() > tile_num) {
-    auto st = parallel_for(compute_tp, 0, tiles.size(), [&](uint64_t i) {
-      auto tiles_it = tiles.begin();
-      std::advance(tiles_it, i);
-      const auto& attr = tiles_it->first;
-      auto& attr_tiles = tiles.at(attr);
-      const auto type = array_schema_.type(attr);
-      const auto is_dim = array_schema_.is_dim(attr);
-      const auto var_size = array_schema_.var_size(attr);
-      const auto cell_size = array_schema_.cell_size(attr);
-      const auto cell_val_num = array_schema_.cell_val_num(attr);
-      for (auto& tile : attr_tiles) {
-        TileMetadataGenerator md_generator(
-            type, is_dim, var_size, cell_size, cell_val_num);
-        md_generator.process_full_tile(tile);
-        md_generator.set_tile_metadata(tile);
-      }
-
-      return Status::Ok();
-    });
-    RETURN_NOT_OK(st);
-  } else {  // Parallelize over tiles
-    for (auto& tile_vec : tiles) {
-      const auto& attr = tile_vec.first;
-      auto& attr_tiles = tile_vec.second;
-      const auto type = array_schema_.type(attr);
-      const auto is_dim = array_schema_.is_dim(attr);
-      const auto var_size = array_schema_.var_size(attr);
-      const auto cell_size = array_schema_.cell_size(attr);
-      const auto cell_val_num = array_schema_.cell_val_num(attr);
-      auto st = parallel_for(compute_tp, 0, tile_num, [&](uint64_t t) {
-        TileMetadataGenerator md_generator(
-            type, is_dim, var_size, cell_size, cell_val_num);
-        md_generator.process_full_tile(attr_tiles[t]);
-        md_generator.set_tile_metadata(attr_tiles[t]);
-
-        return Status::Ok();
-      });
-      RETURN_NOT_OK(st);
-    }
-  }
-
-  return Status::Ok();
-}
-
 std::string WriterBase::coords_to_str(uint64_t i) const {
   std::stringstream ss;
   auto dim_num = array_schema_.dim_num();
@@ -796,12 +753,50 @@ Status WriterBase::create_fragment(
 
 Status WriterBase::filter_tiles(
     tdb::pmr::unordered_map<std::string, WriterTileTupleVector>* tiles) {
+  const uint64_t tile_num = tiles->empty() ? 0 : tiles->begin()->second.size();
+  return filter_tiles(0, tile_num, tiles);
+}
+
+Status WriterBase::filter_tiles(
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx,
+    tdb::pmr::unordered_map<std::string, WriterTileTupleVector>* tiles) {
   auto timer_se = stats_->start_timer("filter_tiles");
+
+  // Flatten the per-field tile lists into one global task list so that all
+  // (field, tile) pairs share the thread pool, instead of the remaining
+  // tiles of a large field filtering alone once the other fields are done.
+  std::vector<std::pair<const std::string*, WriterTileTuple*>> tasks;
+  tasks.reserve(tiles->size() * (end_tile_idx - start_tile_idx));
+  for (auto& [name, tile_vec] : *tiles) {
+    for (uint64_t t = start_tile_idx; t < end_tile_idx; t++) {
+      tasks.emplace_back(&name, &tile_vec[t]);
+    }
+  }
+
+  // Schedule the largest tiles first so that an expensive tile cannot start
+  // last and serialize the tail of the write.
+  auto tile_size = [](const WriterTileTuple& tile) {
+    uint64_t size = 0;
+    if (tile.var_size()) {
+      size = tile.offset_tile().size() + tile.var_tile().size();
+    } else {
+      size = tile.fixed_tile().size();
+    }
+
+    if (tile.nullable()) {
+      size += tile.validity_tile().size();
+    }
+
+    return size;
+  };
+  std::sort(tasks.begin(), tasks.end(), [&](const auto& a, const auto& b) {
+    return tile_size(*a.second) > tile_size(*b.second);
+  });
+
   auto status =
-      parallel_for(&resources_.compute_tp(), 0, tiles->size(), [&](uint64_t i) {
-        auto tiles_it = tiles->begin();
-        std::advance(tiles_it, i);
-        throw_if_not_ok(filter_tiles(tiles_it->first, &tiles_it->second));
+      parallel_for(&resources_.compute_tp(), 0, tasks.size(), [&](uint64_t i) {
+        throw_if_not_ok(filter_tile_tuple(*tasks[i].first, *tasks[i].second));
         throw_if_cancelled();
         return Status::Ok();
       });
@@ -812,48 +807,60 @@ Status WriterBase::filter_tiles(
 
 Status WriterBase::filter_tiles(
     const std::string& name, WriterTileTupleVector* tiles) {
-  const bool var_size = array_schema_.var_size(name);
-  const bool nullable = array_schema_.is_nullable(name);
-
-  // Filter all tiles
-  auto tile_num = tiles->size();
-
-  // Process all tiles, minus offsets, they get processed separately.
-  std::vector<std::tuple<WriterTile*, WriterTile*, bool, bool>> args;
-  args.reserve(tile_num * (1 + nullable));
-  for (auto& tile : *tiles) {
-    if (var_size) {
-      args.emplace_back(&tile.var_tile(), &tile.offset_tile(), false, false);
-    } else {
-      args.emplace_back(&tile.fixed_tile(), nullptr, false, false);
-    }
-
-    if (nullable) {
-      args.emplace_back(&tile.validity_tile(), nullptr, false, true);
-    }
-  }
+  return filter_tiles(name, tiles, 0, tiles->size());
+}
 
-  // For fixed size, process everything, for var size, everything minus offsets.
-  auto status =
-      parallel_for(&resources_.compute_tp(), 0, args.size(), [&](uint64_t i) {
-        const auto& [tile, offset_tile, contains_offsets, is_nullable] =
-            args[i];
-        throw_if_not_ok(filter_tile(
-            name, tile, offset_tile, contains_offsets, is_nullable));
+Status WriterBase::filter_tiles(
+    const std::string& name,
+    WriterTileTupleVector* tiles,
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx) {
+  // Process the tiles in parallel. The pipeline parallelizes over chunks
+  // internally, so writes with few tiles still use the full thread pool.
+  auto status = parallel_for(
+      &resources_.compute_tp(),
+      start_tile_idx,
+      end_tile_idx,
+      [&](uint64_t t) {
+        throw_if_not_ok(filter_tile_tuple(name, (*tiles)[t]));
         return Status::Ok();
       });
   RETURN_NOT_OK(status);
 
-  // Process offsets for var size.
+  return Status::Ok();
+}
+
+Status WriterBase::filter_tile_tuple(
+    const std::string& name, WriterTileTuple& tile) {
+  const auto type = array_schema_.type(name);
+  const bool is_dim = array_schema_.is_dim(name);
+  const bool var_size = array_schema_.var_size(name);
+  const auto cell_size = array_schema_.cell_size(name);
+  const auto cell_val_num = array_schema_.cell_val_num(name);
+  const bool nullable = array_schema_.is_nullable(name);
+
+  // Compute the tile metadata on the unfiltered data, right before running
+  // the filter pipeline so the tile bytes are still cached when they get
+  // compressed.
+  TileMetadataGenerator md_generator(
+      type, is_dim, var_size, cell_size, cell_val_num);
+  md_generator.process_full_tile(tile);
+  md_generator.set_tile_metadata(tile);
+
+  // Filter the tile, offsets last as the var tile filters may use them.
   if (var_size) {
-    auto status = parallel_for(
-        &resources_.compute_tp(), 0, tiles->size(), [&](uint64_t i) {
-          auto& tile = (*tiles)[i];
-          throw_if_not_ok(
-              filter_tile(name, &tile.offset_tile(), nullptr, true, false));
-          return Status::Ok();
-        });
-    RETURN_NOT_OK(status);
+    throw_if_not_ok(
+        filter_tile(name, &tile.var_tile(), &tile.offset_tile(), false, false));
+    throw_if_not_ok(
+        filter_tile(name, &tile.offset_tile(), nullptr, true, false));
+  } else {
+    throw_if_not_ok(
+        filter_tile(name, &tile.fixed_tile(), nullptr, false, false));
+  }
+
+  if (nullable) {
+    throw_if_not_ok(
+        filter_tile(name, &tile.validity_tile(), nullptr, false, true));
   }
 
   return Status::Ok();
@@ -898,11 +905,18 @@ Status WriterBase::filter_tile(
   bool use_chunking = filters.use_tile_chunking(
       array_schema_.var_size(name), array_schema_.version(), tile->type());
 
+  const auto unfiltered_size = tile->size();
+
   assert(!tile->filtered());
   filters.run_forward(
       stats_, tile, offsets_tile, &resources_.compute_tp(), use_chunking);
   assert(tile->filtered());
 
+  // Track the running pre- and post-filter byte totals, so the online
+  // compression ratio of the write is visible in the stats report.
+  stats_->add_counter("pre_filter_bytes", unfiltered_size);
+  stats_->add_counter("post_filter_bytes", tile->filtered_buffer().size());
+
   return Status::Ok();
 }
 
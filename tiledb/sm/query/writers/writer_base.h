@@ -267,18 +267,6 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
       const std::vector<NDRange>& mbrs,
       shared_ptr<FragmentMetadata> meta) const;
 
-  /**
-   * Computes the tiles metadata (min/max/sum/null count).
-   *
-   * @param tile_num The number of tiles.
-   * @param tiles The tiles to calculate the tile metadata from. It is
-   *     a map of vectors, one vector of tiles per dimension.
-   * @return Status
-   */
-  Status compute_tiles_metadata(
-      uint64_t tile_num,
-      tdb::pmr::unordered_map<std::string, WriterTileTupleVector>& tiles) const;
-
   /**
    * Returns the i-th coordinates in the coordinate buffers in string
    * format.
@@ -305,6 +293,21 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
   Status filter_tiles(
       tdb::pmr::unordered_map<std::string, WriterTileTupleVector>* tiles);
 
+  /**
+   * Runs the input coordinate and attribute tiles in the range
+   * [start_tile_idx, end_tile_idx) through their filter pipelines. The tile
+   * buffers are modified to contain the output of the pipeline.
+   *
+   * @param start_tile_idx Index of the first tile to filter.
+   * @param end_tile_idx Index past the last tile to filter.
+   * @param tiles The tiles to be filtered.
+   * @return Status
+   */
+  Status filter_tiles(
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx,
+      tdb::pmr::unordered_map<std::string, WriterTileTupleVector>* tiles);
+
   /**
    * Runs the input tiles for the input attribute through the filter pipeline.
    * The tile buffers are modified to contain the output of the pipeline.
@@ -315,6 +318,34 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
    */
   Status filter_tiles(const std::string& name, WriterTileTupleVector* tiles);
 
+  /**
+   * Runs the input tiles in the range [start_tile_idx, end_tile_idx) for the
+   * input attribute through the filter pipeline. The tile buffers are
+   * modified to contain the output of the pipeline.
+   *
+   * @param name The attribute/dimension the tiles belong to.
+   * @param tile The tiles to be filtered.
+   * @param start_tile_idx Index of the first tile to filter.
+   * @param end_tile_idx Index past the last tile to filter.
+   * @return Status
+   */
+  Status filter_tiles(
+      const std::string& name,
+      WriterTileTupleVector* tiles,
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx);
+
+  /**
+   * Computes the metadata of one tile tuple and runs its fixed, var and
+   * validity tiles through their filter pipelines. The tile buffers are
+   * modified to contain the output of the pipelines.
+   *
+   * @param name The attribute/dimension the tile belongs to.
+   * @param tile The tile to be filtered.
+   * @return Status
+   */
+  Status filter_tile_tuple(const std::string& name, WriterTileTuple& tile);
+
   /**
    * Runs the input tile for the input attribute/dimension through the filter
    * pipeline. The tile buffer is modified to contain the output of the
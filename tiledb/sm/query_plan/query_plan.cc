@@ -33,7 +33,9 @@
 #include "tiledb/sm/query_plan/query_plan.h"
 
 #include "tiledb/sm/array/array.h"
+#include "tiledb/sm/config/config.h"
 #include "tiledb/sm/enums/array_type.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/filesystem/uri.h"
@@ -91,6 +93,51 @@ QueryPlan::QueryPlan(Query& query) {
 
   std::sort(attributes_.begin(), attributes_.end());
   std::sort(dimensions_.begin(), dimensions_.end());
+
+  // Per-fragment statistics and coarse cost estimates, computed from the
+  // fragment metadata footers already loaded at array open. No subarray
+  // pruning is applied, so the estimates are upper bounds.
+  const auto& schema = query.array()->array_schema_latest();
+  uint64_t fixed_cell_size = 0;
+  for (auto& buf : query.buffer_names()) {
+    if (schema.is_field(buf) && !schema.var_size(buf)) {
+      fixed_cell_size += schema.cell_size(buf);
+    }
+  }
+  for (auto& frag : query.array()->fragment_metadata()) {
+    FragmentPlanInfo info;
+    info.name = frag->fragment_uri().last_path_part();
+    info.tile_num = frag->tile_num();
+    info.cell_num = frag->cell_num();
+    info.persisted_bytes = 0;
+    for (auto size : frag->file_sizes()) {
+      info.persisted_bytes += size;
+    }
+    for (auto size : frag->file_var_sizes()) {
+      info.persisted_bytes += size;
+    }
+    for (auto size : frag->file_validity_sizes()) {
+      info.persisted_bytes += size;
+    }
+    est_read_bytes_ += info.persisted_bytes;
+    // Fixed-size fields unfilter to cell_num * cell_size; var-size fields
+    // are approximated by their persisted size.
+    est_unfiltered_bytes_ += info.cell_num * fixed_cell_size;
+    for (auto size : frag->file_var_sizes()) {
+      est_unfiltered_bytes_ += size;
+    }
+    fragments_.emplace_back(std::move(info));
+  }
+
+  // Budgeted readers cap their working set at the memory budget.
+  auto memory_budget =
+      query.config().get<uint64_t>("sm.mem.total_budget", Config::must_find);
+  est_memory_high_water_ =
+      std::min(memory_budget, est_read_bytes_ + est_unfiltered_bytes_);
+
+  // Capture a flattened stats snapshot; when the plan is requested after
+  // the query has executed this doubles as an execution trace.
+  stats_ = query.stats()->snapshot();
 }
 
 QueryPlan::QueryPlan(
@@ -113,28 +160,40 @@ QueryPlan::QueryPlan(
 /*                API                */
 /* ********************************* */
 std::string QueryPlan::dump_json(uint32_t indent) {
-  nlohmann::json rv;
+  nlohmann::json plan;
+  plan["Array.URI"] = array_uri_;
+  plan["Array.Type"] = array_type_str(array_type_);
   if (!URI(array_uri_).is_tiledb()) {
-    rv = {
-        {"TileDB Query Plan",
-         {{"Array.URI", array_uri_},
-          {"Array.Type", array_type_str(array_type_)},
-          {"VFS.Backend", vfs_backend_},
-          {"Query.Layout", layout_str(query_layout_)},
-          {"Query.Strategy.Name", strategy_name_},
-          {"Query.Attributes", attributes_},
-          {"Query.Dimensions", dimensions_}}}};
-  } else {
-    rv = {
-        {"TileDB Query Plan",
-         {{"Array.URI", array_uri_},
-          {"Array.Type", array_type_str(array_type_)},
-          {"Query.Layout", layout_str(query_layout_)},
-          {"Query.Strategy.Name", strategy_name_},
-          {"Query.Attributes", attributes_},
-          {"Query.Dimensions", dimensions_}}}};
+    plan["VFS.Backend"] = vfs_backend_;
+  }
+  plan["Query.Layout"] = layout_str(query_layout_);
+  plan["Query.Strategy.Name"] = strategy_name_;
+  plan["Query.Attributes"] = attributes_;
+  plan["Query.Dimensions"] = dimensions_;
+
+  if (!fragments_.empty()) {
+    nlohmann::json fragments = nlohmann::json::array();
+    for (const auto& frag : fragments_) {
+      fragments.push_back(
+          {{"Name", frag.name},
+           {"Tile.Num", frag.tile_num},
+           {"Cell.Num", frag.cell_num},
+           {"Persisted.Bytes", frag.persisted_bytes}});
+    }
+    plan["Fragments"] = fragments;
+    plan["Est.Read.Bytes"] = est_read_bytes_;
+    plan["Est.Unfiltered.Bytes"] = est_unfiltered_bytes_;
+    plan["Est.Memory.HighWater.Bytes"] = est_memory_high_water_;
+  }
+
+  // Present only after stats have been collected, i.e. when the plan is
+  // taken from a query that has executed.
+  if (!stats_.timers().empty() || !stats_.counters().empty()) {
+    plan["Stats.Timers"] = stats_.timers();
+    plan["Stats.Counters"] = stats_.counters();
   }
 
+  nlohmann::json rv = {{"TileDB Query Plan", plan}};
   return rv.dump(indent);
 }
 
@@ -36,6 +36,7 @@
 #include <string>
 #include <vector>
 #include "tiledb/common/common.h"
+#include "tiledb/sm/stats/stats.h"
 
 using namespace tiledb::common;
 
@@ -51,6 +52,25 @@ enum class ArrayType : uint8_t;
  */
 class QueryPlan {
  public:
+  /* ****************************** */
+  /*         PUBLIC DATATYPES       */
+  /* ****************************** */
+
+  /** Per-fragment statistics included in the plan. */
+  struct FragmentPlanInfo {
+    /** The fragment name. */
+    std::string name;
+
+    /** The number of tiles in the fragment. */
+    uint64_t tile_num;
+
+    /** The number of cells in the fragment. */
+    uint64_t cell_num;
+
+    /** The persisted (filtered) size of the fragment's data files. */
+    uint64_t persisted_bytes;
+  };
+
   /* ****************************** */
   /*   CONSTRUCTORS & DESTRUCTORS   */
   /* ****************************** */
@@ -134,6 +154,13 @@ class QueryPlan {
     return dimensions_;
   }
 
+  /*
+   * Get the per-fragment statistics stored in the query plan.
+   */
+  inline const std::vector<FragmentPlanInfo>& fragments() const {
+    return fragments_;
+  }
+
  private:
   /* ****************************** */
   /*       PRIVATE ATTRIBUTES       */
@@ -159,6 +186,21 @@ class QueryPlan {
 
   /** A list of queried dimensions */
   std::vector<std::string> dimensions_;
+
+  /** Per-fragment statistics, empty for remote plans */
+  std::vector<FragmentPlanInfo> fragments_;
+
+  /** Estimated bytes read from storage, an upper bound with no pruning */
+  uint64_t est_read_bytes_ = 0;
+
+  /** Estimated bytes produced by unfiltering the read data */
+  uint64_t est_unfiltered_bytes_ = 0;
+
+  /** Coarse memory high-water estimate, capped at the memory budget */
+  uint64_t est_memory_high_water_ = 0;
+
+  /** Snapshot of the query stats, an execution trace when taken post-run */
+  stats::StatsData stats_;
 };
 
 }  // namespace sm
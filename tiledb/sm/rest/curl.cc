@@ -39,6 +39,7 @@
 #include "tiledb/sm/stats/global_stats.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -60,7 +61,8 @@ struct WriteCbState {
   WriteCbState()
       : reset(true)
       , arg(NULL)
-      , skip_retries(false) {
+      , skip_retries(false)
+      , curl(NULL) {
   }
 
   /** True if this is the first write callback invoked in a request retry. */
@@ -71,6 +73,9 @@ struct WriteCbState {
 
   /** True if the internal curl retries should be skipped. */
   bool skip_retries;
+
+  /** The curl easy handle of the request, for querying transfer info. */
+  CURL* curl;
 };
 
 /**
@@ -96,6 +101,24 @@ size_t write_memory_callback(
     buffer->set_size(0);
     buffer->reset_offset();
     write_cb_state->reset = false;
+
+    // Reserve the full response upfront when the server announced its
+    // length, so that large responses land in one allocation instead of
+    // being copied on every growth of the buffer.
+    curl_off_t content_length = 0;
+    if (write_cb_state->curl != nullptr &&
+        curl_easy_getinfo(
+            write_cb_state->curl,
+            CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,
+            &content_length) == CURLE_OK &&
+        content_length > 0) {
+      auto st = buffer->realloc(static_cast<uint64_t>(content_length));
+      if (!st.ok()) {
+        LOG_ERROR(
+            "Cannot reserve libcurl response buffer: " + st.to_string());
+        return 0;
+      }
+    }
   }
 
   auto st = buffer->write(contents, content_nbytes);
@@ -250,6 +273,45 @@ size_t write_header_callback(
   return size * count;
 }
 
+/** Per-data mutexes used by the libcurl share handle lock callbacks. */
+static std::array<std::mutex, CURL_LOCK_DATA_LAST> curl_share_locks_;
+
+static void curl_share_lock_cb(
+    CURL*, curl_lock_data data, curl_lock_access, void*) {
+  curl_share_locks_[data].lock();
+}
+
+static void curl_share_unlock_cb(CURL*, curl_lock_data data, void*) {
+  curl_share_locks_[data].unlock();
+}
+
+/**
+ * Returns the process-wide libcurl share handle, or `nullptr` if it could
+ * not be created.
+ *
+ * The share handle pools connections, DNS entries and TLS sessions across
+ * all easy handles, so that the sequential requests of a remote array open
+ * and concurrent remote queries reuse established connections instead of
+ * re-handshaking per request. The handle is intentionally never cleaned
+ * up: easy handles may still reference it during process teardown.
+ */
+static CURLSH* curl_share_handle() {
+  static CURLSH* share = []() -> CURLSH* {
+    CURLSH* sh = curl_share_init();
+    if (sh == nullptr) {
+      return nullptr;
+    }
+
+    curl_share_setopt(sh, CURLSHOPT_LOCKFUNC, curl_share_lock_cb);
+    curl_share_setopt(sh, CURLSHOPT_UNLOCKFUNC, curl_share_unlock_cb);
+    curl_share_setopt(sh, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    curl_share_setopt(sh, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(sh, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    return sh;
+  }();
+  return share;
+}
+
 Curl::Curl(const std::shared_ptr<Logger>& logger)
     : config_(nullptr)
     , curl_(nullptr, curl_easy_cleanup)
@@ -302,6 +364,18 @@ Status Curl::init(
     return LOG_STATUS(Status_RestError(
         "Error initializing libcurl; failed to set CURLOPT_HEADERDATA"));
 
+  // Pool connections, DNS entries and TLS sessions across all easy handles
+  // and prefer multiplexing requests over one HTTP/2 connection instead of
+  // opening a new connection per request. HTTP/2 is negotiated over TLS and
+  // falls back to HTTP/1.1 when the server does not support it.
+  auto share = curl_share_handle();
+  if (share != nullptr) {
+    curl_easy_setopt(curl_.get(), CURLOPT_SHARE, share);
+  }
+  curl_easy_setopt(
+      curl_.get(), CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+  curl_easy_setopt(curl_.get(), CURLOPT_PIPEWAIT, 1L);
+
   SSLConfig ssl_cfg = RestSSLConfig(*config_);
 
   if (ssl_cfg.verify() == false) {
@@ -493,6 +567,7 @@ Status Curl::make_curl_request_common(
   for (uint8_t i = 0; i <= retry_count_; i++) {
     WriteCbState write_cb_state;
     write_cb_state.arg = write_cb_arg;
+    write_cb_state.curl = curl;
 
     /* set url to fetch */
     curl_easy_setopt(curl, CURLOPT_URL, url);
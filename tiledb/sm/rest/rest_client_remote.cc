@@ -88,6 +88,7 @@ RestClientRemote::RestClientRemote(
     , config_(&config)
     , compute_tp_(&compute_tp)
     , resubmit_incomplete_(true)
+    , query_deadline_ms_(0)
     , logger_(logger.clone("curl ", ++logger_id_))
     , memory_tracker_(tracker) {
   // Setting the type of the memory tracker as MemoryTrackerType::REST_CLIENT
@@ -101,6 +102,9 @@ RestClientRemote::RestClientRemote(
 
   auto ri = config.get<bool>("rest.resubmit_incomplete");
   resubmit_incomplete_ = ri.value_or(false);
+
+  auto qd = config.get<uint64_t>("rest.query_deadline_ms");
+  query_deadline_ms_ = qd.value_or(0);
 }
 
 bool RestClientRemote::use_refactored_query(const Config& config) {
@@ -796,17 +800,26 @@ Status RestClientRemote::post_query_submit(
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
       curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+  // A read deadline is incompatible with reading all data server-side: the
+  // server returns whatever result batches completed by the deadline and
+  // the client resumes through the regular incomplete-query path.
+  const bool deadline_set =
+      query_deadline_ms_ > 0 && query->type() == QueryType::READ;
+  const bool read_all = resubmit_incomplete_ && !deadline_set;
   std::string url;
   if (use_refactored_query(query->config())) {
     url = redirect_uri(cache_key) + "/v3/arrays/" + array_ns + "/" +
           curlc.url_escape(array_uri) +
           "/query/submit?type=" + query_type_str(query->type()) +
-          "&read_all=" + (resubmit_incomplete_ ? "true" : "false");
+          "&read_all=" + (read_all ? "true" : "false");
   } else {
     url = redirect_uri(cache_key) + "/v2/arrays/" + array_ns + "/" +
           curlc.url_escape(array_uri) +
           "/query/submit?type=" + query_type_str(query->type()) +
-          "&read_all=" + (resubmit_incomplete_ ? "true" : "false");
+          "&read_all=" + (read_all ? "true" : "false");
+  }
+  if (deadline_set) {
+    url += "&deadline_ms=" + std::to_string(query_deadline_ms_);
   }
 
   // Remote array reads always supply the timestamp.
@@ -900,53 +913,62 @@ size_t RestClientRemote::query_post_call_back(
   // a previous callback.
   bytes_processed -= scratch->size();
 
-  // Copy 'contents' to the end of 'scratch'. As a future optimization, if
-  // 'scratch' is empty, we could attempt to process 'contents' in-place and
-  // only copy the remaining, unprocessed bytes into 'scratch'.
-  scratch->set_offset(scratch->size());
-  Status st = scratch->write(contents, content_nbytes);
-  if (!st.ok()) {
-    LOG_ERROR(
-        "Cannot copy libcurl response data; buffer write failed: " +
-        st.to_string());
-    return return_wrapper(bytes_processed);
+  // When 'scratch' is empty, no partial message was carried over from a
+  // previous callback and we can process 'contents' in place, copying only
+  // the remaining, unprocessed bytes into 'scratch'. Otherwise, append
+  // 'contents' to 'scratch' and process from there.
+  Buffer contents_view(contents, content_nbytes);
+  Buffer* buf;
+  Status st;
+  if (scratch->size() == 0 && content_nbytes > 0) {
+    buf = &contents_view;
+  } else {
+    scratch->set_offset(scratch->size());
+    st = scratch->write(contents, content_nbytes);
+    if (!st.ok()) {
+      LOG_ERROR(
+          "Cannot copy libcurl response data; buffer write failed: " +
+          st.to_string());
+      return return_wrapper(bytes_processed);
+    }
+    buf = scratch.get();
   }
 
-  // Process all of the serialized queries contained within 'scratch'.
-  scratch->reset_offset();
-  while (scratch->offset() < scratch->size()) {
+  // Process all of the serialized queries contained within 'buf'.
+  buf->reset_offset();
+  while (buf->offset() < buf->size()) {
     // We need at least 8 bytes to determine the size of the next
     // serialized query.
-    if (scratch->offset() + 8 > scratch->size()) {
+    if (buf->offset() + 8 > buf->size()) {
       break;
     }
 
     // Decode the query size. We could cache this from the previous
     // callback to prevent decoding the same prefix multiple times.
     const uint64_t query_size =
-        utils::endianness::decode_le<uint64_t>(scratch->cur_data());
+        utils::endianness::decode_le<uint64_t>(buf->cur_data());
 
     // We must have the full serialized query before attempting to
     // deserialize it.
-    if (scratch->offset() + 8 + query_size > scratch->size()) {
+    if (buf->offset() + 8 + query_size > buf->size()) {
       break;
     }
 
     // At this point of execution, we know that we the next serialized
-    // query is entirely in 'scratch'. For convenience, we will advance
+    // query is entirely in 'buf'. For convenience, we will advance
     // the offset to point to the start of the serialized query.
-    scratch->advance_offset(8);
+    buf->advance_offset(8);
 
     // We can only deserialize the query if it is 8-byte aligned. If the
-    // offset is 8-byte aligned, we can deserialize the query in-place.
+    // data is 8-byte aligned, we can deserialize the query in-place.
     // Otherwise, we must make a copy to an auxiliary buffer.
-    if (scratch->offset() % 8 != 0) {
+    if (reinterpret_cast<uintptr_t>(buf->cur_data()) % 8 != 0) {
       // Copy the entire serialized buffer to a newly allocated, 8-byte
       // aligned auxiliary buffer.
       Buffer aux;
-      st = aux.write(scratch->cur_data(), query_size);
+      st = aux.write(buf->cur_data(), query_size);
       if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
+        buf->set_offset(buf->offset() - 8);
         return return_wrapper(bytes_processed);
       }
 
@@ -958,7 +980,7 @@ size_t RestClientRemote::query_post_call_back(
       st = serialization::query_deserialize(
           aux, serialization_type_, true, copy_state, query, compute_tp_);
       if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
+        buf->set_offset(buf->offset() - 8);
         return return_wrapper(bytes_processed);
       }
     } else {
@@ -967,14 +989,14 @@ size_t RestClientRemote::query_post_call_back(
       // data when deserializing read queries, this will return an
       // error status.
       st = serialization::query_deserialize(
-          *scratch, serialization_type_, true, copy_state, query, compute_tp_);
+          *buf, serialization_type_, true, copy_state, query, compute_tp_);
       if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
+        buf->set_offset(buf->offset() - 8);
         return return_wrapper(bytes_processed);
       }
     }
 
-    scratch->advance_offset(query_size);
+    buf->advance_offset(query_size);
     bytes_processed += (query_size + 8);
   }
 
@@ -982,9 +1004,16 @@ size_t RestClientRemote::query_post_call_back(
   // here because from the point of view of libcurl we have processed any
   // remaining bytes in our scratch buffer even though we won't get to
   // deserializing them on the next invocation of this callback.
-  const uint64_t length = scratch->size() - scratch->offset();
+  const uint64_t length = buf->size() - buf->offset();
 
-  if (scratch->offset() != 0) {
+  if (buf == &contents_view) {
+    // Carry the unprocessed remainder of 'contents' over to the next
+    // callback.
+    if (length > 0) {
+      scratch->reset_offset();
+      throw_if_not_ok(scratch->write(buf->cur_data(), length));
+    }
+  } else if (scratch->offset() != 0) {
     // Save any unprocessed query data in scratch by copying it to an
     // auxillary buffer before we truncate scratch. Then copy any unprocessed
     // bytes back into scratch.
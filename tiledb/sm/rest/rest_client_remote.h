@@ -478,6 +478,14 @@ class RestClientRemote : public RestClient {
    */
   bool resubmit_incomplete_;
 
+  /**
+   * Deadline for remote read queries in milliseconds; zero means no
+   * deadline. When set, the server returns whatever result batches
+   * completed by the deadline and the remaining work is picked up through
+   * the regular incomplete-query resubmission path.
+   */
+  uint64_t query_deadline_ms_;
+
   /** Array URI to redirected server mapping. */
   std::unordered_map<std::string, std::string> redirect_meta_;
 
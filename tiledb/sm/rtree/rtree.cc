@@ -36,14 +36,18 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/storage_format/serialization/serializers.h"
+#include "tiledb/type/apply_with_type.h"
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <list>
+#include <numeric>
 
 /** Class for locally generated status exceptions. */
 class RTreeException : public StatusException {
@@ -58,6 +62,30 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+/**
+ * Marks every tile whose packed MBR range on one dimension intersects the
+ * query range. The loop body is branch-free over contiguous arrays so
+ * that compilers can vectorize it.
+ */
+template <class T>
+void intersect_packed_dim(
+    const Range& range,
+    const void* mins,
+    const void* maxs,
+    uint64_t mbr_num,
+    std::vector<uint8_t>* tile_bitmap) {
+  auto r = static_cast<const T*>(range.data());
+  auto min = static_cast<const T*>(mins);
+  auto max = static_cast<const T*>(maxs);
+  const T range_start = r[0];
+  const T range_end = r[1];
+  auto bitmap = tile_bitmap->data();
+  for (uint64_t i = 0; i < mbr_num; ++i) {
+    bitmap[i] |=
+        static_cast<uint8_t>(!(range_start > max[i] || range_end < min[i]));
+  }
+}
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
@@ -79,6 +107,10 @@ RTree::~RTree() = default;
 /* ****************************** */
 
 void RTree::build_tree() {
+  build_tree(nullptr);
+}
+
+void RTree::build_tree(ThreadPool* compute_tp) {
   if (levels_.empty()) {
     return;
   }
@@ -88,23 +120,29 @@ void RTree::build_tree() {
   auto leaf_num = levels_[0].size();
   assert(leaf_num >= 1);
   if (leaf_num == 1) {
+    build_packed_levels();
     return;
   }
 
-  // Build the tree bottom up
+  // Build the tree bottom up. Each level depends on the one below it,
+  // so the levels are built in order, but the MBRs within a level are
+  // computed in parallel.
   auto height = (size_t)std::ceil(utils::math::log(fanout_, leaf_num)) + 1;
   for (size_t i = 0; i < height - 1; ++i) {
-    auto new_level = build_level(levels_.back());
+    auto new_level = build_level(levels_.back(), compute_tp);
     levels_.emplace_back(new_level);
   }
 
   // Make the root as the first level
   std::reverse(std::begin(levels_), std::end(levels_));
+
+  build_packed_levels();
 }
 
 uint64_t RTree::free_memory() {
   auto ret = deserialized_buffer_size_;
   levels_.clear();
+  packed_levels_.clear();
   deserialized_buffer_size_ = 0;
   return ret;
 }
@@ -170,12 +208,101 @@ TileOverlap RTree::get_tile_overlap(
   return overlap;
 }
 
+std::vector<TileOverlap> RTree::get_tile_overlaps(
+    const std::vector<const NDRange*>& ranges,
+    std::vector<bool>& is_default) const {
+  std::vector<TileOverlap> overlaps(ranges.size());
+
+  // Empty tree
+  if (domain_ == nullptr || levels_.empty() || ranges.empty())
+    return overlaps;
+
+  // This will keep track of the traversal. The root entry starts with
+  // all ranges as candidates; each node prunes its candidate list before
+  // descending, so a node is visited once for the whole batch.
+  std::list<BulkEntry> traversal;
+  std::vector<uint64_t> range_idx(ranges.size());
+  std::iota(range_idx.begin(), range_idx.end(), 0);
+  traversal.push_front({0, 0, std::move(range_idx)});
+  auto leaf_num = levels_.back().size();
+  auto height = this->height();
+
+  while (!traversal.empty()) {
+    // Get next entry
+    auto entry = std::move(traversal.front());
+    traversal.pop_front();
+    const auto& mbr = levels_[entry.level_][entry.mbr_idx_];
+
+    std::vector<uint64_t> partial;
+    for (auto r : entry.range_idx_) {
+      // Get overlap ratio
+      auto ratio = domain_->overlap_ratio(*ranges[r], is_default, mbr);
+
+      // No overlap
+      if (ratio == 0.0)
+        continue;
+
+      // If there is full overlap
+      if (ratio == 1.0) {
+        auto subtree_leaf_num = this->subtree_leaf_num(entry.level_);
+        assert(subtree_leaf_num > 0);
+        uint64_t start = entry.mbr_idx_ * subtree_leaf_num;
+        uint64_t end = start + std::min(subtree_leaf_num, leaf_num - start) - 1;
+        overlaps[r].tile_ranges_.emplace_back(start, end);
+      } else if (entry.level_ == height - 1) {
+        // Partial overlap with a leaf, insert into results
+        overlaps[r].tiles_.emplace_back(entry.mbr_idx_, ratio);
+      } else {
+        // Partial overlap with an inner node, descend with this range
+        partial.emplace_back(r);
+      }
+    }
+
+    // Insert all "children" to traversal with the surviving ranges
+    if (!partial.empty()) {
+      auto next_mbr_num = (uint64_t)levels_[entry.level_ + 1].size();
+      auto start = entry.mbr_idx_ * fanout_;
+      auto end = std::min(start + fanout_ - 1, next_mbr_num - 1);
+      for (uint64_t i = start; i <= end; ++i)
+        traversal.push_front({entry.level_ + 1, end - (i - start), partial});
+    }
+  }
+
+  return overlaps;
+}
+
 void RTree::compute_tile_bitmap(
     const Range& range, unsigned d, std::vector<uint8_t>* tile_bitmap) const {
   // Empty tree
   if (domain_ == nullptr || levels_.empty())
     return;
 
+  // Fast path: scan the packed leaf arrays with a vectorized intersection
+  // kernel instead of traversing the tree. The scan touches only the
+  // contiguous min/max arrays of dimension `d`, so even for selective
+  // ranges it beats the pointer-chasing traversal below.
+  if (!packed_levels_.empty() && !packed_levels_.back()[d].mins.empty()) {
+    const auto& packed = packed_levels_.back()[d];
+    const auto mbr_num = levels_.back().size();
+    if (tile_bitmap->size() < mbr_num) {
+      throw RTreeException("Cannot compute tile bitmap; Bitmap too small");
+    }
+    apply_with_type(
+        [&](auto type) {
+          using T = decltype(type);
+          if constexpr (tiledb::type::TileDBNumeric<T>) {
+            intersect_packed_dim<T>(
+                range,
+                packed.mins.data(),
+                packed.maxs.data(),
+                mbr_num,
+                tile_bitmap);
+          }
+        },
+        domain_->dimension_ptr(d)->type());
+    return;
+  }
+
   // This will keep track of the traversal
   std::list<Entry> traversal;
   traversal.push_front({0, 0});
@@ -277,12 +404,16 @@ void RTree::set_leaf(uint64_t leaf_id, const NDRange& mbr) {
     throw RTreeException("Cannot set leaf; Invalid lead index");
 
   levels_[0][leaf_id] = mbr;
+
+  // The packed arrays are stale until the tree is rebuilt.
+  packed_levels_.clear();
 }
 
 void RTree::set_leaves(const tdb::pmr::vector<NDRange>& mbrs) {
   levels_.clear();
   levels_.resize(1);
   levels_[0].assign(mbrs.begin(), mbrs.end());
+  build_packed_levels();
 }
 
 void RTree::set_leaf_num(uint64_t num) {
@@ -296,6 +427,9 @@ void RTree::set_leaf_num(uint64_t num) {
         "cannot be smaller than the current leaf number");
 
   levels_[0].resize(num);
+
+  // The packed arrays are stale until the tree is rebuilt.
+  packed_levels_.clear();
 }
 
 void RTree::deserialize(
@@ -318,23 +452,80 @@ void RTree::reset(const Domain* domain, unsigned int fanout) {
 /*          PRIVATE METHODS       */
 /* ****************************** */
 
-RTree::Level RTree::build_level(const Level& level) {
+RTree::Level RTree::build_level(const Level& level, ThreadPool* compute_tp) {
   auto cur_mbr_num = (uint64_t)level.size();
   Level new_level(
       (uint64_t)std::ceil((double)cur_mbr_num / fanout_),
       memory_tracker_->get_resource(MemoryType::RTREE));
   auto new_mbr_num = (uint64_t)new_level.size();
 
-  uint64_t mbrs_visited = 0;
-  for (uint64_t i = 0; i < new_mbr_num; ++i) {
-    auto mbr_num = std::min((uint64_t)fanout_, cur_mbr_num - mbrs_visited);
-    for (uint64_t j = 0; j < mbr_num; ++j, ++mbrs_visited)
-      domain_->expand_ndrange(level[mbrs_visited], &new_level[i]);
+  // New MBR `i` covers exactly the children `[i * fanout_,
+  // (i + 1) * fanout_)` of the input level, so all new MBRs can be
+  // computed independently.
+  auto expand_mbr = [&](uint64_t i) {
+    auto first = i * fanout_;
+    auto last = std::min(first + fanout_, cur_mbr_num);
+    for (uint64_t j = first; j < last; ++j)
+      domain_->expand_ndrange(level[j], &new_level[i]);
+    return Status::Ok();
+  };
+
+  if (compute_tp != nullptr && new_mbr_num > 1) {
+    throw_if_not_ok(parallel_for(compute_tp, 0, new_mbr_num, expand_mbr));
+  } else {
+    for (uint64_t i = 0; i < new_mbr_num; ++i)
+      throw_if_not_ok(expand_mbr(i));
   }
 
   return {new_level, memory_tracker_->get_resource(MemoryType::RTREE)};
 }
 
+void RTree::build_packed_levels() {
+  packed_levels_.clear();
+  if (domain_ == nullptr || levels_.empty()) {
+    return;
+  }
+
+  auto dim_num = domain_->dim_num();
+  packed_levels_.reserve(levels_.size());
+  for (const auto& level : levels_) {
+    auto mbr_num = level.size();
+    PackedLevel packed;
+    packed.reserve(dim_num);
+    for (unsigned d = 0; d < dim_num; ++d) {
+      auto* resource = memory_tracker_->get_resource(MemoryType::RTREE);
+      PackedDim packed_dim{
+          tdb::pmr::vector<uint8_t>(resource),
+          tdb::pmr::vector<uint8_t>(resource)};
+      auto dim = domain_->dimension_ptr(d);
+      if (!dim->var_size()) {
+        auto coord_size = dim->coord_size();
+        packed_dim.mins.resize(mbr_num * coord_size);
+        packed_dim.maxs.resize(mbr_num * coord_size);
+        bool packable = true;
+        for (uint64_t m = 0; m < mbr_num; ++m) {
+          const auto& mbr = level[m];
+          if (mbr.size() != dim_num || mbr[d].empty()) {
+            // The level is still being populated; leave it unpacked.
+            packable = false;
+            break;
+          }
+          auto data = static_cast<const uint8_t*>(mbr[d].data());
+          std::memcpy(&packed_dim.mins[m * coord_size], data, coord_size);
+          std::memcpy(
+              &packed_dim.maxs[m * coord_size], data + coord_size, coord_size);
+        }
+        if (!packable) {
+          packed_dim.mins.clear();
+          packed_dim.maxs.clear();
+        }
+      }
+      packed.emplace_back(std::move(packed_dim));
+    }
+    packed_levels_.emplace_back(std::move(packed));
+  }
+}
+
 void RTree::deserialize_v1_v4(
     Deserializer& deserializer, const Domain* domain) {
   deserialized_buffer_size_ = deserializer.size();
@@ -372,6 +563,7 @@ void RTree::deserialize_v1_v4(
   }
 
   domain_ = domain;
+  build_packed_levels();
 }
 
 void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
@@ -417,6 +609,7 @@ void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
   }
 
   domain_ = domain;
+  build_packed_levels();
 }
 
 }  // namespace sm
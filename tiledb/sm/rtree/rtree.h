@@ -37,6 +37,7 @@
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/pmr.h"
+#include "tiledb/common/thread_pool/thread_pool.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/misc/tile_overlap.h"
 #include "tiledb/storage_format/serialization/serializers.h"
@@ -84,6 +85,18 @@ class RTree {
   /** Builds the RTree bottom-up on the current leaf level. */
   void build_tree();
 
+  /**
+   * Builds the RTree bottom-up on the current leaf level, computing the
+   * MBRs of each level in parallel on the input thread pool. The leaves
+   * are packed in tile order, so every internal MBR covers a fixed range
+   * of `fanout_` consecutive children and can be computed independently
+   * of its siblings.
+   *
+   * @param compute_tp The thread pool to compute the levels on. If
+   *     `nullptr`, the tree is built serially.
+   */
+  void build_tree(ThreadPool* compute_tp);
+
   /** Frees the memory associated with the rtree. */
   uint64_t free_memory();
 
@@ -105,6 +118,20 @@ class RTree {
   TileOverlap get_tile_overlap(
       const NDRange& range, std::vector<bool>& is_default) const;
 
+  /**
+   * Returns the tile overlap of a batch of input ranges with the MBRs
+   * stored in the RTree, walking the tree only once for the whole batch.
+   * Nodes shared by many ranges are visited a single time, which
+   * amortizes the traversal cost for fine-grained multi-range queries.
+   *
+   * @param ranges The ranges to compute the overlap for.
+   * @param is_default If default range should be used.
+   * @return One `TileOverlap` per input range, in input order.
+   */
+  std::vector<TileOverlap> get_tile_overlaps(
+      const std::vector<const NDRange*>& ranges,
+      std::vector<bool>& is_default) const;
+
   /**
    * Compute tile bitmap for the curent range.
    */
@@ -218,6 +245,40 @@ class RTree {
     uint64_t mbr_idx_;
   };
 
+  /**
+   * An entry of a bulk traversal. In addition to the node it identifies,
+   * it carries the indices of the query ranges that still partially
+   * overlap the node's MBR, so that a subtree is descended once for the
+   * whole batch of ranges rather than once per range.
+   */
+  struct BulkEntry {
+    /** The level of the node the entry corresponds to. */
+    uint64_t level_;
+    /** The index of the first MBR of the corresponding node. */
+    uint64_t mbr_idx_;
+    /** The indices of the ranges that partially overlap the node. */
+    std::vector<uint64_t> range_idx_;
+  };
+
+  /**
+   * Packed storage of the MBRs of one level for one fixed-sized
+   * dimension: contiguous minimum and maximum coordinate arrays with one
+   * entry of `coord_size` bytes per MBR. The `Level` MBRs store each
+   * `Range` as a separate heap allocation, so traversals pointer-chase
+   * per dimension; the packed arrays allow scanning a whole level with a
+   * tight, vectorizable loop. Both arrays are empty for var-sized
+   * dimensions, which keep using the `Level` representation.
+   */
+  struct PackedDim {
+    /** The packed minimum coordinates (`mbr_num * coord_size` bytes). */
+    tdb::pmr::vector<uint8_t> mins;
+    /** The packed maximum coordinates (`mbr_num * coord_size` bytes). */
+    tdb::pmr::vector<uint8_t> maxs;
+  };
+
+  /** The packed per-dimension arrays of one level. */
+  using PackedLevel = std::vector<PackedDim>;
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -242,6 +303,13 @@ class RTree {
    */
   tdb::pmr::vector<Level> levels_;
 
+  /**
+   * The packed per-dimension min/max arrays, one `PackedLevel` per entry
+   * of `levels_`. Built at load time and empty while the tree is being
+   * populated leaf by leaf.
+   */
+  std::vector<PackedLevel> packed_levels_;
+
   /**
    * Stores the size of the buffer used to deserialize the data, used for
    * memory tracking pusposes on reads.
@@ -252,8 +320,18 @@ class RTree {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
-  /** Builds a single tree level on top of the input level. */
-  Level build_level(const Level& level);
+  /**
+   * Builds a single tree level on top of the input level, parallelizing
+   * over the new MBRs on `compute_tp` (serially if `nullptr`).
+   */
+  Level build_level(const Level& level, ThreadPool* compute_tp);
+
+  /**
+   * Builds the packed per-dimension min/max arrays from `levels_`.
+   * Levels containing MBRs that are not fully set are left unpacked, as
+   * are var-sized dimensions.
+   */
+  void build_packed_levels();
 
   /**
    * Deserializes the contents of the object from the input buffer based
@@ -1246,3 +1246,91 @@ TEST_CASE(
   CHECK(overlap.tiles_[1].second == 1.0 / 3);
   */
 }
+
+TEST_CASE("RTree: Test tile bitmap", "[rtree][tile-bitmap]") {
+  auto tracker = create_test_memory_tracker();
+
+  // 1D fixed-sized dimension, exercises the packed leaf-level scan.
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom1 = create_domain(
+      {"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent}, tracker);
+  auto mbrs = create_mbrs<int32_t, 1>({1, 3, 5, 10, 20, 22}, tracker);
+  RTree rtree(&dom1, 3, tracker);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+
+  int32_t r_no[] = {25, 30};
+  std::vector<uint8_t> bitmap(mbrs.size(), 0);
+  rtree.compute_tile_bitmap(Range(r_no, 2 * sizeof(int32_t)), 0, &bitmap);
+  CHECK(bitmap == std::vector<uint8_t>{0, 0, 0});
+
+  int32_t r_full[] = {0, 22};
+  bitmap.assign(mbrs.size(), 0);
+  rtree.compute_tile_bitmap(Range(r_full, 2 * sizeof(int32_t)), 0, &bitmap);
+  CHECK(bitmap == std::vector<uint8_t>{1, 1, 1});
+
+  int32_t r_partial[] = {6, 21};
+  bitmap.assign(mbrs.size(), 0);
+  rtree.compute_tile_bitmap(Range(r_partial, 2 * sizeof(int32_t)), 0, &bitmap);
+  CHECK(bitmap == std::vector<uint8_t>{0, 1, 1});
+
+  // Overlap on one dimension only of a 2D domain.
+  int64_t dim_dom_2[] = {1, 1000};
+  int64_t dim_extent_2 = 10;
+  Domain dom2 = create_domain(
+      {"d1", "d2"},
+      {Datatype::INT64, Datatype::INT64},
+      {dim_dom_2, dim_dom_2},
+      {&dim_extent_2, &dim_extent_2},
+      tracker);
+  auto mbrs_2d = create_mbrs<int64_t, 2>(
+      {1, 3, 5, 10, 20, 22, 24, 25, 11, 15, 30, 31}, tracker);
+  RTree rtree2(&dom2, 5, tracker);
+  rtree2.set_leaves(mbrs_2d);
+  rtree2.build_tree();
+
+  int64_t r_d1[] = {2, 12};
+  bitmap.assign(mbrs_2d.size(), 0);
+  rtree2.compute_tile_bitmap(Range(r_d1, 2 * sizeof(int64_t)), 0, &bitmap);
+  CHECK(bitmap == std::vector<uint8_t>{1, 0, 1});
+
+  int64_t r_d2[] = {8, 14};
+  bitmap.assign(mbrs_2d.size(), 0);
+  rtree2.compute_tile_bitmap(Range(r_d2, 2 * sizeof(int64_t)), 1, &bitmap);
+  CHECK(bitmap == std::vector<uint8_t>{1, 0, 0});
+}
+
+TEST_CASE("RTree: Test bulk tile overlap", "[rtree][bulk-overlap]") {
+  auto tracker = create_test_memory_tracker();
+  std::vector<bool> is_default(1, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom1 = create_domain(
+      {"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent}, tracker);
+  auto mbrs = create_mbrs<int32_t, 1>(
+      {1, 3, 5, 10, 20, 22, 30, 35, 36, 38, 40, 49, 50, 51, 65, 69}, tracker);
+  RTree rtree(&dom1, 3, tracker);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+  CHECK(rtree.height() == 3);
+
+  // A mix of non-overlapping, partially and fully overlapping ranges.
+  int32_t rs[] = {25, 28, 0, 100, 6, 21, 31, 37, 40, 51, 66, 70};
+  std::vector<NDRange> ranges(6);
+  std::vector<const NDRange*> range_ptrs;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ranges[i].resize(1);
+    ranges[i][0] = Range(&rs[2 * i], 2 * sizeof(int32_t));
+    range_ptrs.emplace_back(&ranges[i]);
+  }
+
+  // The bulk traversal must produce exactly the per-range results.
+  auto overlaps = rtree.get_tile_overlaps(range_ptrs, is_default);
+  REQUIRE(overlaps.size() == ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto expected = rtree.get_tile_overlap(ranges[i], is_default);
+    CHECK(overlaps[i].tile_ranges_ == expected.tile_ranges_);
+    CHECK(overlaps[i].tiles_ == expected.tiles_);
+  }
+}
@@ -45,6 +45,7 @@
 #include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/enums/serialization_type.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/serialization/array.h"
 #include "tiledb/sm/serialization/array_directory.h"
@@ -303,33 +304,43 @@ void array_from_capnp(
     auto fragment_metadata = array->fragment_metadata();
     fragment_metadata.clear();
     auto fragment_metadata_all_reader = array_reader.getFragmentMetadataAll();
-    fragment_metadata.reserve(fragment_metadata_all_reader.size());
-    for (auto frag_meta_reader : fragment_metadata_all_reader) {
-      auto meta = make_shared<FragmentMetadata>(
-          HERE(),
-          &resources,
-          array->memory_tracker(),
-          frag_meta_reader.getVersion());
-
-      auto schema = array->array_schema_latest_ptr();
-      if (frag_meta_reader.hasArraySchemaName()) {
-        auto fragment_array_schema_name =
-            frag_meta_reader.getArraySchemaName().cStr();
-        schema = array->array_schemas_all().at(fragment_array_schema_name);
-      } else if (array->array_schemas_all().size() > 1) {
-        throw ArraySerializationException(
-            "Cannot deserialize fragment metadata without an array schema name "
-            "in the case of arrays with evolved schemas.");
-      }
+    fragment_metadata.resize(fragment_metadata_all_reader.size());
+    // Fragments deserialize independently of each other and their metadata
+    // dominates remote opens of high-fragment arrays, so spread the work
+    // over the compute thread pool. Reading a capnp message from multiple
+    // threads is safe.
+    throw_if_not_ok(parallel_for(
+        &resources.compute_tp(),
+        0,
+        fragment_metadata_all_reader.size(),
+        [&](size_t i) {
+          auto frag_meta_reader = fragment_metadata_all_reader[i];
+          auto meta = make_shared<FragmentMetadata>(
+              HERE(),
+              &resources,
+              array->memory_tracker(),
+              frag_meta_reader.getVersion());
+
+          auto schema = array->array_schema_latest_ptr();
+          if (frag_meta_reader.hasArraySchemaName()) {
+            auto fragment_array_schema_name =
+                frag_meta_reader.getArraySchemaName().cStr();
+            schema = array->array_schemas_all().at(fragment_array_schema_name);
+          } else if (array->array_schemas_all().size() > 1) {
+            throw ArraySerializationException(
+                "Cannot deserialize fragment metadata without an array schema "
+                "name in the case of arrays with evolved schemas.");
+          }
 
-      // pass the right schema to deserialize fragment metadata
-      throw_if_not_ok(
-          fragment_metadata_from_capnp(schema, frag_meta_reader, meta));
-      if (client_side) {
-        meta->loaded_metadata()->set_rtree_loaded();
-      }
-      fragment_metadata.emplace_back(meta);
-    }
+          // pass the right schema to deserialize fragment metadata
+          throw_if_not_ok(
+              fragment_metadata_from_capnp(schema, frag_meta_reader, meta));
+          if (client_side) {
+            meta->loaded_metadata()->set_rtree_loaded();
+          }
+          fragment_metadata[i] = std::move(meta);
+          return Status::Ok();
+        }));
     array->set_fragment_metadata(std::move(fragment_metadata));
   }
 
@@ -56,6 +56,7 @@
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
+#include "tiledb/sm/filter/checksum_crc32c_filter.h"
 #include "tiledb/sm/filter/checksum_md5_filter.h"
 #include "tiledb/sm/filter/checksum_sha256_filter.h"
 #include "tiledb/sm/filter/compression_filter.h"
@@ -64,6 +65,7 @@
 #include "tiledb/sm/filter/float_scaling_filter.h"
 #include "tiledb/sm/filter/noop_filter.h"
 #include "tiledb/sm/filter/positive_delta_filter.h"
+#include "tiledb/sm/filter/validity_bit_pack_filter.h"
 #include "tiledb/sm/filter/webp_filter.h"
 #include "tiledb/sm/filter/xor_filter.h"
 #include "tiledb/sm/misc/constants.h"
@@ -176,6 +178,8 @@ Status filter_to_capnp(
     case FilterType::FILTER_BYTESHUFFLE:
     case FilterType::FILTER_CHECKSUM_MD5:
     case FilterType::FILTER_CHECKSUM_SHA256:
+    case FilterType::FILTER_CHECKSUM_CRC32C:
+    case FilterType::FILTER_VALIDITY_BIT_PACK:
     case FilterType::INTERNAL_FILTER_AES_256_GCM:
     case FilterType::FILTER_XOR:
     case FilterType::FILTER_DEPRECATED:
@@ -293,6 +297,16 @@ tuple<Status, optional<shared_ptr<Filter>>> filter_from_capnp(
           Status::Ok(),
           tiledb::common::make_shared<ChecksumSHA256Filter>(HERE(), datatype)};
     }
+    case FilterType::FILTER_CHECKSUM_CRC32C: {
+      return {
+          Status::Ok(),
+          tiledb::common::make_shared<ChecksumCRC32CFilter>(HERE(), datatype)};
+    }
+    case FilterType::FILTER_VALIDITY_BIT_PACK: {
+      return {
+          Status::Ok(),
+          tiledb::common::make_shared<ValidityBitPackFilter>(HERE(), datatype)};
+    }
     case FilterType::INTERNAL_FILTER_AES_256_GCM: {
       return {
           Status::Ok(),
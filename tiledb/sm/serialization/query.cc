@@ -42,6 +42,7 @@
 #include "tiledb/sm/serialization/array_schema.h"
 #include "tiledb/sm/serialization/capnp_utils.h"
 #include "tiledb/sm/serialization/query_aggregates.h"
+#include "tiledb/sm/serialization/scratch_message_builder.h"
 #endif
 // clang-format on
 
@@ -86,6 +87,42 @@ namespace tiledb::sm::serialization {
 
 shared_ptr<Logger> dummy_logger = make_shared<Logger>(HERE(), "");
 
+/** Zero bytes written between payload blocks when alignment is enabled. */
+static char payload_pad_zeros[256];
+
+/**
+ * Returns the negotiated alignment, in bytes, of the raw attribute buffer
+ * blocks appended after the capnp header, as set by
+ * 'rest.payload_buffer_alignment'. Zero (the default) keeps the legacy
+ * packed layout. Both peers see the same value because the client's config
+ * travels inside the serialized query.
+ */
+static uint64_t payload_buffer_alignment(const Config& config) {
+  const uint64_t alignment =
+      config.get<uint64_t>("rest.payload_buffer_alignment", Config::must_find);
+  if (alignment != 0 &&
+      (alignment % sizeof(uint64_t) != 0 ||
+       (alignment & (alignment - 1)) != 0 ||
+       alignment > sizeof(payload_pad_zeros))) {
+    throw StatusException(Status_SerializationError(
+        "Invalid 'rest.payload_buffer_alignment' value; must be zero or a "
+        "power of two multiple of 8, no greater than 256."));
+  }
+  return alignment;
+}
+
+/**
+ * Returns the number of zero bytes that follow a payload block of `size`
+ * bytes so that the next block starts on an `alignment`-byte boundary. An
+ * alignment of zero disables padding.
+ */
+static inline uint64_t payload_pad_size(uint64_t size, uint64_t alignment) {
+  if (alignment == 0) {
+    return 0;
+  }
+  return (alignment - (size % alignment)) % alignment;
+}
+
 void stats_to_capnp(const Stats& stats, capnp::Stats::Builder* stats_builder) {
   // Build counters
   const auto counters = stats.counters();
@@ -1642,6 +1679,11 @@ Status query_from_capnp(
 
   auto buffer_headers = query_reader.getAttributeBufferHeaders();
   auto attribute_buffer_start = static_cast<char*>(buffer_start);
+
+  // When 'rest.payload_buffer_alignment' is set, the peer padded each block
+  // in the attribute buffer region so that the next one starts aligned. The
+  // config deserialized above carries the client's value on the server side.
+  const uint64_t alignment = payload_buffer_alignment(query->config());
   for (auto buffer_header : buffer_headers) {
     const std::string name = buffer_header.getName().cStr();
 
@@ -1835,12 +1877,16 @@ Status query_from_capnp(
           std::memcpy(
               offset_dest, attribute_buffer_start, fixedlen_size_to_copy);
           attribute_buffer_start += fixedlen_size_to_copy;
+          attribute_buffer_start += payload_pad_size(fixedlen_size, alignment);
           std::memcpy(data_dest, attribute_buffer_start, varlen_size);
           attribute_buffer_start += varlen_size;
+          attribute_buffer_start += payload_pad_size(varlen_size, alignment);
           if (nullable) {
             std::memcpy(
                 validity_dest, attribute_buffer_start, validitylen_size);
             attribute_buffer_start += validitylen_size;
+            attribute_buffer_start +=
+                payload_pad_size(validitylen_size, alignment);
           }
 
           // The offsets in each buffer correspond to the values in its
@@ -1908,12 +1954,15 @@ Status query_from_capnp(
 
           std::memcpy(data_dest, attribute_buffer_start, fixedlen_size);
           attribute_buffer_start += fixedlen_size;
+          attribute_buffer_start += payload_pad_size(fixedlen_size, alignment);
           if (nullable) {
             char* validity_dest =
                 (char*)existing_validity_buffer + curr_validity_size;
             std::memcpy(
                 validity_dest, attribute_buffer_start, validitylen_size);
             attribute_buffer_start += validitylen_size;
+            attribute_buffer_start +=
+                payload_pad_size(validitylen_size, alignment);
           }
 
           // attr_copy_state==nulptr models the case of deserialization code
@@ -2044,13 +2093,21 @@ Status query_from_capnp(
         // On writes, just set buffer pointers wrapping the data in the
         // message.
         if (var_size) {
+          const uint64_t fixedlen_pad =
+              payload_pad_size(fixedlen_size, alignment);
+          const uint64_t varlen_pad = payload_pad_size(varlen_size, alignment);
           auto* offsets = reinterpret_cast<uint64_t*>(attribute_buffer_start);
-          auto* varlen_data = attribute_buffer_start + fixedlen_size;
+          auto* varlen_data =
+              attribute_buffer_start + fixedlen_size + fixedlen_pad;
           auto* validity = reinterpret_cast<uint8_t*>(
-              attribute_buffer_start + fixedlen_size + varlen_size);
+              attribute_buffer_start + fixedlen_size + fixedlen_pad +
+              varlen_size + varlen_pad);
 
-          attribute_buffer_start +=
-              fixedlen_size + varlen_size + validitylen_size;
+          attribute_buffer_start += fixedlen_size + fixedlen_pad +
+                                    varlen_size + varlen_pad +
+                                    validitylen_size +
+                                    payload_pad_size(validitylen_size,
+                                                     alignment);
 
           Buffer offsets_buff(offsets, fixedlen_size);
           Buffer varlen_buff(varlen_data, varlen_size);
@@ -2086,11 +2143,16 @@ Status query_from_capnp(
                 true));
           }
         } else {
+          const uint64_t fixedlen_pad =
+              payload_pad_size(fixedlen_size, alignment);
           auto* data = attribute_buffer_start;
           auto* validity = reinterpret_cast<uint8_t*>(
-              attribute_buffer_start + fixedlen_size);
+              attribute_buffer_start + fixedlen_size + fixedlen_pad);
 
-          attribute_buffer_start += fixedlen_size + validitylen_size;
+          attribute_buffer_start += fixedlen_size + fixedlen_pad +
+                                    validitylen_size +
+                                    payload_pad_size(validitylen_size,
+                                                     alignment);
 
           Buffer buff(data, fixedlen_size);
           Buffer varlen_buff(nullptr, 0);
@@ -2286,7 +2348,8 @@ Status array_from_query_deserialize(
     switch (serialize_type) {
       case SerializationType::JSON: {
         ::capnp::JsonCodec json;
-        ::capnp::MallocMessageBuilder message_builder;
+        ScratchMessageBuilder scratch_builder;
+        auto& message_builder = scratch_builder.builder();
         capnp::Query::Builder query_builder =
             message_builder.initRoot<capnp::Query>();
         json.decode(
@@ -2352,7 +2415,8 @@ Status query_serialize(
         "Cannot serialize query; json format not supported."));
 
   try {
-    ::capnp::MallocMessageBuilder message;
+    ScratchMessageBuilder scratch_builder;
+    auto& message = scratch_builder.builder();
     capnp::Query::Builder query_builder = message.initRoot<capnp::Query>();
     RETURN_NOT_OK(query_to_capnp(*query, &query_builder, clientside));
 
@@ -2391,6 +2455,18 @@ Status query_serialize(
         // Concatenate buffers to end of message
         if (serialize_buffers) {
           const auto& query_buffer_storage = query->get_remote_buffer_cache();
+          const uint64_t alignment = payload_buffer_alignment(query->config());
+
+          // Appends zero padding after a payload block of the given total
+          // size so that the next block starts on an aligned boundary.
+          auto append_pad = [&](uint64_t block_size) -> Status {
+            const uint64_t pad = payload_pad_size(block_size, alignment);
+            if (pad != 0) {
+              RETURN_NOT_OK(serialized_buffer->add_buffer(
+                  Buffer(payload_pad_zeros, pad)));
+            }
+            return Status::Ok();
+          };
 
           auto attr_buffer_builders = query_builder.getAttributeBufferHeaders();
           for (auto attr_buffer_builder : attr_buffer_builders) {
@@ -2431,14 +2507,20 @@ Status query_serialize(
                 }
 
                 RETURN_NOT_OK(serialized_buffer->add_buffer(std::move(data)));
+                RETURN_NOT_OK(append_pad(
+                    attr_buffer_builder.getFixedLenBufferSizeInBytes()));
                 RETURN_NOT_OK(
                     serialized_buffer->add_buffer(std::move(prepend_var_data)));
               } else {
                 data = Buffer(buffer.buffer_, *buffer.buffer_size_);
                 RETURN_NOT_OK(serialized_buffer->add_buffer(std::move(data)));
+                RETURN_NOT_OK(append_pad(
+                    attr_buffer_builder.getFixedLenBufferSizeInBytes()));
               }
 
               RETURN_NOT_OK(serialized_buffer->add_buffer(std::move(var)));
+              RETURN_NOT_OK(append_pad(
+                  attr_buffer_builder.getVarLenBufferSizeInBytes()));
             } else if (
                 buffer.buffer_size_ != nullptr && buffer.buffer_ != nullptr) {
               // Fixed size buffers.
@@ -2454,6 +2536,8 @@ Status query_serialize(
               }
 
               RETURN_NOT_OK(serialized_buffer->add_buffer(std::move(data)));
+              RETURN_NOT_OK(append_pad(
+                  attr_buffer_builder.getFixedLenBufferSizeInBytes()));
             } else {
               throw StatusException(Status_SerializationError(
                   "Unable to serialize invalid query buffers."));
@@ -2476,6 +2560,8 @@ Status query_serialize(
               }
 
               RETURN_NOT_OK(serialized_buffer->add_buffer(std::move(data)));
+              RETURN_NOT_OK(append_pad(
+                  attr_buffer_builder.getValidityLenBufferSizeInBytes()));
             }
           }
         }
@@ -2514,7 +2600,8 @@ Status do_query_deserialize(
     switch (serialize_type) {
       case SerializationType::JSON: {
         ::capnp::JsonCodec json;
-        ::capnp::MallocMessageBuilder message_builder;
+        ScratchMessageBuilder scratch_builder;
+        auto& message_builder = scratch_builder.builder();
         capnp::Query::Builder query_builder =
             message_builder.initRoot<capnp::Query>();
         json.decode(
@@ -2728,7 +2815,8 @@ Status query_est_result_size_serialize(
     bool,
     Buffer* serialized_buffer) {
   try {
-    ::capnp::MallocMessageBuilder message;
+    ScratchMessageBuilder scratch_builder;
+    auto& message = scratch_builder.builder();
     capnp::EstimatedResultSize::Builder est_result_size_builder =
         message.initRoot<capnp::EstimatedResultSize>();
     RETURN_NOT_OK(query_est_result_size_reader_to_capnp(
@@ -2782,7 +2870,8 @@ Status query_est_result_size_deserialize(
     switch (serialize_type) {
       case SerializationType::JSON: {
         ::capnp::JsonCodec json;
-        ::capnp::MallocMessageBuilder message_builder;
+        ScratchMessageBuilder scratch_builder;
+        auto& message_builder = scratch_builder.builder();
         capnp::EstimatedResultSize::Builder estimated_result_size_builder =
             message_builder.initRoot<capnp::EstimatedResultSize>();
         json.decode(
@@ -3043,6 +3132,136 @@ Status global_write_state_from_capnp(
   return Status::Ok();
 }
 
+/**
+ * Returns the global order writer of the input query, or an error if the
+ * query is not a local global order write query.
+ */
+static std::pair<Status, GlobalOrderWriter*> global_writer_for_checkpoint(
+    Query* query) {
+  if (query->type() != QueryType::WRITE ||
+      query->layout() != Layout::GLOBAL_ORDER) {
+    return {
+        LOG_STATUS(Status_SerializationError(
+            "Cannot checkpoint write state; not a global order write query.")),
+        nullptr};
+  }
+
+  auto global_writer = dynamic_cast<GlobalOrderWriter*>(query->strategy());
+  if (global_writer == nullptr) {
+    return {
+        LOG_STATUS(Status_SerializationError(
+            "Cannot checkpoint write state; query has no global order "
+            "writer.")),
+        nullptr};
+  }
+
+  return {Status::Ok(), global_writer};
+}
+
+Status global_write_state_checkpoint_serialize(
+    Query* query, const URI& checkpoint_uri, ContextResources& resources) {
+  auto&& [st, global_writer] = global_writer_for_checkpoint(query);
+  RETURN_NOT_OK(st);
+
+  if (global_writer->get_global_state() == nullptr) {
+    return LOG_STATUS(
+        Status_SerializationError("Cannot checkpoint write state; no write "
+                                  "has been submitted yet."));
+  }
+
+  try {
+    ScratchMessageBuilder scratch_builder;
+    auto& message = scratch_builder.builder();
+    auto state_builder = message.initRoot<capnp::GlobalWriteState>();
+
+    // Serialize from the server perspective so that the multipart upload
+    // state is read from the cloud backend instead of the client cache.
+    RETURN_NOT_OK(global_write_state_to_capnp(
+        *query, *global_writer, &state_builder, false));
+
+    kj::Array<::capnp::word> protomessage = messageToFlatArray(message);
+    kj::ArrayPtr<const char> message_chars = protomessage.asChars();
+
+    // Replace any previous checkpoint. The removal is required as VFS
+    // writes append to existing files on some backends.
+    auto& vfs = resources.vfs();
+    bool exists;
+    RETURN_NOT_OK(vfs.is_file(checkpoint_uri, &exists));
+    if (exists) {
+      RETURN_NOT_OK(vfs.remove_file(checkpoint_uri));
+    }
+    RETURN_NOT_OK(
+        vfs.write(checkpoint_uri, message_chars.begin(), message_chars.size()));
+    RETURN_NOT_OK(vfs.close_file(checkpoint_uri));
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error checkpointing global write state; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error checkpointing global write state; exception " +
+        std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
+Status global_write_state_checkpoint_deserialize(
+    Query* query, const URI& checkpoint_uri, ContextResources& resources) {
+  auto&& [st, global_writer] = global_writer_for_checkpoint(query);
+  RETURN_NOT_OK(st);
+
+  if (global_writer->get_global_state() != nullptr) {
+    return LOG_STATUS(
+        Status_SerializationError("Cannot restore write state; the query has "
+                                  "already been submitted."));
+  }
+
+  try {
+    // Read the checkpoint file. The buffer is heap allocated and thus
+    // satisfies the 64-bit alignment that capnp requires.
+    auto& vfs = resources.vfs();
+    uint64_t nbytes = 0;
+    RETURN_NOT_OK(vfs.file_size(checkpoint_uri, &nbytes));
+    Buffer buffer;
+    RETURN_NOT_OK(buffer.realloc(nbytes));
+    RETURN_NOT_OK(vfs.read(checkpoint_uri, 0, buffer.data(), nbytes));
+
+    // Set traversal limit from config
+    uint64_t limit =
+        query->config().get<uint64_t>("rest.capnp_traversal_limit").value();
+    ::capnp::ReaderOptions readerOptions;
+    // capnp uses the limit in words
+    readerOptions.traversalLimitInWords = limit / sizeof(::capnp::word);
+
+    ::capnp::FlatArrayMessageReader reader(
+        kj::arrayPtr(
+            reinterpret_cast<const ::capnp::word*>(buffer.data()),
+            nbytes / sizeof(::capnp::word)),
+        readerOptions);
+    auto state_reader = reader.getRoot<capnp::GlobalWriteState>();
+
+    // Mirror the remote write handoff: allocate a fresh state and
+    // deserialize into it. The fragment URI comes from the checkpointed
+    // fragment metadata, so the next submission resumes the in-progress
+    // fragment instead of creating a new one.
+    RETURN_NOT_OK(global_writer->alloc_global_write_state());
+    RETURN_NOT_OK(global_writer->init_global_write_state());
+    RETURN_NOT_OK(global_write_state_from_capnp(
+        *query, state_reader, global_writer, SerializationContext::SERVER));
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error restoring global write state; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error restoring global write state; exception " +
+        std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
 Status unordered_write_state_to_capnp(
     const Query& query,
     UnorderedWriter& unordered_writer,
@@ -3207,6 +3426,18 @@ Status query_est_result_size_deserialize(
       "Cannot deserialize; serialization not enabled."));
 }
 
+Status global_write_state_checkpoint_serialize(
+    Query*, const URI&, ContextResources&) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot serialize; serialization not enabled."));
+}
+
+Status global_write_state_checkpoint_deserialize(
+    Query*, const URI&, ContextResources&) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot deserialize; serialization not enabled."));
+}
+
 #endif  // TILEDB_SERIALIZATION
 
 }  // namespace tiledb::sm::serialization
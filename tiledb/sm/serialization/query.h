@@ -54,6 +54,7 @@ class Buffer;
 class BufferList;
 class ContextResources;
 class Query;
+class URI;
 class GlobalOrderWriter;
 class UnorderedWriter;
 class OrderedDimLabelReader;
@@ -214,6 +215,40 @@ Status query_est_result_size_deserialize(
     bool clientside,
     const Buffer& serialized_buffer);
 
+/**
+ * Serialize the global write state of a global order write query to a
+ * checkpoint file.
+ *
+ * The checkpoint captures everything a restarted process needs to resume
+ * the write from the last submitted batch: the in-progress fragment
+ * metadata, the number of cells written per field, the last written cell
+ * coordinates and the multipart upload state of the cloud backend (e.g.
+ * S3 upload ids and completed part etags). Any existing checkpoint at the
+ * given URI is replaced.
+ *
+ * @param query Global order write query to checkpoint.
+ * @param checkpoint_uri URI of the checkpoint file to write.
+ * @param resources The context resources, used for VFS access.
+ */
+Status global_write_state_checkpoint_serialize(
+    Query* query, const URI& checkpoint_uri, ContextResources& resources);
+
+/**
+ * Restore the global write state of a global order write query from a
+ * checkpoint file written by `global_write_state_checkpoint_serialize`.
+ *
+ * The query must be initialized with the same buffers and layout as the
+ * checkpointed one and must not have been submitted yet. The multipart
+ * upload state is registered with the cloud backend so that subsequent
+ * writes append to the in-progress uploads instead of starting over.
+ *
+ * @param query Global order write query to restore into.
+ * @param checkpoint_uri URI of the checkpoint file to read.
+ * @param resources The context resources, used for VFS access.
+ */
+Status global_write_state_checkpoint_deserialize(
+    Query* query, const URI& checkpoint_uri, ContextResources& resources);
+
 #ifdef TILEDB_SERIALIZATION
 
 enum class SerializationContext { CLIENT, SERVER, BACKUP };
@@ -0,0 +1,98 @@
+/**
+ * @file   scratch_message_builder.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines a capnp message builder backed by pooled scratch
+ * arenas.
+ */
+
+#ifdef TILEDB_SERIALIZATION
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "tiledb/sm/serialization/scratch_message_builder.h"
+
+namespace tiledb::sm::serialization {
+
+namespace {
+
+/** Protects the arena pool. */
+std::mutex arena_pool_mtx;
+
+/** The idle scratch arenas; every pooled arena is fully zeroed. */
+std::vector<std::unique_ptr<::capnp::word[]>> arena_pool;
+
+/** Takes an arena from the pool, allocating a fresh one if it is empty. */
+std::unique_ptr<::capnp::word[]> take_arena() {
+  {
+    std::lock_guard<std::mutex> lg(arena_pool_mtx);
+    if (!arena_pool.empty()) {
+      auto arena = std::move(arena_pool.back());
+      arena_pool.pop_back();
+      return arena;
+    }
+  }
+
+  // Value-initialization zeroes the arena, as capnp requires of scratch
+  // space.
+  return std::make_unique<::capnp::word[]>(ScratchMessageBuilder::arena_words);
+}
+
+/**
+ * Returns a (fully zeroed) arena to the pool, or frees it if the pool is
+ * full so that idle arenas never exceed the pool's high-water bound.
+ */
+void return_arena(std::unique_ptr<::capnp::word[]> arena) {
+  std::lock_guard<std::mutex> lg(arena_pool_mtx);
+  if (arena_pool.size() < ScratchMessageBuilder::max_pooled_arenas) {
+    arena_pool.emplace_back(std::move(arena));
+  }
+}
+
+}  // namespace
+
+ScratchMessageBuilder::ScratchMessageBuilder()
+    : arena_(take_arena()) {
+  builder_.emplace(kj::arrayPtr(arena_.get(), arena_words));
+}
+
+ScratchMessageBuilder::~ScratchMessageBuilder() {
+  // Only the first segment lives in the arena; words past its used size
+  // were never handed out by the builder and are still zero.
+  auto segments = builder_->getSegmentsForOutput();
+  const size_t used_words = segments.size() == 0 ? 0 : segments[0].size();
+  builder_.reset();
+  std::memset(arena_.get(), 0, used_words * sizeof(::capnp::word));
+  return_arena(std::move(arena_));
+}
+
+}  // namespace tiledb::sm::serialization
+
+#endif  // TILEDB_SERIALIZATION
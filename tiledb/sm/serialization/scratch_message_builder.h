@@ -0,0 +1,118 @@
+/**
+ * @file   scratch_message_builder.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares a capnp message builder backed by pooled scratch
+ * arenas.
+ */
+
+#ifndef TILEDB_SERIALIZATION_SCRATCH_MESSAGE_BUILDER_H
+#define TILEDB_SERIALIZATION_SCRATCH_MESSAGE_BUILDER_H
+
+#ifdef TILEDB_SERIALIZATION
+
+#include <capnp/message.h>
+
+#include <memory>
+#include <optional>
+
+#include "tiledb/common/macros.h"
+
+namespace tiledb::sm::serialization {
+
+/**
+ * A capnp message builder whose first segment is drawn from a
+ * process-wide pool of scratch arenas.
+ *
+ * A server embedding of the library serializes thousands of short-lived
+ * messages per second, and almost all of them fit in a single segment.
+ * Constructing a fresh `::capnp::MallocMessageBuilder` per message pays
+ * for an allocation and a zeroing of that segment every time; this class
+ * instead hands the builder a pre-zeroed arena from the pool and, on
+ * destruction, re-zeroes only the words the message actually used before
+ * returning the arena. Messages larger than the arena spill into
+ * heap-allocated overflow segments managed by capnp as usual.
+ *
+ * The pool is bounded: arenas returned when the pool is full are freed,
+ * so a burst of concurrent serializations does not permanently pin its
+ * high-water memory.
+ */
+class ScratchMessageBuilder {
+ public:
+  /* ********************************* */
+  /*          STATIC CONSTANTS         */
+  /* ********************************* */
+
+  /** The size of a pooled scratch arena, in capnp words (256KiB). */
+  static constexpr size_t arena_words = 32768;
+
+  /** The maximum number of idle arenas kept in the pool. */
+  static constexpr size_t max_pooled_arenas = 16;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. Takes an arena from the pool, allocating if empty. */
+  ScratchMessageBuilder();
+
+  /** Destructor. Re-zeroes the used prefix and returns the arena. */
+  ~ScratchMessageBuilder();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ScratchMessageBuilder);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(ScratchMessageBuilder);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the underlying message builder. */
+  inline ::capnp::MallocMessageBuilder& builder() {
+    return *builder_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The scratch arena backing the builder's first segment. */
+  std::unique_ptr<::capnp::word[]> arena_;
+
+  /**
+   * The builder. Held in an optional so the destructor can destroy it
+   * before the arena is zeroed and returned to the pool.
+   */
+  std::optional<::capnp::MallocMessageBuilder> builder_;
+};
+
+}  // namespace tiledb::sm::serialization
+
+#endif  // TILEDB_SERIALIZATION
+
+#endif  // TILEDB_SERIALIZATION_SCRATCH_MESSAGE_BUILDER_H
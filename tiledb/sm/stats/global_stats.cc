@@ -96,6 +96,40 @@ void GlobalStats::register_stats(const shared_ptr<Stats>& stats) {
   registered_stats_.emplace_back(stats);
 }
 
+StatsData GlobalStats::snapshot() {
+  std::unordered_map<std::string, uint64_t> counters;
+  std::unordered_map<std::string, double> timers;
+  iterate([&](Stats& stat) {
+    const StatsData data = stat.snapshot();
+    for (const auto& counter : data.counters()) {
+      counters[counter.first] += counter.second;
+    }
+    for (const auto& timer : data.timers()) {
+      timers[timer.first] += timer.second;
+    }
+  });
+
+  StatsData data(counters, timers);
+
+  // Invoke the export hooks outside of any stats locks.
+  std::vector<std::function<void(const StatsData&)>> hooks;
+  {
+    std::unique_lock<std::mutex> ul(mtx_);
+    hooks = export_hooks_;
+  }
+  for (const auto& hook : hooks) {
+    hook(data);
+  }
+
+  return data;
+}
+
+void GlobalStats::register_export_hook(
+    std::function<void(const StatsData&)> hook) {
+  std::unique_lock<std::mutex> ul(mtx_);
+  export_hooks_.emplace_back(std::move(hook));
+}
+
 template <class FuncT>
 void GlobalStats::iterate(const FuncT& f) {
   std::unique_lock<std::mutex> ul(mtx_);
@@ -36,6 +36,7 @@
 #include <inttypes.h>
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <list>
@@ -176,6 +177,21 @@ class GlobalStats {
   /** Dumps the current raw stats to the given string as a JSON. */
   void raw_dump(std::string* out) const;
 
+  /**
+   * Takes a live, flattened snapshot of all registered stats without
+   * pausing collection, and invokes any registered export hooks with it.
+   * Counters and timers with the same name across registered stats are
+   * summed. Intended for metrics exporters scraping a running process.
+   */
+  StatsData snapshot();
+
+  /**
+   * Registers a hook that is invoked with the data of every snapshot
+   * taken via `snapshot()`. Hooks are invoked outside of any stats locks
+   * and cannot be unregistered.
+   */
+  void register_export_hook(std::function<void(const StatsData&)> hook);
+
  private:
   /* ****************************** */
   /*       PRIVATE DATATYPES        */
@@ -202,6 +218,9 @@ class GlobalStats {
   /** The aggregated stats. */
   std::list<std::weak_ptr<stats::Stats>> registered_stats_;
 
+  /** Hooks invoked with the data of every snapshot taken. */
+  std::vector<std::function<void(const StatsData&)>> export_hooks_;
+
   /* ****************************** */
   /*       PRIVATE FUNCTIONS        */
   /* ****************************** */
@@ -0,0 +1,201 @@
+/**
+ * @file   histogram.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class Histogram.
+ */
+
+#ifndef TILEDB_HISTOGRAM_H
+#define TILEDB_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+namespace tiledb {
+namespace sm {
+namespace stats {
+
+/**
+ * A log-linear (HDR-style) histogram of operation durations.
+ *
+ * Durations are bucketed in nanoseconds with 8 linear sub-buckets per
+ * power of two, giving roughly 12.5% relative precision across the full
+ * range while keeping the bucket array small and fixed-size. Recording is
+ * a handful of arithmetic operations and one array increment, cheap
+ * enough for per-operation timers.
+ *
+ * The histogram performs no synchronization of its own; callers
+ * synchronize access (see the per-slab locking in `Stats`).
+ */
+class Histogram {
+ public:
+  /* ****************************** */
+  /*   CONSTRUCTORS & DESTRUCTORS   */
+  /* ****************************** */
+
+  /** Default constructor. All buckets start empty. */
+  Histogram() = default;
+
+  /** Destructor. */
+  ~Histogram() = default;
+
+  /* ****************************** */
+  /*              API               */
+  /* ****************************** */
+
+  /** Records a duration, measured in seconds. */
+  void record(const std::chrono::duration<double> duration) {
+    const double seconds = duration.count();
+    count_++;
+    sum_ += seconds;
+    if (seconds > max_) {
+      max_ = seconds;
+    }
+    buckets_[bucket_index(static_cast<uint64_t>(seconds * 1e9))]++;
+  }
+
+  /** Merges the contents of another histogram into this one. */
+  void merge(const Histogram& other) {
+    count_ += other.count_;
+    sum_ += other.sum_;
+    if (other.max_ > max_) {
+      max_ = other.max_;
+    }
+    for (size_t i = 0; i < num_buckets_; i++) {
+      buckets_[i] += other.buckets_[i];
+    }
+  }
+
+  /** Returns the number of recorded durations. */
+  inline uint64_t count() const {
+    return count_;
+  }
+
+  /** Returns the sum of recorded durations, in seconds. */
+  inline double sum() const {
+    return sum_;
+  }
+
+  /** Returns the maximum recorded duration, in seconds. */
+  inline double max() const {
+    return max_;
+  }
+
+  /**
+   * Returns an estimate of the `q`-quantile duration, in seconds. The
+   * estimate is the upper bound of the bucket containing the quantile, so
+   * it errs high by at most the bucket precision.
+   *
+   * @param q The quantile to estimate, in `[0, 1]`.
+   */
+  double quantile(const double q) const {
+    if (count_ == 0) {
+      return 0.0;
+    }
+
+    const uint64_t target =
+        std::max<uint64_t>(1, static_cast<uint64_t>(q * count_));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < num_buckets_; i++) {
+      seen += buckets_[i];
+      if (seen >= target) {
+        return static_cast<double>(bucket_upper_bound(i)) / 1e9;
+      }
+    }
+
+    return max_;
+  }
+
+ private:
+  /* ****************************** */
+  /*           CONSTANTS            */
+  /* ****************************** */
+
+  /** Log2 of the number of linear sub-buckets per power of two. */
+  static constexpr size_t sub_bucket_bits_ = 3;
+
+  /** The number of linear sub-buckets per power of two. */
+  static constexpr size_t sub_bucket_count_ = 1 << sub_bucket_bits_;
+
+  /** The total number of buckets, covering the full `uint64_t` range. */
+  static constexpr size_t num_buckets_ =
+      (64 - sub_bucket_bits_) * sub_bucket_count_ + sub_bucket_count_;
+
+  /* ****************************** */
+  /*       PRIVATE ATTRIBUTES       */
+  /* ****************************** */
+
+  /** The number of recorded durations. */
+  uint64_t count_ = 0;
+
+  /** The sum of recorded durations, in seconds. */
+  double sum_ = 0.0;
+
+  /** The maximum recorded duration, in seconds. */
+  double max_ = 0.0;
+
+  /** The bucket counts. */
+  std::array<uint64_t, num_buckets_> buckets_{};
+
+  /* ****************************** */
+  /*       PRIVATE FUNCTIONS        */
+  /* ****************************** */
+
+  /** Returns the bucket index for a value in nanoseconds. */
+  static size_t bucket_index(const uint64_t value_ns) {
+    if (value_ns < sub_bucket_count_) {
+      return static_cast<size_t>(value_ns);
+    }
+
+    const size_t exponent = std::bit_width(value_ns) - 1;
+    const size_t bucket = exponent - sub_bucket_bits_ + 1;
+    const size_t sub = static_cast<size_t>(
+        (value_ns >> (exponent - sub_bucket_bits_)) - sub_bucket_count_);
+    return bucket * sub_bucket_count_ + sub;
+  }
+
+  /** Returns the exclusive upper bound of a bucket, in nanoseconds. */
+  static uint64_t bucket_upper_bound(const size_t index) {
+    const size_t bucket = index / sub_bucket_count_;
+    const size_t sub = index % sub_bucket_count_;
+    if (bucket == 0) {
+      return sub + 1;
+    }
+
+    return static_cast<uint64_t>(sub_bucket_count_ + sub + 1) << (bucket - 1);
+  }
+};
+
+}  // namespace stats
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_HISTOGRAM_H
@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/stats/stats.h"
 #include "tiledb/common/stdx_string.h"
+#include "tiledb/sm/stats/trace.h"
 #include "tiledb/sm/misc/utils.h"
 
 #include <algorithm>
@@ -71,12 +72,20 @@ void Stats::set_enabled(bool enabled) {
 }
 
 void Stats::reset() {
+  // Clear the slabs first; slab locks are never held together with `mtx_`.
+  for (auto& slab : slabs_) {
+    std::unique_lock<std::mutex> slab_lck(slab.mtx);
+    slab.counters.clear();
+    slab.timers.clear();
+  }
+
   // We will acquire the locks top-down in the tree and hold
   // until the recursion terminates.
   std::unique_lock<std::mutex> lck(mtx_);
 
   timers_.clear();
   counters_.clear();
+  histograms_.clear();
 
   for (auto& child : children_) {
     child.reset();
@@ -182,14 +191,9 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
     return;
   }
 
-  std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
-  auto it = counters_.find(new_stat);
-  if (it == counters_.end()) {  // Counter not found
-    counters_[new_stat] = count;
-  } else {  // Counter found
-    it->second += count;
-  }
+  auto& slab = slab_for_thread();
+  std::unique_lock<std::mutex> lck(slab.mtx);
+  slab.counters[prefix_ + stat] += count;
 }
 
 DurationInstrument<Stats> Stats::start_timer(const std::string& stat) {
@@ -198,37 +202,19 @@ DurationInstrument<Stats> Stats::start_timer(const std::string& stat) {
 
 void Stats::report_duration(
     const std::string& stat, const std::chrono::duration<double> duration) {
-  if (!enabled_) {
-    return;
+  // The tracer keeps the individual events that the sums below discard.
+  // It is disabled by default and is opted into independently of stats.
+  if (global_tracer.enabled()) {
+    global_tracer.record_span(prefix_ + stat, duration);
   }
 
-  std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
-
-  // Add duration to timer total
-  auto it2 = timers_.find(new_stat + ".sum");
-  if (it2 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".sum"] = duration.count();
-  } else {  // Timer found
-    it2->second += duration.count();
-  }
-
-  // Add duration to timer max
-  auto it3 = timers_.find(new_stat + ".max");
-  if (it3 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".max"] = duration.count();
-  } else {  // Timer found
-    if (duration.count() > it3->second)
-      it3->second = duration.count();
+  if (!enabled_) {
+    return;
   }
 
-  // Increment the timer counter
-  auto it4 = counters_.find(new_stat + ".timer_count");
-  if (it4 == counters_.end()) {  // Timer not found
-    counters_[new_stat + ".timer_count"] = 1;
-  } else {  // Timer found
-    it4->second += 1;
-  }
+  auto& slab = slab_for_thread();
+  std::unique_lock<std::mutex> lck(slab.mtx);
+  slab.timers[prefix_ + stat].record(duration);
 }
 
 #else
@@ -262,9 +248,84 @@ Stats* Stats::create_child(const std::string& prefix, const StatsData& data) {
   return child;
 }
 
+Stats::Slab& Stats::slab_for_thread() const {
+  static thread_local const size_t index =
+      std::hash<std::thread::id>()(std::this_thread::get_id()) % num_slabs_;
+  return slabs_[index];
+}
+
+void Stats::flush_slabs() const {
+  // Move the slab contents out under the slab locks, one slab at a time,
+  // so that collection on the other slabs is never stalled.
+  std::unordered_map<std::string, uint64_t> counters;
+  std::unordered_map<std::string, Histogram> timers;
+  for (auto& slab : slabs_) {
+    std::unique_lock<std::mutex> slab_lck(slab.mtx);
+    for (const auto& counter : slab.counters) {
+      counters[counter.first] += counter.second;
+    }
+    for (const auto& timer : slab.timers) {
+      timers[timer.first].merge(timer.second);
+    }
+    slab.counters.clear();
+    slab.timers.clear();
+  }
+
+  // Merge the drained deltas into the aggregate maps.
+  std::unique_lock<std::mutex> lck(mtx_);
+  for (const auto& counter : counters) {
+    counters_[counter.first] += counter.second;
+  }
+  for (const auto& timer : timers) {
+    const auto& hist = timer.second;
+    histograms_[timer.first].merge(hist);
+    timers_[timer.first + ".sum"] += hist.sum();
+    auto& max = timers_[timer.first + ".max"];
+    if (hist.max() > max) {
+      max = hist.max();
+    }
+    counters_[timer.first + ".timer_count"] += hist.count();
+  }
+}
+
+void Stats::populate_flattened_histograms(
+    std::unordered_map<std::string, Histogram>* const flattened_histograms)
+    const {
+  flush_slabs();
+
+  {
+    std::unique_lock<std::mutex> lck(mtx_);
+    for (const auto& histogram : histograms_) {
+      (*flattened_histograms)[histogram.first].merge(histogram.second);
+    }
+  }
+
+  for (const auto& child : children_) {
+    child.populate_flattened_histograms(flattened_histograms);
+  }
+}
+
+StatsData Stats::snapshot() const {
+  std::unordered_map<std::string, double> timers;
+  std::unordered_map<std::string, uint64_t> counters;
+  populate_flattened_stats(&timers, &counters);
+
+  std::unordered_map<std::string, Histogram> histograms;
+  populate_flattened_histograms(&histograms);
+  for (const auto& histogram : histograms) {
+    timers[histogram.first + ".p50"] = histogram.second.quantile(0.5);
+    timers[histogram.first + ".p99"] = histogram.second.quantile(0.99);
+  }
+
+  return StatsData(counters, timers);
+}
+
 void Stats::populate_flattened_stats(
     std::unordered_map<std::string, double>* const flattened_timers,
     std::unordered_map<std::string, uint64_t>* const flattened_counters) const {
+  // Drain the hot-path slabs into the aggregate maps first.
+  flush_slabs();
+
   // We will acquire the locks top-down in the tree and hold
   // until the recursion terminates.
   std::unique_lock<std::mutex> lck(mtx_);
@@ -282,11 +343,13 @@ void Stats::populate_flattened_stats(
 }
 
 const std::unordered_map<std::string, double>* Stats::timers() const {
+  flush_slabs();
   return &timers_;
 }
 
 /** Return pointer to conters map, used for serialization only. */
 const std::unordered_map<std::string, uint64_t>* Stats::counters() const {
+  flush_slabs();
   return &counters_;
 }
 
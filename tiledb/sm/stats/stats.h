@@ -34,8 +34,10 @@
 #define TILEDB_STATS_H
 
 #include "duration_instrument.h"
+#include "histogram.h"
 
 #include <inttypes.h>
+#include <array>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -200,22 +202,60 @@ class Stats {
    */
   void populate_with_data(const StatsData& data);
 
+  /**
+   * Returns a flattened snapshot of this instance's stats and all of its
+   * children, taken live without pausing collection. Timer quantiles
+   * estimated from the duration histograms are included as `.p50` and
+   * `.p99` entries in the timers map.
+   */
+  StatsData snapshot() const;
+
  private:
+  /* ****************************** */
+  /*       PRIVATE DATATYPES        */
+  /* ****************************** */
+
+  /**
+   * A slab of counters and duration histograms. Mutating threads are
+   * hashed over the slabs so that the slab lock is uncontended in the
+   * common case; aggregation drains the slabs one at a time without ever
+   * pausing collection on the others.
+   */
+  struct Slab {
+    /** Protects the slab maps. */
+    std::mutex mtx;
+
+    /** Counter deltas not yet flushed to the aggregate maps. */
+    std::unordered_map<std::string, uint64_t> counters;
+
+    /** Duration histograms not yet flushed to the aggregate maps. */
+    std::unordered_map<std::string, Histogram> timers;
+  };
+
   /* ****************************** */
   /*       PRIVATE ATTRIBUTES       */
   /* ****************************** */
 
-  /** Mutex. */
+  /** The number of slabs that mutating threads are hashed over. */
+  static constexpr size_t num_slabs_ = 16;
+
+  /** Mutex. Protects the aggregate maps, not the slabs. */
   mutable std::mutex mtx_;
 
   /** True if stats are being gathered. */
   bool enabled_;
 
+  /** The slabs written by the hot paths. */
+  mutable std::array<Slab, num_slabs_> slabs_;
+
   /** A map of timer stats measuring time in seconds. */
-  std::unordered_map<std::string, double> timers_;
+  mutable std::unordered_map<std::string, double> timers_;
 
   /** A map of counter stats. */
-  std::unordered_map<std::string, uint64_t> counters_;
+  mutable std::unordered_map<std::string, uint64_t> counters_;
+
+  /** A map of duration histograms, one per timer stat. */
+  mutable std::unordered_map<std::string, Histogram> histograms_;
 
   /** Prefix used for the various timers and counters. */
   const std::string prefix_;
@@ -237,6 +277,27 @@ class Stats {
   void report_duration(
       const std::string& stat, const std::chrono::duration<double> duration);
 
+  /** Returns the slab assigned to the calling thread. */
+  Slab& slab_for_thread() const;
+
+  /**
+   * Drains all slabs into the aggregate maps. Each slab lock is taken and
+   * released individually and the slab contents are moved out before the
+   * aggregate lock is acquired, so collection never stalls behind
+   * aggregation.
+   */
+  void flush_slabs() const;
+
+  /**
+   * Populates the input map with the duration histograms of this instance
+   * and all of its children, merging histograms for the same stat.
+   *
+   * @param flattened_histograms Histograms to merge into.
+   */
+  void populate_flattened_histograms(
+      std::unordered_map<std::string, Histogram>* const flattened_histograms)
+      const;
+
   /**
    * Populates the input stats with the instance stats. This is a
    * recursive work routine that `dump()` uses to aggregate all stats
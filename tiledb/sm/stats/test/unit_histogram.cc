@@ -0,0 +1,81 @@
+/**
+ * @file   unit_histogram.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the duration histogram used by the stats subsystem.
+ */
+
+#include <test/support/tdb_catch.h>
+#include <tiledb/sm/stats/histogram.h>
+
+using namespace tiledb::sm::stats;
+using std::chrono::duration;
+
+TEST_CASE("Histogram: basic recording", "[stats][histogram]") {
+  Histogram hist;
+  CHECK(hist.count() == 0);
+  CHECK(hist.quantile(0.5) == 0.0);
+
+  hist.record(duration<double>(0.001));
+  hist.record(duration<double>(0.002));
+  hist.record(duration<double>(0.004));
+
+  CHECK(hist.count() == 3);
+  CHECK(hist.sum() == Catch::Approx(0.007));
+  CHECK(hist.max() == Catch::Approx(0.004));
+}
+
+TEST_CASE("Histogram: quantile precision", "[stats][histogram]") {
+  Histogram hist;
+
+  // 99 fast operations and one slow one.
+  for (int i = 0; i < 99; i++) {
+    hist.record(duration<double>(0.001));
+  }
+  hist.record(duration<double>(1.0));
+
+  // Buckets have 12.5% relative precision and quantiles err high by at
+  // most one bucket.
+  CHECK(hist.quantile(0.5) >= 0.001);
+  CHECK(hist.quantile(0.5) <= 0.001 * 1.125 * 1.125);
+  CHECK(hist.quantile(0.99) <= 0.001 * 1.125 * 1.125);
+  CHECK(hist.quantile(1.0) >= 1.0);
+}
+
+TEST_CASE("Histogram: merge", "[stats][histogram]") {
+  Histogram a, b;
+  a.record(duration<double>(0.001));
+  b.record(duration<double>(0.1));
+  b.record(duration<double>(0.2));
+
+  a.merge(b);
+  CHECK(a.count() == 3);
+  CHECK(a.sum() == Catch::Approx(0.301));
+  CHECK(a.max() == Catch::Approx(0.2));
+  CHECK(a.quantile(1.0) >= 0.2);
+}
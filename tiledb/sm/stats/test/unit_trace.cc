@@ -0,0 +1,116 @@
+/**
+ * @file   unit_trace.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `Tracer` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/stats/stats.h"
+#include "tiledb/sm/stats/trace.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace tiledb::sm::stats;
+
+TEST_CASE("Tracer: Disabled by default", "[stats][trace]") {
+  Tracer tracer;
+  CHECK(!tracer.enabled());
+
+  // Spans recorded while disabled are discarded.
+  tracer.record_span("discarded", std::chrono::milliseconds(1));
+  CHECK(tracer.dump() == "[]\n");
+}
+
+TEST_CASE("Tracer: Records the span timeline", "[stats][trace]") {
+  Tracer tracer;
+  tracer.enable("");
+  CHECK(tracer.enabled());
+
+  tracer.record_span("Context.Query.read", std::chrono::milliseconds(3));
+  tracer.record_span("Context.Query.unfilter", std::chrono::milliseconds(1));
+
+  auto dumped = tracer.dump();
+  CHECK(dumped.find("\"name\": \"Context.Query.read\"") != std::string::npos);
+  CHECK(
+      dumped.find("\"name\": \"Context.Query.unfilter\"") !=
+      std::string::npos);
+  CHECK(dumped.find("\"ph\": \"X\"") != std::string::npos);
+  CHECK(dumped.find("\"dur\": 3000") != std::string::npos);
+  CHECK(dumped.find("\"dur\": 1000") != std::string::npos);
+
+  // Re-enabling after a disable starts a fresh timeline.
+  tracer.disable();
+  CHECK(!tracer.enabled());
+  tracer.enable("");
+  CHECK(tracer.dump() == "[]\n");
+}
+
+TEST_CASE("Tracer: Export hooks see every span", "[stats][trace]") {
+  Tracer tracer;
+  std::vector<TraceEvent> exported;
+  tracer.register_export_hook(
+      [&exported](const TraceEvent& event) { exported.emplace_back(event); });
+  tracer.enable("");
+
+  tracer.record_span("exported_span", std::chrono::milliseconds(2));
+
+  REQUIRE(exported.size() == 1);
+  CHECK(exported[0].name == "exported_span");
+  CHECK(exported[0].dur_us == 2000);
+  CHECK(exported[0].tid != 0);
+}
+
+#ifdef TILEDB_STATS
+TEST_CASE("Tracer: Stats timers emit spans", "[stats][trace]") {
+  global_tracer.enable("");
+
+  Stats stats("TracedStats");
+  {
+    auto timer = stats.start_timer("stage");
+  }
+
+  {
+    // Spans recorded inside a query scope carry its query id.
+    Tracer::ScopedQuery query_scope;
+    auto timer = stats.start_timer("scoped_stage");
+  }
+
+  auto dumped = global_tracer.dump();
+  CHECK(
+      dumped.find("\"name\": \"TracedStats.stage\"") != std::string::npos);
+  CHECK(
+      dumped.find("\"name\": \"TracedStats.scoped_stage\"") !=
+      std::string::npos);
+  CHECK(dumped.find("\"args\": {\"query\": ") != std::string::npos);
+
+  global_tracer.disable();
+}
+#endif
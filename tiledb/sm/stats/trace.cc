@@ -0,0 +1,191 @@
+/**
+ * @file   trace.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class Tracer.
+ */
+
+#include "tiledb/sm/stats/trace.h"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace tiledb {
+namespace sm {
+namespace stats {
+
+Tracer global_tracer;
+
+thread_local uint64_t Tracer::current_query_id_ = 0;
+
+/* ****************************** */
+/*          SCOPED QUERY          */
+/* ****************************** */
+
+Tracer::ScopedQuery::ScopedQuery()
+    : previous_id_(current_query_id_) {
+  if (global_tracer.enabled()) {
+    current_query_id_ =
+        global_tracer.next_query_id_.fetch_add(1, std::memory_order_relaxed) +
+        1;
+  }
+}
+
+Tracer::ScopedQuery::~ScopedQuery() {
+  current_query_id_ = previous_id_;
+}
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+Tracer::Tracer()
+    : enabled_(false)
+    , dropped_(0)
+    , next_query_id_(0) {
+}
+
+Tracer::~Tracer() {
+  flush();
+}
+
+/* ****************************** */
+/*              API               */
+/* ****************************** */
+
+void Tracer::enable(const std::string& path) {
+  std::unique_lock<std::mutex> lck(mtx_);
+  if (enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  path_ = path;
+  epoch_ = std::chrono::steady_clock::now();
+  events_.clear();
+  dropped_ = 0;
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::disable() {
+  flush();
+  enabled_.store(false, std::memory_order_relaxed);
+}
+
+void Tracer::record_span(
+    const std::string& name, const std::chrono::duration<double> duration) {
+  if (!enabled()) {
+    return;
+  }
+
+  // The duration was measured by the caller; approximate the start time
+  // as the reporting time minus the duration.
+  const auto now = std::chrono::steady_clock::now();
+  const auto dur_us =
+      static_cast<uint64_t>(std::chrono::duration<double, std::micro>(duration)
+                                .count());
+
+  TraceEvent event;
+  event.name = name;
+  event.dur_us = dur_us;
+  event.tid = std::hash<std::thread::id>()(std::this_thread::get_id());
+  event.query_id = current_query_id_;
+
+  {
+    std::unique_lock<std::mutex> lck(mtx_);
+    const auto end_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - epoch_)
+            .count());
+    event.ts_us = end_us >= dur_us ? end_us - dur_us : 0;
+    if (events_.size() < max_events_) {
+      events_.emplace_back(event);
+    } else {
+      dropped_++;
+    }
+  }
+
+  // Hooks run outside of the lock on the recording thread.
+  for (const auto& hook : export_hooks_) {
+    hook(event);
+  }
+}
+
+void Tracer::flush() {
+  std::string path;
+  {
+    std::unique_lock<std::mutex> lck(mtx_);
+    path = path_;
+  }
+  if (path.empty()) {
+    return;
+  }
+
+  std::ofstream out(path);
+  out << dump();
+
+  std::unique_lock<std::mutex> lck(mtx_);
+  events_.clear();
+  dropped_ = 0;
+}
+
+std::string Tracer::dump() const {
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  std::stringstream ss;
+  ss << "[";
+  bool printed_first_event = false;
+  for (const auto& event : events_) {
+    if (printed_first_event) {
+      ss << ",";
+    }
+    ss << "\n  {\"name\": \"" << event.name << "\", \"cat\": \"tiledb\", "
+       << "\"ph\": \"X\", \"ts\": " << event.ts_us
+       << ", \"dur\": " << event.dur_us << ", \"pid\": 0, \"tid\": "
+       << event.tid;
+    if (event.query_id != 0) {
+      ss << ", \"args\": {\"query\": " << event.query_id << "}";
+    }
+    ss << "}";
+    printed_first_event = true;
+  }
+  if (printed_first_event) {
+    ss << "\n";
+  }
+  ss << "]\n";
+
+  return ss.str();
+}
+
+void Tracer::register_export_hook(std::function<void(const TraceEvent&)> hook) {
+  std::unique_lock<std::mutex> lck(mtx_);
+  export_hooks_.emplace_back(std::move(hook));
+}
+
+}  // namespace stats
+}  // namespace sm
+}  // namespace tiledb
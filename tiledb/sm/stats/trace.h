@@ -0,0 +1,225 @@
+/**
+ * @file   trace.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class Tracer.
+ */
+
+#ifndef TILEDB_TRACE_H
+#define TILEDB_TRACE_H
+
+#include "tiledb/common/macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+namespace stats {
+
+/**
+ * A single completed span on the trace timeline.
+ */
+struct TraceEvent {
+  /** The span name, which is the full stats prefix of the timer. */
+  std::string name;
+
+  /** Start of the span, in microseconds since the tracer was enabled. */
+  uint64_t ts_us;
+
+  /** Duration of the span, in microseconds. */
+  uint64_t dur_us;
+
+  /** Hashed id of the thread that recorded the span. */
+  uint64_t tid;
+
+  /** Id of the query submission the span belongs to, or 0 if none. */
+  uint64_t query_id;
+};
+
+/**
+ * Records the timeline of the durations reported through the `Stats`
+ * tree as scoped spans. While `Stats` accumulates durations into sums
+ * and histograms, the tracer keeps the individual events with their
+ * start times, thread ids and query ids, so that a slow query can be
+ * inspected stage by stage after the fact.
+ *
+ * Tracing is disabled by default and costs a single relaxed atomic load
+ * per reported duration while disabled. It is enabled by setting the
+ * `sm.trace.file` config parameter to an output path; the buffered
+ * events are written to that path in the Chrome trace event JSON format
+ * (loadable in `chrome://tracing` and in the Perfetto UI) when the
+ * tracer is flushed or destroyed. Alternatively, an export hook can be
+ * registered to stream every completed span to an external collector
+ * such as an OpenTelemetry bridge.
+ *
+ * Spans are recorded on the thread that reports the duration; work
+ * timed from a thread pool task carries the id of the worker thread.
+ * The query id is propagated through a thread-local, so spans reported
+ * from worker threads spawned inside a query submission carry query
+ * id 0; their names still carry the `Query.` stats prefix.
+ */
+class Tracer {
+ public:
+  /* ****************************** */
+  /*         TYPE DEFINITIONS       */
+  /* ****************************** */
+
+  /**
+   * Scope guard that tags the spans recorded on the current thread with
+   * a fresh query id. Instantiated at the top of a query submission.
+   */
+  class ScopedQuery {
+   public:
+    /** Constructor. Assigns a query id if tracing is enabled. */
+    ScopedQuery();
+
+    /** Destructor. Restores the previous query id. */
+    ~ScopedQuery();
+
+    DISABLE_COPY_AND_COPY_ASSIGN(ScopedQuery);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(ScopedQuery);
+
+   private:
+    /** The query id in scope before this guard was constructed. */
+    uint64_t previous_id_;
+  };
+
+  /* ****************************** */
+  /*   CONSTRUCTORS & DESTRUCTORS   */
+  /* ****************************** */
+
+  /** Constructor. The tracer starts out disabled. */
+  Tracer();
+
+  /** Destructor. Flushes any buffered events. */
+  ~Tracer();
+
+  /* ****************************** */
+  /*              API               */
+  /* ****************************** */
+
+  /** Returns true if tracing is currently enabled. */
+  inline bool enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Enables tracing, clearing any previously buffered events. If the
+   * tracer is already enabled, the call is a no-op so that the first
+   * context to configure tracing wins.
+   *
+   * @param path Path the Chrome trace JSON is written to on `flush`.
+   *     May be empty if only export hooks are used.
+   */
+  void enable(const std::string& path);
+
+  /** Flushes buffered events and disables tracing. */
+  void disable();
+
+  /**
+   * Records a completed span ending now. Called from
+   * `Stats::report_duration` with the prefixed timer name.
+   *
+   * @param name The span name.
+   * @param duration The span duration.
+   */
+  void record_span(
+      const std::string& name, std::chrono::duration<double> duration);
+
+  /**
+   * Writes the buffered events to the configured path as Chrome trace
+   * JSON and clears the buffer. A no-op if no path was configured.
+   */
+  void flush();
+
+  /** Returns the buffered events as a Chrome trace JSON array. */
+  std::string dump() const;
+
+  /**
+   * Registers a hook that is invoked with every completed span, e.g. an
+   * OpenTelemetry bridge. Hooks are invoked outside of the tracer lock
+   * on the recording thread and cannot be unregistered; they must be
+   * registered before tracing is enabled.
+   */
+  void register_export_hook(std::function<void(const TraceEvent&)> hook);
+
+ private:
+  /* ****************************** */
+  /*       PRIVATE ATTRIBUTES       */
+  /* ****************************** */
+
+  /**
+   * The maximum number of buffered events. Events recorded past this
+   * limit are counted and dropped so that a long-running traced process
+   * does not grow without bound.
+   */
+  static constexpr size_t max_events_ = 1 << 20;
+
+  /** True if tracing is enabled. */
+  std::atomic<bool> enabled_;
+
+  /** Protects the members below. */
+  mutable std::mutex mtx_;
+
+  /** Path the trace is written to on `flush`. */
+  std::string path_;
+
+  /** The instant `ts_us` is measured from. */
+  std::chrono::steady_clock::time_point epoch_;
+
+  /** The buffered events. */
+  std::vector<TraceEvent> events_;
+
+  /** The number of events dropped because the buffer was full. */
+  uint64_t dropped_;
+
+  /** Hooks invoked with every completed span. */
+  std::vector<std::function<void(const TraceEvent&)>> export_hooks_;
+
+  /** The next query id handed out to a `ScopedQuery`. */
+  std::atomic<uint64_t> next_query_id_;
+
+  /** The query id spans recorded on this thread are tagged with. */
+  static thread_local uint64_t current_query_id_;
+};
+
+/**
+ * The singleton instance spans are recorded on.
+ */
+extern Tracer global_tracer;
+
+}  // namespace stats
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TRACE_H
@@ -33,6 +33,10 @@
 #include "tiledb/common/common.h"
 
 #include "tiledb/common/logger.h"
+#include "tiledb/sm/array/array_directory.h"
+#include "tiledb/sm/crypto/encryption_key.h"
+#include "tiledb/sm/enums/encryption_type.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/storage_manager/context.h"
 
 using namespace tiledb::common;
@@ -100,6 +104,28 @@ void Context::save_error(const StatusException& st) {
   last_error_ = st.what();
 }
 
+void Context::warmup(const std::vector<URI>& uris) {
+  EncryptionKey key;
+  throw_if_not_ok(key.set_key(EncryptionType::NO_ENCRYPTION, nullptr, 0));
+
+  throw_if_not_ok(
+      parallel_for(&resources_.io_tp(), 0, uris.size(), [&](size_t i) {
+        try {
+          // Constructing the directory performs the listing, which also
+          // forces lazy initialization of the backend client for the URI's
+          // scheme.
+          ArrayDirectory array_dir(resources_, uris[i], 0, UINT64_MAX);
+          array_dir.load_array_schema_latest(
+              key, resources_.ephemeral_memory_tracker());
+        } catch (const std::exception& e) {
+          logger_->warn(
+              "[Context::warmup] Skipping '" + uris[i].to_string() +
+              "': " + e.what());
+        }
+        return Status::Ok();
+      }));
+}
+
 Status Context::get_config_thread_count(
     const Config& config, uint64_t& config_thread_count_ret) {
   // The "sm.num_async_threads", "sm.num_reader_threads",
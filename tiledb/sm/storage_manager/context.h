@@ -36,6 +36,7 @@
 #include "tiledb/common/exception/exception.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/filesystem/uri.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/storage_manager/context_resources.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -78,6 +79,23 @@ class Context {
   /** Returns the last error status. */
   optional<std::string> last_error();
 
+  /**
+   * Eagerly initializes backend clients and pre-loads array metadata for
+   * the given URIs.
+   *
+   * Backend SDK clients (S3, Azure, GCS) are initialized lazily on first
+   * use, and the first access to an array additionally pays a directory
+   * listing and a schema load. Short-lived processes can call this once at
+   * startup to perform all of that work concurrently on the I/O thread
+   * pool instead of paying it serially inside the first query.
+   *
+   * Warm-up is best effort: errors on individual URIs (e.g. an array that
+   * does not exist yet) are logged and ignored.
+   *
+   * @param uris The URIs of the arrays to warm up.
+   */
+  void warmup(const std::vector<URI>& uris);
+
   /**
    * Saves a `Status` as the last error.
    */
@@ -33,6 +33,7 @@
 #include "tiledb/sm/storage_manager/context_resources.h"
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/sm/rest/rest_client.h"
+#include "tiledb/sm/stats/trace.h"
 
 using namespace tiledb::common;
 
@@ -54,8 +55,12 @@ ContextResources::ContextResources(
           HERE(), config, memory_tracker_manager_))
     , config_(config)
     , logger_(logger)
-    , compute_tp_(compute_thread_count)
-    , io_tp_(io_thread_count)
+    , compute_tp_(
+          compute_thread_count,
+          config.get<bool>("sm.numa_pinning", Config::must_find))
+    , io_tp_(
+          io_thread_count,
+          config.get<bool>("sm.numa_pinning", Config::must_find))
     , stats_(make_shared<stats::Stats>(HERE(), stats_name))
     , vfs_(stats_.get(), &compute_tp_, &io_tp_, config)
     , rest_client_{RestClientFactory::make(
@@ -63,7 +68,25 @@ ContextResources::ContextResources(
           config_,
           compute_tp(),
           *logger_.get(),
-          create_memory_tracker())} {
+          create_memory_tracker())}
+    , tile_cache_(make_shared<TileCache>(
+          HERE(),
+          config_.get<uint64_t>("sm.tile_cache_size", Config::must_find),
+          create_memory_tracker()))
+    , fragment_meta_cache_(make_shared<FragmentMetaCache>(
+          HERE(),
+          config_.get<uint64_t>(
+              "sm.fragment_meta_cache_size", Config::must_find),
+          create_memory_tracker()))
+    , enumeration_cache_(make_shared<EnumerationCache>(
+          HERE(),
+          config_.get<uint64_t>("sm.enumeration_cache_size", Config::must_find),
+          create_memory_tracker()))
+    , generic_tile_cache_(make_shared<GenericTileCache>(
+          HERE(),
+          config_.get<uint64_t>(
+              "sm.generic_tile_cache_size", Config::must_find),
+          create_memory_tracker())) {
   ephemeral_memory_tracker_->set_type(MemoryTrackerType::EPHEMERAL);
 
   /*
@@ -71,6 +94,14 @@ ContextResources::ContextResources(
    */
   stats::all_stats.register_stats(stats_);
 
+  // Tracing is process-wide; the first context to configure a trace file
+  // enables it.
+  auto trace_file =
+      config_.get<std::string>("sm.trace.file", Config::must_find);
+  if (!trace_file.empty()) {
+    stats::global_tracer.enable(trace_file);
+  }
+
   if (!logger_) {
     throw std::logic_error("Logger must not be nullptr");
   }
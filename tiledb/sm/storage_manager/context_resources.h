@@ -35,9 +35,14 @@
 
 #include "tiledb/common/exception/exception.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
+#include "tiledb/sm/cache/enumeration_cache.h"
+#include "tiledb/sm/cache/fragment_meta_cache.h"
+#include "tiledb/sm/cache/generic_tile_cache.h"
+#include "tiledb/sm/cache/tile_cache.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/stats/global_stats.h"
+#include "tiledb/sm/storage_manager/read_profiles.h"
 
 using namespace tiledb::common;
 
@@ -111,6 +116,31 @@ class ContextResources {
     return rest_client_;
   }
 
+  /** Returns the unfiltered tile cache, shared by all queries. */
+  [[nodiscard]] inline TileCache& tile_cache() const {
+    return *tile_cache_;
+  }
+
+  /** Returns the consolidated fragment metadata cache. */
+  [[nodiscard]] inline FragmentMetaCache& fragment_meta_cache() const {
+    return *fragment_meta_cache_;
+  }
+
+  /** Returns the enumeration cache, shared by all array opens. */
+  [[nodiscard]] inline EnumerationCache& enumeration_cache() const {
+    return *enumeration_cache_;
+  }
+
+  /** Returns the generic tile cache, shared by all array opens. */
+  [[nodiscard]] inline GenericTileCache& generic_tile_cache() const {
+    return *generic_tile_cache_;
+  }
+
+  /** Returns the per array read profiles, shared by all queries. */
+  [[nodiscard]] inline ReadProfiles& read_profiles() const {
+    return read_profiles_;
+  }
+
   [[nodiscard]] inline MemoryTrackerManager& memory_tracker_manager() const {
     return *memory_tracker_manager_;
   }
@@ -172,6 +202,27 @@ class ContextResources {
 
   /** The rest client (may be null if none was configured). */
   shared_ptr<RestClient> rest_client_;
+
+  /** The unfiltered tile cache, shared by all queries on this context. */
+  mutable shared_ptr<TileCache> tile_cache_;
+
+  /**
+   * The consolidated fragment metadata cache, shared by all array opens
+   * on this context.
+   */
+  mutable shared_ptr<FragmentMetaCache> fragment_meta_cache_;
+
+  /** The enumeration cache, shared by all array opens on this context. */
+  mutable shared_ptr<EnumerationCache> enumeration_cache_;
+
+  /**
+   * The cache of unfiltered generic tiles (schema, enumeration and
+   * metadata objects), shared by all array opens on this context.
+   */
+  mutable shared_ptr<GenericTileCache> generic_tile_cache_;
+
+  /** Read execution profiles, per array, shared by all queries. */
+  mutable ReadProfiles read_profiles_;
 };
 
 }  // namespace tiledb::sm
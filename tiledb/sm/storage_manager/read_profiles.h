@@ -0,0 +1,119 @@
+/**
+ * @file read_profiles.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ReadProfiles.
+ */
+
+#ifndef TILEDB_READ_PROFILES_H
+#define TILEDB_READ_PROFILES_H
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace tiledb::sm {
+
+/**
+ * Execution feedback from completed read queries, recorded per array URI and
+ * shared by all queries on a context.
+ *
+ * Readers size their internal batches from configuration values before any
+ * data is seen, which makes the first queries on an array run with generic
+ * parameters that often need hand-tuning. This registry lets a reader record
+ * what it actually observed so that subsequent queries on the same array can
+ * start from measured values instead.
+ */
+class ReadProfiles {
+ public:
+  /* ********************************* */
+  /*           TYPE DEFINITIONS        */
+  /* ********************************* */
+
+  /** Execution feedback recorded for one array. */
+  struct ArrayReadProfile {
+    /** Number of read queries recorded for the array. */
+    uint64_t num_reads_ = 0;
+
+    /**
+     * Largest memory footprint of a single coordinate tile seen while
+     * reading the array, including the result tile structures.
+     */
+    uint64_t max_coord_tiles_size_ = 0;
+  };
+
+  /* ********************************* */
+  /*                 API               */
+  /* ********************************* */
+
+  /**
+   * Returns the profile recorded for an array, or a default constructed
+   * profile if no read was recorded yet.
+   *
+   * @param array_uri URI of the array.
+   * @return Profile for the array.
+   */
+  ArrayReadProfile profile(const std::string& array_uri) const {
+    std::lock_guard<std::mutex> lg(mutex_);
+    auto it = profiles_.find(array_uri);
+    return it == profiles_.end() ? ArrayReadProfile() : it->second;
+  }
+
+  /**
+   * Records the execution feedback of a completed read query.
+   *
+   * @param array_uri URI of the array.
+   * @param max_coord_tiles_size Largest coordinate tile footprint seen by
+   *     the query, 0 if the query did not load coordinate tiles.
+   */
+  void record_read(
+      const std::string& array_uri, uint64_t max_coord_tiles_size) {
+    std::lock_guard<std::mutex> lg(mutex_);
+    auto& profile = profiles_[array_uri];
+    profile.num_reads_++;
+    profile.max_coord_tiles_size_ =
+        std::max(profile.max_coord_tiles_size_, max_coord_tiles_size);
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Mutex protecting the profiles. */
+  mutable std::mutex mutex_;
+
+  /** Profiles, per array URI. */
+  std::unordered_map<std::string, ArrayReadProfile> profiles_;
+};
+
+}  // namespace tiledb::sm
+
+#endif  // TILEDB_READ_PROFILES_H
@@ -51,6 +51,7 @@
 #include "tiledb/sm/enums/array_type.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/object_type.h"
+#include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/global_state/global_state.h"
 #include "tiledb/sm/global_state/unit_test_config.h"
@@ -63,6 +64,7 @@
 #include "tiledb/sm/query/query.h"
 #include "tiledb/sm/rest/rest_client.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/subarray/subarray.h"
 #include "tiledb/sm/tile/generic_tile_io.h"
 #include "tiledb/sm/tile/tile.h"
 
@@ -93,7 +95,12 @@ StorageManagerCanonical::StorageManagerCanonical(
     , logger_(logger)
     , cancellation_in_progress_(false)
     , config_(config)
-    , queries_in_progress_(0) {
+    , queries_in_progress_(0)
+    , admission_memory_budget_(config.get<uint64_t>(
+          "sm.query.admission.memory_budget", Config::must_find))
+    , admission_queue_timeout_ms_(config.get<uint64_t>(
+          "sm.query.admission.queue_timeout_ms", Config::must_find))
+    , admitted_cost_(0) {
   /*
    * This is a transitional version the implementation of this constructor. To
    * complete the transition, the `init` member function must disappear.
@@ -194,6 +201,7 @@ void StorageManagerCanonical::increment_in_progress() {
 
 Status StorageManagerCanonical::query_submit(Query* query) {
   // Process the query
+  QueryAdmission admission(this, query);
   QueryInProgress in_progress(this);
   auto st = query->process();
 
@@ -215,4 +223,70 @@ void StorageManagerCanonical::wait_for_zero_in_progress() {
 /*         PRIVATE METHODS        */
 /* ****************************** */
 
+uint64_t StorageManagerCanonical::estimate_query_cost(Query* query) const {
+  // Write queries are bounded by user buffers that are already in memory;
+  // only reads are costed against the admission budget.
+  if (query->type() != QueryType::READ) {
+    return 0;
+  }
+
+  auto subarray = query->subarray();
+  if (subarray == nullptr) {
+    return 0;
+  }
+
+  // Sum the on-disk payload of the fragments the subarray may touch. Before
+  // the first submission this is every fragment in the array; a resubmitted
+  // incomplete query has computed the fragments its ranges actually overlap
+  // and the estimate tightens accordingly.
+  auto& fragment_metadata = query->array()->fragment_metadata();
+  const auto& relevant_fragments = subarray->relevant_fragments();
+  uint64_t cost = 0;
+  for (size_t i = 0; i < relevant_fragments.size(); i++) {
+    cost += fragment_metadata[relevant_fragments[i]]->fragment_size();
+  }
+
+  return cost;
+}
+
+uint64_t StorageManagerCanonical::admit_query(Query* query) {
+  if (admission_memory_budget_ == 0) {
+    return 0;
+  }
+
+  auto cost = estimate_query_cost(query);
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(admission_queue_timeout_ms_);
+  std::unique_lock<std::mutex> lck(admission_mtx_);
+  auto admissible = [&]() {
+    // A query whose cost exceeds the budget on its own is admitted once
+    // nothing else is running so that it cannot be starved forever.
+    return admitted_cost_ == 0 ||
+           admitted_cost_ + cost <= admission_memory_budget_;
+  };
+  if (!admission_cv_.wait_until(lck, deadline, admissible)) {
+    throw StorageManagerException(
+        "Query admission deadline exceeded after " +
+        std::to_string(admission_queue_timeout_ms_) +
+        "ms waiting for " + std::to_string(cost) +
+        " bytes of estimated cost; reduce concurrent load or increase "
+        "'sm.query.admission.memory_budget'.");
+  }
+  admitted_cost_ += cost;
+
+  return cost;
+}
+
+void StorageManagerCanonical::release_query(uint64_t cost) {
+  if (admission_memory_budget_ == 0) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lck(admission_mtx_);
+    admitted_cost_ -= cost;
+  }
+  admission_cv_.notify_all();
+}
+
 }  // namespace tiledb::sm
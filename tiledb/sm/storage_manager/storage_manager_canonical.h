@@ -173,6 +173,36 @@ class StorageManagerCanonical {
     }
   };
 
+  /**
+   * Helper RAII struct that admits a query against the admission memory
+   * budget in the constructor and releases its cost in the destructor, on
+   * the given StorageManagerCanonical instance.
+   *
+   * This ensures that the admitted cost is released even in the case of
+   * exceptions.
+   */
+  struct QueryAdmission {
+    /** The StorageManagerCanonical instance. */
+    StorageManagerCanonical* sm;
+
+    /** The admitted cost estimate, in bytes. */
+    uint64_t cost;
+
+    /**
+     * Constructor. Blocks until the query is admitted, throwing if the
+     * admission deadline passes first.
+     */
+    QueryAdmission(StorageManagerCanonical* sm, Query* query)
+        : sm(sm)
+        , cost(sm->admit_query(query)) {
+    }
+
+    /** Destructor. Releases the admitted cost. */
+    ~QueryAdmission() {
+      sm->release_query(cost);
+    }
+  };
+
   /* ********************************* */
   /*        PRIVATE ATTRIBUTES         */
   /* ********************************* */
@@ -201,6 +231,24 @@ class StorageManagerCanonical {
   /** Guards queries_in_progress_ counter. */
   std::condition_variable queries_in_progress_cv_;
 
+  /**
+   * The maximum summed cost estimate of admitted queries, in bytes. 0
+   * disables admission control.
+   */
+  uint64_t admission_memory_budget_;
+
+  /** Maximum time a query may wait for admission, in milliseconds. */
+  uint64_t admission_queue_timeout_ms_;
+
+  /** Summed cost estimate of the queries admitted for processing. */
+  uint64_t admitted_cost_;
+
+  /** Guards admitted_cost_. */
+  std::mutex admission_mtx_;
+
+  /** Signals waiting queries when admitted cost is released. */
+  std::condition_variable admission_cv_;
+
   /** Tracks all scheduled tasks that can be safely cancelled before execution.
    */
   CancelableTasks cancelable_tasks_;
@@ -217,6 +265,38 @@ class StorageManagerCanonical {
 
   /** Block until there are zero in-progress queries. */
   void wait_for_zero_in_progress();
+
+  /**
+   * Estimate the processing cost of a query, in bytes.
+   *
+   * Read queries are costed by the summed on-disk size of the fragments
+   * their subarray may touch. Before the first submission this is every
+   * fragment in the array; a resubmitted incomplete query has computed the
+   * fragments its ranges actually overlap and the estimate tightens
+   * accordingly. Write queries are bounded by user buffers that are already
+   * in memory and are costed at zero.
+   *
+   * @param query The query to estimate.
+   * @return The cost estimate, in bytes.
+   */
+  uint64_t estimate_query_cost(Query* query) const;
+
+  /**
+   * Block until the query fits in the admission memory budget, throwing if
+   * the admission deadline passes first. A no-op returning 0 when admission
+   * control is disabled.
+   *
+   * @param query The query to admit.
+   * @return The admitted cost estimate, in bytes.
+   */
+  uint64_t admit_query(Query* query);
+
+  /**
+   * Release the admitted cost of a finished query and wake waiting queries.
+   *
+   * @param cost The cost returned by admit_query.
+   */
+  void release_query(uint64_t cost);
 };
 
 }  // namespace tiledb::sm
@@ -161,6 +161,72 @@ tuple<Status, optional<std::string>> RangeSetAndSuperset::add_range(
   }
 }
 
+optional<std::string> RangeSetAndSuperset::add_ranges(
+    ThreadPool* const compute_tp,
+    std::vector<Range> ranges,
+    const bool read_range_oob_error) {
+  if (ranges.empty()) {
+    return nullopt;
+  }
+
+  optional<std::string> warn_message = nullopt;
+  for (auto& range : ranges) {
+    impl_->check_range_is_valid(range);
+    if (read_range_oob_error) {
+      throw_if_not_ok(impl_->check_range_is_subset(range));
+    } else {
+      auto warning = impl_->crop_range_with_warning(range);
+      if (warning.has_value() && !warn_message.has_value()) {
+        warn_message = warning;
+      }
+    }
+  }
+
+  // Sort and merge the batch up front so the stored range count is
+  // proportional to the merged count, not the raw input count.
+  impl_->sort_ranges(compute_tp, ranges);
+  impl_->merge_ranges(ranges);
+
+  if (is_implicitly_initialized_) {
+    ranges_.clear();
+    is_implicitly_initialized_ = false;
+  }
+  if (ranges_.empty()) {
+    ranges_ = std::move(ranges);
+  } else {
+    ranges_.reserve(ranges_.size() + ranges.size());
+    for (const auto& range : ranges) {
+      throw_if_not_ok(impl_->add_range(ranges_, range));
+    }
+  }
+
+  return warn_message;
+}
+
+void RangeSetAndSuperset::add_ranges_complement(
+    ThreadPool* const compute_tp, std::vector<Range> ranges) {
+  if (ranges.empty()) {
+    return;
+  }
+
+  for (auto& range : ranges) {
+    impl_->check_range_is_valid(range);
+  }
+
+  // The complement is computed over sorted, non-overlapping ranges.
+  impl_->sort_ranges(compute_tp, ranges);
+  impl_->merge_ranges(ranges);
+  impl_->complement_sorted_ranges(ranges);
+
+  if (is_implicitly_initialized_) {
+    ranges_.clear();
+    is_implicitly_initialized_ = false;
+  }
+  for (const auto& range : ranges) {
+    throw_if_not_ok(impl_->add_range(ranges_, range));
+  }
+}
+
 Status RangeSetAndSuperset::add_range_unrestricted(const Range& range) {
   if (is_implicitly_initialized_) {
     ranges_.clear();
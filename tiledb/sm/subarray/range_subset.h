@@ -38,8 +38,11 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/type/range/range.h"
+#include "tiledb/type/range/range_operations.h"
 
+#include <cmath>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -73,14 +76,14 @@ struct AddStrategy<
     }
 
     // If the start index of `range` immediately follows the end of the
-    // last range on `ranges`, they are contiguous and will be coalesced.
+    // last range on `ranges`, they are adjacent and will be coalesced.
+    // Overlapping ranges are deliberately kept distinct: a multi-range
+    // query returns results per range.
     Range& last_range = ranges.back();
-    const bool contiguous_after =
-        last_range.end_as<T>() != std::numeric_limits<T>::max() &&
-        last_range.end_as<T>() + 1 == new_range.start_as<T>();
+    auto [order, adjacent] = type::range_compare<T>(last_range, new_range);
 
-    // Coalesce `range` with `last_range` if they are contiguous.
-    if (contiguous_after) {
+    // Coalesce `range` with `last_range` if they are adjacent.
+    if (order < 0 && adjacent) {
       last_range.set_end_fixed(new_range.end_fixed());
     } else {
       ranges.emplace_back(new_range);
@@ -158,18 +161,12 @@ struct MergeStrategy<
 
     // Merge
     for (auto tail = head + 1; tail != ranges.end(); tail++) {
-      // For integer ranges, we can merge two ranges if the start of a range is
-      // the next integer after the end of the other. For this reason, we use
-      // end + 1 for integer values. For floating point ranges, this is not the
-      // case and we simply use the end.
-      auto head_end = std::is_integral<T>::value ? head->end_as<T>() + 1 :
-                                                   head->end_as<T>();
-      const bool can_merge =
-          head->end_as<T>() != std::numeric_limits<T>::max() &&
-          tail->start_as<T>() <= head_end;
-
-      if (can_merge) {
-        head->set_end_fixed(tail->end_fixed());
+      // Since the ranges are sorted, the union of two consecutive ranges is
+      // an interval exactly when they intersect or are adjacent. Adjacency
+      // follows the interval library semantics: integer ranges are adjacent
+      // when one starts at the next integer after the end of the other;
+      // floating point ranges are never adjacent.
+      if (type::range_union<T>(*head, *tail)) {
         merged_cells++;
       } else {
         head++;
@@ -211,6 +208,70 @@ struct MergeStrategy<std::string, std::string> {
   };
 };
 
+/** Default complement behavior: complement is not enabled. */
+template <typename T, typename Enable = T>
+struct ComplementStrategy {
+  static void complement_sorted_ranges(const Range&, std::vector<Range>&);
+};
+
+/** Complement algorithm for numeric-type ranges. */
+template <typename T>
+struct ComplementStrategy<
+    T,
+    typename std::enable_if<std::is_arithmetic<T>::value, T>::type> {
+  /** Returns the largest representable value less than `value`. */
+  static T prev_value(T value) {
+    if constexpr (std::is_integral<T>::value) {
+      return value - 1;
+    } else {
+      return std::nextafter(value, std::numeric_limits<T>::lowest());
+    }
+  }
+
+  /** Returns the smallest representable value greater than `value`. */
+  static T next_value(T value) {
+    if constexpr (std::is_integral<T>::value) {
+      return value + 1;
+    } else {
+      return std::nextafter(value, std::numeric_limits<T>::max());
+    }
+  }
+
+  static void complement_sorted_ranges(
+      const Range& superset, std::vector<Range>& ranges) {
+    auto domain = static_cast<const T*>(superset.data());
+    std::vector<Range> result;
+    result.reserve(ranges.size() + 1);
+
+    // Walk the sorted, non-overlapping excluded ranges and emit the gaps
+    // between them that intersect the superset.
+    T next = domain[0];
+    bool reached_end = false;
+    for (const auto& range : ranges) {
+      auto start = range.start_as<T>();
+      auto end = range.end_as<T>();
+      if (end < domain[0] || start > domain[1]) {
+        continue;
+      }
+      if (start > next) {
+        T bounds[2] = {next, prev_value(start)};
+        result.emplace_back(bounds, sizeof(bounds));
+      }
+      if (end >= domain[1]) {
+        reached_end = true;
+        break;
+      }
+      next = std::max(next, next_value(end));
+    }
+    if (!reached_end && next <= domain[1]) {
+      T bounds[2] = {next, domain[1]};
+      result.emplace_back(bounds, sizeof(bounds));
+    }
+
+    ranges = std::move(result);
+  };
+};
+
 class RangeSetAndSupersetImpl {
  public:
   /* ********************************* */
@@ -271,6 +332,14 @@ class RangeSetAndSupersetImpl {
    * @param ranges The sorted ranges to be merged.
    */
   virtual void merge_ranges(std::vector<Range>& ranges) const = 0;
+
+  /**
+   * Replaces sorted, non-overlapping ranges with their complement in the
+   * superset.
+   *
+   * @param ranges The sorted, non-overlapping ranges to complement.
+   */
+  virtual void complement_sorted_ranges(std::vector<Range>& ranges) const = 0;
 };
 
 template <typename T, bool CoalesceAdds>
@@ -317,6 +386,10 @@ class TypedRangeSetAndSupersetImpl : public RangeSetAndSupersetImpl {
     MergeStrategy<T>::merge_sorted_ranges(ranges);
   }
 
+  void complement_sorted_ranges(std::vector<Range>& ranges) const override {
+    ComplementStrategy<T>::complement_sorted_ranges(superset_, ranges);
+  }
+
  private:
   /** Maximum possible range. */
   Range superset_{};
@@ -354,6 +427,14 @@ class TypedRangeSetAndFullsetImpl : public RangeSetAndSupersetImpl {
   void merge_ranges(std::vector<Range>& ranges) const override {
     MergeStrategy<T>::merge_sorted_ranges(ranges);
   }
+
+  void complement_sorted_ranges(std::vector<Range>& ranges) const override {
+    // With no explicit superset, complement over the full typeset.
+    T bounds[2] = {
+        std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()};
+    Range full_typeset(bounds, sizeof(bounds));
+    ComplementStrategy<T>::complement_sorted_ranges(full_typeset, ranges);
+  }
 };
 
 /**
@@ -393,6 +474,13 @@ class TypedRangeSetAndFullsetImpl<std::string, CoalesceAdds>
   void merge_ranges(std::vector<Range>& ranges) const override {
     MergeStrategy<std::string>::merge_sorted_ranges(ranges);
   }
+
+  void complement_sorted_ranges(std::vector<Range>&) const override {
+    // The complement of a string range set is unbounded above, so it cannot
+    // be represented as a finite set of ranges.
+    throw std::logic_error(
+        "Complement ranges are not supported for string dimensions.");
+  }
 };
 
 }  // namespace detail
@@ -478,6 +566,50 @@ class RangeSetAndSuperset {
    */
   Status add_range_unrestricted(const Range& range);
 
+  /**
+   * Adds a batch of ranges to the range set after checking validity.
+   *
+   * The input ranges are sorted and merged before they are added, so the
+   * number of stored ranges is proportional to the merged range count,
+   * not the raw input count. Note this reorders the input: the merged
+   * ranges are added in sorted order, unlike repeated ``add_range``
+   * calls which preserve insertion order.
+   *
+   * If the ranges are currently implicitly initialized, then they will be
+   * cleared before the batch is added. Otherwise, the merged batch is
+   * appended to the ranges already in the set.
+   *
+   * @param compute_tp The compute thread pool, used to sort the input.
+   * @param ranges The ranges to add.
+   * @param read_range_oob_error Flag for behavior when a range is out of
+   * bounds. If ``true``, an exception is thrown. If ``false``, the range
+   * is cropped and a warning message is returned.
+   * @return A warning message for the first cropped range, if any.
+   **/
+  optional<std::string> add_ranges(
+      ThreadPool* const compute_tp,
+      std::vector<Range> ranges,
+      const bool read_range_oob_error = true);
+
+  /**
+   * Adds the complement of a set of ranges to the range set.
+   *
+   * The input ranges are sorted and merged, then subtracted from the
+   * superset, and the resulting ranges are added to the set. This converts
+   * an exclusion list into the equivalent union of inclusion ranges in one
+   * pass, instead of requiring the caller to construct the complement
+   * ranges and add them one by one.
+   *
+   * If the ranges are currently implicitly initialized, then they will be
+   * cleared before the complement is added. Otherwise, the complement is
+   * unioned with the ranges already in the set.
+   *
+   * @param compute_tp The compute thread pool, used to sort the input.
+   * @param ranges The ranges to exclude from the superset.
+   */
+  void add_ranges_complement(
+      ThreadPool* const compute_tp, std::vector<Range> ranges);
+
   /**
    * Removes all ranges.
    *
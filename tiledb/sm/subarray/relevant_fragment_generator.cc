@@ -62,6 +62,55 @@ RelevantFragmentGenerator::RelevantFragmentGenerator(
   for (uint32_t d = 0; d < dim_num; ++d) {
     fragment_bytemaps_[d].resize(fragment_num, subarray_.is_default(d) ? 1 : 0);
   }
+
+  // Restrict the candidate fragments from a previous computation on the
+  // same opened array, if possible.
+  candidates_ = candidates_from_cache();
+}
+
+optional<std::vector<unsigned>>
+RelevantFragmentGenerator::candidates_from_cache() const {
+  auto cache = array_->relevant_fragments_cache();
+  if (!cache.has_value() ||
+      cache->fragment_num != array_->fragment_metadata().size()) {
+    return nullopt;
+  }
+
+  // Validate that every range of the subarray is contained in one of the
+  // ranges of the cached computation, for every dimension. A fragment whose
+  // non-empty domain does not overlap the cached ranges cannot overlap any
+  // range contained in them, so the cached relevant fragments are then a
+  // superset of the relevant fragments of this subarray.
+  auto dim_num = array_->array_schema_latest().dim_num();
+  for (dimension_size_type d = 0; d < dim_num; ++d) {
+    // A default dimension in the cached computation covers the whole domain.
+    if (cache->is_default[d]) {
+      continue;
+    }
+
+    // A default dimension in the subarray can only be contained in a
+    // dimension that was also default in the cached computation.
+    if (subarray_.is_default(d)) {
+      return nullopt;
+    }
+
+    auto dim{array_->array_schema_latest().dimension_ptr(d)};
+    for (const auto& range : subarray_.ranges_for_dim(d)) {
+      bool covered = false;
+      for (const auto& cached_range : cache->ranges[d]) {
+        if (dim->covered(range, cached_range)) {
+          covered = true;
+          break;
+        }
+      }
+
+      if (!covered) {
+        return nullopt;
+      }
+    }
+  }
+
+  return std::move(cache->relevant_fragments);
 }
 
 bool RelevantFragmentGenerator::update_range_coords(
@@ -113,8 +162,38 @@ RelevantFragments RelevantFragmentGenerator::compute_relevant_fragments(
         &fragment_bytemaps_[d]);
   }));
 
+  if (candidates_.has_value()) {
+    stats_->add_counter("compute_relevant_frags.candidate_cache_hit", 1);
+  }
+
   // Recalculate relevant fragments.
-  return RelevantFragments(dim_num, fragment_num, fragment_bytemaps_);
+  RelevantFragments relevant_fragments(
+      dim_num, fragment_num, fragment_bytemaps_);
+
+  // Cache the outcome on the opened array so that later queries with
+  // contained ranges can restrict their candidate fragments to the ones
+  // found relevant here.
+  OpenedArray::RelevantFragmentsCacheEntry entry;
+  entry.ranges.resize(dim_num);
+  entry.is_default.resize(dim_num);
+  entry.fragment_num = fragment_num;
+  for (dimension_size_type d = 0; d < dim_num; ++d) {
+    entry.is_default[d] = subarray_.is_default(d);
+    if (!entry.is_default[d]) {
+      const auto& ranges = subarray_.ranges_for_dim(d);
+      entry.ranges[d].reserve(end_coords_[d] - start_coords_[d] + 1);
+      for (uint64_t r = start_coords_[d]; r <= end_coords_[d]; ++r) {
+        entry.ranges[d].emplace_back(ranges[r]);
+      }
+    }
+  }
+  entry.relevant_fragments.reserve(relevant_fragments.size());
+  for (auto f : relevant_fragments) {
+    entry.relevant_fragments.emplace_back(f);
+  }
+  array_->set_relevant_fragments_cache(std::move(entry));
+
+  return relevant_fragments;
 }
 
 Status RelevantFragmentGenerator::compute_relevant_fragments_for_dim(
@@ -127,7 +206,13 @@ Status RelevantFragmentGenerator::compute_relevant_fragments_for_dim(
   const auto meta = array_->fragment_metadata();
   auto dim{array_->array_schema_latest().dimension_ptr(dim_idx)};
 
-  return parallel_for(compute_tp, 0, fragment_num, [&](const uint64_t f) {
+  // Only compute on the candidate fragments, when they were restricted.
+  const uint64_t candidate_num =
+      candidates_.has_value() ? candidates_->size() : fragment_num;
+
+  return parallel_for(compute_tp, 0, candidate_num, [&](const uint64_t c) {
+    const uint64_t f = candidates_.has_value() ? (*candidates_)[c] : c;
+
     // We're done when we have already determined fragment `f` to
     // be relevant for this dimension.
     if ((*frag_bytemap)[f] == 1) {
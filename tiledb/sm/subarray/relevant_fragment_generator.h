@@ -101,6 +101,16 @@ class RelevantFragmentGenerator {
   /*          PRIVATE METHODS          */
   /* ********************************* */
 
+  /**
+   * Restricts the candidate fragments from the cached outcome of a previous
+   * relevant fragments computation on the same opened array, if all the
+   * ranges of the subarray are contained in the ranges of that computation.
+   *
+   * @return The candidate fragment indexes, or `nullopt` if the cached
+   *    computation is missing or does not contain the subarray ranges.
+   */
+  optional<std::vector<unsigned>> candidates_from_cache() const;
+
   /**
    * Computes the relevant fragment bytemap for a specific dimension.
    *
@@ -133,6 +143,12 @@ class RelevantFragmentGenerator {
    */
   std::vector<uint64_t> end_coords_;
 
+  /**
+   * The candidate fragment indexes to compute on, or `nullopt` when all the
+   * fragments of the array are candidates.
+   */
+  optional<std::vector<unsigned>> candidates_;
+
   /**
    * The fragment bytemaps for each dimension. The inner
    * vector is the fragment bytemap that has a byte element
@@ -41,6 +41,7 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/attribute.h"
+#include "tiledb/sm/array_schema/current_domain.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/dimension_label.h"
 #include "tiledb/sm/array_schema/domain.h"
@@ -86,6 +87,7 @@ Subarray::Subarray()
     , layout_(Layout::UNORDERED)
     , cell_order_(Layout::ROW_MAJOR)
     , est_result_size_computed_(false)
+    , est_result_size_max_sampled_tiles_(0)
     , relevant_fragments_(0)
     , coalesce_ranges_(true)
     , ranges_sorted_(false) {
@@ -133,6 +135,7 @@ Subarray::Subarray(
     , layout_(layout)
     , cell_order_(opened_array->array_schema_latest().cell_order())
     , est_result_size_computed_(false)
+    , est_result_size_max_sampled_tiles_(0)
     , relevant_fragments_(opened_array->fragment_metadata().size())
     , coalesce_ranges_(coalesce_ranges)
     , ranges_sorted_(false) {
@@ -480,6 +483,131 @@ void Subarray::add_ranges_list(
   }
 }
 
+void Subarray::add_ranges(unsigned dim_idx, std::vector<Range> ranges) {
+  auto dim_num = array_->array_schema_latest().dim_num();
+  if (dim_idx >= dim_num) {
+    throw SubarrayException("Cannot add ranges; Invalid dimension index");
+  }
+
+  if (label_range_subset_[dim_idx].has_value()) {
+    throw SubarrayException(
+        "Cannot add range to to dimension; A range is already set on a "
+        "dimension label for this dimension");
+  }
+
+  if (ranges.empty()) {
+    return;
+  }
+
+  // Must reset the result size and tile overlap
+  est_result_size_computed_ = false;
+  tile_overlap_.clear();
+
+  // Sort, merge and add the whole batch at once.
+  auto range_num = ranges.size();
+  auto dim_name = array_->array_schema_latest().dimension_ptr(dim_idx)->name();
+  auto oob_warning = range_subset_[dim_idx].add_ranges(
+      &array_->resources().compute_tp(),
+      std::move(ranges),
+      err_on_range_oob_);
+  if (oob_warning.has_value()) {
+    LOG_WARN(oob_warning.value() + " on dimension '" + dim_name + "'");
+  }
+
+  // Update is default and stats counter.
+  is_default_[dim_idx] = range_subset_[dim_idx].is_implicitly_initialized();
+  stats_->add_counter("add_range_dim_" + std::to_string(dim_idx), range_num);
+}
+
+void Subarray::add_ranges_complement(
+    unsigned dim_idx, const void* start, uint64_t count) {
+  if (dim_idx >= this->array_->array_schema_latest().dim_num()) {
+    throw SubarrayException("Cannot add range; Invalid dimension index");
+  }
+
+  if (has_label_ranges(dim_idx)) {
+    throw SubarrayException(
+        "Cannot add range to to dimension; A range is already set on a "
+        "dimension label for this dimension");
+  }
+
+  if (count % 2) {
+    throw SubarrayException(
+        "add_ranges_complement: Invalid count " + std::to_string(count) +
+        ", count must be a multiple of 2 ");
+  }
+
+  if (start == nullptr) {
+    throw SubarrayException("Cannot add ranges; Invalid start pointer");
+  }
+
+  auto dim{array_->array_schema_latest().dimension_ptr(dim_idx)};
+  if (dim->var_size()) {
+    throw SubarrayException("Cannot add range; Range must be fixed-sized");
+  }
+
+  // Must reset the result size and tile overlap
+  est_result_size_computed_ = false;
+  tile_overlap_.clear();
+
+  // Collect the excluded ranges.
+  auto coord_size = dim->coord_size();
+  std::vector<Range> excluded;
+  excluded.reserve(count / 2);
+  for (size_t i = 0; i < count / 2; i++) {
+    uint8_t* ptr = (uint8_t*)start + 2 * coord_size * i;
+    excluded.emplace_back(ptr, 2 * coord_size);
+  }
+
+  // Subtract the excluded set from the dimension domain in one pass and
+  // add the resulting inclusion ranges.
+  range_subset_[dim_idx].add_ranges_complement(
+      &array_->resources().compute_tp(), std::move(excluded));
+  if (range_subset_[dim_idx].is_empty()) {
+    throw SubarrayException(
+        "Cannot add complement ranges to dimension '" + dim->name() +
+        "'; The excluded ranges cover the entire dimension domain");
+  }
+
+  // Update is default and stats counter.
+  is_default_[dim_idx] = range_subset_[dim_idx].is_implicitly_initialized();
+  stats_->add_counter("add_range_dim_" + std::to_string(dim_idx), 1);
+}
+
+void Subarray::clip_to_current_domain() {
+  auto& array_schema = array_->array_schema_latest();
+  auto cd = array_schema.get_current_domain();
+  if (cd->empty()) {
+    return;
+  }
+
+  // See if any data was written outside of the current domain.
+  bool all_ned_contained_in_current_domain = true;
+  for (auto& meta : array_->fragment_metadata()) {
+    if (!cd->includes(meta->non_empty_domain())) {
+      all_ned_contained_in_current_domain = false;
+      break;
+    }
+  }
+
+  for (unsigned d = 0; d < array_schema.dim_num(); d++) {
+    if (is_set(d)) {
+      // Make sure all ranges are contained in the current domain.
+      for (auto& range : ranges_for_dim(d)) {
+        if (!cd->includes(d, range)) {
+          throw SubarrayException(
+              "A range was set outside of the current domain.");
+        }
+      }
+    } else if (!all_ned_contained_in_current_domain) {
+      // Add ranges to make sure all data read is contained in the current
+      // domain.
+      auto range_copy = cd->ndrectangle()->get_range(d);
+      add_range(d, std::move(range_copy));
+    }
+  }
+}
+
 void Subarray::add_range_by_name(
     const std::string& dim_name, const void* start, const void* end) {
   unsigned dim_idx =
@@ -1771,6 +1899,14 @@ void Subarray::compute_est_result_size(
     return;
   }
 
+  // Lookup the sampled-estimation cap (0 means exact estimation).
+  bool found = false;
+  throw_if_not_ok(config->get<uint64_t>(
+      "sm.est_result_size.max_sampled_tiles",
+      &est_result_size_max_sampled_tiles_,
+      &found));
+  assert(found);
+
   // TODO: This routine is used in the path for the C APIs that estimate
   // result sizes. We need to refactor this routine to handle the scenario
   // where `tile_overlap_` may be truncated to fit the memory budget.
@@ -1898,6 +2034,24 @@ void Subarray::compute_relevant_fragment_est_result_sizes(
 
     // Parse tile ranges
     for (const auto& tr : overlap->tile_ranges_) {
+      // Sampled mode: estimate long fully-overlapping runs from a subset
+      // of their tiles instead of inspecting every tile's metadata.
+      if (est_result_size_max_sampled_tiles_ > 0 &&
+          tr.second - tr.first + 1 > est_result_size_max_sampled_tiles_) {
+        est_result_size_from_sampled_tiles(
+            array_schema,
+            all_dims_same_type,
+            meta,
+            name,
+            var_sizes,
+            nullable,
+            f,
+            tr,
+            result_sizes,
+            frag_tiles);
+        continue;
+      }
+
       for (uint64_t tid = tr.first; tid <= tr.second; ++tid) {
         for (size_t n = 0; n < name.size(); ++n) {
           // Zipped coords applicable only in homogeneous domains
@@ -2017,6 +2171,83 @@ void Subarray::compute_relevant_fragment_est_result_sizes(
   }
 }
 
+void Subarray::est_result_size_from_sampled_tiles(
+    const ArraySchema& array_schema,
+    bool all_dims_same_type,
+    const shared_ptr<FragmentMetadata>& meta,
+    const std::vector<std::string>& name,
+    const std::vector<bool>& var_sizes,
+    const std::vector<bool>& nullable,
+    unsigned f,
+    const std::pair<uint64_t, uint64_t>& tile_range,
+    std::vector<ResultSize>* result_sizes,
+    std::set<std::pair<unsigned, uint64_t>>* frag_tiles) const {
+  const uint64_t tile_num = tile_range.second - tile_range.first + 1;
+  const uint64_t sample_num = est_result_size_max_sampled_tiles_;
+  const uint64_t stride = tile_num / sample_num;
+
+  // Sample evenly spaced tiles across the range.
+  std::vector<uint64_t> sampled_tiles;
+  sampled_tiles.reserve(sample_num);
+  for (uint64_t i = 0; i < sample_num; ++i) {
+    auto tid = tile_range.first + i * stride;
+    sampled_tiles.emplace_back(tid);
+    frag_tiles->insert(std::pair<unsigned, uint64_t>(f, tid));
+  }
+
+  // Extrapolate a per-tile mean to the whole range, inflated by an upper
+  // ~95% confidence bound (two standard errors) so that sampling errs
+  // towards over-allocation rather than truncated buffers.
+  auto extrapolate = [&](double sum, double sum_sq) {
+    auto count = (double)sample_num;
+    auto mean = sum / count;
+    auto variance = std::max(0.0, sum_sq / count - mean * mean);
+    return (mean + 2.0 * std::sqrt(variance / count)) * tile_num;
+  };
+
+  for (size_t n = 0; n < name.size(); ++n) {
+    // Zipped coords applicable only in homogeneous domains
+    if (name[n] == constants::coords && !all_dims_same_type)
+      continue;
+
+    // If this attribute does not exist, skip it as this is likely a new
+    // attribute added as a result of schema evolution
+    if (!meta->array_schema()->is_field(name[n])) {
+      continue;
+    }
+
+    double sum_fixed = 0.0, sum_sq_fixed = 0.0;
+    double sum_var = 0.0, sum_sq_var = 0.0;
+    for (auto tid : sampled_tiles) {
+      double tile_size = meta->tile_size(name[n], tid);
+      if (var_sizes[n]) {
+        tile_size -= constants::cell_var_offset_size;
+        double tile_var_size =
+            meta->loaded_metadata()->tile_var_size(name[n], tid);
+        sum_var += tile_var_size;
+        sum_sq_var += tile_var_size * tile_var_size;
+      }
+      sum_fixed += tile_size;
+      sum_sq_fixed += tile_size * tile_size;
+    }
+
+    auto est_fixed = extrapolate(sum_fixed, sum_sq_fixed);
+    (*result_sizes)[n].size_fixed_ += est_fixed;
+    if (!var_sizes[n]) {
+      auto attr_datatype_size = datatype_size(array_schema.type(name[n]));
+      if (nullable[n])
+        (*result_sizes)[n].size_validity_ +=
+            est_fixed / attr_datatype_size * constants::cell_validity_size;
+    } else {
+      (*result_sizes)[n].size_var_ += extrapolate(sum_var, sum_sq_var);
+      if (nullable[n])
+        (*result_sizes)[n].size_validity_ += est_fixed /
+                                             constants::cell_var_offset_size *
+                                             constants::cell_validity_size;
+    }
+  }
+}
+
 template <class T>
 void Subarray::compute_tile_coords_col() {
   std::vector<std::set<T>> coords_set;
@@ -2224,6 +2455,81 @@ void Subarray::precompute_tile_overlap(
       tile_overlap_.range_idx_end() - tile_overlap_.range_idx_start() + 1);
 }
 
+void Subarray::refine_tile_overlap(const Subarray& parent) {
+  // Refinement maps parent ranges to child ranges, which is only
+  // straightforward when both subarrays consist of a single ND range.
+  if (range_num() != 1 || parent.range_num() != 1 ||
+      !parent.tile_overlap_.contains_range(0, 0)) {
+    return;
+  }
+
+  auto timer_se = stats_->start_timer("read_refine_tile_overlap");
+
+  compute_range_offsets();
+  relevant_fragments_ = parent.relevant_fragments_;
+
+  auto meta = array_->fragment_metadata();
+  auto fragment_num = meta.size();
+  SubarrayTileOverlap tile_overlap(fragment_num, 0, 0);
+  const auto range = this->ndrange(0);
+
+  for (unsigned f = 0; f < fragment_num; ++f) {
+    const auto* src = parent.tile_overlap_.at(f, 0);
+
+    // A fragment with no overlap in the parent cannot overlap the child.
+    if (src->tiles_.empty() && src->tile_ranges_.empty()) {
+      continue;
+    }
+
+    auto* dest = tile_overlap.at(f, 0);
+    if (meta[f]->dense()) {
+      // Dense overlap is geometric and cheap to recompute.
+      *dest = compute_tile_overlap(0, f);
+      continue;
+    }
+
+    // Re-test the parent's overlapping tiles directly against the leaf
+    // MBRs, merging the parent's two (sorted) result lists so that the
+    // refined results remain sorted on tile index.
+    const auto& rtree = meta[f]->loaded_metadata()->rtree();
+    auto retest = [&](uint64_t t) {
+      auto ratio =
+          rtree.domain()->overlap_ratio(range, is_default_, rtree.leaf(t));
+      if (ratio == 0.0) {
+        return;
+      }
+      if (ratio == 1.0) {
+        auto& tile_ranges = dest->tile_ranges_;
+        if (!tile_ranges.empty() && tile_ranges.back().second + 1 == t) {
+          tile_ranges.back().second = t;
+        } else {
+          tile_ranges.emplace_back(t, t);
+        }
+      } else {
+        dest->tiles_.emplace_back(t, ratio);
+      }
+    };
+
+    uint64_t ti = 0, ri = 0;
+    while (ti < src->tiles_.size() || ri < src->tile_ranges_.size()) {
+      if (ri == src->tile_ranges_.size() ||
+          (ti < src->tiles_.size() &&
+           src->tiles_[ti].first < src->tile_ranges_[ri].first)) {
+        retest(src->tiles_[ti++].first);
+      } else {
+        for (uint64_t t = src->tile_ranges_[ri].first;
+             t <= src->tile_ranges_[ri].second;
+             ++t) {
+          retest(t);
+        }
+        ++ri;
+      }
+    }
+  }
+
+  tile_overlap_ = std::move(tile_overlap);
+}
+
 void Subarray::precompute_all_ranges_tile_overlap(
     ThreadPool* compute_tp,
     const std::vector<FragIdx>& frag_tile_idx,
@@ -2349,6 +2655,8 @@ Subarray Subarray::clone() const {
   clone.attr_range_subset_ = attr_range_subset_;
   clone.tile_overlap_ = tile_overlap_;
   clone.est_result_size_computed_ = est_result_size_computed_;
+  clone.est_result_size_max_sampled_tiles_ =
+      est_result_size_max_sampled_tiles_;
   clone.relevant_fragments_ = relevant_fragments_;
   clone.coalesce_ranges_ = coalesce_ranges_;
   clone.est_result_size_ = est_result_size_;
@@ -2459,6 +2767,9 @@ void Subarray::swap(Subarray& subarray) {
   std::swap(range_offsets_, subarray.range_offsets_);
   std::swap(tile_overlap_, subarray.tile_overlap_);
   std::swap(est_result_size_computed_, subarray.est_result_size_computed_);
+  std::swap(
+      est_result_size_max_sampled_tiles_,
+      subarray.est_result_size_max_sampled_tiles_);
   std::swap(relevant_fragments_, subarray.relevant_fragments_);
   std::swap(coalesce_ranges_, subarray.coalesce_ranges_);
   std::swap(est_result_size_, subarray.est_result_size_);
@@ -2547,8 +2858,12 @@ void Subarray::load_relevant_fragment_rtrees(ThreadPool* compute_tp) const {
 
   auto status =
       parallel_for(compute_tp, 0, relevant_fragments_.size(), [&](uint64_t f) {
-        meta[relevant_fragments_[f]]->loaded_metadata()->load_rtree(
-            *encryption_key);
+        // Dense fragments compute tile overlap directly from the domain
+        // and never consult the R-tree, so skip the metadata read.
+        if (!meta[relevant_fragments_[f]]->dense()) {
+          meta[relevant_fragments_[f]]->loaded_metadata()->load_rtree(
+              *encryption_key);
+        }
         return Status::Ok();
       });
   throw_if_not_ok(status);
@@ -2593,15 +2908,28 @@ void Subarray::compute_relevant_fragment_tile_overlap(
     const auto r_start = fn_ctx->range_idx_offset_ + (t * ranges_per_thread);
     const auto r_end = fn_ctx->range_idx_offset_ +
                        std::min((t + 1) * ranges_per_thread - 1, range_num - 1);
-    for (uint64_t r = r_start; r <= r_end; ++r) {
-      if (dense) {  // Dense fragment
+    if (r_start > r_end) {
+      return Status::Ok();
+    }
+
+    if (dense) {  // Dense fragment
+      for (uint64_t r = r_start; r <= r_end; ++r) {
         *tile_overlap->at(frag_idx, r) =
             compute_tile_overlap(r + tile_overlap->range_idx_start(), frag_idx);
-      } else {  // Sparse fragment
-        const auto& range = this->ndrange(r + tile_overlap->range_idx_start());
-        meta->loaded_metadata()->get_tile_overlap(
-            range, is_default_, tile_overlap->at(frag_idx, r));
       }
+    } else {  // Sparse fragment
+      // Batch the thread's ranges into a single bulk R-tree traversal,
+      // which amortizes node visits across the whole batch.
+      std::vector<NDRange> ranges;
+      std::vector<TileOverlap*> tile_overlaps;
+      ranges.reserve(r_end - r_start + 1);
+      tile_overlaps.reserve(r_end - r_start + 1);
+      for (uint64_t r = r_start; r <= r_end; ++r) {
+        ranges.emplace_back(this->ndrange(r + tile_overlap->range_idx_start()));
+        tile_overlaps.emplace_back(tile_overlap->at(frag_idx, r));
+      }
+      meta->loaded_metadata()->get_tile_overlaps(
+          ranges, is_default_, tile_overlaps);
     }
     return Status::Ok();
   });
@@ -567,6 +567,44 @@ class Subarray {
       uint64_t count,
       bool check_for_label = true);
 
+  /**
+   * @brief Adds a batch of ranges to the query on the input dimension,
+   * sorting and merging the whole batch at once.
+   *
+   * Overlapping and adjacent input ranges are merged before they are
+   * stored, so planning cost downstream scales with the merged range
+   * count rather than the raw input count. Note the merged ranges are
+   * stored in sorted order, unlike repeated ``add_range`` calls which
+   * preserve insertion order.
+   *
+   * @param dim_idx Dimension index.
+   * @param ranges The ranges to add.
+   */
+  void add_ranges(unsigned dim_idx, std::vector<Range> ranges);
+
+  /**
+   * @brief Set ranges to the complement of an array of ranges (paired
+   * { begin,end } ).
+   *
+   * The input ranges are excluded from the dimension domain: the subarray
+   * covers the full domain minus their union. The exclusion set is sorted,
+   * merged and subtracted from the domain here, so callers do not need to
+   * construct the complement ranges themselves; the resulting inclusion
+   * ranges are pruned at tile granularity by the usual tile overlap
+   * computation.
+   *
+   * @param dim_idx Dimension index.
+   * @param start Pointer to start of the array.
+   * @param count Number of total elements to exclude. Must contain two
+   *     elements for each range.
+   * @note The pairs list is logically { {begin1,end1}, {begin2,end2}, ...}
+   * but because of typing considerations from the C api is simply presented
+   * as a linear list of individual items, though they should be multiple
+   * of 2
+   */
+  void add_ranges_complement(
+      unsigned dim_idx, const void* start, uint64_t count);
+
   /**
    * Adds a variable-sized range to the (read/write) query on the input
    * dimension by index, in the form of (start, end).
@@ -589,6 +627,20 @@ class Subarray {
    */
   void add_range_unsafe(uint32_t dim_idx, const Range& range);
 
+  /**
+   * Clips the subarray to the current domain of the array schema, so that
+   * later range computations never consider data that was retired by a
+   * domain shrink.
+   *
+   * Ranges that were explicitly set must already be contained in the
+   * current domain and this throws if one is not. When some fragment
+   * non-empty domain extends past the current domain, the dimensions that
+   * were not set get the current domain range added, which excludes the
+   * retired regions from tile overlap and relevant fragment computations.
+   * Does nothing if the schema has no current domain.
+   */
+  void clip_to_current_domain();
+
   /**
    * Adds a range to the (read/write) query on the input dimension by name.
    * The range components must be of the same type as the domain type of the
@@ -821,6 +873,23 @@ class Subarray {
       ThreadPool* compute_tp,
       bool override_memory_constraint = false);
 
+  /**
+   * Seeds the tile overlap of this subarray by refining the precomputed
+   * tile overlap of a parent subarray that this subarray was split from.
+   * Since this subarray covers a subset of the parent's domain slice,
+   * only the tiles the parent found overlapping need to be re-tested
+   * against the leaf MBRs, which avoids repeating identical R-tree
+   * traversals after every partition split.
+   *
+   * The function is a no-op unless both subarrays consist of a single
+   * ND range and the parent overlap has been computed; in that case the
+   * overlap is simply computed from scratch on the next
+   * `precompute_tile_overlap` call.
+   *
+   * @param parent The subarray this subarray was split from.
+   */
+  void refine_tile_overlap(const Subarray& parent);
+
   /**
    * Precomputes the tile overlap with all subarray ranges for all fragments.
    *
@@ -868,6 +937,39 @@ class Subarray {
       std::vector<ResultSize>* result_sizes,
       std::set<std::pair<unsigned, uint64_t>>* frag_tiles);
 
+  /**
+   * Estimates the result sizes contributed by a fully-overlapping tile
+   * range from a subset of evenly spaced sampled tiles, extrapolating
+   * the per-tile mean with an upper confidence bound. Used instead of
+   * inspecting every tile when `sm.est_result_size.max_sampled_tiles`
+   * is non-zero and the tile range exceeds it.
+   *
+   * @param array_schema The array schema.
+   * @param all_dims_same_type Whether or not all dimensions have the
+   *     same type.
+   * @param meta The metadata of the fragment the tile range belongs to.
+   * @param name The name vector of the attributes/dimensions to focus on.
+   * @param var_sizes A vector indicating which attribute/dimension is
+   *     var-sized.
+   * @param nullable A vector indicating which attribute is nullable.
+   * @param f The id of the fragment the tile range belongs to.
+   * @param tile_range The (inclusive) tile range to estimate.
+   * @param result_sizes The result sizes to be updated for all given names.
+   * @param frag_tiles The set of unique (fragment id, tile id) pairs,
+   *     updated with the sampled tiles only.
+   */
+  void est_result_size_from_sampled_tiles(
+      const ArraySchema& array_schema,
+      bool all_dims_same_type,
+      const shared_ptr<FragmentMetadata>& meta,
+      const std::vector<std::string>& name,
+      const std::vector<bool>& var_sizes,
+      const std::vector<bool>& nullable,
+      unsigned f,
+      const std::pair<uint64_t, uint64_t>& tile_range,
+      std::vector<ResultSize>* result_sizes,
+      std::set<std::pair<unsigned, uint64_t>>* frag_tiles) const;
+
   /**
    * Returns a cropped version of the subarray, constrained in the
    * tile with the input coordinates. The new subarray will have
@@ -1482,6 +1584,14 @@ class Subarray {
    */
   bool est_result_size_computed_;
 
+  /**
+   * The maximum number of tiles sampled per fully-overlapping tile range
+   * when estimating result sizes. `0` means exact estimation. Set from
+   * `sm.est_result_size.max_sampled_tiles` when the estimation is
+   * requested through `compute_est_result_size`.
+   */
+  uint64_t est_result_size_max_sampled_tiles_;
+
   /**
    * The array fragment ids whose non-empty domain intersects at
    * least one subarray range.
@@ -598,6 +598,16 @@ Status SubarrayPartitioner::set_memory_budget(
 Status SubarrayPartitioner::split_current(bool* unsplittable) {
   auto timer_se = stats_->start_timer("read_split_current_partition");
 
+  // The read overflowed a partition the estimates deemed fitting, so the
+  // estimates under-predict the actual results. Double the correction
+  // applied to them for the rest of this query so that later partitions
+  // are shrunk upfront rather than after another failed read.
+  constexpr double max_est_correction = 1024.0;
+  if (!skip_split_on_est_size_ && est_correction_ < max_est_correction) {
+    est_correction_ *= 2.0;
+    stats_->add_counter("est_size_corrections", 1);
+  }
+
   *unsplittable = false;
 
   // Current came from splitting a multi-range partition
@@ -786,6 +796,7 @@ SubarrayPartitioner SubarrayPartitioner::clone() const {
   clone.skip_split_on_est_size_ = skip_split_on_est_size_;
   clone.skip_unary_partitioning_budget_check_ =
       skip_unary_partitioning_budget_check_;
+  clone.est_correction_ = est_correction_;
   clone.compute_tp_ = compute_tp_;
 
   return clone;
@@ -845,19 +856,22 @@ Status SubarrayPartitioner::compute_current_start_end(bool* found) {
       mem_size.size_var_ += memory_sizes[r][i].size_var_;
       mem_size.size_validity_ += memory_sizes[r][i].size_validity_;
       if ((!skip_split_on_est_size_ &&
-           (cur_size.size_fixed_ > budget.size_fixed_ ||
-            cur_size.size_var_ > budget.size_var_ ||
-            cur_size.size_validity_ > budget.size_validity_)) ||
+           (cur_size.size_fixed_ * est_correction_ > budget.size_fixed_ ||
+            cur_size.size_var_ * est_correction_ > budget.size_var_ ||
+            cur_size.size_validity_ * est_correction_ >
+                budget.size_validity_)) ||
           mem_size.size_fixed_ > memory_budget_ ||
           mem_size.size_var_ > memory_budget_var_ ||
           mem_size.size_validity_ > memory_budget_validity_) {
-        if (cur_size.size_fixed_ > budget.size_fixed_) {
+        if (cur_size.size_fixed_ * est_correction_ > budget.size_fixed_) {
           stats_->add_counter(
               "compute_current_start_end.fixed_result_size_overflow", 1);
-        } else if (cur_size.size_var_ > budget.size_var_) {
+        } else if (cur_size.size_var_ * est_correction_ > budget.size_var_) {
           stats_->add_counter(
               "compute_current_start_end.var_result_size_overflow", 1);
-        } else if (cur_size.size_validity_ > budget.size_validity_) {
+        } else if (
+            cur_size.size_validity_ * est_correction_ >
+            budget.size_validity_) {
           stats_->add_counter(
               "compute_current_start_end.validity_result_size_overflow", 1);
         } else if (mem_size.size_fixed_ > memory_budget_) {
@@ -1171,9 +1185,9 @@ bool SubarrayPartitioner::must_split(Subarray* partition) {
 
     // Check for budget overflow
     if ((!skip_split_on_est_size_ &&
-         (est_size.fixed_ > b.second.size_fixed_ ||
-          est_size.variable_ > b.second.size_var_ ||
-          est_size.validity_ > b.second.size_validity_)) ||
+         (est_size.fixed_ * est_correction_ > b.second.size_fixed_ ||
+          est_size.variable_ * est_correction_ > b.second.size_var_ ||
+          est_size.validity_ * est_correction_ > b.second.size_validity_)) ||
         mem_size.fixed_ > memory_budget_ ||
         mem_size.variable_ > memory_budget_var_ ||
         mem_size.validity_ > memory_budget_validity_) {
@@ -1265,6 +1279,12 @@ Status SubarrayPartitioner::split_top_single_range(bool* unsplittable) {
   Subarray r1, r2;
   range.split(splitting_dim, splitting_value, &r1, &r2);
 
+  // Refine the parent's tile overlap into the children, so that the
+  // next estimation pass re-tests only the parent's overlapping tiles
+  // instead of recomputing the overlap from scratch.
+  r1.refine_tile_overlap(range);
+  r2.refine_tile_overlap(range);
+
   // Update list
   state_.single_range_.pop_front();
   if (normal_order) {
@@ -1336,6 +1356,7 @@ void SubarrayPartitioner::swap(SubarrayPartitioner& partitioner) {
   std::swap(
       skip_unary_partitioning_budget_check_,
       partitioner.skip_unary_partitioning_budget_check_);
+  std::swap(est_correction_, partitioner.est_correction_);
   std::swap(compute_tp_, partitioner.compute_tp_);
 }
 
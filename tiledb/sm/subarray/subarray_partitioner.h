@@ -393,6 +393,16 @@ class SubarrayPartitioner {
    */
   bool skip_unary_partitioning_budget_check_;
 
+  /**
+   * Multiplicative correction applied to the estimated result sizes when
+   * checking them against the result budgets. It starts at 1.0 and doubles
+   * every time a partition that the estimates deemed fitting overflows at
+   * read time (i.e., upon ``split_current``). Later partitions of the same
+   * query are then pre-shrunk, instead of repeating the overflow-split-retry
+   * cycle on every partition of data the estimates misjudge.
+   */
+  double est_correction_ = 1.0;
+
   /** The thread pool for compute-bound tasks. */
   ThreadPool* compute_tp_;
 
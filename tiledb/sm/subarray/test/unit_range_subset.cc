@@ -676,3 +676,155 @@ TEST_CASE("RangeSetAndSuperset test bad constructor args") {
   Range range{};
   REQUIRE_THROWS(RangeSetAndSuperset(Datatype::ANY, range, false, false));
 }
+
+TEMPLATE_TEST_CASE_SIG(
+    "RangeSetAndSuperset::add_ranges_complement - integer types",
+    "[range_multi_subset][complement]",
+    ((typename T, Datatype D), T, D),
+    (int8_t, Datatype::INT8),
+    (uint8_t, Datatype::UINT8),
+    (int16_t, Datatype::INT16),
+    (uint16_t, Datatype::UINT16),
+    (int32_t, Datatype::INT32),
+    (uint32_t, Datatype::UINT32),
+    (int64_t, Datatype::INT64),
+    (uint64_t, Datatype::UINT64),
+    (int64_t, Datatype::DATETIME_YEAR)) {
+  T bounds[2] = {0, 10};
+  Range domain{bounds, 2 * sizeof(T)};
+  RangeSetAndSuperset range_subset{D, domain, true, false};
+  ThreadPool pool{2};
+
+  SECTION("Exclude a single interior window") {
+    T data[2] = {4, 6};
+    range_subset.add_ranges_complement(&pool, {Range(data, 2 * sizeof(T))});
+    REQUIRE(range_subset.num_ranges() == 2);
+    check_subset_range_values<T>(range_subset, 0, 0, 3);
+    check_subset_range_values<T>(range_subset, 1, 7, 10);
+  }
+
+  SECTION("Exclude unsorted, overlapping windows") {
+    T data1[2] = {7, 9};
+    T data2[2] = {1, 3};
+    T data3[2] = {2, 4};
+    range_subset.add_ranges_complement(
+        &pool,
+        {Range(data1, 2 * sizeof(T)),
+         Range(data2, 2 * sizeof(T)),
+         Range(data3, 2 * sizeof(T))});
+    REQUIRE(range_subset.num_ranges() == 3);
+    check_subset_range_values<T>(range_subset, 0, 0, 0);
+    check_subset_range_values<T>(range_subset, 1, 5, 6);
+    check_subset_range_values<T>(range_subset, 2, 10, 10);
+  }
+
+  SECTION("Exclude windows covering the domain bounds") {
+    T data1[2] = {0, 2};
+    T data2[2] = {8, 10};
+    range_subset.add_ranges_complement(
+        &pool, {Range(data1, 2 * sizeof(T)), Range(data2, 2 * sizeof(T))});
+    REQUIRE(range_subset.num_ranges() == 1);
+    check_subset_range_values<T>(range_subset, 0, 3, 7);
+  }
+
+  SECTION("Exclude the full domain") {
+    T data[2] = {0, 10};
+    range_subset.add_ranges_complement(&pool, {Range(data, 2 * sizeof(T))});
+    REQUIRE(range_subset.is_empty());
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "RangeSetAndSuperset::add_ranges_complement - floating-point types",
+    "[range_multi_subset][complement]",
+    ((typename T, Datatype D), T, D),
+    (float, Datatype::FLOAT32),
+    (double, Datatype::FLOAT64)) {
+  T bounds[2] = {-1.0, 1.0};
+  Range domain{bounds, 2 * sizeof(T)};
+  RangeSetAndSuperset range_subset{D, domain, true, false};
+  ThreadPool pool{2};
+
+  T data[2] = {-0.5, 0.5};
+  range_subset.add_ranges_complement(&pool, {Range(data, 2 * sizeof(T))});
+  REQUIRE(range_subset.num_ranges() == 2);
+  check_subset_range_values<T>(
+      range_subset,
+      0,
+      static_cast<T>(-1.0),
+      std::nextafter(static_cast<T>(-0.5), std::numeric_limits<T>::lowest()));
+  check_subset_range_values<T>(
+      range_subset,
+      1,
+      std::nextafter(static_cast<T>(0.5), std::numeric_limits<T>::max()),
+      static_cast<T>(1.0));
+}
+
+TEST_CASE(
+    "RangeSetAndSuperset::add_ranges_complement - unsupported for strings",
+    "[range_multi_subset][complement]") {
+  RangeSetAndSuperset range_subset{Datatype::STRING_ASCII, Range(), true, true};
+  ThreadPool pool{2};
+  REQUIRE_THROWS(range_subset.add_ranges_complement(&pool, {Range("b", "c")}));
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "RangeSetAndSuperset::add_ranges - integer types",
+    "[range_multi_subset][add_ranges]",
+    ((typename T, Datatype D), T, D),
+    (int8_t, Datatype::INT8),
+    (uint16_t, Datatype::UINT16),
+    (int32_t, Datatype::INT32),
+    (uint64_t, Datatype::UINT64)) {
+  T bounds[2] = {0, 10};
+  Range domain{bounds, 2 * sizeof(T)};
+  RangeSetAndSuperset range_subset{D, domain, true, false};
+  ThreadPool pool{2};
+
+  SECTION("Unsorted, overlapping batch is sorted and merged") {
+    T data1[2] = {7, 9};
+    T data2[2] = {1, 3};
+    T data3[2] = {2, 4};
+    T data4[2] = {4, 5};
+    auto warning = range_subset.add_ranges(
+        &pool,
+        {Range(data1, 2 * sizeof(T)),
+         Range(data2, 2 * sizeof(T)),
+         Range(data3, 2 * sizeof(T)),
+         Range(data4, 2 * sizeof(T))});
+    CHECK(!warning.has_value());
+    REQUIRE(range_subset.num_ranges() == 2);
+    check_subset_range_values<T>(range_subset, 0, 1, 5);
+    check_subset_range_values<T>(range_subset, 1, 7, 9);
+  }
+
+  SECTION("Batch is appended after explicitly added ranges") {
+    T data0[2] = {0, 0};
+    Range first{data0, 2 * sizeof(T)};
+    auto&& [status, warn] = range_subset.add_range(first);
+    REQUIRE(status.ok());
+    T data1[2] = {8, 9};
+    T data2[2] = {5, 6};
+    range_subset.add_ranges(
+        &pool, {Range(data1, 2 * sizeof(T)), Range(data2, 2 * sizeof(T))});
+    REQUIRE(range_subset.num_ranges() == 3);
+    check_subset_range_values<T>(range_subset, 0, 0, 0);
+    check_subset_range_values<T>(range_subset, 1, 5, 6);
+    check_subset_range_values<T>(range_subset, 2, 8, 9);
+  }
+
+  SECTION("Out-of-bounds range is cropped with a warning") {
+    T data[2] = {8, 20};
+    auto warning =
+        range_subset.add_ranges(&pool, {Range(data, 2 * sizeof(T))}, false);
+    REQUIRE(range_subset.num_ranges() == 1);
+    check_subset_range_values<T>(range_subset, 0, 8, 10);
+    CHECK(warning.has_value());
+  }
+
+  SECTION("Out-of-bounds range throws when errors are requested") {
+    T data[2] = {5, 20};
+    REQUIRE_THROWS(
+        range_subset.add_ranges(&pool, {Range(data, 2 * sizeof(T))}, true));
+  }
+}
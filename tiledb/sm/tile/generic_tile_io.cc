@@ -35,6 +35,8 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/unreachable.h"
+#include "tiledb/sm/buffer/buffer_list.h"
+#include "tiledb/sm/crypto/crypto.h"
 #include "tiledb/sm/crypto/encryption_key.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/filter/compression_filter.h"
@@ -89,11 +91,64 @@ shared_ptr<Tile> GenericTileIO::load(
   stdx::unreachable();
 }
 
+/**
+ * Returns a digest of the encryption key, for use in the generic tile
+ * cache key. Decrypted plaintext cached under one key must never be
+ * served to a lookup with a different key: for AES-256-GCM, wrong-key
+ * detection lives in the GCM tag verification performed while
+ * unfiltering, which a cache hit would skip.
+ */
+static std::string encryption_key_digest(const EncryptionKey& encryption_key) {
+  Buffer digest;
+  ConstBuffer key = encryption_key.key();
+  throw_if_not_ok(Crypto::sha256(&key, &digest));
+  std::string result(
+      static_cast<const char*>(digest.data()), Crypto::SHA256_DIGEST_BYTES);
+  result += static_cast<char>(encryption_key.encryption_type());
+  return result;
+}
+
 shared_ptr<Tile> GenericTileIO::read_generic(
     uint64_t file_offset,
     const EncryptionKey& encryption_key,
     const Config& config,
     shared_ptr<MemoryTracker> memory_tracker) {
+  // Serve the unfiltered tile from the generic tile cache, if possible.
+  // Generic tile files are written once under unique names, so the URI and
+  // offset always address the same bytes. The encryption key digest is part
+  // of the cache key, so a wrong-key read misses the cache and fails
+  // authentication on the regular read path below.
+  auto& cache = resources_.generic_tile_cache();
+  std::string key_digest;
+  if (cache.enabled()) {
+    key_digest = encryption_key_digest(encryption_key);
+    auto entry = cache.lookup(uri_, file_offset, key_digest);
+    if (entry.data_ != nullptr) {
+      // Same validation as performed against the header on the read path.
+      if (encryption_key.encryption_type() !=
+          (EncryptionType)entry.encryption_type_) {
+        throw GenericTileIOException(
+            "Error reading generic tile; tile is encrypted with " +
+            encryption_type_str((EncryptionType)entry.encryption_type_) +
+            " but given key is for " +
+            encryption_type_str(encryption_key.encryption_type()));
+      }
+
+      shared_ptr<Tile> tile = make_shared<Tile>(
+          HERE(),
+          entry.version_,
+          (Datatype)entry.datatype_,
+          entry.cell_size_,
+          0,
+          entry.size_,
+          nullptr,
+          0,
+          memory_tracker->get_resource(MemoryType::GENERIC_TILE_IO));
+      tile->use_cached_data(entry.data_);
+      return tile;
+    }
+  }
+
   auto&& header = read_generic_tile_header(resources_, uri_, file_offset);
 
   if (encryption_key.encryption_type() !=
@@ -131,9 +186,25 @@ shared_ptr<Tile> GenericTileIO::read_generic(
 
   // Unfilter
   assert(tile->filtered());
-  header.filters.run_reverse_generic_tile(&resources_.stats(), *tile, config);
+  header.filters.run_reverse_generic_tile(
+      &resources_.stats(), *tile, &resources_.compute_tp(), config);
   assert(!tile->filtered());
 
+  // Cache the unfiltered tile so that subsequent opens skip the reads and
+  // the filter pipeline.
+  if (cache.enabled()) {
+    cache.insert(
+        uri_,
+        file_offset,
+        key_digest,
+        tile->data(),
+        tile->size(),
+        header.version_number,
+        header.datatype,
+        header.cell_size,
+        header.encryption_type);
+  }
+
   return tile;
 }
 
@@ -182,10 +253,26 @@ void GenericTileIO::store_data(
     const EncryptionKey& encryption_key) {
   GenericTileIO tile_io(resources, uri);
   uint64_t nbytes = 0;
-  tile_io.write_generic(tile, encryption_key, &nbytes);
+  BufferList buffer_list;
+  tile_io.write_generic(tile, encryption_key, &nbytes, buffer_list);
+  flush_buffer_list(resources, uri, buffer_list);
   throw_if_not_ok(resources.vfs().close_file(uri));
 }
 
+void GenericTileIO::flush_buffer_list(
+    ContextResources& resources, const URI& uri, BufferList& buffer_list) {
+  if (buffer_list.total_size() == 0) {
+    return;
+  }
+
+  // Coalesce the buffered tiles into one contiguous region so that they are
+  // written with a single VFS write.
+  std::vector<uint8_t> data(buffer_list.total_size());
+  buffer_list.reset_offset();
+  throw_if_not_ok(buffer_list.read(data.data(), data.size()));
+  throw_if_not_ok(resources.vfs().write(uri, data.data(), data.size()));
+}
+
 void GenericTileIO::write_generic(
     shared_ptr<WriterTile> tile,
     const EncryptionKey& encryption_key,
@@ -210,6 +297,37 @@ void GenericTileIO::write_generic(
             header.filter_pipeline_size + header.persisted_size;
 }
 
+void GenericTileIO::write_generic(
+    shared_ptr<WriterTile> tile,
+    const EncryptionKey& encryption_key,
+    uint64_t* nbytes,
+    BufferList& buffer_list) {
+  // Create a header
+  GenericTileHeader header;
+  init_generic_tile_header(tile.get(), &header, encryption_key);
+
+  // Filter tile
+  assert(!tile->filtered());
+  header.filters.run_forward(
+      &resources_.stats(), tile.get(), nullptr, &resources_.compute_tp());
+  header.persisted_size = tile->filtered_buffer().size();
+  assert(tile->filtered());
+
+  write_generic_tile_header(&header, buffer_list);
+
+  // Buffer the filtered tile contents. The tile may be released before the
+  // buffer list is flushed, so the contents are copied. The final size is
+  // known up front, so reserve it in one allocation.
+  Buffer filtered_data;
+  throw_if_not_ok(filtered_data.reserve(tile->filtered_buffer().size()));
+  throw_if_not_ok(filtered_data.write(
+      tile->filtered_buffer().data(), tile->filtered_buffer().size()));
+  throw_if_not_ok(buffer_list.add_buffer(std::move(filtered_data)));
+
+  *nbytes = GenericTileIO::GenericTileHeader::BASE_SIZE +
+            header.filter_pipeline_size + header.persisted_size;
+}
+
 template <class T>
 void GenericTileIO::serialize_generic_tile_header(
     T& serializer, GenericTileHeader& header) {
@@ -239,6 +357,25 @@ void GenericTileIO::write_generic_tile_header(GenericTileHeader* header) {
   throw_if_not_ok(resources_.vfs().write(uri_, data.data(), data.size()));
 }
 
+void GenericTileIO::write_generic_tile_header(
+    GenericTileHeader* header, BufferList& buffer_list) {
+  SizeComputationSerializer fp_size_computation_serializer;
+  header->filters.serialize(fp_size_computation_serializer);
+  header->filter_pipeline_size = fp_size_computation_serializer.size();
+
+  SizeComputationSerializer size_computation_serializer;
+  serialize_generic_tile_header(size_computation_serializer, *header);
+
+  std::vector<uint8_t> data(size_computation_serializer.size());
+  Serializer serializer(data.data(), data.size());
+  serialize_generic_tile_header(serializer, *header);
+
+  // Append the serialized header to the buffer list.
+  Buffer header_buff;
+  throw_if_not_ok(header_buff.write(data.data(), data.size()));
+  throw_if_not_ok(buffer_list.add_buffer(std::move(header_buff)));
+}
+
 void GenericTileIO::configure_encryption_filter(
     GenericTileHeader* header, const EncryptionKey& encryption_key) const {
   switch ((EncryptionType)header->encryption_type) {
@@ -45,6 +45,7 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+class BufferList;
 class Tile;
 
 /** Handles IO (reading/writing) for tiles. */
@@ -175,6 +176,19 @@ class GenericTileIO {
       shared_ptr<WriterTile> tile,
       const EncryptionKey& encryption_key);
 
+  /**
+   * Writes a list of buffered generic tiles to a file with a single VFS
+   * write. This is a no-op if the buffer list is empty, and the buffers are
+   * not released. The file is not closed, so the caller may continue
+   * appending to it.
+   *
+   * @param resources The ContextResources instance to use for writing.
+   * @param uri The URI of the file to append to.
+   * @param buffer_list The buffered generic tiles to write.
+   */
+  static void flush_buffer_list(
+      ContextResources& resources, const URI& uri, BufferList& buffer_list);
+
   /**
    * Writes a tile generically to the file. This means that a header will be
    * prepended to the file before writing the tile contents. The reason is
@@ -190,6 +204,24 @@ class GenericTileIO {
       const EncryptionKey& encryption_key,
       uint64_t* nbytes);
 
+  /**
+   * Batched variant of `write_generic`. The serialized header and the
+   * filtered tile contents are appended to the given buffer list instead of
+   * being written to the file, so that many small generic tiles destined for
+   * the same file can be coalesced into a single VFS write with
+   * `flush_buffer_list`.
+   *
+   * @param tile The tile to be written.
+   * @param encryption_key The encryption key to use.
+   * @param nbytes The total number of bytes the tile occupies in the file.
+   * @param buffer_list The buffer list to append the serialized tile to.
+   */
+  void write_generic(
+      shared_ptr<WriterTile> tile,
+      const EncryptionKey& encryption_key,
+      uint64_t* nbytes,
+      BufferList& buffer_list);
+
   /**
    * Serialize a generic tile header.
    *
@@ -206,6 +238,15 @@ class GenericTileIO {
    */
   void write_generic_tile_header(GenericTileHeader* header);
 
+  /**
+   * Appends the serialized generic tile header to the given buffer list.
+   *
+   * @param header The header to serialize
+   * @param buffer_list The buffer list to append the header to
+   */
+  void write_generic_tile_header(
+      GenericTileHeader* header, BufferList& buffer_list);
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
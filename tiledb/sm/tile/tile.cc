@@ -85,10 +85,25 @@ shared_ptr<WriterTile> WriterTile::from_generic(
 
 uint32_t WriterTile::compute_chunk_size(
     const uint64_t tile_size, const uint64_t tile_cell_size) {
+  return compute_chunk_size(tile_size, tile_cell_size, max_tile_chunk_size_);
+}
+
+uint32_t WriterTile::compute_chunk_size(
+    const uint64_t tile_size,
+    const uint64_t tile_cell_size,
+    const uint64_t max_chunk_size) {
   const uint64_t dim_tile_size = tile_size;
   const uint64_t dim_cell_size = tile_cell_size;
 
-  uint64_t chunk_size64 = std::min(max_tile_chunk_size_, dim_tile_size);
+  // The whitebox test override of the static maximum takes precedence over
+  // the requested maximum, so that tests exercising specific chunk layouts
+  // keep controlling the chunking regardless of the pipeline settings.
+  const uint64_t max_size =
+      max_tile_chunk_size_ != constants::max_tile_chunk_size ?
+          max_tile_chunk_size_ :
+          max_chunk_size;
+
+  uint64_t chunk_size64 = std::min(max_size, dim_tile_size);
   chunk_size64 = chunk_size64 / dim_cell_size * dim_cell_size;
   chunk_size64 = std::max(chunk_size64, dim_cell_size);
   if (chunk_size64 > std::numeric_limits<uint32_t>::max()) {
@@ -110,6 +125,7 @@ TileBase::TileBase(
     tdb::pmr::memory_resource* resource)
     : resource_(resource)
     , data_(tdb::pmr::make_unique<std::byte>(resource_, size))
+    , data_alias_(nullptr)
     , size_(size)
     , cell_size_(cell_size)
     , format_version_(format_version)
@@ -132,7 +148,8 @@ Tile::Tile(
     const uint64_t size,
     void* filtered_data,
     uint64_t filtered_size,
-    shared_ptr<MemoryTracker> memory_tracker)
+    shared_ptr<MemoryTracker> memory_tracker,
+    std::shared_ptr<std::byte> filtered_data_owner)
     : Tile(
           format_version,
           type,
@@ -141,7 +158,8 @@ Tile::Tile(
           size,
           filtered_data,
           filtered_size,
-          memory_tracker->get_resource(MemoryType::TILE_DATA)) {
+          memory_tracker->get_resource(MemoryType::TILE_DATA),
+          std::move(filtered_data_owner)) {
 }
 
 Tile::Tile(
@@ -152,11 +170,14 @@ Tile::Tile(
     const uint64_t size,
     void* filtered_data,
     uint64_t filtered_size,
-    tdb::pmr::memory_resource* resource)
+    tdb::pmr::memory_resource* resource,
+    std::shared_ptr<std::byte> filtered_data_owner)
     : TileBase(format_version, type, cell_size, size, resource)
     , zipped_coords_dim_num_(zipped_coords_dim_num)
     , filtered_data_(filtered_data)
-    , filtered_size_(filtered_size) {
+    , filtered_size_(filtered_size)
+    , streamed_(false)
+    , filtered_data_owner_(std::move(filtered_data_owner)) {
 }
 
 WriterTile::WriterTile(
@@ -193,13 +214,16 @@ void TileBase::read(
   if (nbytes > size_ - offset) {
     throw TileException("Read tile overflow; may not read beyond buffer size");
   }
-  std::memcpy(buffer, data_.get() + offset, nbytes);
+  std::memcpy(buffer, static_cast<std::byte*>(data()) + offset, nbytes);
 }
 
 void TileBase::write(const void* data, uint64_t offset, uint64_t nbytes) {
   if (nbytes > size_ - offset) {
     throw TileException("Write tile overflow; would write out of bounds");
   }
+  if (data_alias_ != nullptr) {
+    throw TileException("Cannot write to a tile aliasing external memory");
+  }
 
   std::memcpy(data_.get() + offset, data, nbytes);
   size_ = std::max(offset + nbytes, size_);
@@ -248,6 +272,7 @@ uint64_t Tile::load_offsets_chunk_data(ChunkData& chunk_data) {
 
 void WriterTile::clear_data() {
   data_ = nullptr;
+  data_alias_ = nullptr;
   size_ = 0;
 }
 
@@ -39,6 +39,7 @@
 #include "tiledb/sm/tile/filtered_buffer.h"
 #include "tiledb/storage_format/serialization/serializers.h"
 
+#include <cassert>
 #include <cinttypes>
 
 using namespace tiledb::common;
@@ -100,7 +101,12 @@ class TileBase {
 
   /** Returns the internal buffer. */
   inline void* data() const {
-    return data_.get();
+    return data_alias_ != nullptr ? data_alias_ : data_.get();
+  }
+
+  /** Returns `true` if the tile data aliases externally owned memory. */
+  inline bool has_data_alias() const {
+    return data_alias_ != nullptr;
   }
 
   /**
@@ -112,7 +118,7 @@ class TileBase {
 
   /** Returns the tile size. */
   inline uint64_t size() const {
-    return (data_ == nullptr) ? 0 : size_;
+    return (data_ == nullptr && data_alias_ == nullptr) ? 0 : size_;
   }
 
   /** Returns the cell size. */
@@ -139,6 +145,22 @@ class TileBase {
   }
 
  protected:
+  /* ********************************* */
+  /*        PROTECTED METHODS          */
+  /* ********************************* */
+
+  /**
+   * Swaps the tile's own allocation for a view on externally owned memory
+   * and releases the tile's own buffer. The caller is responsible for
+   * keeping the aliased memory alive for the lifetime of the tile.
+   *
+   * @param alias Externally owned buffer holding the tile data.
+   */
+  inline void set_data_alias(std::byte* alias) {
+    data_alias_ = alias;
+    data_.reset();
+  }
+
   /* ********************************* */
   /*       PROTECTED ATTRIBUTES        */
   /* ********************************* */
@@ -149,6 +171,12 @@ class TileBase {
   /** The buffer backing the tile data. */
   tdb::pmr::unique_ptr<std::byte> data_;
 
+  /**
+   * View on externally owned memory backing the tile data instead of
+   * `data_` (zero-copy read path), or `nullptr` if the tile owns its data.
+   */
+  std::byte* data_alias_;
+
   /** Size of the data. */
   uint64_t size_;
 
@@ -191,6 +219,8 @@ class Tile : public TileBase {
    * @param size The size of the tile.
    * @param filtered_data Pointer to the external filtered data.
    * @param filtered_size The filtered size to allocate.
+   * @param filtered_data_owner Optional shared ownership of the buffer
+   *    backing `filtered_data`, enabling the zero-copy read path.
    */
   Tile(
       const format_version_t format_version,
@@ -200,7 +230,8 @@ class Tile : public TileBase {
       const uint64_t size,
       void* filtered_data,
       uint64_t filtered_size,
-      shared_ptr<MemoryTracker> memory_tracker);
+      shared_ptr<MemoryTracker> memory_tracker,
+      std::shared_ptr<std::byte> filtered_data_owner = {});
 
   /**
    * Constructor.
@@ -214,6 +245,8 @@ class Tile : public TileBase {
    * @param filtered_data Pointer to the external filtered data.
    * @param filtered_size The filtered size to allocate.
    * @param resource The memory resource to use.
+   * @param filtered_data_owner Optional shared ownership of the buffer
+   *    backing `filtered_data`, enabling the zero-copy read path.
    */
   Tile(
       const format_version_t format_version,
@@ -223,7 +256,8 @@ class Tile : public TileBase {
       const uint64_t size,
       void* filtered_data,
       uint64_t filtered_size,
-      tdb::pmr::memory_resource* resource);
+      tdb::pmr::memory_resource* resource,
+      std::shared_ptr<std::byte> filtered_data_owner = {});
 
   DISABLE_MOVE_AND_MOVE_ASSIGN(Tile);
   DISABLE_COPY_AND_COPY_ASSIGN(Tile);
@@ -266,6 +300,65 @@ class Tile : public TileBase {
   void clear_filtered_buffer() {
     filtered_data_ = nullptr;
     filtered_size_ = 0;
+
+    // Keep the filtered data alive when the tile data aliases into it
+    // (zero-copy read path).
+    if (data_alias_ == nullptr) {
+      filtered_data_owner_.reset();
+    }
+  }
+
+  /** @return `true` if the filtered data is backed by a shared owner. */
+  inline bool has_filtered_data_owner() const {
+    return filtered_data_owner_ != nullptr;
+  }
+
+  /**
+   * Serves the tile data directly from the filtered buffer instead of
+   * copying it out (zero-copy read path). Only valid when the filtered data
+   * is backed by the shared owner passed at construction, which is kept
+   * alive for the lifetime of the tile. Releases the tile's own allocation.
+   *
+   * @param data Start of the unfiltered cell data inside the filtered
+   *    buffer.
+   */
+  inline void use_filtered_data_view(void* data) {
+    assert(filtered_data_owner_ != nullptr);
+    set_data_alias(static_cast<std::byte*>(data));
+  }
+
+  /**
+   * Serves the tile data from an externally owned buffer holding the
+   * already unfiltered, post-processed tile payload (tile cache hit). The
+   * buffer is kept alive for the lifetime of the tile and the filtered
+   * buffer is cleared so that unfiltering skips the tile. Releases the
+   * tile's own allocation.
+   *
+   * @param data Shared ownership of the unfiltered tile data.
+   */
+  inline void use_cached_data(std::shared_ptr<std::byte> data) {
+    filtered_data_ = nullptr;
+    filtered_size_ = 0;
+    filtered_data_owner_ = std::move(data);
+    set_data_alias(filtered_data_owner_.get());
+  }
+
+  /**
+   * Marks the tile as loaded by targeted range reads of its data region
+   * (streamed partial read) instead of through the filter pipeline. The
+   * filtered buffer is cleared so that unfiltering skips the tile; the
+   * reader reads the byte ranges of the selected cells directly into the
+   * tile data.
+   */
+  inline void set_streamed() {
+    filtered_data_ = nullptr;
+    filtered_size_ = 0;
+    streamed_ = true;
+  }
+
+  /** @return `true` if the tile is loaded by targeted range reads. */
+  inline bool streamed() const {
+    return streamed_;
   }
 
   /**
@@ -353,6 +446,19 @@ class Tile : public TileBase {
 
   /** The size of the filtered data. */
   uint64_t filtered_size_;
+
+  /**
+   * `true` if the tile data is filled by targeted range reads of the
+   * selected cells instead of through the filter pipeline.
+   */
+  bool streamed_;
+
+  /**
+   * Optional shared ownership of the buffer backing `filtered_data_`. Kept
+   * alive past `clear_filtered_buffer` when the tile data aliases into the
+   * filtered buffer (zero-copy read path).
+   */
+  std::shared_ptr<std::byte> filtered_data_owner_;
 };
 
 /**
@@ -376,7 +482,8 @@ class WriterTile : public TileBase {
       storage_size_t tile_size, shared_ptr<MemoryTracker> memory_tracker);
 
   /**
-   * Computes the chunk size for a tile.
+   * Computes the chunk size for a tile, using the default maximum chunk
+   * size.
    *
    * @param tile_size The total size of the tile.
    * @param tile_cell_size The cell size.
@@ -385,6 +492,20 @@ class WriterTile : public TileBase {
   static uint32_t compute_chunk_size(
       const uint64_t tile_size, const uint64_t tile_cell_size);
 
+  /**
+   * Computes the chunk size for a tile with a custom maximum chunk size.
+   *
+   * @param tile_size The total size of the tile.
+   * @param tile_cell_size The cell size.
+   * @param max_chunk_size The maximum chunk size, typically coming from the
+   *     filter pipeline the tile will be filtered with.
+   * @return Chunk size.
+   */
+  static uint32_t compute_chunk_size(
+      const uint64_t tile_size,
+      const uint64_t tile_cell_size,
+      const uint64_t max_chunk_size);
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -436,6 +557,18 @@ class WriterTile : public TileBase {
   /** Clears the internal buffer. */
   void clear_data();
 
+  /**
+   * Backs the tile with externally owned memory instead of its own
+   * allocation (zero-copy write path). The caller must keep the memory
+   * alive and unmodified until the tile has been filtered. The view is
+   * released by `clear_data`.
+   *
+   * @param alias Externally owned buffer holding the tile data.
+   */
+  inline void alias_data(std::byte* alias) {
+    set_data_alias(alias);
+  }
+
   /**
    * Returns the current filtered state of the tile data in the buffer. When
    * `true`, the buffer contains the filtered, on-disk format of the tile.
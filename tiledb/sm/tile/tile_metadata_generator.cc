@@ -393,11 +393,22 @@ void TileMetadataGenerator::min_max(
     max_ = static_cast<const void*>(&metadata_generator_type_data<T>::max);
   }
 
-  // Process cell by cell.
+  // Process the range as value reductions that the compiler can vectorize.
+  // The selects preserve the comparison semantics of the previous pointer
+  // based loop.
+  T min_v = *static_cast<const T*>(min_);
+  T max_v = *static_cast<const T*>(max_);
   for (uint64_t c = start; c < end; c++) {
-    min_ = *static_cast<const T*>(min_) < values[c] ? min_ : &values[c];
-    max_ = *static_cast<const T*>(max_) > values[c] ? max_ : &values[c];
+    min_v = min_v < values[c] ? min_v : values[c];
+    max_v = max_v > values[c] ? max_v : values[c];
   }
+
+  min_data_.resize(sizeof(T));
+  max_data_.resize(sizeof(T));
+  *reinterpret_cast<T*>(min_data_.data()) = min_v;
+  *reinterpret_cast<T*>(max_data_.data()) = max_v;
+  min_ = min_data_.data();
+  max_ = max_data_.data();
 }
 
 template <>
@@ -445,15 +456,24 @@ void TileMetadataGenerator::min_max_nullable(
     max_ = (void*)&metadata_generator_type_data<T>::max;
   }
 
-  // Process cell by cell.
+  // Process the range as value reductions that the compiler can vectorize.
+  // The selects preserve the comparison semantics of the previous pointer
+  // based loop.
+  T min_v = *static_cast<const T*>(min_);
+  T max_v = *static_cast<const T*>(max_);
   for (uint64_t c = start; c < end; c++) {
     const bool is_null = validity_values[c] == 0;
-    min_ = (is_null || (*static_cast<const T*>(min_) < values[c])) ? min_ :
-                                                                     &values[c];
-    max_ = (is_null || (*static_cast<const T*>(max_) > values[c])) ? max_ :
-                                                                     &values[c];
+    min_v = (is_null || (min_v < values[c])) ? min_v : values[c];
+    max_v = (is_null || (max_v > values[c])) ? max_v : values[c];
     null_count_ += is_null;
   }
+
+  min_data_.resize(sizeof(T));
+  max_data_.resize(sizeof(T));
+  *reinterpret_cast<T*>(min_data_.data()) = min_v;
+  *reinterpret_cast<T*>(max_data_.data()) = max_v;
+  min_ = min_data_.data();
+  max_ = max_data_.data();
 }
 
 template <>
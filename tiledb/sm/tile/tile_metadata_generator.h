@@ -257,6 +257,13 @@ class TileMetadataGenerator {
   /** Maximum value size for this tile. */
   uint64_t max_size_;
 
+  /**
+   * Storage for the min/max computed by the fixed size value reductions;
+   * `min_`/`max_` point into it.
+   */
+  ByteVec min_data_;
+  ByteVec max_data_;
+
   /** Sum of values. */
   ByteVec sum_;
 
@@ -40,6 +40,7 @@
 #include "tiledb/sm/enums/datatype.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <sstream>
@@ -58,12 +59,141 @@ namespace tiledb::type {
  * between fixed and variable size types.
  */
 class Range {
+  /**
+   * Storage for the flattened range bytes with a small-buffer optimization.
+   *
+   * Ranges over fixed-size dimension types occupy at most 16 bytes (two
+   * 8-byte limits), so they live in the inline buffer and never touch the
+   * heap. Longer (variable-size) ranges spill over to an allocator-backed
+   * vector. Query planning creates large numbers of transient fixed-size
+   * ranges (MBR copies, subarray splits), which made range storage a top
+   * allocation site before the inline buffer.
+   */
+  class RangeBuffer {
+   public:
+    using vector_type = tdb::pmr::vector<uint8_t>;
+    using allocator_type = vector_type::allocator_type;
+
+    /** Inline capacity; two limits of the largest fixed-size datatype. */
+    static constexpr size_t inline_capacity = 16;
+
+    /** Constructs an empty buffer. */
+    explicit RangeBuffer(const allocator_type& alloc)
+        : heap_(alloc) {
+    }
+
+    /** Constructs a zero-initialized buffer of the given size. */
+    RangeBuffer(size_t size, const allocator_type& alloc)
+        : heap_(alloc)
+        , size_(size) {
+      if (size_ > inline_capacity) {
+        heap_.resize(size_);
+      }
+    }
+
+    /** Copy constructor. */
+    RangeBuffer(const RangeBuffer&) = default;
+
+    /** Move constructor. The moved-from buffer is left empty. */
+    RangeBuffer(RangeBuffer&& other) noexcept
+        : inline_(other.inline_)
+        , heap_(std::move(other.heap_))
+        , size_(other.size_) {
+      other.size_ = 0;
+    }
+
+    /** Copy-assign operator. */
+    RangeBuffer& operator=(const RangeBuffer&) = default;
+
+    /** Move-assign operator. The moved-from buffer is left empty. */
+    RangeBuffer& operator=(RangeBuffer&& other) noexcept {
+      inline_ = other.inline_;
+      heap_ = std::move(other.heap_);
+      size_ = other.size_;
+      other.size_ = 0;
+      return *this;
+    }
+
+    /** Returns a pointer to the buffer bytes. */
+    uint8_t* data() {
+      return size_ <= inline_capacity ? inline_.data() : heap_.data();
+    }
+
+    /** Returns a const pointer to the buffer bytes. */
+    const uint8_t* data() const {
+      return size_ <= inline_capacity ? inline_.data() : heap_.data();
+    }
+
+    /** Accesses the byte at the given position. */
+    uint8_t& operator[](size_t pos) {
+      return data()[pos];
+    }
+
+    /** Accesses the byte at the given position. */
+    const uint8_t& operator[](size_t pos) const {
+      return data()[pos];
+    }
+
+    /** Returns the buffer size in bytes. */
+    size_t size() const {
+      return size_;
+    }
+
+    /** Returns true if the buffer is empty. */
+    bool empty() const {
+      return size_ == 0;
+    }
+
+    /** Clears the buffer. */
+    void clear() {
+      heap_.clear();
+      size_ = 0;
+    }
+
+    /**
+     * Resizes the buffer, preserving existing bytes and zero-initializing
+     * any new ones, moving the bytes between the inline buffer and the heap
+     * as needed.
+     */
+    void resize(size_t size) {
+      if (size > inline_capacity) {
+        if (size_ <= inline_capacity) {
+          heap_.assign(inline_.begin(), inline_.begin() + size_);
+        }
+        heap_.resize(size);
+      } else if (size_ > inline_capacity) {
+        std::memcpy(inline_.data(), heap_.data(), size);
+        heap_.clear();
+      } else if (size > size_) {
+        std::memset(inline_.data() + size_, 0, size - size_);
+      }
+      size_ = size;
+    }
+
+    /** Equality operator; compares sizes and bytes. */
+    bool operator==(const RangeBuffer& b) const {
+      return size_ == b.size_ &&
+             (size_ == 0 || std::memcmp(data(), b.data(), size_) == 0);
+    }
+
+   private:
+    /** Inline bytes, used while the size fits in `inline_capacity`. */
+    std::array<uint8_t, inline_capacity> inline_{};
+
+    /** Heap spill-over, used only when the inline bytes are exceeded. */
+    vector_type heap_;
+
+    /** The current buffer size in bytes. */
+    size_t size_{0};
+  };
+
   /**
    * The range is stored as a sequence of bytes with manual memory layout. The
    * memory layout is different for fixed-size and variable-size types.
    *
    * All constructors accept an optional allocator argument, whose default value
-   * is an allocator using std::pmr::get_default_resource.
+   * is an allocator using std::pmr::get_default_resource. The allocator only
+   * comes into play when the range outgrows the inline buffer.
    *
    * Fixed-size type T:
    *   lower limit: sizeof(T)
@@ -72,10 +202,10 @@ class Range {
    *   lower limit: range_start_size_
    *   upper limit: range_size() - range_start_size_
    */
-  tdb::pmr::vector<uint8_t> range_;
+  RangeBuffer range_;
 
   /**
-   * Alias to the allocator type used by the range vector.
+   * Alias to the allocator type used by the range storage.
    */
   using allocator_type = decltype(range_)::allocator_type;
 
@@ -0,0 +1,160 @@
+/**
+ * @file tiledb/type/range/range_operations.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines typed, inline set operations on `Range`. A `Range` stores
+ * a closed interval `[low, high]` as untyped bytes; these functions view the
+ * bytes as a caller-supplied type and implement intersection, union and
+ * comparison with the semantics of the interval library
+ * (tiledb/common/interval). In particular, adjacency comes from
+ * `TypeTraits<T>`: two integral ranges `[a,b]` and `[b+1,c]` are adjacent and
+ * their union is an interval, while floating-point ranges are never adjacent.
+ *
+ * These operations are on the range-planning hot path (subarray range
+ * coalescing and R-tree overlap), so they are deliberately allocation-free
+ * and resolve the type at compile time; callers dispatch on the dimension
+ * datatype once, not per range pair.
+ */
+
+#ifndef TILEDB_RANGE_OPERATIONS_H
+#define TILEDB_RANGE_OPERATIONS_H
+
+#include "tiledb/common/interval/interval.h"
+#include "tiledb/type/range/range.h"
+
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+
+namespace tiledb::type {
+
+/**
+ * Adjacency and ordering semantics for the element type, shared with
+ * `Interval<T>`.
+ */
+template <typename T>
+using interval_traits = tiledb::common::detail::TypeTraits<T>;
+
+/**
+ * Returns ``true`` if two 1D ranges have a non-empty intersection.
+ *
+ * Both ranges must be non-empty and valid ranges of type T.
+ */
+template <
+    typename T,
+    typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+inline bool intersects(const Range& r1, const Range& r2) {
+  auto d1 = (const T*)r1.data();
+  auto d2 = (const T*)r2.data();
+  return !(d1[1] < d2[0] || d2[1] < d1[0]);
+}
+
+/**
+ * Returns ``true`` if two 1D string ranges have a non-empty intersection.
+ *
+ * Both ranges must be non-empty and valid var-sized ranges.
+ */
+template <
+    typename T,
+    typename std::enable_if<std::is_same<T, std::string_view>::value>::type* =
+        nullptr>
+inline bool intersects(const Range& r1, const Range& r2) {
+  return !(r1.end_str() < r2.start_str() || r2.end_str() < r1.start_str());
+}
+
+/**
+ * Three-way comparison of two 1D ranges, following the convention of
+ * `Interval<T>::compare`.
+ *
+ * The first return value is -1 if `r1` is disjoint from and less than `r2`,
+ * +1 if `r1` is disjoint from and greater than `r2`, and 0 if the ranges
+ * intersect. The second return value is the predicate that the ranges are
+ * adjacent: disjoint, but with no element of T between them, so that their
+ * union is still an interval. Intersecting ranges are never adjacent.
+ *
+ * Both ranges must be non-empty and valid ranges of type T.
+ */
+template <
+    typename T,
+    typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+inline std::tuple<int, bool> range_compare(const Range& r1, const Range& r2) {
+  auto d1 = (const T*)r1.data();
+  auto d2 = (const T*)r2.data();
+  if (d1[1] < d2[0]) {
+    return {-1, interval_traits<T>::adjacent(d1[1], d2[0])};
+  }
+  if (d2[1] < d1[0]) {
+    return {+1, interval_traits<T>::adjacent(d2[1], d1[0])};
+  }
+  return {0, false};
+}
+
+/**
+ * Replaces `r2` with the intersection of the two ranges, in place.
+ *
+ * Both ranges must be non-empty, valid ranges of type T that intersect, as
+ * checked by ``intersects``.
+ */
+template <
+    typename T,
+    typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+inline void intersection(const Range& r1, Range& r2) {
+  auto d1 = (const T*)r1.data();
+  auto d2 = (T*)r2.data();
+  d2[0] = std::max(d1[0], d2[0]);
+  d2[1] = std::min(d1[1], d2[1]);
+}
+
+/**
+ * Replaces `r1` with the union of the two ranges, in place, if that union is
+ * an interval.
+ *
+ * The union of two closed intervals is an interval exactly when they
+ * intersect or are adjacent. Returns ``true`` and updates `r1` in that case;
+ * returns ``false`` and leaves `r1` unchanged otherwise.
+ *
+ * Both ranges must be non-empty and valid ranges of type T.
+ */
+template <
+    typename T,
+    typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+inline bool range_union(Range& r1, const Range& r2) {
+  auto [order, adjacent] = range_compare<T>(r1, r2);
+  if (order != 0 && !adjacent) {
+    return false;
+  }
+  auto d1 = (T*)r1.data();
+  auto d2 = (const T*)r2.data();
+  d1[0] = std::min(d1[0], d2[0]);
+  d1[1] = std::max(d1[1], d2[1]);
+  return true;
+}
+
+}  // namespace tiledb::type
+
+#endif
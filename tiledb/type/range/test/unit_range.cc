@@ -69,3 +69,34 @@ TEST_CASE(
   REQUIRE(range.start_str() == start);
   REQUIRE(range.end_str() == end);
 }
+
+TEST_CASE("Test range storage beyond the inline buffer", "[range]") {
+  // Longer than the 16 inline bytes, so the storage spills to the heap.
+  std::string start{"aaaaaaaaaaaa"};
+  std::string end{"zzzzzzzzzzzz"};
+  Range range{start, end};
+  REQUIRE(range.size() == start.size() + end.size());
+  REQUIRE(range.start_str() == start);
+  REQUIRE(range.end_str() == end);
+
+  SECTION("copy preserves the bytes") {
+    Range copy{range};
+    REQUIRE(copy == range);
+    REQUIRE(copy.start_str() == start);
+    REQUIRE(copy.end_str() == end);
+  }
+
+  SECTION("move preserves the bytes and empties the source") {
+    Range moved{std::move(range)};
+    REQUIRE(moved.start_str() == start);
+    REQUIRE(moved.end_str() == end);
+    REQUIRE(range.empty());
+  }
+
+  SECTION("shrinking back moves the bytes inline") {
+    range.set_str_range("b", "d");
+    REQUIRE(range.size() == 2);
+    REQUIRE(range.start_str() == "b");
+    REQUIRE(range.end_str() == "d");
+  }
+}
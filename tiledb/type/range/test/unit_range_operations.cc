@@ -0,0 +1,236 @@
+/**
+ * @file unit_range_operations.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file tests the typed range set operations.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/type/range/range_operations.h"
+
+using namespace tiledb::common;
+using namespace tiledb::type;
+
+namespace {
+
+template <typename T>
+Range make_range(T start, T end) {
+  return Range{&start, &end, sizeof(T)};
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE(
+    "Test intersects",
+    "[range-operations]",
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+    float,
+    double) {
+  Range range = make_range<TestType>(10, 20);
+  SECTION("Disjoint ranges do not intersect") {
+    CHECK(!intersects<TestType>(range, make_range<TestType>(0, 5)));
+    CHECK(!intersects<TestType>(range, make_range<TestType>(21, 30)));
+  }
+  SECTION("Ranges sharing an endpoint intersect") {
+    CHECK(intersects<TestType>(range, make_range<TestType>(0, 10)));
+    CHECK(intersects<TestType>(range, make_range<TestType>(20, 30)));
+  }
+  SECTION("Nested ranges intersect") {
+    CHECK(intersects<TestType>(range, make_range<TestType>(12, 15)));
+    CHECK(intersects<TestType>(range, make_range<TestType>(0, 30)));
+  }
+}
+
+TEST_CASE("Test intersects on string ranges", "[range-operations]") {
+  Range range{std::string("cat"), std::string("dog")};
+  CHECK(!intersects<std::string_view>(range, Range("ant", "bee")));
+  CHECK(!intersects<std::string_view>(range, Range("eel", "fox")));
+  CHECK(intersects<std::string_view>(range, Range("bee", "cow")));
+  CHECK(intersects<std::string_view>(range, Range("dog", "eel")));
+  CHECK(intersects<std::string_view>(range, Range("cow", "cub")));
+}
+
+TEMPLATE_TEST_CASE(
+    "Test range_compare ordering",
+    "[range-operations]",
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+    float,
+    double) {
+  Range range = make_range<TestType>(10, 20);
+  SECTION("Intersecting ranges compare equal and are not adjacent") {
+    auto [order, adjacent] =
+        range_compare<TestType>(range, make_range<TestType>(15, 30));
+    CHECK(order == 0);
+    CHECK(!adjacent);
+  }
+  SECTION("Disjoint ranges are ordered") {
+    auto [order_before, adjacent_before] =
+        range_compare<TestType>(range, make_range<TestType>(30, 40));
+    CHECK(order_before == -1);
+    CHECK(!adjacent_before);
+    auto [order_after, adjacent_after] =
+        range_compare<TestType>(range, make_range<TestType>(0, 5));
+    CHECK(order_after == 1);
+    CHECK(!adjacent_after);
+  }
+}
+
+TEMPLATE_TEST_CASE(
+    "Test range_compare adjacency on integral ranges",
+    "[range-operations]",
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t) {
+  Range range = make_range<TestType>(10, 20);
+  SECTION("Ranges separated by no element are adjacent") {
+    auto [order, adjacent] =
+        range_compare<TestType>(range, make_range<TestType>(21, 30));
+    CHECK(order == -1);
+    CHECK(adjacent);
+  }
+  SECTION("Ranges separated by one element are not adjacent") {
+    auto [order, adjacent] =
+        range_compare<TestType>(range, make_range<TestType>(22, 30));
+    CHECK(order == -1);
+    CHECK(!adjacent);
+  }
+  SECTION("Adjacency at the maximum value does not overflow") {
+    constexpr TestType max_value = std::numeric_limits<TestType>::max();
+    auto [order, adjacent] = range_compare<TestType>(
+        make_range<TestType>(max_value, max_value), range);
+    CHECK(order == 1);
+    CHECK(!adjacent);
+  }
+}
+
+TEMPLATE_TEST_CASE(
+    "Test range_compare adjacency on floating point ranges",
+    "[range-operations]",
+    float,
+    double) {
+  // Floating point ranges are never adjacent, even at consecutive
+  // representable values.
+  auto upper_start = std::nextafter(
+      TestType{20}, std::numeric_limits<TestType>::max());
+  auto [order, adjacent] = range_compare<TestType>(
+      make_range<TestType>(10, 20), make_range<TestType>(upper_start, 30));
+  CHECK(order == -1);
+  CHECK(!adjacent);
+}
+
+TEMPLATE_TEST_CASE(
+    "Test intersection",
+    "[range-operations]",
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+    float,
+    double) {
+  Range range = make_range<TestType>(10, 20);
+  SECTION("Partial overlap crops both bounds") {
+    Range other = make_range<TestType>(15, 30);
+    intersection<TestType>(range, other);
+    CHECK(other.start_as<TestType>() == 15);
+    CHECK(other.end_as<TestType>() == 20);
+  }
+  SECTION("A subset is left unchanged") {
+    Range other = make_range<TestType>(12, 15);
+    intersection<TestType>(range, other);
+    CHECK(other.start_as<TestType>() == 12);
+    CHECK(other.end_as<TestType>() == 15);
+  }
+}
+
+TEMPLATE_TEST_CASE(
+    "Test range_union",
+    "[range-operations]",
+    int8_t,
+    int16_t,
+    int32_t,
+    int64_t,
+    uint8_t,
+    uint16_t,
+    uint32_t,
+    uint64_t,
+    float,
+    double) {
+  SECTION("Intersecting ranges merge") {
+    Range range = make_range<TestType>(10, 20);
+    REQUIRE(range_union<TestType>(range, make_range<TestType>(15, 30)));
+    CHECK(range.start_as<TestType>() == 10);
+    CHECK(range.end_as<TestType>() == 30);
+  }
+  SECTION("A nested range does not shrink the result") {
+    Range range = make_range<TestType>(10, 20);
+    REQUIRE(range_union<TestType>(range, make_range<TestType>(12, 15)));
+    CHECK(range.start_as<TestType>() == 10);
+    CHECK(range.end_as<TestType>() == 20);
+  }
+  SECTION("Separated ranges do not merge") {
+    Range range = make_range<TestType>(10, 20);
+    REQUIRE(!range_union<TestType>(range, make_range<TestType>(30, 40)));
+    CHECK(range.start_as<TestType>() == 10);
+    CHECK(range.end_as<TestType>() == 20);
+  }
+  SECTION("Adjacent ranges merge only for integral types") {
+    Range range = make_range<TestType>(10, 20);
+    auto merged = range_union<TestType>(range, make_range<TestType>(21, 30));
+    if constexpr (std::is_integral_v<TestType>) {
+      REQUIRE(merged);
+      CHECK(range.start_as<TestType>() == 10);
+      CHECK(range.end_as<TestType>() == 30);
+    } else {
+      REQUIRE(!merged);
+      CHECK(range.end_as<TestType>() == 20);
+    }
+  }
+}
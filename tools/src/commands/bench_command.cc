@@ -0,0 +1,372 @@
+/**
+ * @file   bench_command.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the bench command.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "commands/bench_command.h"
+
+#include "tiledb/sm/cpp_api/tiledb"
+
+namespace tiledb {
+namespace cli {
+
+namespace {
+
+/**
+ * Synthetic array generator and scenario runner. The array has `dim_num`
+ * uint64 dimensions and one uint64 attribute; every dimension but the
+ * first spans a single tile, so a row-major enumeration of a fragment's
+ * slab of rows is also its global order.
+ */
+class BenchArray {
+ public:
+  BenchArray(
+      const std::string& uri,
+      unsigned dim_num,
+      unsigned fragment_num,
+      uint64_t cells_per_fragment,
+      uint64_t tile_extent)
+      : uri_(uri)
+      , dim_num_(dim_num)
+      , fragment_num_(fragment_num)
+      , tile_extent_(tile_extent) {
+    slab_cells_ = 1;
+    for (unsigned d = 1; d < dim_num_; d++) {
+      slab_cells_ *= tile_extent_;
+    }
+    rows_per_fragment_ =
+        std::max<uint64_t>(1, cells_per_fragment / slab_cells_);
+    row_num_ = rows_per_fragment_ * fragment_num_;
+  }
+
+  /** Removes the array if it exists. */
+  void remove() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(uri_)) {
+      vfs.remove_dir(uri_);
+    }
+  }
+
+  /** Creates the array. */
+  void create(bool sparse) {
+    Domain domain(ctx_);
+    domain.add_dimension(Dimension::create<uint64_t>(
+        ctx_, "d1", {{1, row_num_}}, std::min(tile_extent_, row_num_)));
+    for (unsigned d = 1; d < dim_num_; d++) {
+      domain.add_dimension(Dimension::create<uint64_t>(
+          ctx_,
+          "d" + std::to_string(d + 1),
+          {{1, tile_extent_}},
+          tile_extent_));
+    }
+
+    ArraySchema schema(ctx_, sparse ? TILEDB_SPARSE : TILEDB_DENSE);
+    schema.set_domain(domain);
+    schema.add_attribute(Attribute::create<uint64_t>(ctx_, "a"));
+    if (sparse) {
+      schema.set_allows_dups(true);
+      schema.set_capacity(tile_extent_ * slab_cells_);
+    }
+
+    Array::create(uri_, schema);
+  }
+
+  /** Writes one dense fragment covering the fragment's slab of rows. */
+  void write_dense_fragment(unsigned f) {
+    std::vector<uint64_t> data(rows_per_fragment_ * slab_cells_);
+    std::iota(data.begin(), data.end(), f * data.size());
+
+    Array array(ctx_, uri_, TILEDB_WRITE);
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_subarray(slab_subarray(array, f))
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_data_buffer("a", data);
+    query.submit();
+    array.close();
+  }
+
+  /**
+   * Writes one sparse fragment of uniformly random coordinates, with an
+   * unordered write. The generator is seeded with the fragment index, so
+   * the data is reproducible across runs and builds.
+   */
+  void write_sparse_fragment(unsigned f) {
+    const uint64_t cell_num = rows_per_fragment_ * slab_cells_;
+    std::mt19937_64 rng(f);
+    std::uniform_int_distribution<uint64_t> row_dist(1, row_num_);
+    std::uniform_int_distribution<uint64_t> col_dist(1, tile_extent_);
+
+    std::vector<std::vector<uint64_t>> coords(dim_num_);
+    for (unsigned d = 0; d < dim_num_; d++) {
+      coords[d].reserve(cell_num);
+    }
+    for (uint64_t c = 0; c < cell_num; c++) {
+      coords[0].emplace_back(row_dist(rng));
+      for (unsigned d = 1; d < dim_num_; d++) {
+        coords[d].emplace_back(col_dist(rng));
+      }
+    }
+
+    std::vector<uint64_t> data(cell_num);
+    std::iota(data.begin(), data.end(), f * cell_num);
+
+    Array array(ctx_, uri_, TILEDB_WRITE);
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_UNORDERED).set_data_buffer("a", data);
+    for (unsigned d = 0; d < dim_num_; d++) {
+      query.set_data_buffer("d" + std::to_string(d + 1), coords[d]);
+    }
+    query.submit();
+    array.close();
+  }
+
+  /**
+   * Writes one sparse fragment with a global order write: the structured
+   * coordinates of the fragment's slab of rows, enumerated row-major.
+   */
+  void write_global_order_fragment(unsigned f) {
+    const uint64_t cell_num = rows_per_fragment_ * slab_cells_;
+    std::vector<std::vector<uint64_t>> coords(dim_num_);
+    for (unsigned d = 0; d < dim_num_; d++) {
+      coords[d].reserve(cell_num);
+    }
+    for (uint64_t c = 0; c < cell_num; c++) {
+      uint64_t rem = c;
+      for (unsigned d = dim_num_ - 1; d >= 1; d--) {
+        coords[d].emplace_back(1 + (rem % tile_extent_));
+        rem /= tile_extent_;
+      }
+      coords[0].emplace_back(1 + f * rows_per_fragment_ + rem);
+    }
+
+    std::vector<uint64_t> data(cell_num);
+    std::iota(data.begin(), data.end(), f * cell_num);
+
+    Array array(ctx_, uri_, TILEDB_WRITE);
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_GLOBAL_ORDER).set_data_buffer("a", data);
+    for (unsigned d = 0; d < dim_num_; d++) {
+      query.set_data_buffer("d" + std::to_string(d + 1), coords[d]);
+    }
+    query.submit();
+    query.finalize();
+    array.close();
+  }
+
+  /** Reads the full domain back. */
+  void read_all(bool sparse) {
+    const uint64_t cell_num = row_num_ * slab_cells_;
+    std::vector<uint64_t> data(cell_num);
+
+    Array array(ctx_, uri_, TILEDB_READ);
+    Query query(ctx_, array);
+    Subarray subarray(ctx_, array);
+    subarray.add_range<uint64_t>(0, 1, row_num_);
+    for (unsigned d = 1; d < dim_num_; d++) {
+      subarray.add_range<uint64_t>(d, 1, tile_extent_);
+    }
+    query.set_subarray(subarray)
+        .set_layout(sparse ? TILEDB_UNORDERED : TILEDB_ROW_MAJOR)
+        .set_data_buffer("a", data);
+
+    std::vector<std::vector<uint64_t>> coords(sparse ? dim_num_ : 0);
+    for (unsigned d = 0; d < coords.size(); d++) {
+      coords[d].resize(cell_num);
+      query.set_data_buffer("d" + std::to_string(d + 1), coords[d]);
+    }
+
+    do {
+      query.submit();
+    } while (query.query_status() == Query::Status::INCOMPLETE);
+    array.close();
+  }
+
+  /** Consolidates the array's fragments. */
+  void consolidate() {
+    Array::consolidate(ctx_, uri_);
+  }
+
+ private:
+  /** Returns the subarray of a dense fragment's slab of rows. */
+  Subarray slab_subarray(Array& array, unsigned f) {
+    Subarray subarray(ctx_, array);
+    subarray.add_range<uint64_t>(
+        0, 1 + f * rows_per_fragment_, (f + 1) * rows_per_fragment_);
+    for (unsigned d = 1; d < dim_num_; d++) {
+      subarray.add_range<uint64_t>(d, 1, tile_extent_);
+    }
+    return subarray;
+  }
+
+  const std::string uri_;
+  const unsigned dim_num_;
+  const unsigned fragment_num_;
+  const uint64_t tile_extent_;
+  uint64_t slab_cells_;
+  uint64_t rows_per_fragment_;
+  uint64_t row_num_;
+
+  Context ctx_;
+};
+
+}  // namespace
+
+clipp::group BenchCommand::get_cli() {
+  using namespace clipp;
+  auto cli =
+      (one_of(
+           command("dense-write").set(scenario_, Scenario::DenseWrite) %
+               "Writes dense fragments in row-major order.",
+           command("dense-read").set(scenario_, Scenario::DenseRead) %
+               "Full read of a pre-written dense array.",
+           command("sparse-write").set(scenario_, Scenario::SparseWrite) %
+               "Unordered writes of random sparse fragments.",
+           command("sparse-read").set(scenario_, Scenario::SparseRead) %
+               "Full read of a pre-written sparse array.",
+           command("global-order-write")
+                   .set(scenario_, Scenario::GlobalOrderWrite) %
+               "Global order writes of sparse fragments.",
+           command("consolidation").set(scenario_, Scenario::Consolidation) %
+               "Consolidates the fragments of a sparse array."),
+       option("-a", "--array").doc("URI to benchmark against") &
+           value("uri", array_uri_),
+       option("-d", "--dims").doc("Number of dimensions (default 2)") &
+           value("N", dim_num_),
+       option("-f", "--fragments").doc("Number of fragments (default 4)") &
+           value("N", fragment_num_),
+       option("-c", "--cells")
+               .doc("Number of cells per fragment (default 1048576)") &
+           value("N", cells_per_fragment_),
+       option("-e", "--tile-extent").doc("Tile extent (default 1024)") &
+           value("N", tile_extent_),
+       option("-n", "--trials").doc("Number of timed trials (default 3)") &
+           value("N", trials_),
+       option("-m", "--memfs")
+               .set(memfs_, true)
+               .doc("Run against the in-memory filesystem to take local "
+                    "disk I/O out of the measurement"));
+  return cli;
+}
+
+std::string BenchCommand::array_uri() const {
+  if (!array_uri_.empty()) {
+    return array_uri_;
+  }
+  return memfs_ ? "mem://tiledb_bench_array" : "tiledb_bench_array";
+}
+
+uint64_t BenchCommand::run_trial() const {
+  BenchArray array(
+      array_uri(), dim_num_, fragment_num_, cells_per_fragment_, tile_extent_);
+
+  const bool sparse = scenario_ != Scenario::DenseWrite &&
+                      scenario_ != Scenario::DenseRead;
+
+  // Untimed setup: every trial starts from a fresh array, and the read and
+  // consolidation scenarios from a fully populated one.
+  array.remove();
+  array.create(sparse);
+  if (scenario_ == Scenario::DenseRead) {
+    for (unsigned f = 0; f < fragment_num_; f++) {
+      array.write_dense_fragment(f);
+    }
+  } else if (
+      scenario_ == Scenario::SparseRead ||
+      scenario_ == Scenario::Consolidation) {
+    for (unsigned f = 0; f < fragment_num_; f++) {
+      array.write_sparse_fragment(f);
+    }
+  }
+
+  // Timed portion.
+  auto t0 = std::chrono::steady_clock::now();
+  switch (scenario_) {
+    case Scenario::DenseWrite:
+      for (unsigned f = 0; f < fragment_num_; f++) {
+        array.write_dense_fragment(f);
+      }
+      break;
+    case Scenario::DenseRead:
+      array.read_all(false);
+      break;
+    case Scenario::SparseWrite:
+      for (unsigned f = 0; f < fragment_num_; f++) {
+        array.write_sparse_fragment(f);
+      }
+      break;
+    case Scenario::SparseRead:
+      array.read_all(true);
+      break;
+    case Scenario::GlobalOrderWrite:
+      for (unsigned f = 0; f < fragment_num_; f++) {
+        array.write_global_order_fragment(f);
+      }
+      break;
+    case Scenario::Consolidation:
+      array.consolidate();
+      break;
+    default:
+      break;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+
+  array.remove();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0)
+      .count();
+}
+
+void BenchCommand::run() {
+  if (scenario_ == Scenario::None) {
+    return;
+  }
+
+  std::vector<uint64_t> times_ms;
+  for (unsigned trial = 0; trial < trials_; trial++) {
+    const uint64_t ms = run_trial();
+    times_ms.emplace_back(ms);
+    std::cout << "{ \"trial\": " << trial << ", \"runtime_ms\": " << ms
+              << " }" << std::endl;
+  }
+
+  std::cout << "{ \"min_runtime_ms\": "
+            << *std::min_element(times_ms.begin(), times_ms.end()) << " }"
+            << std::endl;
+}
+
+}  // namespace cli
+}  // namespace tiledb
@@ -0,0 +1,102 @@
+/**
+ * @file   bench_command.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the bench command.
+ */
+
+#ifndef TILEDB_CLI_BENCH_COMMAND_H
+#define TILEDB_CLI_BENCH_COMMAND_H
+
+#include "commands/command.h"
+
+#include <string>
+
+namespace tiledb {
+namespace cli {
+
+/**
+ * Command that runs end-to-end query benchmark scenarios on synthetic
+ * arrays. Array generation is deterministic (fixed seed), so two builds
+ * given the same parameters benchmark identical workloads.
+ */
+class BenchCommand : public Command {
+ public:
+  /** Get the CLI for this command instance. */
+  clipp::group get_cli();
+
+  /** Runs this bench command. */
+  void run();
+
+ private:
+  /** Benchmark scenarios. */
+  enum class Scenario {
+    None,
+    DenseWrite,
+    DenseRead,
+    SparseWrite,
+    SparseRead,
+    GlobalOrderWrite,
+    Consolidation
+  };
+
+  /** Scenario to run. */
+  Scenario scenario_ = Scenario::None;
+
+  /** Array URI; empty selects a default local or in-memory URI. */
+  std::string array_uri_;
+
+  /** Number of dimensions of the synthetic array. */
+  unsigned dim_num_ = 2;
+
+  /** Number of fragments to write. */
+  unsigned fragment_num_ = 4;
+
+  /** Number of cells per fragment. */
+  uint64_t cells_per_fragment_ = 1048576;
+
+  /** Tile extent of every dimension. */
+  uint64_t tile_extent_ = 1024;
+
+  /** Number of timed trials. */
+  unsigned trials_ = 3;
+
+  /** Run against the in-memory filesystem instead of local disk. */
+  bool memfs_ = false;
+
+  /** Returns the URI to benchmark against. */
+  std::string array_uri() const;
+
+  /** Runs a single trial and returns its time in milliseconds. */
+  uint64_t run_trial() const;
+};
+
+}  // namespace cli
+}  // namespace tiledb
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file   tiledb_bench.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Command-line harness for end-to-end query benchmarks on synthetic
+ * arrays.
+ */
+
+#include <clipp.h>
+
+#include <iostream>
+
+#include "commands/bench_command.h"
+
+using namespace tiledb::cli;
+
+int main(int argc, char** argv) {
+  BenchCommand bench;
+  auto cli = bench.get_cli();
+
+  if (!clipp::parse(argc, argv, cli)) {
+    auto cli_format = clipp::doc_formatting{}.first_column(4).doc_column(30);
+    std::cout << clipp::make_man_page(cli, "tiledb_bench", cli_format)
+                     .prepend_section(
+                         "DESCRIPTION",
+                         "Runs end-to-end query benchmark scenarios on "
+                         "synthetic arrays. Choose a scenario:")
+              << std::endl;
+    return 1;
+  }
+
+  bench.run();
+  return 0;
+}